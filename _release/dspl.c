@@ -63,13 +63,23 @@ p_conv_fft                              conv_fft                      ;
 p_conv_fft_cmplx                        conv_fft_cmplx                ;
 p_cos_cmplx                             cos_cmplx                     ;
 
+p_czt_cmplx                             czt_cmplx                     ;
+p_czt_create                            czt_create                    ;
+p_czt_free                              czt_free                      ;
+p_dct_batch                             dct_batch                     ;
+p_dct2                                  dct2                          ;
+p_dct3                                  dct3                          ;
+p_dct4                                  dct4                          ;
 p_decimate                              decimate                      ;
 p_decimate_cmplx                        decimate_cmplx                ;
 p_dft                                   dft                           ;
 p_dft_cmplx                             dft_cmplx                     ;
 p_dmod                                  dmod                          ;
+p_dspl_get_isa                          dspl_get_isa                  ;
 p_dspl_info                             dspl_info                     ;
+p_dspl_set_isa                          dspl_set_isa                  ;
 
+p_dst                                   dst                           ;
 p_ellip_acd                             ellip_acd                     ;
 p_ellip_acd_cmplx                       ellip_acd_cmplx               ;
 p_ellip_ap                              ellip_ap                      ;
@@ -89,20 +99,52 @@ p_farrow_spline                         farrow_spline                 ;
 p_fft                                   fft                           ;
 p_fft_abs                               fft_abs                       ;
 p_fft_abs_cmplx                         fft_abs_cmplx                 ;
+p_fft_batch                             fft_batch                     ;
+p_fft_bind                              fft_bind                      ;
+p_fft_cache_set_size                    fft_cache_set_size            ;
+p_fft_cache_stat                        fft_cache_stat                ;
 p_fft_cmplx                             fft_cmplx                     ;
+p_fft_cmplx_batch                       fft_cmplx_batch               ;
+p_fft_cmplx_pruned                      fft_cmplx_pruned              ;
 p_fft_create                            fft_create                    ;
 p_fft_free                              fft_free                      ;
+p_fft_get_isa                           fft_get_isa                   ;
 p_fft_mag                               fft_mag                       ;
 p_fft_mag_cmplx                         fft_mag_cmplx                 ;
+p_fft_plan_create                       fft_plan_create               ;
+p_fft_plan_free                         fft_plan_free                 ;
+p_fft_r2c                               fft_r2c                       ;
+p_fft_set_isa                           fft_set_isa                   ;
+p_fft_set_threads                       fft_set_threads               ;
 p_fft_shift                             fft_shift                     ;
 p_fft_shift_cmplx                       fft_shift_cmplx               ;
+p_fft_wisdom_clear                      fft_wisdom_clear              ;
+p_fft_wisdom_load                       fft_wisdom_load               ;
+p_fft_wisdom_measure                    fft_wisdom_measure            ;
+p_fft_wisdom_save                       fft_wisdom_save               ;
+p_fft2                                  fft2                          ;
+p_fft2_cmplx                            fft2_cmplx                    ;
+p_fftf                                  fftf                          ;
+p_fftf_cmplx                            fftf_cmplx                    ;
+p_fftf_create                           fftf_create                   ;
+p_fftf_free                             fftf_free                     ;
+p_filter_fir_multi                      filter_fir_multi              ;
 p_filter_freq_resp                      filter_freq_resp              ;
 p_filter_iir                            filter_iir                    ;
+p_filter_iir_multi                      filter_iir_multi              ;
+p_filter_sos                            filter_sos                    ;
+p_filter_tf2sos                         filter_tf2sos                 ;
 p_filter_ws1                            filter_ws1                    ;
 p_filter_zp2ab                          filter_zp2ab                  ;
+p_filter_zp2sos                         filter_zp2sos                 ;
 p_find_max_abs                          find_max_abs                  ;
 p_find_nearest                          find_nearest                  ;
+p_fir_create                            fir_create                    ;
+p_fir_create_multi                      fir_create_multi              ;
+p_fir_filter                            fir_filter                    ;
+p_fir_free                              fir_free                      ;
 p_fir_linphase                          fir_linphase                  ;
+p_fir_reset                             fir_reset                     ;
 p_flipip                                flipip                        ;
 p_flipip_cmplx                          flipip_cmplx                  ;
 p_fourier_integral_cmplx                fourier_integral_cmplx        ;
@@ -120,15 +162,32 @@ p_gnuplot_create                        gnuplot_create                ;
 p_gnuplot_open                          gnuplot_open                  ;
 p_goertzel                              goertzel                      ;
 p_goertzel_cmplx                        goertzel_cmplx                ;
+p_goertzel_create                       goertzel_create               ;
+p_goertzel_free                         goertzel_free                 ;
+p_goertzel_reset                        goertzel_reset                ;
+p_goertzel_result                       goertzel_result               ;
+p_goertzel_update                       goertzel_update               ;
+p_goertzel_update_cmplx                 goertzel_update_cmplx         ;
 p_group_delay                           group_delay                   ;
 
 p_histogram                             histogram                     ;
 p_histogram_norm                        histogram_norm                ;
 
 p_idft_cmplx                            idft_cmplx                    ;
+p_ifft                                  ifft                          ;
 p_ifft_cmplx                            ifft_cmplx                    ;
+p_ifft_cmplx_pruned                     ifft_cmplx_pruned             ;
+p_ifft2_cmplx                           ifft2_cmplx                   ;
+p_ifftf_cmplx                           ifftf_cmplx                   ;
 p_iir                                   iir                           ;
 
+p_iir_create                            iir_create                    ;
+p_iir_create_multi                      iir_create_multi              ;
+p_iir_filter                            iir_filter                    ;
+p_iir_free                              iir_free                      ;
+p_iir_reset                             iir_reset                     ;
+p_iir_sos                               iir_sos                       ;
+p_istft                                 istft                         ;
 p_linspace                              linspace                      ;
 p_log_cmplx                             log_cmplx                     ;
 p_logspace                              logspace                      ;
@@ -152,6 +211,8 @@ p_mean                                  mean                          ;
 p_mean_cmplx                            mean_cmplx                    ;
 p_minmax                                minmax                        ;
 
+p_nufft1_cmplx                          nufft1_cmplx                  ;
+p_nufft2_cmplx                          nufft2_cmplx                  ;
 p_ones                                  ones                          ;
 
 p_phase_delay                           phase_delay                   ;
@@ -177,14 +238,27 @@ p_ratcompos                             ratcompos                     ;
 p_re2cmplx                              re2cmplx                      ;
 p_readbin                               readbin                       ;
 
+p_sdft_create                           sdft_create                   ;
+p_sdft_free                             sdft_free                     ;
+p_sdft_push                             sdft_push                     ;
 p_signal_pimp                           signal_pimp                   ;
 p_signal_saw                            signal_saw                    ;
 p_sin_cmplx                             sin_cmplx                     ;
 p_sinc                                  sinc                          ;
 p_sine_int                              sine_int                      ;
+p_sos_create                            sos_create                    ;
+p_sos_filter                            sos_filter                    ;
+p_sos_free                              sos_free                      ;
+p_sos_reset                             sos_reset                     ;
+p_spectrogram                           spectrogram                   ;
+p_spectrogram_push                      spectrogram_push              ;
 p_sqrt_cmplx                            sqrt_cmplx                    ;
 p_stat_std                              stat_std                      ;
 p_stat_std_cmplx                        stat_std_cmplx                ;
+p_stft                                  stft                          ;
+p_stft_create                           stft_create                   ;
+p_stft_free                             stft_free                     ;
+p_stft_push                             stft_push                     ;
 p_sum                                   sum                           ;
 p_sum_sqr                               sum_sqr                       ;
 
@@ -212,6 +286,7 @@ p_writetxt_int                          writetxt_int                  ;
 
 p_xcorr                                 xcorr                         ;
 p_xcorr_cmplx                           xcorr_cmplx                   ;
+p_zoom_fft                              zoom_fft                      ;
 
 
 #ifdef WIN_OS
@@ -284,13 +359,23 @@ void* dspl_load()
     LOAD_FUNC(conv_fft_cmplx);
     LOAD_FUNC(cos_cmplx);
     
+    LOAD_FUNC(czt_cmplx);
+    LOAD_FUNC(czt_create);
+    LOAD_FUNC(czt_free);
+    LOAD_FUNC(dct_batch);
+    LOAD_FUNC(dct2);
+    LOAD_FUNC(dct3);
+    LOAD_FUNC(dct4);
     LOAD_FUNC(decimate);
     LOAD_FUNC(decimate_cmplx);
     LOAD_FUNC(dft);
     LOAD_FUNC(dft_cmplx);
     LOAD_FUNC(dmod);
+    LOAD_FUNC(dspl_get_isa);
     LOAD_FUNC(dspl_info);
+    LOAD_FUNC(dspl_set_isa);
     
+    LOAD_FUNC(dst);
     LOAD_FUNC(ellip_acd);
     LOAD_FUNC(ellip_acd_cmplx);
     LOAD_FUNC(ellip_ap);
@@ -308,20 +393,52 @@ void* dspl_load()
     LOAD_FUNC(farrow_lagrange);
     LOAD_FUNC(farrow_spline);
     LOAD_FUNC(fft);
+    LOAD_FUNC(fft_batch);
+    LOAD_FUNC(fft_bind);
+    LOAD_FUNC(fft_cache_set_size);
+    LOAD_FUNC(fft_cache_stat);
     LOAD_FUNC(fft_cmplx);
+    LOAD_FUNC(fft_cmplx_batch);
+    LOAD_FUNC(fft_cmplx_pruned);
     LOAD_FUNC(fft_create);
     LOAD_FUNC(fft_free);
+    LOAD_FUNC(fft_get_isa);
     LOAD_FUNC(fft_mag);
     LOAD_FUNC(fft_mag_cmplx);
+    LOAD_FUNC(fft_plan_create);
+    LOAD_FUNC(fft_plan_free);
+    LOAD_FUNC(fft_r2c);
+    LOAD_FUNC(fft_set_isa);
+    LOAD_FUNC(fft_set_threads);
     LOAD_FUNC(fft_shift);
     LOAD_FUNC(fft_shift_cmplx);
+    LOAD_FUNC(fft_wisdom_clear);
+    LOAD_FUNC(fft_wisdom_load);
+    LOAD_FUNC(fft_wisdom_measure);
+    LOAD_FUNC(fft_wisdom_save);
+    LOAD_FUNC(fft2);
+    LOAD_FUNC(fft2_cmplx);
+    LOAD_FUNC(fftf);
+    LOAD_FUNC(fftf_cmplx);
+    LOAD_FUNC(fftf_create);
+    LOAD_FUNC(fftf_free);
+    LOAD_FUNC(filter_fir_multi);
     LOAD_FUNC(filter_freq_resp);
     LOAD_FUNC(filter_iir);
+    LOAD_FUNC(filter_iir_multi);
+    LOAD_FUNC(filter_sos);
+    LOAD_FUNC(filter_tf2sos);
     LOAD_FUNC(filter_ws1);
     LOAD_FUNC(filter_zp2ab);
+    LOAD_FUNC(filter_zp2sos);
     LOAD_FUNC(find_max_abs);
     LOAD_FUNC(find_nearest);
+    LOAD_FUNC(fir_create);
+    LOAD_FUNC(fir_create_multi);
+    LOAD_FUNC(fir_filter);
+    LOAD_FUNC(fir_free);
     LOAD_FUNC(fir_linphase);
+    LOAD_FUNC(fir_reset);
     LOAD_FUNC(flipip);
     LOAD_FUNC(flipip_cmplx);
     LOAD_FUNC(fourier_integral_cmplx);
@@ -339,15 +456,32 @@ void* dspl_load()
     LOAD_FUNC(gnuplot_open);
     LOAD_FUNC(goertzel);
     LOAD_FUNC(goertzel_cmplx);
+    LOAD_FUNC(goertzel_create);
+    LOAD_FUNC(goertzel_free);
+    LOAD_FUNC(goertzel_reset);
+    LOAD_FUNC(goertzel_result);
+    LOAD_FUNC(goertzel_update);
+    LOAD_FUNC(goertzel_update_cmplx);
     LOAD_FUNC(group_delay);
     
     LOAD_FUNC(histogram);
     LOAD_FUNC(histogram_norm);
     
     LOAD_FUNC(idft_cmplx);
+    LOAD_FUNC(ifft);
     LOAD_FUNC(ifft_cmplx);
+    LOAD_FUNC(ifft_cmplx_pruned);
+    LOAD_FUNC(ifft2_cmplx);
+    LOAD_FUNC(ifftf_cmplx);
     LOAD_FUNC(iir);
     
+    LOAD_FUNC(iir_create);
+    LOAD_FUNC(iir_create_multi);
+    LOAD_FUNC(iir_filter);
+    LOAD_FUNC(iir_free);
+    LOAD_FUNC(iir_reset);
+    LOAD_FUNC(iir_sos);
+    LOAD_FUNC(istft);
     LOAD_FUNC(linspace);
     LOAD_FUNC(log_cmplx);
     LOAD_FUNC(logspace);
@@ -371,6 +505,8 @@ void* dspl_load()
     LOAD_FUNC(mean_cmplx);
     LOAD_FUNC(minmax);
     
+    LOAD_FUNC(nufft1_cmplx);
+    LOAD_FUNC(nufft2_cmplx);
     LOAD_FUNC(ones);
     
     LOAD_FUNC(phase_delay);
@@ -396,14 +532,27 @@ void* dspl_load()
     LOAD_FUNC(re2cmplx);
     LOAD_FUNC(readbin);
     
+    LOAD_FUNC(sdft_create);
+    LOAD_FUNC(sdft_free);
+    LOAD_FUNC(sdft_push);
     LOAD_FUNC(signal_pimp);
     LOAD_FUNC(signal_saw);
     LOAD_FUNC(sin_cmplx);
     LOAD_FUNC(sinc);
     LOAD_FUNC(sine_int);
+    LOAD_FUNC(sos_create);
+    LOAD_FUNC(sos_filter);
+    LOAD_FUNC(sos_free);
+    LOAD_FUNC(sos_reset);
+    LOAD_FUNC(spectrogram);
+    LOAD_FUNC(spectrogram_push);
     LOAD_FUNC(sqrt_cmplx);
     LOAD_FUNC(stat_std);
     LOAD_FUNC(stat_std_cmplx);
+    LOAD_FUNC(stft);
+    LOAD_FUNC(stft_create);
+    LOAD_FUNC(stft_free);
+    LOAD_FUNC(stft_push);
     LOAD_FUNC(sum);
     LOAD_FUNC(sum_sqr);
     
@@ -431,6 +580,7 @@ void* dspl_load()
     
     LOAD_FUNC(xcorr);
     LOAD_FUNC(xcorr_cmplx);
+    LOAD_FUNC(zoom_fft);
 
     
     #ifdef WIN_OS
@@ -38,6 +38,8 @@ Function convolves two real vectors \f$ c = a * b\f$ length `na` and `nb`
 in the frequency domain by using FFT algorithms. This approach provide 
 high-performance convolution which increases with `na` and `nb` increasing.
 The output convolution is a vector `c` with length equal to  `na + nb - 1`. 
+Sections are transformed by the real FFT \ref fft_r2c and the real 
+IFFT \ref ifft of the non-redundant spectrum half. 
 
 \param[in]  a
 Pointer to the first vector `a`. \n
@@ -115,6 +117,8 @@ c[ 18] =     72.00    d[ 18] =     72.00
 Функция рассчитывает линейную свертку двух векторов \f$ c = a * b\f$ используя
 секционную обработку с перекрытием в частотной области. Это позволяет сократить 
 вычислительные операции при расчете длинных сверток.
+Секции преобразуются вещественным БПФ \ref fft_r2c и вещественным
+ОБПФ \ref ifft неизбыточной половины спектра.
 
 \param[in]  a
 Указатель на первый вектор  \f$a\f$. \n 
@@ -145,8 +149,8 @@ c[ 18] =     72.00    d[ 18] =     72.00
 Например если `na=10`, а `nb=4`, то параметр `nfft` должен быть больше 4. \n 
 Библиотека поддерживает алгоритмы БПФ составной длины
 \f$n = n_0 \times n_1 \times n_2 \times \ldots \times n_p \times m\f$,
-где \f$n_i = 2,3,5,7\f$, а \f$m \f$ --- произвольный простой множитель 
-не превосходящий 46340 (см. описание функции \ref fft_create).
+где \f$n_i = 2,3,5,7\f$, а \f$m \f$ --- произвольный множитель
+(см. описание функции \ref fft_create).
 Однако, максимальное быстродействие достигается при использовании длин равных 
 степени двойки.
 
@@ -198,34 +202,111 @@ c[ 18] =     72.00    d[ 18] =     72.00
 int DSPL_API conv_fft(double* a, int na, double* b, int nb,
                       fft_t* pfft, int nfft, double* c)
 {
-    complex_t *pa = NULL, *pb = NULL, *pc = NULL;
-    int err;
-    
+    int La, Lb, Lc, Nz, Nh, n, p0, p1, ind, err;
+    double *pa, *pb, *pt, re;
+    complex_t *pA, *pB;
+
     if(!a || !b || !c || !pfft)
         return ERROR_PTR;
     if(na<1 || nb < 1)
         return ERROR_SIZE;
     if(nfft<2)
         return ERROR_FFT_SIZE;
-    
-    pa = (complex_t*) malloc(na*sizeof(complex_t));
-    pb = (complex_t*) malloc(nb*sizeof(complex_t));
-    pc = (complex_t*) malloc((na+nb-1)*sizeof(complex_t));
-    
-    re2cmplx(a, na, pa);
-    re2cmplx(b, nb, pb);
-    
-    err = conv_fft_cmplx(pa, na, pb, nb, pfft, nfft, pc);
+
+    if(na >= nb)
+    {
+        La = na;
+        Lb = nb;
+        pa = a;
+        pb = b;
+    }
+    else
+    {
+        La = nb;
+        pa = b;
+        Lb = na;
+        pb = a;
+    }
+
+    Lc = La + Lb - 1;
+    Nz = nfft - Lb;
+    Nh = nfft/2 + 1;
+
+    if(Nz <= 0)
+        return ERROR_FFT_SIZE;
+
+    /* real FFT and real IFFT of the spectrum half */
+    pt = (double*)   malloc(nfft*sizeof(double));
+    pB = (complex_t*)malloc(Nh*sizeof(complex_t));
+    pA = (complex_t*)malloc(Nh*sizeof(complex_t));
+    if(!pt || !pB || !pA)
+    {
+        err = ERROR_MALLOC;
+        goto exit_label;
+    }
+
+    memset(pt, 0, nfft*sizeof(double));
+    memcpy(pt+Nz, pb, Lb*sizeof(double));
+
+    err = fft_r2c(pt, nfft, pfft, pB);
     if(err != RES_OK)
         goto exit_label;
-    
-    err = cmplx2re(pc, na+nb-1, c, NULL);
-    
+
+    p0 = -Lb;
+    p1 = p0 + nfft;
+    ind = 0;
+    while(ind < Lc)
+    {
+        if(p0 >=0)
+        {
+            if(p1 < La)
+                err = fft_r2c(pa + p0, nfft, pfft, pA);
+            else
+            {
+                memset(pt, 0, nfft*sizeof(double));
+                memcpy(pt, pa+p0, (nfft+La-p1)*sizeof(double));
+                err = fft_r2c(pt, nfft, pfft, pA);
+            }
+        }
+        else
+        {
+            memset(pt, 0, nfft*sizeof(double));
+            if(p1 < La)
+                memcpy(pt - p0, pa, (nfft+p0)*sizeof(double));
+            else
+                memcpy(pt - p0, pa, La * sizeof(double));
+            err = fft_r2c(pt, nfft, pfft, pA);
+        }
+
+        if(err != RES_OK)
+            goto exit_label;
+
+        for(n = 0; n < Nh; n++)
+        {
+            re = CMRE(pA[n], pB[n]);
+            IM(pA[n]) = CMIM(pA[n], pB[n]);
+            RE(pA[n]) = re;
+        }
+
+        if(ind+nfft < Lc)
+            err = ifft(pA, nfft, pfft, c+ind);
+        else
+        {
+            err = ifft(pA, nfft, pfft, pt);
+            memcpy(c+ind, pt, (Lc-ind)*sizeof(double));
+        }
+        if(err != RES_OK)
+            goto exit_label;
+
+        p0  += Nz;
+        p1  += Nz;
+        ind += Nz;
+    }
+
 exit_label:
-    if(pa) free(pa);
-    if(pb) free(pb);
-    if(pc) free(pc);
-    
+    if(pt) free(pt);
+    if(pB) free(pB);
+    if(pA) free(pA);
+
     return err;
 }
-
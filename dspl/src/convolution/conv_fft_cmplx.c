@@ -138,8 +138,8 @@ c[ 18] =    -37.00  +484.00j    d[ 18] =    -37.00  +484.00j
 Например если `na=10`, а `nb=4`, то параметр `nfft` должен быть больше 4. \n 
 Библиотека поддерживает алгоритмы БПФ составной длины
 \f$n = n_0 \times n_1 \times n_2 \times \ldots \times n_p \times m\f$,
-где \f$n_i = 2,3,5,7\f$, а \f$m \f$ --- произвольный простой множитель 
-не превосходящий 46340 (см. описание функции \ref fft_create).
+где \f$n_i = 2,3,5,7\f$, а \f$m \f$ --- произвольный множитель
+(см. описание функции \ref fft_create).
 Однако, максимальное быстродействие достигается при использовании длин равных 
 степени двойки.
 
@@ -241,11 +241,8 @@ int DSPL_API conv_fft_cmplx(complex_t* a, int na, complex_t* b, int nb,
             if(p1 < La)
                 err = fft_cmplx(pa + p0, nfft, pfft, pA);
             else
-            {
-                memset(pt, 0, nfft*sizeof(complex_t));
-                memcpy(pt, pa+p0, (nfft+La-p1)*sizeof(complex_t));
-                err = fft_cmplx(pt, nfft, pfft, pA);
-            }
+                err = fft_cmplx_pruned(pa + p0, nfft+La-p1, nfft, 0, nfft, 
+                                       pfft, pA);
         }
         else
         {
@@ -267,13 +264,9 @@ int DSPL_API conv_fft_cmplx(complex_t* a, int na, complex_t* b, int nb,
         }
 
 
-        if(ind+nfft < Lc)
-            err = ifft_cmplx(pC, nfft, pfft, c+ind);
-        else
-        {
-            err = ifft_cmplx(pC, nfft, pfft, pt);
-            memcpy(c+ind, pt, (Lc-ind)*sizeof(complex_t));
-        }
+        /* only the first Nz IFFT outputs are valid (output-pruned IFFT) */
+        n = ind + Nz < Lc ? Nz : Lc - ind;
+        err = ifft_cmplx_pruned(pC, nfft, nfft, 0, n, pfft, c+ind);
         if(err != RES_OK)
             goto exit_label;
         
@@ -0,0 +1,70 @@
+#ifndef CONVOLUTION_H
+#define CONVOLUTION_H
+
+
+/* fir_t direct filtering block size: the input samples are copied 
+   after the filter history and filtered by blocks of FIR_BLOCK samples */
+#define FIR_BLOCK       1024
+
+/* Minimal number of the taps of the overlap-save FFT filtering */
+#define FIR_FFT_MIN     32
+
+/* Cost of the real FFT and IFFT per point per log2(nfft) in the units 
+   of the one tap multiply-add of the direct filtering */
+#define FIR_FFT_COST    3.0
+
+/* Number of the checked overlap-save FFT sizes 2^p, 
+   starting from the least 2^p >= 2*nh */
+#define FIR_FFT_SIZES   5
+
+/* Maximal overlap-save FFT size */
+#define FIR_FFT_MAX     0x4000000
+
+
+/* Direct FIR filtering: y(k) = sum_i hr(i) x(k+i), i = 0 ... nh-1, 
+   k = 0 ... n-1, hr are the reversed filter taps */
+void fir_krn(double* hr, int nh, double* x, int n, double* y);
+
+
+/* Maximal number of vectors of the second-order sections filtered 
+   by one pass of the vector kernel. Longer cascades are filtered 
+   by several passes */
+#define SOS_SIMD_NV     3
+
+/* Minimal number of the second-order sections of the vector kernel */
+#define SOS_SIMD_MIN    2
+
+/* Minimal number of the second-order sections of the AVX-512 kernel */
+#define SOS_AVX512_MIN  13
+
+
+/* Number of the channels vectors filtered together 
+   by the multichannel FIR vector kernel */
+#define FIR_MULTI_NV    4
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FILTER_SIMD_X86
+
+/* Vector kernels of the cascade of ns <= SOS_SIMD_NV*4 (AVX2) or 
+   ns <= SOS_SIMD_NV*8 (AVX-512) second-order sections 
+   with the state w (see filter_simd_krn.h) */
+void sos_krn_avx2(double* c, double* w, int ns, 
+                  double* x, int n, double* y);
+void sos_krn_avx512(double* c, double* w, int ns, 
+                    double* x, int n, double* y);
+
+/* Multichannel IIR and FIR vector kernels for nv vectors of 4 (AVX2) 
+   or 8 (AVX-512) channels (see filter_simd_krn.h) */
+void iir_multi_krn_avx2(double* b, double* a, int ord, double* w, int nch, 
+                        int pos, int nv, double* x, int n, int ld, double* y);
+void iir_multi_krn_avx512(double* b, double* a, int ord, double* w, int nch,
+                          int pos, int nv, double* x, int n, int ld, 
+                          double* y);
+void fir_multi_krn_avx2(double* hr, int nh, double* buf, int nch, int nv, 
+                        int n, double* y, int ld);
+void fir_multi_krn_avx512(double* hr, int nh, double* buf, int nch, int nv,
+                          int n, double* y, int ld);
+#endif
+
+#endif
@@ -0,0 +1,229 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+#include "convolution.h"
+
+
+
+/* Multichannel direct FIR filtering for nc channels, the arguments 
+   are the same as of the vector kernels (see filter_simd_krn.h).
+   The taps are summed four per pass in the fir_krn order, so each channel 
+   output is equal to the direct fir_filter output bit for bit */
+static void fir_multi_krn(double* hr, int nh, double* buf, int nch, int nc,
+                          int n, double* y, int ld)
+{
+    double *p;
+    double  v;
+    int c, k, i;
+
+    for(k = 0; k < n; k++)
+    {
+        for(c = 0; c < nc; c++)
+        {
+            p = buf + k*nch + c;
+            v = 0.0;
+            for(i = 0; i + 3 < nh; i += 4)
+                v += hr[i]   * p[i*nch]       + hr[i+1] * p[(i+1)*nch] + 
+                     hr[i+2] * p[(i+2)*nch]   + hr[i+3] * p[(i+3)*nch];
+            for(; i < nh; i++)
+                v += hr[i] * p[i*nch];
+            y[k*ld + c] = v;
+        }
+    }
+}
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Multichannel streaming FIR filtering of the interleaved signal block.
+
+Function filters `n` new samples of each channel of the multichannel
+FIR filter object created by the \ref fir_create_multi function. \n
+The sample `k` of the channel `c` is `x[k*ld + c]`, so the `nch` 
+channels samples are interleaved if `ld = nch`, and the `nch` channels 
+of the wider frame of `ld` channels are filtered if `ld > nch`. \n
+The history of each channel is stored in the object, 
+so the filter has no transients between blocks. \n
+If the AVX2 or AVX-512 instruction set is selected by the 
+\ref dspl_set_isa function then the outputs of four (AVX2) or 
+eight (AVX-512) channels are calculated by one vector operation. 
+The rest channels are calculated one by one with the same taps 
+summation order as the direct calculation of the \ref fir_filter 
+function, so their outputs are equal. \n
+The one channel object is filtered by the \ref fir_filter function.
+The function does not allocate memory.
+
+\param[in,out]  pfir
+Pointer to the `fir_t` object created by the \ref fir_create_multi 
+or \ref fir_create function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[n*ld x 1]`. \n \n
+
+\param[in]  n
+Number of the new samples of each channel. \n \n
+
+\param[in]  ld
+Distance between the samples `k` and `k+1` of the channel. \n
+Must be not less than the number of the channels. \n \n
+
+\param[out]  y
+Pointer to the filter output. \n
+The output sample `k` of the channel `c` is written to `y[k*ld + c]`,
+other elements are not changed. \n
+Vector size is `[n*ld x 1]`. \n
+Memory must be allocated. \n
+The pointer can be equal to `x`. \n \n
+
+\return
+`RES_OK` if the block is filtered successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Многоканальная потоковая КИХ-фильтрация блока чередующихся отсчетов
+
+Функция фильтрует `n` новых отсчетов каждого канала объектом
+многоканального КИХ-фильтра, созданным функцией \ref fir_create_multi. \n
+Отсчет `k` канала `c` равен `x[k*ld + c]`, поэтому при `ld = nch` 
+отсчеты `nch` каналов чередуются, а при `ld > nch` фильтруются `nch` 
+каналов из кадра шириной `ld` каналов. \n
+Предыстория каждого канала хранится в объекте, поэтому 
+фильтр не имеет переходных процессов между блоками. \n
+Если функцией \ref dspl_set_isa выбран набор инструкций AVX2 или 
+AVX-512, то выходные отсчеты четырех (AVX2) или восьми (AVX-512) 
+каналов рассчитываются одной векторной операцией. 
+Остальные каналы рассчитываются по одному с тем же порядком
+суммирования, что и при прямом расчете функцией \ref fir_filter,
+поэтому их выходные отсчеты совпадают. \n
+Одноканальный объект обрабатывается функцией \ref fir_filter.
+Функция не выделяет память.
+
+\param[in,out]  pfir
+Указатель на объект `fir_t`, созданный функцией \ref fir_create_multi 
+или \ref fir_create. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[n*ld x 1]`. \n \n
+
+\param[in]  n
+Количество новых отсчетов каждого канала. \n \n
+
+\param[in]  ld
+Расстояние между отсчетами `k` и `k+1` канала. \n
+Должно быть не меньше количества каналов. \n \n
+
+\param[out]  y
+Указатель на выход фильтра. \n
+Выходной отсчет `k` канала `c` записывается в `y[k*ld + c]`,
+остальные элементы не изменяются. \n
+Размер вектора `[n*ld x 1]`. \n
+Память должна быть выделена. \n
+Указатель может совпадать с `x`. \n \n
+
+\return
+`RES_OK` если блок обработан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API filter_fir_multi(fir_t* pfir, double* x, int n, int ld, 
+                              double* y)
+{
+    double t[FIR_BLOCK];
+    double *buf;
+    int c, k, m, nch, hist, err;
+#ifdef FILTER_SIMD_X86
+    int isa, nv;
+#endif
+
+    if(!pfir || !x || !y)
+        return ERROR_PTR;
+    if(!pfir->h || n < 1 || ld < pfir->nch)
+        return ERROR_SIZE;
+
+    nch = pfir->nch;
+    if(nch == 1)
+    {
+        if(ld == 1)
+            return fir_filter(pfir, x, n, y);
+
+        /* one channel samples are copied to the contiguous blocks */
+        for(k = 0; k < n; k += m)
+        {
+            m = n - k < FIR_BLOCK ? n - k : FIR_BLOCK;
+            for(c = 0; c < m; c++)
+                t[c] = x[(k+c)*ld];
+            err = fir_filter(pfir, t, m, t);
+            if(err != RES_OK)
+                return err;
+            for(c = 0; c < m; c++)
+                y[(k+c)*ld] = t[c];
+        }
+        return RES_OK;
+    }
+
+    buf  = pfir->buf;
+    hist = (pfir->nh - 1) * nch;
+#ifdef FILTER_SIMD_X86
+    isa = dspl_get_isa();
+#endif
+    for(k = 0; k < n; k += m)
+    {
+        m = n - k < FIR_BLOCK ? n - k : FIR_BLOCK;
+        for(c = 0; c < m; c++)
+            memcpy(buf + hist + c*nch, x + (k+c)*ld, nch * sizeof(double));
+
+        c = 0;
+#ifdef FILTER_SIMD_X86
+        if(isa >= DSPL_ISA_AVX512 && nch - c >= 8)
+        {
+            nv = (nch - c) / 8;
+            fir_multi_krn_avx512(pfir->h, pfir->nh, buf + c, nch, nv, m, 
+                                 y + k*ld + c, ld);
+            c += nv * 8;
+        }
+        if(isa >= DSPL_ISA_AVX2 && nch - c >= 4)
+        {
+            nv = (nch - c) / 4;
+            fir_multi_krn_avx2(pfir->h, pfir->nh, buf + c, nch, nv, m, 
+                               y + k*ld + c, ld);
+            c += nv * 4;
+        }
+#endif
+        fir_multi_krn(pfir->h, pfir->nh, buf + c, nch, nch - c, m, 
+                      y + k*ld + c, ld);
+
+        memmove(buf, buf + m*nch, hist * sizeof(double));
+    }
+    return RES_OK;
+}
@@ -35,7 +35,11 @@ contains real coefficients of the transfer function \f$H(z)\f$
   H(z) = \frac{\sum_{n = 0}^{N} b_n  z^{-n}}
   {1+{\frac{1}{a_0}}\sum_{m = 1}^{M} a_m  z^{-n}},
 \f]
-here \f$a_0\f$ cannot be equals zeros, \f$N=M=\f$`ord`.
+here \f$a_0\f$ cannot be equals zeros, \f$N=M=\f$`ord`. \n
+The filter starts with zero initial conditions. 
+The stream filtering by blocks without transients between blocks 
+is provided by the `iir_t` object (see \ref iir_create
+and \ref iir_filter).
 
 \param[in]  b
 Pointer to the vector \f$b\f$ of IIR filter 
@@ -105,7 +109,10 @@ GNUPLOT script for make plots is:
   H(z) = \frac{\sum_{n = 0}^{N} b_n  z^{-n}}
   {1+{\frac{1}{a_0}}\sum_{m = 1}^{M} a_m  z^{-m}},
 \f]
-где \f$a_0\f$ не может быть 0, \f$N=M=\f$`ord`.
+где \f$a_0\f$ не может быть 0, \f$N=M=\f$`ord`. \n
+Фильтр начинает работу с нулевыми начальными условиями.
+Фильтрация потока по блокам без переходных процессов между блоками
+производится объектом `iir_t` (см. \ref iir_create и \ref iir_filter).
 
 \param[in]  b
 Указатель на вектор коэффициентов числителя 
@@ -165,13 +172,8 @@ dat/sf.txt - сигнал на выходе фильтра.
 int DSPL_API filter_iir(double* b, double* a, int ord,
                         double* x, int n, double* y)
 {
-    double *buf = NULL;
-    double *an  = NULL;
-    double *bn  = NULL;
-    double  u;
-    int     k;
-    int     m;
-    int     count;
+    iir_t flt = {0};
+    int   err;
 
     if(!b || !x || !y)
         return ERROR_PTR;
@@ -179,50 +181,10 @@ int DSPL_API filter_iir(double* b, double* a, int ord,
     if(ord < 1 || n < 1)
         return ERROR_SIZE;
 
-    if(a && a[0]==0.0)
-        return ERROR_FILTER_A0;
-
-    count = ord + 1;
-    buf = (double*) malloc(count*sizeof(double));
-    an =  (double*) malloc(count*sizeof(double));
-
-    memset(buf, 0, count*sizeof(double));
-
-    if(!a)
-    {
-        memset(an, 0, count*sizeof(double));
-        bn = b;
-    }
-    else
-    {
-        bn =  (double*) malloc(count*sizeof(double));
-        for(k = 0; k < count; k++)
-        {
-            an[k] = a[k] / a[0];
-            bn[k] = b[k] / a[0];
-        }
-    }
-
-    for(k = 0; k < n; k++)
-    {
-        for(m = ord; m > 0; m--)
-            buf[m] = buf[m-1];
-        u = 0.0;
-        for(m = ord; m > 0; m--)
-            u += buf[m]*an[m];
-
-        buf[0] = x[k] - u;
-        y[k] = 0.0;
-        for(m = 0; m < count; m++)
-            y[k] += buf[m] * bn[m];
-    }
-
-    if(buf)
-        free(buf);
-    if(an)
-        free(an);
-    if(bn && (bn != b))
-        free(bn);
-    return RES_OK;
+    err = iir_create(&flt, b, a, ord);
+    if(err == RES_OK)
+        err = iir_filter(&flt, x, n, y);
+    iir_free(&flt);
+    return err;
 }
 
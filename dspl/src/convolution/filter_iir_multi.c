@@ -0,0 +1,205 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+#include "convolution.h"
+
+
+
+/* Multichannel IIR filter direct form II for nc channels, one channel
+   after another. The arguments are the same as of the vector kernels
+   (see filter_simd_krn.h) */
+static void iir_multi_krn(double* b, double* a, int ord, double* w, int nch,
+                          int pos, int nc, double* x, int n, int ld, 
+                          double* y)
+{
+    double *wp;
+    double  u, v;
+    int c, k, m, p, count = ord + 1;
+
+    for(c = 0; c < nc; c++)
+    {
+        p = pos;
+        for(k = 0; k < n; k++)
+        {
+            p = p ? p - 1 : ord;
+            wp = w + p * nch + c;
+
+            u = 0.0;
+            for(m = ord; m > 0; m--)
+                u += wp[m*nch] * a[m];
+
+            wp[0] = wp[count*nch] = x[k*ld + c] - u;
+            v = 0.0;
+            for(m = 0; m < count; m++)
+                v += wp[m*nch] * b[m];
+            y[k*ld + c] = v;
+        }
+    }
+}
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Multichannel streaming IIR filtering of the interleaved signal block.
+
+Function filters `n` new samples of each channel of the multichannel
+IIR filter object created by the \ref iir_create_multi function. \n
+The sample `k` of the channel `c` is `x[k*ld + c]`, so the `nch` 
+channels samples are interleaved if `ld = nch`, and the `nch` channels 
+of the wider frame of `ld` channels are filtered if `ld > nch`. \n
+The each channel is filtered by the direct form II as 
+the \ref iir_filter function does, and the delay line of each channel 
+is stored in the object, so the filter has no transients between blocks. \n
+If the AVX2 or AVX-512 instruction set is selected by the 
+\ref dspl_set_isa function then the recursion is calculated for four 
+(AVX2) or eight (AVX-512) channels by one vector operation. 
+The rest channels are calculated one by one. The vector lanes are
+calculated by the separate multiplications and additions in the 
+\ref iir_filter summation order, so the output of each channel is 
+equal to the \ref iir_filter output for any instruction set. \n
+The function does not allocate memory.
+
+\param[in,out]  piir
+Pointer to the `iir_t` object created by the \ref iir_create_multi 
+function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[n*ld x 1]`. \n \n
+
+\param[in]  n
+Number of the new samples of each channel. \n \n
+
+\param[in]  ld
+Distance between the samples `k` and `k+1` of the channel. \n
+Must be not less than the number of the channels. \n \n
+
+\param[out]  y
+Pointer to the filter output. \n
+The output sample `k` of the channel `c` is written to `y[k*ld + c]`,
+other elements are not changed. \n
+Vector size is `[n*ld x 1]`. \n
+Memory must be allocated. \n
+The pointer can be equal to `x`. \n \n
+
+\return
+`RES_OK` if the block is filtered successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Многоканальная потоковая БИХ-фильтрация блока чередующихся отсчетов
+
+Функция фильтрует `n` новых отсчетов каждого канала объектом
+многоканального БИХ-фильтра, созданным функцией \ref iir_create_multi. \n
+Отсчет `k` канала `c` равен `x[k*ld + c]`, поэтому при `ld = nch` 
+отсчеты `nch` каналов чередуются, а при `ld > nch` фильтруются `nch` 
+каналов из кадра шириной `ld` каналов. \n
+Каждый канал фильтруется по прямой форме II так же, как функцией 
+\ref iir_filter, и линия задержки каждого канала хранится в объекте, 
+поэтому фильтр не имеет переходных процессов между блоками. \n
+Если функцией \ref dspl_set_isa выбран набор инструкций AVX2 или 
+AVX-512, то рекурсия рассчитывается для четырех (AVX2) или 
+восьми (AVX-512) каналов одной векторной операцией. 
+Остальные каналы рассчитываются по одному. Элементы векторов 
+рассчитываются раздельными умножениями и сложениями в порядке 
+суммирования функции \ref iir_filter, поэтому выход каждого канала 
+совпадает с выходом функции \ref iir_filter для любого набора 
+инструкций. \n
+Функция не выделяет память.
+
+\param[in,out]  piir
+Указатель на объект `iir_t`, созданный функцией \ref iir_create_multi. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[n*ld x 1]`. \n \n
+
+\param[in]  n
+Количество новых отсчетов каждого канала. \n \n
+
+\param[in]  ld
+Расстояние между отсчетами `k` и `k+1` канала. \n
+Должно быть не меньше количества каналов. \n \n
+
+\param[out]  y
+Указатель на выход фильтра. \n
+Выходной отсчет `k` канала `c` записывается в `y[k*ld + c]`,
+остальные элементы не изменяются. \n
+Размер вектора `[n*ld x 1]`. \n
+Память должна быть выделена. \n
+Указатель может совпадать с `x`. \n \n
+
+\return
+`RES_OK` если блок обработан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API filter_iir_multi(iir_t* piir, double* x, int n, int ld, 
+                              double* y)
+{
+    int c = 0, nch, count;
+#ifdef FILTER_SIMD_X86
+    int isa, nv;
+#endif
+
+    if(!piir || !x || !y)
+        return ERROR_PTR;
+    if(!piir->w || n < 1 || ld < piir->nch)
+        return ERROR_SIZE;
+
+    nch   = piir->nch;
+    count = piir->ord + 1;
+
+#ifdef FILTER_SIMD_X86
+    isa = dspl_get_isa();
+    if(isa >= DSPL_ISA_AVX512 && nch - c >= 8)
+    {
+        nv = (nch - c) / 8;
+        iir_multi_krn_avx512(piir->b, piir->a, piir->ord, piir->w + c, nch, 
+                             piir->pos, nv, x + c, n, ld, y + c);
+        c += nv * 8;
+    }
+    if(isa >= DSPL_ISA_AVX2 && nch - c >= 4)
+    {
+        nv = (nch - c) / 4;
+        iir_multi_krn_avx2(piir->b, piir->a, piir->ord, piir->w + c, nch, 
+                           piir->pos, nv, x + c, n, ld, y + c);
+        c += nv * 4;
+    }
+#endif
+    iir_multi_krn(piir->b, piir->a, piir->ord, piir->w + c, nch, 
+                  piir->pos, nch - c, x + c, n, ld, y + c);
+
+    /* the delay line index is decremented by each sample */
+    piir->pos = (piir->pos + count - n % count) % count;
+    return RES_OK;
+}
@@ -0,0 +1,136 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "convolution.h"
+
+
+#ifdef FILTER_SIMD_X86
+
+#include <immintrin.h>
+
+/* GCC vector intrinsics are the vector type operators, so FILT_VMUL 
+   followed by FILT_VADD is contracted to FMA by default. The FMA 
+   kernels use FILT_VFMA, the multiply and add must be kept separate */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+/*******************************************************************************
+AVX2 kernels: four double values per vector
+*******************************************************************************/
+#define FILT_V              __m256d
+#define FILT_VN             4
+#define FILT_TARGET         __attribute__((target("avx2,fma")))
+#define FILT_SFX(f)         f##_avx2
+#define FILT_VLD(p)         _mm256_loadu_pd(p)
+#define FILT_VST(p, a)      _mm256_storeu_pd((p), (a))
+#define FILT_VSET1(r)       _mm256_set1_pd(r)
+#define FILT_VFMA(a, b, c)  _mm256_fmadd_pd((a), (b), (c))
+#define FILT_VFNMA(a, b, c) _mm256_fnmadd_pd((a), (b), (c))
+#define FILT_VMUL(a, b)     _mm256_mul_pd((a), (b))
+#define FILT_VADD(a, b)     _mm256_add_pd((a), (b))
+#define FILT_VSUB(a, b)     _mm256_sub_pd((a), (b))
+#define FILT_VROT(a)        _mm256_permute4x64_pd((a), 0x93)
+#define FILT_VINS0(a, b)    _mm256_blend_pd((a), (b), 1)
+#define FILT_VGET0(a)       _mm256_cvtsd_f64(a)
+#define FILT_M              __m256d
+#define FILT_VACT(a, l, h)  _mm256_and_pd(                                  \
+                                _mm256_cmp_pd((a), _mm256_set1_pd(l),       \
+                                              _CMP_GT_OQ),                  \
+                                _mm256_cmp_pd((a), _mm256_set1_pd(h),       \
+                                              _CMP_LE_OQ))
+#define FILT_VSEL(m, a, b)  _mm256_blendv_pd((a), (b), (m))
+
+#include "filter_simd_krn.h"
+
+#undef FILT_V
+#undef FILT_VN
+#undef FILT_TARGET
+#undef FILT_SFX
+#undef FILT_VLD
+#undef FILT_VST
+#undef FILT_VSET1
+#undef FILT_VFMA
+#undef FILT_VFNMA
+#undef FILT_VMUL
+#undef FILT_VADD
+#undef FILT_VSUB
+#undef FILT_VROT
+#undef FILT_VINS0
+#undef FILT_VGET0
+#undef FILT_M
+#undef FILT_VACT
+#undef FILT_VSEL
+
+
+
+/*******************************************************************************
+AVX-512 kernels: eight double values per vector
+*******************************************************************************/
+#define FILT_V              __m512d
+#define FILT_VN             8
+#define FILT_TARGET         __attribute__((target("avx512f,avx2,fma")))
+#define FILT_SFX(f)         f##_avx512
+#define FILT_VLD(p)         _mm512_loadu_pd(p)
+#define FILT_VST(p, a)      _mm512_storeu_pd((p), (a))
+#define FILT_VSET1(r)       _mm512_set1_pd(r)
+#define FILT_VFMA(a, b, c)  _mm512_fmadd_pd((a), (b), (c))
+#define FILT_VFNMA(a, b, c) _mm512_fnmadd_pd((a), (b), (c))
+#define FILT_VMUL(a, b)     _mm512_mul_pd((a), (b))
+#define FILT_VADD(a, b)     _mm512_add_pd((a), (b))
+#define FILT_VSUB(a, b)     _mm512_sub_pd((a), (b))
+#define FILT_VROT(a)        _mm512_permutexvar_pd(                          \
+                                _mm512_set_epi64(6, 5, 4, 3, 2, 1, 0, 7), (a))
+#define FILT_VINS0(a, b)    _mm512_mask_blend_pd(1, (a), (b))
+#define FILT_VGET0(a)       _mm512_cvtsd_f64(a)
+#define FILT_M              __mmask8
+#define FILT_VACT(a, l, h)  (_mm512_cmp_pd_mask((a), _mm512_set1_pd(l),     \
+                                                _CMP_GT_OQ) &               \
+                             _mm512_cmp_pd_mask((a), _mm512_set1_pd(h),     \
+                                                _CMP_LE_OQ))
+#define FILT_VSEL(m, a, b)  _mm512_mask_blend_pd((m), (a), (b))
+
+#include "filter_simd_krn.h"
+
+#undef FILT_V
+#undef FILT_VN
+#undef FILT_TARGET
+#undef FILT_SFX
+#undef FILT_VLD
+#undef FILT_VST
+#undef FILT_VSET1
+#undef FILT_VFMA
+#undef FILT_VFNMA
+#undef FILT_VMUL
+#undef FILT_VADD
+#undef FILT_VSUB
+#undef FILT_VROT
+#undef FILT_VINS0
+#undef FILT_VGET0
+#undef FILT_M
+#undef FILT_VACT
+#undef FILT_VSEL
+
+#endif /* FILTER_SIMD_X86 */
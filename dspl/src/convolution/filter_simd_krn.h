@@ -0,0 +1,215 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*******************************************************************************
+Filtering vector kernels.
+
+The file is included by filter_simd.c once for each instruction set.
+Before the include the following macros must be defined:
+FILT_V            vector type of FILT_VN double values
+FILT_VN           number of double values in the vector
+FILT_TARGET       function target attribute
+FILT_SFX(f)       function name with the instruction set suffix
+FILT_VLD(p)       load FILT_VN values from p
+FILT_VST(p, a)    store vector a to p
+FILT_VSET1(r)     broadcast r to all lanes
+FILT_VFMA(a,b,c)  a*b + c
+FILT_VFNMA(a,b,c) c - a*b
+FILT_VMUL(a, b)   a*b
+FILT_VADD(a, b)   a+b
+FILT_VSUB(a, b)   a-b
+FILT_VROT(a)      lanes rotation: lane i+1 gets lane i, lane 0 gets
+                  lane FILT_VN-1
+FILT_VINS0(a, b)  vector a with lane 0 replaced by lane 0 of b
+FILT_VGET0(a)     lane 0 of a
+FILT_M            lanes mask type
+FILT_VACT(a,l,h)  mask of the lanes of a which are l < a <= h
+FILT_VSEL(m,a,b)  lanes of b selected by the mask m, other lanes of a
+*******************************************************************************/
+
+
+
+/* Cascade of ns <= SOS_SIMD_NV*FILT_VN second-order sections, 
+   c[5s] ... c[5s+4] are b0, b1, b2, a1, a2 of the section s and 
+   w[2s], w[2s+1] are the state of the section s.
+   The lane i of the vector g filters the section s = g*FILT_VN + i 
+   and the section s gets the input sample k at the step k+s, 
+   so the all sections are calculated by the vector operations 
+   at each step and the output sample k is ready at the step k+lat.
+   At the first and the last lat steps the section s keeps its state 
+   if it has no input sample, so the state is saved for the next block */
+FILT_TARGET void FILT_SFX(sos_krn)(double* c, double* w, int ns, 
+                                   double* x, int n, double* y)
+{
+    FILT_V b0[SOS_SIMD_NV], b1[SOS_SIMD_NV], b2[SOS_SIMD_NV];
+    FILT_V a1[SOS_SIMD_NV], a2[SOS_SIMD_NV];
+    FILT_V s1[SOS_SIMD_NV], s2[SOS_SIMD_NV], o[SOS_SIMD_NV];
+    FILT_V id[SOS_SIMD_NV];
+    FILT_V u, v, t, r1, r2;
+    FILT_M m;
+    double q[8][FILT_VN];
+    int g, ng, i, j, k, s, lat;
+
+    ng  = (ns + FILT_VN - 1) / FILT_VN;
+    lat = ng * FILT_VN - 1;
+    for(g = 0; g < ng; g++)
+    {
+        /* sections after ns are the unity sections y = x 
+           with the zero state */
+        for(i = 0; i < FILT_VN; i++)
+        {
+            s = g*FILT_VN + i;
+            for(j = 0; j < 5; j++)
+                q[j][i] = (s < ns) ? c[5*s+j] : (double)(j == 0);
+            q[5][i] = (s < ns) ? w[2*s]   : 0.0;
+            q[6][i] = (s < ns) ? w[2*s+1] : 0.0;
+            q[7][i] = (double)s;
+        }
+        b0[g] = FILT_VLD(q[0]);
+        b1[g] = FILT_VLD(q[1]);
+        b2[g] = FILT_VLD(q[2]);
+        a1[g] = FILT_VLD(q[3]);
+        a2[g] = FILT_VLD(q[4]);
+        s1[g] = FILT_VLD(q[5]);
+        s2[g] = FILT_VLD(q[6]);
+        id[g] = FILT_VLD(q[7]);
+        o[g]  = FILT_VSET1(0.0);
+    }
+
+    for(k = 0; k < n + lat; k++)
+    {
+        /* o[g] keeps the previous step rotated outputs, so the section 
+           input is the previous section output at the previous step */
+        u = FILT_VSET1(k < n ? x[k] : 0.0);
+        for(g = 0; g < ng; g++)
+        {
+            v = FILT_VINS0(o[g], u);
+            u = o[g];
+            t  = FILT_VFMA(b0[g], v, s1[g]);
+            r1 = FILT_VFNMA(a1[g], t, FILT_VFMA(b1[g], v, s2[g]));
+            r2 = FILT_VFNMA(a2[g], t, FILT_VMUL(b2[g], v));
+            if(k < lat || k >= n)
+            {
+                /* the section s is active if 0 <= k-s < n */
+                m  = FILT_VACT(id[g], (double)(k - n), (double)k);
+                r1 = FILT_VSEL(m, s1[g], r1);
+                r2 = FILT_VSEL(m, s2[g], r2);
+            }
+            s1[g] = r1;
+            s2[g] = r2;
+            o[g] = FILT_VROT(t);
+        }
+        if(k >= lat)
+            y[k - lat] = FILT_VGET0(o[ng-1]);
+    }
+
+    for(g = 0; g < ng; g++)
+    {
+        FILT_VST(q[5], s1[g]);
+        FILT_VST(q[6], s2[g]);
+        for(i = 0; i < FILT_VN && g*FILT_VN + i < ns; i++)
+        {
+            s = g*FILT_VN + i;
+            w[2*s]   = q[5][i];
+            w[2*s+1] = q[6][i];
+        }
+    }
+}
+
+
+
+
+/* Multichannel IIR filter direct form II for nv vectors of channels.
+   The sample k of the channel c is x[k*ld + c], the delay line sample
+   w(k-m) of the channel c is w[(pos+m)*nch + c] (see filter_iir_multi).
+   The products are added by FILT_VADD without FMA in the iir_filter 
+   order, so the outputs are equal to the iir_filter outputs */
+FILT_TARGET void FILT_SFX(iir_multi_krn)(double* b, double* a, int ord, 
+                                         double* w, int nch, int pos, int nv,
+                                         double* x, int n, int ld, double* y)
+{
+    FILT_V u, v, t;
+    double *wp;
+    int k, c, m, count = ord + 1;
+
+    for(k = 0; k < n; k++)
+    {
+        pos = pos ? pos - 1 : ord;
+        wp = w + pos * nch;
+        for(c = 0; c < nv * FILT_VN; c += FILT_VN)
+        {
+            /* a[1]*w(k-1) is added last as in iir_filter, 
+               so the recursion latency is one multiply and add */
+            u = FILT_VSET1(0.0);
+            for(m = ord; m > 0; m--)
+                u = FILT_VADD(u, FILT_VMUL(FILT_VLD(wp + m*nch + c), 
+                                           FILT_VSET1(a[m])));
+            t = FILT_VSUB(FILT_VLD(x + k*ld + c), u);
+            FILT_VST(wp + c, t);
+            FILT_VST(wp + count*nch + c, t);
+            v = FILT_VSET1(0.0);
+            for(m = 0; m < count; m++)
+                v = FILT_VADD(v, FILT_VMUL(FILT_VLD(wp + m*nch + c), 
+                                           FILT_VSET1(b[m])));
+            FILT_VST(y + k*ld + c, v);
+        }
+    }
+}
+
+
+
+/* Multichannel direct FIR filtering for nv vectors of channels:
+   y[k*ld + c] = sum_i hr(i) buf[(k+i)*nch + c], i = 0 ... nh-1, 
+   FIR_MULTI_NV vectors of channels are calculated together */
+FILT_TARGET void FILT_SFX(fir_multi_krn)(double* hr, int nh, double* buf, 
+                                         int nch, int nv, int n, 
+                                         double* y, int ld)
+{
+    FILT_V acc[FIR_MULTI_NV], h;
+    double *r;
+    int k, c, i, j;
+
+    for(k = 0; k < n; k++)
+    {
+        for(c = 0; c + FIR_MULTI_NV * FILT_VN <= nv * FILT_VN; 
+            c += FIR_MULTI_NV * FILT_VN)
+        {
+            for(j = 0; j < FIR_MULTI_NV; j++)
+                acc[j] = FILT_VSET1(0.0);
+            for(i = 0; i < nh; i++)
+            {
+                h = FILT_VSET1(hr[i]);
+                r = buf + (k+i) * nch + c;
+                for(j = 0; j < FIR_MULTI_NV; j++)
+                    acc[j] = FILT_VFMA(h, FILT_VLD(r + j*FILT_VN), acc[j]);
+            }
+            for(j = 0; j < FIR_MULTI_NV; j++)
+                FILT_VST(y + k*ld + c + j*FILT_VN, acc[j]);
+        }
+        for(; c < nv * FILT_VN; c += FILT_VN)
+        {
+            acc[0] = FILT_VSET1(0.0);
+            for(i = 0; i < nh; i++)
+                acc[0] = FILT_VFMA(FILT_VSET1(hr[i]), 
+                                   FILT_VLD(buf + (k+i) * nch + c), acc[0]);
+            FILT_VST(y + k*ld + c, acc[0]);
+        }
+    }
+}
@@ -0,0 +1,189 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Real IIR filtration by the second-order sections cascade
+
+Function calculates the output of the real IIR filter defined 
+as the cascade of `ns` second-order sections (biquads)
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}},
+\f]
+here \f$a_{3s}\f$ cannot be equal zero.
+The sections are calculated by the \ref iir_sos, \ref filter_zp2sos or 
+\ref filter_tf2sos functions. \n
+Each section is calculated by the transposed direct form II,
+the section state is kept in the two variables without the delay line
+shifting. The high order filters are stable in the sections form 
+when the \ref filter_iir function output is unstable 
+because of the polynomial coefficients rounding errors. \n
+If the AVX2 or AVX-512 instruction set is selected by the 
+\ref dspl_set_isa function then the sections are calculated in the 
+vector lanes: the section `s` filters the input sample `k` at the step 
+`k+s`, and four (AVX2) or eight (AVX-512) sections are calculated 
+by one vector operation. \n
+The filter starts with zero initial conditions. 
+The stream filtering by blocks without transients between blocks 
+is provided by the `sos_t` object (see \ref sos_create
+and \ref sos_filter).
+
+\param[in]  b
+Pointer to the sections numerators. \n 
+Vector size is `[3*ns x 1]`. \n \n 
+
+\param[in]  a
+Pointer to the sections denominators. \n 
+Vector size is `[3*ns x 1]`. \n \n 
+
+\param[in]  ns
+Number of the sections. \n \n 
+
+\param[in]  x
+Pointer to the input signal vector. \n 
+Vector size is `[n x 1]`. \n \n 
+
+\param[in]  n
+Size of the input signal vector `x`. \n \n 
+
+\param[out] y
+Pointer to the filter output vector. \n 
+Vector size is `[n x  1]`. \n 
+Memory must be allocated. \n 
+The pointer can be equal to `x`. \n \n 
+
+\return
+`RES_OK` if filter output is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error". \n
+
+Example:
+
+\include filter_sos_test.c
+
+The zeros and poles are grouped into the sections by the
+\ref filter_zp2sos function, the sections pairs and the gain are checked.
+The `filter_sos` and the block-wise \ref sos_filter outputs are compared 
+with the sections filtered one by one by the \ref filter_iir function 
+for each instruction set selected by the \ref dspl_set_isa function.
+The cascade of 4 sections is filtered by the AVX2 kernel only, 
+13 sections by one AVX-512 kernel pass and 30 sections by the 
+AVX-512 kernel pass of 24 sections and the AVX2 kernel pass 
+of the last 6 sections.
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Фильтрация вещественного сигнала каскадом звеньев второго порядка
+
+Функция рассчитывает выход вещественного БИХ-фильтра, заданного 
+каскадом из `ns` звеньев второго порядка (биквадратных звеньев)
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}},
+\f]
+где \f$a_{3s}\f$ не может быть 0.
+Звенья рассчитываются функциями \ref iir_sos, \ref filter_zp2sos или 
+\ref filter_tf2sos. \n
+Каждое звено рассчитывается по транспонированной прямой форме II,
+состояние звена хранится в двух переменных без сдвига линии задержки.
+Фильтры высокого порядка устойчивы в виде каскада звеньев, когда выход 
+функции \ref filter_iir неустойчив из-за ошибок округления 
+коэффициентов полиномов. \n
+Если функцией \ref dspl_set_isa выбран набор инструкций AVX2 или 
+AVX-512, то звенья рассчитываются в элементах векторов: звено `s` 
+обрабатывает входной отсчет `k` на шаге `k+s`, и четыре (AVX2) 
+или восемь (AVX-512) звеньев рассчитываются одной векторной операцией. \n
+Фильтр начинает работу с нулевыми начальными условиями.
+
+\param[in]  b
+Указатель на числители звеньев. \n 
+Размер вектора `[3*ns x 1]`. \n \n 
+
+\param[in]  a
+Указатель на знаменатели звеньев. \n 
+Размер вектора `[3*ns x 1]`. \n \n 
+
+\param[in]  ns
+Количество звеньев. \n \n 
+
+\param[in]  x
+Указатель на вектор отсчетов входного сигнала. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Длина входного сигнала. \n \n
+
+\param[out] y
+Указатель на вектор выходных отсчетов фильтра. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n
+Указатель может совпадать с `x`. \n \n
+
+\return
+`RES_OK` если фильтрация произведена успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+
+\include filter_sos_test.c
+
+Нули и полюсы группируются в звенья функцией \ref filter_zp2sos,
+пары корней звеньев и коэффициент усиления проверяются.
+Выходы `filter_sos` и блочной фильтрации \ref sos_filter сравниваются
+с выходом звеньев, обработанных по одному функцией \ref filter_iir,
+для каждого набора инструкций, выбранного функцией \ref dspl_set_isa.
+Каскад из 4 звеньев фильтруется только ядром AVX2, 
+13 звеньев --- одним проходом ядра AVX-512, а 30 звеньев --- 
+проходом ядра AVX-512 для 24 звеньев и проходом ядра AVX2 
+для последних 6 звеньев.
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API filter_sos(double* b, double* a, int ns, 
+                        double* x, int n, double* y)
+{
+    sos_t flt = {0};
+    int   err;
+
+    if(!b || !a || !x || !y)
+        return ERROR_PTR;
+    if(ns < 1 || n < 1)
+        return ERROR_SIZE;
+
+    err = sos_create(&flt, b, a, ns);
+    if(err == RES_OK)
+        err = sos_filter(&flt, x, n, y);
+    sos_free(&flt);
+    return err;
+}
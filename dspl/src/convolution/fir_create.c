@@ -0,0 +1,223 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "dspl.h"
+#include "convolution.h"
+
+/* Overlap-save FFT size of the nh taps filter with the least cost per
+   output sample, or zero if the direct filtering is faster */
+static int fir_fft_size(int nh)
+{
+    int n, k, nfft = 0;
+    double c, cmin = (double)nh;
+
+    if(nh < FIR_FFT_MIN)
+        return 0;
+    n = 2;
+    while(n < 2*nh)
+        n *= 2;
+    for(k = 0; k < FIR_FFT_SIZES && n <= FIR_FFT_MAX; k++, n *= 2)
+    {
+        c = FIR_FFT_COST * log2((double)n) * (double)n / (double)(n - nh + 1);
+        if(c < cmin)
+        {
+            cmin = c;
+            nfft = n;
+        }
+    }
+    return nfft;
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming FIR filter object creation.
+
+Function creates the streaming FIR filter object of the `nh` taps `h`
+(see \ref fir_filter). \n
+The filtering method is selected by the number of the taps. 
+The filter with the small number of the taps is calculated directly
+(`nh` multiply-adds per output sample).
+Else the overlap-save method with the `nfft`-points real FFT 
+is used, and `nfft` is selected by the least operations count 
+per output sample. The filter spectrum is calculated once 
+by this function. \n
+The object stores the filter history, 
+it is cleared by this function and by the \ref fir_reset function.
+
+\param[in,out]  pfir
+Pointer to the `fir_t` object. \n
+The object must be cleared (filled by zeros) before the first use. 
+The object which was created before is recreated. \n \n
+
+\param[in]  h
+Pointer to the filter taps. \n
+Vector size is `[nh x 1]`. \n \n
+
+\param[in]  nh
+Number of the filter taps. \n \n
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+fir_t fir = {0};
+
+// 255 taps lowpass filter, the overlap-save FFT filtering is used
+fir_linphase(254, 0.2, 0.0, DSPL_FILTER_LPF, 
+             DSPL_WIN_BLACKMAN, 0.0, h);
+fir_create(&fir, h, 255);
+
+// input stream blocks of any size
+fir_filter(&fir, x0, 1000, y0);
+fir_filter(&fir, x1, 37, y1);
+
+fir_free(&fir);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Создание объекта потокового КИХ-фильтра
+
+Функция создает объект потокового КИХ-фильтра 
+с `nh` коэффициентами `h` (см. \ref fir_filter). \n
+Метод фильтрации выбирается по количеству коэффициентов.
+Фильтр с малым количеством коэффициентов рассчитывается непосредственно
+(`nh` умножений с накоплением на один выходной отсчет).
+Иначе используется метод перекрытия с накоплением и `nfft`-точечное
+БПФ вещественного сигнала, размер `nfft` выбирается по минимальному
+количеству операций на один выходной отсчет. Спектр фильтра
+рассчитывается один раз данной функцией. \n
+Объект хранит предысторию фильтра, которая очищается данной функцией
+и функцией \ref fir_reset.
+
+\param[in,out]  pfir
+Указатель на объект `fir_t`. \n
+Объект должен быть очищен (заполнен нулями) перед первым использованием.
+Ранее созданный объект пересоздается. \n \n
+
+\param[in]  h
+Указатель на коэффициенты фильтра. \n
+Размер вектора `[nh x 1]`. \n \n
+
+\param[in]  nh
+Количество коэффициентов фильтра. \n \n
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+fir_t fir = {0};
+
+// ФНЧ 255 коэффициентов, используется фильтрация с помощью БПФ
+fir_linphase(254, 0.2, 0.0, DSPL_FILTER_LPF, 
+             DSPL_WIN_BLACKMAN, 0.0, h);
+fir_create(&fir, h, 255);
+
+// блоки входного потока любого размера
+fir_filter(&fir, x0, 1000, y0);
+fir_filter(&fir, x1, 37, y1);
+
+fir_free(&fir);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fir_create(fir_t* pfir, double* h, int nh)
+{
+    int k, nfft, err;
+
+    if(!pfir || !h)
+        return ERROR_PTR;
+    if(nh < 1)
+        return ERROR_SIZE;
+
+    fir_free(pfir);
+
+    nfft = fir_fft_size(nh);
+
+    pfir->h = (double*) malloc(nh * sizeof(double));
+    if(!pfir->h)
+    {
+        err = ERROR_MALLOC;
+        goto error_proc;
+    }
+    for(k = 0; k < nh; k++)
+        pfir->h[k] = h[nh - 1 - k];
+
+    if(!nfft)
+    {
+        pfir->buf = (double*) malloc((nh - 1 + FIR_BLOCK) * sizeof(double));
+        if(!pfir->buf)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        memset(pfir->buf, 0, (nh - 1 + FIR_BLOCK) * sizeof(double));
+    }
+    else
+    {
+        pfir->buf = (double*)    malloc(nfft * sizeof(double));
+        pfir->t   = (double*)    malloc(nfft * sizeof(double));
+        pfir->hf  = (complex_t*) malloc((nfft/2+1) * sizeof(complex_t));
+        pfir->xf  = (complex_t*) malloc((nfft/2+1) * sizeof(complex_t));
+        if(!pfir->buf || !pfir->t || !pfir->hf || !pfir->xf)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        memset(pfir->buf, 0, nfft * sizeof(double));
+
+        /* filter spectrum */
+        memset(pfir->t, 0, nfft * sizeof(double));
+        memcpy(pfir->t, h, nh * sizeof(double));
+        err = fft_r2c(pfir->t, nfft, &pfir->fft, pfir->hf);
+        if(err != RES_OK)
+            goto error_proc;
+    }
+
+    pfir->nh   = nh;
+    pfir->nfft = nfft;
+    pfir->nch  = 1;
+    pfir->pos  = 0;
+    pfir->nout = 0;
+    return RES_OK;
+
+error_proc:
+    fir_free(pfir);
+    return err;
+}
@@ -0,0 +1,135 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "dspl.h"
+#include "convolution.h"
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Multichannel streaming FIR filter object creation.
+
+Function creates the streaming FIR filter object of `nch` channels
+filtered by the same `nh` taps `h` (see \ref filter_fir_multi). \n
+The multichannel filter is calculated directly 
+(`nh` multiply-adds per output sample of each channel) 
+and the channels are calculated in the vector lanes.
+The object of one channel is the same as the object created 
+by the \ref fir_create function. \n
+The object stores the history of each channel, 
+it is cleared by this function and by the \ref fir_reset function.
+
+\param[in,out]  pfir
+Pointer to the `fir_t` object. \n
+The object must be cleared (filled by zeros) before the first use.
+The object which was created before is recreated. \n \n
+
+\param[in]  h
+Pointer to the filter taps. \n
+Vector size is `[nh x 1]`. \n \n
+
+\param[in]  nh
+Number of the filter taps. \n \n
+
+\param[in]  nch
+Number of the channels. \n \n
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Создание объекта многоканального потокового КИХ-фильтра
+
+Функция создает объект потокового КИХ-фильтра `nch` каналов,
+фильтруемых одними коэффициентами `h` (см. \ref filter_fir_multi). \n
+Многоканальный фильтр рассчитывается непосредственно 
+(`nh` умножений с накоплением на выходной отсчет каждого канала), 
+и каналы рассчитываются в элементах векторов.
+Объект одного канала совпадает с объектом, созданным 
+функцией \ref fir_create. \n
+Объект хранит предысторию каждого канала, которая очищается 
+данной функцией и функцией \ref fir_reset.
+
+\param[in,out]  pfir
+Указатель на объект `fir_t`. \n
+Объект должен быть очищен (заполнен нулями) перед первым использованием.
+Ранее созданный объект пересоздается. \n \n
+
+\param[in]  h
+Указатель на коэффициенты фильтра. \n
+Размер вектора `[nh x 1]`. \n \n
+
+\param[in]  nh
+Количество коэффициентов фильтра. \n \n
+
+\param[in]  nch
+Количество каналов. \n \n
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fir_create_multi(fir_t* pfir, double* h, int nh, int nch)
+{
+    int k, size;
+
+    if(!pfir || !h)
+        return ERROR_PTR;
+    if(nh < 1 || nch < 1)
+        return ERROR_SIZE;
+    if(nch == 1)
+        return fir_create(pfir, h, nh);
+
+    fir_free(pfir);
+
+    size = (nh - 1 + FIR_BLOCK) * nch;
+    pfir->h   = (double*) malloc(nh * sizeof(double));
+    pfir->buf = (double*) malloc(size * sizeof(double));
+    if(!pfir->h || !pfir->buf)
+    {
+        fir_free(pfir);
+        return ERROR_MALLOC;
+    }
+    for(k = 0; k < nh; k++)
+        pfir->h[k] = h[nh - 1 - k];
+    memset(pfir->buf, 0, size * sizeof(double));
+
+    pfir->nh   = nh;
+    pfir->nfft = 0;
+    pfir->nch  = nch;
+    pfir->pos  = 0;
+    pfir->nout = 0;
+    return RES_OK;
+}
@@ -0,0 +1,264 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "dspl.h"
+#include "convolution.h"
+
+/* Overlap-save block: FFT of the buffer, multiplication by the filter
+   spectrum and IFFT to the workspace t */
+static int fir_block(fir_t* pfir)
+{
+    int k, err;
+    double re;
+    complex_t *xf = pfir->xf, *hf = pfir->hf;
+
+    err = fft_r2c(pfir->buf, pfir->nfft, &pfir->fft, xf);
+    if(err != RES_OK)
+        return err;
+    for(k = 0; k <= pfir->nfft/2; k++)
+    {
+        re = CMRE(xf[k], hf[k]);
+        IM(xf[k]) = CMIM(xf[k], hf[k]);
+        RE(xf[k]) = re;
+    }
+    return ifft(xf, pfir->nfft, &pfir->fft, pfir->t);
+}
+
+
+
+/* Outputs of the new samples nout ... pos-1 of the overlap-save block,
+   calculated directly or by the FFT of the zero-padded block */
+static int fir_out(fir_t* pfir, double* y)
+{
+    int c, h1, err;
+
+    c  = pfir->pos - pfir->nout;
+    h1 = pfir->nh - 1;
+    if((double)c * (double)pfir->nh < 
+       FIR_FFT_COST * (double)pfir->nfft * log2((double)pfir->nfft))
+        fir_krn(pfir->h, pfir->nh, pfir->buf + pfir->nout, c, y);
+    else
+    {
+        memset(pfir->buf + h1 + pfir->pos, 0, 
+               (pfir->nfft - h1 - pfir->pos) * sizeof(double));
+        err = fir_block(pfir);
+        if(err != RES_OK)
+            return err;
+        memcpy(y, pfir->t + h1 + pfir->nout, c * sizeof(double));
+    }
+    pfir->nout = pfir->pos;
+    return RES_OK;
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming FIR filtering of the real signal block.
+
+Function filters `n` new samples of the real input stream
+by the FIR filter object created by the \ref fir_create function: \n
+\f[
+  y(k) = \sum_{i = 0}^{n_h-1} h(i) x(k-i),
+\f]
+the previous stream samples \f$ x(k-i) \f$, \f$ k < i \f$, are taken 
+from the filter history stored in the object, so the output is the same 
+as the filtering of the whole stream for any blocks sizes. \n
+The direct filter is calculated by the blocks of the input samples
+copied after the history. 
+The FFT filter collects the overlap-save blocks of 
+`nfft - nh + 1` samples. The outputs of the block samples which are
+not calculated by the previous calls, and the outputs of the incomplete 
+block at the end of the input, are calculated directly or by the FFT 
+of the zero-padded block, whichever is faster. 
+The incomplete block is completed by the next calls, thus the blocks 
+of `nfft - nh + 1` samples or more are filtered by the FFT, 
+and the small blocks are filtered directly. \n
+The function does not allocate memory.
+
+\param[in,out]  pfir
+Pointer to the one channel `fir_t` object created by the \ref fir_create 
+function. The multichannel object is filtered by the 
+\ref filter_fir_multi function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Block size. \n \n
+
+\param[out]  y
+Pointer to the filter output. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n
+The pointer can be equal to `x`. \n \n
+
+\return
+`RES_OK` if the block is filtered successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Потоковая КИХ-фильтрация блока вещественного сигнала
+
+Функция фильтрует `n` новых отсчетов вещественного входного потока
+объектом КИХ-фильтра, созданным функцией \ref fir_create: \n
+\f[
+  y(k) = \sum_{i = 0}^{n_h-1} h(i) x(k-i),
+\f]
+предыдущие отсчеты потока \f$ x(k-i) \f$, \f$ k < i \f$, берутся 
+из предыстории фильтра, хранимой в объекте, поэтому выход совпадает
+с результатом фильтрации всего потока при любых размерах блоков. \n
+Непосредственный фильтр рассчитывается по блокам входных отсчетов,
+скопированных после предыстории. 
+Фильтр с использованием БПФ накапливает блоки метода перекрытия 
+с накоплением по `nfft - nh + 1` отсчетов. Выходные отсчеты блока, 
+не рассчитанные предыдущими вызовами, и выходные отсчеты 
+незавершенного блока в конце входа рассчитываются непосредственно
+или с помощью БПФ блока, дополненного нулями, в зависимости от того, 
+что быстрее. Незавершенный блок завершается при следующих вызовах, 
+поэтому блоки от `nfft - nh + 1` отсчетов фильтруются с помощью БПФ,
+а малые блоки фильтруются непосредственно. \n
+Функция не выделяет память.
+
+\param[in,out]  pfir
+Указатель на одноканальный объект `fir_t`, созданный функцией 
+\ref fir_create. Многоканальный объект обрабатывается функцией 
+\ref filter_fir_multi. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер блока. \n \n
+
+\param[out]  y
+Указатель на выход фильтра. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n
+Указатель может совпадать с `x`. \n \n
+
+\return
+`RES_OK` если блок обработан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fir_filter(fir_t* pfir, double* x, int n, double* y)
+{
+    int c, L, h1, err;
+    double *buf;
+
+    if(!pfir || !x || !y)
+        return ERROR_PTR;
+    if(!pfir->h || pfir->nch != 1 || n < 1)
+        return ERROR_SIZE;
+
+    buf = pfir->buf;
+    h1  = pfir->nh - 1;
+
+    if(!pfir->nfft)
+    {
+        while(n > 0)
+        {
+            c = n < FIR_BLOCK ? n : FIR_BLOCK;
+            memcpy(buf + h1, x, c * sizeof(double));
+            fir_krn(pfir->h, pfir->nh, buf, c, y);
+            memmove(buf, buf + c, h1 * sizeof(double));
+            x += c;
+            y += c;
+            n -= c;
+        }
+        return RES_OK;
+    }
+
+    L = pfir->nfft - h1;
+    while(n > 0)
+    {
+        c = L - pfir->pos < n ? L - pfir->pos : n;
+        memcpy(buf + h1 + pfir->pos, x, c * sizeof(double));
+        pfir->pos += c;
+        x += c;
+        n -= c;
+        if(pfir->pos < L)
+            break;
+
+        /* complete overlap-save block */
+        c = L - pfir->nout;
+        err = fir_out(pfir, y);
+        if(err != RES_OK)
+            return err;
+        y += c;
+        memmove(buf, buf + L, h1 * sizeof(double));
+        pfir->pos = pfir->nout = 0;
+    }
+
+    /* outputs of the incomplete block */
+    if(pfir->pos > pfir->nout)
+        return fir_out(pfir, y);
+    return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Direct FIR filtering, see convolution.h. 
+The outputs vector is updated by four taps per pass
+*******************************************************************************/
+void fir_krn(double* hr, int nh, double* x, int n, double* y)
+{
+    int i, k;
+    double a0, a1, a2, a3;
+    double *p;
+
+    memset(y, 0, n * sizeof(double));
+    for(i = 0; i + 3 < nh; i += 4)
+    {
+        a0 = hr[i];
+        a1 = hr[i+1];
+        a2 = hr[i+2];
+        a3 = hr[i+3];
+        p  = x + i;
+        for(k = 0; k < n; k++)
+            y[k] += a0 * p[k] + a1 * p[k+1] + a2 * p[k+2] + a3 * p[k+3];
+    }
+    for(; i < nh; i++)
+    {
+        a0 = hr[i];
+        p  = x + i;
+        for(k = 0; k < n; k++)
+            y[k] += a0 * p[k];
+    }
+}
@@ -0,0 +1,74 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "dspl.h"
+#include "convolution.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming FIR filter object memory free.
+
+Function frees the memory of the `fir_t` object 
+and fills the object by zeros.
+
+\param[in,out]  pfir
+Pointer to the `fir_t` object. \n \n
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Освобождение памяти объекта потокового КИХ-фильтра
+
+Функция освобождает память объекта `fir_t` 
+и заполняет объект нулями.
+
+\param[in,out]  pfir
+Указатель на объект `fir_t`. \n \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+void DSPL_API fir_free(fir_t* pfir)
+{
+    if(!pfir)
+        return;
+    if(pfir->h)
+        free(pfir->h);
+    if(pfir->buf)
+        free(pfir->buf);
+    if(pfir->t)
+        free(pfir->t);
+    if(pfir->hf)
+        free(pfir->hf);
+    if(pfir->xf)
+        free(pfir->xf);
+    fft_free(&pfir->fft);
+
+    memset(pfir, 0, sizeof(fir_t));
+}
@@ -0,0 +1,83 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "dspl.h"
+#include "convolution.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming FIR filter history reset.
+
+Function clears the filter history of the `fir_t` object, 
+so the next block is filtered as the beginning of the new stream
+(the previous samples are zeros).
+
+\param[in,out]  pfir
+Pointer to the `fir_t` object created by the \ref fir_create 
+or \ref fir_create_multi function. \n \n
+
+\return
+`RES_OK` if the history is cleared successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Сброс предыстории потокового КИХ-фильтра
+
+Функция очищает предысторию фильтра объекта `fir_t`,
+поэтому следующий блок фильтруется как начало нового потока
+(предыдущие отсчеты равны нулю).
+
+\param[in,out]  pfir
+Указатель на объект `fir_t`, созданный функцией \ref fir_create 
+или \ref fir_create_multi. \n \n
+
+\return
+`RES_OK` если предыстория очищена успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fir_reset(fir_t* pfir)
+{
+    if(!pfir)
+        return ERROR_PTR;
+    if(!pfir->buf)
+        return ERROR_SIZE;
+    if(pfir->nfft)
+        memset(pfir->buf, 0, pfir->nfft * sizeof(double));
+    else
+        memset(pfir->buf, 0, 
+               (pfir->nh - 1 + FIR_BLOCK) * pfir->nch * sizeof(double));
+    pfir->pos  = 0;
+    pfir->nout = 0;
+    return RES_OK;
+}
@@ -0,0 +1,200 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Multichannel streaming IIR filter object creation.
+
+Function creates the streaming IIR filter object of `nch` channels
+filtered by the same transfer function
+\f[
+  H(z) = \frac{\sum_{n = 0}^{N} b_n  z^{-n}}
+  {1+{\frac{1}{a_0}}\sum_{m = 1}^{M} a_m  z^{-n}},
+\f]
+here \f$a_0\f$ cannot be equals zeros, \f$N=M=\f$`ord`
+(see \ref filter_iir_multi). \n
+The object stores the delay line of each channel,
+the delay lines are cleared by this function and 
+by the \ref iir_reset function. \n
+The object of one channel is the same as the object created 
+by the \ref iir_create function.
+
+\param[in,out]  piir
+Pointer to the `iir_t` object. \n
+The object must be cleared (filled by zeros) before the first use. 
+The object which was created before is recreated. \n \n
+
+\param[in]  b
+Pointer to the vector \f$b\f$ of IIR filter 
+transfer function numerator coefficients. \n 
+Vector size is `[ord + 1 x 1]`. \n \n 
+
+\param[in]  a
+Pointer to the vector \f$a\f$ of IIR filter 
+transfer function denominator coefficients. \n 
+Vector size is `[ord + 1 x 1]`. \n 
+This pointer can be `NULL` if filter is FIR. \n \n 
+
+\param[in]  ord
+Filter order. Number of the transfer function 
+numerator and denominator coefficients 
+(length of vectors `b` and `a`) is `ord + 1`. \n \n 
+
+\param[in]  nch
+Number of the channels. \n \n 
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+iir_t flt = {0};
+
+// 6 order elliptic LPF of 64 channels
+iir(1.0, 60.0, 6, 0.2, 0.0, DSPL_FILTER_ELLIP | DSPL_FILTER_LPF, b, a);
+iir_create_multi(&flt, b, a, 6, 64);
+
+// x[k*64 + c] is the sample k of the channel c
+filter_iir_multi(&flt, x, 1000, 64, y);
+
+iir_free(&flt);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Создание объекта многоканального потокового БИХ-фильтра
+
+Функция создает объект потокового БИХ-фильтра `nch` каналов, 
+фильтруемых одной передаточной характеристикой
+\f[
+  H(z) = \frac{\sum_{n = 0}^{N} b_n  z^{-n}}
+  {1+{\frac{1}{a_0}}\sum_{m = 1}^{M} a_m  z^{-n}},
+\f]
+где \f$a_0\f$ не может быть равно нулю, \f$N=M=\f$`ord`
+(см. \ref filter_iir_multi). \n
+Объект хранит линию задержки каждого канала, линии задержки
+очищаются данной функцией и функцией \ref iir_reset. \n
+Объект одного канала совпадает с объектом, созданным 
+функцией \ref iir_create.
+
+\param[in,out]  piir
+Указатель на объект `iir_t`. \n
+Объект должен быть очищен (заполнен нулями) перед первым использованием.
+Ранее созданный объект пересоздается. \n \n
+
+\param[in]  b
+Указатель на вектор коэффициентов числителя 
+передаточной функции БИХ-фильтра \f$b\f$. \n 
+Размер вектора `[ord + 1 x 1]`. \n \n 
+
+\param[in]  a
+Указатель на вектор коэффициентов знаменателя 
+передаточной функции БИХ-фильтра \f$a\f$. \n 
+Размер вектора `[ord + 1 x 1]`. \n 
+Указатель может быть `NULL`, если фильтр является КИХ-фильтром. \n \n 
+
+\param[in]  ord
+Порядок фильтра. Количество коэффициентов числителя и знаменателя
+передаточной функции (размер векторов `b` и `a`) равно `ord + 1`. \n \n 
+
+\param[in]  nch
+Количество каналов. \n \n 
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+iir_t flt = {0};
+
+// эллиптический ФНЧ 6 порядка для 64 каналов
+iir(1.0, 60.0, 6, 0.2, 0.0, DSPL_FILTER_ELLIP | DSPL_FILTER_LPF, b, a);
+iir_create_multi(&flt, b, a, 6, 64);
+
+// x[k*64 + c] -- отсчет k канала c
+filter_iir_multi(&flt, x, 1000, 64, y);
+
+iir_free(&flt);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API iir_create_multi(iir_t* piir, double* b, double* a, 
+                              int ord, int nch)
+{
+    int k, count, err;
+
+    if(!piir || !b)
+        return ERROR_PTR;
+    if(ord < 1 || nch < 1)
+        return ERROR_SIZE;
+    if(a && a[0]==0.0)
+        return ERROR_FILTER_A0;
+
+    iir_free(piir);
+
+    count = ord + 1;
+    piir->b = (double*) malloc(count * sizeof(double));
+    piir->a = (double*) malloc(count * sizeof(double));
+    piir->w = (double*) malloc(2 * count * nch * sizeof(double));
+    if(!piir->b || !piir->a || !piir->w)
+    {
+        err = ERROR_MALLOC;
+        goto error_proc;
+    }
+
+    if(!a)
+    {
+        memset(piir->a, 0, count * sizeof(double));
+        memcpy(piir->b, b, count * sizeof(double));
+    }
+    else
+    {
+        for(k = 0; k < count; k++)
+        {
+            piir->a[k] = a[k] / a[0];
+            piir->b[k] = b[k] / a[0];
+        }
+    }
+    memset(piir->w, 0, 2 * count * nch * sizeof(double));
+
+    piir->ord = ord;
+    piir->nch = nch;
+    piir->pos = 0;
+    return RES_OK;
+
+error_proc:
+    iir_free(piir);
+    return err;
+}
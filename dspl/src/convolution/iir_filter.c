@@ -0,0 +1,149 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming IIR filtering of the real signal block.
+
+Function filters `n` new samples of the real input stream
+by the IIR filter object created by the \ref iir_create function. \n
+The filter is calculated by the direct form II:
+\f[
+  w(k) = x(k) - \sum_{m = 1}^{ord} a_m w(k-m), \qquad
+  y(k) = \sum_{m = 0}^{ord} b_m w(k-m),
+\f]
+with the normalized coefficients (\f$ a_0 = 1 \f$). 
+The delay line \f$ w(k-m) \f$ is stored in the object, so the output
+is the same as the \ref filter_iir function output of the whole stream
+for any blocks sizes and the filter has no transients between blocks. \n
+The function does not allocate memory.
+
+\param[in,out]  piir
+Pointer to the one channel `iir_t` object created by the \ref iir_create 
+function. The multichannel object is filtered by the 
+\ref filter_iir_multi function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Block size. \n \n
+
+\param[out]  y
+Pointer to the filter output. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n
+The pointer can be equal to `x`. \n \n
+
+\return
+`RES_OK` if the block is filtered successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Потоковая БИХ-фильтрация блока вещественного сигнала
+
+Функция фильтрует `n` новых отсчетов вещественного входного потока
+объектом БИХ-фильтра, созданным функцией \ref iir_create. \n
+Фильтр рассчитывается по прямой форме II:
+\f[
+  w(k) = x(k) - \sum_{m = 1}^{ord} a_m w(k-m), \qquad
+  y(k) = \sum_{m = 0}^{ord} b_m w(k-m),
+\f]
+с нормированными коэффициентами (\f$ a_0 = 1 \f$). 
+Линия задержки \f$ w(k-m) \f$ хранится в объекте, поэтому выход 
+совпадает с выходом функции \ref filter_iir для всего потока 
+при любых размерах блоков, и фильтр не имеет переходных процессов 
+между блоками. \n
+Функция не выделяет память.
+
+\param[in,out]  piir
+Указатель на одноканальный объект `iir_t`, созданный функцией 
+\ref iir_create. Многоканальный объект обрабатывается функцией 
+\ref filter_iir_multi. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер блока. \n \n
+
+\param[out]  y
+Указатель на выход фильтра. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n
+Указатель может совпадать с `x`. \n \n
+
+\return
+`RES_OK` если блок обработан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API iir_filter(iir_t* piir, double* x, int n, double* y)
+{
+    double *a, *b, *w;
+    double  u, v;
+    int     k, m, ord, count, pos;
+
+    if(!piir || !x || !y)
+        return ERROR_PTR;
+    if(!piir->w || piir->nch != 1 || n < 1)
+        return ERROR_SIZE;
+
+    a     = piir->a;
+    b     = piir->b;
+    ord   = piir->ord;
+    count = ord + 1;
+    pos   = piir->pos;
+
+    for(k = 0; k < n; k++)
+    {
+        /* w + pos is the delay line w(k-m), m = 0 ... ord */
+        pos = pos ? pos - 1 : ord;
+        w = piir->w + pos;
+
+        u = 0.0;
+        for(m = ord; m > 0; m--)
+            u += w[m]*a[m];
+
+        w[0] = w[count] = x[k] - u;
+        v = 0.0;
+        for(m = 0; m < count; m++)
+            v += w[m] * b[m];
+        y[k] = v;
+    }
+    piir->pos = pos;
+    return RES_OK;
+}
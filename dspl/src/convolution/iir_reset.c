@@ -0,0 +1,76 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming IIR filter delay line reset.
+
+Function clears the delay line of the `iir_t` object, 
+so the next block is filtered as the beginning of the new stream
+(zero initial conditions).
+
+\param[in,out]  piir
+Pointer to the `iir_t` object created by the \ref iir_create 
+or \ref iir_create_multi function. \n \n
+
+\return
+`RES_OK` if the delay line is cleared successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Сброс линии задержки потокового БИХ-фильтра
+
+Функция очищает линию задержки объекта `iir_t`,
+поэтому следующий блок фильтруется как начало нового потока
+(нулевые начальные условия).
+
+\param[in,out]  piir
+Указатель на объект `iir_t`, созданный функцией \ref iir_create 
+или \ref iir_create_multi. \n \n
+
+\return
+`RES_OK` если линия задержки очищена успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API iir_reset(iir_t* piir)
+{
+    if(!piir)
+        return ERROR_PTR;
+    if(!piir->w)
+        return ERROR_SIZE;
+    memset(piir->w, 0, 2 * (piir->ord + 1) * piir->nch * sizeof(double));
+    piir->pos = 0;
+    return RES_OK;
+}
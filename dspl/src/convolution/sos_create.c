@@ -0,0 +1,174 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming second-order sections cascade object creation.
+
+Function creates the streaming IIR filter object defined 
+as the cascade of `ns` second-order sections
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}},
+\f]
+here \f$a_{3s}\f$ cannot be equal zero (see \ref filter_sos). \n
+The sections coefficients are normalized by \f$a_{3s}\f$ once 
+by this function. The object stores the state of each section,
+it is cleared by this function and by the \ref sos_reset function.
+
+\param[in,out]  psos
+Pointer to the `sos_t` object. \n
+The object must be cleared (filled by zeros) before the first use. 
+The object which was created before is recreated. \n \n
+
+\param[in]  b
+Pointer to the sections numerators. \n 
+Vector size is `[3*ns x 1]`. \n \n 
+
+\param[in]  a
+Pointer to the sections denominators. \n 
+Vector size is `[3*ns x 1]`. \n \n 
+
+\param[in]  ns
+Number of the sections. \n \n 
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+sos_t flt = {0};
+
+// 12 order elliptic LPF as 6 second-order sections
+iir_sos(1.0, 60.0, 12, 0.2, 0.0, DSPL_FILTER_ELLIP | DSPL_FILTER_LPF, b, a);
+sos_create(&flt, b, a, 6);
+
+// input stream blocks of any size without transients between blocks
+sos_filter(&flt, x0, 1000, y0);
+sos_filter(&flt, x1, 37, y1);
+
+sos_free(&flt);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Создание объекта потокового каскада звеньев второго порядка
+
+Функция создает объект потокового БИХ-фильтра, заданного 
+каскадом из `ns` звеньев второго порядка
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}},
+\f]
+где \f$a_{3s}\f$ не может быть 0 (см. \ref filter_sos). \n
+Коэффициенты звеньев нормируются на \f$a_{3s}\f$ один раз 
+данной функцией. Объект хранит состояние каждого звена, 
+которое очищается данной функцией и функцией \ref sos_reset.
+
+\param[in,out]  psos
+Указатель на объект `sos_t`. \n
+Объект должен быть очищен (заполнен нулями) перед первым использованием.
+Ранее созданный объект пересоздается. \n \n
+
+\param[in]  b
+Указатель на числители звеньев. \n 
+Размер вектора `[3*ns x 1]`. \n \n 
+
+\param[in]  a
+Указатель на знаменатели звеньев. \n 
+Размер вектора `[3*ns x 1]`. \n \n 
+
+\param[in]  ns
+Количество звеньев. \n \n 
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+sos_t flt = {0};
+
+// эллиптический ФНЧ 12 порядка в виде 6 звеньев второго порядка
+iir_sos(1.0, 60.0, 12, 0.2, 0.0, DSPL_FILTER_ELLIP | DSPL_FILTER_LPF, b, a);
+sos_create(&flt, b, a, 6);
+
+// блоки входного потока любого размера без переходных процессов 
+// между блоками
+sos_filter(&flt, x0, 1000, y0);
+sos_filter(&flt, x1, 37, y1);
+
+sos_free(&flt);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API sos_create(sos_t* psos, double* b, double* a, int ns)
+{
+    int s;
+
+    if(!psos || !b || !a)
+        return ERROR_PTR;
+    if(ns < 1)
+        return ERROR_SIZE;
+    for(s = 0; s < ns; s++)
+        if(a[3*s] == 0.0)
+            return ERROR_FILTER_A0;
+
+    sos_free(psos);
+
+    psos->c = (double*) malloc(5 * ns * sizeof(double));
+    psos->w = (double*) malloc(2 * ns * sizeof(double));
+    if(!psos->c || !psos->w)
+    {
+        sos_free(psos);
+        return ERROR_MALLOC;
+    }
+
+    /* normalized coefficients b0, b1, b2, a1, a2 of the each section */
+    for(s = 0; s < ns; s++)
+    {
+        psos->c[5*s]   = b[3*s]   / a[3*s];
+        psos->c[5*s+1] = b[3*s+1] / a[3*s];
+        psos->c[5*s+2] = b[3*s+2] / a[3*s];
+        psos->c[5*s+3] = a[3*s+1] / a[3*s];
+        psos->c[5*s+4] = a[3*s+2] / a[3*s];
+    }
+    memset(psos->w, 0, 2 * ns * sizeof(double));
+
+    psos->ns = ns;
+    return RES_OK;
+}
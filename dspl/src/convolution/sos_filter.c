@@ -0,0 +1,180 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "convolution.h"
+
+
+/* Cascade of ns second-order sections with the state w.
+   The sections are filtered one after another, the state of the section
+   is kept in the registers. c[5s] ... c[5s+4] are b0, b1, b2, a1, a2 
+   of the section s, w[2s] and w[2s+1] are the state of the section s */
+static void sos_krn(double* c, double* w, int ns, 
+                    double* x, int n, double* y)
+{
+    double b0, b1, b2, a1, a2, s1, s2, t;
+    double *in = x;
+    int s, k;
+
+    for(s = 0; s < ns; s++)
+    {
+        b0 = c[5*s];
+        b1 = c[5*s+1];
+        b2 = c[5*s+2];
+        a1 = c[5*s+3];
+        a2 = c[5*s+4];
+        s1 = w[2*s];
+        s2 = w[2*s+1];
+        for(k = 0; k < n; k++)
+        {
+            t  = b0 * in[k] + s1;
+            s1 = b1 * in[k] - a1 * t + s2;
+            s2 = b2 * in[k] - a2 * t;
+            y[k] = t;
+        }
+        w[2*s]   = s1;
+        w[2*s+1] = s2;
+        in = y;
+    }
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming filtering of the real signal block 
+by the second-order sections cascade.
+
+Function filters `n` new samples of the real input stream
+by the second-order sections cascade object created by the 
+\ref sos_create function. \n
+Each section is calculated by the transposed direct form II
+(see \ref filter_sos). The sections state is stored in the object, 
+so the output is the same as the \ref filter_sos function output 
+of the whole stream for any blocks sizes and the filter 
+has no transients between blocks. \n
+The function does not allocate memory.
+
+\param[in,out]  psos
+Pointer to the `sos_t` object created by the \ref sos_create 
+function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Block size. \n \n
+
+\param[out]  y
+Pointer to the filter output. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n
+The pointer can be equal to `x`. \n \n
+
+\return
+`RES_OK` if the block is filtered successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Потоковая фильтрация блока вещественного сигнала 
+каскадом звеньев второго порядка
+
+Функция фильтрует `n` новых отсчетов вещественного входного потока
+объектом каскада звеньев второго порядка, созданным функцией 
+\ref sos_create. \n
+Каждое звено рассчитывается по транспонированной прямой форме II
+(см. \ref filter_sos). Состояние звеньев хранится в объекте, поэтому 
+выход совпадает с выходом функции \ref filter_sos для всего потока 
+при любых размерах блоков, и фильтр не имеет переходных процессов 
+между блоками. \n
+Функция не выделяет память.
+
+\param[in,out]  psos
+Указатель на объект `sos_t`, созданный функцией \ref sos_create. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер блока. \n \n
+
+\param[out]  y
+Указатель на выход фильтра. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n
+Указатель может совпадать с `x`. \n \n
+
+\return
+`RES_OK` если блок обработан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API sos_filter(sos_t* psos, double* x, int n, double* y)
+{
+    double *in = x;
+    int ns;
+#ifdef FILTER_SIMD_X86
+    int s, m, isa;
+#endif
+
+    if(!psos || !x || !y)
+        return ERROR_PTR;
+    if(!psos->c || !psos->w || n < 1)
+        return ERROR_SIZE;
+
+    ns = psos->ns;
+#ifdef FILTER_SIMD_X86
+    isa = (ns < SOS_SIMD_MIN) ? DSPL_ISA_SCALAR : dspl_get_isa();
+    for(s = 0; s < ns && isa >= DSPL_ISA_AVX2; s += m)
+    {
+        if(isa >= DSPL_ISA_AVX512 && ns - s >= SOS_AVX512_MIN)
+        {
+            m = (ns - s < SOS_SIMD_NV * 8) ? ns - s : SOS_SIMD_NV * 8;
+            sos_krn_avx512(psos->c + 5*s, psos->w + 2*s, m, in, n, y);
+        }
+        else
+        {
+            m = (ns - s < SOS_SIMD_NV * 4) ? ns - s : SOS_SIMD_NV * 4;
+            sos_krn_avx2(psos->c + 5*s, psos->w + 2*s, m, in, n, y);
+        }
+        in = y;
+    }
+    if(isa >= DSPL_ISA_AVX2)
+        return RES_OK;
+#endif
+    sos_krn(psos->c, psos->w, ns, in, n, y);
+    return RES_OK;
+}
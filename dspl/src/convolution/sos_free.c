@@ -0,0 +1,66 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming second-order sections cascade object memory free.
+
+Function frees the memory of the `sos_t` object 
+and fills the object by zeros.
+
+\param[in,out]  psos
+Pointer to the `sos_t` object. \n \n
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Освобождение памяти объекта потокового каскада звеньев 
+второго порядка
+
+Функция освобождает память объекта `sos_t` 
+и заполняет объект нулями.
+
+\param[in,out]  psos
+Указатель на объект `sos_t`. \n \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+void DSPL_API sos_free(sos_t* psos)
+{
+    if(!psos)
+        return;
+    if(psos->c)
+        free(psos->c);
+    if(psos->w)
+        free(psos->w);
+    memset(psos, 0, sizeof(sos_t));
+}
@@ -0,0 +1,75 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Streaming second-order sections cascade state reset.
+
+Function clears the sections state of the `sos_t` object, 
+so the next block is filtered as the beginning of the new stream
+(zero initial conditions).
+
+\param[in,out]  psos
+Pointer to the `sos_t` object created by the \ref sos_create 
+function. \n \n
+
+\return
+`RES_OK` if the state is cleared successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\brief Сброс состояния потокового каскада звеньев второго порядка
+
+Функция очищает состояние звеньев объекта `sos_t`,
+поэтому следующий блок фильтруется как начало нового потока
+(нулевые начальные условия).
+
+\param[in,out]  psos
+Указатель на объект `sos_t`, созданный функцией \ref sos_create. \n \n
+
+\return
+`RES_OK` если состояние очищено успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API sos_reset(sos_t* psos)
+{
+    if(!psos)
+        return ERROR_PTR;
+    if(!psos->w)
+        return ERROR_SIZE;
+    memset(psos->w, 0, 2 * psos->ns * sizeof(double));
+    return RES_OK;
+}
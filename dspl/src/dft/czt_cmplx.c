@@ -0,0 +1,199 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Chirp Z-transform of the complex input vector.
+
+The function calculates the chirp Z-transform (CZT)
+of the `n`-points complex input vector `x`
+on the `m`-points spiral contour of the `czt_t` object:
+\f[
+Y(k) = \sum_{p = 0}^{n-1} x(p) A^{-p} W^{pk}, \qquad k = 0 \ldots m-1.
+\f]
+The CZT is calculated by the Bluestein algorithm as the fast convolution
+of the chirp modulated input and the chirp filter
+by two `l`-points FFT, \f$ l \geq n + m - 1 \f$,
+so the number of operations is
+\f$ O((n+m) \log_2(n+m)) \f$ for any contour. \n
+The chirp vectors and the chirp filter spectrum are calculated once
+by the \ref czt_create function, so the object can be used
+for any number of the signal frames.
+
+\param[in]  x
+Pointer to the complex input vector. \n
+Vector size is `[n x 1]`, where `n` is the `czt_t` object input size. \n \n
+
+\param[in]  pczt
+Pointer to the `czt_t` object created by the \ref czt_create
+or \ref zoom_fft function. \n \n
+
+\param[out]  y
+Pointer to the CZT vector. \n
+Vector size is `[m x 1]`, where `m` is the number of the contour
+points of the `czt_t` object. \n
+Memory must be allocated. \n
+Pointer `y` can be equal to `x`
+if the vector size is not less than `m`. \n \n
+
+\return
+`RES_OK` if the CZT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+czt_t czt = {0};
+complex_t w, a;
+
+// 64 bins of the 1024-points DFT from the bin 100
+RE(w) = cos(M_2PI / 1024.0);  IM(w) = -sin(M_2PI / 1024.0);
+RE(a) = cos(M_2PI * 100.0 / 1024.0);  IM(a) = sin(M_2PI * 100.0 / 1024.0);
+
+czt_create(&czt, 1024, 64, w, a);
+czt_cmplx(x, &czt, y);
+czt_free(&czt);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief ЛЧМ Z-преобразование комплексного вектора
+
+Функция рассчитывает ЛЧМ Z-преобразование
+`n` отсчетов комплексного входного вектора `x`
+в `m` точках спирального контура объекта `czt_t`:
+\f[
+Y(k) = \sum_{p = 0}^{n-1} x(p) A^{-p} W^{pk}, \qquad k = 0 \ldots m-1.
+\f]
+ЛЧМ Z-преобразование рассчитывается алгоритмом Блюстейна
+как быстрая свертка модулированного ЛЧМ сигналом входного вектора
+и ЛЧМ фильтра при помощи двух `l`-точечных БПФ,
+\f$ l \geq n + m - 1 \f$,
+поэтому количество операций равно
+\f$ O((n+m) \log_2(n+m)) \f$ для любого контура. \n
+ЛЧМ векторы и спектр ЛЧМ фильтра рассчитываются один раз
+функцией \ref czt_create, поэтому объект может быть использован
+для любого количества кадров сигнала.
+
+\param[in]  x
+Указатель на комплексный входной вектор. \n
+Размер вектора `[n x 1]`, где `n` --- размер входного сигнала
+объекта `czt_t`. \n \n
+
+\param[in]  pczt
+Указатель на объект `czt_t`, созданный функцией \ref czt_create
+или \ref zoom_fft. \n \n
+
+\param[out]  y
+Указатель на вектор ЛЧМ Z-преобразования. \n
+Размер вектора `[m x 1]`, где `m` --- количество точек контура
+объекта `czt_t`. \n
+Память должна быть выделена. \n
+Указатель `y` может совпадать с `x`,
+если размер вектора не меньше `m`. \n \n
+
+\return
+`RES_OK` если преобразование рассчитано успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+czt_t czt = {0};
+complex_t w, a;
+
+// 64 отсчета 1024-точечного ДПФ начиная с отсчета 100
+RE(w) = cos(M_2PI / 1024.0);  IM(w) = -sin(M_2PI / 1024.0);
+RE(a) = cos(M_2PI * 100.0 / 1024.0);  IM(a) = sin(M_2PI * 100.0 / 1024.0);
+
+czt_create(&czt, 1024, 64, w, a);
+czt_cmplx(x, &czt, y);
+czt_free(&czt);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API czt_cmplx(complex_t* x, czt_t* pczt, complex_t* y)
+{
+    complex_t *t, *h, *wn, *wm, z;
+    int k, n, m, l, err;
+
+    if(!x || !y || !pczt)
+        return ERROR_PTR;
+    if(!pczt->t || pczt->n < 1 || pczt->m < 1)
+        return ERROR_SIZE;
+
+    n  = pczt->n;
+    m  = pczt->m;
+    l  = pczt->l;
+    t  = pczt->t;
+    h  = pczt->h;
+    wn = pczt->wn;
+    wm = pczt->wm;
+
+    /* t(k) = x(k) * A^(-k) W^(k^2/2) */
+    for(k = 0; k < n; k++)
+    {
+        RE(t[k]) = CMRE(x[k], wn[k]);
+        IM(t[k]) = CMIM(x[k], wn[k]);
+    }
+    memset(t+n, 0, (l-n)*sizeof(complex_t));
+
+    err = fft_cmplx(t, l, &pczt->fft, t);
+    if(err != RES_OK)
+        return err;
+
+    /* inverse FFT of T(k)*H(k) as conj(FFT(conj(T(k)*H(k)))) */
+    for(k = 0; k < l; k++)
+    {
+        RE(z) =  CMRE(t[k], h[k]);
+        IM(z) = -CMIM(t[k], h[k]);
+        RE(t[k]) = RE(z);
+        IM(t[k]) = IM(z);
+    }
+
+    err = fft_cmplx(t, l, &pczt->fft, t);
+    if(err != RES_OK)
+        return err;
+
+    /* y(k) = conj(t(k)) * W^(k^2/2) */
+    for(k = 0; k < m; k++)
+    {
+        RE(y[k]) = CMCONJRE(wm[k], t[k]);
+        IM(y[k]) = CMCONJIM(wm[k], t[k]);
+    }
+    return RES_OK;
+}
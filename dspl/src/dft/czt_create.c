@@ -0,0 +1,377 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#include <math.h>
+
+
+
+
+/* smallest l >= n with the prime factors 2, 3, 5 and 7 only */
+static int czt_fft_size(int n)
+{
+    int l, r;
+    for(l = n; ; l++)
+    {
+        r = l;
+        while(r % 2 == 0) r /= 2;
+        while(r % 3 == 0) r /= 3;
+        while(r % 5 == 0) r /= 5;
+        while(r % 7 == 0) r /= 7;
+        if(r == 1)
+            return l;
+    }
+}
+
+
+
+
+/*******************************************************************************
+Fractional part of x * (f[0] + f[1]) in the range [-0.5, 0.5].
+f[0] + f[1] is the double-double angle in cycles, x = k or x = k^2/2
+is exact. The x * f[0] product error is calculated by fma, and
+the integer part is removed before the low parts are added,
+thus the result error does not grow with x
+*******************************************************************************/
+static double czt_cycles(double x, double* f)
+{
+    double p, r;
+    p = x * f[0];
+    r = fma(x, f[0], -p);
+    p -= floor(p + 0.5);
+    p += r + x * f[1];
+    return p - floor(p + 0.5);
+}
+
+
+
+
+/*******************************************************************************
+y = a^(-k) * w^(e),
+la and lw are the logarithms of |a| and |w|,
+fa and fw are the double-double angles of a and w in cycles
+*******************************************************************************/
+static void czt_chirp(double la, double* fa, double lw, double* fw,
+                      double k, double e, complex_t y)
+{
+    double mag, phi;
+    mag = exp(e * lw - k * la);
+    phi = M_2PI * (czt_cycles(e, fw) - czt_cycles(k, fa));
+    RE(y) = mag * cos(phi);
+    IM(y) = mag * sin(phi);
+}
+
+
+
+
+/*******************************************************************************
+Double-double ratio f[0] + f[1] = (x + xl) / (y + yl)
+*******************************************************************************/
+void czt_div(double x, double xl, double y, double yl, double* f)
+{
+    double q, r;
+    q = x / y;
+    r = fma(-q, y, x) + xl - q * yl;
+    f[0] = q;
+    f[1] = r / y;
+}
+
+
+
+
+/*******************************************************************************
+Angle of z in cycles as the double-double f[0] + f[1].
+The angle is set to the exact ratio 1/q if it differs from 1/q
+by the atan2 rounding only (e.g. W = exp(-j 2 pi / n) of the DFT bins)
+*******************************************************************************/
+static void czt_angle(complex_t z, double* f)
+{
+    double q;
+    f[0] = atan2(IM(z), RE(z)) / M_2PI;
+    f[1] = 0.0;
+    if(f[0] == 0.0)
+        return;
+    q = floor(1.0 / f[0] + 0.5);
+    if(q != 0.0 && fabs(f[0] * q - 1.0) < 8.0 * DBL_EPSILON)
+        czt_div(1.0, 0.0, q, 0.0, f);
+}
+
+
+
+
+/*******************************************************************************
+Logarithm of |z|, it is set to zero if |z| = 1 up to rounding,
+because the chirp magnitudes |z|^(k^2/2) amplify the rounding error
+*******************************************************************************/
+static double czt_logabs(complex_t z)
+{
+    double r = ABSSQR(z);
+    if(fabs(r - 1.0) < 8.0 * DBL_EPSILON)
+        return 0.0;
+    return 0.5 * log(r);
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Create the chirp Z-transform object.
+
+The function fills the `czt_t` object of the `n`-points input
+and `m`-points output chirp Z-transform (CZT)
+\f[
+Y(k) = \sum_{p = 0}^{n-1} x(p) z_k^{-p}, \qquad
+z_k = A \cdot W^{-k}, \qquad k = 0 \ldots m-1,
+\f]
+for the spiral contour given by the start point \f$ A \f$
+and the points ratio \f$ W \f$. \n
+The function calculates the input and output chirps and the FFT
+of the chirp filter of size \f$ l \geq n + m - 1 \f$
+(the prime factors of `l` are 2, 3, 5 and 7).
+The `l`-points FFT plan is requested from the FFT plan cache. \n
+If the object is already created for the same `n`, `m`, `w` and `a`,
+the function does nothing. \n
+The chirp phases are calculated by the contour angles in cycles
+reduced modulo the period in the double-double arithmetic,
+thus the phase error does not grow with \f$ k^2 \f$.
+
+\param[in,out]  pczt
+Pointer to the `czt_t` object. \n
+Pointer cannot be `NULL`. \n
+The object must be zeroed before the first call. \n \n
+
+\param[in]  n
+Input signal size. \n \n
+
+\param[in]  m
+Number of the contour points. \n \n
+
+\param[in]  w
+Contour points ratio \f$ W \f$. \n
+\f$ W = \exp(-j 2\pi / n) \f$ and \f$ A = 1 \f$
+give the `m` first DFT bins. \n \n
+
+\param[in]  a
+Contour start point \f$ A \f$. \n \n
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\note
+If \f$ |W| \neq 1 \f$ the chirp magnitudes \f$ |W|^{k^2/2} \f$
+grow or decay quickly with `n` and `m`,
+and the CZT accuracy degrades. \n
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Создание объекта ЛЧМ Z-преобразования
+
+Функция заполняет объект `czt_t` ЛЧМ Z-преобразования
+`n` отсчетов входного сигнала в `m` точек контура
+\f[
+Y(k) = \sum_{p = 0}^{n-1} x(p) z_k^{-p}, \qquad
+z_k = A \cdot W^{-k}, \qquad k = 0 \ldots m-1,
+\f]
+где спиральный контур задан начальной точкой \f$ A \f$
+и отношением соседних точек \f$ W \f$. \n
+Функция рассчитывает входной и выходной ЛЧМ векторы и БПФ
+ЛЧМ фильтра размера \f$ l \geq n + m - 1 \f$
+(простые множители `l` равны 2, 3, 5 и 7).
+План `l`-точечного БПФ запрашивается из кэша планов БПФ. \n
+Если объект уже создан для тех же `n`, `m`, `w` и `a`,
+то функция ничего не делает. \n
+Фазы ЛЧМ векторов рассчитываются по углам контура в периодах,
+приведенным по модулю периода в арифметике двойной-двойной точности,
+поэтому ошибка фазы не растет с ростом \f$ k^2 \f$.
+
+\param[in,out]  pczt
+Указатель на объект `czt_t`. \n
+Указатель не должен быть `NULL`. \n
+Объект должен быть обнулен перед первым вызовом. \n \n
+
+\param[in]  n
+Размер входного сигнала. \n \n
+
+\param[in]  m
+Количество точек контура. \n \n
+
+\param[in]  w
+Отношение соседних точек контура \f$ W \f$. \n
+\f$ W = \exp(-j 2\pi / n) \f$ и \f$ A = 1 \f$
+соответствуют `m` первым отсчетам ДПФ. \n \n
+
+\param[in]  a
+Начальная точка контура \f$ A \f$. \n \n
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\note
+Если \f$ |W| \neq 1 \f$, то модули ЛЧМ векторов \f$ |W|^{k^2/2} \f$
+быстро растут или убывают с ростом `n` и `m`,
+и точность ЛЧМ Z-преобразования снижается. \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API czt_create(czt_t* pczt, int n, int m, complex_t w, complex_t a)
+{
+    double fw[2], fa[2];
+
+    czt_angle(w, fw);
+    czt_angle(a, fa);
+    return czt_create_krn(pczt, n, m, w, fw, a, fa);
+}
+
+
+
+
+/*******************************************************************************
+CZT object of the contour W = |w| exp(j 2 pi fw), A = |a| exp(j 2 pi fa),
+fw and fa are the double-double angles in cycles (see czt_create)
+*******************************************************************************/
+int czt_create_krn(czt_t* pczt, int n, int m, complex_t w, double* fw,
+                   complex_t a, double* fa)
+{
+    complex_t *v;
+    complex_t *wn = NULL, *wm = NULL, *h = NULL, *t = NULL;
+    double e, lw, la;
+    int k, l, err;
+
+    if(!pczt || !fw || !fa)
+        return ERROR_PTR;
+    if(n < 1 || m < 1)
+        return ERROR_SIZE;
+    if(ABSSQR(w) == 0.0 || ABSSQR(a) == 0.0)
+        return ERROR_ARG_PARAM;
+
+    if(pczt->n == n && pczt->m == m &&
+       RE(pczt->w) == RE(w) && IM(pczt->w) == IM(w) &&
+       RE(pczt->a) == RE(a) && IM(pczt->a) == IM(a) &&
+       pczt->fw[0] == fw[0] && pczt->fw[1] == fw[1] &&
+       pczt->fa[0] == fa[0] && pczt->fa[1] == fa[1])
+        return RES_OK;
+
+    l = czt_fft_size(n + m - 1);
+
+    wn = (complex_t*) malloc(n * sizeof(complex_t));
+    wm = (complex_t*) malloc(m * sizeof(complex_t));
+    h  = (complex_t*) malloc(l * sizeof(complex_t));
+    t  = (complex_t*) malloc(l * sizeof(complex_t));
+    if(!wn || !wm || !h || !t)
+    {
+        err = ERROR_MALLOC;
+        goto error_proc;
+    }
+
+    err = fft_create(&pczt->fft, l);
+    if(err != RES_OK)
+        goto error_proc;
+
+    lw = czt_logabs(w);
+    la = czt_logabs(a);
+
+    /* wn(k) = A^(-k) W^(k^2/2), wm(k) = W^(k^2/2) */
+    for(k = 0; k < n; k++)
+    {
+        e = 0.5 * (double)k * (double)k;
+        czt_chirp(la, fa, lw, fw, (double)k, e, wn[k]);
+    }
+    for(k = 0; k < m; k++)
+    {
+        e = 0.5 * (double)k * (double)k;
+        czt_chirp(la, fa, lw, fw, 0.0, e, wm[k]);
+    }
+
+    /* chirp filter v(k) = W^(-k^2/2) for k = -(n-1) ... m-1 (circular) */
+    v = t;
+    memset(v, 0, l * sizeof(complex_t));
+    for(k = 0; k < m; k++)
+    {
+        RE(v[k]) =  RE(wm[k]) / ABSSQR(wm[k]);
+        IM(v[k]) = -IM(wm[k]) / ABSSQR(wm[k]);
+    }
+    for(k = 1; k < n; k++)
+    {
+        e = -0.5 * (double)k * (double)k;
+        czt_chirp(la, fa, lw, fw, 0.0, e, v[l-k]);
+    }
+
+    err = fft_cmplx(v, l, &pczt->fft, h);
+    if(err != RES_OK)
+        goto error_proc;
+    for(k = 0; k < l; k++)
+    {
+        RE(h[k]) /= (double)l;
+        IM(h[k]) /= (double)l;
+    }
+
+    if(pczt->wn)
+        free(pczt->wn);
+    if(pczt->wm)
+        free(pczt->wm);
+    if(pczt->h)
+        free(pczt->h);
+    if(pczt->t)
+        free(pczt->t);
+
+    pczt->wn = wn;
+    pczt->wm = wm;
+    pczt->h  = h;
+    pczt->t  = t;
+    RE(pczt->w) = RE(w);
+    IM(pczt->w) = IM(w);
+    RE(pczt->a) = RE(a);
+    IM(pczt->a) = IM(a);
+    pczt->fw[0] = fw[0];
+    pczt->fw[1] = fw[1];
+    pczt->fa[0] = fa[0];
+    pczt->fa[1] = fa[1];
+    pczt->n  = n;
+    pczt->m  = m;
+    pczt->l  = l;
+    return RES_OK;
+
+error_proc:
+    if(wn)
+        free(wn);
+    if(wm)
+        free(wm);
+    if(h)
+        free(h);
+    if(t)
+        free(t);
+    return err;
+}
@@ -0,0 +1,75 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Free `czt_t` structure.
+
+The function clears the chirp vectors and the FFT object
+of the `czt_t` structure.
+
+\param[in] pczt
+Pointer to the `czt_t` object. \n
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Очистить структуру `czt_t` ЛЧМ Z-преобразования
+
+Функция очищает ЛЧМ векторы и объект БПФ структуры `czt_t`.
+
+\param[in] pczt
+Указатель на структуру `czt_t`. \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+void DSPL_API czt_free(czt_t* pczt)
+{
+    if(!pczt)
+        return;
+    if(pczt->wn)
+        free(pczt->wn);
+    if(pczt->wm)
+        free(pczt->wm);
+    if(pczt->h)
+        free(pczt->h);
+    if(pczt->t)
+        free(pczt->t);
+    fft_free(&pczt->fft);
+
+    memset(pczt, 0, sizeof(czt_t));
+}
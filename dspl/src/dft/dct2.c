@@ -0,0 +1,143 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Discrete cosine transform of type II (DCT-II).
+
+Function calculates \f$ n \f$-points DCT-II of the real vector
+\f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \cos \left( \frac{\pi}{2n} k (2m+1) \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$. The inverse transform is \ref dct3. \n
+The input vector is reordered as \f$ v(m) = x(2m) \f$, 
+\f$ v(n-1-m) = x(2m+1) \f$ and the DCT is calculated from the 
+\f$ n \f$-points FFT of the real vector \f$ v(m) \f$ 
+(the \f$ n/2 \f$-points complex FFT for even `n`, as the \ref fft_r2c
+function does) multiplied by the \f$ \exp(-j \pi k / 2n) \f$ twiddle factors.
+Thus the DCT requires about four times less calculations 
+than the \f$ 2n \f$-points complex FFT of the mirrored vector.
+
+\param[in]  x
+Pointer to the input real vector \f$x(m)\f$,
+\f$ m = 0 \ldots n-1 \f$.  \n
+Vector size is `[n x 1]`.  \n \n
+
+\param[in]  n
+Transform size \f$n\f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+The function creates the `fft_t` object plan of the `n/2`-points FFT
+for even `n` or of the `n`-points FFT for odd `n`. 
+The transform twiddle factors are kept by the object. \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the result real vector, 
+\f$ k = 0 \ldots n-1 \f$. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n
+The output vector can be the same as the input vector `x`. \n \n
+
+\return
+`RES_OK` if the transform is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include dct_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Дискретное косинусное преобразование второго типа (ДКП-II)
+
+Функция рассчитывает \f$ n \f$-точечное ДКП-II вещественного вектора
+\f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \cos \left( \frac{\pi}{2n} k (2m+1) \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$. Обратное преобразование --- \ref dct3. \n
+Входной вектор переупорядочивается как \f$ v(m) = x(2m) \f$, 
+\f$ v(n-1-m) = x(2m+1) \f$, и ДКП рассчитывается по 
+\f$ n \f$-точечному БПФ вещественного вектора \f$ v(m) \f$ 
+(\f$ n/2 \f$-точечному комплексному БПФ при четном `n`, аналогично 
+функции \ref fft_r2c), умноженному на поворотные коэффициенты
+\f$ \exp(-j \pi k / 2n) \f$.
+Таким образом ДКП требует примерно в четыре раза меньше вычислений, 
+чем \f$ 2n \f$-точечное комплексное БПФ симметрично продолженного вектора.
+
+\param[in]  x
+Указатель на входной вещественный вектор \f$x(m)\f$,
+\f$ m = 0 \ldots n-1 \f$.  \n
+Размер вектора `[n x 1]`.  \n \n
+
+\param[in]  n
+Размер преобразования \f$n\f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Функция создает план `n/2`-точечного БПФ объекта `fft_t`
+при четном `n` или `n`-точечного БПФ при нечетном `n`.
+Поворотные коэффициенты преобразования хранятся в объекте. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на вещественный вектор результата,
+\f$ k = 0 \ldots n-1 \f$. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n
+Выходной вектор может совпадать с входным вектором `x`. \n \n
+
+\return
+`RES_OK` если преобразование рассчитано успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции:
+
+\include dct_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API dct2(double* x, int n, fft_t* pfft, double* y)
+{
+    return dct_krn(x, n, 1, DSPL_DCT2, pfft, y);
+}
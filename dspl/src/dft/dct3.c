@@ -0,0 +1,138 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Discrete cosine transform of type III (inverse DCT-II).
+
+Function calculates \f$ n \f$-points DCT-III of the real vector
+\f$ X(k) \f$, \f$ k = 0 \ldots n-1 \f$: \n
+\f[
+  y(m) = \frac{1}{n} \left( X(0) + 2 \sum_{k = 1}^{n-1} X(k) 
+  \cos \left( \frac{\pi}{2n} k (2m+1) \right) \right),
+\f]
+here \f$ m = 0 \ldots n-1 \f$. \n
+The function is the exact inverse of the \ref dct2 function.
+The spectrum \f$ V(k) = \exp(j \pi k / 2n) (X(k) - j X(n-k)) \f$ of the
+reordered vector is formed and the real IFFT is calculated 
+as the \ref ifft function does.
+
+\param[in]  x
+Pointer to the input real vector \f$x(m)\f$,
+\f$ m = 0 \ldots n-1 \f$.  \n
+Vector size is `[n x 1]`.  \n \n
+
+\param[in]  n
+Transform size \f$n\f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+The function creates the `fft_t` object plan of the `n/2`-points FFT
+for even `n` or of the `n`-points FFT for odd `n`. 
+The transform twiddle factors are kept by the object. \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the result real vector, 
+\f$ k = 0 \ldots n-1 \f$. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n
+The output vector can be the same as the input vector `x`. \n \n
+
+\return
+`RES_OK` if the transform is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include dct_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Дискретное косинусное преобразование третьего типа (обратное ДКП-II)
+
+Функция рассчитывает \f$ n \f$-точечное ДКП-III вещественного вектора
+\f$ X(k) \f$, \f$ k = 0 \ldots n-1 \f$: \n
+\f[
+  y(m) = \frac{1}{n} \left( X(0) + 2 \sum_{k = 1}^{n-1} X(k) 
+  \cos \left( \frac{\pi}{2n} k (2m+1) \right) \right),
+\f]
+где \f$ m = 0 \ldots n-1 \f$. \n
+Функция является точным обращением функции \ref dct2.
+Формируется спектр \f$ V(k) = \exp(j \pi k / 2n) (X(k) - j X(n-k)) \f$
+переупорядоченного вектора и рассчитывается вещественное ОБПФ
+аналогично функции \ref ifft.
+
+\param[in]  x
+Указатель на входной вещественный вектор \f$x(m)\f$,
+\f$ m = 0 \ldots n-1 \f$.  \n
+Размер вектора `[n x 1]`.  \n \n
+
+\param[in]  n
+Размер преобразования \f$n\f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Функция создает план `n/2`-точечного БПФ объекта `fft_t`
+при четном `n` или `n`-точечного БПФ при нечетном `n`.
+Поворотные коэффициенты преобразования хранятся в объекте. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на вещественный вектор результата,
+\f$ k = 0 \ldots n-1 \f$. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n
+Выходной вектор может совпадать с входным вектором `x`. \n \n
+
+\return
+`RES_OK` если преобразование рассчитано успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции:
+
+\include dct_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API dct3(double* x, int n, fft_t* pfft, double* y)
+{
+    return dct_krn(x, n, 1, DSPL_DCT3, pfft, y);
+}
@@ -0,0 +1,132 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Batch discrete cosine and sine transforms.
+
+Function calculates `cnt` \f$ n \f$-points DCT or DST of the real vectors
+\f$ x_b(m) = \textrm{x[b} \cdot \textrm{n + m]} \f$, 
+\f$ b = 0 \ldots cnt-1 \f$ (for example the image blocks). \n
+The transform type is set by the `type` parameter:
+`DSPL_DCT2` (see \ref dct2), `DSPL_DCT3` (see \ref dct3), 
+`DSPL_DCT4` (see \ref dct4) or `DSPL_DST2` (see \ref dst). \n
+The plan and the twiddle factors are prepared once per call.
+Small transforms are calculated by groups, so the FFT codelets process
+the blocks of all transforms of the group by one call.
+
+\param[in]  x
+Pointer to the input real vectors. \n
+Vector size is `[n*cnt x 1]`.  \n \n
+
+\param[in]  n
+Transform size \f$n\f$. \n \n
+
+\param[in]  cnt
+Number of the transforms. \n \n
+
+\param[in]  type
+Transform type. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the transforms results. \n
+Result of the vector `b` is stored as `y[b*n + k]`. \n
+Vector size is `[n*cnt x 1]`. \n
+Memory must be allocated. \n
+The output vector can be the same as the input vector `x`. \n \n
+
+\return
+`RES_OK` if the transforms are calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Пакетные дискретные косинусные и синусные преобразования
+
+Функция рассчитывает `cnt` \f$ n \f$-точечных ДКП или ДСП 
+вещественных векторов
+\f$ x_b(m) = \textrm{x[b} \cdot \textrm{n + m]} \f$, 
+\f$ b = 0 \ldots cnt-1 \f$ (например блоков изображения). \n
+Тип преобразования задается параметром `type`:
+`DSPL_DCT2` (см. \ref dct2), `DSPL_DCT3` (см. \ref dct3), 
+`DSPL_DCT4` (см. \ref dct4) или `DSPL_DST2` (см. \ref dst). \n
+План и поворотные коэффициенты подготавливаются один раз за вызов.
+Преобразования малого размера рассчитываются группами, при этом 
+ядра БПФ обрабатывают блоки всех преобразований группы за один вызов.
+
+\param[in]  x
+Указатель на входные вещественные векторы. \n
+Размер вектора `[n*cnt x 1]`.  \n \n
+
+\param[in]  n
+Размер преобразования \f$n\f$. \n \n
+
+\param[in]  cnt
+Количество преобразований. \n \n
+
+\param[in]  type
+Тип преобразования. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на результаты преобразований. \n
+Результат вектора `b` сохраняется как `y[b*n + k]`. \n
+Размер вектора `[n*cnt x 1]`. \n
+Память должна быть выделена. \n
+Выходной вектор может совпадать с входным вектором `x`. \n \n
+
+\return
+`RES_OK` если преобразования рассчитаны успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API dct_batch(double* x, int n, int cnt, int type, 
+                       fft_t* pfft, double* y)
+{
+    return dct_krn(x, n, cnt, type, pfft, y);
+}
@@ -0,0 +1,334 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#include <math.h>
+
+
+
+
+/*******************************************************************************
+Twiddle factors of the n-points DCT and DST:
+wd[k]              = exp(-j pi k / (2n)),       k = 0 ... n/2
+For even n (n/2-points DCT-IV):
+wd[n/2+1 + m]      = exp(-j pi (4m+1) / (4n)),  m = 0 ... n/2-1
+wd[n/2+1 + n/2 + k]= exp(-j pi k / n),          k = 0 ... n/2-1
+For odd n (DCT-IV by the n-points DCT-II):
+wd[n/2+1 + m]      = exp(-j pi (2m+1) / (4n)),  m = 0 ... n-1
+*******************************************************************************/
+static int dct_twiddle(fft_t* pfft, int n)
+{
+    complex_t *w, *w4;
+    double phi;
+    int k, n2;
+
+    if(pfft->wd && pfft->nd == n)
+        return RES_OK;
+
+    n2 = n/2;
+    w = pfft->wd ? 
+        (complex_t*) realloc(pfft->wd, (n2+1+n)*sizeof(complex_t)):
+        (complex_t*) malloc(           (n2+1+n)*sizeof(complex_t));
+    pfft->nd = 0;
+    if(!w)
+    {
+        pfft->wd = NULL;
+        return ERROR_MALLOC;
+    }
+    pfft->wd = w;
+
+    for(k = 0; k <= n2; k++)
+    {
+        phi = -M_PI * (double)k / (double)(2*n);
+        RE(w[k]) = cos(phi);
+        IM(w[k]) = sin(phi);
+    }
+
+    w4 = w + n2 + 1;
+    if(n%2)
+    {
+        for(k = 0; k < n; k++)
+        {
+            phi = -M_PI * (double)(2*k+1) / (double)(4*n);
+            RE(w4[k]) = cos(phi);
+            IM(w4[k]) = sin(phi);
+        }
+    }
+    else
+    {
+        for(k = 0; k < n2; k++)
+        {
+            phi = -M_PI * (double)(4*k+1) / (double)(4*n);
+            RE(w4[k]) = cos(phi);
+            IM(w4[k]) = sin(phi);
+            phi = -M_PI * (double)k / (double)n;
+            RE(w4[n2+k]) = cos(phi);
+            IM(w4[n2+k]) = sin(phi);
+        }
+    }
+    pfft->nd = n;
+    return RES_OK;
+}
+
+
+
+
+/* Index of the DCT-II input x(i) in the permuted vector v:
+   v(i) = x(2i), v(n-1-i) = x(2i+1) */
+static int dct_perm(int i, int n)
+{
+    return i < (n+1)/2 ? 2*i : 2*(n-1-i) + 1;
+}
+
+
+
+
+/*******************************************************************************
+Input vector x of the n-points transform to the nf-points FFT input z.
+tv is the n/2+1 points workspace.
+*******************************************************************************/
+static void dct_pack(double* x, int n, int type, fft_t* pfft, 
+                     complex_t* tv, complex_t* z)
+{
+    complex_t* w = pfft->wd;
+    complex_t* w4 = pfft->wd + n/2 + 1;
+    double* v = (double*)z;
+    double a, b;
+    int i, m, n2 = n/2;
+
+    /* odd n DCT-IV is calculated by the DCT-II */
+    if(type == DSPL_DCT4 && n%2)
+        type = DSPL_DCT2 | DSPL_DCT4;
+
+    switch(type)
+    {
+        case DSPL_DCT2:
+        case DSPL_DST2:
+        case DSPL_DCT2 | DSPL_DCT4:
+            /* permuted input v(i) (DST-II: (-1)^m x(m), 
+               odd n DCT-IV: 2 cos(pi (2m+1) / (4n)) x(m)), 
+               even n: z(m) = v(2m) + j v(2m+1) */
+            for(i = 0; i < n; i++)
+            {
+                m = dct_perm(i, n);
+                a = x[m];
+                if(type == DSPL_DST2 && (m & 1))
+                    a = -a;
+                if(type == (DSPL_DCT2 | DSPL_DCT4))
+                    a *= 2.0 * RE(w4[m]);
+                if(n%2)
+                {
+                    RE(z[i]) = a;
+                    IM(z[i]) = 0.0;
+                }
+                else
+                    v[i] = a;
+            }
+            break;
+
+        case DSPL_DCT3:
+            /* V(k) = exp(j pi k / (2n)) (X(k) - j X(n-k)) */
+            RE(tv[0]) = x[0];
+            IM(tv[0]) = 0.0;
+            for(i = 1; i <= n2; i++)
+            {
+                a =  x[i];
+                b = -x[n-i];
+                RE(tv[i]) = a * RE(w[i]) + b * IM(w[i]);
+                IM(tv[i]) = b * RE(w[i]) - a * IM(w[i]);
+            }
+            if(n%2)
+            {
+                /* full conjugate spectrum scaled by 1/n */
+                RE(z[0]) = RE(tv[0]) / (double)n;
+                IM(z[0]) = 0.0;
+                for(i = 1; i <= n2; i++)
+                {
+                    RE(z[i])   =  RE(tv[i]) / (double)n;
+                    IM(z[i])   = -IM(tv[i]) / (double)n;
+                    RE(z[n-i]) =  RE(tv[i]) / (double)n;
+                    IM(z[n-i]) =  IM(tv[i]) / (double)n;
+                }
+            }
+            else
+                fft_c2r_merge(tv, n2, pfft->plan->wr, 1.0 / (double)n, z);
+            break;
+
+        case DSPL_DCT4:
+            /* z(m) = (x(2m) + j x(n-1-2m)) exp(-j pi (4m+1) / (4n)) */
+            for(i = 0; i < n2; i++)
+            {
+                a = x[2*i];
+                b = x[n-1-2*i];
+                RE(z[i]) = a * RE(w4[i]) - b * IM(w4[i]);
+                IM(z[i]) = a * IM(w4[i]) + b * RE(w4[i]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+
+
+
+/*******************************************************************************
+nf-points FFT output z to the output vector y of the n-points transform.
+tv is the n/2+1 points workspace.
+*******************************************************************************/
+static void dct_unpack(complex_t* z, int n, int type, fft_t* pfft, 
+                       complex_t* tv, double* y)
+{
+    complex_t* w = pfft->wd;
+    complex_t* w4 = pfft->wd + n/2 + 1;
+    complex_t* V;
+    double pr, pi, v;
+    int k, i, n2 = n/2;
+
+    if(type == DSPL_DCT4 && n%2)
+        type = DSPL_DCT2 | DSPL_DCT4;
+
+    switch(type)
+    {
+        case DSPL_DCT2:
+        case DSPL_DST2:
+        case DSPL_DCT2 | DSPL_DCT4:
+            /* spectrum V(k) of the permuted input, k = 0 ... n/2 */
+            if(n%2)
+                V = z;
+            else
+            {
+                memcpy(tv, z, n2*sizeof(complex_t));
+                fft_r2c_split(tv, n2, pfft->plan->wr);
+                V = tv;
+            }
+            /* Y(k) = Re(exp(-j pi k/(2n)) V(k)), Y(n-k) = -Im(...) */
+            for(k = 0; k <= n2; k++)
+            {
+                pr = CMRE(V[k], w[k]);
+                pi = CMIM(V[k], w[k]);
+                if(type == DSPL_DST2)
+                {
+                    y[n-1-k] = pr;
+                    if(k)
+                        y[k-1] = -pi;
+                }
+                else
+                {
+                    y[k] = pr;
+                    if(k)
+                        y[n-k] = -pi;
+                }
+            }
+            /* odd n DCT-IV: C2(k) = Y(k) + Y(k-1), C2(0) = 2 Y(0) */
+            if(type == (DSPL_DCT2 | DSPL_DCT4))
+            {
+                y[0] *= 0.5;
+                for(k = 1; k < n; k++)
+                    y[k] -= y[k-1];
+            }
+            break;
+
+        case DSPL_DCT3:
+            /* v(i) to x(dct_perm(i)) */
+            for(i = 0; i < n; i++)
+            {
+                if(n%2)
+                    v = RE(z[i]);
+                else
+                    v = (i%2) ? -IM(z[i/2]) : RE(z[i/2]);
+                y[dct_perm(i, n)] = v;
+            }
+            break;
+
+        case DSPL_DCT4:
+            /* c(k) = Z(k) exp(-j pi k / n), 
+               Y(2k) = Re c(k), Y(n-1-2k) = -Im c(k) */
+            for(k = 0; k < n2; k++)
+            {
+                y[2*k]     =  CMRE(z[k], w4[n2+k]);
+                y[n-1-2*k] = -CMIM(z[k], w4[n2+k]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+
+
+
+/*******************************************************************************
+cnt n-points DCT or DST of the contiguous vectors x[b*n + m] to y[b*n + k].
+Even n transforms use the n/2-points complex FFT, odd n transforms use 
+the n-points complex FFT. Small transforms are processed by groups 
+by one FFT schedule execution. x can be equal to y.
+*******************************************************************************/
+int dct_krn(double* x, int n, int cnt, int type, fft_t* pfft, double* y)
+{
+    int err, nf, g, b, m;
+    complex_t* tv;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || cnt < 1)
+        return ERROR_SIZE;
+    if(type != DSPL_DCT2 && type != DSPL_DCT3 && 
+       type != DSPL_DCT4 && type != DSPL_DST2)
+        return ERROR_ARG_PARAM;
+
+    nf = n%2 ? n : n/2;
+    err = fft_create(pfft, nf);
+    if(err != RES_OK)
+        return err;
+    err = dct_twiddle(pfft, n);
+    if(err != RES_OK)
+        return err;
+
+    /* group size */
+    g = nf < FFT_BATCH_SIZE ? FFT_BATCH_SIZE / nf : 1;
+    if(g > cnt)
+        g = cnt;
+    err = fft_workspace(pfft, g*nf + nf + 1);
+    if(err != RES_OK)
+        return err;
+    tv = pfft->t0 + g*nf;
+
+    for(b = 0; b < cnt; b += g)
+    {
+        if(g > cnt - b)
+            g = cnt - b;
+        for(m = 0; m < g; m++)
+            dct_pack(x + (b+m)*n, n, type, pfft, tv, pfft->t0 + m*nf);
+
+        fft_run(pfft->t0, pfft->t1, pfft->plan, pfft->plan->st, pfft->tb, g);
+
+        for(m = 0; m < g; m++)
+            dct_unpack(pfft->t1 + m*nf, n, type, pfft, tv, y + (b+m)*n);
+    }
+    return RES_OK;
+}
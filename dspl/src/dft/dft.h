@@ -2,12 +2,385 @@
 #define DFT_H
 
 
-/* sqrt(2^31) */
-#define FFT_COMPOSITE_MAX           46340
+/* Prime factor size above which Bluestein algorithm is used 
+   instead of the naive DFT */
+#define FFT_BLUESTEIN_MIN           32
 
+/* Bluestein FFT size 2^30 must not overflow int */
+#define FFT_BLUESTEIN_MAX           0x20000000
 
-/* FFT kernel */
-int fft_krn(complex_t* t0, complex_t* t1, fft_t* p, int n, int addr);
+/* Stage size up to which the schedule is executed stage by stage
+   over all blocks. Larger stages are executed block by block 
+   to keep the sub-blocks data in cache */
+#define FFT_FLAT_MAX                8192
+
+/* Batch FFT workspace size. Small FFTs are processed by groups of 
+   FFT_BATCH_SIZE / n transforms by one schedule execution */
+#define FFT_BATCH_SIZE              16384
+
+/* Pruned FFT cost of the one twiddle factor multiplication in the units
+   of the one radix-2 butterfly per point of the FFT */
+#define FFT_PRUNED_TW               2.0
+
+/* Pruned FFT cost of the input and output data passes per point */
+#define FFT_PRUNED_PASS             5.0
+
+/* Minimal number of the adjacent pruned FFT blocks processed together */
+#define FFT_PRUNED_GROUP            4
+
+/* Default number of the plans of the process-wide plan cache */
+#define FFT_CACHE_SIZE              32
+
+/* fft_t own flag value: the plan is taken from the plan cache */
+#define FFT_OWN_CACHE               2
+
+/* FFT size from which the schedule is executed by the worker threads
+   of the object set by fft_set_threads */
+#define FFT_THREADS_MIN             262144
+
+/* Maximal number of the stages of the FFT wisdom radix sequence */
+#define FFT_WISDOM_NST              32
+
+/* Minimal measurement time (seconds) of the candidate plan 
+   by fft_wisdom_measure */
+#define FFT_WISDOM_TIME             0.01
+
+/* Number of the measurements of the candidate plan, the minimal time
+   is used as the plan time */
+#define FFT_WISDOM_REP              3
+
+
+/* FFT codelet: cnt DFTs of the stage n1-points blocks from x to y */
+typedef void (*fft_codelet_t)(complex_t* x, complex_t* y, int cnt, 
+                              fft_plan_t* p, fft_stage_t* s, complex_t* tb);
+
+/* FFT schedule stage.
+   Stage transforms blocks of n = n1 * n2 points: 
+   n2 DFTs of n1 points by the codelet fn, twiddle factors multiplication
+   and n1 FFTs of n2 points by the next stage. 
+   The last stage of the schedule has n2 = 1. 
+   Flat stages are executed stage by stage, cnt is the number of the 
+   stage blocks in the block of the first flat stage. */
+struct fft_stage_s
+{
+    fft_codelet_t   fn;     /* n1-points codelet                        */
+    int             n;      /* stage block size                         */
+    int             n1;     /* codelet size                             */
+    int             n2;     /* next stage block size                    */
+    int             cnt;    /* number of flat stage blocks              */
+    int             addr;   /* twiddle factors offset in the plan w     */
+    int             flat;   /* flat stage flag                          */
+    int             vec;    /* vector codelet flag: the codelet reads 
+                               the stage block without input transpose 
+                               and writes the output with twiddles      */
+};
+
+/* FFT kernel (plan schedule execution, input t0 is destroyed) */
+int fft_krn(complex_t* t0, complex_t* t1, fft_t* p);
+
+/* FFT kernel without modification of the input x, x can be equal to y.
+   The input copy to t1 is used only if the first stage is not vector */
+int fft_krn_src(complex_t* x, complex_t* y, fft_t* p);
+
+/* FFT schedule execution for cnt blocks of the stage s */
+void fft_run(complex_t* t0, complex_t* t1, fft_plan_t* p, 
+             fft_stage_t* s, complex_t* tb, int cnt);
+
+/* t0 and t1 workspace vectors allocation for nt points */
+int fft_workspace(fft_t* pfft, int nt);
+
+/* Bluestein workspace tb allocation (2*nb points per thread) */
+int fft_workspace_tb(fft_t* pfft);
+
+/* n2-points plan pfft->half of the even 2*n2-points real FFT. The plan is
+   kept next to pfft->plan, so the complex FFT plan of the object is not
+   changed. If h is not NULL, h receives the copy of the object with
+   the half plan, which shares the pfft workspace and worker threads */
+int fft_create_half(fft_t* pfft, int n2, fft_t* h);
+
+/* Plan of the n-points FFT from the process-wide cache. The plan is created
+   and cached at the first request. *pplan is NULL if the cache is disabled */
+int fft_cache_get(int n, fft_plan_t** pplan);
+
+/* Release of the plan taken by fft_cache_get */
+void fft_cache_release(fft_plan_t* plan);
+
+/* Maximal number of the cached plans */
+void fft_cache_resize(int nplans);
+
+/* Plan cache hit and miss counters and the number of the cached plans */
+void fft_cache_counters(long long* hits, long long* misses, int* nplans);
+
+/* Unused cached plans are cleared, used plans are not returned by 
+   fft_cache_get anymore and they are cleared after the last release */
+void fft_cache_flush(void);
+
+/* FFT wisdom of the n-points FFT for the instruction set isa:
+   radixes r[0] ... r[nst-1] of the first plan stages. 
+   The stage uses the vector codelet if vec[i] is nonzero,
+   else the scalar codelet */
+typedef struct
+{
+    int n;
+    int isa;
+    int nst;
+    int r[FFT_WISDOM_NST];
+    int vec[FFT_WISDOM_NST];
+} fft_wisdom_t;
+
+/* Plan of the n-points FFT by the wisdom radix sequence wis.
+   The stages which are not set by wis are selected by the heuristic
+   (all stages if wis is NULL) */
+int fft_plan_build(fft_plan_t* plan, int n, fft_wisdom_t* wis);
+
+/* Copy of the process-wide wisdom of the n-points FFT and 
+   the instruction set isa. Returns 0 if the wisdom is not found */
+int fft_wisdom_find(int n, int isa, fft_wisdom_t* wis);
+
+/* Wisdom k of the process-wide wisdom table. Returns 0 if k is out of range */
+int fft_wisdom_get(int k, fft_wisdom_t* wis);
+
+/* Wisdom is added to the process-wide wisdom table 
+   or it replaces the wisdom of the same n and isa */
+int fft_wisdom_put(fft_wisdom_t* wis);
+
+/* Process-wide wisdom table is cleared */
+void fft_wisdom_reset(void);
+
+/* Nonzero if the wisdom radixes and codelets are valid for the FFT size */
+int fft_wisdom_check(fft_wisdom_t* wis);
+
+/* Worker threads pool of nth threads including the caller thread */
+fft_pool_t* fft_pool_create(int nth);
+
+/* Worker threads termination and the pool memory free */
+void fft_pool_free(fft_pool_t* pool);
+
+/* Multithreaded FFT schedule execution for cnt blocks of the stage s.
+   tb is the Bluestein workspace of all pool threads */
+void fft_run_mt(complex_t* t0, complex_t* t1, fft_plan_t* p,
+                fft_stage_t* s, complex_t* tb, int cnt, fft_pool_t* pool);
+
+/* Multithreaded vector codelet of the one block of the stage s from x to y */
+void fft_vcol_mt(complex_t* x, complex_t* y, fft_plan_t* p,
+                 fft_stage_t* s, fft_pool_t* pool);
+
+/* Multithreaded output transpose of the one block of the stage s */
+void fft_transpose_mt(complex_t* x, complex_t* y, fft_plan_t* p,
+                      fft_stage_t* s, fft_pool_t* pool);
+
+/* FFTs of cnt strided lines x[b*dist + k*stride] to the lines
+   y[b*ydist + k*ystride] by groups of the adjacent lines, the groups are
+   distributed between the worker threads of the object 
+   (x can be equal to y if the layouts are equal). 
+   The fft_t object must be created for the lines size */
+int fft_lines(complex_t* x, complex_t* y, int cnt, int stride, int dist,
+              int ystride, int ydist, fft_t* pfft);
+
+/* Parallel loop range function: iterations k0 ... k1-1 
+   by the pool thread id (0 is the caller thread) */
+typedef void (*fft_range_t)(void* arg, int id, int k0, int k1);
+
+/* Parallel loop of cnt iterations distributed between the pool threads
+   (single thread loop if pool is NULL) */
+void fft_pool_for(fft_pool_t* pool, int cnt, fft_range_t fn, void* arg);
+
+/* cnt n-points DCT or DST (type DSPL_DCT2, DSPL_DCT3, DSPL_DCT4 or 
+   DSPL_DST2) of the contiguous vectors x to y */
+int dct_krn(double* x, int n, int cnt, int type, fft_t* pfft, double* y);
+
+/* Pruned FFT (IFFT if inv): ny samples X((k0 + i) mod n), i = 0 ... ny-1 
+   of the n-points FFT of nx samples x zero-padded to n. 
+   The FFT is calculated by q FFTs of m = n/q points: decimation in frequency
+   if nx <= m (input pruning) or decimation in time (output pruning) */
+int fft_pruned_krn(complex_t* x, int nx, int n, int k0, int ny, 
+                   fft_t* pfft, int inv, complex_t* y);
+
+/* NUFFT kernel "exponential of semicircle" 
+   phi(z) = exp(beta * (sqrt(1 - z^2) - 1)), |z| < 1, of w grid points 
+   on the grid oversampled by 2, beta = NUFFT_BETA * w. 
+   The accuracy is about 10^(1-w), w <= NUFFT_WIDTH_MAX */
+#define NUFFT_BETA          2.30
+#define NUFFT_WIDTH_MAX     16
+
+/* NUFFT accuracy of the Fourier series functions */
+#define NUFFT_EPS           1E-12
+
+/* Cost of the one complex exponent of the direct sum in the units of
+   the one kernel value of the NUFFT gridding */
+#define NUFFT_DIRECT_COST   2.0
+
+/* Relative tolerance per point of the frequency vector uniform grid check,
+   the grid calculated by the accumulation w(k) = w(k-1) + dw has 
+   the rounding error proportional to the number of points */
+#define NUFFT_UNIFORM_TOL   (2.0 * DBL_EPSILON)
+
+/* Type 1 NUFFT (type = 1): 
+     y(k) = sum_m s(m) exp(-j (k - nk/2) x(m)),  k = 0 ... nk-1,
+   or type 2 NUFFT (type = 2):
+     y(m) = sum_k s(k) exp(+j (k - nk/2) x(m)),  m = 0 ... nx-1,
+   with the relative accuracy eps */
+int nufft_krn(double* x, complex_t* s, int nx, int nk, double eps, int type,
+              fft_t* pfft, complex_t* y);
+
+/* Nonzero if the NUFFT is faster than the direct sum of nx * nk exponents */
+int nufft_fast(int nx, int nk, double eps);
+
+/* Nonzero if w(k) = w0 + k * dw, k = 0 ... n-1, with rounding errors */
+int nufft_uniform(double* w, int n, double* w0, double* dw);
+
+/* Trapezoidal Fourier integral of the signal s(t) of nt samples 
+   at the frequencies w(k) = w0 + k * dw, k = 0 ... nw-1, by the type 1 NUFFT:
+     y(k) = int s(t) exp(-j w(k) t) dt */
+int nufft_fourier_integral(double* t, complex_t* s, int nt, 
+                           double w0, double dw, int nw, complex_t* y);
+
+/* Fourier series of the frequencies w(k) = w0 + k * dw, k = 0 ... nw-1,
+   by the type 2 NUFFT:
+     y(m) = sum_k s(k) exp(j w(k) t(m)),  m = 0 ... nt-1 */
+int nufft_fourier_series(double w0, double dw, complex_t* s, int nw,
+                         double* t, int nt, complex_t* y);
+
+/* Goertzel algorithm samples block size: the block stays in L1 cache 
+   while all the bins resonators are updated */
+#define GOERTZEL_BLOCK  512
+
+/* Goertzel resonators vectors are padded to the multiple of GOERTZEL_PAD 
+   by the zero coefficients resonators, so the kernels tiles 
+   never need the scalar tail */
+#define GOERTZEL_PAD    16
+#define GOERTZEL_KP(k)  (((k) + GOERTZEL_PAD - 1) / GOERTZEL_PAD * GOERTZEL_PAD)
+
+/* Goertzel resonators s1, s2 of k bins (a = 2cos(theta)) update 
+   by cnt samples x[m*step], the vectors are padded to GOERTZEL_KP(k) */
+void goertzel_krn(double* x, int cnt, int step, double* a, 
+                  double* s1, double* s2, int k);
+
+/* Returns 1 if k bins of the n-points DFT are calculated faster by the FFT
+   than by the multi-bin Goertzel algorithm */
+int goertzel_use_fft(int n, int k);
+
+/* cnt STFT frames w(m) * x(s + f*hop + m), f = 0 ... cnt-1, the samples 
+   of the negative indexes are taken from the stream tail xb of nb samples.
+   nfft/2+1 bins of each frame are stored to yc, or the bins magnitudes 
+   are stored to ym (dB if flag has DSPL_FLAG_LOGMAG) */
+int stft_krn(double* x, double* xb, int nb, int s, int cnt, stft_t* p,
+             int flag, complex_t* yc, double* ym);
+
+/* Streaming STFT: frames of the stream tail and n new samples x, 
+   the number of the frames is returned by pcnt */
+int stft_stream(stft_t* p, double* x, int n, int flag, 
+                complex_t* yc, double* ym, int* pcnt);
+
+/* Real FFT spectrum separation from the n2-points complex FFT */
+void fft_r2c_split(complex_t* y, int n2, complex_t* wr);
+
+/* Real IFFT merge of the n2+1 Hermitian spectrum samples x into
+   the conjugate n2-points spectrum z scaled by norm */
+void fft_c2r_merge(complex_t* x, int n2, complex_t* wr, double norm,
+                   complex_t* z);
+
+/* FFT codelet for the n1-points stage (NULL if n1 is not supported) */
+fft_codelet_t fft_codelet(int n1);
+
+/* First generated radix of the planner priority list FFT_BFGEN_PLAN 
+   (see fft_bfgen.py) which divides s, or 1 */
+int fft_codelet_radix(int s);
+
+/* Naive DFT codelet for the prime factor n1 <= FFT_BLUESTEIN_MIN */
+void fft_codelet_dft(complex_t* x, complex_t* y, int cnt, 
+                     fft_plan_t* p, fft_stage_t* s, complex_t* tb);
+
+/* Bluestein codelet for the prime factor n1 > FFT_BLUESTEIN_MIN */
+void fft_codelet_bluestein(complex_t* x, complex_t* y, int cnt, 
+                           fft_plan_t* p, fft_stage_t* s, complex_t* tb);
+
+/* Bluestein FFT of the one n1-points block of the stage s.
+   nb-points FFTs are executed by the pool threads if pool is not NULL */
+void fft_bluestein(complex_t* t0, complex_t* t1, fft_plan_t* p, 
+                   fft_stage_t* s, complex_t* tb, fft_pool_t* pool);
+
+/* FFT instruction set selected by fft_set_isa */
+extern int fft_simd_isa;
+
+/* Nonzero if the instruction set isa is supported by the CPU */
+int fft_simd_support(int isa);
+
+/* The best instruction set supported by the CPU */
+int fft_simd_best(void);
+
+/* Nonzero if the vector codelet of the n1-points stage exists */
+int fft_simd_radix(int n1);
+
+/* Vector kernel: DFTs of the vectors v ... nv-1 (see fft_simd_krn.h) */
+typedef int (*fft_vkrn_t)(complex_t* x, complex_t* y, complex_t* w, 
+                          int v, int nv, int s);
+
+/* Kernels of the isa and narrower instruction sets for the tail vectors */
+int fft_simd_chain(int isa, int r, int row, fft_vkrn_t* krn);
+
+/* Vector codelet of the not last stage.
+   Each of cnt blocks x[i + j*n2] is transformed to 
+   y[i + k*n2] = DFT_i(k) * w[i + k*n2] without input transpose */
+void fft_codelet_vcol(complex_t* x, complex_t* y, int cnt, 
+                      fft_plan_t* p, fft_stage_t* s, complex_t* tb);
+
+/* Vector codelet of the last stage: cnt DFTs of n1-points blocks */
+void fft_codelet_vrow(complex_t* x, complex_t* y, int cnt, 
+                      fft_plan_t* p, fft_stage_t* s, complex_t* tb);
+
+
+
+/* Single precision FFT codelet: cnt DFTs of the stage blocks from x to y */
+typedef void (*fftf_codelet_t)(complexf_t* x, complexf_t* y, int cnt, 
+                               fftf_t* p, fftf_stage_t* s);
+
+/* Single precision FFT schedule stage (see fft_stage_s).
+   Not last stages are executed by the vector column codelets,
+   the last stage (n2 = 1) by the vector row, DFT or Bluestein codelet */
+struct fftf_stage_s
+{
+    fftf_codelet_t  fn;     /* stage codelet                            */
+    int             n;      /* stage block size                         */
+    int             n1;     /* codelet size                             */
+    int             n2;     /* next stage block size                    */
+    int             addr;   /* twiddle factors offset in the plan w     */
+};
+
+/* Single precision FFT kernel (input t0 is destroyed) */
+int fftf_krn(complexf_t* t0, complexf_t* t1, fftf_t* p);
+
+/* Single precision FFT schedule execution for cnt blocks of the stage s */
+void fftf_run(complexf_t* t0, complexf_t* t1, fftf_t* p, 
+              fftf_stage_t* s, int cnt);
+
+/* Single precision real FFT spectrum separation (see fft_r2c_split) */
+void fftf_r2c_split(complexf_t* y, int n2, complexf_t* wr);
+
+/* b[i*m + j] = a[j*n + i] (see matrix_transpose_cmplx) */
+void fftf_transpose(complexf_t* a, int n, int m, complexf_t* b);
+
+/* Single precision vector kernel (see fft_vkrn_t) */
+typedef int (*fftf_vkrn_t)(complexf_t* x, complexf_t* y, complexf_t* w, 
+                           int v, int nv, int s);
+
+/* Single precision kernels of the isa and narrower instruction sets.
+   The last kernel of the chain is scalar */
+int fftf_simd_chain(int isa, int r, int row, fftf_vkrn_t* krn);
+
+/* Single precision vector codelets (see fft_codelet_vcol, fft_codelet_vrow) */
+void fftf_codelet_vcol(complexf_t* x, complexf_t* y, int cnt, 
+                       fftf_t* p, fftf_stage_t* s);
+void fftf_codelet_vrow(complexf_t* x, complexf_t* y, int cnt, 
+                       fftf_t* p, fftf_stage_t* s);
+
+/* Single precision naive DFT codelet for the factor n1 <= FFT_BLUESTEIN_MIN */
+void fftf_codelet_dft(complexf_t* x, complexf_t* y, int cnt, 
+                      fftf_t* p, fftf_stage_t* s);
+
+/* Single precision Bluestein codelet for the factor n1 > FFT_BLUESTEIN_MIN */
+void fftf_codelet_bluestein(complexf_t* x, complexf_t* y, int cnt, 
+                            fftf_t* p, fftf_stage_t* s);
 
 /* DFT 2 points */
 void dft2 (complex_t *x,  complex_t* y);
@@ -26,6 +399,10 @@ void dft4 (complex_t *x,  complex_t* y);
 #define DFT5_W3        1.538841768587630
 #define DFT5_W4        0.587785252292473
 #define DFT5_W5        0.363271264002680
+#define DFT5_C1        0.309016994374947
+#define DFT5_C2       -0.809016994374947
+#define DFT5_S1        0.951056516295154
+#define DFT5_S2        0.587785252292473
 void dft5 (complex_t *x,  complex_t* y);
 
 
@@ -38,6 +415,12 @@ void dft5 (complex_t *x,  complex_t* y);
 #define DFT7_W6      -0.340872930623931369442658
 #define DFT7_W7       0.533969360337725240661655
 #define DFT7_W8      -0.874842290961656665615465
+#define DFT7_C1       0.623489801858734530525004
+#define DFT7_C2      -0.222520933956314404288902
+#define DFT7_C3      -0.900968867902419126236102
+#define DFT7_S1       0.781831482468029808708444
+#define DFT7_S2       0.974927912181823607018131
+#define DFT7_S3       0.433883739117558120475768
 void dft7 (complex_t *x,  complex_t* y);
 
 
@@ -84,5 +467,13 @@ void dft2048(complex_t *x, complex_t* y, complex_t* w,
 /* DFT 4096 points */
 void dft4096(complex_t *x, complex_t* y, complex_t* w,  complex_t* w256);
 
+/* CZT object of the contour W = |w| exp(j 2 pi fw), A = |a| exp(j 2 pi fa),
+   fw and fa are the double-double angles in cycles fw[0] + fw[1] */
+int czt_create_krn(czt_t* pczt, int n, int m, complex_t w, double* fw,
+                   complex_t a, double* fa);
+
+/* Double-double ratio f[0] + f[1] = (x + xl) / (y + yl) */
+void czt_div(double x, double xl, double y, double yl, double* f);
+
 
 #endif
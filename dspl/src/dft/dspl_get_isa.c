@@ -0,0 +1,70 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup SYS_LOADING_GROUP
+\brief Instruction set of the library vector kernels.
+
+Function returns the instruction set which is used by the 
+new FFT plans and by the filtering functions (see \ref dspl_set_isa). \n
+If `DSPL_ISA_AUTO` is selected then the function returns 
+the best instruction set supported by the CPU. \n
+The \ref fft_get_isa function is the alias of this function.
+
+\return
+`DSPL_ISA_SCALAR`, `DSPL_ISA_SSE2`, `DSPL_ISA_AVX2` or `DSPL_ISA_AVX512`.
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup SYS_LOADING_GROUP
+\brief Набор инструкций векторных ядер библиотеки
+
+Функция возвращает набор инструкций, который используется 
+новыми планами БПФ и функциями фильтрации (см. \ref dspl_set_isa). \n
+Если выбран `DSPL_ISA_AUTO`, то функция возвращает
+лучший набор инструкций, поддерживаемый процессором. \n
+Функция \ref fft_get_isa является синонимом данной функции.
+
+\return
+`DSPL_ISA_SCALAR`, `DSPL_ISA_SSE2`, `DSPL_ISA_AVX2` или `DSPL_ISA_AVX512`.
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API dspl_get_isa(void)
+{
+    if(fft_simd_isa == DSPL_ISA_AUTO)
+        return fft_simd_best();
+    return fft_simd_isa;
+}
@@ -0,0 +1,150 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup SYS_LOADING_GROUP
+\brief Select the instruction set of the library vector kernels.
+
+The FFT codelets and the filtering kernels are compiled for several 
+instruction sets and the instruction set is selected at run time 
+by this function. \n
+The selected instruction set is used by the FFT plans
+created after the function call 
+(\ref fft_plan_create and \ref fft_create functions). 
+The plans created before keep their instruction set until they are 
+recreated: the own and the cached plans of the \ref fft_t objects 
+and the \ref fftf_t objects are rebuilt for the new instruction set 
+by the next FFT call, the shared plan bound by the \ref fft_bind function 
+is rebuilt by the next \ref fft_plan_create call. \n
+The filtering functions \ref filter_sos, \ref sos_filter,
+\ref filter_iir_multi and \ref filter_fir_multi read the 
+instruction set at each call. \n
+The \ref fft_set_isa function and the `FFT_ISA_*` names 
+are the aliases of this function and of the `DSPL_ISA_*` names.
+
+\param[in]  isa
+Instruction set: \n
+\verbatim
+DSPL_ISA_AUTO    - the best instruction set supported by the CPU
+                   (default)
+DSPL_ISA_SCALAR  - scalar kernels
+DSPL_ISA_SSE2    - SSE2 vector kernels (FFT only, 
+                   the filters use the scalar kernels)
+DSPL_ISA_AVX2    - AVX2 and FMA vector kernels
+DSPL_ISA_AVX512  - AVX-512 vector kernels
+\endverbatim
+Vector kernels are available for the x86 CPU only. \n \n
+
+\return
+`RES_OK` if the instruction set is selected successfully. \n
+`ERROR_FFT_ISA` if the instruction set is not supported by the CPU. 
+The instruction set is not changed in this case.
+
+Example:
+\code{.cpp}
+fft_t pfft = {0};
+int err;
+
+err = dspl_set_isa(DSPL_ISA_AVX2);
+if(err != RES_OK)
+    dspl_set_isa(DSPL_ISA_AUTO);
+
+// FFT plan and the filters use the AVX2 kernels if AVX2 is supported
+err = fft_create(&pfft, 4096);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup SYS_LOADING_GROUP
+\brief Выбор набора инструкций векторных ядер библиотеки
+
+Ядра БПФ и ядра фильтрации скомпилированы для нескольких наборов 
+инструкций, и набор инструкций выбирается во время выполнения 
+данной функцией. \n
+Выбранный набор инструкций используется планами БПФ,
+созданными после вызова функции 
+(функции \ref fft_plan_create и \ref fft_create). 
+Планы, созданные ранее, сохраняют свой набор инструкций до 
+пересоздания: собственные и кэшированные планы объектов \ref fft_t 
+и объекты \ref fftf_t пересоздаются для нового набора инструкций 
+при следующем вызове БПФ, а совместно используемый план, подключенный 
+функцией \ref fft_bind, пересоздается следующим вызовом 
+\ref fft_plan_create. \n
+Функции фильтрации \ref filter_sos, \ref sos_filter,
+\ref filter_iir_multi и \ref filter_fir_multi читают 
+набор инструкций при каждом вызове. \n
+Функция \ref fft_set_isa и имена `FFT_ISA_*` являются 
+синонимами данной функции и имен `DSPL_ISA_*`.
+
+\param[in]  isa
+Набор инструкций: \n
+\verbatim
+DSPL_ISA_AUTO    - лучший набор инструкций, поддерживаемый процессором
+                   (по умолчанию)
+DSPL_ISA_SCALAR  - скалярные ядра
+DSPL_ISA_SSE2    - векторные ядра SSE2 (только БПФ, 
+                   фильтры используют скалярные ядра)
+DSPL_ISA_AVX2    - векторные ядра AVX2 и FMA
+DSPL_ISA_AVX512  - векторные ядра AVX-512
+\endverbatim
+Векторные ядра доступны только для процессоров x86. \n \n
+
+\return
+`RES_OK` если набор инструкций выбран успешно. \n
+`ERROR_FFT_ISA` если набор инструкций не поддерживается процессором. 
+Набор инструкций при этом не изменяется.
+
+Пример:
+\code{.cpp}
+fft_t pfft = {0};
+int err;
+
+err = dspl_set_isa(DSPL_ISA_AVX2);
+if(err != RES_OK)
+    dspl_set_isa(DSPL_ISA_AUTO);
+
+// план БПФ и фильтры используют ядра AVX2, если AVX2 поддерживается
+err = fft_create(&pfft, 4096);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API dspl_set_isa(int isa)
+{
+    if(isa != DSPL_ISA_AUTO && !fft_simd_support(isa))
+        return ERROR_FFT_ISA;
+    fft_simd_isa = isa;
+    return RES_OK;
+}
@@ -40,6 +40,11 @@ Function calculated \f$ n \f$-points FFT for the real vector
 \f]
 here \f$ k = 0 \ldots n-1 \f$.
 
+For even `n` the spectrum is calculated by the \ref fft_r2c function
+via the \f$ n/2 \f$-points complex FFT,
+and the second half of the spectrum is filled as
+\f$ Y(n-k) = Y^*(k) \f$.
+
 
 \param[in]  x
 Pointer to the input real vector \f$x(m)\f$, 
@@ -51,7 +56,7 @@ FFT size \f$n\f$. \n
 FFT size can be composite: 
 \f$n = n_0 \times n_1 \times n_2 \times \ldots \times n_p \times m\f$,
 here \f$n_i = 2,3,5,7\f$, а \f$m \f$ -- 
-simple number less than 46340
+arbitrary factor
 (see \ref fft_create function). \n \n
 
 \param[in]  pfft
@@ -111,6 +116,9 @@ y[13] =    -7.000  -30.669
 где \f$ k = 0 \ldots n-1 \f$.
 
 Для расчета используется алгоритм БПФ составной длины.
+При четном `n` спектр рассчитывается функцией \ref fft_r2c 
+посредством \f$ n/2 \f$-точечного комплексного БПФ,
+а вторая половина спектра заполняется как \f$ Y(n-k) = Y^*(k) \f$.
 
 \param[in]  x
 Указатель на вектор вещественного входного сигнала \f$x(m)\f$, 
@@ -122,7 +130,7 @@ y[13] =    -7.000  -30.669
 Размер БПФ может быть составным вида 
 \f$n = n_0 \times n_1 \times n_2 \times \ldots \times n_p \times m\f$,
 где \f$n_i = 2,3,5,7\f$, а \f$m \f$ -- 
-произвольный простой множитель не превосходящий 46340
+произвольный множитель
 (см. описание функции \ref fft_create). \n \n
 
 \param[in]  pfft
@@ -170,19 +178,33 @@ y[13] =    -7.000  -30.669
 #endif
 int DSPL_API fft(double* x, int n, fft_t* pfft, complex_t* y)
 {
-    int err;
+    int err, k;
 
     if(!x || !pfft || !y)
         return ERROR_PTR;
     if(n<1)
         return ERROR_SIZE;
 
+    if(n%2)
+    {
+        err = fft_create(pfft, n);
+        if(err != RES_OK)
+            return err;
+
+        re2cmplx(x, n, pfft->t1);
 
-    err = fft_create(pfft, n);
+        return fft_krn(pfft->t1, y, pfft);
+    }
+
+    /* even size: n/2-points complex FFT and spectrum symmetry */
+    err = fft_r2c(x, n, pfft, y);
     if(err != RES_OK)
         return err;
 
-    re2cmplx(x, n, pfft->t1);
-
-    return fft_krn(pfft->t1, y, pfft, n, 0);
-}
\ No newline at end of file
+    for(k = n/2+1; k < n; k++)
+    {
+        RE(y[k]) =  RE(y[n-k]);
+        IM(y[k]) = -IM(y[n-k]);
+    }
+    return RES_OK;
+}
@@ -0,0 +1,168 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Two-dimensional fast Fourier transform of the real matrix.
+
+Function calculates 2D FFT of the real matrix \f$ x(p,q) \f$
+of size `[n x m]`: \n
+\f[
+  Y(k,l) = \sum_{p = 0}^{n-1} \sum_{q = 0}^{m-1} x(p,q)
+  \exp \left( -j \frac{2\pi}{n} p k \right)
+  \exp \left( -j \frac{2\pi}{m} q l \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$, \f$ l = 0 \ldots m-1 \f$. \n
+Matrix is stored in the memory as column-major array. \n
+
+The columns are transformed by the real batch FFT (see \ref fft_batch).
+The spectrum of the real matrix is conjugate symmetric:
+\f$ Y(n-k, m-l) = Y^*(k,l) \f$, so the row FFTs are calculated
+for the rows \f$ k = 0 \ldots \lfloor n/2 \rfloor \f$ only and
+the other rows are filled by symmetry. \n
+Row FFTs are calculated by the groups of the adjacent rows without
+the matrix transpose as the \ref fft2_cmplx function does.
+
+\param[in]  x
+Pointer to the input real matrix \f$ x(p,q) \f$. \n
+Matrix size is `[n x m]`. \n \n
+
+\param[in]  n
+Number of the matrix rows (FFT size of the columns). \n \n
+
+\param[in]  m
+Number of the matrix columns (FFT size of the rows). \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the 2D FFT result complex matrix \f$ Y(k,l) \f$. \n
+Matrix size is `[n x m]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Двумерное быстрое преобразование Фурье вещественной матрицы
+
+Функция рассчитывает двумерное БПФ вещественной матрицы \f$ x(p,q) \f$
+размера `[n x m]`: \n
+\f[
+  Y(k,l) = \sum_{p = 0}^{n-1} \sum_{q = 0}^{m-1} x(p,q)
+  \exp \left( -j \frac{2\pi}{n} p k \right)
+  \exp \left( -j \frac{2\pi}{m} q l \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$, \f$ l = 0 \ldots m-1 \f$. \n
+Матрица должна быть расположена в памяти по столбцам. \n
+
+Столбцы преобразуются пакетным БПФ вещественных сигналов
+(см. \ref fft_batch).
+Спектр вещественной матрицы обладает комплексно-сопряженной симметрией:
+\f$ Y(n-k, m-l) = Y^*(k,l) \f$, поэтому БПФ строк рассчитываются
+только для строк \f$ k = 0 \ldots \lfloor n/2 \rfloor \f$,
+а остальные строки заполняются по симметрии. \n
+БПФ строк рассчитываются группами соседних строк без транспонирования
+матрицы аналогично функции \ref fft2_cmplx.
+
+\param[in]  x
+Указатель на входную вещественную матрицу \f$ x(p,q) \f$. \n
+Размер матрицы `[n x m]`. \n \n
+
+\param[in]  n
+Количество строк матрицы (размер БПФ столбцов). \n \n
+
+\param[in]  m
+Количество столбцов матрицы (размер БПФ строк). \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на комплексную матрицу результата двумерного БПФ 
+\f$ Y(k,l) \f$. \n
+Размер матрицы `[n x m]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft2(double* x, int n, int m, fft_t* pfft, complex_t* y)
+{
+    int err, k, l, lc;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || m < 1)
+        return ERROR_SIZE;
+
+    /* columns */
+    err = fft_batch(x, n, m, 1, n, pfft, y);
+    if(err != RES_OK)
+        return err;
+
+    /* rows 0 ... n/2 */
+    err = fft_create(pfft, m);
+    if(err != RES_OK)
+        return err;
+    err = fft_lines(y, y, n/2+1, n, 1, n, 1, pfft);
+    if(err != RES_OK)
+        return err;
+
+    /* rows n/2+1 ... n-1: Y(k,l) = Y*(n-k, m-l) */
+    for(l = 0; l < m; l++)
+    {
+        lc = l ? m - l : 0;
+        for(k = n/2+1; k < n; k++)
+        {
+            RE(y[l*n + k]) =  RE(y[lc*n + n - k]);
+            IM(y[l*n + k]) = -IM(y[lc*n + n - k]);
+        }
+    }
+    return RES_OK;
+}
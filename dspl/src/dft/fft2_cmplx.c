@@ -0,0 +1,175 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Two-dimensional fast Fourier transform of the complex matrix.
+
+Function calculates 2D FFT of the complex matrix \f$ x(p,q) \f$
+of size `[n x m]`: \n
+\f[
+  Y(k,l) = \sum_{p = 0}^{n-1} \sum_{q = 0}^{m-1} x(p,q)
+  \exp \left( -j \frac{2\pi}{n} p k \right)
+  \exp \left( -j \frac{2\pi}{m} q l \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$, \f$ l = 0 \ldots m-1 \f$. \n
+Matrix is stored in the memory as column-major array: 
+\f$ x(p,q) = \textrm{x[q} \cdot \textrm{n + p]} \f$. \n
+
+The \f$ n \f$-points FFTs of the columns are calculated first and then 
+the \f$ m \f$-points FFTs of the rows. 
+Strided rows are processed by the groups of the adjacent rows: 
+the group is gathered to the `fft_t` workspace column by column, 
+transformed by the FFT codelets and scattered back. Thus the matrix is not 
+transposed and the data of each pass stays in cache. \n
+FFTs of the groups are distributed between the threads of the 
+`fft_t` object if the threads are set by the \ref fft_set_threads function
+and the matrix size \f$ n \cdot m \geq 262144 \f$.
+
+\param[in]  x
+Pointer to the input complex matrix \f$ x(p,q) \f$. \n
+Matrix size is `[n x m]`. \n \n
+
+\param[in]  n
+Number of the matrix rows (FFT size of the columns). \n \n
+
+\param[in]  m
+Number of the matrix columns (FFT size of the rows). \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+The function creates the `fft_t` object plans of the `n` and `m` sizes
+in turn (the plans are taken from the plan cache). \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the 2D FFT result matrix \f$ Y(k,l) \f$. \n
+Matrix size is `[n x m]`. \n
+Memory must be allocated. \n
+The output matrix can be the same as the input matrix `x`. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include fft2_cmplx_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Двумерное быстрое преобразование Фурье комплексной матрицы
+
+Функция рассчитывает двумерное БПФ комплексной матрицы \f$ x(p,q) \f$
+размера `[n x m]`: \n
+\f[
+  Y(k,l) = \sum_{p = 0}^{n-1} \sum_{q = 0}^{m-1} x(p,q)
+  \exp \left( -j \frac{2\pi}{n} p k \right)
+  \exp \left( -j \frac{2\pi}{m} q l \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$, \f$ l = 0 \ldots m-1 \f$. \n
+Матрица должна быть расположена в памяти по столбцам:
+\f$ x(p,q) = \textrm{x[q} \cdot \textrm{n + p]} \f$. \n
+
+Сначала рассчитываются \f$ n \f$-точечные БПФ столбцов, затем 
+\f$ m \f$-точечные БПФ строк. 
+Строки матрицы обрабатываются группами соседних строк:
+группа собирается в рабочую память `fft_t` по столбцам, 
+преобразуется ядрами БПФ и записывается обратно. Таким образом матрица
+не транспонируется, а данные каждого прохода остаются в кэше. \n
+БПФ групп распределяются между потоками объекта `fft_t`, если
+потоки заданы функцией \ref fft_set_threads и размер матрицы
+\f$ n \cdot m \geq 262144 \f$.
+
+\param[in]  x
+Указатель на входную комплексную матрицу \f$ x(p,q) \f$. \n
+Размер матрицы `[n x m]`. \n \n
+
+\param[in]  n
+Количество строк матрицы (размер БПФ столбцов). \n \n
+
+\param[in]  m
+Количество столбцов матрицы (размер БПФ строк). \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Функция поочередно создает планы объекта `fft_t` размеров `n` и `m`
+(планы берутся из кэша планов). \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на матрицу результата двумерного БПФ \f$ Y(k,l) \f$. \n
+Размер матрицы `[n x m]`. \n
+Память должна быть выделена. \n
+Выходная матрица может совпадать с входной матрицей `x`. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции:
+
+\include fft2_cmplx_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft2_cmplx(complex_t* x, int n, int m, fft_t* pfft, complex_t* y)
+{
+    int err;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || m < 1)
+        return ERROR_SIZE;
+
+    /* columns */
+    err = fft_create(pfft, n);
+    if(err != RES_OK)
+        return err;
+    err = fft_lines(x, y, m, 1, n, 1, n, pfft);
+    if(err != RES_OK)
+        return err;
+
+    /* rows */
+    err = fft_create(pfft, m);
+    if(err != RES_OK)
+        return err;
+    return fft_lines(y, y, n, n, 1, n, 1, pfft);
+}
@@ -0,0 +1,276 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+/* Real batch FFT data of the groups distributed between the threads */
+typedef struct
+{
+    double*     x;
+    complex_t*  y;
+    complex_t*  t0;     /* g*nf points workspace of each thread         */
+    complex_t*  tb;     /* Bluestein workspace of each thread           */
+    fft_plan_t* plan;   /* nf-points plan                               */
+    int         n;
+    int         nf;
+    int         cnt;
+    int         stride;
+    int         dist;
+    int         g;      /* group size                                   */
+} fft_batch_t;
+
+
+
+
+/* Groups q0 ... q1-1 of the real batch FFT by the thread id */
+static void fft_batch_groups(void* arg, int id, int q0, int q1)
+{
+    fft_batch_t* a = (fft_batch_t*)arg;
+    int n = a->n, nf = a->nf;
+    int q, b, g, m, k;
+    double *px;
+    complex_t *t0, *tb, *pt, *py;
+
+    t0 = a->t0 + id * a->g * nf;
+    tb = a->tb ? a->tb + 2 * id * a->plan->nb : NULL;
+    for(q = q0; q < q1; q++)
+    {
+        b = q * a->g;
+        g = a->cnt - b < a->g ? a->cnt - b : a->g;
+
+        /* gather the group input vectors */
+        pt = t0;
+        for(m = 0; m < g; m++)
+        {
+            px = a->x + (b+m)*a->dist;
+            if(n % 2)
+            {
+                for(k = 0; k < nf; k++)
+                {
+                    RE(pt[k]) = px[k*a->stride];
+                    IM(pt[k]) = 0.0;
+                }
+            }
+            else
+            {
+                for(k = 0; k < nf; k++)
+                {
+                    RE(pt[k]) = px[(2*k)  *a->stride];
+                    IM(pt[k]) = px[(2*k+1)*a->stride];
+                }
+            }
+            pt += nf;
+        }
+        fft_run(t0, a->y + b*n, a->plan, a->plan->st, tb, g);
+        if(n % 2)
+            continue;
+
+        /* spectrum separation and symmetry, 
+           the last vector of the group is moved first */
+        for(m = g-1; m >= 0; m--)
+        {
+            py = a->y + (b+m)*n;
+            if(m)
+                memmove(py, a->y + b*n + m*nf, nf*sizeof(complex_t));
+            fft_r2c_split(py, nf, a->plan->wr);
+            for(k = nf+1; k < n; k++)
+            {
+                RE(py[k]) =  RE(py[n-k]);
+                IM(py[k]) = -IM(py[n-k]);
+            }
+        }
+    }
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Batch fast Fourier transform of the real vectors.
+
+Function calculates `cnt` \f$ n \f$-points FFTs of the real vectors
+\f$ x_b(m) \f$, \f$ m = 0 \ldots n-1 \f$, \f$ b = 0 \ldots cnt-1 \f$: \n
+\f[
+  Y_b(k) = \sum_{m = 0}^{n-1} x_b(m) 
+  \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$.
+
+Input samples are addressed as 
+\f$ x_b(m) = \textrm{x[b} \cdot \textrm{dist} + m \cdot \textrm{stride]} \f$. \n
+For even `n` each real vector is calculated by the 
+\f$ n/2 \f$-points complex FFT as the \ref fft function does. \n
+The vectors are calculated by groups as the \ref fft_cmplx_batch 
+function does, and the groups are distributed between 
+the worker threads set by the \ref fft_set_threads function.
+
+\param[in]  x
+Pointer to the input real vectors. \n \n
+
+\param[in]  n
+FFT size \f$n\f$ (see \ref fft_create function). \n \n
+
+\param[in]  cnt
+Number of the FFTs. \n \n
+
+\param[in]  stride
+Distance between the samples of one input vector. \n 
+`stride` must be positive. \n \n
+
+\param[in]  dist
+Distance between the first samples of the adjacent input vectors. \n 
+`dist` must be positive. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Note that for even `n` the function fills the
+structure \ref fft_t for the `n/2`-points FFT. \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the FFT results.  \n
+FFT result \f$ Y_b(k) \f$ is stored as `y[b*n + k]`. \n
+Vector size is `[n*cnt x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Пакетное быстрое преобразование Фурье вещественных сигналов
+
+Функция рассчитывает `cnt` \f$ n \f$-точечных БПФ вещественных сигналов
+\f$ x_b(m) \f$, \f$ m = 0 \ldots n-1 \f$, \f$ b = 0 \ldots cnt-1 \f$: \n
+\f[
+  Y_b(k) = \sum_{m = 0}^{n-1} x_b(m) 
+  \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$.
+
+Отсчеты входных сигналов адресуются как
+\f$ x_b(m) = \textrm{x[b} \cdot \textrm{dist} + m \cdot \textrm{stride]} \f$. \n
+При четном `n` каждый вещественный сигнал обрабатывается 
+\f$ n/2 \f$-точечным комплексным БПФ аналогично функции \ref fft. \n
+Сигналы обрабатываются группами аналогично функции 
+\ref fft_cmplx_batch, при этом группы распределяются между
+рабочими потоками, заданными функцией \ref fft_set_threads.
+
+\param[in]  x
+Указатель на входные вещественные сигналы. \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$ (см. описание функции \ref fft_create). \n \n
+
+\param[in]  cnt
+Количество БПФ. \n \n
+
+\param[in]  stride
+Шаг между отсчетами одного входного сигнала. \n 
+Значение `stride` должно быть положительным. \n \n
+
+\param[in]  dist
+Шаг между первыми отсчетами соседних входных сигналов. \n 
+Значение `dist` должно быть положительным. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Необходимо учитывать, что при четном `n` функция заполняет
+структуру \ref fft_t для `n/2`-точечного БПФ. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на результаты БПФ. \n
+Результат БПФ \f$ Y_b(k) \f$ сохраняется как `y[b*n + k]`. \n
+Размер вектора `[n*cnt x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_batch(double* x, int n, int cnt, int stride, 
+                       int dist, fft_t* pfft, complex_t* y)
+{
+    int err, nf, ng, nth;
+    fft_batch_t a;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || cnt < 1)
+        return ERROR_SIZE;
+    if(stride < 1 || dist < 1)
+        return ERROR_ARG_PARAM;
+
+    /* even size: n/2-points complex FFT of z(m) = x(2m) + j x(2m+1) */
+    nf = n % 2 ? n : n / 2;
+    if(n % 2)
+        err = fft_create(pfft, nf);
+    else
+        err = fft_create_half(pfft, nf, NULL);
+    if(err != RES_OK)
+        return err;
+
+    /* group size and the number of groups */
+    a.g = nf < FFT_BATCH_SIZE ? FFT_BATCH_SIZE / nf : 1;
+    if(a.g > cnt)
+        a.g = cnt;
+    ng = (cnt + a.g - 1) / a.g;
+
+    /* the groups are distributed between the worker threads */
+    nth = 1;
+    if(pfft->pool && (double)n * cnt >= FFT_THREADS_MIN && ng > 1)
+        nth = pfft->nthreads < ng ? pfft->nthreads : ng;
+    err = fft_workspace(pfft, nth * a.g * nf);
+    if(err != RES_OK)
+        return err;
+
+    a.x      = x;
+    a.y      = y;
+    a.t0     = pfft->t0;
+    a.tb     = pfft->tb;
+    a.plan   = n % 2 ? pfft->plan : pfft->half;
+    a.n      = n;
+    a.nf     = nf;
+    a.cnt    = cnt;
+    a.stride = stride;
+    a.dist   = dist;
+
+    fft_pool_for(nth > 1 ? pfft->pool : NULL, ng, fft_batch_groups, &a);
+    return RES_OK;
+}
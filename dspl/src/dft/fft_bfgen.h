@@ -0,0 +1,7079 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*******************************************************************************
+Generated FFT butterflies. DO NOT EDIT, the file is generated by
+    python3 fft_bfgen.py -o fft_bfgen.h 13 11 10 12 9 25 49 15 6 256
+
+FFT_BFGEN_LIST(X) calls X(R) for each generated radix R.
+FFT_BFGEN_PLAN(X) calls X(R) for the radixes tried by the FFT planner
+heuristic in the priority order.
+If FFT_SFX is defined (see fft_simd_krn.h) then the file also
+defines the butterflies FFT_SFX(fft_bfR)(FFT_V* a).
+*******************************************************************************/
+
+#ifndef FFT_BFGEN_LIST
+#define FFT_BFGEN_LIST(X)  X(6) X(9) X(10) X(11) X(12) X(13) X(15) X(25) X(49) X(256)
+#endif
+
+#ifndef FFT_BFGEN_PLAN
+#define FFT_BFGEN_PLAN(X)  X(13) X(11) X(10) X(12) X(9) X(25) X(49) X(15) X(6)
+#endif
+
+
+
+#ifdef FFT_SFX
+
+
+/* 6 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf6)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23;
+
+    t0 = FFT_VADD(a[0], a[3]);
+    t1 = FFT_VSUB(a[0], a[3]);
+    t2 = FFT_VADD(a[2], a[5]);
+    t3 = FFT_VSUB(a[2], a[5]);
+    t4 = FFT_VADD(a[1], a[4]);
+    t5 = FFT_VSUB(a[4], a[1]);
+    t6 = FFT_VADD(t2, t4);
+    t7 = FFT_VSUB(t2, t4);
+    t8 = FFT_VMULNJ(t7);
+    t9 = FFT_VADD(t0, t6);
+    t10 = FFT_VSCL(t6, 0.4999999999999998);
+    t11 = FFT_VSUB(t0, t10);
+    t12 = FFT_VSCL(t8, 0.8660254037844387);
+    t13 = FFT_VADD(t11, t12);
+    t14 = FFT_VSUB(t11, t12);
+    t15 = FFT_VADD(t3, t5);
+    t16 = FFT_VSUB(t3, t5);
+    t17 = FFT_VMULNJ(t16);
+    t18 = FFT_VADD(t1, t15);
+    t19 = FFT_VSCL(t15, 0.4999999999999998);
+    t20 = FFT_VSUB(t1, t19);
+    t21 = FFT_VSCL(t17, 0.8660254037844387);
+    t22 = FFT_VADD(t20, t21);
+    t23 = FFT_VSUB(t20, t21);
+    a[0] = t9;
+    a[1] = t22;
+    a[2] = t14;
+    a[3] = t18;
+    a[4] = t13;
+    a[5] = t23;
+}
+
+
+
+/* 9 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf9)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62, t63, t64, t65, t66, t67, t68, t69;
+
+    t0 = FFT_VADD(a[3], a[6]);
+    t1 = FFT_VSUB(a[3], a[6]);
+    t2 = FFT_VMULNJ(t1);
+    t3 = FFT_VADD(a[0], t0);
+    t4 = FFT_VSCL(t0, 0.4999999999999998);
+    t5 = FFT_VSUB(a[0], t4);
+    t6 = FFT_VSCL(t2, 0.8660254037844387);
+    t7 = FFT_VADD(t5, t6);
+    t8 = FFT_VSUB(t5, t6);
+    t9 = FFT_VADD(a[4], a[7]);
+    t10 = FFT_VSUB(a[4], a[7]);
+    t11 = FFT_VMULNJ(t10);
+    t12 = FFT_VADD(a[1], t9);
+    t13 = FFT_VSCL(t9, 0.4999999999999998);
+    t14 = FFT_VSUB(a[1], t13);
+    t15 = FFT_VSCL(t11, 0.8660254037844387);
+    t16 = FFT_VADD(t14, t15);
+    t17 = FFT_VSUB(t14, t15);
+    t18 = FFT_VADD(a[5], a[8]);
+    t19 = FFT_VSUB(a[5], a[8]);
+    t20 = FFT_VMULNJ(t19);
+    t21 = FFT_VADD(a[2], t18);
+    t22 = FFT_VSCL(t18, 0.4999999999999998);
+    t23 = FFT_VSUB(a[2], t22);
+    t24 = FFT_VSCL(t20, 0.8660254037844387);
+    t25 = FFT_VADD(t23, t24);
+    t26 = FFT_VSUB(t23, t24);
+    t27 = FFT_VADD(t12, t21);
+    t28 = FFT_VSUB(t12, t21);
+    t29 = FFT_VMULNJ(t28);
+    t30 = FFT_VADD(t27, t3);
+    t31 = FFT_VSCL(t27, 0.4999999999999998);
+    t32 = FFT_VSUB(t3, t31);
+    t33 = FFT_VSCL(t29, 0.8660254037844387);
+    t34 = FFT_VADD(t32, t33);
+    t35 = FFT_VSUB(t32, t33);
+    t36 = FFT_VSCL(t16, 0.766044443118978);
+    t37 = FFT_VMULNJ(t16);
+    t38 = FFT_VSCL(t37, 0.6427876096865393);
+    t39 = FFT_VADD(t36, t38);
+    t40 = FFT_VSCL(t25, 0.17364817766693041);
+    t41 = FFT_VMULNJ(t25);
+    t42 = FFT_VSCL(t41, 0.984807753012208);
+    t43 = FFT_VADD(t40, t42);
+    t44 = FFT_VADD(t39, t43);
+    t45 = FFT_VSUB(t39, t43);
+    t46 = FFT_VMULNJ(t45);
+    t47 = FFT_VADD(t44, t7);
+    t48 = FFT_VSCL(t44, 0.4999999999999998);
+    t49 = FFT_VSUB(t7, t48);
+    t50 = FFT_VSCL(t46, 0.8660254037844387);
+    t51 = FFT_VADD(t49, t50);
+    t52 = FFT_VSUB(t49, t50);
+    t53 = FFT_VSCL(t17, 0.17364817766693041);
+    t54 = FFT_VMULNJ(t17);
+    t55 = FFT_VSCL(t54, 0.984807753012208);
+    t56 = FFT_VADD(t53, t55);
+    t57 = FFT_VSCL(t26, 0.9396926207859083);
+    t58 = FFT_VMULNJ(t26);
+    t59 = FFT_VSCL(t58, 0.3420201433256689);
+    t60 = FFT_VSUB(t59, t57);
+    t61 = FFT_VADD(t56, t60);
+    t62 = FFT_VSUB(t56, t60);
+    t63 = FFT_VMULNJ(t62);
+    t64 = FFT_VADD(t61, t8);
+    t65 = FFT_VSCL(t61, 0.4999999999999998);
+    t66 = FFT_VSUB(t8, t65);
+    t67 = FFT_VSCL(t63, 0.8660254037844387);
+    t68 = FFT_VADD(t66, t67);
+    t69 = FFT_VSUB(t66, t67);
+    a[0] = t30;
+    a[1] = t47;
+    a[2] = t64;
+    a[3] = t34;
+    a[4] = t51;
+    a[5] = t68;
+    a[6] = t35;
+    a[7] = t52;
+    a[8] = t69;
+}
+
+
+
+/* 10 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf10)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61;
+
+    t0 = FFT_VADD(a[0], a[5]);
+    t1 = FFT_VSUB(a[0], a[5]);
+    t2 = FFT_VADD(a[2], a[7]);
+    t3 = FFT_VSUB(a[2], a[7]);
+    t4 = FFT_VADD(a[4], a[9]);
+    t5 = FFT_VSUB(a[4], a[9]);
+    t6 = FFT_VADD(a[1], a[6]);
+    t7 = FFT_VSUB(a[6], a[1]);
+    t8 = FFT_VADD(a[3], a[8]);
+    t9 = FFT_VSUB(a[8], a[3]);
+    t10 = FFT_VADD(t2, t8);
+    t11 = FFT_VADD(t4, t6);
+    t12 = FFT_VSUB(t2, t8);
+    t13 = FFT_VMULNJ(t12);
+    t14 = FFT_VSUB(t4, t6);
+    t15 = FFT_VMULNJ(t14);
+    t16 = FFT_VADD(t0, t10);
+    t17 = FFT_VADD(t11, t16);
+    t18 = FFT_VSCL(t10, 0.30901699437494745);
+    t19 = FFT_VSCL(t11, 0.8090169943749473);
+    t20 = FFT_VADD(t0, t18);
+    t21 = FFT_VSUB(t20, t19);
+    t22 = FFT_VSCL(t13, 0.9510565162951535);
+    t23 = FFT_VSCL(t15, 0.5877852522924732);
+    t24 = FFT_VADD(t22, t23);
+    t25 = FFT_VADD(t21, t24);
+    t26 = FFT_VSUB(t21, t24);
+    t27 = FFT_VSCL(t10, 0.8090169943749473);
+    t28 = FFT_VSCL(t11, 0.30901699437494745);
+    t29 = FFT_VSUB(t0, t27);
+    t30 = FFT_VADD(t28, t29);
+    t31 = FFT_VSCL(t13, 0.5877852522924732);
+    t32 = FFT_VSCL(t15, 0.9510565162951535);
+    t33 = FFT_VSUB(t31, t32);
+    t34 = FFT_VADD(t30, t33);
+    t35 = FFT_VSUB(t30, t33);
+    t36 = FFT_VADD(t3, t9);
+    t37 = FFT_VADD(t5, t7);
+    t38 = FFT_VSUB(t3, t9);
+    t39 = FFT_VMULNJ(t38);
+    t40 = FFT_VSUB(t5, t7);
+    t41 = FFT_VMULNJ(t40);
+    t42 = FFT_VADD(t1, t36);
+    t43 = FFT_VADD(t37, t42);
+    t44 = FFT_VSCL(t36, 0.30901699437494745);
+    t45 = FFT_VSCL(t37, 0.8090169943749473);
+    t46 = FFT_VADD(t1, t44);
+    t47 = FFT_VSUB(t46, t45);
+    t48 = FFT_VSCL(t39, 0.9510565162951535);
+    t49 = FFT_VSCL(t41, 0.5877852522924732);
+    t50 = FFT_VADD(t48, t49);
+    t51 = FFT_VADD(t47, t50);
+    t52 = FFT_VSUB(t47, t50);
+    t53 = FFT_VSCL(t36, 0.8090169943749473);
+    t54 = FFT_VSCL(t37, 0.30901699437494745);
+    t55 = FFT_VSUB(t1, t53);
+    t56 = FFT_VADD(t54, t55);
+    t57 = FFT_VSCL(t39, 0.5877852522924732);
+    t58 = FFT_VSCL(t41, 0.9510565162951535);
+    t59 = FFT_VSUB(t57, t58);
+    t60 = FFT_VADD(t56, t59);
+    t61 = FFT_VSUB(t56, t59);
+    a[0] = t17;
+    a[1] = t51;
+    a[2] = t34;
+    a[3] = t61;
+    a[4] = t26;
+    a[5] = t43;
+    a[6] = t25;
+    a[7] = t60;
+    a[8] = t35;
+    a[9] = t52;
+}
+
+
+
+/* 11 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf11)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62, t63, t64, t65, t66, t67, t68, t69;
+    FFT_V t70, t71, t72, t73, t74, t75, t76, t77, t78, t79;
+    FFT_V t80, t81, t82, t83, t84, t85, t86, t87, t88, t89;
+    FFT_V t90, t91, t92, t93, t94, t95, t96, t97, t98, t99;
+    FFT_V t100, t101, t102, t103, t104, t105, t106, t107, t108, t109;
+    FFT_V t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+    FFT_V t120, t121, t122, t123, t124;
+
+    t0 = FFT_VADD(a[10], a[1]);
+    t1 = FFT_VADD(a[2], a[9]);
+    t2 = FFT_VADD(a[3], a[8]);
+    t3 = FFT_VADD(a[4], a[7]);
+    t4 = FFT_VADD(a[5], a[6]);
+    t5 = FFT_VSUB(a[1], a[10]);
+    t6 = FFT_VMULNJ(t5);
+    t7 = FFT_VSUB(a[2], a[9]);
+    t8 = FFT_VMULNJ(t7);
+    t9 = FFT_VSUB(a[3], a[8]);
+    t10 = FFT_VMULNJ(t9);
+    t11 = FFT_VSUB(a[4], a[7]);
+    t12 = FFT_VMULNJ(t11);
+    t13 = FFT_VSUB(a[5], a[6]);
+    t14 = FFT_VMULNJ(t13);
+    t15 = FFT_VADD(a[0], t0);
+    t16 = FFT_VADD(t1, t15);
+    t17 = FFT_VADD(t16, t2);
+    t18 = FFT_VADD(t17, t3);
+    t19 = FFT_VADD(t18, t4);
+    t20 = FFT_VSCL(t0, 0.8412535328311812);
+    t21 = FFT_VSCL(t1, 0.41541501300188644);
+    t22 = FFT_VSCL(t2, 0.142314838273285);
+    t23 = FFT_VSCL(t3, 0.654860733945285);
+    t24 = FFT_VSCL(t4, 0.9594929736144974);
+    t25 = FFT_VADD(a[0], t20);
+    t26 = FFT_VADD(t21, t25);
+    t27 = FFT_VSUB(t26, t22);
+    t28 = FFT_VSUB(t27, t23);
+    t29 = FFT_VSUB(t28, t24);
+    t30 = FFT_VSCL(t6, 0.5406408174555976);
+    t31 = FFT_VSCL(t8, 0.9096319953545183);
+    t32 = FFT_VSCL(t10, 0.9898214418809328);
+    t33 = FFT_VSCL(t12, 0.7557495743542583);
+    t34 = FFT_VSCL(t14, 0.28173255684142967);
+    t35 = FFT_VADD(t30, t31);
+    t36 = FFT_VADD(t32, t35);
+    t37 = FFT_VADD(t33, t36);
+    t38 = FFT_VADD(t34, t37);
+    t39 = FFT_VADD(t29, t38);
+    t40 = FFT_VSUB(t29, t38);
+    t41 = FFT_VSCL(t0, 0.41541501300188644);
+    t42 = FFT_VSCL(t1, 0.654860733945285);
+    t43 = FFT_VSCL(t2, 0.9594929736144974);
+    t44 = FFT_VSCL(t3, 0.142314838273285);
+    t45 = FFT_VSCL(t4, 0.8412535328311812);
+    t46 = FFT_VADD(a[0], t41);
+    t47 = FFT_VSUB(t46, t42);
+    t48 = FFT_VSUB(t47, t43);
+    t49 = FFT_VSUB(t48, t44);
+    t50 = FFT_VADD(t45, t49);
+    t51 = FFT_VSCL(t6, 0.9096319953545183);
+    t52 = FFT_VSCL(t8, 0.7557495743542583);
+    t53 = FFT_VSCL(t10, 0.28173255684142967);
+    t54 = FFT_VSCL(t12, 0.9898214418809328);
+    t55 = FFT_VSCL(t14, 0.5406408174555976);
+    t56 = FFT_VADD(t51, t52);
+    t57 = FFT_VSUB(t56, t53);
+    t58 = FFT_VSUB(t57, t54);
+    t59 = FFT_VSUB(t58, t55);
+    t60 = FFT_VADD(t50, t59);
+    t61 = FFT_VSUB(t50, t59);
+    t62 = FFT_VSCL(t0, 0.142314838273285);
+    t63 = FFT_VSCL(t1, 0.9594929736144974);
+    t64 = FFT_VSCL(t2, 0.41541501300188644);
+    t65 = FFT_VSCL(t3, 0.8412535328311812);
+    t66 = FFT_VSCL(t4, 0.654860733945285);
+    t67 = FFT_VSUB(a[0], t62);
+    t68 = FFT_VSUB(t67, t63);
+    t69 = FFT_VADD(t64, t68);
+    t70 = FFT_VADD(t65, t69);
+    t71 = FFT_VSUB(t70, t66);
+    t72 = FFT_VSCL(t6, 0.9898214418809328);
+    t73 = FFT_VSCL(t8, 0.28173255684142967);
+    t74 = FFT_VSCL(t10, 0.9096319953545183);
+    t75 = FFT_VSCL(t12, 0.5406408174555976);
+    t76 = FFT_VSCL(t14, 0.7557495743542583);
+    t77 = FFT_VSUB(t72, t73);
+    t78 = FFT_VSUB(t77, t74);
+    t79 = FFT_VADD(t75, t78);
+    t80 = FFT_VADD(t76, t79);
+    t81 = FFT_VADD(t71, t80);
+    t82 = FFT_VSUB(t71, t80);
+    t83 = FFT_VSCL(t0, 0.654860733945285);
+    t84 = FFT_VSCL(t1, 0.142314838273285);
+    t85 = FFT_VSCL(t2, 0.8412535328311812);
+    t86 = FFT_VSCL(t3, 0.9594929736144974);
+    t87 = FFT_VSCL(t4, 0.41541501300188644);
+    t88 = FFT_VSUB(a[0], t83);
+    t89 = FFT_VSUB(t88, t84);
+    t90 = FFT_VADD(t85, t89);
+    t91 = FFT_VSUB(t90, t86);
+    t92 = FFT_VADD(t87, t91);
+    t93 = FFT_VSCL(t6, 0.7557495743542583);
+    t94 = FFT_VSCL(t8, 0.9898214418809328);
+    t95 = FFT_VSCL(t10, 0.5406408174555976);
+    t96 = FFT_VSCL(t12, 0.28173255684142967);
+    t97 = FFT_VSCL(t14, 0.9096319953545183);
+    t98 = FFT_VSUB(t93, t94);
+    t99 = FFT_VADD(t95, t98);
+    t100 = FFT_VADD(t96, t99);
+    t101 = FFT_VSUB(t100, t97);
+    t102 = FFT_VADD(t101, t92);
+    t103 = FFT_VSUB(t92, t101);
+    t104 = FFT_VSCL(t0, 0.9594929736144974);
+    t105 = FFT_VSCL(t1, 0.8412535328311812);
+    t106 = FFT_VSCL(t2, 0.654860733945285);
+    t107 = FFT_VSCL(t3, 0.41541501300188644);
+    t108 = FFT_VSCL(t4, 0.142314838273285);
+    t109 = FFT_VSUB(a[0], t104);
+    t110 = FFT_VADD(t105, t109);
+    t111 = FFT_VSUB(t110, t106);
+    t112 = FFT_VADD(t107, t111);
+    t113 = FFT_VSUB(t112, t108);
+    t114 = FFT_VSCL(t6, 0.28173255684142967);
+    t115 = FFT_VSCL(t8, 0.5406408174555976);
+    t116 = FFT_VSCL(t10, 0.7557495743542583);
+    t117 = FFT_VSCL(t12, 0.9096319953545183);
+    t118 = FFT_VSCL(t14, 0.9898214418809328);
+    t119 = FFT_VSUB(t114, t115);
+    t120 = FFT_VADD(t116, t119);
+    t121 = FFT_VSUB(t120, t117);
+    t122 = FFT_VADD(t118, t121);
+    t123 = FFT_VADD(t113, t122);
+    t124 = FFT_VSUB(t113, t122);
+    a[0] = t19;
+    a[1] = t39;
+    a[2] = t60;
+    a[3] = t81;
+    a[4] = t102;
+    a[5] = t123;
+    a[6] = t124;
+    a[7] = t103;
+    a[8] = t82;
+    a[9] = t61;
+    a[10] = t40;
+}
+
+
+
+/* 12 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf12)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62;
+
+    t0 = FFT_VADD(a[4], a[8]);
+    t1 = FFT_VSUB(a[4], a[8]);
+    t2 = FFT_VMULNJ(t1);
+    t3 = FFT_VADD(a[0], t0);
+    t4 = FFT_VSCL(t0, 0.4999999999999998);
+    t5 = FFT_VSUB(a[0], t4);
+    t6 = FFT_VSCL(t2, 0.8660254037844387);
+    t7 = FFT_VADD(t5, t6);
+    t8 = FFT_VSUB(t5, t6);
+    t9 = FFT_VADD(a[11], a[7]);
+    t10 = FFT_VSUB(a[7], a[11]);
+    t11 = FFT_VMULNJ(t10);
+    t12 = FFT_VADD(a[3], t9);
+    t13 = FFT_VSCL(t9, 0.4999999999999998);
+    t14 = FFT_VSUB(a[3], t13);
+    t15 = FFT_VSCL(t11, 0.8660254037844387);
+    t16 = FFT_VADD(t14, t15);
+    t17 = FFT_VSUB(t14, t15);
+    t18 = FFT_VADD(a[10], a[2]);
+    t19 = FFT_VSUB(a[10], a[2]);
+    t20 = FFT_VMULNJ(t19);
+    t21 = FFT_VADD(a[6], t18);
+    t22 = FFT_VSCL(t18, 0.4999999999999998);
+    t23 = FFT_VSUB(a[6], t22);
+    t24 = FFT_VSCL(t20, 0.8660254037844387);
+    t25 = FFT_VADD(t23, t24);
+    t26 = FFT_VSUB(t23, t24);
+    t27 = FFT_VADD(a[1], a[5]);
+    t28 = FFT_VSUB(a[1], a[5]);
+    t29 = FFT_VMULNJ(t28);
+    t30 = FFT_VADD(a[9], t27);
+    t31 = FFT_VSCL(t27, 0.4999999999999998);
+    t32 = FFT_VSUB(a[9], t31);
+    t33 = FFT_VSCL(t29, 0.8660254037844387);
+    t34 = FFT_VADD(t32, t33);
+    t35 = FFT_VSUB(t32, t33);
+    t36 = FFT_VADD(t21, t3);
+    t37 = FFT_VSUB(t3, t21);
+    t38 = FFT_VADD(t12, t30);
+    t39 = FFT_VSUB(t12, t30);
+    t40 = FFT_VADD(t36, t38);
+    t41 = FFT_VSUB(t36, t38);
+    t42 = FFT_VMULNJ(t39);
+    t43 = FFT_VADD(t37, t42);
+    t44 = FFT_VSUB(t37, t42);
+    t45 = FFT_VADD(t25, t7);
+    t46 = FFT_VSUB(t7, t25);
+    t47 = FFT_VADD(t16, t34);
+    t48 = FFT_VSUB(t16, t34);
+    t49 = FFT_VADD(t45, t47);
+    t50 = FFT_VSUB(t45, t47);
+    t51 = FFT_VMULNJ(t48);
+    t52 = FFT_VADD(t46, t51);
+    t53 = FFT_VSUB(t46, t51);
+    t54 = FFT_VADD(t26, t8);
+    t55 = FFT_VSUB(t8, t26);
+    t56 = FFT_VADD(t17, t35);
+    t57 = FFT_VSUB(t17, t35);
+    t58 = FFT_VADD(t54, t56);
+    t59 = FFT_VSUB(t54, t56);
+    t60 = FFT_VMULNJ(t57);
+    t61 = FFT_VADD(t55, t60);
+    t62 = FFT_VSUB(t55, t60);
+    a[0] = t40;
+    a[1] = t52;
+    a[2] = t59;
+    a[3] = t44;
+    a[4] = t49;
+    a[5] = t61;
+    a[6] = t41;
+    a[7] = t53;
+    a[8] = t58;
+    a[9] = t43;
+    a[10] = t50;
+    a[11] = t62;
+}
+
+
+
+/* 13 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf13)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62, t63, t64, t65, t66, t67, t68, t69;
+    FFT_V t70, t71, t72, t73, t74, t75, t76, t77, t78, t79;
+    FFT_V t80, t81, t82, t83, t84, t85, t86, t87, t88, t89;
+    FFT_V t90, t91, t92, t93, t94, t95, t96, t97, t98, t99;
+    FFT_V t100, t101, t102, t103, t104, t105, t106, t107, t108, t109;
+    FFT_V t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+    FFT_V t120, t121, t122, t123, t124, t125, t126, t127, t128, t129;
+    FFT_V t130, t131, t132, t133, t134, t135, t136, t137, t138, t139;
+    FFT_V t140, t141, t142, t143, t144, t145, t146, t147, t148, t149;
+    FFT_V t150, t151, t152, t153, t154, t155, t156, t157, t158, t159;
+    FFT_V t160, t161, t162, t163, t164, t165, t166, t167, t168, t169;
+    FFT_V t170, t171, t172, t173;
+
+    t0 = FFT_VADD(a[12], a[1]);
+    t1 = FFT_VADD(a[11], a[2]);
+    t2 = FFT_VADD(a[10], a[3]);
+    t3 = FFT_VADD(a[4], a[9]);
+    t4 = FFT_VADD(a[5], a[8]);
+    t5 = FFT_VADD(a[6], a[7]);
+    t6 = FFT_VSUB(a[1], a[12]);
+    t7 = FFT_VMULNJ(t6);
+    t8 = FFT_VSUB(a[2], a[11]);
+    t9 = FFT_VMULNJ(t8);
+    t10 = FFT_VSUB(a[3], a[10]);
+    t11 = FFT_VMULNJ(t10);
+    t12 = FFT_VSUB(a[4], a[9]);
+    t13 = FFT_VMULNJ(t12);
+    t14 = FFT_VSUB(a[5], a[8]);
+    t15 = FFT_VMULNJ(t14);
+    t16 = FFT_VSUB(a[6], a[7]);
+    t17 = FFT_VMULNJ(t16);
+    t18 = FFT_VADD(a[0], t0);
+    t19 = FFT_VADD(t1, t18);
+    t20 = FFT_VADD(t19, t2);
+    t21 = FFT_VADD(t20, t3);
+    t22 = FFT_VADD(t21, t4);
+    t23 = FFT_VADD(t22, t5);
+    t24 = FFT_VSCL(t0, 0.8854560256532099);
+    t25 = FFT_VSCL(t1, 0.5680647467311559);
+    t26 = FFT_VSCL(t2, 0.120536680255323);
+    t27 = FFT_VSCL(t3, 0.35460488704253545);
+    t28 = FFT_VSCL(t4, 0.7485107481711012);
+    t29 = FFT_VSCL(t5, 0.970941817426052);
+    t30 = FFT_VADD(a[0], t24);
+    t31 = FFT_VADD(t25, t30);
+    t32 = FFT_VADD(t26, t31);
+    t33 = FFT_VSUB(t32, t27);
+    t34 = FFT_VSUB(t33, t28);
+    t35 = FFT_VSUB(t34, t29);
+    t36 = FFT_VSCL(t7, 0.4647231720437685);
+    t37 = FFT_VSCL(t9, 0.8229838658936564);
+    t38 = FFT_VSCL(t11, 0.992708874098054);
+    t39 = FFT_VSCL(t13, 0.9350162426854148);
+    t40 = FFT_VSCL(t15, 0.6631226582407952);
+    t41 = FFT_VSCL(t17, 0.23931566428755768);
+    t42 = FFT_VADD(t36, t37);
+    t43 = FFT_VADD(t38, t42);
+    t44 = FFT_VADD(t39, t43);
+    t45 = FFT_VADD(t40, t44);
+    t46 = FFT_VADD(t41, t45);
+    t47 = FFT_VADD(t35, t46);
+    t48 = FFT_VSUB(t35, t46);
+    t49 = FFT_VSCL(t0, 0.5680647467311559);
+    t50 = FFT_VSCL(t1, 0.35460488704253545);
+    t51 = FFT_VSCL(t2, 0.970941817426052);
+    t52 = FFT_VSCL(t3, 0.7485107481711012);
+    t53 = FFT_VSCL(t4, 0.120536680255323);
+    t54 = FFT_VSCL(t5, 0.8854560256532099);
+    t55 = FFT_VADD(a[0], t49);
+    t56 = FFT_VSUB(t55, t50);
+    t57 = FFT_VSUB(t56, t51);
+    t58 = FFT_VSUB(t57, t52);
+    t59 = FFT_VADD(t53, t58);
+    t60 = FFT_VADD(t54, t59);
+    t61 = FFT_VSCL(t7, 0.8229838658936564);
+    t62 = FFT_VSCL(t9, 0.9350162426854148);
+    t63 = FFT_VSCL(t11, 0.23931566428755768);
+    t64 = FFT_VSCL(t13, 0.6631226582407952);
+    t65 = FFT_VSCL(t15, 0.992708874098054);
+    t66 = FFT_VSCL(t17, 0.4647231720437685);
+    t67 = FFT_VADD(t61, t62);
+    t68 = FFT_VADD(t63, t67);
+    t69 = FFT_VSUB(t68, t64);
+    t70 = FFT_VSUB(t69, t65);
+    t71 = FFT_VSUB(t70, t66);
+    t72 = FFT_VADD(t60, t71);
+    t73 = FFT_VSUB(t60, t71);
+    t74 = FFT_VSCL(t0, 0.120536680255323);
+    t75 = FFT_VSCL(t1, 0.970941817426052);
+    t76 = FFT_VSCL(t2, 0.35460488704253545);
+    t77 = FFT_VSCL(t3, 0.8854560256532099);
+    t78 = FFT_VSCL(t4, 0.5680647467311559);
+    t79 = FFT_VSCL(t5, 0.7485107481711012);
+    t80 = FFT_VADD(a[0], t74);
+    t81 = FFT_VSUB(t80, t75);
+    t82 = FFT_VSUB(t81, t76);
+    t83 = FFT_VADD(t77, t82);
+    t84 = FFT_VADD(t78, t83);
+    t85 = FFT_VSUB(t84, t79);
+    t86 = FFT_VSCL(t7, 0.992708874098054);
+    t87 = FFT_VSCL(t9, 0.23931566428755768);
+    t88 = FFT_VSCL(t11, 0.9350162426854148);
+    t89 = FFT_VSCL(t13, 0.4647231720437685);
+    t90 = FFT_VSCL(t15, 0.8229838658936564);
+    t91 = FFT_VSCL(t17, 0.6631226582407952);
+    t92 = FFT_VADD(t86, t87);
+    t93 = FFT_VSUB(t92, t88);
+    t94 = FFT_VSUB(t93, t89);
+    t95 = FFT_VADD(t90, t94);
+    t96 = FFT_VADD(t91, t95);
+    t97 = FFT_VADD(t85, t96);
+    t98 = FFT_VSUB(t85, t96);
+    t99 = FFT_VSCL(t0, 0.35460488704253545);
+    t100 = FFT_VSCL(t1, 0.7485107481711012);
+    t101 = FFT_VSCL(t2, 0.8854560256532099);
+    t102 = FFT_VSCL(t3, 0.120536680255323);
+    t103 = FFT_VSCL(t4, 0.970941817426052);
+    t104 = FFT_VSCL(t5, 0.5680647467311559);
+    t105 = FFT_VSUB(a[0], t99);
+    t106 = FFT_VSUB(t105, t100);
+    t107 = FFT_VADD(t101, t106);
+    t108 = FFT_VADD(t102, t107);
+    t109 = FFT_VSUB(t108, t103);
+    t110 = FFT_VADD(t104, t109);
+    t111 = FFT_VSCL(t7, 0.9350162426854148);
+    t112 = FFT_VSCL(t9, 0.6631226582407952);
+    t113 = FFT_VSCL(t11, 0.4647231720437685);
+    t114 = FFT_VSCL(t13, 0.992708874098054);
+    t115 = FFT_VSCL(t15, 0.23931566428755768);
+    t116 = FFT_VSCL(t17, 0.8229838658936564);
+    t117 = FFT_VSUB(t111, t112);
+    t118 = FFT_VSUB(t117, t113);
+    t119 = FFT_VADD(t114, t118);
+    t120 = FFT_VSUB(t119, t115);
+    t121 = FFT_VSUB(t120, t116);
+    t122 = FFT_VADD(t110, t121);
+    t123 = FFT_VSUB(t110, t121);
+    t124 = FFT_VSCL(t0, 0.7485107481711012);
+    t125 = FFT_VSCL(t1, 0.120536680255323);
+    t126 = FFT_VSCL(t2, 0.5680647467311559);
+    t127 = FFT_VSCL(t3, 0.970941817426052);
+    t128 = FFT_VSCL(t4, 0.8854560256532099);
+    t129 = FFT_VSCL(t5, 0.35460488704253545);
+    t130 = FFT_VSUB(a[0], t124);
+    t131 = FFT_VADD(t125, t130);
+    t132 = FFT_VADD(t126, t131);
+    t133 = FFT_VSUB(t132, t127);
+    t134 = FFT_VADD(t128, t133);
+    t135 = FFT_VSUB(t134, t129);
+    t136 = FFT_VSCL(t7, 0.6631226582407952);
+    t137 = FFT_VSCL(t9, 0.992708874098054);
+    t138 = FFT_VSCL(t11, 0.8229838658936564);
+    t139 = FFT_VSCL(t13, 0.23931566428755768);
+    t140 = FFT_VSCL(t15, 0.4647231720437685);
+    t141 = FFT_VSCL(t17, 0.9350162426854148);
+    t142 = FFT_VSUB(t136, t137);
+    t143 = FFT_VADD(t138, t142);
+    t144 = FFT_VSUB(t143, t139);
+    t145 = FFT_VSUB(t144, t140);
+    t146 = FFT_VADD(t141, t145);
+    t147 = FFT_VADD(t135, t146);
+    t148 = FFT_VSUB(t135, t146);
+    t149 = FFT_VSCL(t0, 0.970941817426052);
+    t150 = FFT_VSCL(t1, 0.8854560256532099);
+    t151 = FFT_VSCL(t2, 0.7485107481711012);
+    t152 = FFT_VSCL(t3, 0.5680647467311559);
+    t153 = FFT_VSCL(t4, 0.35460488704253545);
+    t154 = FFT_VSCL(t5, 0.120536680255323);
+    t155 = FFT_VSUB(a[0], t149);
+    t156 = FFT_VADD(t150, t155);
+    t157 = FFT_VSUB(t156, t151);
+    t158 = FFT_VADD(t152, t157);
+    t159 = FFT_VSUB(t158, t153);
+    t160 = FFT_VADD(t154, t159);
+    t161 = FFT_VSCL(t7, 0.23931566428755768);
+    t162 = FFT_VSCL(t9, 0.4647231720437685);
+    t163 = FFT_VSCL(t11, 0.6631226582407952);
+    t164 = FFT_VSCL(t13, 0.8229838658936564);
+    t165 = FFT_VSCL(t15, 0.9350162426854148);
+    t166 = FFT_VSCL(t17, 0.992708874098054);
+    t167 = FFT_VSUB(t161, t162);
+    t168 = FFT_VADD(t163, t167);
+    t169 = FFT_VSUB(t168, t164);
+    t170 = FFT_VADD(t165, t169);
+    t171 = FFT_VSUB(t170, t166);
+    t172 = FFT_VADD(t160, t171);
+    t173 = FFT_VSUB(t160, t171);
+    a[0] = t23;
+    a[1] = t47;
+    a[2] = t72;
+    a[3] = t97;
+    a[4] = t122;
+    a[5] = t147;
+    a[6] = t172;
+    a[7] = t173;
+    a[8] = t148;
+    a[9] = t123;
+    a[10] = t98;
+    a[11] = t73;
+    a[12] = t48;
+}
+
+
+
+/* 15 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf15)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62, t63, t64, t65, t66, t67, t68, t69;
+    FFT_V t70, t71, t72, t73, t74, t75, t76, t77, t78, t79;
+    FFT_V t80, t81, t82, t83, t84, t85, t86, t87, t88, t89;
+    FFT_V t90, t91, t92, t93, t94, t95, t96, t97, t98, t99;
+    FFT_V t100, t101, t102, t103, t104, t105, t106, t107, t108, t109;
+    FFT_V t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+    FFT_V t120, t121, t122;
+
+    t0 = FFT_VADD(a[10], a[5]);
+    t1 = FFT_VSUB(a[5], a[10]);
+    t2 = FFT_VMULNJ(t1);
+    t3 = FFT_VADD(a[0], t0);
+    t4 = FFT_VSCL(t0, 0.4999999999999998);
+    t5 = FFT_VSUB(a[0], t4);
+    t6 = FFT_VSCL(t2, 0.8660254037844387);
+    t7 = FFT_VADD(t5, t6);
+    t8 = FFT_VSUB(t5, t6);
+    t9 = FFT_VADD(a[13], a[8]);
+    t10 = FFT_VSUB(a[8], a[13]);
+    t11 = FFT_VMULNJ(t10);
+    t12 = FFT_VADD(a[3], t9);
+    t13 = FFT_VSCL(t9, 0.4999999999999998);
+    t14 = FFT_VSUB(a[3], t13);
+    t15 = FFT_VSCL(t11, 0.8660254037844387);
+    t16 = FFT_VADD(t14, t15);
+    t17 = FFT_VSUB(t14, t15);
+    t18 = FFT_VADD(a[11], a[1]);
+    t19 = FFT_VSUB(a[11], a[1]);
+    t20 = FFT_VMULNJ(t19);
+    t21 = FFT_VADD(a[6], t18);
+    t22 = FFT_VSCL(t18, 0.4999999999999998);
+    t23 = FFT_VSUB(a[6], t22);
+    t24 = FFT_VSCL(t20, 0.8660254037844387);
+    t25 = FFT_VADD(t23, t24);
+    t26 = FFT_VSUB(t23, t24);
+    t27 = FFT_VADD(a[14], a[4]);
+    t28 = FFT_VSUB(a[14], a[4]);
+    t29 = FFT_VMULNJ(t28);
+    t30 = FFT_VADD(a[9], t27);
+    t31 = FFT_VSCL(t27, 0.4999999999999998);
+    t32 = FFT_VSUB(a[9], t31);
+    t33 = FFT_VSCL(t29, 0.8660254037844387);
+    t34 = FFT_VADD(t32, t33);
+    t35 = FFT_VSUB(t32, t33);
+    t36 = FFT_VADD(a[2], a[7]);
+    t37 = FFT_VSUB(a[2], a[7]);
+    t38 = FFT_VMULNJ(t37);
+    t39 = FFT_VADD(a[12], t36);
+    t40 = FFT_VSCL(t36, 0.4999999999999998);
+    t41 = FFT_VSUB(a[12], t40);
+    t42 = FFT_VSCL(t38, 0.8660254037844387);
+    t43 = FFT_VADD(t41, t42);
+    t44 = FFT_VSUB(t41, t42);
+    t45 = FFT_VADD(t12, t39);
+    t46 = FFT_VADD(t21, t30);
+    t47 = FFT_VSUB(t12, t39);
+    t48 = FFT_VMULNJ(t47);
+    t49 = FFT_VSUB(t21, t30);
+    t50 = FFT_VMULNJ(t49);
+    t51 = FFT_VADD(t3, t45);
+    t52 = FFT_VADD(t46, t51);
+    t53 = FFT_VSCL(t45, 0.30901699437494745);
+    t54 = FFT_VSCL(t46, 0.8090169943749473);
+    t55 = FFT_VADD(t3, t53);
+    t56 = FFT_VSUB(t55, t54);
+    t57 = FFT_VSCL(t48, 0.9510565162951535);
+    t58 = FFT_VSCL(t50, 0.5877852522924732);
+    t59 = FFT_VADD(t57, t58);
+    t60 = FFT_VADD(t56, t59);
+    t61 = FFT_VSUB(t56, t59);
+    t62 = FFT_VSCL(t45, 0.8090169943749473);
+    t63 = FFT_VSCL(t46, 0.30901699437494745);
+    t64 = FFT_VSUB(t3, t62);
+    t65 = FFT_VADD(t63, t64);
+    t66 = FFT_VSCL(t48, 0.5877852522924732);
+    t67 = FFT_VSCL(t50, 0.9510565162951535);
+    t68 = FFT_VSUB(t66, t67);
+    t69 = FFT_VADD(t65, t68);
+    t70 = FFT_VSUB(t65, t68);
+    t71 = FFT_VADD(t16, t43);
+    t72 = FFT_VADD(t25, t34);
+    t73 = FFT_VSUB(t16, t43);
+    t74 = FFT_VMULNJ(t73);
+    t75 = FFT_VSUB(t25, t34);
+    t76 = FFT_VMULNJ(t75);
+    t77 = FFT_VADD(t7, t71);
+    t78 = FFT_VADD(t72, t77);
+    t79 = FFT_VSCL(t71, 0.30901699437494745);
+    t80 = FFT_VSCL(t72, 0.8090169943749473);
+    t81 = FFT_VADD(t7, t79);
+    t82 = FFT_VSUB(t81, t80);
+    t83 = FFT_VSCL(t74, 0.9510565162951535);
+    t84 = FFT_VSCL(t76, 0.5877852522924732);
+    t85 = FFT_VADD(t83, t84);
+    t86 = FFT_VADD(t82, t85);
+    t87 = FFT_VSUB(t82, t85);
+    t88 = FFT_VSCL(t71, 0.8090169943749473);
+    t89 = FFT_VSCL(t72, 0.30901699437494745);
+    t90 = FFT_VSUB(t7, t88);
+    t91 = FFT_VADD(t89, t90);
+    t92 = FFT_VSCL(t74, 0.5877852522924732);
+    t93 = FFT_VSCL(t76, 0.9510565162951535);
+    t94 = FFT_VSUB(t92, t93);
+    t95 = FFT_VADD(t91, t94);
+    t96 = FFT_VSUB(t91, t94);
+    t97 = FFT_VADD(t17, t44);
+    t98 = FFT_VADD(t26, t35);
+    t99 = FFT_VSUB(t17, t44);
+    t100 = FFT_VMULNJ(t99);
+    t101 = FFT_VSUB(t26, t35);
+    t102 = FFT_VMULNJ(t101);
+    t103 = FFT_VADD(t8, t97);
+    t104 = FFT_VADD(t103, t98);
+    t105 = FFT_VSCL(t97, 0.30901699437494745);
+    t106 = FFT_VSCL(t98, 0.8090169943749473);
+    t107 = FFT_VADD(t105, t8);
+    t108 = FFT_VSUB(t107, t106);
+    t109 = FFT_VSCL(t100, 0.9510565162951535);
+    t110 = FFT_VSCL(t102, 0.5877852522924732);
+    t111 = FFT_VADD(t109, t110);
+    t112 = FFT_VADD(t108, t111);
+    t113 = FFT_VSUB(t108, t111);
+    t114 = FFT_VSCL(t97, 0.8090169943749473);
+    t115 = FFT_VSCL(t98, 0.30901699437494745);
+    t116 = FFT_VSUB(t8, t114);
+    t117 = FFT_VADD(t115, t116);
+    t118 = FFT_VSCL(t100, 0.5877852522924732);
+    t119 = FFT_VSCL(t102, 0.9510565162951535);
+    t120 = FFT_VSUB(t118, t119);
+    t121 = FFT_VADD(t117, t120);
+    t122 = FFT_VSUB(t117, t120);
+    a[0] = t52;
+    a[1] = t86;
+    a[2] = t121;
+    a[3] = t70;
+    a[4] = t87;
+    a[5] = t104;
+    a[6] = t60;
+    a[7] = t95;
+    a[8] = t122;
+    a[9] = t61;
+    a[10] = t78;
+    a[11] = t112;
+    a[12] = t69;
+    a[13] = t96;
+    a[14] = t113;
+}
+
+
+
+/* 25 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf25)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62, t63, t64, t65, t66, t67, t68, t69;
+    FFT_V t70, t71, t72, t73, t74, t75, t76, t77, t78, t79;
+    FFT_V t80, t81, t82, t83, t84, t85, t86, t87, t88, t89;
+    FFT_V t90, t91, t92, t93, t94, t95, t96, t97, t98, t99;
+    FFT_V t100, t101, t102, t103, t104, t105, t106, t107, t108, t109;
+    FFT_V t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+    FFT_V t120, t121, t122, t123, t124, t125, t126, t127, t128, t129;
+    FFT_V t130, t131, t132, t133, t134, t135, t136, t137, t138, t139;
+    FFT_V t140, t141, t142, t143, t144, t145, t146, t147, t148, t149;
+    FFT_V t150, t151, t152, t153, t154, t155, t156, t157, t158, t159;
+    FFT_V t160, t161, t162, t163, t164, t165, t166, t167, t168, t169;
+    FFT_V t170, t171, t172, t173, t174, t175, t176, t177, t178, t179;
+    FFT_V t180, t181, t182, t183, t184, t185, t186, t187, t188, t189;
+    FFT_V t190, t191, t192, t193, t194, t195, t196, t197, t198, t199;
+    FFT_V t200, t201, t202, t203, t204, t205, t206, t207, t208, t209;
+    FFT_V t210, t211, t212, t213, t214, t215, t216, t217, t218, t219;
+    FFT_V t220, t221, t222, t223, t224, t225, t226, t227, t228, t229;
+    FFT_V t230, t231, t232, t233, t234, t235, t236, t237, t238, t239;
+    FFT_V t240, t241, t242, t243, t244, t245, t246, t247, t248, t249;
+    FFT_V t250, t251, t252, t253, t254, t255, t256, t257, t258, t259;
+    FFT_V t260, t261, t262, t263, t264, t265, t266, t267, t268, t269;
+    FFT_V t270, t271, t272, t273, t274, t275, t276, t277, t278, t279;
+    FFT_V t280, t281, t282, t283, t284, t285, t286, t287, t288, t289;
+    FFT_V t290, t291, t292, t293, t294, t295, t296, t297, t298, t299;
+    FFT_V t300, t301, t302, t303, t304, t305, t306, t307, t308, t309;
+    FFT_V t310, t311, t312, t313, t314, t315, t316, t317, t318, t319;
+    FFT_V t320, t321, t322, t323;
+
+    t0 = FFT_VADD(a[20], a[5]);
+    t1 = FFT_VADD(a[10], a[15]);
+    t2 = FFT_VSUB(a[5], a[20]);
+    t3 = FFT_VMULNJ(t2);
+    t4 = FFT_VSUB(a[10], a[15]);
+    t5 = FFT_VMULNJ(t4);
+    t6 = FFT_VADD(a[0], t0);
+    t7 = FFT_VADD(t1, t6);
+    t8 = FFT_VSCL(t0, 0.30901699437494745);
+    t9 = FFT_VSCL(t1, 0.8090169943749473);
+    t10 = FFT_VADD(a[0], t8);
+    t11 = FFT_VSUB(t10, t9);
+    t12 = FFT_VSCL(t3, 0.9510565162951535);
+    t13 = FFT_VSCL(t5, 0.5877852522924732);
+    t14 = FFT_VADD(t12, t13);
+    t15 = FFT_VADD(t11, t14);
+    t16 = FFT_VSUB(t11, t14);
+    t17 = FFT_VSCL(t0, 0.8090169943749473);
+    t18 = FFT_VSCL(t1, 0.30901699437494745);
+    t19 = FFT_VSUB(a[0], t17);
+    t20 = FFT_VADD(t18, t19);
+    t21 = FFT_VSCL(t3, 0.5877852522924732);
+    t22 = FFT_VSCL(t5, 0.9510565162951535);
+    t23 = FFT_VSUB(t21, t22);
+    t24 = FFT_VADD(t20, t23);
+    t25 = FFT_VSUB(t20, t23);
+    t26 = FFT_VADD(a[21], a[6]);
+    t27 = FFT_VADD(a[11], a[16]);
+    t28 = FFT_VSUB(a[6], a[21]);
+    t29 = FFT_VMULNJ(t28);
+    t30 = FFT_VSUB(a[11], a[16]);
+    t31 = FFT_VMULNJ(t30);
+    t32 = FFT_VADD(a[1], t26);
+    t33 = FFT_VADD(t27, t32);
+    t34 = FFT_VSCL(t26, 0.30901699437494745);
+    t35 = FFT_VSCL(t27, 0.8090169943749473);
+    t36 = FFT_VADD(a[1], t34);
+    t37 = FFT_VSUB(t36, t35);
+    t38 = FFT_VSCL(t29, 0.9510565162951535);
+    t39 = FFT_VSCL(t31, 0.5877852522924732);
+    t40 = FFT_VADD(t38, t39);
+    t41 = FFT_VADD(t37, t40);
+    t42 = FFT_VSUB(t37, t40);
+    t43 = FFT_VSCL(t26, 0.8090169943749473);
+    t44 = FFT_VSCL(t27, 0.30901699437494745);
+    t45 = FFT_VSUB(a[1], t43);
+    t46 = FFT_VADD(t44, t45);
+    t47 = FFT_VSCL(t29, 0.5877852522924732);
+    t48 = FFT_VSCL(t31, 0.9510565162951535);
+    t49 = FFT_VSUB(t47, t48);
+    t50 = FFT_VADD(t46, t49);
+    t51 = FFT_VSUB(t46, t49);
+    t52 = FFT_VADD(a[22], a[7]);
+    t53 = FFT_VADD(a[12], a[17]);
+    t54 = FFT_VSUB(a[7], a[22]);
+    t55 = FFT_VMULNJ(t54);
+    t56 = FFT_VSUB(a[12], a[17]);
+    t57 = FFT_VMULNJ(t56);
+    t58 = FFT_VADD(a[2], t52);
+    t59 = FFT_VADD(t53, t58);
+    t60 = FFT_VSCL(t52, 0.30901699437494745);
+    t61 = FFT_VSCL(t53, 0.8090169943749473);
+    t62 = FFT_VADD(a[2], t60);
+    t63 = FFT_VSUB(t62, t61);
+    t64 = FFT_VSCL(t55, 0.9510565162951535);
+    t65 = FFT_VSCL(t57, 0.5877852522924732);
+    t66 = FFT_VADD(t64, t65);
+    t67 = FFT_VADD(t63, t66);
+    t68 = FFT_VSUB(t63, t66);
+    t69 = FFT_VSCL(t52, 0.8090169943749473);
+    t70 = FFT_VSCL(t53, 0.30901699437494745);
+    t71 = FFT_VSUB(a[2], t69);
+    t72 = FFT_VADD(t70, t71);
+    t73 = FFT_VSCL(t55, 0.5877852522924732);
+    t74 = FFT_VSCL(t57, 0.9510565162951535);
+    t75 = FFT_VSUB(t73, t74);
+    t76 = FFT_VADD(t72, t75);
+    t77 = FFT_VSUB(t72, t75);
+    t78 = FFT_VADD(a[23], a[8]);
+    t79 = FFT_VADD(a[13], a[18]);
+    t80 = FFT_VSUB(a[8], a[23]);
+    t81 = FFT_VMULNJ(t80);
+    t82 = FFT_VSUB(a[13], a[18]);
+    t83 = FFT_VMULNJ(t82);
+    t84 = FFT_VADD(a[3], t78);
+    t85 = FFT_VADD(t79, t84);
+    t86 = FFT_VSCL(t78, 0.30901699437494745);
+    t87 = FFT_VSCL(t79, 0.8090169943749473);
+    t88 = FFT_VADD(a[3], t86);
+    t89 = FFT_VSUB(t88, t87);
+    t90 = FFT_VSCL(t81, 0.9510565162951535);
+    t91 = FFT_VSCL(t83, 0.5877852522924732);
+    t92 = FFT_VADD(t90, t91);
+    t93 = FFT_VADD(t89, t92);
+    t94 = FFT_VSUB(t89, t92);
+    t95 = FFT_VSCL(t78, 0.8090169943749473);
+    t96 = FFT_VSCL(t79, 0.30901699437494745);
+    t97 = FFT_VSUB(a[3], t95);
+    t98 = FFT_VADD(t96, t97);
+    t99 = FFT_VSCL(t81, 0.5877852522924732);
+    t100 = FFT_VSCL(t83, 0.9510565162951535);
+    t101 = FFT_VSUB(t99, t100);
+    t102 = FFT_VADD(t101, t98);
+    t103 = FFT_VSUB(t98, t101);
+    t104 = FFT_VADD(a[24], a[9]);
+    t105 = FFT_VADD(a[14], a[19]);
+    t106 = FFT_VSUB(a[9], a[24]);
+    t107 = FFT_VMULNJ(t106);
+    t108 = FFT_VSUB(a[14], a[19]);
+    t109 = FFT_VMULNJ(t108);
+    t110 = FFT_VADD(a[4], t104);
+    t111 = FFT_VADD(t105, t110);
+    t112 = FFT_VSCL(t104, 0.30901699437494745);
+    t113 = FFT_VSCL(t105, 0.8090169943749473);
+    t114 = FFT_VADD(a[4], t112);
+    t115 = FFT_VSUB(t114, t113);
+    t116 = FFT_VSCL(t107, 0.9510565162951535);
+    t117 = FFT_VSCL(t109, 0.5877852522924732);
+    t118 = FFT_VADD(t116, t117);
+    t119 = FFT_VADD(t115, t118);
+    t120 = FFT_VSUB(t115, t118);
+    t121 = FFT_VSCL(t104, 0.8090169943749473);
+    t122 = FFT_VSCL(t105, 0.30901699437494745);
+    t123 = FFT_VSUB(a[4], t121);
+    t124 = FFT_VADD(t122, t123);
+    t125 = FFT_VSCL(t107, 0.5877852522924732);
+    t126 = FFT_VSCL(t109, 0.9510565162951535);
+    t127 = FFT_VSUB(t125, t126);
+    t128 = FFT_VADD(t124, t127);
+    t129 = FFT_VSUB(t124, t127);
+    t130 = FFT_VADD(t111, t33);
+    t131 = FFT_VADD(t59, t85);
+    t132 = FFT_VSUB(t33, t111);
+    t133 = FFT_VMULNJ(t132);
+    t134 = FFT_VSUB(t59, t85);
+    t135 = FFT_VMULNJ(t134);
+    t136 = FFT_VADD(t130, t7);
+    t137 = FFT_VADD(t131, t136);
+    t138 = FFT_VSCL(t130, 0.30901699437494745);
+    t139 = FFT_VSCL(t131, 0.8090169943749473);
+    t140 = FFT_VADD(t138, t7);
+    t141 = FFT_VSUB(t140, t139);
+    t142 = FFT_VSCL(t133, 0.9510565162951535);
+    t143 = FFT_VSCL(t135, 0.5877852522924732);
+    t144 = FFT_VADD(t142, t143);
+    t145 = FFT_VADD(t141, t144);
+    t146 = FFT_VSUB(t141, t144);
+    t147 = FFT_VSCL(t130, 0.8090169943749473);
+    t148 = FFT_VSCL(t131, 0.30901699437494745);
+    t149 = FFT_VSUB(t7, t147);
+    t150 = FFT_VADD(t148, t149);
+    t151 = FFT_VSCL(t133, 0.5877852522924732);
+    t152 = FFT_VSCL(t135, 0.9510565162951535);
+    t153 = FFT_VSUB(t151, t152);
+    t154 = FFT_VADD(t150, t153);
+    t155 = FFT_VSUB(t150, t153);
+    t156 = FFT_VSCL(t41, 0.9685831611286311);
+    t157 = FFT_VMULNJ(t41);
+    t158 = FFT_VSCL(t157, 0.2486898871648548);
+    t159 = FFT_VADD(t156, t158);
+    t160 = FFT_VSCL(t67, 0.8763066800438636);
+    t161 = FFT_VMULNJ(t67);
+    t162 = FFT_VSCL(t161, 0.4817536741017153);
+    t163 = FFT_VADD(t160, t162);
+    t164 = FFT_VSCL(t93, 0.7289686274214116);
+    t165 = FFT_VMULNJ(t93);
+    t166 = FFT_VSCL(t165, 0.6845471059286886);
+    t167 = FFT_VADD(t164, t166);
+    t168 = FFT_VSCL(t119, 0.5358267949789965);
+    t169 = FFT_VMULNJ(t119);
+    t170 = FFT_VSCL(t169, 0.8443279255020151);
+    t171 = FFT_VADD(t168, t170);
+    t172 = FFT_VADD(t159, t171);
+    t173 = FFT_VADD(t163, t167);
+    t174 = FFT_VSUB(t159, t171);
+    t175 = FFT_VMULNJ(t174);
+    t176 = FFT_VSUB(t163, t167);
+    t177 = FFT_VMULNJ(t176);
+    t178 = FFT_VADD(t15, t172);
+    t179 = FFT_VADD(t173, t178);
+    t180 = FFT_VSCL(t172, 0.30901699437494745);
+    t181 = FFT_VSCL(t173, 0.8090169943749473);
+    t182 = FFT_VADD(t15, t180);
+    t183 = FFT_VSUB(t182, t181);
+    t184 = FFT_VSCL(t175, 0.9510565162951535);
+    t185 = FFT_VSCL(t177, 0.5877852522924732);
+    t186 = FFT_VADD(t184, t185);
+    t187 = FFT_VADD(t183, t186);
+    t188 = FFT_VSUB(t183, t186);
+    t189 = FFT_VSCL(t172, 0.8090169943749473);
+    t190 = FFT_VSCL(t173, 0.30901699437494745);
+    t191 = FFT_VSUB(t15, t189);
+    t192 = FFT_VADD(t190, t191);
+    t193 = FFT_VSCL(t175, 0.5877852522924732);
+    t194 = FFT_VSCL(t177, 0.9510565162951535);
+    t195 = FFT_VSUB(t193, t194);
+    t196 = FFT_VADD(t192, t195);
+    t197 = FFT_VSUB(t192, t195);
+    t198 = FFT_VSCL(t50, 0.8763066800438636);
+    t199 = FFT_VMULNJ(t50);
+    t200 = FFT_VSCL(t199, 0.4817536741017153);
+    t201 = FFT_VADD(t198, t200);
+    t202 = FFT_VSCL(t76, 0.5358267949789965);
+    t203 = FFT_VMULNJ(t76);
+    t204 = FFT_VSCL(t203, 0.8443279255020151);
+    t205 = FFT_VADD(t202, t204);
+    t206 = FFT_VSCL(t102, 0.06279051952931353);
+    t207 = FFT_VMULNJ(t102);
+    t208 = FFT_VSCL(t207, 0.9980267284282716);
+    t209 = FFT_VADD(t206, t208);
+    t210 = FFT_VSCL(t128, 0.4257792915650727);
+    t211 = FFT_VMULNJ(t128);
+    t212 = FFT_VSCL(t211, 0.9048270524660195);
+    t213 = FFT_VSUB(t212, t210);
+    t214 = FFT_VADD(t201, t213);
+    t215 = FFT_VADD(t205, t209);
+    t216 = FFT_VSUB(t201, t213);
+    t217 = FFT_VMULNJ(t216);
+    t218 = FFT_VSUB(t205, t209);
+    t219 = FFT_VMULNJ(t218);
+    t220 = FFT_VADD(t214, t24);
+    t221 = FFT_VADD(t215, t220);
+    t222 = FFT_VSCL(t214, 0.30901699437494745);
+    t223 = FFT_VSCL(t215, 0.8090169943749473);
+    t224 = FFT_VADD(t222, t24);
+    t225 = FFT_VSUB(t224, t223);
+    t226 = FFT_VSCL(t217, 0.9510565162951535);
+    t227 = FFT_VSCL(t219, 0.5877852522924732);
+    t228 = FFT_VADD(t226, t227);
+    t229 = FFT_VADD(t225, t228);
+    t230 = FFT_VSUB(t225, t228);
+    t231 = FFT_VSCL(t214, 0.8090169943749473);
+    t232 = FFT_VSCL(t215, 0.30901699437494745);
+    t233 = FFT_VSUB(t24, t231);
+    t234 = FFT_VADD(t232, t233);
+    t235 = FFT_VSCL(t217, 0.5877852522924732);
+    t236 = FFT_VSCL(t219, 0.9510565162951535);
+    t237 = FFT_VSUB(t235, t236);
+    t238 = FFT_VADD(t234, t237);
+    t239 = FFT_VSUB(t234, t237);
+    t240 = FFT_VSCL(t51, 0.7289686274214116);
+    t241 = FFT_VMULNJ(t51);
+    t242 = FFT_VSCL(t241, 0.6845471059286886);
+    t243 = FFT_VADD(t240, t242);
+    t244 = FFT_VSCL(t77, 0.06279051952931353);
+    t245 = FFT_VMULNJ(t77);
+    t246 = FFT_VSCL(t245, 0.9980267284282716);
+    t247 = FFT_VADD(t244, t246);
+    t248 = FFT_VSCL(t103, 0.6374239897486897);
+    t249 = FFT_VMULNJ(t103);
+    t250 = FFT_VSCL(t249, 0.7705132427757893);
+    t251 = FFT_VSUB(t250, t248);
+    t252 = FFT_VSCL(t129, 0.9921147013144778);
+    t253 = FFT_VMULNJ(t129);
+    t254 = FFT_VSCL(t253, 0.12533323356430454);
+    t255 = FFT_VSUB(t254, t252);
+    t256 = FFT_VADD(t243, t255);
+    t257 = FFT_VADD(t247, t251);
+    t258 = FFT_VSUB(t243, t255);
+    t259 = FFT_VMULNJ(t258);
+    t260 = FFT_VSUB(t247, t251);
+    t261 = FFT_VMULNJ(t260);
+    t262 = FFT_VADD(t25, t256);
+    t263 = FFT_VADD(t257, t262);
+    t264 = FFT_VSCL(t256, 0.30901699437494745);
+    t265 = FFT_VSCL(t257, 0.8090169943749473);
+    t266 = FFT_VADD(t25, t264);
+    t267 = FFT_VSUB(t266, t265);
+    t268 = FFT_VSCL(t259, 0.9510565162951535);
+    t269 = FFT_VSCL(t261, 0.5877852522924732);
+    t270 = FFT_VADD(t268, t269);
+    t271 = FFT_VADD(t267, t270);
+    t272 = FFT_VSUB(t267, t270);
+    t273 = FFT_VSCL(t256, 0.8090169943749473);
+    t274 = FFT_VSCL(t257, 0.30901699437494745);
+    t275 = FFT_VSUB(t25, t273);
+    t276 = FFT_VADD(t274, t275);
+    t277 = FFT_VSCL(t259, 0.5877852522924732);
+    t278 = FFT_VSCL(t261, 0.9510565162951535);
+    t279 = FFT_VSUB(t277, t278);
+    t280 = FFT_VADD(t276, t279);
+    t281 = FFT_VSUB(t276, t279);
+    t282 = FFT_VSCL(t42, 0.5358267949789965);
+    t283 = FFT_VMULNJ(t42);
+    t284 = FFT_VSCL(t283, 0.8443279255020151);
+    t285 = FFT_VADD(t282, t284);
+    t286 = FFT_VSCL(t68, 0.4257792915650727);
+    t287 = FFT_VMULNJ(t68);
+    t288 = FFT_VSCL(t287, 0.9048270524660195);
+    t289 = FFT_VSUB(t288, t286);
+    t290 = FFT_VSCL(t94, 0.9921147013144778);
+    t291 = FFT_VMULNJ(t94);
+    t292 = FFT_VSCL(t291, 0.12533323356430454);
+    t293 = FFT_VSUB(t292, t290);
+    t294 = FFT_VSCL(t120, 0.6374239897486897);
+    t295 = FFT_VMULNJ(t120);
+    t296 = FFT_VSCL(t295, 0.7705132427757893);
+    t297 = FFT_VADD(t294, t296);
+    t298 = FFT_VSUB(t285, t297);
+    t299 = FFT_VADD(t289, t293);
+    t300 = FFT_VADD(t285, t297);
+    t301 = FFT_VMULNJ(t300);
+    t302 = FFT_VSUB(t289, t293);
+    t303 = FFT_VMULNJ(t302);
+    t304 = FFT_VADD(t16, t298);
+    t305 = FFT_VADD(t299, t304);
+    t306 = FFT_VSCL(t298, 0.30901699437494745);
+    t307 = FFT_VSCL(t299, 0.8090169943749473);
+    t308 = FFT_VADD(t16, t306);
+    t309 = FFT_VSUB(t308, t307);
+    t310 = FFT_VSCL(t301, 0.9510565162951535);
+    t311 = FFT_VSCL(t303, 0.5877852522924732);
+    t312 = FFT_VADD(t310, t311);
+    t313 = FFT_VADD(t309, t312);
+    t314 = FFT_VSUB(t309, t312);
+    t315 = FFT_VSCL(t298, 0.8090169943749473);
+    t316 = FFT_VSCL(t299, 0.30901699437494745);
+    t317 = FFT_VSUB(t16, t315);
+    t318 = FFT_VADD(t316, t317);
+    t319 = FFT_VSCL(t301, 0.5877852522924732);
+    t320 = FFT_VSCL(t303, 0.9510565162951535);
+    t321 = FFT_VSUB(t319, t320);
+    t322 = FFT_VADD(t318, t321);
+    t323 = FFT_VSUB(t318, t321);
+    a[0] = t137;
+    a[1] = t179;
+    a[2] = t221;
+    a[3] = t263;
+    a[4] = t305;
+    a[5] = t145;
+    a[6] = t187;
+    a[7] = t229;
+    a[8] = t271;
+    a[9] = t313;
+    a[10] = t154;
+    a[11] = t196;
+    a[12] = t238;
+    a[13] = t280;
+    a[14] = t322;
+    a[15] = t155;
+    a[16] = t197;
+    a[17] = t239;
+    a[18] = t281;
+    a[19] = t323;
+    a[20] = t146;
+    a[21] = t188;
+    a[22] = t230;
+    a[23] = t272;
+    a[24] = t314;
+}
+
+
+
+/* 49 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf49)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62, t63, t64, t65, t66, t67, t68, t69;
+    FFT_V t70, t71, t72, t73, t74, t75, t76, t77, t78, t79;
+    FFT_V t80, t81, t82, t83, t84, t85, t86, t87, t88, t89;
+    FFT_V t90, t91, t92, t93, t94, t95, t96, t97, t98, t99;
+    FFT_V t100, t101, t102, t103, t104, t105, t106, t107, t108, t109;
+    FFT_V t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+    FFT_V t120, t121, t122, t123, t124, t125, t126, t127, t128, t129;
+    FFT_V t130, t131, t132, t133, t134, t135, t136, t137, t138, t139;
+    FFT_V t140, t141, t142, t143, t144, t145, t146, t147, t148, t149;
+    FFT_V t150, t151, t152, t153, t154, t155, t156, t157, t158, t159;
+    FFT_V t160, t161, t162, t163, t164, t165, t166, t167, t168, t169;
+    FFT_V t170, t171, t172, t173, t174, t175, t176, t177, t178, t179;
+    FFT_V t180, t181, t182, t183, t184, t185, t186, t187, t188, t189;
+    FFT_V t190, t191, t192, t193, t194, t195, t196, t197, t198, t199;
+    FFT_V t200, t201, t202, t203, t204, t205, t206, t207, t208, t209;
+    FFT_V t210, t211, t212, t213, t214, t215, t216, t217, t218, t219;
+    FFT_V t220, t221, t222, t223, t224, t225, t226, t227, t228, t229;
+    FFT_V t230, t231, t232, t233, t234, t235, t236, t237, t238, t239;
+    FFT_V t240, t241, t242, t243, t244, t245, t246, t247, t248, t249;
+    FFT_V t250, t251, t252, t253, t254, t255, t256, t257, t258, t259;
+    FFT_V t260, t261, t262, t263, t264, t265, t266, t267, t268, t269;
+    FFT_V t270, t271, t272, t273, t274, t275, t276, t277, t278, t279;
+    FFT_V t280, t281, t282, t283, t284, t285, t286, t287, t288, t289;
+    FFT_V t290, t291, t292, t293, t294, t295, t296, t297, t298, t299;
+    FFT_V t300, t301, t302, t303, t304, t305, t306, t307, t308, t309;
+    FFT_V t310, t311, t312, t313, t314, t315, t316, t317, t318, t319;
+    FFT_V t320, t321, t322, t323, t324, t325, t326, t327, t328, t329;
+    FFT_V t330, t331, t332, t333, t334, t335, t336, t337, t338, t339;
+    FFT_V t340, t341, t342, t343, t344, t345, t346, t347, t348, t349;
+    FFT_V t350, t351, t352, t353, t354, t355, t356, t357, t358, t359;
+    FFT_V t360, t361, t362, t363, t364, t365, t366, t367, t368, t369;
+    FFT_V t370, t371, t372, t373, t374, t375, t376, t377, t378, t379;
+    FFT_V t380, t381, t382, t383, t384, t385, t386, t387, t388, t389;
+    FFT_V t390, t391, t392, t393, t394, t395, t396, t397, t398, t399;
+    FFT_V t400, t401, t402, t403, t404, t405, t406, t407, t408, t409;
+    FFT_V t410, t411, t412, t413, t414, t415, t416, t417, t418, t419;
+    FFT_V t420, t421, t422, t423, t424, t425, t426, t427, t428, t429;
+    FFT_V t430, t431, t432, t433, t434, t435, t436, t437, t438, t439;
+    FFT_V t440, t441, t442, t443, t444, t445, t446, t447, t448, t449;
+    FFT_V t450, t451, t452, t453, t454, t455, t456, t457, t458, t459;
+    FFT_V t460, t461, t462, t463, t464, t465, t466, t467, t468, t469;
+    FFT_V t470, t471, t472, t473, t474, t475, t476, t477, t478, t479;
+    FFT_V t480, t481, t482, t483, t484, t485, t486, t487, t488, t489;
+    FFT_V t490, t491, t492, t493, t494, t495, t496, t497, t498, t499;
+    FFT_V t500, t501, t502, t503, t504, t505, t506, t507, t508, t509;
+    FFT_V t510, t511, t512, t513, t514, t515, t516, t517, t518, t519;
+    FFT_V t520, t521, t522, t523, t524, t525, t526, t527, t528, t529;
+    FFT_V t530, t531, t532, t533, t534, t535, t536, t537, t538, t539;
+    FFT_V t540, t541, t542, t543, t544, t545, t546, t547, t548, t549;
+    FFT_V t550, t551, t552, t553, t554, t555, t556, t557, t558, t559;
+    FFT_V t560, t561, t562, t563, t564, t565, t566, t567, t568, t569;
+    FFT_V t570, t571, t572, t573, t574, t575, t576, t577, t578, t579;
+    FFT_V t580, t581, t582, t583, t584, t585, t586, t587, t588, t589;
+    FFT_V t590, t591, t592, t593, t594, t595, t596, t597, t598, t599;
+    FFT_V t600, t601, t602, t603, t604, t605, t606, t607, t608, t609;
+    FFT_V t610, t611, t612, t613, t614, t615, t616, t617, t618, t619;
+    FFT_V t620, t621, t622, t623, t624, t625, t626, t627, t628, t629;
+    FFT_V t630, t631, t632, t633, t634, t635, t636, t637, t638, t639;
+    FFT_V t640, t641, t642, t643, t644, t645, t646, t647, t648, t649;
+    FFT_V t650, t651, t652, t653, t654, t655, t656, t657, t658, t659;
+    FFT_V t660, t661, t662, t663, t664, t665, t666, t667, t668, t669;
+    FFT_V t670, t671, t672, t673, t674, t675, t676, t677, t678, t679;
+    FFT_V t680, t681, t682, t683, t684, t685, t686, t687, t688, t689;
+    FFT_V t690, t691, t692, t693, t694, t695, t696, t697, t698, t699;
+    FFT_V t700, t701, t702, t703, t704, t705, t706, t707, t708, t709;
+    FFT_V t710, t711, t712, t713, t714, t715, t716, t717, t718, t719;
+    FFT_V t720, t721, t722, t723, t724, t725, t726, t727, t728, t729;
+    FFT_V t730, t731, t732, t733, t734, t735, t736, t737, t738, t739;
+    FFT_V t740, t741, t742, t743, t744, t745, t746, t747, t748, t749;
+    FFT_V t750, t751, t752, t753, t754, t755, t756, t757, t758, t759;
+    FFT_V t760, t761, t762, t763, t764, t765, t766, t767, t768, t769;
+    FFT_V t770, t771, t772, t773, t774, t775, t776, t777, t778, t779;
+    FFT_V t780, t781, t782, t783, t784, t785, t786, t787, t788, t789;
+    FFT_V t790, t791, t792, t793, t794, t795, t796, t797, t798, t799;
+    FFT_V t800, t801, t802, t803, t804, t805, t806, t807, t808, t809;
+    FFT_V t810, t811, t812, t813, t814, t815, t816, t817, t818, t819;
+    FFT_V t820, t821, t822, t823, t824, t825, t826, t827, t828, t829;
+    FFT_V t830, t831, t832, t833, t834, t835, t836, t837, t838, t839;
+    FFT_V t840, t841, t842, t843, t844, t845, t846, t847, t848, t849;
+    FFT_V t850, t851, t852, t853, t854, t855, t856, t857;
+
+    t0 = FFT_VADD(a[42], a[7]);
+    t1 = FFT_VADD(a[14], a[35]);
+    t2 = FFT_VADD(a[21], a[28]);
+    t3 = FFT_VSUB(a[7], a[42]);
+    t4 = FFT_VMULNJ(t3);
+    t5 = FFT_VSUB(a[14], a[35]);
+    t6 = FFT_VMULNJ(t5);
+    t7 = FFT_VSUB(a[21], a[28]);
+    t8 = FFT_VMULNJ(t7);
+    t9 = FFT_VADD(a[0], t0);
+    t10 = FFT_VADD(t1, t9);
+    t11 = FFT_VADD(t10, t2);
+    t12 = FFT_VSCL(t0, 0.6234898018587336);
+    t13 = FFT_VSCL(t1, 0.22252093395631434);
+    t14 = FFT_VSCL(t2, 0.900968867902419);
+    t15 = FFT_VADD(a[0], t12);
+    t16 = FFT_VSUB(t15, t13);
+    t17 = FFT_VSUB(t16, t14);
+    t18 = FFT_VSCL(t4, 0.7818314824680298);
+    t19 = FFT_VSCL(t6, 0.9749279121818236);
+    t20 = FFT_VSCL(t8, 0.43388373911755823);
+    t21 = FFT_VADD(t18, t19);
+    t22 = FFT_VADD(t20, t21);
+    t23 = FFT_VADD(t17, t22);
+    t24 = FFT_VSUB(t17, t22);
+    t25 = FFT_VSCL(t0, 0.22252093395631434);
+    t26 = FFT_VSCL(t1, 0.900968867902419);
+    t27 = FFT_VSCL(t2, 0.6234898018587336);
+    t28 = FFT_VSUB(a[0], t25);
+    t29 = FFT_VSUB(t28, t26);
+    t30 = FFT_VADD(t27, t29);
+    t31 = FFT_VSCL(t4, 0.9749279121818236);
+    t32 = FFT_VSCL(t6, 0.43388373911755823);
+    t33 = FFT_VSCL(t8, 0.7818314824680298);
+    t34 = FFT_VSUB(t31, t32);
+    t35 = FFT_VSUB(t34, t33);
+    t36 = FFT_VADD(t30, t35);
+    t37 = FFT_VSUB(t30, t35);
+    t38 = FFT_VSCL(t0, 0.900968867902419);
+    t39 = FFT_VSCL(t1, 0.6234898018587336);
+    t40 = FFT_VSCL(t2, 0.22252093395631434);
+    t41 = FFT_VSUB(a[0], t38);
+    t42 = FFT_VADD(t39, t41);
+    t43 = FFT_VSUB(t42, t40);
+    t44 = FFT_VSCL(t4, 0.43388373911755823);
+    t45 = FFT_VSCL(t6, 0.7818314824680298);
+    t46 = FFT_VSCL(t8, 0.9749279121818236);
+    t47 = FFT_VSUB(t44, t45);
+    t48 = FFT_VADD(t46, t47);
+    t49 = FFT_VADD(t43, t48);
+    t50 = FFT_VSUB(t43, t48);
+    t51 = FFT_VADD(a[43], a[8]);
+    t52 = FFT_VADD(a[15], a[36]);
+    t53 = FFT_VADD(a[22], a[29]);
+    t54 = FFT_VSUB(a[8], a[43]);
+    t55 = FFT_VMULNJ(t54);
+    t56 = FFT_VSUB(a[15], a[36]);
+    t57 = FFT_VMULNJ(t56);
+    t58 = FFT_VSUB(a[22], a[29]);
+    t59 = FFT_VMULNJ(t58);
+    t60 = FFT_VADD(a[1], t51);
+    t61 = FFT_VADD(t52, t60);
+    t62 = FFT_VADD(t53, t61);
+    t63 = FFT_VSCL(t51, 0.6234898018587336);
+    t64 = FFT_VSCL(t52, 0.22252093395631434);
+    t65 = FFT_VSCL(t53, 0.900968867902419);
+    t66 = FFT_VADD(a[1], t63);
+    t67 = FFT_VSUB(t66, t64);
+    t68 = FFT_VSUB(t67, t65);
+    t69 = FFT_VSCL(t55, 0.7818314824680298);
+    t70 = FFT_VSCL(t57, 0.9749279121818236);
+    t71 = FFT_VSCL(t59, 0.43388373911755823);
+    t72 = FFT_VADD(t69, t70);
+    t73 = FFT_VADD(t71, t72);
+    t74 = FFT_VADD(t68, t73);
+    t75 = FFT_VSUB(t68, t73);
+    t76 = FFT_VSCL(t51, 0.22252093395631434);
+    t77 = FFT_VSCL(t52, 0.900968867902419);
+    t78 = FFT_VSCL(t53, 0.6234898018587336);
+    t79 = FFT_VSUB(a[1], t76);
+    t80 = FFT_VSUB(t79, t77);
+    t81 = FFT_VADD(t78, t80);
+    t82 = FFT_VSCL(t55, 0.9749279121818236);
+    t83 = FFT_VSCL(t57, 0.43388373911755823);
+    t84 = FFT_VSCL(t59, 0.7818314824680298);
+    t85 = FFT_VSUB(t82, t83);
+    t86 = FFT_VSUB(t85, t84);
+    t87 = FFT_VADD(t81, t86);
+    t88 = FFT_VSUB(t81, t86);
+    t89 = FFT_VSCL(t51, 0.900968867902419);
+    t90 = FFT_VSCL(t52, 0.6234898018587336);
+    t91 = FFT_VSCL(t53, 0.22252093395631434);
+    t92 = FFT_VSUB(a[1], t89);
+    t93 = FFT_VADD(t90, t92);
+    t94 = FFT_VSUB(t93, t91);
+    t95 = FFT_VSCL(t55, 0.43388373911755823);
+    t96 = FFT_VSCL(t57, 0.7818314824680298);
+    t97 = FFT_VSCL(t59, 0.9749279121818236);
+    t98 = FFT_VSUB(t95, t96);
+    t99 = FFT_VADD(t97, t98);
+    t100 = FFT_VADD(t94, t99);
+    t101 = FFT_VSUB(t94, t99);
+    t102 = FFT_VADD(a[44], a[9]);
+    t103 = FFT_VADD(a[16], a[37]);
+    t104 = FFT_VADD(a[23], a[30]);
+    t105 = FFT_VSUB(a[9], a[44]);
+    t106 = FFT_VMULNJ(t105);
+    t107 = FFT_VSUB(a[16], a[37]);
+    t108 = FFT_VMULNJ(t107);
+    t109 = FFT_VSUB(a[23], a[30]);
+    t110 = FFT_VMULNJ(t109);
+    t111 = FFT_VADD(a[2], t102);
+    t112 = FFT_VADD(t103, t111);
+    t113 = FFT_VADD(t104, t112);
+    t114 = FFT_VSCL(t102, 0.6234898018587336);
+    t115 = FFT_VSCL(t103, 0.22252093395631434);
+    t116 = FFT_VSCL(t104, 0.900968867902419);
+    t117 = FFT_VADD(a[2], t114);
+    t118 = FFT_VSUB(t117, t115);
+    t119 = FFT_VSUB(t118, t116);
+    t120 = FFT_VSCL(t106, 0.7818314824680298);
+    t121 = FFT_VSCL(t108, 0.9749279121818236);
+    t122 = FFT_VSCL(t110, 0.43388373911755823);
+    t123 = FFT_VADD(t120, t121);
+    t124 = FFT_VADD(t122, t123);
+    t125 = FFT_VADD(t119, t124);
+    t126 = FFT_VSUB(t119, t124);
+    t127 = FFT_VSCL(t102, 0.22252093395631434);
+    t128 = FFT_VSCL(t103, 0.900968867902419);
+    t129 = FFT_VSCL(t104, 0.6234898018587336);
+    t130 = FFT_VSUB(a[2], t127);
+    t131 = FFT_VSUB(t130, t128);
+    t132 = FFT_VADD(t129, t131);
+    t133 = FFT_VSCL(t106, 0.9749279121818236);
+    t134 = FFT_VSCL(t108, 0.43388373911755823);
+    t135 = FFT_VSCL(t110, 0.7818314824680298);
+    t136 = FFT_VSUB(t133, t134);
+    t137 = FFT_VSUB(t136, t135);
+    t138 = FFT_VADD(t132, t137);
+    t139 = FFT_VSUB(t132, t137);
+    t140 = FFT_VSCL(t102, 0.900968867902419);
+    t141 = FFT_VSCL(t103, 0.6234898018587336);
+    t142 = FFT_VSCL(t104, 0.22252093395631434);
+    t143 = FFT_VSUB(a[2], t140);
+    t144 = FFT_VADD(t141, t143);
+    t145 = FFT_VSUB(t144, t142);
+    t146 = FFT_VSCL(t106, 0.43388373911755823);
+    t147 = FFT_VSCL(t108, 0.7818314824680298);
+    t148 = FFT_VSCL(t110, 0.9749279121818236);
+    t149 = FFT_VSUB(t146, t147);
+    t150 = FFT_VADD(t148, t149);
+    t151 = FFT_VADD(t145, t150);
+    t152 = FFT_VSUB(t145, t150);
+    t153 = FFT_VADD(a[10], a[45]);
+    t154 = FFT_VADD(a[17], a[38]);
+    t155 = FFT_VADD(a[24], a[31]);
+    t156 = FFT_VSUB(a[10], a[45]);
+    t157 = FFT_VMULNJ(t156);
+    t158 = FFT_VSUB(a[17], a[38]);
+    t159 = FFT_VMULNJ(t158);
+    t160 = FFT_VSUB(a[24], a[31]);
+    t161 = FFT_VMULNJ(t160);
+    t162 = FFT_VADD(a[3], t153);
+    t163 = FFT_VADD(t154, t162);
+    t164 = FFT_VADD(t155, t163);
+    t165 = FFT_VSCL(t153, 0.6234898018587336);
+    t166 = FFT_VSCL(t154, 0.22252093395631434);
+    t167 = FFT_VSCL(t155, 0.900968867902419);
+    t168 = FFT_VADD(a[3], t165);
+    t169 = FFT_VSUB(t168, t166);
+    t170 = FFT_VSUB(t169, t167);
+    t171 = FFT_VSCL(t157, 0.7818314824680298);
+    t172 = FFT_VSCL(t159, 0.9749279121818236);
+    t173 = FFT_VSCL(t161, 0.43388373911755823);
+    t174 = FFT_VADD(t171, t172);
+    t175 = FFT_VADD(t173, t174);
+    t176 = FFT_VADD(t170, t175);
+    t177 = FFT_VSUB(t170, t175);
+    t178 = FFT_VSCL(t153, 0.22252093395631434);
+    t179 = FFT_VSCL(t154, 0.900968867902419);
+    t180 = FFT_VSCL(t155, 0.6234898018587336);
+    t181 = FFT_VSUB(a[3], t178);
+    t182 = FFT_VSUB(t181, t179);
+    t183 = FFT_VADD(t180, t182);
+    t184 = FFT_VSCL(t157, 0.9749279121818236);
+    t185 = FFT_VSCL(t159, 0.43388373911755823);
+    t186 = FFT_VSCL(t161, 0.7818314824680298);
+    t187 = FFT_VSUB(t184, t185);
+    t188 = FFT_VSUB(t187, t186);
+    t189 = FFT_VADD(t183, t188);
+    t190 = FFT_VSUB(t183, t188);
+    t191 = FFT_VSCL(t153, 0.900968867902419);
+    t192 = FFT_VSCL(t154, 0.6234898018587336);
+    t193 = FFT_VSCL(t155, 0.22252093395631434);
+    t194 = FFT_VSUB(a[3], t191);
+    t195 = FFT_VADD(t192, t194);
+    t196 = FFT_VSUB(t195, t193);
+    t197 = FFT_VSCL(t157, 0.43388373911755823);
+    t198 = FFT_VSCL(t159, 0.7818314824680298);
+    t199 = FFT_VSCL(t161, 0.9749279121818236);
+    t200 = FFT_VSUB(t197, t198);
+    t201 = FFT_VADD(t199, t200);
+    t202 = FFT_VADD(t196, t201);
+    t203 = FFT_VSUB(t196, t201);
+    t204 = FFT_VADD(a[11], a[46]);
+    t205 = FFT_VADD(a[18], a[39]);
+    t206 = FFT_VADD(a[25], a[32]);
+    t207 = FFT_VSUB(a[11], a[46]);
+    t208 = FFT_VMULNJ(t207);
+    t209 = FFT_VSUB(a[18], a[39]);
+    t210 = FFT_VMULNJ(t209);
+    t211 = FFT_VSUB(a[25], a[32]);
+    t212 = FFT_VMULNJ(t211);
+    t213 = FFT_VADD(a[4], t204);
+    t214 = FFT_VADD(t205, t213);
+    t215 = FFT_VADD(t206, t214);
+    t216 = FFT_VSCL(t204, 0.6234898018587336);
+    t217 = FFT_VSCL(t205, 0.22252093395631434);
+    t218 = FFT_VSCL(t206, 0.900968867902419);
+    t219 = FFT_VADD(a[4], t216);
+    t220 = FFT_VSUB(t219, t217);
+    t221 = FFT_VSUB(t220, t218);
+    t222 = FFT_VSCL(t208, 0.7818314824680298);
+    t223 = FFT_VSCL(t210, 0.9749279121818236);
+    t224 = FFT_VSCL(t212, 0.43388373911755823);
+    t225 = FFT_VADD(t222, t223);
+    t226 = FFT_VADD(t224, t225);
+    t227 = FFT_VADD(t221, t226);
+    t228 = FFT_VSUB(t221, t226);
+    t229 = FFT_VSCL(t204, 0.22252093395631434);
+    t230 = FFT_VSCL(t205, 0.900968867902419);
+    t231 = FFT_VSCL(t206, 0.6234898018587336);
+    t232 = FFT_VSUB(a[4], t229);
+    t233 = FFT_VSUB(t232, t230);
+    t234 = FFT_VADD(t231, t233);
+    t235 = FFT_VSCL(t208, 0.9749279121818236);
+    t236 = FFT_VSCL(t210, 0.43388373911755823);
+    t237 = FFT_VSCL(t212, 0.7818314824680298);
+    t238 = FFT_VSUB(t235, t236);
+    t239 = FFT_VSUB(t238, t237);
+    t240 = FFT_VADD(t234, t239);
+    t241 = FFT_VSUB(t234, t239);
+    t242 = FFT_VSCL(t204, 0.900968867902419);
+    t243 = FFT_VSCL(t205, 0.6234898018587336);
+    t244 = FFT_VSCL(t206, 0.22252093395631434);
+    t245 = FFT_VSUB(a[4], t242);
+    t246 = FFT_VADD(t243, t245);
+    t247 = FFT_VSUB(t246, t244);
+    t248 = FFT_VSCL(t208, 0.43388373911755823);
+    t249 = FFT_VSCL(t210, 0.7818314824680298);
+    t250 = FFT_VSCL(t212, 0.9749279121818236);
+    t251 = FFT_VSUB(t248, t249);
+    t252 = FFT_VADD(t250, t251);
+    t253 = FFT_VADD(t247, t252);
+    t254 = FFT_VSUB(t247, t252);
+    t255 = FFT_VADD(a[12], a[47]);
+    t256 = FFT_VADD(a[19], a[40]);
+    t257 = FFT_VADD(a[26], a[33]);
+    t258 = FFT_VSUB(a[12], a[47]);
+    t259 = FFT_VMULNJ(t258);
+    t260 = FFT_VSUB(a[19], a[40]);
+    t261 = FFT_VMULNJ(t260);
+    t262 = FFT_VSUB(a[26], a[33]);
+    t263 = FFT_VMULNJ(t262);
+    t264 = FFT_VADD(a[5], t255);
+    t265 = FFT_VADD(t256, t264);
+    t266 = FFT_VADD(t257, t265);
+    t267 = FFT_VSCL(t255, 0.6234898018587336);
+    t268 = FFT_VSCL(t256, 0.22252093395631434);
+    t269 = FFT_VSCL(t257, 0.900968867902419);
+    t270 = FFT_VADD(a[5], t267);
+    t271 = FFT_VSUB(t270, t268);
+    t272 = FFT_VSUB(t271, t269);
+    t273 = FFT_VSCL(t259, 0.7818314824680298);
+    t274 = FFT_VSCL(t261, 0.9749279121818236);
+    t275 = FFT_VSCL(t263, 0.43388373911755823);
+    t276 = FFT_VADD(t273, t274);
+    t277 = FFT_VADD(t275, t276);
+    t278 = FFT_VADD(t272, t277);
+    t279 = FFT_VSUB(t272, t277);
+    t280 = FFT_VSCL(t255, 0.22252093395631434);
+    t281 = FFT_VSCL(t256, 0.900968867902419);
+    t282 = FFT_VSCL(t257, 0.6234898018587336);
+    t283 = FFT_VSUB(a[5], t280);
+    t284 = FFT_VSUB(t283, t281);
+    t285 = FFT_VADD(t282, t284);
+    t286 = FFT_VSCL(t259, 0.9749279121818236);
+    t287 = FFT_VSCL(t261, 0.43388373911755823);
+    t288 = FFT_VSCL(t263, 0.7818314824680298);
+    t289 = FFT_VSUB(t286, t287);
+    t290 = FFT_VSUB(t289, t288);
+    t291 = FFT_VADD(t285, t290);
+    t292 = FFT_VSUB(t285, t290);
+    t293 = FFT_VSCL(t255, 0.900968867902419);
+    t294 = FFT_VSCL(t256, 0.6234898018587336);
+    t295 = FFT_VSCL(t257, 0.22252093395631434);
+    t296 = FFT_VSUB(a[5], t293);
+    t297 = FFT_VADD(t294, t296);
+    t298 = FFT_VSUB(t297, t295);
+    t299 = FFT_VSCL(t259, 0.43388373911755823);
+    t300 = FFT_VSCL(t261, 0.7818314824680298);
+    t301 = FFT_VSCL(t263, 0.9749279121818236);
+    t302 = FFT_VSUB(t299, t300);
+    t303 = FFT_VADD(t301, t302);
+    t304 = FFT_VADD(t298, t303);
+    t305 = FFT_VSUB(t298, t303);
+    t306 = FFT_VADD(a[13], a[48]);
+    t307 = FFT_VADD(a[20], a[41]);
+    t308 = FFT_VADD(a[27], a[34]);
+    t309 = FFT_VSUB(a[13], a[48]);
+    t310 = FFT_VMULNJ(t309);
+    t311 = FFT_VSUB(a[20], a[41]);
+    t312 = FFT_VMULNJ(t311);
+    t313 = FFT_VSUB(a[27], a[34]);
+    t314 = FFT_VMULNJ(t313);
+    t315 = FFT_VADD(a[6], t306);
+    t316 = FFT_VADD(t307, t315);
+    t317 = FFT_VADD(t308, t316);
+    t318 = FFT_VSCL(t306, 0.6234898018587336);
+    t319 = FFT_VSCL(t307, 0.22252093395631434);
+    t320 = FFT_VSCL(t308, 0.900968867902419);
+    t321 = FFT_VADD(a[6], t318);
+    t322 = FFT_VSUB(t321, t319);
+    t323 = FFT_VSUB(t322, t320);
+    t324 = FFT_VSCL(t310, 0.7818314824680298);
+    t325 = FFT_VSCL(t312, 0.9749279121818236);
+    t326 = FFT_VSCL(t314, 0.43388373911755823);
+    t327 = FFT_VADD(t324, t325);
+    t328 = FFT_VADD(t326, t327);
+    t329 = FFT_VADD(t323, t328);
+    t330 = FFT_VSUB(t323, t328);
+    t331 = FFT_VSCL(t306, 0.22252093395631434);
+    t332 = FFT_VSCL(t307, 0.900968867902419);
+    t333 = FFT_VSCL(t308, 0.6234898018587336);
+    t334 = FFT_VSUB(a[6], t331);
+    t335 = FFT_VSUB(t334, t332);
+    t336 = FFT_VADD(t333, t335);
+    t337 = FFT_VSCL(t310, 0.9749279121818236);
+    t338 = FFT_VSCL(t312, 0.43388373911755823);
+    t339 = FFT_VSCL(t314, 0.7818314824680298);
+    t340 = FFT_VSUB(t337, t338);
+    t341 = FFT_VSUB(t340, t339);
+    t342 = FFT_VADD(t336, t341);
+    t343 = FFT_VSUB(t336, t341);
+    t344 = FFT_VSCL(t306, 0.900968867902419);
+    t345 = FFT_VSCL(t307, 0.6234898018587336);
+    t346 = FFT_VSCL(t308, 0.22252093395631434);
+    t347 = FFT_VSUB(a[6], t344);
+    t348 = FFT_VADD(t345, t347);
+    t349 = FFT_VSUB(t348, t346);
+    t350 = FFT_VSCL(t310, 0.43388373911755823);
+    t351 = FFT_VSCL(t312, 0.7818314824680298);
+    t352 = FFT_VSCL(t314, 0.9749279121818236);
+    t353 = FFT_VSUB(t350, t351);
+    t354 = FFT_VADD(t352, t353);
+    t355 = FFT_VADD(t349, t354);
+    t356 = FFT_VSUB(t349, t354);
+    t357 = FFT_VADD(t317, t62);
+    t358 = FFT_VADD(t113, t266);
+    t359 = FFT_VADD(t164, t215);
+    t360 = FFT_VSUB(t62, t317);
+    t361 = FFT_VMULNJ(t360);
+    t362 = FFT_VSUB(t113, t266);
+    t363 = FFT_VMULNJ(t362);
+    t364 = FFT_VSUB(t164, t215);
+    t365 = FFT_VMULNJ(t364);
+    t366 = FFT_VADD(t11, t357);
+    t367 = FFT_VADD(t358, t366);
+    t368 = FFT_VADD(t359, t367);
+    t369 = FFT_VSCL(t357, 0.6234898018587336);
+    t370 = FFT_VSCL(t358, 0.22252093395631434);
+    t371 = FFT_VSCL(t359, 0.900968867902419);
+    t372 = FFT_VADD(t11, t369);
+    t373 = FFT_VSUB(t372, t370);
+    t374 = FFT_VSUB(t373, t371);
+    t375 = FFT_VSCL(t361, 0.7818314824680298);
+    t376 = FFT_VSCL(t363, 0.9749279121818236);
+    t377 = FFT_VSCL(t365, 0.43388373911755823);
+    t378 = FFT_VADD(t375, t376);
+    t379 = FFT_VADD(t377, t378);
+    t380 = FFT_VADD(t374, t379);
+    t381 = FFT_VSUB(t374, t379);
+    t382 = FFT_VSCL(t357, 0.22252093395631434);
+    t383 = FFT_VSCL(t358, 0.900968867902419);
+    t384 = FFT_VSCL(t359, 0.6234898018587336);
+    t385 = FFT_VSUB(t11, t382);
+    t386 = FFT_VSUB(t385, t383);
+    t387 = FFT_VADD(t384, t386);
+    t388 = FFT_VSCL(t361, 0.9749279121818236);
+    t389 = FFT_VSCL(t363, 0.43388373911755823);
+    t390 = FFT_VSCL(t365, 0.7818314824680298);
+    t391 = FFT_VSUB(t388, t389);
+    t392 = FFT_VSUB(t391, t390);
+    t393 = FFT_VADD(t387, t392);
+    t394 = FFT_VSUB(t387, t392);
+    t395 = FFT_VSCL(t357, 0.900968867902419);
+    t396 = FFT_VSCL(t358, 0.6234898018587336);
+    t397 = FFT_VSCL(t359, 0.22252093395631434);
+    t398 = FFT_VSUB(t11, t395);
+    t399 = FFT_VADD(t396, t398);
+    t400 = FFT_VSUB(t399, t397);
+    t401 = FFT_VSCL(t361, 0.43388373911755823);
+    t402 = FFT_VSCL(t363, 0.7818314824680298);
+    t403 = FFT_VSCL(t365, 0.9749279121818236);
+    t404 = FFT_VSUB(t401, t402);
+    t405 = FFT_VADD(t403, t404);
+    t406 = FFT_VADD(t400, t405);
+    t407 = FFT_VSUB(t400, t405);
+    t408 = FFT_VSCL(t74, 0.9917900138232462);
+    t409 = FFT_VMULNJ(t74);
+    t410 = FFT_VSCL(t409, 0.127877161684506);
+    t411 = FFT_VADD(t408, t410);
+    t412 = FFT_VSCL(t125, 0.9672948630390295);
+    t413 = FFT_VMULNJ(t125);
+    t414 = FFT_VSCL(t413, 0.25365458390950735);
+    t415 = FFT_VADD(t412, t414);
+    t416 = FFT_VSCL(t176, 0.9269167573460217);
+    t417 = FFT_VMULNJ(t176);
+    t418 = FFT_VSCL(t417, 0.3752670048793741);
+    t419 = FFT_VADD(t416, t418);
+    t420 = FFT_VSCL(t227, 0.8713187041233894);
+    t421 = FFT_VMULNJ(t227);
+    t422 = FFT_VSCL(t421, 0.49071755200393785);
+    t423 = FFT_VADD(t420, t422);
+    t424 = FFT_VSCL(t278, 0.8014136218679566);
+    t425 = FFT_VMULNJ(t278);
+    t426 = FFT_VSCL(t425, 0.598110530491216);
+    t427 = FFT_VADD(t424, t426);
+    t428 = FFT_VSCL(t329, 0.7183493500977276);
+    t429 = FFT_VMULNJ(t329);
+    t430 = FFT_VSCL(t429, 0.6956825506034864);
+    t431 = FFT_VADD(t428, t430);
+    t432 = FFT_VADD(t411, t431);
+    t433 = FFT_VADD(t415, t427);
+    t434 = FFT_VADD(t419, t423);
+    t435 = FFT_VSUB(t411, t431);
+    t436 = FFT_VMULNJ(t435);
+    t437 = FFT_VSUB(t415, t427);
+    t438 = FFT_VMULNJ(t437);
+    t439 = FFT_VSUB(t419, t423);
+    t440 = FFT_VMULNJ(t439);
+    t441 = FFT_VADD(t23, t432);
+    t442 = FFT_VADD(t433, t441);
+    t443 = FFT_VADD(t434, t442);
+    t444 = FFT_VSCL(t432, 0.6234898018587336);
+    t445 = FFT_VSCL(t433, 0.22252093395631434);
+    t446 = FFT_VSCL(t434, 0.900968867902419);
+    t447 = FFT_VADD(t23, t444);
+    t448 = FFT_VSUB(t447, t445);
+    t449 = FFT_VSUB(t448, t446);
+    t450 = FFT_VSCL(t436, 0.7818314824680298);
+    t451 = FFT_VSCL(t438, 0.9749279121818236);
+    t452 = FFT_VSCL(t440, 0.43388373911755823);
+    t453 = FFT_VADD(t450, t451);
+    t454 = FFT_VADD(t452, t453);
+    t455 = FFT_VADD(t449, t454);
+    t456 = FFT_VSUB(t449, t454);
+    t457 = FFT_VSCL(t432, 0.22252093395631434);
+    t458 = FFT_VSCL(t433, 0.900968867902419);
+    t459 = FFT_VSCL(t434, 0.6234898018587336);
+    t460 = FFT_VSUB(t23, t457);
+    t461 = FFT_VSUB(t460, t458);
+    t462 = FFT_VADD(t459, t461);
+    t463 = FFT_VSCL(t436, 0.9749279121818236);
+    t464 = FFT_VSCL(t438, 0.43388373911755823);
+    t465 = FFT_VSCL(t440, 0.7818314824680298);
+    t466 = FFT_VSUB(t463, t464);
+    t467 = FFT_VSUB(t466, t465);
+    t468 = FFT_VADD(t462, t467);
+    t469 = FFT_VSUB(t462, t467);
+    t470 = FFT_VSCL(t432, 0.900968867902419);
+    t471 = FFT_VSCL(t433, 0.6234898018587336);
+    t472 = FFT_VSCL(t434, 0.22252093395631434);
+    t473 = FFT_VSUB(t23, t470);
+    t474 = FFT_VADD(t471, t473);
+    t475 = FFT_VSUB(t474, t472);
+    t476 = FFT_VSCL(t436, 0.43388373911755823);
+    t477 = FFT_VSCL(t438, 0.7818314824680298);
+    t478 = FFT_VSCL(t440, 0.9749279121818236);
+    t479 = FFT_VSUB(t476, t477);
+    t480 = FFT_VADD(t478, t479);
+    t481 = FFT_VADD(t475, t480);
+    t482 = FFT_VSUB(t475, t480);
+    t483 = FFT_VSCL(t87, 0.9672948630390295);
+    t484 = FFT_VMULNJ(t87);
+    t485 = FFT_VSCL(t484, 0.25365458390950735);
+    t486 = FFT_VADD(t483, t485);
+    t487 = FFT_VSCL(t138, 0.8713187041233894);
+    t488 = FFT_VMULNJ(t138);
+    t489 = FFT_VSCL(t488, 0.49071755200393785);
+    t490 = FFT_VADD(t487, t489);
+    t491 = FFT_VSCL(t189, 0.7183493500977276);
+    t492 = FFT_VMULNJ(t189);
+    t493 = FFT_VSCL(t492, 0.6956825506034864);
+    t494 = FFT_VADD(t491, t493);
+    t495 = FFT_VSCL(t240, 0.5183925683105252);
+    t496 = FFT_VMULNJ(t240);
+    t497 = FFT_VSCL(t496, 0.8551427630053461);
+    t498 = FFT_VADD(t495, t497);
+    t499 = FFT_VSCL(t291, 0.28452758663103245);
+    t500 = FFT_VMULNJ(t291);
+    t501 = FFT_VSCL(t500, 0.9586678530366606);
+    t502 = FFT_VADD(t499, t501);
+    t503 = FFT_VSCL(t342, 0.03205157757165533);
+    t504 = FFT_VMULNJ(t342);
+    t505 = FFT_VSCL(t504, 0.9994862162006879);
+    t506 = FFT_VADD(t503, t505);
+    t507 = FFT_VADD(t486, t506);
+    t508 = FFT_VADD(t490, t502);
+    t509 = FFT_VADD(t494, t498);
+    t510 = FFT_VSUB(t486, t506);
+    t511 = FFT_VMULNJ(t510);
+    t512 = FFT_VSUB(t490, t502);
+    t513 = FFT_VMULNJ(t512);
+    t514 = FFT_VSUB(t494, t498);
+    t515 = FFT_VMULNJ(t514);
+    t516 = FFT_VADD(t36, t507);
+    t517 = FFT_VADD(t508, t516);
+    t518 = FFT_VADD(t509, t517);
+    t519 = FFT_VSCL(t507, 0.6234898018587336);
+    t520 = FFT_VSCL(t508, 0.22252093395631434);
+    t521 = FFT_VSCL(t509, 0.900968867902419);
+    t522 = FFT_VADD(t36, t519);
+    t523 = FFT_VSUB(t522, t520);
+    t524 = FFT_VSUB(t523, t521);
+    t525 = FFT_VSCL(t511, 0.7818314824680298);
+    t526 = FFT_VSCL(t513, 0.9749279121818236);
+    t527 = FFT_VSCL(t515, 0.43388373911755823);
+    t528 = FFT_VADD(t525, t526);
+    t529 = FFT_VADD(t527, t528);
+    t530 = FFT_VADD(t524, t529);
+    t531 = FFT_VSUB(t524, t529);
+    t532 = FFT_VSCL(t507, 0.22252093395631434);
+    t533 = FFT_VSCL(t508, 0.900968867902419);
+    t534 = FFT_VSCL(t509, 0.6234898018587336);
+    t535 = FFT_VSUB(t36, t532);
+    t536 = FFT_VSUB(t535, t533);
+    t537 = FFT_VADD(t534, t536);
+    t538 = FFT_VSCL(t511, 0.9749279121818236);
+    t539 = FFT_VSCL(t513, 0.43388373911755823);
+    t540 = FFT_VSCL(t515, 0.7818314824680298);
+    t541 = FFT_VSUB(t538, t539);
+    t542 = FFT_VSUB(t541, t540);
+    t543 = FFT_VADD(t537, t542);
+    t544 = FFT_VSUB(t537, t542);
+    t545 = FFT_VSCL(t507, 0.900968867902419);
+    t546 = FFT_VSCL(t508, 0.6234898018587336);
+    t547 = FFT_VSCL(t509, 0.22252093395631434);
+    t548 = FFT_VSUB(t36, t545);
+    t549 = FFT_VADD(t546, t548);
+    t550 = FFT_VSUB(t549, t547);
+    t551 = FFT_VSCL(t511, 0.43388373911755823);
+    t552 = FFT_VSCL(t513, 0.7818314824680298);
+    t553 = FFT_VSCL(t515, 0.9749279121818236);
+    t554 = FFT_VSUB(t551, t552);
+    t555 = FFT_VADD(t553, t554);
+    t556 = FFT_VADD(t550, t555);
+    t557 = FFT_VSUB(t550, t555);
+    t558 = FFT_VSCL(t100, 0.9269167573460217);
+    t559 = FFT_VMULNJ(t100);
+    t560 = FFT_VSCL(t559, 0.3752670048793741);
+    t561 = FFT_VADD(t558, t560);
+    t562 = FFT_VSCL(t151, 0.7183493500977276);
+    t563 = FFT_VMULNJ(t151);
+    t564 = FFT_VSCL(t563, 0.6956825506034864);
+    t565 = FFT_VADD(t562, t564);
+    t566 = FFT_VSCL(t202, 0.4047833431223938);
+    t567 = FFT_VMULNJ(t202);
+    t568 = FFT_VSCL(t567, 0.9144126230158125);
+    t569 = FFT_VADD(t566, t568);
+    t570 = FFT_VSCL(t253, 0.03205157757165533);
+    t571 = FFT_VMULNJ(t253);
+    t572 = FFT_VSCL(t571, 0.9994862162006879);
+    t573 = FFT_VADD(t570, t572);
+    t574 = FFT_VSCL(t304, 0.3453650544213075);
+    t575 = FFT_VMULNJ(t304);
+    t576 = FFT_VSCL(t575, 0.9384684220497604);
+    t577 = FFT_VSUB(t576, t574);
+    t578 = FFT_VSCL(t355, 0.6723008902613169);
+    t579 = FFT_VMULNJ(t355);
+    t580 = FFT_VSCL(t579, 0.7402779970753155);
+    t581 = FFT_VSUB(t580, t578);
+    t582 = FFT_VADD(t561, t581);
+    t583 = FFT_VADD(t565, t577);
+    t584 = FFT_VADD(t569, t573);
+    t585 = FFT_VSUB(t561, t581);
+    t586 = FFT_VMULNJ(t585);
+    t587 = FFT_VSUB(t565, t577);
+    t588 = FFT_VMULNJ(t587);
+    t589 = FFT_VSUB(t569, t573);
+    t590 = FFT_VMULNJ(t589);
+    t591 = FFT_VADD(t49, t582);
+    t592 = FFT_VADD(t583, t591);
+    t593 = FFT_VADD(t584, t592);
+    t594 = FFT_VSCL(t582, 0.6234898018587336);
+    t595 = FFT_VSCL(t583, 0.22252093395631434);
+    t596 = FFT_VSCL(t584, 0.900968867902419);
+    t597 = FFT_VADD(t49, t594);
+    t598 = FFT_VSUB(t597, t595);
+    t599 = FFT_VSUB(t598, t596);
+    t600 = FFT_VSCL(t586, 0.7818314824680298);
+    t601 = FFT_VSCL(t588, 0.9749279121818236);
+    t602 = FFT_VSCL(t590, 0.43388373911755823);
+    t603 = FFT_VADD(t600, t601);
+    t604 = FFT_VADD(t602, t603);
+    t605 = FFT_VADD(t599, t604);
+    t606 = FFT_VSUB(t599, t604);
+    t607 = FFT_VSCL(t582, 0.22252093395631434);
+    t608 = FFT_VSCL(t583, 0.900968867902419);
+    t609 = FFT_VSCL(t584, 0.6234898018587336);
+    t610 = FFT_VSUB(t49, t607);
+    t611 = FFT_VSUB(t610, t608);
+    t612 = FFT_VADD(t609, t611);
+    t613 = FFT_VSCL(t586, 0.9749279121818236);
+    t614 = FFT_VSCL(t588, 0.43388373911755823);
+    t615 = FFT_VSCL(t590, 0.7818314824680298);
+    t616 = FFT_VSUB(t613, t614);
+    t617 = FFT_VSUB(t616, t615);
+    t618 = FFT_VADD(t612, t617);
+    t619 = FFT_VSUB(t612, t617);
+    t620 = FFT_VSCL(t582, 0.900968867902419);
+    t621 = FFT_VSCL(t583, 0.6234898018587336);
+    t622 = FFT_VSCL(t584, 0.22252093395631434);
+    t623 = FFT_VSUB(t49, t620);
+    t624 = FFT_VADD(t621, t623);
+    t625 = FFT_VSUB(t624, t622);
+    t626 = FFT_VSCL(t586, 0.43388373911755823);
+    t627 = FFT_VSCL(t588, 0.7818314824680298);
+    t628 = FFT_VSCL(t590, 0.9749279121818236);
+    t629 = FFT_VSUB(t626, t627);
+    t630 = FFT_VADD(t628, t629);
+    t631 = FFT_VADD(t625, t630);
+    t632 = FFT_VSUB(t625, t630);
+    t633 = FFT_VSCL(t101, 0.8713187041233894);
+    t634 = FFT_VMULNJ(t101);
+    t635 = FFT_VSCL(t634, 0.49071755200393785);
+    t636 = FFT_VADD(t633, t635);
+    t637 = FFT_VSCL(t152, 0.5183925683105252);
+    t638 = FFT_VMULNJ(t152);
+    t639 = FFT_VSCL(t638, 0.8551427630053461);
+    t640 = FFT_VADD(t637, t639);
+    t641 = FFT_VSCL(t203, 0.03205157757165533);
+    t642 = FFT_VMULNJ(t203);
+    t643 = FFT_VSCL(t642, 0.9994862162006879);
+    t644 = FFT_VADD(t641, t643);
+    t645 = FFT_VSCL(t254, 0.4625382902408351);
+    t646 = FFT_VMULNJ(t254);
+    t647 = FFT_VSCL(t646, 0.8865993063730001);
+    t648 = FFT_VSUB(t647, t645);
+    t649 = FFT_VSCL(t305, 0.8380881048918406);
+    t650 = FFT_VMULNJ(t305);
+    t651 = FFT_VSCL(t650, 0.5455349012105487);
+    t652 = FFT_VSUB(t651, t649);
+    t653 = FFT_VSCL(t356, 0.9979453927503363);
+    t654 = FFT_VMULNJ(t356);
+    t655 = FFT_VSCL(t654, 0.06407021998071323);
+    t656 = FFT_VSUB(t655, t653);
+    t657 = FFT_VADD(t636, t656);
+    t658 = FFT_VADD(t640, t652);
+    t659 = FFT_VADD(t644, t648);
+    t660 = FFT_VSUB(t636, t656);
+    t661 = FFT_VMULNJ(t660);
+    t662 = FFT_VSUB(t640, t652);
+    t663 = FFT_VMULNJ(t662);
+    t664 = FFT_VSUB(t644, t648);
+    t665 = FFT_VMULNJ(t664);
+    t666 = FFT_VADD(t50, t657);
+    t667 = FFT_VADD(t658, t666);
+    t668 = FFT_VADD(t659, t667);
+    t669 = FFT_VSCL(t657, 0.6234898018587336);
+    t670 = FFT_VSCL(t658, 0.22252093395631434);
+    t671 = FFT_VSCL(t659, 0.900968867902419);
+    t672 = FFT_VADD(t50, t669);
+    t673 = FFT_VSUB(t672, t670);
+    t674 = FFT_VSUB(t673, t671);
+    t675 = FFT_VSCL(t661, 0.7818314824680298);
+    t676 = FFT_VSCL(t663, 0.9749279121818236);
+    t677 = FFT_VSCL(t665, 0.43388373911755823);
+    t678 = FFT_VADD(t675, t676);
+    t679 = FFT_VADD(t677, t678);
+    t680 = FFT_VADD(t674, t679);
+    t681 = FFT_VSUB(t674, t679);
+    t682 = FFT_VSCL(t657, 0.22252093395631434);
+    t683 = FFT_VSCL(t658, 0.900968867902419);
+    t684 = FFT_VSCL(t659, 0.6234898018587336);
+    t685 = FFT_VSUB(t50, t682);
+    t686 = FFT_VSUB(t685, t683);
+    t687 = FFT_VADD(t684, t686);
+    t688 = FFT_VSCL(t661, 0.9749279121818236);
+    t689 = FFT_VSCL(t663, 0.43388373911755823);
+    t690 = FFT_VSCL(t665, 0.7818314824680298);
+    t691 = FFT_VSUB(t688, t689);
+    t692 = FFT_VSUB(t691, t690);
+    t693 = FFT_VADD(t687, t692);
+    t694 = FFT_VSUB(t687, t692);
+    t695 = FFT_VSCL(t657, 0.900968867902419);
+    t696 = FFT_VSCL(t658, 0.6234898018587336);
+    t697 = FFT_VSCL(t659, 0.22252093395631434);
+    t698 = FFT_VSUB(t50, t695);
+    t699 = FFT_VADD(t696, t698);
+    t700 = FFT_VSUB(t699, t697);
+    t701 = FFT_VSCL(t661, 0.43388373911755823);
+    t702 = FFT_VSCL(t663, 0.7818314824680298);
+    t703 = FFT_VSCL(t665, 0.9749279121818236);
+    t704 = FFT_VSUB(t701, t702);
+    t705 = FFT_VADD(t703, t704);
+    t706 = FFT_VADD(t700, t705);
+    t707 = FFT_VSUB(t700, t705);
+    t708 = FFT_VSCL(t88, 0.8014136218679566);
+    t709 = FFT_VMULNJ(t88);
+    t710 = FFT_VSCL(t709, 0.598110530491216);
+    t711 = FFT_VADD(t708, t710);
+    t712 = FFT_VSCL(t139, 0.28452758663103245);
+    t713 = FFT_VMULNJ(t139);
+    t714 = FFT_VSCL(t713, 0.9586678530366606);
+    t715 = FFT_VADD(t712, t714);
+    t716 = FFT_VSCL(t190, 0.3453650544213075);
+    t717 = FFT_VMULNJ(t190);
+    t718 = FFT_VSCL(t717, 0.9384684220497604);
+    t719 = FFT_VSUB(t718, t716);
+    t720 = FFT_VSCL(t241, 0.8380881048918406);
+    t721 = FFT_VMULNJ(t241);
+    t722 = FFT_VSCL(t721, 0.5455349012105487);
+    t723 = FFT_VSUB(t722, t720);
+    t724 = FFT_VSCL(t292, 0.9979453927503363);
+    t725 = FFT_VMULNJ(t292);
+    t726 = FFT_VSCL(t725, 0.06407021998071323);
+    t727 = FFT_VADD(t724, t726);
+    t728 = FFT_VSCL(t343, 0.7614459583691342);
+    t729 = FFT_VMULNJ(t343);
+    t730 = FFT_VSCL(t729, 0.6482283953077888);
+    t731 = FFT_VADD(t728, t730);
+    t732 = FFT_VSUB(t711, t731);
+    t733 = FFT_VSUB(t715, t727);
+    t734 = FFT_VADD(t719, t723);
+    t735 = FFT_VADD(t711, t731);
+    t736 = FFT_VMULNJ(t735);
+    t737 = FFT_VADD(t715, t727);
+    t738 = FFT_VMULNJ(t737);
+    t739 = FFT_VSUB(t719, t723);
+    t740 = FFT_VMULNJ(t739);
+    t741 = FFT_VADD(t37, t732);
+    t742 = FFT_VADD(t733, t741);
+    t743 = FFT_VADD(t734, t742);
+    t744 = FFT_VSCL(t732, 0.6234898018587336);
+    t745 = FFT_VSCL(t733, 0.22252093395631434);
+    t746 = FFT_VSCL(t734, 0.900968867902419);
+    t747 = FFT_VADD(t37, t744);
+    t748 = FFT_VSUB(t747, t745);
+    t749 = FFT_VSUB(t748, t746);
+    t750 = FFT_VSCL(t736, 0.7818314824680298);
+    t751 = FFT_VSCL(t738, 0.9749279121818236);
+    t752 = FFT_VSCL(t740, 0.43388373911755823);
+    t753 = FFT_VADD(t750, t751);
+    t754 = FFT_VADD(t752, t753);
+    t755 = FFT_VADD(t749, t754);
+    t756 = FFT_VSUB(t749, t754);
+    t757 = FFT_VSCL(t732, 0.22252093395631434);
+    t758 = FFT_VSCL(t733, 0.900968867902419);
+    t759 = FFT_VSCL(t734, 0.6234898018587336);
+    t760 = FFT_VSUB(t37, t757);
+    t761 = FFT_VSUB(t760, t758);
+    t762 = FFT_VADD(t759, t761);
+    t763 = FFT_VSCL(t736, 0.9749279121818236);
+    t764 = FFT_VSCL(t738, 0.43388373911755823);
+    t765 = FFT_VSCL(t740, 0.7818314824680298);
+    t766 = FFT_VSUB(t763, t764);
+    t767 = FFT_VSUB(t766, t765);
+    t768 = FFT_VADD(t762, t767);
+    t769 = FFT_VSUB(t762, t767);
+    t770 = FFT_VSCL(t732, 0.900968867902419);
+    t771 = FFT_VSCL(t733, 0.6234898018587336);
+    t772 = FFT_VSCL(t734, 0.22252093395631434);
+    t773 = FFT_VSUB(t37, t770);
+    t774 = FFT_VADD(t771, t773);
+    t775 = FFT_VSUB(t774, t772);
+    t776 = FFT_VSCL(t736, 0.43388373911755823);
+    t777 = FFT_VSCL(t738, 0.7818314824680298);
+    t778 = FFT_VSCL(t740, 0.9749279121818236);
+    t779 = FFT_VSUB(t776, t777);
+    t780 = FFT_VADD(t778, t779);
+    t781 = FFT_VADD(t775, t780);
+    t782 = FFT_VSUB(t775, t780);
+    t783 = FFT_VSCL(t75, 0.7183493500977276);
+    t784 = FFT_VMULNJ(t75);
+    t785 = FFT_VSCL(t784, 0.6956825506034864);
+    t786 = FFT_VADD(t783, t785);
+    t787 = FFT_VSCL(t126, 0.03205157757165533);
+    t788 = FFT_VMULNJ(t126);
+    t789 = FFT_VSCL(t788, 0.9994862162006879);
+    t790 = FFT_VADD(t787, t789);
+    t791 = FFT_VSCL(t177, 0.6723008902613169);
+    t792 = FFT_VMULNJ(t177);
+    t793 = FFT_VSCL(t792, 0.7402779970753155);
+    t794 = FFT_VSUB(t793, t791);
+    t795 = FFT_VSCL(t228, 0.9979453927503363);
+    t796 = FFT_VMULNJ(t228);
+    t797 = FFT_VSCL(t796, 0.06407021998071323);
+    t798 = FFT_VSUB(t797, t795);
+    t799 = FFT_VSCL(t279, 0.7614459583691342);
+    t800 = FFT_VMULNJ(t279);
+    t801 = FFT_VSCL(t800, 0.6482283953077888);
+    t802 = FFT_VADD(t799, t801);
+    t803 = FFT_VSCL(t330, 0.09602302590768176);
+    t804 = FFT_VMULNJ(t330);
+    t805 = FFT_VSCL(t804, 0.9953791129491982);
+    t806 = FFT_VADD(t803, t805);
+    t807 = FFT_VSUB(t786, t806);
+    t808 = FFT_VSUB(t790, t802);
+    t809 = FFT_VADD(t794, t798);
+    t810 = FFT_VADD(t786, t806);
+    t811 = FFT_VMULNJ(t810);
+    t812 = FFT_VADD(t790, t802);
+    t813 = FFT_VMULNJ(t812);
+    t814 = FFT_VSUB(t794, t798);
+    t815 = FFT_VMULNJ(t814);
+    t816 = FFT_VADD(t24, t807);
+    t817 = FFT_VADD(t808, t816);
+    t818 = FFT_VADD(t809, t817);
+    t819 = FFT_VSCL(t807, 0.6234898018587336);
+    t820 = FFT_VSCL(t808, 0.22252093395631434);
+    t821 = FFT_VSCL(t809, 0.900968867902419);
+    t822 = FFT_VADD(t24, t819);
+    t823 = FFT_VSUB(t822, t820);
+    t824 = FFT_VSUB(t823, t821);
+    t825 = FFT_VSCL(t811, 0.7818314824680298);
+    t826 = FFT_VSCL(t813, 0.9749279121818236);
+    t827 = FFT_VSCL(t815, 0.43388373911755823);
+    t828 = FFT_VADD(t825, t826);
+    t829 = FFT_VADD(t827, t828);
+    t830 = FFT_VADD(t824, t829);
+    t831 = FFT_VSUB(t824, t829);
+    t832 = FFT_VSCL(t807, 0.22252093395631434);
+    t833 = FFT_VSCL(t808, 0.900968867902419);
+    t834 = FFT_VSCL(t809, 0.6234898018587336);
+    t835 = FFT_VSUB(t24, t832);
+    t836 = FFT_VSUB(t835, t833);
+    t837 = FFT_VADD(t834, t836);
+    t838 = FFT_VSCL(t811, 0.9749279121818236);
+    t839 = FFT_VSCL(t813, 0.43388373911755823);
+    t840 = FFT_VSCL(t815, 0.7818314824680298);
+    t841 = FFT_VSUB(t838, t839);
+    t842 = FFT_VSUB(t841, t840);
+    t843 = FFT_VADD(t837, t842);
+    t844 = FFT_VSUB(t837, t842);
+    t845 = FFT_VSCL(t807, 0.900968867902419);
+    t846 = FFT_VSCL(t808, 0.6234898018587336);
+    t847 = FFT_VSCL(t809, 0.22252093395631434);
+    t848 = FFT_VSUB(t24, t845);
+    t849 = FFT_VADD(t846, t848);
+    t850 = FFT_VSUB(t849, t847);
+    t851 = FFT_VSCL(t811, 0.43388373911755823);
+    t852 = FFT_VSCL(t813, 0.7818314824680298);
+    t853 = FFT_VSCL(t815, 0.9749279121818236);
+    t854 = FFT_VSUB(t851, t852);
+    t855 = FFT_VADD(t853, t854);
+    t856 = FFT_VADD(t850, t855);
+    t857 = FFT_VSUB(t850, t855);
+    a[0] = t368;
+    a[1] = t443;
+    a[2] = t518;
+    a[3] = t593;
+    a[4] = t668;
+    a[5] = t743;
+    a[6] = t818;
+    a[7] = t380;
+    a[8] = t455;
+    a[9] = t530;
+    a[10] = t605;
+    a[11] = t680;
+    a[12] = t755;
+    a[13] = t830;
+    a[14] = t393;
+    a[15] = t468;
+    a[16] = t543;
+    a[17] = t618;
+    a[18] = t693;
+    a[19] = t768;
+    a[20] = t843;
+    a[21] = t406;
+    a[22] = t481;
+    a[23] = t556;
+    a[24] = t631;
+    a[25] = t706;
+    a[26] = t781;
+    a[27] = t856;
+    a[28] = t407;
+    a[29] = t482;
+    a[30] = t557;
+    a[31] = t632;
+    a[32] = t707;
+    a[33] = t782;
+    a[34] = t857;
+    a[35] = t394;
+    a[36] = t469;
+    a[37] = t544;
+    a[38] = t619;
+    a[39] = t694;
+    a[40] = t769;
+    a[41] = t844;
+    a[42] = t381;
+    a[43] = t456;
+    a[44] = t531;
+    a[45] = t606;
+    a[46] = t681;
+    a[47] = t756;
+    a[48] = t831;
+}
+
+
+
+/* 256 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf256)(FFT_V* a)
+{
+    FFT_V t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    FFT_V t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    FFT_V t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    FFT_V t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    FFT_V t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    FFT_V t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    FFT_V t60, t61, t62, t63, t64, t65, t66, t67, t68, t69;
+    FFT_V t70, t71, t72, t73, t74, t75, t76, t77, t78, t79;
+    FFT_V t80, t81, t82, t83, t84, t85, t86, t87, t88, t89;
+    FFT_V t90, t91, t92, t93, t94, t95, t96, t97, t98, t99;
+    FFT_V t100, t101, t102, t103, t104, t105, t106, t107, t108, t109;
+    FFT_V t110, t111, t112, t113, t114, t115, t116, t117, t118, t119;
+    FFT_V t120, t121, t122, t123, t124, t125, t126, t127, t128, t129;
+    FFT_V t130, t131, t132, t133, t134, t135, t136, t137, t138, t139;
+    FFT_V t140, t141, t142, t143, t144, t145, t146, t147, t148, t149;
+    FFT_V t150, t151, t152, t153, t154, t155, t156, t157, t158, t159;
+    FFT_V t160, t161, t162, t163, t164, t165, t166, t167, t168, t169;
+    FFT_V t170, t171, t172, t173, t174, t175, t176, t177, t178, t179;
+    FFT_V t180, t181, t182, t183, t184, t185, t186, t187, t188, t189;
+    FFT_V t190, t191, t192, t193, t194, t195, t196, t197, t198, t199;
+    FFT_V t200, t201, t202, t203, t204, t205, t206, t207, t208, t209;
+    FFT_V t210, t211, t212, t213, t214, t215, t216, t217, t218, t219;
+    FFT_V t220, t221, t222, t223, t224, t225, t226, t227, t228, t229;
+    FFT_V t230, t231, t232, t233, t234, t235, t236, t237, t238, t239;
+    FFT_V t240, t241, t242, t243, t244, t245, t246, t247, t248, t249;
+    FFT_V t250, t251, t252, t253, t254, t255, t256, t257, t258, t259;
+    FFT_V t260, t261, t262, t263, t264, t265, t266, t267, t268, t269;
+    FFT_V t270, t271, t272, t273, t274, t275, t276, t277, t278, t279;
+    FFT_V t280, t281, t282, t283, t284, t285, t286, t287, t288, t289;
+    FFT_V t290, t291, t292, t293, t294, t295, t296, t297, t298, t299;
+    FFT_V t300, t301, t302, t303, t304, t305, t306, t307, t308, t309;
+    FFT_V t310, t311, t312, t313, t314, t315, t316, t317, t318, t319;
+    FFT_V t320, t321, t322, t323, t324, t325, t326, t327, t328, t329;
+    FFT_V t330, t331, t332, t333, t334, t335, t336, t337, t338, t339;
+    FFT_V t340, t341, t342, t343, t344, t345, t346, t347, t348, t349;
+    FFT_V t350, t351, t352, t353, t354, t355, t356, t357, t358, t359;
+    FFT_V t360, t361, t362, t363, t364, t365, t366, t367, t368, t369;
+    FFT_V t370, t371, t372, t373, t374, t375, t376, t377, t378, t379;
+    FFT_V t380, t381, t382, t383, t384, t385, t386, t387, t388, t389;
+    FFT_V t390, t391, t392, t393, t394, t395, t396, t397, t398, t399;
+    FFT_V t400, t401, t402, t403, t404, t405, t406, t407, t408, t409;
+    FFT_V t410, t411, t412, t413, t414, t415, t416, t417, t418, t419;
+    FFT_V t420, t421, t422, t423, t424, t425, t426, t427, t428, t429;
+    FFT_V t430, t431, t432, t433, t434, t435, t436, t437, t438, t439;
+    FFT_V t440, t441, t442, t443, t444, t445, t446, t447, t448, t449;
+    FFT_V t450, t451, t452, t453, t454, t455, t456, t457, t458, t459;
+    FFT_V t460, t461, t462, t463, t464, t465, t466, t467, t468, t469;
+    FFT_V t470, t471, t472, t473, t474, t475, t476, t477, t478, t479;
+    FFT_V t480, t481, t482, t483, t484, t485, t486, t487, t488, t489;
+    FFT_V t490, t491, t492, t493, t494, t495, t496, t497, t498, t499;
+    FFT_V t500, t501, t502, t503, t504, t505, t506, t507, t508, t509;
+    FFT_V t510, t511, t512, t513, t514, t515, t516, t517, t518, t519;
+    FFT_V t520, t521, t522, t523, t524, t525, t526, t527, t528, t529;
+    FFT_V t530, t531, t532, t533, t534, t535, t536, t537, t538, t539;
+    FFT_V t540, t541, t542, t543, t544, t545, t546, t547, t548, t549;
+    FFT_V t550, t551, t552, t553, t554, t555, t556, t557, t558, t559;
+    FFT_V t560, t561, t562, t563, t564, t565, t566, t567, t568, t569;
+    FFT_V t570, t571, t572, t573, t574, t575, t576, t577, t578, t579;
+    FFT_V t580, t581, t582, t583, t584, t585, t586, t587, t588, t589;
+    FFT_V t590, t591, t592, t593, t594, t595, t596, t597, t598, t599;
+    FFT_V t600, t601, t602, t603, t604, t605, t606, t607, t608, t609;
+    FFT_V t610, t611, t612, t613, t614, t615, t616, t617, t618, t619;
+    FFT_V t620, t621, t622, t623, t624, t625, t626, t627, t628, t629;
+    FFT_V t630, t631, t632, t633, t634, t635, t636, t637, t638, t639;
+    FFT_V t640, t641, t642, t643, t644, t645, t646, t647, t648, t649;
+    FFT_V t650, t651, t652, t653, t654, t655, t656, t657, t658, t659;
+    FFT_V t660, t661, t662, t663, t664, t665, t666, t667, t668, t669;
+    FFT_V t670, t671, t672, t673, t674, t675, t676, t677, t678, t679;
+    FFT_V t680, t681, t682, t683, t684, t685, t686, t687, t688, t689;
+    FFT_V t690, t691, t692, t693, t694, t695, t696, t697, t698, t699;
+    FFT_V t700, t701, t702, t703, t704, t705, t706, t707, t708, t709;
+    FFT_V t710, t711, t712, t713, t714, t715, t716, t717, t718, t719;
+    FFT_V t720, t721, t722, t723, t724, t725, t726, t727, t728, t729;
+    FFT_V t730, t731, t732, t733, t734, t735, t736, t737, t738, t739;
+    FFT_V t740, t741, t742, t743, t744, t745, t746, t747, t748, t749;
+    FFT_V t750, t751, t752, t753, t754, t755, t756, t757, t758, t759;
+    FFT_V t760, t761, t762, t763, t764, t765, t766, t767, t768, t769;
+    FFT_V t770, t771, t772, t773, t774, t775, t776, t777, t778, t779;
+    FFT_V t780, t781, t782, t783, t784, t785, t786, t787, t788, t789;
+    FFT_V t790, t791, t792, t793, t794, t795, t796, t797, t798, t799;
+    FFT_V t800, t801, t802, t803, t804, t805, t806, t807, t808, t809;
+    FFT_V t810, t811, t812, t813, t814, t815, t816, t817, t818, t819;
+    FFT_V t820, t821, t822, t823, t824, t825, t826, t827, t828, t829;
+    FFT_V t830, t831, t832, t833, t834, t835, t836, t837, t838, t839;
+    FFT_V t840, t841, t842, t843, t844, t845, t846, t847, t848, t849;
+    FFT_V t850, t851, t852, t853, t854, t855, t856, t857, t858, t859;
+    FFT_V t860, t861, t862, t863, t864, t865, t866, t867, t868, t869;
+    FFT_V t870, t871, t872, t873, t874, t875, t876, t877, t878, t879;
+    FFT_V t880, t881, t882, t883, t884, t885, t886, t887, t888, t889;
+    FFT_V t890, t891, t892, t893, t894, t895, t896, t897, t898, t899;
+    FFT_V t900, t901, t902, t903, t904, t905, t906, t907, t908, t909;
+    FFT_V t910, t911, t912, t913, t914, t915, t916, t917, t918, t919;
+    FFT_V t920, t921, t922, t923, t924, t925, t926, t927, t928, t929;
+    FFT_V t930, t931, t932, t933, t934, t935, t936, t937, t938, t939;
+    FFT_V t940, t941, t942, t943, t944, t945, t946, t947, t948, t949;
+    FFT_V t950, t951, t952, t953, t954, t955, t956, t957, t958, t959;
+    FFT_V t960, t961, t962, t963, t964, t965, t966, t967, t968, t969;
+    FFT_V t970, t971, t972, t973, t974, t975, t976, t977, t978, t979;
+    FFT_V t980, t981, t982, t983, t984, t985, t986, t987, t988, t989;
+    FFT_V t990, t991, t992, t993, t994, t995, t996, t997, t998, t999;
+    FFT_V t1000, t1001, t1002, t1003, t1004, t1005, t1006, t1007, t1008, t1009;
+    FFT_V t1010, t1011, t1012, t1013, t1014, t1015, t1016, t1017, t1018, t1019;
+    FFT_V t1020, t1021, t1022, t1023, t1024, t1025, t1026, t1027, t1028, t1029;
+    FFT_V t1030, t1031, t1032, t1033, t1034, t1035, t1036, t1037, t1038, t1039;
+    FFT_V t1040, t1041, t1042, t1043, t1044, t1045, t1046, t1047, t1048, t1049;
+    FFT_V t1050, t1051, t1052, t1053, t1054, t1055, t1056, t1057, t1058, t1059;
+    FFT_V t1060, t1061, t1062, t1063, t1064, t1065, t1066, t1067, t1068, t1069;
+    FFT_V t1070, t1071, t1072, t1073, t1074, t1075, t1076, t1077, t1078, t1079;
+    FFT_V t1080, t1081, t1082, t1083, t1084, t1085, t1086, t1087, t1088, t1089;
+    FFT_V t1090, t1091, t1092, t1093, t1094, t1095, t1096, t1097, t1098, t1099;
+    FFT_V t1100, t1101, t1102, t1103, t1104, t1105, t1106, t1107, t1108, t1109;
+    FFT_V t1110, t1111, t1112, t1113, t1114, t1115, t1116, t1117, t1118, t1119;
+    FFT_V t1120, t1121, t1122, t1123, t1124, t1125, t1126, t1127, t1128, t1129;
+    FFT_V t1130, t1131, t1132, t1133, t1134, t1135, t1136, t1137, t1138, t1139;
+    FFT_V t1140, t1141, t1142, t1143, t1144, t1145, t1146, t1147, t1148, t1149;
+    FFT_V t1150, t1151, t1152, t1153, t1154, t1155, t1156, t1157, t1158, t1159;
+    FFT_V t1160, t1161, t1162, t1163, t1164, t1165, t1166, t1167, t1168, t1169;
+    FFT_V t1170, t1171, t1172, t1173, t1174, t1175, t1176, t1177, t1178, t1179;
+    FFT_V t1180, t1181, t1182, t1183, t1184, t1185, t1186, t1187, t1188, t1189;
+    FFT_V t1190, t1191, t1192, t1193, t1194, t1195, t1196, t1197, t1198, t1199;
+    FFT_V t1200, t1201, t1202, t1203, t1204, t1205, t1206, t1207, t1208, t1209;
+    FFT_V t1210, t1211, t1212, t1213, t1214, t1215, t1216, t1217, t1218, t1219;
+    FFT_V t1220, t1221, t1222, t1223, t1224, t1225, t1226, t1227, t1228, t1229;
+    FFT_V t1230, t1231, t1232, t1233, t1234, t1235, t1236, t1237, t1238, t1239;
+    FFT_V t1240, t1241, t1242, t1243, t1244, t1245, t1246, t1247, t1248, t1249;
+    FFT_V t1250, t1251, t1252, t1253, t1254, t1255, t1256, t1257, t1258, t1259;
+    FFT_V t1260, t1261, t1262, t1263, t1264, t1265, t1266, t1267, t1268, t1269;
+    FFT_V t1270, t1271, t1272, t1273, t1274, t1275, t1276, t1277, t1278, t1279;
+    FFT_V t1280, t1281, t1282, t1283, t1284, t1285, t1286, t1287, t1288, t1289;
+    FFT_V t1290, t1291, t1292, t1293, t1294, t1295, t1296, t1297, t1298, t1299;
+    FFT_V t1300, t1301, t1302, t1303, t1304, t1305, t1306, t1307, t1308, t1309;
+    FFT_V t1310, t1311, t1312, t1313, t1314, t1315, t1316, t1317, t1318, t1319;
+    FFT_V t1320, t1321, t1322, t1323, t1324, t1325, t1326, t1327, t1328, t1329;
+    FFT_V t1330, t1331, t1332, t1333, t1334, t1335, t1336, t1337, t1338, t1339;
+    FFT_V t1340, t1341, t1342, t1343, t1344, t1345, t1346, t1347, t1348, t1349;
+    FFT_V t1350, t1351, t1352, t1353, t1354, t1355, t1356, t1357, t1358, t1359;
+    FFT_V t1360, t1361, t1362, t1363, t1364, t1365, t1366, t1367, t1368, t1369;
+    FFT_V t1370, t1371, t1372, t1373, t1374, t1375, t1376, t1377, t1378, t1379;
+    FFT_V t1380, t1381, t1382, t1383, t1384, t1385, t1386, t1387, t1388, t1389;
+    FFT_V t1390, t1391, t1392, t1393, t1394, t1395, t1396, t1397, t1398, t1399;
+    FFT_V t1400, t1401, t1402, t1403, t1404, t1405, t1406, t1407, t1408, t1409;
+    FFT_V t1410, t1411, t1412, t1413, t1414, t1415, t1416, t1417, t1418, t1419;
+    FFT_V t1420, t1421, t1422, t1423, t1424, t1425, t1426, t1427, t1428, t1429;
+    FFT_V t1430, t1431, t1432, t1433, t1434, t1435, t1436, t1437, t1438, t1439;
+    FFT_V t1440, t1441, t1442, t1443, t1444, t1445, t1446, t1447, t1448, t1449;
+    FFT_V t1450, t1451, t1452, t1453, t1454, t1455, t1456, t1457, t1458, t1459;
+    FFT_V t1460, t1461, t1462, t1463, t1464, t1465, t1466, t1467, t1468, t1469;
+    FFT_V t1470, t1471, t1472, t1473, t1474, t1475, t1476, t1477, t1478, t1479;
+    FFT_V t1480, t1481, t1482, t1483, t1484, t1485, t1486, t1487, t1488, t1489;
+    FFT_V t1490, t1491, t1492, t1493, t1494, t1495, t1496, t1497, t1498, t1499;
+    FFT_V t1500, t1501, t1502, t1503, t1504, t1505, t1506, t1507, t1508, t1509;
+    FFT_V t1510, t1511, t1512, t1513, t1514, t1515, t1516, t1517, t1518, t1519;
+    FFT_V t1520, t1521, t1522, t1523, t1524, t1525, t1526, t1527, t1528, t1529;
+    FFT_V t1530, t1531, t1532, t1533, t1534, t1535, t1536, t1537, t1538, t1539;
+    FFT_V t1540, t1541, t1542, t1543, t1544, t1545, t1546, t1547, t1548, t1549;
+    FFT_V t1550, t1551, t1552, t1553, t1554, t1555, t1556, t1557, t1558, t1559;
+    FFT_V t1560, t1561, t1562, t1563, t1564, t1565, t1566, t1567, t1568, t1569;
+    FFT_V t1570, t1571, t1572, t1573, t1574, t1575, t1576, t1577, t1578, t1579;
+    FFT_V t1580, t1581, t1582, t1583, t1584, t1585, t1586, t1587, t1588, t1589;
+    FFT_V t1590, t1591, t1592, t1593, t1594, t1595, t1596, t1597, t1598, t1599;
+    FFT_V t1600, t1601, t1602, t1603, t1604, t1605, t1606, t1607, t1608, t1609;
+    FFT_V t1610, t1611, t1612, t1613, t1614, t1615, t1616, t1617, t1618, t1619;
+    FFT_V t1620, t1621, t1622, t1623, t1624, t1625, t1626, t1627, t1628, t1629;
+    FFT_V t1630, t1631, t1632, t1633, t1634, t1635, t1636, t1637, t1638, t1639;
+    FFT_V t1640, t1641, t1642, t1643, t1644, t1645, t1646, t1647, t1648, t1649;
+    FFT_V t1650, t1651, t1652, t1653, t1654, t1655, t1656, t1657, t1658, t1659;
+    FFT_V t1660, t1661, t1662, t1663, t1664, t1665, t1666, t1667, t1668, t1669;
+    FFT_V t1670, t1671, t1672, t1673, t1674, t1675, t1676, t1677, t1678, t1679;
+    FFT_V t1680, t1681, t1682, t1683, t1684, t1685, t1686, t1687, t1688, t1689;
+    FFT_V t1690, t1691, t1692, t1693, t1694, t1695, t1696, t1697, t1698, t1699;
+    FFT_V t1700, t1701, t1702, t1703, t1704, t1705, t1706, t1707, t1708, t1709;
+    FFT_V t1710, t1711, t1712, t1713, t1714, t1715, t1716, t1717, t1718, t1719;
+    FFT_V t1720, t1721, t1722, t1723, t1724, t1725, t1726, t1727, t1728, t1729;
+    FFT_V t1730, t1731, t1732, t1733, t1734, t1735, t1736, t1737, t1738, t1739;
+    FFT_V t1740, t1741, t1742, t1743, t1744, t1745, t1746, t1747, t1748, t1749;
+    FFT_V t1750, t1751, t1752, t1753, t1754, t1755, t1756, t1757, t1758, t1759;
+    FFT_V t1760, t1761, t1762, t1763, t1764, t1765, t1766, t1767, t1768, t1769;
+    FFT_V t1770, t1771, t1772, t1773, t1774, t1775, t1776, t1777, t1778, t1779;
+    FFT_V t1780, t1781, t1782, t1783, t1784, t1785, t1786, t1787, t1788, t1789;
+    FFT_V t1790, t1791, t1792, t1793, t1794, t1795, t1796, t1797, t1798, t1799;
+    FFT_V t1800, t1801, t1802, t1803, t1804, t1805, t1806, t1807, t1808, t1809;
+    FFT_V t1810, t1811, t1812, t1813, t1814, t1815, t1816, t1817, t1818, t1819;
+    FFT_V t1820, t1821, t1822, t1823, t1824, t1825, t1826, t1827, t1828, t1829;
+    FFT_V t1830, t1831, t1832, t1833, t1834, t1835, t1836, t1837, t1838, t1839;
+    FFT_V t1840, t1841, t1842, t1843, t1844, t1845, t1846, t1847, t1848, t1849;
+    FFT_V t1850, t1851, t1852, t1853, t1854, t1855, t1856, t1857, t1858, t1859;
+    FFT_V t1860, t1861, t1862, t1863, t1864, t1865, t1866, t1867, t1868, t1869;
+    FFT_V t1870, t1871, t1872, t1873, t1874, t1875, t1876, t1877, t1878, t1879;
+    FFT_V t1880, t1881, t1882, t1883, t1884, t1885, t1886, t1887, t1888, t1889;
+    FFT_V t1890, t1891, t1892, t1893, t1894, t1895, t1896, t1897, t1898, t1899;
+    FFT_V t1900, t1901, t1902, t1903, t1904, t1905, t1906, t1907, t1908, t1909;
+    FFT_V t1910, t1911, t1912, t1913, t1914, t1915, t1916, t1917, t1918, t1919;
+    FFT_V t1920, t1921, t1922, t1923, t1924, t1925, t1926, t1927, t1928, t1929;
+    FFT_V t1930, t1931, t1932, t1933, t1934, t1935, t1936, t1937, t1938, t1939;
+    FFT_V t1940, t1941, t1942, t1943, t1944, t1945, t1946, t1947, t1948, t1949;
+    FFT_V t1950, t1951, t1952, t1953, t1954, t1955, t1956, t1957, t1958, t1959;
+    FFT_V t1960, t1961, t1962, t1963, t1964, t1965, t1966, t1967, t1968, t1969;
+    FFT_V t1970, t1971, t1972, t1973, t1974, t1975, t1976, t1977, t1978, t1979;
+    FFT_V t1980, t1981, t1982, t1983, t1984, t1985, t1986, t1987, t1988, t1989;
+    FFT_V t1990, t1991, t1992, t1993, t1994, t1995, t1996, t1997, t1998, t1999;
+    FFT_V t2000, t2001, t2002, t2003, t2004, t2005, t2006, t2007, t2008, t2009;
+    FFT_V t2010, t2011, t2012, t2013, t2014, t2015, t2016, t2017, t2018, t2019;
+    FFT_V t2020, t2021, t2022, t2023, t2024, t2025, t2026, t2027, t2028, t2029;
+    FFT_V t2030, t2031, t2032, t2033, t2034, t2035, t2036, t2037, t2038, t2039;
+    FFT_V t2040, t2041, t2042, t2043, t2044, t2045, t2046, t2047, t2048, t2049;
+    FFT_V t2050, t2051, t2052, t2053, t2054, t2055, t2056, t2057, t2058, t2059;
+    FFT_V t2060, t2061, t2062, t2063, t2064, t2065, t2066, t2067, t2068, t2069;
+    FFT_V t2070, t2071, t2072, t2073, t2074, t2075, t2076, t2077, t2078, t2079;
+    FFT_V t2080, t2081, t2082, t2083, t2084, t2085, t2086, t2087, t2088, t2089;
+    FFT_V t2090, t2091, t2092, t2093, t2094, t2095, t2096, t2097, t2098, t2099;
+    FFT_V t2100, t2101, t2102, t2103, t2104, t2105, t2106, t2107, t2108, t2109;
+    FFT_V t2110, t2111, t2112, t2113, t2114, t2115, t2116, t2117, t2118, t2119;
+    FFT_V t2120, t2121, t2122, t2123, t2124, t2125, t2126, t2127, t2128, t2129;
+    FFT_V t2130, t2131, t2132, t2133, t2134, t2135, t2136, t2137, t2138, t2139;
+    FFT_V t2140, t2141, t2142, t2143, t2144, t2145, t2146, t2147, t2148, t2149;
+    FFT_V t2150, t2151, t2152, t2153, t2154, t2155, t2156, t2157, t2158, t2159;
+    FFT_V t2160, t2161, t2162, t2163, t2164, t2165, t2166, t2167, t2168, t2169;
+    FFT_V t2170, t2171, t2172, t2173, t2174, t2175, t2176, t2177, t2178, t2179;
+    FFT_V t2180, t2181, t2182, t2183, t2184, t2185, t2186, t2187, t2188, t2189;
+    FFT_V t2190, t2191, t2192, t2193, t2194, t2195, t2196, t2197, t2198, t2199;
+    FFT_V t2200, t2201, t2202, t2203, t2204, t2205, t2206, t2207, t2208, t2209;
+    FFT_V t2210, t2211, t2212, t2213, t2214, t2215, t2216, t2217, t2218, t2219;
+    FFT_V t2220, t2221, t2222, t2223, t2224, t2225, t2226, t2227, t2228, t2229;
+    FFT_V t2230, t2231, t2232, t2233, t2234, t2235, t2236, t2237, t2238, t2239;
+    FFT_V t2240, t2241, t2242, t2243, t2244, t2245, t2246, t2247, t2248, t2249;
+    FFT_V t2250, t2251, t2252, t2253, t2254, t2255, t2256, t2257, t2258, t2259;
+    FFT_V t2260, t2261, t2262, t2263, t2264, t2265, t2266, t2267, t2268, t2269;
+    FFT_V t2270, t2271, t2272, t2273, t2274, t2275, t2276, t2277, t2278, t2279;
+    FFT_V t2280, t2281, t2282, t2283, t2284, t2285, t2286, t2287, t2288, t2289;
+    FFT_V t2290, t2291, t2292, t2293, t2294, t2295, t2296, t2297, t2298, t2299;
+    FFT_V t2300, t2301, t2302, t2303, t2304, t2305, t2306, t2307, t2308, t2309;
+    FFT_V t2310, t2311, t2312, t2313, t2314, t2315, t2316, t2317, t2318, t2319;
+    FFT_V t2320, t2321, t2322, t2323, t2324, t2325, t2326, t2327, t2328, t2329;
+    FFT_V t2330, t2331, t2332, t2333, t2334, t2335, t2336, t2337, t2338, t2339;
+    FFT_V t2340, t2341, t2342, t2343, t2344, t2345, t2346, t2347, t2348, t2349;
+    FFT_V t2350, t2351, t2352, t2353, t2354, t2355, t2356, t2357, t2358, t2359;
+    FFT_V t2360, t2361, t2362, t2363, t2364, t2365, t2366, t2367, t2368, t2369;
+    FFT_V t2370, t2371, t2372, t2373, t2374, t2375, t2376, t2377, t2378, t2379;
+    FFT_V t2380, t2381, t2382, t2383, t2384, t2385, t2386, t2387, t2388, t2389;
+    FFT_V t2390, t2391, t2392, t2393, t2394, t2395, t2396, t2397, t2398, t2399;
+    FFT_V t2400, t2401, t2402, t2403, t2404, t2405, t2406, t2407, t2408, t2409;
+    FFT_V t2410, t2411, t2412, t2413, t2414, t2415, t2416, t2417, t2418, t2419;
+    FFT_V t2420, t2421, t2422, t2423, t2424, t2425, t2426, t2427, t2428, t2429;
+    FFT_V t2430, t2431, t2432, t2433, t2434, t2435, t2436, t2437, t2438, t2439;
+    FFT_V t2440, t2441, t2442, t2443, t2444, t2445, t2446, t2447, t2448, t2449;
+    FFT_V t2450, t2451, t2452, t2453, t2454, t2455, t2456, t2457, t2458, t2459;
+    FFT_V t2460, t2461, t2462, t2463, t2464, t2465, t2466, t2467, t2468, t2469;
+    FFT_V t2470, t2471, t2472, t2473, t2474, t2475, t2476, t2477, t2478, t2479;
+    FFT_V t2480, t2481, t2482, t2483, t2484, t2485, t2486, t2487, t2488, t2489;
+    FFT_V t2490, t2491, t2492, t2493, t2494, t2495, t2496, t2497, t2498, t2499;
+    FFT_V t2500, t2501, t2502, t2503, t2504, t2505, t2506, t2507, t2508, t2509;
+    FFT_V t2510, t2511, t2512, t2513, t2514, t2515, t2516, t2517, t2518, t2519;
+    FFT_V t2520, t2521, t2522, t2523, t2524, t2525, t2526, t2527, t2528, t2529;
+    FFT_V t2530, t2531, t2532, t2533, t2534, t2535, t2536, t2537, t2538, t2539;
+    FFT_V t2540, t2541, t2542, t2543, t2544, t2545, t2546, t2547, t2548, t2549;
+    FFT_V t2550, t2551, t2552, t2553, t2554, t2555, t2556, t2557, t2558, t2559;
+    FFT_V t2560, t2561, t2562, t2563, t2564, t2565, t2566, t2567, t2568, t2569;
+    FFT_V t2570, t2571, t2572, t2573, t2574, t2575, t2576, t2577, t2578, t2579;
+    FFT_V t2580, t2581, t2582, t2583, t2584, t2585, t2586, t2587, t2588, t2589;
+    FFT_V t2590, t2591, t2592, t2593, t2594, t2595, t2596, t2597, t2598, t2599;
+    FFT_V t2600, t2601, t2602, t2603, t2604, t2605, t2606, t2607, t2608, t2609;
+    FFT_V t2610, t2611, t2612, t2613, t2614, t2615, t2616, t2617, t2618, t2619;
+    FFT_V t2620, t2621, t2622, t2623, t2624, t2625, t2626, t2627, t2628, t2629;
+    FFT_V t2630, t2631, t2632, t2633, t2634, t2635, t2636, t2637, t2638, t2639;
+    FFT_V t2640, t2641, t2642, t2643, t2644, t2645, t2646, t2647, t2648, t2649;
+    FFT_V t2650, t2651, t2652, t2653, t2654, t2655, t2656, t2657, t2658, t2659;
+    FFT_V t2660, t2661, t2662, t2663, t2664, t2665, t2666, t2667, t2668, t2669;
+    FFT_V t2670, t2671, t2672, t2673, t2674, t2675, t2676, t2677, t2678, t2679;
+    FFT_V t2680, t2681, t2682, t2683, t2684, t2685, t2686, t2687, t2688, t2689;
+    FFT_V t2690, t2691, t2692, t2693, t2694, t2695, t2696, t2697, t2698, t2699;
+    FFT_V t2700, t2701, t2702, t2703, t2704, t2705, t2706, t2707, t2708, t2709;
+    FFT_V t2710, t2711, t2712, t2713, t2714, t2715, t2716, t2717, t2718, t2719;
+    FFT_V t2720, t2721, t2722, t2723, t2724, t2725, t2726, t2727, t2728, t2729;
+    FFT_V t2730, t2731, t2732, t2733, t2734, t2735, t2736, t2737, t2738, t2739;
+    FFT_V t2740, t2741, t2742, t2743, t2744, t2745, t2746, t2747, t2748, t2749;
+    FFT_V t2750, t2751, t2752, t2753, t2754, t2755, t2756, t2757, t2758, t2759;
+    FFT_V t2760, t2761, t2762, t2763, t2764, t2765, t2766, t2767, t2768, t2769;
+    FFT_V t2770, t2771, t2772, t2773, t2774, t2775, t2776, t2777, t2778, t2779;
+    FFT_V t2780, t2781, t2782, t2783, t2784, t2785, t2786, t2787, t2788, t2789;
+    FFT_V t2790, t2791, t2792, t2793, t2794, t2795, t2796, t2797, t2798, t2799;
+    FFT_V t2800, t2801, t2802, t2803, t2804, t2805, t2806, t2807, t2808, t2809;
+    FFT_V t2810, t2811, t2812, t2813, t2814, t2815, t2816, t2817, t2818, t2819;
+    FFT_V t2820, t2821, t2822, t2823, t2824, t2825, t2826, t2827, t2828, t2829;
+    FFT_V t2830, t2831, t2832, t2833, t2834, t2835, t2836, t2837, t2838, t2839;
+    FFT_V t2840, t2841, t2842, t2843, t2844, t2845, t2846, t2847, t2848, t2849;
+    FFT_V t2850, t2851, t2852, t2853, t2854, t2855, t2856, t2857, t2858, t2859;
+    FFT_V t2860, t2861, t2862, t2863, t2864, t2865, t2866, t2867, t2868, t2869;
+    FFT_V t2870, t2871, t2872, t2873, t2874, t2875, t2876, t2877, t2878, t2879;
+    FFT_V t2880, t2881, t2882, t2883, t2884, t2885, t2886, t2887, t2888, t2889;
+    FFT_V t2890, t2891, t2892, t2893, t2894, t2895, t2896, t2897, t2898, t2899;
+    FFT_V t2900, t2901, t2902, t2903, t2904, t2905, t2906, t2907, t2908, t2909;
+    FFT_V t2910, t2911, t2912, t2913, t2914, t2915, t2916, t2917, t2918, t2919;
+    FFT_V t2920, t2921, t2922, t2923, t2924, t2925, t2926, t2927, t2928, t2929;
+    FFT_V t2930, t2931, t2932, t2933, t2934, t2935, t2936, t2937, t2938, t2939;
+    FFT_V t2940, t2941, t2942, t2943, t2944, t2945, t2946, t2947, t2948, t2949;
+    FFT_V t2950, t2951, t2952, t2953, t2954, t2955, t2956, t2957, t2958, t2959;
+    FFT_V t2960, t2961, t2962, t2963, t2964, t2965, t2966, t2967, t2968, t2969;
+    FFT_V t2970, t2971, t2972, t2973, t2974, t2975, t2976, t2977, t2978, t2979;
+    FFT_V t2980, t2981, t2982, t2983, t2984, t2985, t2986, t2987, t2988, t2989;
+    FFT_V t2990, t2991, t2992, t2993, t2994, t2995, t2996, t2997, t2998, t2999;
+    FFT_V t3000, t3001, t3002, t3003, t3004, t3005, t3006, t3007, t3008, t3009;
+    FFT_V t3010, t3011, t3012, t3013, t3014, t3015, t3016, t3017, t3018, t3019;
+    FFT_V t3020, t3021, t3022, t3023, t3024, t3025, t3026, t3027, t3028, t3029;
+    FFT_V t3030, t3031, t3032, t3033, t3034, t3035, t3036, t3037, t3038, t3039;
+    FFT_V t3040, t3041, t3042, t3043, t3044, t3045, t3046, t3047, t3048, t3049;
+    FFT_V t3050, t3051, t3052, t3053, t3054, t3055, t3056, t3057, t3058, t3059;
+    FFT_V t3060, t3061, t3062, t3063, t3064, t3065, t3066, t3067, t3068, t3069;
+    FFT_V t3070, t3071, t3072, t3073, t3074, t3075, t3076, t3077, t3078, t3079;
+    FFT_V t3080, t3081, t3082, t3083, t3084, t3085, t3086, t3087, t3088, t3089;
+    FFT_V t3090, t3091, t3092, t3093, t3094, t3095, t3096, t3097, t3098, t3099;
+    FFT_V t3100, t3101, t3102, t3103, t3104, t3105, t3106, t3107, t3108, t3109;
+    FFT_V t3110, t3111, t3112, t3113, t3114, t3115, t3116, t3117, t3118, t3119;
+    FFT_V t3120, t3121, t3122, t3123, t3124, t3125, t3126, t3127, t3128, t3129;
+    FFT_V t3130, t3131, t3132, t3133, t3134, t3135, t3136, t3137, t3138, t3139;
+    FFT_V t3140, t3141, t3142, t3143, t3144, t3145, t3146, t3147, t3148, t3149;
+    FFT_V t3150, t3151, t3152, t3153, t3154, t3155, t3156, t3157, t3158, t3159;
+    FFT_V t3160, t3161, t3162, t3163, t3164, t3165, t3166, t3167, t3168, t3169;
+    FFT_V t3170, t3171, t3172, t3173, t3174, t3175, t3176, t3177, t3178, t3179;
+    FFT_V t3180, t3181, t3182, t3183, t3184, t3185, t3186, t3187, t3188, t3189;
+    FFT_V t3190, t3191, t3192, t3193, t3194, t3195, t3196, t3197, t3198, t3199;
+    FFT_V t3200, t3201, t3202, t3203, t3204, t3205, t3206, t3207, t3208, t3209;
+    FFT_V t3210, t3211, t3212, t3213, t3214, t3215, t3216, t3217, t3218, t3219;
+    FFT_V t3220, t3221, t3222, t3223, t3224, t3225, t3226, t3227, t3228, t3229;
+    FFT_V t3230, t3231, t3232, t3233, t3234, t3235, t3236, t3237, t3238, t3239;
+    FFT_V t3240, t3241, t3242, t3243, t3244, t3245, t3246, t3247, t3248, t3249;
+    FFT_V t3250, t3251, t3252, t3253, t3254, t3255, t3256, t3257, t3258, t3259;
+    FFT_V t3260, t3261, t3262, t3263, t3264, t3265, t3266, t3267, t3268, t3269;
+    FFT_V t3270, t3271, t3272, t3273, t3274, t3275, t3276, t3277, t3278, t3279;
+    FFT_V t3280, t3281, t3282, t3283, t3284, t3285, t3286, t3287, t3288, t3289;
+    FFT_V t3290, t3291, t3292, t3293, t3294, t3295, t3296, t3297, t3298, t3299;
+    FFT_V t3300, t3301, t3302, t3303, t3304, t3305, t3306, t3307, t3308, t3309;
+    FFT_V t3310, t3311, t3312, t3313, t3314, t3315, t3316, t3317, t3318, t3319;
+    FFT_V t3320, t3321, t3322, t3323, t3324, t3325, t3326, t3327, t3328, t3329;
+    FFT_V t3330, t3331, t3332, t3333, t3334, t3335, t3336, t3337, t3338, t3339;
+    FFT_V t3340, t3341, t3342, t3343, t3344, t3345, t3346, t3347, t3348, t3349;
+    FFT_V t3350, t3351, t3352, t3353, t3354, t3355, t3356, t3357, t3358, t3359;
+    FFT_V t3360, t3361, t3362, t3363, t3364, t3365, t3366, t3367, t3368, t3369;
+    FFT_V t3370, t3371, t3372, t3373, t3374, t3375, t3376, t3377, t3378, t3379;
+    FFT_V t3380, t3381, t3382, t3383, t3384, t3385, t3386, t3387, t3388, t3389;
+    FFT_V t3390, t3391, t3392, t3393, t3394, t3395, t3396, t3397, t3398, t3399;
+    FFT_V t3400, t3401, t3402, t3403, t3404, t3405, t3406, t3407, t3408, t3409;
+    FFT_V t3410, t3411, t3412, t3413, t3414, t3415, t3416, t3417, t3418, t3419;
+    FFT_V t3420, t3421, t3422, t3423, t3424, t3425, t3426, t3427, t3428, t3429;
+    FFT_V t3430, t3431, t3432, t3433, t3434, t3435, t3436, t3437, t3438, t3439;
+    FFT_V t3440, t3441, t3442, t3443, t3444, t3445, t3446, t3447, t3448, t3449;
+    FFT_V t3450, t3451, t3452, t3453, t3454, t3455, t3456, t3457, t3458, t3459;
+    FFT_V t3460, t3461, t3462, t3463, t3464, t3465, t3466, t3467, t3468, t3469;
+    FFT_V t3470, t3471, t3472, t3473, t3474, t3475, t3476, t3477, t3478, t3479;
+    FFT_V t3480, t3481, t3482, t3483, t3484, t3485, t3486, t3487, t3488, t3489;
+    FFT_V t3490, t3491, t3492, t3493, t3494, t3495, t3496, t3497, t3498, t3499;
+    FFT_V t3500, t3501, t3502, t3503, t3504, t3505, t3506, t3507, t3508, t3509;
+    FFT_V t3510, t3511, t3512, t3513, t3514, t3515, t3516, t3517, t3518, t3519;
+    FFT_V t3520, t3521, t3522, t3523, t3524, t3525, t3526, t3527, t3528, t3529;
+    FFT_V t3530, t3531, t3532, t3533, t3534, t3535, t3536, t3537, t3538, t3539;
+    FFT_V t3540, t3541, t3542, t3543, t3544, t3545, t3546, t3547, t3548, t3549;
+    FFT_V t3550, t3551, t3552, t3553, t3554, t3555, t3556, t3557, t3558, t3559;
+    FFT_V t3560, t3561, t3562, t3563, t3564, t3565, t3566, t3567, t3568, t3569;
+    FFT_V t3570, t3571, t3572, t3573, t3574, t3575, t3576, t3577, t3578, t3579;
+    FFT_V t3580, t3581, t3582, t3583, t3584, t3585, t3586, t3587, t3588, t3589;
+    FFT_V t3590, t3591, t3592, t3593, t3594, t3595, t3596, t3597, t3598, t3599;
+    FFT_V t3600, t3601, t3602, t3603, t3604, t3605, t3606, t3607, t3608, t3609;
+    FFT_V t3610, t3611, t3612, t3613, t3614, t3615, t3616, t3617, t3618, t3619;
+    FFT_V t3620, t3621, t3622, t3623, t3624, t3625, t3626, t3627, t3628, t3629;
+    FFT_V t3630, t3631, t3632, t3633, t3634, t3635, t3636, t3637, t3638, t3639;
+    FFT_V t3640, t3641, t3642, t3643, t3644, t3645, t3646, t3647, t3648, t3649;
+    FFT_V t3650, t3651, t3652, t3653, t3654, t3655, t3656, t3657, t3658, t3659;
+    FFT_V t3660, t3661, t3662, t3663, t3664, t3665, t3666, t3667, t3668, t3669;
+    FFT_V t3670, t3671, t3672, t3673, t3674, t3675, t3676, t3677, t3678, t3679;
+    FFT_V t3680, t3681, t3682, t3683, t3684, t3685, t3686, t3687, t3688, t3689;
+    FFT_V t3690, t3691, t3692, t3693, t3694, t3695, t3696, t3697, t3698, t3699;
+    FFT_V t3700, t3701, t3702, t3703, t3704, t3705, t3706, t3707, t3708, t3709;
+    FFT_V t3710, t3711, t3712, t3713, t3714, t3715, t3716, t3717, t3718, t3719;
+    FFT_V t3720, t3721, t3722, t3723, t3724, t3725, t3726, t3727, t3728, t3729;
+    FFT_V t3730, t3731, t3732, t3733, t3734, t3735, t3736, t3737, t3738, t3739;
+    FFT_V t3740, t3741, t3742, t3743, t3744, t3745, t3746, t3747, t3748, t3749;
+    FFT_V t3750, t3751, t3752, t3753, t3754, t3755, t3756, t3757, t3758, t3759;
+    FFT_V t3760, t3761, t3762, t3763, t3764, t3765, t3766, t3767, t3768, t3769;
+    FFT_V t3770, t3771, t3772, t3773, t3774, t3775, t3776, t3777, t3778, t3779;
+    FFT_V t3780, t3781, t3782, t3783, t3784, t3785, t3786, t3787, t3788, t3789;
+    FFT_V t3790, t3791, t3792, t3793, t3794, t3795, t3796, t3797, t3798, t3799;
+    FFT_V t3800, t3801, t3802, t3803, t3804, t3805, t3806, t3807, t3808, t3809;
+    FFT_V t3810, t3811, t3812, t3813, t3814, t3815, t3816, t3817, t3818, t3819;
+    FFT_V t3820, t3821, t3822, t3823, t3824, t3825, t3826, t3827, t3828, t3829;
+    FFT_V t3830, t3831, t3832, t3833, t3834, t3835, t3836, t3837, t3838, t3839;
+    FFT_V t3840, t3841, t3842, t3843, t3844, t3845, t3846, t3847, t3848, t3849;
+    FFT_V t3850, t3851, t3852, t3853, t3854, t3855, t3856, t3857, t3858, t3859;
+    FFT_V t3860, t3861, t3862, t3863, t3864, t3865, t3866, t3867, t3868, t3869;
+    FFT_V t3870, t3871, t3872, t3873, t3874, t3875, t3876, t3877, t3878, t3879;
+    FFT_V t3880, t3881, t3882, t3883, t3884, t3885, t3886, t3887, t3888, t3889;
+    FFT_V t3890, t3891, t3892, t3893, t3894, t3895, t3896, t3897, t3898, t3899;
+    FFT_V t3900, t3901, t3902, t3903, t3904, t3905, t3906, t3907, t3908, t3909;
+    FFT_V t3910, t3911, t3912, t3913, t3914, t3915, t3916, t3917, t3918, t3919;
+    FFT_V t3920, t3921, t3922, t3923, t3924, t3925, t3926, t3927, t3928, t3929;
+    FFT_V t3930, t3931, t3932, t3933, t3934, t3935, t3936, t3937, t3938, t3939;
+    FFT_V t3940, t3941, t3942, t3943, t3944, t3945, t3946, t3947, t3948, t3949;
+    FFT_V t3950, t3951, t3952, t3953, t3954, t3955, t3956, t3957, t3958, t3959;
+    FFT_V t3960, t3961, t3962, t3963, t3964, t3965, t3966, t3967, t3968, t3969;
+    FFT_V t3970, t3971, t3972, t3973, t3974, t3975, t3976, t3977, t3978, t3979;
+    FFT_V t3980, t3981, t3982, t3983, t3984, t3985, t3986, t3987, t3988, t3989;
+    FFT_V t3990, t3991, t3992, t3993, t3994, t3995, t3996, t3997, t3998, t3999;
+    FFT_V t4000, t4001, t4002, t4003, t4004, t4005, t4006, t4007, t4008, t4009;
+    FFT_V t4010, t4011, t4012, t4013, t4014, t4015, t4016, t4017, t4018, t4019;
+    FFT_V t4020, t4021, t4022, t4023, t4024, t4025, t4026, t4027, t4028, t4029;
+    FFT_V t4030, t4031, t4032, t4033, t4034, t4035, t4036, t4037, t4038, t4039;
+    FFT_V t4040, t4041, t4042, t4043, t4044, t4045, t4046, t4047, t4048, t4049;
+    FFT_V t4050, t4051, t4052, t4053, t4054, t4055, t4056, t4057, t4058, t4059;
+    FFT_V t4060, t4061, t4062, t4063, t4064, t4065, t4066, t4067, t4068, t4069;
+    FFT_V t4070, t4071, t4072, t4073, t4074, t4075, t4076, t4077, t4078, t4079;
+    FFT_V t4080, t4081, t4082, t4083, t4084, t4085, t4086, t4087, t4088, t4089;
+    FFT_V t4090, t4091, t4092, t4093, t4094, t4095, t4096, t4097, t4098, t4099;
+    FFT_V t4100, t4101, t4102, t4103, t4104, t4105, t4106, t4107, t4108, t4109;
+    FFT_V t4110, t4111, t4112, t4113, t4114, t4115, t4116, t4117, t4118, t4119;
+    FFT_V t4120, t4121, t4122, t4123, t4124;
+
+    t0 = FFT_VADD(a[0], a[128]);
+    t1 = FFT_VSUB(a[0], a[128]);
+    t2 = FFT_VADD(a[192], a[64]);
+    t3 = FFT_VSUB(a[64], a[192]);
+    t4 = FFT_VADD(t0, t2);
+    t5 = FFT_VSUB(t0, t2);
+    t6 = FFT_VMULNJ(t3);
+    t7 = FFT_VADD(t1, t6);
+    t8 = FFT_VSUB(t1, t6);
+    t9 = FFT_VADD(a[144], a[16]);
+    t10 = FFT_VSUB(a[16], a[144]);
+    t11 = FFT_VADD(a[208], a[80]);
+    t12 = FFT_VSUB(a[80], a[208]);
+    t13 = FFT_VADD(t11, t9);
+    t14 = FFT_VSUB(t9, t11);
+    t15 = FFT_VMULNJ(t12);
+    t16 = FFT_VADD(t10, t15);
+    t17 = FFT_VSUB(t10, t15);
+    t18 = FFT_VADD(a[160], a[32]);
+    t19 = FFT_VSUB(a[32], a[160]);
+    t20 = FFT_VADD(a[224], a[96]);
+    t21 = FFT_VSUB(a[96], a[224]);
+    t22 = FFT_VADD(t18, t20);
+    t23 = FFT_VSUB(t18, t20);
+    t24 = FFT_VMULNJ(t21);
+    t25 = FFT_VADD(t19, t24);
+    t26 = FFT_VSUB(t19, t24);
+    t27 = FFT_VADD(a[176], a[48]);
+    t28 = FFT_VSUB(a[48], a[176]);
+    t29 = FFT_VADD(a[112], a[240]);
+    t30 = FFT_VSUB(a[112], a[240]);
+    t31 = FFT_VADD(t27, t29);
+    t32 = FFT_VSUB(t27, t29);
+    t33 = FFT_VMULNJ(t30);
+    t34 = FFT_VADD(t28, t33);
+    t35 = FFT_VSUB(t28, t33);
+    t36 = FFT_VADD(t22, t4);
+    t37 = FFT_VSUB(t4, t22);
+    t38 = FFT_VADD(t13, t31);
+    t39 = FFT_VSUB(t13, t31);
+    t40 = FFT_VADD(t36, t38);
+    t41 = FFT_VSUB(t36, t38);
+    t42 = FFT_VMULNJ(t39);
+    t43 = FFT_VADD(t37, t42);
+    t44 = FFT_VSUB(t37, t42);
+    t45 = FFT_VSCL(t16, 0.9238795325112867);
+    t46 = FFT_VMULNJ(t16);
+    t47 = FFT_VSCL(t46, 0.3826834323650898);
+    t48 = FFT_VADD(t45, t47);
+    t49 = FFT_VMULNJ(t25);
+    t50 = FFT_VADD(t25, t49);
+    t51 = FFT_VSCL(t50, 0.7071067811865476);
+    t52 = FFT_VSCL(t34, 0.38268343236508984);
+    t53 = FFT_VMULNJ(t34);
+    t54 = FFT_VSCL(t53, 0.9238795325112867);
+    t55 = FFT_VADD(t52, t54);
+    t56 = FFT_VADD(t51, t7);
+    t57 = FFT_VSUB(t7, t51);
+    t58 = FFT_VADD(t48, t55);
+    t59 = FFT_VSUB(t48, t55);
+    t60 = FFT_VADD(t56, t58);
+    t61 = FFT_VSUB(t56, t58);
+    t62 = FFT_VMULNJ(t59);
+    t63 = FFT_VADD(t57, t62);
+    t64 = FFT_VSUB(t57, t62);
+    t65 = FFT_VMULNJ(t14);
+    t66 = FFT_VADD(t14, t65);
+    t67 = FFT_VSCL(t66, 0.7071067811865476);
+    t68 = FFT_VMULNJ(t23);
+    t69 = FFT_VMULNJ(t32);
+    t70 = FFT_VSUB(t32, t69);
+    t71 = FFT_VSCL(t70, 0.7071067811865475);
+    t72 = FFT_VADD(t5, t68);
+    t73 = FFT_VSUB(t5, t68);
+    t74 = FFT_VSUB(t67, t71);
+    t75 = FFT_VADD(t67, t71);
+    t76 = FFT_VADD(t72, t74);
+    t77 = FFT_VSUB(t72, t74);
+    t78 = FFT_VMULNJ(t75);
+    t79 = FFT_VADD(t73, t78);
+    t80 = FFT_VSUB(t73, t78);
+    t81 = FFT_VSCL(t17, 0.38268343236508984);
+    t82 = FFT_VMULNJ(t17);
+    t83 = FFT_VSCL(t82, 0.9238795325112867);
+    t84 = FFT_VADD(t81, t83);
+    t85 = FFT_VMULNJ(t26);
+    t86 = FFT_VSUB(t26, t85);
+    t87 = FFT_VSCL(t86, 0.7071067811865475);
+    t88 = FFT_VSCL(t35, 0.9238795325112867);
+    t89 = FFT_VMULNJ(t35);
+    t90 = FFT_VSCL(t89, 0.3826834323650899);
+    t91 = FFT_VADD(t88, t90);
+    t92 = FFT_VSUB(t8, t87);
+    t93 = FFT_VADD(t8, t87);
+    t94 = FFT_VSUB(t84, t91);
+    t95 = FFT_VADD(t84, t91);
+    t96 = FFT_VADD(t92, t94);
+    t97 = FFT_VSUB(t92, t94);
+    t98 = FFT_VMULNJ(t95);
+    t99 = FFT_VADD(t93, t98);
+    t100 = FFT_VSUB(t93, t98);
+    t101 = FFT_VADD(a[129], a[1]);
+    t102 = FFT_VSUB(a[1], a[129]);
+    t103 = FFT_VADD(a[193], a[65]);
+    t104 = FFT_VSUB(a[65], a[193]);
+    t105 = FFT_VADD(t101, t103);
+    t106 = FFT_VSUB(t101, t103);
+    t107 = FFT_VMULNJ(t104);
+    t108 = FFT_VADD(t102, t107);
+    t109 = FFT_VSUB(t102, t107);
+    t110 = FFT_VADD(a[145], a[17]);
+    t111 = FFT_VSUB(a[17], a[145]);
+    t112 = FFT_VADD(a[209], a[81]);
+    t113 = FFT_VSUB(a[81], a[209]);
+    t114 = FFT_VADD(t110, t112);
+    t115 = FFT_VSUB(t110, t112);
+    t116 = FFT_VMULNJ(t113);
+    t117 = FFT_VADD(t111, t116);
+    t118 = FFT_VSUB(t111, t116);
+    t119 = FFT_VADD(a[161], a[33]);
+    t120 = FFT_VSUB(a[33], a[161]);
+    t121 = FFT_VADD(a[225], a[97]);
+    t122 = FFT_VSUB(a[97], a[225]);
+    t123 = FFT_VADD(t119, t121);
+    t124 = FFT_VSUB(t119, t121);
+    t125 = FFT_VMULNJ(t122);
+    t126 = FFT_VADD(t120, t125);
+    t127 = FFT_VSUB(t120, t125);
+    t128 = FFT_VADD(a[177], a[49]);
+    t129 = FFT_VSUB(a[49], a[177]);
+    t130 = FFT_VADD(a[113], a[241]);
+    t131 = FFT_VSUB(a[113], a[241]);
+    t132 = FFT_VADD(t128, t130);
+    t133 = FFT_VSUB(t128, t130);
+    t134 = FFT_VMULNJ(t131);
+    t135 = FFT_VADD(t129, t134);
+    t136 = FFT_VSUB(t129, t134);
+    t137 = FFT_VADD(t105, t123);
+    t138 = FFT_VSUB(t105, t123);
+    t139 = FFT_VADD(t114, t132);
+    t140 = FFT_VSUB(t114, t132);
+    t141 = FFT_VADD(t137, t139);
+    t142 = FFT_VSUB(t137, t139);
+    t143 = FFT_VMULNJ(t140);
+    t144 = FFT_VADD(t138, t143);
+    t145 = FFT_VSUB(t138, t143);
+    t146 = FFT_VSCL(t117, 0.9238795325112867);
+    t147 = FFT_VMULNJ(t117);
+    t148 = FFT_VSCL(t147, 0.3826834323650898);
+    t149 = FFT_VADD(t146, t148);
+    t150 = FFT_VMULNJ(t126);
+    t151 = FFT_VADD(t126, t150);
+    t152 = FFT_VSCL(t151, 0.7071067811865476);
+    t153 = FFT_VSCL(t135, 0.38268343236508984);
+    t154 = FFT_VMULNJ(t135);
+    t155 = FFT_VSCL(t154, 0.9238795325112867);
+    t156 = FFT_VADD(t153, t155);
+    t157 = FFT_VADD(t108, t152);
+    t158 = FFT_VSUB(t108, t152);
+    t159 = FFT_VADD(t149, t156);
+    t160 = FFT_VSUB(t149, t156);
+    t161 = FFT_VADD(t157, t159);
+    t162 = FFT_VSUB(t157, t159);
+    t163 = FFT_VMULNJ(t160);
+    t164 = FFT_VADD(t158, t163);
+    t165 = FFT_VSUB(t158, t163);
+    t166 = FFT_VMULNJ(t115);
+    t167 = FFT_VADD(t115, t166);
+    t168 = FFT_VSCL(t167, 0.7071067811865476);
+    t169 = FFT_VMULNJ(t124);
+    t170 = FFT_VMULNJ(t133);
+    t171 = FFT_VSUB(t133, t170);
+    t172 = FFT_VSCL(t171, 0.7071067811865475);
+    t173 = FFT_VADD(t106, t169);
+    t174 = FFT_VSUB(t106, t169);
+    t175 = FFT_VSUB(t168, t172);
+    t176 = FFT_VADD(t168, t172);
+    t177 = FFT_VADD(t173, t175);
+    t178 = FFT_VSUB(t173, t175);
+    t179 = FFT_VMULNJ(t176);
+    t180 = FFT_VADD(t174, t179);
+    t181 = FFT_VSUB(t174, t179);
+    t182 = FFT_VSCL(t118, 0.38268343236508984);
+    t183 = FFT_VMULNJ(t118);
+    t184 = FFT_VSCL(t183, 0.9238795325112867);
+    t185 = FFT_VADD(t182, t184);
+    t186 = FFT_VMULNJ(t127);
+    t187 = FFT_VSUB(t127, t186);
+    t188 = FFT_VSCL(t187, 0.7071067811865475);
+    t189 = FFT_VSCL(t136, 0.9238795325112867);
+    t190 = FFT_VMULNJ(t136);
+    t191 = FFT_VSCL(t190, 0.3826834323650899);
+    t192 = FFT_VADD(t189, t191);
+    t193 = FFT_VSUB(t109, t188);
+    t194 = FFT_VADD(t109, t188);
+    t195 = FFT_VSUB(t185, t192);
+    t196 = FFT_VADD(t185, t192);
+    t197 = FFT_VADD(t193, t195);
+    t198 = FFT_VSUB(t193, t195);
+    t199 = FFT_VMULNJ(t196);
+    t200 = FFT_VADD(t194, t199);
+    t201 = FFT_VSUB(t194, t199);
+    t202 = FFT_VADD(a[130], a[2]);
+    t203 = FFT_VSUB(a[2], a[130]);
+    t204 = FFT_VADD(a[194], a[66]);
+    t205 = FFT_VSUB(a[66], a[194]);
+    t206 = FFT_VADD(t202, t204);
+    t207 = FFT_VSUB(t202, t204);
+    t208 = FFT_VMULNJ(t205);
+    t209 = FFT_VADD(t203, t208);
+    t210 = FFT_VSUB(t203, t208);
+    t211 = FFT_VADD(a[146], a[18]);
+    t212 = FFT_VSUB(a[18], a[146]);
+    t213 = FFT_VADD(a[210], a[82]);
+    t214 = FFT_VSUB(a[82], a[210]);
+    t215 = FFT_VADD(t211, t213);
+    t216 = FFT_VSUB(t211, t213);
+    t217 = FFT_VMULNJ(t214);
+    t218 = FFT_VADD(t212, t217);
+    t219 = FFT_VSUB(t212, t217);
+    t220 = FFT_VADD(a[162], a[34]);
+    t221 = FFT_VSUB(a[34], a[162]);
+    t222 = FFT_VADD(a[226], a[98]);
+    t223 = FFT_VSUB(a[98], a[226]);
+    t224 = FFT_VADD(t220, t222);
+    t225 = FFT_VSUB(t220, t222);
+    t226 = FFT_VMULNJ(t223);
+    t227 = FFT_VADD(t221, t226);
+    t228 = FFT_VSUB(t221, t226);
+    t229 = FFT_VADD(a[178], a[50]);
+    t230 = FFT_VSUB(a[50], a[178]);
+    t231 = FFT_VADD(a[114], a[242]);
+    t232 = FFT_VSUB(a[114], a[242]);
+    t233 = FFT_VADD(t229, t231);
+    t234 = FFT_VSUB(t229, t231);
+    t235 = FFT_VMULNJ(t232);
+    t236 = FFT_VADD(t230, t235);
+    t237 = FFT_VSUB(t230, t235);
+    t238 = FFT_VADD(t206, t224);
+    t239 = FFT_VSUB(t206, t224);
+    t240 = FFT_VADD(t215, t233);
+    t241 = FFT_VSUB(t215, t233);
+    t242 = FFT_VADD(t238, t240);
+    t243 = FFT_VSUB(t238, t240);
+    t244 = FFT_VMULNJ(t241);
+    t245 = FFT_VADD(t239, t244);
+    t246 = FFT_VSUB(t239, t244);
+    t247 = FFT_VSCL(t218, 0.9238795325112867);
+    t248 = FFT_VMULNJ(t218);
+    t249 = FFT_VSCL(t248, 0.3826834323650898);
+    t250 = FFT_VADD(t247, t249);
+    t251 = FFT_VMULNJ(t227);
+    t252 = FFT_VADD(t227, t251);
+    t253 = FFT_VSCL(t252, 0.7071067811865476);
+    t254 = FFT_VSCL(t236, 0.38268343236508984);
+    t255 = FFT_VMULNJ(t236);
+    t256 = FFT_VSCL(t255, 0.9238795325112867);
+    t257 = FFT_VADD(t254, t256);
+    t258 = FFT_VADD(t209, t253);
+    t259 = FFT_VSUB(t209, t253);
+    t260 = FFT_VADD(t250, t257);
+    t261 = FFT_VSUB(t250, t257);
+    t262 = FFT_VADD(t258, t260);
+    t263 = FFT_VSUB(t258, t260);
+    t264 = FFT_VMULNJ(t261);
+    t265 = FFT_VADD(t259, t264);
+    t266 = FFT_VSUB(t259, t264);
+    t267 = FFT_VMULNJ(t216);
+    t268 = FFT_VADD(t216, t267);
+    t269 = FFT_VSCL(t268, 0.7071067811865476);
+    t270 = FFT_VMULNJ(t225);
+    t271 = FFT_VMULNJ(t234);
+    t272 = FFT_VSUB(t234, t271);
+    t273 = FFT_VSCL(t272, 0.7071067811865475);
+    t274 = FFT_VADD(t207, t270);
+    t275 = FFT_VSUB(t207, t270);
+    t276 = FFT_VSUB(t269, t273);
+    t277 = FFT_VADD(t269, t273);
+    t278 = FFT_VADD(t274, t276);
+    t279 = FFT_VSUB(t274, t276);
+    t280 = FFT_VMULNJ(t277);
+    t281 = FFT_VADD(t275, t280);
+    t282 = FFT_VSUB(t275, t280);
+    t283 = FFT_VSCL(t219, 0.38268343236508984);
+    t284 = FFT_VMULNJ(t219);
+    t285 = FFT_VSCL(t284, 0.9238795325112867);
+    t286 = FFT_VADD(t283, t285);
+    t287 = FFT_VMULNJ(t228);
+    t288 = FFT_VSUB(t228, t287);
+    t289 = FFT_VSCL(t288, 0.7071067811865475);
+    t290 = FFT_VSCL(t237, 0.9238795325112867);
+    t291 = FFT_VMULNJ(t237);
+    t292 = FFT_VSCL(t291, 0.3826834323650899);
+    t293 = FFT_VADD(t290, t292);
+    t294 = FFT_VSUB(t210, t289);
+    t295 = FFT_VADD(t210, t289);
+    t296 = FFT_VSUB(t286, t293);
+    t297 = FFT_VADD(t286, t293);
+    t298 = FFT_VADD(t294, t296);
+    t299 = FFT_VSUB(t294, t296);
+    t300 = FFT_VMULNJ(t297);
+    t301 = FFT_VADD(t295, t300);
+    t302 = FFT_VSUB(t295, t300);
+    t303 = FFT_VADD(a[131], a[3]);
+    t304 = FFT_VSUB(a[3], a[131]);
+    t305 = FFT_VADD(a[195], a[67]);
+    t306 = FFT_VSUB(a[67], a[195]);
+    t307 = FFT_VADD(t303, t305);
+    t308 = FFT_VSUB(t303, t305);
+    t309 = FFT_VMULNJ(t306);
+    t310 = FFT_VADD(t304, t309);
+    t311 = FFT_VSUB(t304, t309);
+    t312 = FFT_VADD(a[147], a[19]);
+    t313 = FFT_VSUB(a[19], a[147]);
+    t314 = FFT_VADD(a[211], a[83]);
+    t315 = FFT_VSUB(a[83], a[211]);
+    t316 = FFT_VADD(t312, t314);
+    t317 = FFT_VSUB(t312, t314);
+    t318 = FFT_VMULNJ(t315);
+    t319 = FFT_VADD(t313, t318);
+    t320 = FFT_VSUB(t313, t318);
+    t321 = FFT_VADD(a[163], a[35]);
+    t322 = FFT_VSUB(a[35], a[163]);
+    t323 = FFT_VADD(a[227], a[99]);
+    t324 = FFT_VSUB(a[99], a[227]);
+    t325 = FFT_VADD(t321, t323);
+    t326 = FFT_VSUB(t321, t323);
+    t327 = FFT_VMULNJ(t324);
+    t328 = FFT_VADD(t322, t327);
+    t329 = FFT_VSUB(t322, t327);
+    t330 = FFT_VADD(a[179], a[51]);
+    t331 = FFT_VSUB(a[51], a[179]);
+    t332 = FFT_VADD(a[115], a[243]);
+    t333 = FFT_VSUB(a[115], a[243]);
+    t334 = FFT_VADD(t330, t332);
+    t335 = FFT_VSUB(t330, t332);
+    t336 = FFT_VMULNJ(t333);
+    t337 = FFT_VADD(t331, t336);
+    t338 = FFT_VSUB(t331, t336);
+    t339 = FFT_VADD(t307, t325);
+    t340 = FFT_VSUB(t307, t325);
+    t341 = FFT_VADD(t316, t334);
+    t342 = FFT_VSUB(t316, t334);
+    t343 = FFT_VADD(t339, t341);
+    t344 = FFT_VSUB(t339, t341);
+    t345 = FFT_VMULNJ(t342);
+    t346 = FFT_VADD(t340, t345);
+    t347 = FFT_VSUB(t340, t345);
+    t348 = FFT_VSCL(t319, 0.9238795325112867);
+    t349 = FFT_VMULNJ(t319);
+    t350 = FFT_VSCL(t349, 0.3826834323650898);
+    t351 = FFT_VADD(t348, t350);
+    t352 = FFT_VMULNJ(t328);
+    t353 = FFT_VADD(t328, t352);
+    t354 = FFT_VSCL(t353, 0.7071067811865476);
+    t355 = FFT_VSCL(t337, 0.38268343236508984);
+    t356 = FFT_VMULNJ(t337);
+    t357 = FFT_VSCL(t356, 0.9238795325112867);
+    t358 = FFT_VADD(t355, t357);
+    t359 = FFT_VADD(t310, t354);
+    t360 = FFT_VSUB(t310, t354);
+    t361 = FFT_VADD(t351, t358);
+    t362 = FFT_VSUB(t351, t358);
+    t363 = FFT_VADD(t359, t361);
+    t364 = FFT_VSUB(t359, t361);
+    t365 = FFT_VMULNJ(t362);
+    t366 = FFT_VADD(t360, t365);
+    t367 = FFT_VSUB(t360, t365);
+    t368 = FFT_VMULNJ(t317);
+    t369 = FFT_VADD(t317, t368);
+    t370 = FFT_VSCL(t369, 0.7071067811865476);
+    t371 = FFT_VMULNJ(t326);
+    t372 = FFT_VMULNJ(t335);
+    t373 = FFT_VSUB(t335, t372);
+    t374 = FFT_VSCL(t373, 0.7071067811865475);
+    t375 = FFT_VADD(t308, t371);
+    t376 = FFT_VSUB(t308, t371);
+    t377 = FFT_VSUB(t370, t374);
+    t378 = FFT_VADD(t370, t374);
+    t379 = FFT_VADD(t375, t377);
+    t380 = FFT_VSUB(t375, t377);
+    t381 = FFT_VMULNJ(t378);
+    t382 = FFT_VADD(t376, t381);
+    t383 = FFT_VSUB(t376, t381);
+    t384 = FFT_VSCL(t320, 0.38268343236508984);
+    t385 = FFT_VMULNJ(t320);
+    t386 = FFT_VSCL(t385, 0.9238795325112867);
+    t387 = FFT_VADD(t384, t386);
+    t388 = FFT_VMULNJ(t329);
+    t389 = FFT_VSUB(t329, t388);
+    t390 = FFT_VSCL(t389, 0.7071067811865475);
+    t391 = FFT_VSCL(t338, 0.9238795325112867);
+    t392 = FFT_VMULNJ(t338);
+    t393 = FFT_VSCL(t392, 0.3826834323650899);
+    t394 = FFT_VADD(t391, t393);
+    t395 = FFT_VSUB(t311, t390);
+    t396 = FFT_VADD(t311, t390);
+    t397 = FFT_VSUB(t387, t394);
+    t398 = FFT_VADD(t387, t394);
+    t399 = FFT_VADD(t395, t397);
+    t400 = FFT_VSUB(t395, t397);
+    t401 = FFT_VMULNJ(t398);
+    t402 = FFT_VADD(t396, t401);
+    t403 = FFT_VSUB(t396, t401);
+    t404 = FFT_VADD(a[132], a[4]);
+    t405 = FFT_VSUB(a[4], a[132]);
+    t406 = FFT_VADD(a[196], a[68]);
+    t407 = FFT_VSUB(a[68], a[196]);
+    t408 = FFT_VADD(t404, t406);
+    t409 = FFT_VSUB(t404, t406);
+    t410 = FFT_VMULNJ(t407);
+    t411 = FFT_VADD(t405, t410);
+    t412 = FFT_VSUB(t405, t410);
+    t413 = FFT_VADD(a[148], a[20]);
+    t414 = FFT_VSUB(a[20], a[148]);
+    t415 = FFT_VADD(a[212], a[84]);
+    t416 = FFT_VSUB(a[84], a[212]);
+    t417 = FFT_VADD(t413, t415);
+    t418 = FFT_VSUB(t413, t415);
+    t419 = FFT_VMULNJ(t416);
+    t420 = FFT_VADD(t414, t419);
+    t421 = FFT_VSUB(t414, t419);
+    t422 = FFT_VADD(a[164], a[36]);
+    t423 = FFT_VSUB(a[36], a[164]);
+    t424 = FFT_VADD(a[100], a[228]);
+    t425 = FFT_VSUB(a[100], a[228]);
+    t426 = FFT_VADD(t422, t424);
+    t427 = FFT_VSUB(t422, t424);
+    t428 = FFT_VMULNJ(t425);
+    t429 = FFT_VADD(t423, t428);
+    t430 = FFT_VSUB(t423, t428);
+    t431 = FFT_VADD(a[180], a[52]);
+    t432 = FFT_VSUB(a[52], a[180]);
+    t433 = FFT_VADD(a[116], a[244]);
+    t434 = FFT_VSUB(a[116], a[244]);
+    t435 = FFT_VADD(t431, t433);
+    t436 = FFT_VSUB(t431, t433);
+    t437 = FFT_VMULNJ(t434);
+    t438 = FFT_VADD(t432, t437);
+    t439 = FFT_VSUB(t432, t437);
+    t440 = FFT_VADD(t408, t426);
+    t441 = FFT_VSUB(t408, t426);
+    t442 = FFT_VADD(t417, t435);
+    t443 = FFT_VSUB(t417, t435);
+    t444 = FFT_VADD(t440, t442);
+    t445 = FFT_VSUB(t440, t442);
+    t446 = FFT_VMULNJ(t443);
+    t447 = FFT_VADD(t441, t446);
+    t448 = FFT_VSUB(t441, t446);
+    t449 = FFT_VSCL(t420, 0.9238795325112867);
+    t450 = FFT_VMULNJ(t420);
+    t451 = FFT_VSCL(t450, 0.3826834323650898);
+    t452 = FFT_VADD(t449, t451);
+    t453 = FFT_VMULNJ(t429);
+    t454 = FFT_VADD(t429, t453);
+    t455 = FFT_VSCL(t454, 0.7071067811865476);
+    t456 = FFT_VSCL(t438, 0.38268343236508984);
+    t457 = FFT_VMULNJ(t438);
+    t458 = FFT_VSCL(t457, 0.9238795325112867);
+    t459 = FFT_VADD(t456, t458);
+    t460 = FFT_VADD(t411, t455);
+    t461 = FFT_VSUB(t411, t455);
+    t462 = FFT_VADD(t452, t459);
+    t463 = FFT_VSUB(t452, t459);
+    t464 = FFT_VADD(t460, t462);
+    t465 = FFT_VSUB(t460, t462);
+    t466 = FFT_VMULNJ(t463);
+    t467 = FFT_VADD(t461, t466);
+    t468 = FFT_VSUB(t461, t466);
+    t469 = FFT_VMULNJ(t418);
+    t470 = FFT_VADD(t418, t469);
+    t471 = FFT_VSCL(t470, 0.7071067811865476);
+    t472 = FFT_VMULNJ(t427);
+    t473 = FFT_VMULNJ(t436);
+    t474 = FFT_VSUB(t436, t473);
+    t475 = FFT_VSCL(t474, 0.7071067811865475);
+    t476 = FFT_VADD(t409, t472);
+    t477 = FFT_VSUB(t409, t472);
+    t478 = FFT_VSUB(t471, t475);
+    t479 = FFT_VADD(t471, t475);
+    t480 = FFT_VADD(t476, t478);
+    t481 = FFT_VSUB(t476, t478);
+    t482 = FFT_VMULNJ(t479);
+    t483 = FFT_VADD(t477, t482);
+    t484 = FFT_VSUB(t477, t482);
+    t485 = FFT_VSCL(t421, 0.38268343236508984);
+    t486 = FFT_VMULNJ(t421);
+    t487 = FFT_VSCL(t486, 0.9238795325112867);
+    t488 = FFT_VADD(t485, t487);
+    t489 = FFT_VMULNJ(t430);
+    t490 = FFT_VSUB(t430, t489);
+    t491 = FFT_VSCL(t490, 0.7071067811865475);
+    t492 = FFT_VSCL(t439, 0.9238795325112867);
+    t493 = FFT_VMULNJ(t439);
+    t494 = FFT_VSCL(t493, 0.3826834323650899);
+    t495 = FFT_VADD(t492, t494);
+    t496 = FFT_VSUB(t412, t491);
+    t497 = FFT_VADD(t412, t491);
+    t498 = FFT_VSUB(t488, t495);
+    t499 = FFT_VADD(t488, t495);
+    t500 = FFT_VADD(t496, t498);
+    t501 = FFT_VSUB(t496, t498);
+    t502 = FFT_VMULNJ(t499);
+    t503 = FFT_VADD(t497, t502);
+    t504 = FFT_VSUB(t497, t502);
+    t505 = FFT_VADD(a[133], a[5]);
+    t506 = FFT_VSUB(a[5], a[133]);
+    t507 = FFT_VADD(a[197], a[69]);
+    t508 = FFT_VSUB(a[69], a[197]);
+    t509 = FFT_VADD(t505, t507);
+    t510 = FFT_VSUB(t505, t507);
+    t511 = FFT_VMULNJ(t508);
+    t512 = FFT_VADD(t506, t511);
+    t513 = FFT_VSUB(t506, t511);
+    t514 = FFT_VADD(a[149], a[21]);
+    t515 = FFT_VSUB(a[21], a[149]);
+    t516 = FFT_VADD(a[213], a[85]);
+    t517 = FFT_VSUB(a[85], a[213]);
+    t518 = FFT_VADD(t514, t516);
+    t519 = FFT_VSUB(t514, t516);
+    t520 = FFT_VMULNJ(t517);
+    t521 = FFT_VADD(t515, t520);
+    t522 = FFT_VSUB(t515, t520);
+    t523 = FFT_VADD(a[165], a[37]);
+    t524 = FFT_VSUB(a[37], a[165]);
+    t525 = FFT_VADD(a[101], a[229]);
+    t526 = FFT_VSUB(a[101], a[229]);
+    t527 = FFT_VADD(t523, t525);
+    t528 = FFT_VSUB(t523, t525);
+    t529 = FFT_VMULNJ(t526);
+    t530 = FFT_VADD(t524, t529);
+    t531 = FFT_VSUB(t524, t529);
+    t532 = FFT_VADD(a[181], a[53]);
+    t533 = FFT_VSUB(a[53], a[181]);
+    t534 = FFT_VADD(a[117], a[245]);
+    t535 = FFT_VSUB(a[117], a[245]);
+    t536 = FFT_VADD(t532, t534);
+    t537 = FFT_VSUB(t532, t534);
+    t538 = FFT_VMULNJ(t535);
+    t539 = FFT_VADD(t533, t538);
+    t540 = FFT_VSUB(t533, t538);
+    t541 = FFT_VADD(t509, t527);
+    t542 = FFT_VSUB(t509, t527);
+    t543 = FFT_VADD(t518, t536);
+    t544 = FFT_VSUB(t518, t536);
+    t545 = FFT_VADD(t541, t543);
+    t546 = FFT_VSUB(t541, t543);
+    t547 = FFT_VMULNJ(t544);
+    t548 = FFT_VADD(t542, t547);
+    t549 = FFT_VSUB(t542, t547);
+    t550 = FFT_VSCL(t521, 0.9238795325112867);
+    t551 = FFT_VMULNJ(t521);
+    t552 = FFT_VSCL(t551, 0.3826834323650898);
+    t553 = FFT_VADD(t550, t552);
+    t554 = FFT_VMULNJ(t530);
+    t555 = FFT_VADD(t530, t554);
+    t556 = FFT_VSCL(t555, 0.7071067811865476);
+    t557 = FFT_VSCL(t539, 0.38268343236508984);
+    t558 = FFT_VMULNJ(t539);
+    t559 = FFT_VSCL(t558, 0.9238795325112867);
+    t560 = FFT_VADD(t557, t559);
+    t561 = FFT_VADD(t512, t556);
+    t562 = FFT_VSUB(t512, t556);
+    t563 = FFT_VADD(t553, t560);
+    t564 = FFT_VSUB(t553, t560);
+    t565 = FFT_VADD(t561, t563);
+    t566 = FFT_VSUB(t561, t563);
+    t567 = FFT_VMULNJ(t564);
+    t568 = FFT_VADD(t562, t567);
+    t569 = FFT_VSUB(t562, t567);
+    t570 = FFT_VMULNJ(t519);
+    t571 = FFT_VADD(t519, t570);
+    t572 = FFT_VSCL(t571, 0.7071067811865476);
+    t573 = FFT_VMULNJ(t528);
+    t574 = FFT_VMULNJ(t537);
+    t575 = FFT_VSUB(t537, t574);
+    t576 = FFT_VSCL(t575, 0.7071067811865475);
+    t577 = FFT_VADD(t510, t573);
+    t578 = FFT_VSUB(t510, t573);
+    t579 = FFT_VSUB(t572, t576);
+    t580 = FFT_VADD(t572, t576);
+    t581 = FFT_VADD(t577, t579);
+    t582 = FFT_VSUB(t577, t579);
+    t583 = FFT_VMULNJ(t580);
+    t584 = FFT_VADD(t578, t583);
+    t585 = FFT_VSUB(t578, t583);
+    t586 = FFT_VSCL(t522, 0.38268343236508984);
+    t587 = FFT_VMULNJ(t522);
+    t588 = FFT_VSCL(t587, 0.9238795325112867);
+    t589 = FFT_VADD(t586, t588);
+    t590 = FFT_VMULNJ(t531);
+    t591 = FFT_VSUB(t531, t590);
+    t592 = FFT_VSCL(t591, 0.7071067811865475);
+    t593 = FFT_VSCL(t540, 0.9238795325112867);
+    t594 = FFT_VMULNJ(t540);
+    t595 = FFT_VSCL(t594, 0.3826834323650899);
+    t596 = FFT_VADD(t593, t595);
+    t597 = FFT_VSUB(t513, t592);
+    t598 = FFT_VADD(t513, t592);
+    t599 = FFT_VSUB(t589, t596);
+    t600 = FFT_VADD(t589, t596);
+    t601 = FFT_VADD(t597, t599);
+    t602 = FFT_VSUB(t597, t599);
+    t603 = FFT_VMULNJ(t600);
+    t604 = FFT_VADD(t598, t603);
+    t605 = FFT_VSUB(t598, t603);
+    t606 = FFT_VADD(a[134], a[6]);
+    t607 = FFT_VSUB(a[6], a[134]);
+    t608 = FFT_VADD(a[198], a[70]);
+    t609 = FFT_VSUB(a[70], a[198]);
+    t610 = FFT_VADD(t606, t608);
+    t611 = FFT_VSUB(t606, t608);
+    t612 = FFT_VMULNJ(t609);
+    t613 = FFT_VADD(t607, t612);
+    t614 = FFT_VSUB(t607, t612);
+    t615 = FFT_VADD(a[150], a[22]);
+    t616 = FFT_VSUB(a[22], a[150]);
+    t617 = FFT_VADD(a[214], a[86]);
+    t618 = FFT_VSUB(a[86], a[214]);
+    t619 = FFT_VADD(t615, t617);
+    t620 = FFT_VSUB(t615, t617);
+    t621 = FFT_VMULNJ(t618);
+    t622 = FFT_VADD(t616, t621);
+    t623 = FFT_VSUB(t616, t621);
+    t624 = FFT_VADD(a[166], a[38]);
+    t625 = FFT_VSUB(a[38], a[166]);
+    t626 = FFT_VADD(a[102], a[230]);
+    t627 = FFT_VSUB(a[102], a[230]);
+    t628 = FFT_VADD(t624, t626);
+    t629 = FFT_VSUB(t624, t626);
+    t630 = FFT_VMULNJ(t627);
+    t631 = FFT_VADD(t625, t630);
+    t632 = FFT_VSUB(t625, t630);
+    t633 = FFT_VADD(a[182], a[54]);
+    t634 = FFT_VSUB(a[54], a[182]);
+    t635 = FFT_VADD(a[118], a[246]);
+    t636 = FFT_VSUB(a[118], a[246]);
+    t637 = FFT_VADD(t633, t635);
+    t638 = FFT_VSUB(t633, t635);
+    t639 = FFT_VMULNJ(t636);
+    t640 = FFT_VADD(t634, t639);
+    t641 = FFT_VSUB(t634, t639);
+    t642 = FFT_VADD(t610, t628);
+    t643 = FFT_VSUB(t610, t628);
+    t644 = FFT_VADD(t619, t637);
+    t645 = FFT_VSUB(t619, t637);
+    t646 = FFT_VADD(t642, t644);
+    t647 = FFT_VSUB(t642, t644);
+    t648 = FFT_VMULNJ(t645);
+    t649 = FFT_VADD(t643, t648);
+    t650 = FFT_VSUB(t643, t648);
+    t651 = FFT_VSCL(t622, 0.9238795325112867);
+    t652 = FFT_VMULNJ(t622);
+    t653 = FFT_VSCL(t652, 0.3826834323650898);
+    t654 = FFT_VADD(t651, t653);
+    t655 = FFT_VMULNJ(t631);
+    t656 = FFT_VADD(t631, t655);
+    t657 = FFT_VSCL(t656, 0.7071067811865476);
+    t658 = FFT_VSCL(t640, 0.38268343236508984);
+    t659 = FFT_VMULNJ(t640);
+    t660 = FFT_VSCL(t659, 0.9238795325112867);
+    t661 = FFT_VADD(t658, t660);
+    t662 = FFT_VADD(t613, t657);
+    t663 = FFT_VSUB(t613, t657);
+    t664 = FFT_VADD(t654, t661);
+    t665 = FFT_VSUB(t654, t661);
+    t666 = FFT_VADD(t662, t664);
+    t667 = FFT_VSUB(t662, t664);
+    t668 = FFT_VMULNJ(t665);
+    t669 = FFT_VADD(t663, t668);
+    t670 = FFT_VSUB(t663, t668);
+    t671 = FFT_VMULNJ(t620);
+    t672 = FFT_VADD(t620, t671);
+    t673 = FFT_VSCL(t672, 0.7071067811865476);
+    t674 = FFT_VMULNJ(t629);
+    t675 = FFT_VMULNJ(t638);
+    t676 = FFT_VSUB(t638, t675);
+    t677 = FFT_VSCL(t676, 0.7071067811865475);
+    t678 = FFT_VADD(t611, t674);
+    t679 = FFT_VSUB(t611, t674);
+    t680 = FFT_VSUB(t673, t677);
+    t681 = FFT_VADD(t673, t677);
+    t682 = FFT_VADD(t678, t680);
+    t683 = FFT_VSUB(t678, t680);
+    t684 = FFT_VMULNJ(t681);
+    t685 = FFT_VADD(t679, t684);
+    t686 = FFT_VSUB(t679, t684);
+    t687 = FFT_VSCL(t623, 0.38268343236508984);
+    t688 = FFT_VMULNJ(t623);
+    t689 = FFT_VSCL(t688, 0.9238795325112867);
+    t690 = FFT_VADD(t687, t689);
+    t691 = FFT_VMULNJ(t632);
+    t692 = FFT_VSUB(t632, t691);
+    t693 = FFT_VSCL(t692, 0.7071067811865475);
+    t694 = FFT_VSCL(t641, 0.9238795325112867);
+    t695 = FFT_VMULNJ(t641);
+    t696 = FFT_VSCL(t695, 0.3826834323650899);
+    t697 = FFT_VADD(t694, t696);
+    t698 = FFT_VSUB(t614, t693);
+    t699 = FFT_VADD(t614, t693);
+    t700 = FFT_VSUB(t690, t697);
+    t701 = FFT_VADD(t690, t697);
+    t702 = FFT_VADD(t698, t700);
+    t703 = FFT_VSUB(t698, t700);
+    t704 = FFT_VMULNJ(t701);
+    t705 = FFT_VADD(t699, t704);
+    t706 = FFT_VSUB(t699, t704);
+    t707 = FFT_VADD(a[135], a[7]);
+    t708 = FFT_VSUB(a[7], a[135]);
+    t709 = FFT_VADD(a[199], a[71]);
+    t710 = FFT_VSUB(a[71], a[199]);
+    t711 = FFT_VADD(t707, t709);
+    t712 = FFT_VSUB(t707, t709);
+    t713 = FFT_VMULNJ(t710);
+    t714 = FFT_VADD(t708, t713);
+    t715 = FFT_VSUB(t708, t713);
+    t716 = FFT_VADD(a[151], a[23]);
+    t717 = FFT_VSUB(a[23], a[151]);
+    t718 = FFT_VADD(a[215], a[87]);
+    t719 = FFT_VSUB(a[87], a[215]);
+    t720 = FFT_VADD(t716, t718);
+    t721 = FFT_VSUB(t716, t718);
+    t722 = FFT_VMULNJ(t719);
+    t723 = FFT_VADD(t717, t722);
+    t724 = FFT_VSUB(t717, t722);
+    t725 = FFT_VADD(a[167], a[39]);
+    t726 = FFT_VSUB(a[39], a[167]);
+    t727 = FFT_VADD(a[103], a[231]);
+    t728 = FFT_VSUB(a[103], a[231]);
+    t729 = FFT_VADD(t725, t727);
+    t730 = FFT_VSUB(t725, t727);
+    t731 = FFT_VMULNJ(t728);
+    t732 = FFT_VADD(t726, t731);
+    t733 = FFT_VSUB(t726, t731);
+    t734 = FFT_VADD(a[183], a[55]);
+    t735 = FFT_VSUB(a[55], a[183]);
+    t736 = FFT_VADD(a[119], a[247]);
+    t737 = FFT_VSUB(a[119], a[247]);
+    t738 = FFT_VADD(t734, t736);
+    t739 = FFT_VSUB(t734, t736);
+    t740 = FFT_VMULNJ(t737);
+    t741 = FFT_VADD(t735, t740);
+    t742 = FFT_VSUB(t735, t740);
+    t743 = FFT_VADD(t711, t729);
+    t744 = FFT_VSUB(t711, t729);
+    t745 = FFT_VADD(t720, t738);
+    t746 = FFT_VSUB(t720, t738);
+    t747 = FFT_VADD(t743, t745);
+    t748 = FFT_VSUB(t743, t745);
+    t749 = FFT_VMULNJ(t746);
+    t750 = FFT_VADD(t744, t749);
+    t751 = FFT_VSUB(t744, t749);
+    t752 = FFT_VSCL(t723, 0.9238795325112867);
+    t753 = FFT_VMULNJ(t723);
+    t754 = FFT_VSCL(t753, 0.3826834323650898);
+    t755 = FFT_VADD(t752, t754);
+    t756 = FFT_VMULNJ(t732);
+    t757 = FFT_VADD(t732, t756);
+    t758 = FFT_VSCL(t757, 0.7071067811865476);
+    t759 = FFT_VSCL(t741, 0.38268343236508984);
+    t760 = FFT_VMULNJ(t741);
+    t761 = FFT_VSCL(t760, 0.9238795325112867);
+    t762 = FFT_VADD(t759, t761);
+    t763 = FFT_VADD(t714, t758);
+    t764 = FFT_VSUB(t714, t758);
+    t765 = FFT_VADD(t755, t762);
+    t766 = FFT_VSUB(t755, t762);
+    t767 = FFT_VADD(t763, t765);
+    t768 = FFT_VSUB(t763, t765);
+    t769 = FFT_VMULNJ(t766);
+    t770 = FFT_VADD(t764, t769);
+    t771 = FFT_VSUB(t764, t769);
+    t772 = FFT_VMULNJ(t721);
+    t773 = FFT_VADD(t721, t772);
+    t774 = FFT_VSCL(t773, 0.7071067811865476);
+    t775 = FFT_VMULNJ(t730);
+    t776 = FFT_VMULNJ(t739);
+    t777 = FFT_VSUB(t739, t776);
+    t778 = FFT_VSCL(t777, 0.7071067811865475);
+    t779 = FFT_VADD(t712, t775);
+    t780 = FFT_VSUB(t712, t775);
+    t781 = FFT_VSUB(t774, t778);
+    t782 = FFT_VADD(t774, t778);
+    t783 = FFT_VADD(t779, t781);
+    t784 = FFT_VSUB(t779, t781);
+    t785 = FFT_VMULNJ(t782);
+    t786 = FFT_VADD(t780, t785);
+    t787 = FFT_VSUB(t780, t785);
+    t788 = FFT_VSCL(t724, 0.38268343236508984);
+    t789 = FFT_VMULNJ(t724);
+    t790 = FFT_VSCL(t789, 0.9238795325112867);
+    t791 = FFT_VADD(t788, t790);
+    t792 = FFT_VMULNJ(t733);
+    t793 = FFT_VSUB(t733, t792);
+    t794 = FFT_VSCL(t793, 0.7071067811865475);
+    t795 = FFT_VSCL(t742, 0.9238795325112867);
+    t796 = FFT_VMULNJ(t742);
+    t797 = FFT_VSCL(t796, 0.3826834323650899);
+    t798 = FFT_VADD(t795, t797);
+    t799 = FFT_VSUB(t715, t794);
+    t800 = FFT_VADD(t715, t794);
+    t801 = FFT_VSUB(t791, t798);
+    t802 = FFT_VADD(t791, t798);
+    t803 = FFT_VADD(t799, t801);
+    t804 = FFT_VSUB(t799, t801);
+    t805 = FFT_VMULNJ(t802);
+    t806 = FFT_VADD(t800, t805);
+    t807 = FFT_VSUB(t800, t805);
+    t808 = FFT_VADD(a[136], a[8]);
+    t809 = FFT_VSUB(a[8], a[136]);
+    t810 = FFT_VADD(a[200], a[72]);
+    t811 = FFT_VSUB(a[72], a[200]);
+    t812 = FFT_VADD(t808, t810);
+    t813 = FFT_VSUB(t808, t810);
+    t814 = FFT_VMULNJ(t811);
+    t815 = FFT_VADD(t809, t814);
+    t816 = FFT_VSUB(t809, t814);
+    t817 = FFT_VADD(a[152], a[24]);
+    t818 = FFT_VSUB(a[24], a[152]);
+    t819 = FFT_VADD(a[216], a[88]);
+    t820 = FFT_VSUB(a[88], a[216]);
+    t821 = FFT_VADD(t817, t819);
+    t822 = FFT_VSUB(t817, t819);
+    t823 = FFT_VMULNJ(t820);
+    t824 = FFT_VADD(t818, t823);
+    t825 = FFT_VSUB(t818, t823);
+    t826 = FFT_VADD(a[168], a[40]);
+    t827 = FFT_VSUB(a[40], a[168]);
+    t828 = FFT_VADD(a[104], a[232]);
+    t829 = FFT_VSUB(a[104], a[232]);
+    t830 = FFT_VADD(t826, t828);
+    t831 = FFT_VSUB(t826, t828);
+    t832 = FFT_VMULNJ(t829);
+    t833 = FFT_VADD(t827, t832);
+    t834 = FFT_VSUB(t827, t832);
+    t835 = FFT_VADD(a[184], a[56]);
+    t836 = FFT_VSUB(a[56], a[184]);
+    t837 = FFT_VADD(a[120], a[248]);
+    t838 = FFT_VSUB(a[120], a[248]);
+    t839 = FFT_VADD(t835, t837);
+    t840 = FFT_VSUB(t835, t837);
+    t841 = FFT_VMULNJ(t838);
+    t842 = FFT_VADD(t836, t841);
+    t843 = FFT_VSUB(t836, t841);
+    t844 = FFT_VADD(t812, t830);
+    t845 = FFT_VSUB(t812, t830);
+    t846 = FFT_VADD(t821, t839);
+    t847 = FFT_VSUB(t821, t839);
+    t848 = FFT_VADD(t844, t846);
+    t849 = FFT_VSUB(t844, t846);
+    t850 = FFT_VMULNJ(t847);
+    t851 = FFT_VADD(t845, t850);
+    t852 = FFT_VSUB(t845, t850);
+    t853 = FFT_VSCL(t824, 0.9238795325112867);
+    t854 = FFT_VMULNJ(t824);
+    t855 = FFT_VSCL(t854, 0.3826834323650898);
+    t856 = FFT_VADD(t853, t855);
+    t857 = FFT_VMULNJ(t833);
+    t858 = FFT_VADD(t833, t857);
+    t859 = FFT_VSCL(t858, 0.7071067811865476);
+    t860 = FFT_VSCL(t842, 0.38268343236508984);
+    t861 = FFT_VMULNJ(t842);
+    t862 = FFT_VSCL(t861, 0.9238795325112867);
+    t863 = FFT_VADD(t860, t862);
+    t864 = FFT_VADD(t815, t859);
+    t865 = FFT_VSUB(t815, t859);
+    t866 = FFT_VADD(t856, t863);
+    t867 = FFT_VSUB(t856, t863);
+    t868 = FFT_VADD(t864, t866);
+    t869 = FFT_VSUB(t864, t866);
+    t870 = FFT_VMULNJ(t867);
+    t871 = FFT_VADD(t865, t870);
+    t872 = FFT_VSUB(t865, t870);
+    t873 = FFT_VMULNJ(t822);
+    t874 = FFT_VADD(t822, t873);
+    t875 = FFT_VSCL(t874, 0.7071067811865476);
+    t876 = FFT_VMULNJ(t831);
+    t877 = FFT_VMULNJ(t840);
+    t878 = FFT_VSUB(t840, t877);
+    t879 = FFT_VSCL(t878, 0.7071067811865475);
+    t880 = FFT_VADD(t813, t876);
+    t881 = FFT_VSUB(t813, t876);
+    t882 = FFT_VSUB(t875, t879);
+    t883 = FFT_VADD(t875, t879);
+    t884 = FFT_VADD(t880, t882);
+    t885 = FFT_VSUB(t880, t882);
+    t886 = FFT_VMULNJ(t883);
+    t887 = FFT_VADD(t881, t886);
+    t888 = FFT_VSUB(t881, t886);
+    t889 = FFT_VSCL(t825, 0.38268343236508984);
+    t890 = FFT_VMULNJ(t825);
+    t891 = FFT_VSCL(t890, 0.9238795325112867);
+    t892 = FFT_VADD(t889, t891);
+    t893 = FFT_VMULNJ(t834);
+    t894 = FFT_VSUB(t834, t893);
+    t895 = FFT_VSCL(t894, 0.7071067811865475);
+    t896 = FFT_VSCL(t843, 0.9238795325112867);
+    t897 = FFT_VMULNJ(t843);
+    t898 = FFT_VSCL(t897, 0.3826834323650899);
+    t899 = FFT_VADD(t896, t898);
+    t900 = FFT_VSUB(t816, t895);
+    t901 = FFT_VADD(t816, t895);
+    t902 = FFT_VSUB(t892, t899);
+    t903 = FFT_VADD(t892, t899);
+    t904 = FFT_VADD(t900, t902);
+    t905 = FFT_VSUB(t900, t902);
+    t906 = FFT_VMULNJ(t903);
+    t907 = FFT_VADD(t901, t906);
+    t908 = FFT_VSUB(t901, t906);
+    t909 = FFT_VADD(a[137], a[9]);
+    t910 = FFT_VSUB(a[9], a[137]);
+    t911 = FFT_VADD(a[201], a[73]);
+    t912 = FFT_VSUB(a[73], a[201]);
+    t913 = FFT_VADD(t909, t911);
+    t914 = FFT_VSUB(t909, t911);
+    t915 = FFT_VMULNJ(t912);
+    t916 = FFT_VADD(t910, t915);
+    t917 = FFT_VSUB(t910, t915);
+    t918 = FFT_VADD(a[153], a[25]);
+    t919 = FFT_VSUB(a[25], a[153]);
+    t920 = FFT_VADD(a[217], a[89]);
+    t921 = FFT_VSUB(a[89], a[217]);
+    t922 = FFT_VADD(t918, t920);
+    t923 = FFT_VSUB(t918, t920);
+    t924 = FFT_VMULNJ(t921);
+    t925 = FFT_VADD(t919, t924);
+    t926 = FFT_VSUB(t919, t924);
+    t927 = FFT_VADD(a[169], a[41]);
+    t928 = FFT_VSUB(a[41], a[169]);
+    t929 = FFT_VADD(a[105], a[233]);
+    t930 = FFT_VSUB(a[105], a[233]);
+    t931 = FFT_VADD(t927, t929);
+    t932 = FFT_VSUB(t927, t929);
+    t933 = FFT_VMULNJ(t930);
+    t934 = FFT_VADD(t928, t933);
+    t935 = FFT_VSUB(t928, t933);
+    t936 = FFT_VADD(a[185], a[57]);
+    t937 = FFT_VSUB(a[57], a[185]);
+    t938 = FFT_VADD(a[121], a[249]);
+    t939 = FFT_VSUB(a[121], a[249]);
+    t940 = FFT_VADD(t936, t938);
+    t941 = FFT_VSUB(t936, t938);
+    t942 = FFT_VMULNJ(t939);
+    t943 = FFT_VADD(t937, t942);
+    t944 = FFT_VSUB(t937, t942);
+    t945 = FFT_VADD(t913, t931);
+    t946 = FFT_VSUB(t913, t931);
+    t947 = FFT_VADD(t922, t940);
+    t948 = FFT_VSUB(t922, t940);
+    t949 = FFT_VADD(t945, t947);
+    t950 = FFT_VSUB(t945, t947);
+    t951 = FFT_VMULNJ(t948);
+    t952 = FFT_VADD(t946, t951);
+    t953 = FFT_VSUB(t946, t951);
+    t954 = FFT_VSCL(t925, 0.9238795325112867);
+    t955 = FFT_VMULNJ(t925);
+    t956 = FFT_VSCL(t955, 0.3826834323650898);
+    t957 = FFT_VADD(t954, t956);
+    t958 = FFT_VMULNJ(t934);
+    t959 = FFT_VADD(t934, t958);
+    t960 = FFT_VSCL(t959, 0.7071067811865476);
+    t961 = FFT_VSCL(t943, 0.38268343236508984);
+    t962 = FFT_VMULNJ(t943);
+    t963 = FFT_VSCL(t962, 0.9238795325112867);
+    t964 = FFT_VADD(t961, t963);
+    t965 = FFT_VADD(t916, t960);
+    t966 = FFT_VSUB(t916, t960);
+    t967 = FFT_VADD(t957, t964);
+    t968 = FFT_VSUB(t957, t964);
+    t969 = FFT_VADD(t965, t967);
+    t970 = FFT_VSUB(t965, t967);
+    t971 = FFT_VMULNJ(t968);
+    t972 = FFT_VADD(t966, t971);
+    t973 = FFT_VSUB(t966, t971);
+    t974 = FFT_VMULNJ(t923);
+    t975 = FFT_VADD(t923, t974);
+    t976 = FFT_VSCL(t975, 0.7071067811865476);
+    t977 = FFT_VMULNJ(t932);
+    t978 = FFT_VMULNJ(t941);
+    t979 = FFT_VSUB(t941, t978);
+    t980 = FFT_VSCL(t979, 0.7071067811865475);
+    t981 = FFT_VADD(t914, t977);
+    t982 = FFT_VSUB(t914, t977);
+    t983 = FFT_VSUB(t976, t980);
+    t984 = FFT_VADD(t976, t980);
+    t985 = FFT_VADD(t981, t983);
+    t986 = FFT_VSUB(t981, t983);
+    t987 = FFT_VMULNJ(t984);
+    t988 = FFT_VADD(t982, t987);
+    t989 = FFT_VSUB(t982, t987);
+    t990 = FFT_VSCL(t926, 0.38268343236508984);
+    t991 = FFT_VMULNJ(t926);
+    t992 = FFT_VSCL(t991, 0.9238795325112867);
+    t993 = FFT_VADD(t990, t992);
+    t994 = FFT_VMULNJ(t935);
+    t995 = FFT_VSUB(t935, t994);
+    t996 = FFT_VSCL(t995, 0.7071067811865475);
+    t997 = FFT_VSCL(t944, 0.9238795325112867);
+    t998 = FFT_VMULNJ(t944);
+    t999 = FFT_VSCL(t998, 0.3826834323650899);
+    t1000 = FFT_VADD(t997, t999);
+    t1001 = FFT_VSUB(t917, t996);
+    t1002 = FFT_VADD(t917, t996);
+    t1003 = FFT_VSUB(t993, t1000);
+    t1004 = FFT_VADD(t1000, t993);
+    t1005 = FFT_VADD(t1001, t1003);
+    t1006 = FFT_VSUB(t1001, t1003);
+    t1007 = FFT_VMULNJ(t1004);
+    t1008 = FFT_VADD(t1002, t1007);
+    t1009 = FFT_VSUB(t1002, t1007);
+    t1010 = FFT_VADD(a[10], a[138]);
+    t1011 = FFT_VSUB(a[10], a[138]);
+    t1012 = FFT_VADD(a[202], a[74]);
+    t1013 = FFT_VSUB(a[74], a[202]);
+    t1014 = FFT_VADD(t1010, t1012);
+    t1015 = FFT_VSUB(t1010, t1012);
+    t1016 = FFT_VMULNJ(t1013);
+    t1017 = FFT_VADD(t1011, t1016);
+    t1018 = FFT_VSUB(t1011, t1016);
+    t1019 = FFT_VADD(a[154], a[26]);
+    t1020 = FFT_VSUB(a[26], a[154]);
+    t1021 = FFT_VADD(a[218], a[90]);
+    t1022 = FFT_VSUB(a[90], a[218]);
+    t1023 = FFT_VADD(t1019, t1021);
+    t1024 = FFT_VSUB(t1019, t1021);
+    t1025 = FFT_VMULNJ(t1022);
+    t1026 = FFT_VADD(t1020, t1025);
+    t1027 = FFT_VSUB(t1020, t1025);
+    t1028 = FFT_VADD(a[170], a[42]);
+    t1029 = FFT_VSUB(a[42], a[170]);
+    t1030 = FFT_VADD(a[106], a[234]);
+    t1031 = FFT_VSUB(a[106], a[234]);
+    t1032 = FFT_VADD(t1028, t1030);
+    t1033 = FFT_VSUB(t1028, t1030);
+    t1034 = FFT_VMULNJ(t1031);
+    t1035 = FFT_VADD(t1029, t1034);
+    t1036 = FFT_VSUB(t1029, t1034);
+    t1037 = FFT_VADD(a[186], a[58]);
+    t1038 = FFT_VSUB(a[58], a[186]);
+    t1039 = FFT_VADD(a[122], a[250]);
+    t1040 = FFT_VSUB(a[122], a[250]);
+    t1041 = FFT_VADD(t1037, t1039);
+    t1042 = FFT_VSUB(t1037, t1039);
+    t1043 = FFT_VMULNJ(t1040);
+    t1044 = FFT_VADD(t1038, t1043);
+    t1045 = FFT_VSUB(t1038, t1043);
+    t1046 = FFT_VADD(t1014, t1032);
+    t1047 = FFT_VSUB(t1014, t1032);
+    t1048 = FFT_VADD(t1023, t1041);
+    t1049 = FFT_VSUB(t1023, t1041);
+    t1050 = FFT_VADD(t1046, t1048);
+    t1051 = FFT_VSUB(t1046, t1048);
+    t1052 = FFT_VMULNJ(t1049);
+    t1053 = FFT_VADD(t1047, t1052);
+    t1054 = FFT_VSUB(t1047, t1052);
+    t1055 = FFT_VSCL(t1026, 0.9238795325112867);
+    t1056 = FFT_VMULNJ(t1026);
+    t1057 = FFT_VSCL(t1056, 0.3826834323650898);
+    t1058 = FFT_VADD(t1055, t1057);
+    t1059 = FFT_VMULNJ(t1035);
+    t1060 = FFT_VADD(t1035, t1059);
+    t1061 = FFT_VSCL(t1060, 0.7071067811865476);
+    t1062 = FFT_VSCL(t1044, 0.38268343236508984);
+    t1063 = FFT_VMULNJ(t1044);
+    t1064 = FFT_VSCL(t1063, 0.9238795325112867);
+    t1065 = FFT_VADD(t1062, t1064);
+    t1066 = FFT_VADD(t1017, t1061);
+    t1067 = FFT_VSUB(t1017, t1061);
+    t1068 = FFT_VADD(t1058, t1065);
+    t1069 = FFT_VSUB(t1058, t1065);
+    t1070 = FFT_VADD(t1066, t1068);
+    t1071 = FFT_VSUB(t1066, t1068);
+    t1072 = FFT_VMULNJ(t1069);
+    t1073 = FFT_VADD(t1067, t1072);
+    t1074 = FFT_VSUB(t1067, t1072);
+    t1075 = FFT_VMULNJ(t1024);
+    t1076 = FFT_VADD(t1024, t1075);
+    t1077 = FFT_VSCL(t1076, 0.7071067811865476);
+    t1078 = FFT_VMULNJ(t1033);
+    t1079 = FFT_VMULNJ(t1042);
+    t1080 = FFT_VSUB(t1042, t1079);
+    t1081 = FFT_VSCL(t1080, 0.7071067811865475);
+    t1082 = FFT_VADD(t1015, t1078);
+    t1083 = FFT_VSUB(t1015, t1078);
+    t1084 = FFT_VSUB(t1077, t1081);
+    t1085 = FFT_VADD(t1077, t1081);
+    t1086 = FFT_VADD(t1082, t1084);
+    t1087 = FFT_VSUB(t1082, t1084);
+    t1088 = FFT_VMULNJ(t1085);
+    t1089 = FFT_VADD(t1083, t1088);
+    t1090 = FFT_VSUB(t1083, t1088);
+    t1091 = FFT_VSCL(t1027, 0.38268343236508984);
+    t1092 = FFT_VMULNJ(t1027);
+    t1093 = FFT_VSCL(t1092, 0.9238795325112867);
+    t1094 = FFT_VADD(t1091, t1093);
+    t1095 = FFT_VMULNJ(t1036);
+    t1096 = FFT_VSUB(t1036, t1095);
+    t1097 = FFT_VSCL(t1096, 0.7071067811865475);
+    t1098 = FFT_VSCL(t1045, 0.9238795325112867);
+    t1099 = FFT_VMULNJ(t1045);
+    t1100 = FFT_VSCL(t1099, 0.3826834323650899);
+    t1101 = FFT_VADD(t1098, t1100);
+    t1102 = FFT_VSUB(t1018, t1097);
+    t1103 = FFT_VADD(t1018, t1097);
+    t1104 = FFT_VSUB(t1094, t1101);
+    t1105 = FFT_VADD(t1094, t1101);
+    t1106 = FFT_VADD(t1102, t1104);
+    t1107 = FFT_VSUB(t1102, t1104);
+    t1108 = FFT_VMULNJ(t1105);
+    t1109 = FFT_VADD(t1103, t1108);
+    t1110 = FFT_VSUB(t1103, t1108);
+    t1111 = FFT_VADD(a[11], a[139]);
+    t1112 = FFT_VSUB(a[11], a[139]);
+    t1113 = FFT_VADD(a[203], a[75]);
+    t1114 = FFT_VSUB(a[75], a[203]);
+    t1115 = FFT_VADD(t1111, t1113);
+    t1116 = FFT_VSUB(t1111, t1113);
+    t1117 = FFT_VMULNJ(t1114);
+    t1118 = FFT_VADD(t1112, t1117);
+    t1119 = FFT_VSUB(t1112, t1117);
+    t1120 = FFT_VADD(a[155], a[27]);
+    t1121 = FFT_VSUB(a[27], a[155]);
+    t1122 = FFT_VADD(a[219], a[91]);
+    t1123 = FFT_VSUB(a[91], a[219]);
+    t1124 = FFT_VADD(t1120, t1122);
+    t1125 = FFT_VSUB(t1120, t1122);
+    t1126 = FFT_VMULNJ(t1123);
+    t1127 = FFT_VADD(t1121, t1126);
+    t1128 = FFT_VSUB(t1121, t1126);
+    t1129 = FFT_VADD(a[171], a[43]);
+    t1130 = FFT_VSUB(a[43], a[171]);
+    t1131 = FFT_VADD(a[107], a[235]);
+    t1132 = FFT_VSUB(a[107], a[235]);
+    t1133 = FFT_VADD(t1129, t1131);
+    t1134 = FFT_VSUB(t1129, t1131);
+    t1135 = FFT_VMULNJ(t1132);
+    t1136 = FFT_VADD(t1130, t1135);
+    t1137 = FFT_VSUB(t1130, t1135);
+    t1138 = FFT_VADD(a[187], a[59]);
+    t1139 = FFT_VSUB(a[59], a[187]);
+    t1140 = FFT_VADD(a[123], a[251]);
+    t1141 = FFT_VSUB(a[123], a[251]);
+    t1142 = FFT_VADD(t1138, t1140);
+    t1143 = FFT_VSUB(t1138, t1140);
+    t1144 = FFT_VMULNJ(t1141);
+    t1145 = FFT_VADD(t1139, t1144);
+    t1146 = FFT_VSUB(t1139, t1144);
+    t1147 = FFT_VADD(t1115, t1133);
+    t1148 = FFT_VSUB(t1115, t1133);
+    t1149 = FFT_VADD(t1124, t1142);
+    t1150 = FFT_VSUB(t1124, t1142);
+    t1151 = FFT_VADD(t1147, t1149);
+    t1152 = FFT_VSUB(t1147, t1149);
+    t1153 = FFT_VMULNJ(t1150);
+    t1154 = FFT_VADD(t1148, t1153);
+    t1155 = FFT_VSUB(t1148, t1153);
+    t1156 = FFT_VSCL(t1127, 0.9238795325112867);
+    t1157 = FFT_VMULNJ(t1127);
+    t1158 = FFT_VSCL(t1157, 0.3826834323650898);
+    t1159 = FFT_VADD(t1156, t1158);
+    t1160 = FFT_VMULNJ(t1136);
+    t1161 = FFT_VADD(t1136, t1160);
+    t1162 = FFT_VSCL(t1161, 0.7071067811865476);
+    t1163 = FFT_VSCL(t1145, 0.38268343236508984);
+    t1164 = FFT_VMULNJ(t1145);
+    t1165 = FFT_VSCL(t1164, 0.9238795325112867);
+    t1166 = FFT_VADD(t1163, t1165);
+    t1167 = FFT_VADD(t1118, t1162);
+    t1168 = FFT_VSUB(t1118, t1162);
+    t1169 = FFT_VADD(t1159, t1166);
+    t1170 = FFT_VSUB(t1159, t1166);
+    t1171 = FFT_VADD(t1167, t1169);
+    t1172 = FFT_VSUB(t1167, t1169);
+    t1173 = FFT_VMULNJ(t1170);
+    t1174 = FFT_VADD(t1168, t1173);
+    t1175 = FFT_VSUB(t1168, t1173);
+    t1176 = FFT_VMULNJ(t1125);
+    t1177 = FFT_VADD(t1125, t1176);
+    t1178 = FFT_VSCL(t1177, 0.7071067811865476);
+    t1179 = FFT_VMULNJ(t1134);
+    t1180 = FFT_VMULNJ(t1143);
+    t1181 = FFT_VSUB(t1143, t1180);
+    t1182 = FFT_VSCL(t1181, 0.7071067811865475);
+    t1183 = FFT_VADD(t1116, t1179);
+    t1184 = FFT_VSUB(t1116, t1179);
+    t1185 = FFT_VSUB(t1178, t1182);
+    t1186 = FFT_VADD(t1178, t1182);
+    t1187 = FFT_VADD(t1183, t1185);
+    t1188 = FFT_VSUB(t1183, t1185);
+    t1189 = FFT_VMULNJ(t1186);
+    t1190 = FFT_VADD(t1184, t1189);
+    t1191 = FFT_VSUB(t1184, t1189);
+    t1192 = FFT_VSCL(t1128, 0.38268343236508984);
+    t1193 = FFT_VMULNJ(t1128);
+    t1194 = FFT_VSCL(t1193, 0.9238795325112867);
+    t1195 = FFT_VADD(t1192, t1194);
+    t1196 = FFT_VMULNJ(t1137);
+    t1197 = FFT_VSUB(t1137, t1196);
+    t1198 = FFT_VSCL(t1197, 0.7071067811865475);
+    t1199 = FFT_VSCL(t1146, 0.9238795325112867);
+    t1200 = FFT_VMULNJ(t1146);
+    t1201 = FFT_VSCL(t1200, 0.3826834323650899);
+    t1202 = FFT_VADD(t1199, t1201);
+    t1203 = FFT_VSUB(t1119, t1198);
+    t1204 = FFT_VADD(t1119, t1198);
+    t1205 = FFT_VSUB(t1195, t1202);
+    t1206 = FFT_VADD(t1195, t1202);
+    t1207 = FFT_VADD(t1203, t1205);
+    t1208 = FFT_VSUB(t1203, t1205);
+    t1209 = FFT_VMULNJ(t1206);
+    t1210 = FFT_VADD(t1204, t1209);
+    t1211 = FFT_VSUB(t1204, t1209);
+    t1212 = FFT_VADD(a[12], a[140]);
+    t1213 = FFT_VSUB(a[12], a[140]);
+    t1214 = FFT_VADD(a[204], a[76]);
+    t1215 = FFT_VSUB(a[76], a[204]);
+    t1216 = FFT_VADD(t1212, t1214);
+    t1217 = FFT_VSUB(t1212, t1214);
+    t1218 = FFT_VMULNJ(t1215);
+    t1219 = FFT_VADD(t1213, t1218);
+    t1220 = FFT_VSUB(t1213, t1218);
+    t1221 = FFT_VADD(a[156], a[28]);
+    t1222 = FFT_VSUB(a[28], a[156]);
+    t1223 = FFT_VADD(a[220], a[92]);
+    t1224 = FFT_VSUB(a[92], a[220]);
+    t1225 = FFT_VADD(t1221, t1223);
+    t1226 = FFT_VSUB(t1221, t1223);
+    t1227 = FFT_VMULNJ(t1224);
+    t1228 = FFT_VADD(t1222, t1227);
+    t1229 = FFT_VSUB(t1222, t1227);
+    t1230 = FFT_VADD(a[172], a[44]);
+    t1231 = FFT_VSUB(a[44], a[172]);
+    t1232 = FFT_VADD(a[108], a[236]);
+    t1233 = FFT_VSUB(a[108], a[236]);
+    t1234 = FFT_VADD(t1230, t1232);
+    t1235 = FFT_VSUB(t1230, t1232);
+    t1236 = FFT_VMULNJ(t1233);
+    t1237 = FFT_VADD(t1231, t1236);
+    t1238 = FFT_VSUB(t1231, t1236);
+    t1239 = FFT_VADD(a[188], a[60]);
+    t1240 = FFT_VSUB(a[60], a[188]);
+    t1241 = FFT_VADD(a[124], a[252]);
+    t1242 = FFT_VSUB(a[124], a[252]);
+    t1243 = FFT_VADD(t1239, t1241);
+    t1244 = FFT_VSUB(t1239, t1241);
+    t1245 = FFT_VMULNJ(t1242);
+    t1246 = FFT_VADD(t1240, t1245);
+    t1247 = FFT_VSUB(t1240, t1245);
+    t1248 = FFT_VADD(t1216, t1234);
+    t1249 = FFT_VSUB(t1216, t1234);
+    t1250 = FFT_VADD(t1225, t1243);
+    t1251 = FFT_VSUB(t1225, t1243);
+    t1252 = FFT_VADD(t1248, t1250);
+    t1253 = FFT_VSUB(t1248, t1250);
+    t1254 = FFT_VMULNJ(t1251);
+    t1255 = FFT_VADD(t1249, t1254);
+    t1256 = FFT_VSUB(t1249, t1254);
+    t1257 = FFT_VSCL(t1228, 0.9238795325112867);
+    t1258 = FFT_VMULNJ(t1228);
+    t1259 = FFT_VSCL(t1258, 0.3826834323650898);
+    t1260 = FFT_VADD(t1257, t1259);
+    t1261 = FFT_VMULNJ(t1237);
+    t1262 = FFT_VADD(t1237, t1261);
+    t1263 = FFT_VSCL(t1262, 0.7071067811865476);
+    t1264 = FFT_VSCL(t1246, 0.38268343236508984);
+    t1265 = FFT_VMULNJ(t1246);
+    t1266 = FFT_VSCL(t1265, 0.9238795325112867);
+    t1267 = FFT_VADD(t1264, t1266);
+    t1268 = FFT_VADD(t1219, t1263);
+    t1269 = FFT_VSUB(t1219, t1263);
+    t1270 = FFT_VADD(t1260, t1267);
+    t1271 = FFT_VSUB(t1260, t1267);
+    t1272 = FFT_VADD(t1268, t1270);
+    t1273 = FFT_VSUB(t1268, t1270);
+    t1274 = FFT_VMULNJ(t1271);
+    t1275 = FFT_VADD(t1269, t1274);
+    t1276 = FFT_VSUB(t1269, t1274);
+    t1277 = FFT_VMULNJ(t1226);
+    t1278 = FFT_VADD(t1226, t1277);
+    t1279 = FFT_VSCL(t1278, 0.7071067811865476);
+    t1280 = FFT_VMULNJ(t1235);
+    t1281 = FFT_VMULNJ(t1244);
+    t1282 = FFT_VSUB(t1244, t1281);
+    t1283 = FFT_VSCL(t1282, 0.7071067811865475);
+    t1284 = FFT_VADD(t1217, t1280);
+    t1285 = FFT_VSUB(t1217, t1280);
+    t1286 = FFT_VSUB(t1279, t1283);
+    t1287 = FFT_VADD(t1279, t1283);
+    t1288 = FFT_VADD(t1284, t1286);
+    t1289 = FFT_VSUB(t1284, t1286);
+    t1290 = FFT_VMULNJ(t1287);
+    t1291 = FFT_VADD(t1285, t1290);
+    t1292 = FFT_VSUB(t1285, t1290);
+    t1293 = FFT_VSCL(t1229, 0.38268343236508984);
+    t1294 = FFT_VMULNJ(t1229);
+    t1295 = FFT_VSCL(t1294, 0.9238795325112867);
+    t1296 = FFT_VADD(t1293, t1295);
+    t1297 = FFT_VMULNJ(t1238);
+    t1298 = FFT_VSUB(t1238, t1297);
+    t1299 = FFT_VSCL(t1298, 0.7071067811865475);
+    t1300 = FFT_VSCL(t1247, 0.9238795325112867);
+    t1301 = FFT_VMULNJ(t1247);
+    t1302 = FFT_VSCL(t1301, 0.3826834323650899);
+    t1303 = FFT_VADD(t1300, t1302);
+    t1304 = FFT_VSUB(t1220, t1299);
+    t1305 = FFT_VADD(t1220, t1299);
+    t1306 = FFT_VSUB(t1296, t1303);
+    t1307 = FFT_VADD(t1296, t1303);
+    t1308 = FFT_VADD(t1304, t1306);
+    t1309 = FFT_VSUB(t1304, t1306);
+    t1310 = FFT_VMULNJ(t1307);
+    t1311 = FFT_VADD(t1305, t1310);
+    t1312 = FFT_VSUB(t1305, t1310);
+    t1313 = FFT_VADD(a[13], a[141]);
+    t1314 = FFT_VSUB(a[13], a[141]);
+    t1315 = FFT_VADD(a[205], a[77]);
+    t1316 = FFT_VSUB(a[77], a[205]);
+    t1317 = FFT_VADD(t1313, t1315);
+    t1318 = FFT_VSUB(t1313, t1315);
+    t1319 = FFT_VMULNJ(t1316);
+    t1320 = FFT_VADD(t1314, t1319);
+    t1321 = FFT_VSUB(t1314, t1319);
+    t1322 = FFT_VADD(a[157], a[29]);
+    t1323 = FFT_VSUB(a[29], a[157]);
+    t1324 = FFT_VADD(a[221], a[93]);
+    t1325 = FFT_VSUB(a[93], a[221]);
+    t1326 = FFT_VADD(t1322, t1324);
+    t1327 = FFT_VSUB(t1322, t1324);
+    t1328 = FFT_VMULNJ(t1325);
+    t1329 = FFT_VADD(t1323, t1328);
+    t1330 = FFT_VSUB(t1323, t1328);
+    t1331 = FFT_VADD(a[173], a[45]);
+    t1332 = FFT_VSUB(a[45], a[173]);
+    t1333 = FFT_VADD(a[109], a[237]);
+    t1334 = FFT_VSUB(a[109], a[237]);
+    t1335 = FFT_VADD(t1331, t1333);
+    t1336 = FFT_VSUB(t1331, t1333);
+    t1337 = FFT_VMULNJ(t1334);
+    t1338 = FFT_VADD(t1332, t1337);
+    t1339 = FFT_VSUB(t1332, t1337);
+    t1340 = FFT_VADD(a[189], a[61]);
+    t1341 = FFT_VSUB(a[61], a[189]);
+    t1342 = FFT_VADD(a[125], a[253]);
+    t1343 = FFT_VSUB(a[125], a[253]);
+    t1344 = FFT_VADD(t1340, t1342);
+    t1345 = FFT_VSUB(t1340, t1342);
+    t1346 = FFT_VMULNJ(t1343);
+    t1347 = FFT_VADD(t1341, t1346);
+    t1348 = FFT_VSUB(t1341, t1346);
+    t1349 = FFT_VADD(t1317, t1335);
+    t1350 = FFT_VSUB(t1317, t1335);
+    t1351 = FFT_VADD(t1326, t1344);
+    t1352 = FFT_VSUB(t1326, t1344);
+    t1353 = FFT_VADD(t1349, t1351);
+    t1354 = FFT_VSUB(t1349, t1351);
+    t1355 = FFT_VMULNJ(t1352);
+    t1356 = FFT_VADD(t1350, t1355);
+    t1357 = FFT_VSUB(t1350, t1355);
+    t1358 = FFT_VSCL(t1329, 0.9238795325112867);
+    t1359 = FFT_VMULNJ(t1329);
+    t1360 = FFT_VSCL(t1359, 0.3826834323650898);
+    t1361 = FFT_VADD(t1358, t1360);
+    t1362 = FFT_VMULNJ(t1338);
+    t1363 = FFT_VADD(t1338, t1362);
+    t1364 = FFT_VSCL(t1363, 0.7071067811865476);
+    t1365 = FFT_VSCL(t1347, 0.38268343236508984);
+    t1366 = FFT_VMULNJ(t1347);
+    t1367 = FFT_VSCL(t1366, 0.9238795325112867);
+    t1368 = FFT_VADD(t1365, t1367);
+    t1369 = FFT_VADD(t1320, t1364);
+    t1370 = FFT_VSUB(t1320, t1364);
+    t1371 = FFT_VADD(t1361, t1368);
+    t1372 = FFT_VSUB(t1361, t1368);
+    t1373 = FFT_VADD(t1369, t1371);
+    t1374 = FFT_VSUB(t1369, t1371);
+    t1375 = FFT_VMULNJ(t1372);
+    t1376 = FFT_VADD(t1370, t1375);
+    t1377 = FFT_VSUB(t1370, t1375);
+    t1378 = FFT_VMULNJ(t1327);
+    t1379 = FFT_VADD(t1327, t1378);
+    t1380 = FFT_VSCL(t1379, 0.7071067811865476);
+    t1381 = FFT_VMULNJ(t1336);
+    t1382 = FFT_VMULNJ(t1345);
+    t1383 = FFT_VSUB(t1345, t1382);
+    t1384 = FFT_VSCL(t1383, 0.7071067811865475);
+    t1385 = FFT_VADD(t1318, t1381);
+    t1386 = FFT_VSUB(t1318, t1381);
+    t1387 = FFT_VSUB(t1380, t1384);
+    t1388 = FFT_VADD(t1380, t1384);
+    t1389 = FFT_VADD(t1385, t1387);
+    t1390 = FFT_VSUB(t1385, t1387);
+    t1391 = FFT_VMULNJ(t1388);
+    t1392 = FFT_VADD(t1386, t1391);
+    t1393 = FFT_VSUB(t1386, t1391);
+    t1394 = FFT_VSCL(t1330, 0.38268343236508984);
+    t1395 = FFT_VMULNJ(t1330);
+    t1396 = FFT_VSCL(t1395, 0.9238795325112867);
+    t1397 = FFT_VADD(t1394, t1396);
+    t1398 = FFT_VMULNJ(t1339);
+    t1399 = FFT_VSUB(t1339, t1398);
+    t1400 = FFT_VSCL(t1399, 0.7071067811865475);
+    t1401 = FFT_VSCL(t1348, 0.9238795325112867);
+    t1402 = FFT_VMULNJ(t1348);
+    t1403 = FFT_VSCL(t1402, 0.3826834323650899);
+    t1404 = FFT_VADD(t1401, t1403);
+    t1405 = FFT_VSUB(t1321, t1400);
+    t1406 = FFT_VADD(t1321, t1400);
+    t1407 = FFT_VSUB(t1397, t1404);
+    t1408 = FFT_VADD(t1397, t1404);
+    t1409 = FFT_VADD(t1405, t1407);
+    t1410 = FFT_VSUB(t1405, t1407);
+    t1411 = FFT_VMULNJ(t1408);
+    t1412 = FFT_VADD(t1406, t1411);
+    t1413 = FFT_VSUB(t1406, t1411);
+    t1414 = FFT_VADD(a[142], a[14]);
+    t1415 = FFT_VSUB(a[14], a[142]);
+    t1416 = FFT_VADD(a[206], a[78]);
+    t1417 = FFT_VSUB(a[78], a[206]);
+    t1418 = FFT_VADD(t1414, t1416);
+    t1419 = FFT_VSUB(t1414, t1416);
+    t1420 = FFT_VMULNJ(t1417);
+    t1421 = FFT_VADD(t1415, t1420);
+    t1422 = FFT_VSUB(t1415, t1420);
+    t1423 = FFT_VADD(a[158], a[30]);
+    t1424 = FFT_VSUB(a[30], a[158]);
+    t1425 = FFT_VADD(a[222], a[94]);
+    t1426 = FFT_VSUB(a[94], a[222]);
+    t1427 = FFT_VADD(t1423, t1425);
+    t1428 = FFT_VSUB(t1423, t1425);
+    t1429 = FFT_VMULNJ(t1426);
+    t1430 = FFT_VADD(t1424, t1429);
+    t1431 = FFT_VSUB(t1424, t1429);
+    t1432 = FFT_VADD(a[174], a[46]);
+    t1433 = FFT_VSUB(a[46], a[174]);
+    t1434 = FFT_VADD(a[110], a[238]);
+    t1435 = FFT_VSUB(a[110], a[238]);
+    t1436 = FFT_VADD(t1432, t1434);
+    t1437 = FFT_VSUB(t1432, t1434);
+    t1438 = FFT_VMULNJ(t1435);
+    t1439 = FFT_VADD(t1433, t1438);
+    t1440 = FFT_VSUB(t1433, t1438);
+    t1441 = FFT_VADD(a[190], a[62]);
+    t1442 = FFT_VSUB(a[62], a[190]);
+    t1443 = FFT_VADD(a[126], a[254]);
+    t1444 = FFT_VSUB(a[126], a[254]);
+    t1445 = FFT_VADD(t1441, t1443);
+    t1446 = FFT_VSUB(t1441, t1443);
+    t1447 = FFT_VMULNJ(t1444);
+    t1448 = FFT_VADD(t1442, t1447);
+    t1449 = FFT_VSUB(t1442, t1447);
+    t1450 = FFT_VADD(t1418, t1436);
+    t1451 = FFT_VSUB(t1418, t1436);
+    t1452 = FFT_VADD(t1427, t1445);
+    t1453 = FFT_VSUB(t1427, t1445);
+    t1454 = FFT_VADD(t1450, t1452);
+    t1455 = FFT_VSUB(t1450, t1452);
+    t1456 = FFT_VMULNJ(t1453);
+    t1457 = FFT_VADD(t1451, t1456);
+    t1458 = FFT_VSUB(t1451, t1456);
+    t1459 = FFT_VSCL(t1430, 0.9238795325112867);
+    t1460 = FFT_VMULNJ(t1430);
+    t1461 = FFT_VSCL(t1460, 0.3826834323650898);
+    t1462 = FFT_VADD(t1459, t1461);
+    t1463 = FFT_VMULNJ(t1439);
+    t1464 = FFT_VADD(t1439, t1463);
+    t1465 = FFT_VSCL(t1464, 0.7071067811865476);
+    t1466 = FFT_VSCL(t1448, 0.38268343236508984);
+    t1467 = FFT_VMULNJ(t1448);
+    t1468 = FFT_VSCL(t1467, 0.9238795325112867);
+    t1469 = FFT_VADD(t1466, t1468);
+    t1470 = FFT_VADD(t1421, t1465);
+    t1471 = FFT_VSUB(t1421, t1465);
+    t1472 = FFT_VADD(t1462, t1469);
+    t1473 = FFT_VSUB(t1462, t1469);
+    t1474 = FFT_VADD(t1470, t1472);
+    t1475 = FFT_VSUB(t1470, t1472);
+    t1476 = FFT_VMULNJ(t1473);
+    t1477 = FFT_VADD(t1471, t1476);
+    t1478 = FFT_VSUB(t1471, t1476);
+    t1479 = FFT_VMULNJ(t1428);
+    t1480 = FFT_VADD(t1428, t1479);
+    t1481 = FFT_VSCL(t1480, 0.7071067811865476);
+    t1482 = FFT_VMULNJ(t1437);
+    t1483 = FFT_VMULNJ(t1446);
+    t1484 = FFT_VSUB(t1446, t1483);
+    t1485 = FFT_VSCL(t1484, 0.7071067811865475);
+    t1486 = FFT_VADD(t1419, t1482);
+    t1487 = FFT_VSUB(t1419, t1482);
+    t1488 = FFT_VSUB(t1481, t1485);
+    t1489 = FFT_VADD(t1481, t1485);
+    t1490 = FFT_VADD(t1486, t1488);
+    t1491 = FFT_VSUB(t1486, t1488);
+    t1492 = FFT_VMULNJ(t1489);
+    t1493 = FFT_VADD(t1487, t1492);
+    t1494 = FFT_VSUB(t1487, t1492);
+    t1495 = FFT_VSCL(t1431, 0.38268343236508984);
+    t1496 = FFT_VMULNJ(t1431);
+    t1497 = FFT_VSCL(t1496, 0.9238795325112867);
+    t1498 = FFT_VADD(t1495, t1497);
+    t1499 = FFT_VMULNJ(t1440);
+    t1500 = FFT_VSUB(t1440, t1499);
+    t1501 = FFT_VSCL(t1500, 0.7071067811865475);
+    t1502 = FFT_VSCL(t1449, 0.9238795325112867);
+    t1503 = FFT_VMULNJ(t1449);
+    t1504 = FFT_VSCL(t1503, 0.3826834323650899);
+    t1505 = FFT_VADD(t1502, t1504);
+    t1506 = FFT_VSUB(t1422, t1501);
+    t1507 = FFT_VADD(t1422, t1501);
+    t1508 = FFT_VSUB(t1498, t1505);
+    t1509 = FFT_VADD(t1498, t1505);
+    t1510 = FFT_VADD(t1506, t1508);
+    t1511 = FFT_VSUB(t1506, t1508);
+    t1512 = FFT_VMULNJ(t1509);
+    t1513 = FFT_VADD(t1507, t1512);
+    t1514 = FFT_VSUB(t1507, t1512);
+    t1515 = FFT_VADD(a[143], a[15]);
+    t1516 = FFT_VSUB(a[15], a[143]);
+    t1517 = FFT_VADD(a[207], a[79]);
+    t1518 = FFT_VSUB(a[79], a[207]);
+    t1519 = FFT_VADD(t1515, t1517);
+    t1520 = FFT_VSUB(t1515, t1517);
+    t1521 = FFT_VMULNJ(t1518);
+    t1522 = FFT_VADD(t1516, t1521);
+    t1523 = FFT_VSUB(t1516, t1521);
+    t1524 = FFT_VADD(a[159], a[31]);
+    t1525 = FFT_VSUB(a[31], a[159]);
+    t1526 = FFT_VADD(a[223], a[95]);
+    t1527 = FFT_VSUB(a[95], a[223]);
+    t1528 = FFT_VADD(t1524, t1526);
+    t1529 = FFT_VSUB(t1524, t1526);
+    t1530 = FFT_VMULNJ(t1527);
+    t1531 = FFT_VADD(t1525, t1530);
+    t1532 = FFT_VSUB(t1525, t1530);
+    t1533 = FFT_VADD(a[175], a[47]);
+    t1534 = FFT_VSUB(a[47], a[175]);
+    t1535 = FFT_VADD(a[111], a[239]);
+    t1536 = FFT_VSUB(a[111], a[239]);
+    t1537 = FFT_VADD(t1533, t1535);
+    t1538 = FFT_VSUB(t1533, t1535);
+    t1539 = FFT_VMULNJ(t1536);
+    t1540 = FFT_VADD(t1534, t1539);
+    t1541 = FFT_VSUB(t1534, t1539);
+    t1542 = FFT_VADD(a[191], a[63]);
+    t1543 = FFT_VSUB(a[63], a[191]);
+    t1544 = FFT_VADD(a[127], a[255]);
+    t1545 = FFT_VSUB(a[127], a[255]);
+    t1546 = FFT_VADD(t1542, t1544);
+    t1547 = FFT_VSUB(t1542, t1544);
+    t1548 = FFT_VMULNJ(t1545);
+    t1549 = FFT_VADD(t1543, t1548);
+    t1550 = FFT_VSUB(t1543, t1548);
+    t1551 = FFT_VADD(t1519, t1537);
+    t1552 = FFT_VSUB(t1519, t1537);
+    t1553 = FFT_VADD(t1528, t1546);
+    t1554 = FFT_VSUB(t1528, t1546);
+    t1555 = FFT_VADD(t1551, t1553);
+    t1556 = FFT_VSUB(t1551, t1553);
+    t1557 = FFT_VMULNJ(t1554);
+    t1558 = FFT_VADD(t1552, t1557);
+    t1559 = FFT_VSUB(t1552, t1557);
+    t1560 = FFT_VSCL(t1531, 0.9238795325112867);
+    t1561 = FFT_VMULNJ(t1531);
+    t1562 = FFT_VSCL(t1561, 0.3826834323650898);
+    t1563 = FFT_VADD(t1560, t1562);
+    t1564 = FFT_VMULNJ(t1540);
+    t1565 = FFT_VADD(t1540, t1564);
+    t1566 = FFT_VSCL(t1565, 0.7071067811865476);
+    t1567 = FFT_VSCL(t1549, 0.38268343236508984);
+    t1568 = FFT_VMULNJ(t1549);
+    t1569 = FFT_VSCL(t1568, 0.9238795325112867);
+    t1570 = FFT_VADD(t1567, t1569);
+    t1571 = FFT_VADD(t1522, t1566);
+    t1572 = FFT_VSUB(t1522, t1566);
+    t1573 = FFT_VADD(t1563, t1570);
+    t1574 = FFT_VSUB(t1563, t1570);
+    t1575 = FFT_VADD(t1571, t1573);
+    t1576 = FFT_VSUB(t1571, t1573);
+    t1577 = FFT_VMULNJ(t1574);
+    t1578 = FFT_VADD(t1572, t1577);
+    t1579 = FFT_VSUB(t1572, t1577);
+    t1580 = FFT_VMULNJ(t1529);
+    t1581 = FFT_VADD(t1529, t1580);
+    t1582 = FFT_VSCL(t1581, 0.7071067811865476);
+    t1583 = FFT_VMULNJ(t1538);
+    t1584 = FFT_VMULNJ(t1547);
+    t1585 = FFT_VSUB(t1547, t1584);
+    t1586 = FFT_VSCL(t1585, 0.7071067811865475);
+    t1587 = FFT_VADD(t1520, t1583);
+    t1588 = FFT_VSUB(t1520, t1583);
+    t1589 = FFT_VSUB(t1582, t1586);
+    t1590 = FFT_VADD(t1582, t1586);
+    t1591 = FFT_VADD(t1587, t1589);
+    t1592 = FFT_VSUB(t1587, t1589);
+    t1593 = FFT_VMULNJ(t1590);
+    t1594 = FFT_VADD(t1588, t1593);
+    t1595 = FFT_VSUB(t1588, t1593);
+    t1596 = FFT_VSCL(t1532, 0.38268343236508984);
+    t1597 = FFT_VMULNJ(t1532);
+    t1598 = FFT_VSCL(t1597, 0.9238795325112867);
+    t1599 = FFT_VADD(t1596, t1598);
+    t1600 = FFT_VMULNJ(t1541);
+    t1601 = FFT_VSUB(t1541, t1600);
+    t1602 = FFT_VSCL(t1601, 0.7071067811865475);
+    t1603 = FFT_VSCL(t1550, 0.9238795325112867);
+    t1604 = FFT_VMULNJ(t1550);
+    t1605 = FFT_VSCL(t1604, 0.3826834323650899);
+    t1606 = FFT_VADD(t1603, t1605);
+    t1607 = FFT_VSUB(t1523, t1602);
+    t1608 = FFT_VADD(t1523, t1602);
+    t1609 = FFT_VSUB(t1599, t1606);
+    t1610 = FFT_VADD(t1599, t1606);
+    t1611 = FFT_VADD(t1607, t1609);
+    t1612 = FFT_VSUB(t1607, t1609);
+    t1613 = FFT_VMULNJ(t1610);
+    t1614 = FFT_VADD(t1608, t1613);
+    t1615 = FFT_VSUB(t1608, t1613);
+    t1616 = FFT_VADD(t40, t848);
+    t1617 = FFT_VSUB(t40, t848);
+    t1618 = FFT_VADD(t1252, t444);
+    t1619 = FFT_VSUB(t444, t1252);
+    t1620 = FFT_VADD(t1616, t1618);
+    t1621 = FFT_VSUB(t1616, t1618);
+    t1622 = FFT_VMULNJ(t1619);
+    t1623 = FFT_VADD(t1617, t1622);
+    t1624 = FFT_VSUB(t1617, t1622);
+    t1625 = FFT_VADD(t141, t949);
+    t1626 = FFT_VSUB(t141, t949);
+    t1627 = FFT_VADD(t1353, t545);
+    t1628 = FFT_VSUB(t545, t1353);
+    t1629 = FFT_VADD(t1625, t1627);
+    t1630 = FFT_VSUB(t1625, t1627);
+    t1631 = FFT_VMULNJ(t1628);
+    t1632 = FFT_VADD(t1626, t1631);
+    t1633 = FFT_VSUB(t1626, t1631);
+    t1634 = FFT_VADD(t1050, t242);
+    t1635 = FFT_VSUB(t242, t1050);
+    t1636 = FFT_VADD(t1454, t646);
+    t1637 = FFT_VSUB(t646, t1454);
+    t1638 = FFT_VADD(t1634, t1636);
+    t1639 = FFT_VSUB(t1634, t1636);
+    t1640 = FFT_VMULNJ(t1637);
+    t1641 = FFT_VADD(t1635, t1640);
+    t1642 = FFT_VSUB(t1635, t1640);
+    t1643 = FFT_VADD(t1151, t343);
+    t1644 = FFT_VSUB(t343, t1151);
+    t1645 = FFT_VADD(t1555, t747);
+    t1646 = FFT_VSUB(t747, t1555);
+    t1647 = FFT_VADD(t1643, t1645);
+    t1648 = FFT_VSUB(t1643, t1645);
+    t1649 = FFT_VMULNJ(t1646);
+    t1650 = FFT_VADD(t1644, t1649);
+    t1651 = FFT_VSUB(t1644, t1649);
+    t1652 = FFT_VADD(t1620, t1638);
+    t1653 = FFT_VSUB(t1620, t1638);
+    t1654 = FFT_VADD(t1629, t1647);
+    t1655 = FFT_VSUB(t1629, t1647);
+    t1656 = FFT_VADD(t1652, t1654);
+    t1657 = FFT_VSUB(t1652, t1654);
+    t1658 = FFT_VMULNJ(t1655);
+    t1659 = FFT_VADD(t1653, t1658);
+    t1660 = FFT_VSUB(t1653, t1658);
+    t1661 = FFT_VSCL(t1632, 0.9238795325112867);
+    t1662 = FFT_VMULNJ(t1632);
+    t1663 = FFT_VSCL(t1662, 0.3826834323650898);
+    t1664 = FFT_VADD(t1661, t1663);
+    t1665 = FFT_VMULNJ(t1641);
+    t1666 = FFT_VADD(t1641, t1665);
+    t1667 = FFT_VSCL(t1666, 0.7071067811865476);
+    t1668 = FFT_VSCL(t1650, 0.38268343236508984);
+    t1669 = FFT_VMULNJ(t1650);
+    t1670 = FFT_VSCL(t1669, 0.9238795325112867);
+    t1671 = FFT_VADD(t1668, t1670);
+    t1672 = FFT_VADD(t1623, t1667);
+    t1673 = FFT_VSUB(t1623, t1667);
+    t1674 = FFT_VADD(t1664, t1671);
+    t1675 = FFT_VSUB(t1664, t1671);
+    t1676 = FFT_VADD(t1672, t1674);
+    t1677 = FFT_VSUB(t1672, t1674);
+    t1678 = FFT_VMULNJ(t1675);
+    t1679 = FFT_VADD(t1673, t1678);
+    t1680 = FFT_VSUB(t1673, t1678);
+    t1681 = FFT_VMULNJ(t1630);
+    t1682 = FFT_VADD(t1630, t1681);
+    t1683 = FFT_VSCL(t1682, 0.7071067811865476);
+    t1684 = FFT_VMULNJ(t1639);
+    t1685 = FFT_VMULNJ(t1648);
+    t1686 = FFT_VSUB(t1648, t1685);
+    t1687 = FFT_VSCL(t1686, 0.7071067811865475);
+    t1688 = FFT_VADD(t1621, t1684);
+    t1689 = FFT_VSUB(t1621, t1684);
+    t1690 = FFT_VSUB(t1683, t1687);
+    t1691 = FFT_VADD(t1683, t1687);
+    t1692 = FFT_VADD(t1688, t1690);
+    t1693 = FFT_VSUB(t1688, t1690);
+    t1694 = FFT_VMULNJ(t1691);
+    t1695 = FFT_VADD(t1689, t1694);
+    t1696 = FFT_VSUB(t1689, t1694);
+    t1697 = FFT_VSCL(t1633, 0.38268343236508984);
+    t1698 = FFT_VMULNJ(t1633);
+    t1699 = FFT_VSCL(t1698, 0.9238795325112867);
+    t1700 = FFT_VADD(t1697, t1699);
+    t1701 = FFT_VMULNJ(t1642);
+    t1702 = FFT_VSUB(t1642, t1701);
+    t1703 = FFT_VSCL(t1702, 0.7071067811865475);
+    t1704 = FFT_VSCL(t1651, 0.9238795325112867);
+    t1705 = FFT_VMULNJ(t1651);
+    t1706 = FFT_VSCL(t1705, 0.3826834323650899);
+    t1707 = FFT_VADD(t1704, t1706);
+    t1708 = FFT_VSUB(t1624, t1703);
+    t1709 = FFT_VADD(t1624, t1703);
+    t1710 = FFT_VSUB(t1700, t1707);
+    t1711 = FFT_VADD(t1700, t1707);
+    t1712 = FFT_VADD(t1708, t1710);
+    t1713 = FFT_VSUB(t1708, t1710);
+    t1714 = FFT_VMULNJ(t1711);
+    t1715 = FFT_VADD(t1709, t1714);
+    t1716 = FFT_VSUB(t1709, t1714);
+    t1717 = FFT_VSCL(t161, 0.9996988186962042);
+    t1718 = FFT_VMULNJ(t161);
+    t1719 = FFT_VSCL(t1718, 0.024541228522912288);
+    t1720 = FFT_VADD(t1717, t1719);
+    t1721 = FFT_VSCL(t262, 0.9987954562051724);
+    t1722 = FFT_VMULNJ(t262);
+    t1723 = FFT_VSCL(t1722, 0.049067674327418015);
+    t1724 = FFT_VADD(t1721, t1723);
+    t1725 = FFT_VSCL(t363, 0.9972904566786902);
+    t1726 = FFT_VMULNJ(t363);
+    t1727 = FFT_VSCL(t1726, 0.07356456359966743);
+    t1728 = FFT_VADD(t1725, t1727);
+    t1729 = FFT_VSCL(t464, 0.9951847266721969);
+    t1730 = FFT_VMULNJ(t464);
+    t1731 = FFT_VSCL(t1730, 0.0980171403295606);
+    t1732 = FFT_VADD(t1729, t1731);
+    t1733 = FFT_VSCL(t565, 0.99247953459871);
+    t1734 = FFT_VMULNJ(t565);
+    t1735 = FFT_VSCL(t1734, 0.1224106751992162);
+    t1736 = FFT_VADD(t1733, t1735);
+    t1737 = FFT_VSCL(t666, 0.989176509964781);
+    t1738 = FFT_VMULNJ(t666);
+    t1739 = FFT_VSCL(t1738, 0.14673047445536175);
+    t1740 = FFT_VADD(t1737, t1739);
+    t1741 = FFT_VSCL(t767, 0.9852776423889412);
+    t1742 = FFT_VMULNJ(t767);
+    t1743 = FFT_VSCL(t1742, 0.17096188876030122);
+    t1744 = FFT_VADD(t1741, t1743);
+    t1745 = FFT_VSCL(t868, 0.9807852804032304);
+    t1746 = FFT_VMULNJ(t868);
+    t1747 = FFT_VSCL(t1746, 0.19509032201612825);
+    t1748 = FFT_VADD(t1745, t1747);
+    t1749 = FFT_VSCL(t969, 0.9757021300385286);
+    t1750 = FFT_VMULNJ(t969);
+    t1751 = FFT_VSCL(t1750, 0.2191012401568698);
+    t1752 = FFT_VADD(t1749, t1751);
+    t1753 = FFT_VSCL(t1070, 0.970031253194544);
+    t1754 = FFT_VMULNJ(t1070);
+    t1755 = FFT_VSCL(t1754, 0.24298017990326387);
+    t1756 = FFT_VADD(t1753, t1755);
+    t1757 = FFT_VSCL(t1171, 0.9637760657954398);
+    t1758 = FFT_VMULNJ(t1171);
+    t1759 = FFT_VSCL(t1758, 0.26671275747489837);
+    t1760 = FFT_VADD(t1757, t1759);
+    t1761 = FFT_VSCL(t1272, 0.9569403357322088);
+    t1762 = FFT_VMULNJ(t1272);
+    t1763 = FFT_VSCL(t1762, 0.29028467725446233);
+    t1764 = FFT_VADD(t1761, t1763);
+    t1765 = FFT_VSCL(t1373, 0.9495281805930367);
+    t1766 = FFT_VMULNJ(t1373);
+    t1767 = FFT_VSCL(t1766, 0.3136817403988915);
+    t1768 = FFT_VADD(t1765, t1767);
+    t1769 = FFT_VSCL(t1474, 0.9415440651830208);
+    t1770 = FFT_VMULNJ(t1474);
+    t1771 = FFT_VSCL(t1770, 0.33688985339222005);
+    t1772 = FFT_VADD(t1769, t1771);
+    t1773 = FFT_VSCL(t1575, 0.932992798834739);
+    t1774 = FFT_VMULNJ(t1575);
+    t1775 = FFT_VSCL(t1774, 0.3598950365349881);
+    t1776 = FFT_VADD(t1773, t1775);
+    t1777 = FFT_VADD(t1748, t60);
+    t1778 = FFT_VSUB(t60, t1748);
+    t1779 = FFT_VADD(t1732, t1764);
+    t1780 = FFT_VSUB(t1732, t1764);
+    t1781 = FFT_VADD(t1777, t1779);
+    t1782 = FFT_VSUB(t1777, t1779);
+    t1783 = FFT_VMULNJ(t1780);
+    t1784 = FFT_VADD(t1778, t1783);
+    t1785 = FFT_VSUB(t1778, t1783);
+    t1786 = FFT_VADD(t1720, t1752);
+    t1787 = FFT_VSUB(t1720, t1752);
+    t1788 = FFT_VADD(t1736, t1768);
+    t1789 = FFT_VSUB(t1736, t1768);
+    t1790 = FFT_VADD(t1786, t1788);
+    t1791 = FFT_VSUB(t1786, t1788);
+    t1792 = FFT_VMULNJ(t1789);
+    t1793 = FFT_VADD(t1787, t1792);
+    t1794 = FFT_VSUB(t1787, t1792);
+    t1795 = FFT_VADD(t1724, t1756);
+    t1796 = FFT_VSUB(t1724, t1756);
+    t1797 = FFT_VADD(t1740, t1772);
+    t1798 = FFT_VSUB(t1740, t1772);
+    t1799 = FFT_VADD(t1795, t1797);
+    t1800 = FFT_VSUB(t1795, t1797);
+    t1801 = FFT_VMULNJ(t1798);
+    t1802 = FFT_VADD(t1796, t1801);
+    t1803 = FFT_VSUB(t1796, t1801);
+    t1804 = FFT_VADD(t1728, t1760);
+    t1805 = FFT_VSUB(t1728, t1760);
+    t1806 = FFT_VADD(t1744, t1776);
+    t1807 = FFT_VSUB(t1744, t1776);
+    t1808 = FFT_VADD(t1804, t1806);
+    t1809 = FFT_VSUB(t1804, t1806);
+    t1810 = FFT_VMULNJ(t1807);
+    t1811 = FFT_VADD(t1805, t1810);
+    t1812 = FFT_VSUB(t1805, t1810);
+    t1813 = FFT_VADD(t1781, t1799);
+    t1814 = FFT_VSUB(t1781, t1799);
+    t1815 = FFT_VADD(t1790, t1808);
+    t1816 = FFT_VSUB(t1790, t1808);
+    t1817 = FFT_VADD(t1813, t1815);
+    t1818 = FFT_VSUB(t1813, t1815);
+    t1819 = FFT_VMULNJ(t1816);
+    t1820 = FFT_VADD(t1814, t1819);
+    t1821 = FFT_VSUB(t1814, t1819);
+    t1822 = FFT_VSCL(t1793, 0.9238795325112867);
+    t1823 = FFT_VMULNJ(t1793);
+    t1824 = FFT_VSCL(t1823, 0.3826834323650898);
+    t1825 = FFT_VADD(t1822, t1824);
+    t1826 = FFT_VMULNJ(t1802);
+    t1827 = FFT_VADD(t1802, t1826);
+    t1828 = FFT_VSCL(t1827, 0.7071067811865476);
+    t1829 = FFT_VSCL(t1811, 0.38268343236508984);
+    t1830 = FFT_VMULNJ(t1811);
+    t1831 = FFT_VSCL(t1830, 0.9238795325112867);
+    t1832 = FFT_VADD(t1829, t1831);
+    t1833 = FFT_VADD(t1784, t1828);
+    t1834 = FFT_VSUB(t1784, t1828);
+    t1835 = FFT_VADD(t1825, t1832);
+    t1836 = FFT_VSUB(t1825, t1832);
+    t1837 = FFT_VADD(t1833, t1835);
+    t1838 = FFT_VSUB(t1833, t1835);
+    t1839 = FFT_VMULNJ(t1836);
+    t1840 = FFT_VADD(t1834, t1839);
+    t1841 = FFT_VSUB(t1834, t1839);
+    t1842 = FFT_VMULNJ(t1791);
+    t1843 = FFT_VADD(t1791, t1842);
+    t1844 = FFT_VSCL(t1843, 0.7071067811865476);
+    t1845 = FFT_VMULNJ(t1800);
+    t1846 = FFT_VMULNJ(t1809);
+    t1847 = FFT_VSUB(t1809, t1846);
+    t1848 = FFT_VSCL(t1847, 0.7071067811865475);
+    t1849 = FFT_VADD(t1782, t1845);
+    t1850 = FFT_VSUB(t1782, t1845);
+    t1851 = FFT_VSUB(t1844, t1848);
+    t1852 = FFT_VADD(t1844, t1848);
+    t1853 = FFT_VADD(t1849, t1851);
+    t1854 = FFT_VSUB(t1849, t1851);
+    t1855 = FFT_VMULNJ(t1852);
+    t1856 = FFT_VADD(t1850, t1855);
+    t1857 = FFT_VSUB(t1850, t1855);
+    t1858 = FFT_VSCL(t1794, 0.38268343236508984);
+    t1859 = FFT_VMULNJ(t1794);
+    t1860 = FFT_VSCL(t1859, 0.9238795325112867);
+    t1861 = FFT_VADD(t1858, t1860);
+    t1862 = FFT_VMULNJ(t1803);
+    t1863 = FFT_VSUB(t1803, t1862);
+    t1864 = FFT_VSCL(t1863, 0.7071067811865475);
+    t1865 = FFT_VSCL(t1812, 0.9238795325112867);
+    t1866 = FFT_VMULNJ(t1812);
+    t1867 = FFT_VSCL(t1866, 0.3826834323650899);
+    t1868 = FFT_VADD(t1865, t1867);
+    t1869 = FFT_VSUB(t1785, t1864);
+    t1870 = FFT_VADD(t1785, t1864);
+    t1871 = FFT_VSUB(t1861, t1868);
+    t1872 = FFT_VADD(t1861, t1868);
+    t1873 = FFT_VADD(t1869, t1871);
+    t1874 = FFT_VSUB(t1869, t1871);
+    t1875 = FFT_VMULNJ(t1872);
+    t1876 = FFT_VADD(t1870, t1875);
+    t1877 = FFT_VSUB(t1870, t1875);
+    t1878 = FFT_VSCL(t177, 0.9987954562051724);
+    t1879 = FFT_VMULNJ(t177);
+    t1880 = FFT_VSCL(t1879, 0.049067674327418015);
+    t1881 = FFT_VADD(t1878, t1880);
+    t1882 = FFT_VSCL(t278, 0.9951847266721969);
+    t1883 = FFT_VMULNJ(t278);
+    t1884 = FFT_VSCL(t1883, 0.0980171403295606);
+    t1885 = FFT_VADD(t1882, t1884);
+    t1886 = FFT_VSCL(t379, 0.989176509964781);
+    t1887 = FFT_VMULNJ(t379);
+    t1888 = FFT_VSCL(t1887, 0.14673047445536175);
+    t1889 = FFT_VADD(t1886, t1888);
+    t1890 = FFT_VSCL(t480, 0.9807852804032304);
+    t1891 = FFT_VMULNJ(t480);
+    t1892 = FFT_VSCL(t1891, 0.19509032201612825);
+    t1893 = FFT_VADD(t1890, t1892);
+    t1894 = FFT_VSCL(t581, 0.970031253194544);
+    t1895 = FFT_VMULNJ(t581);
+    t1896 = FFT_VSCL(t1895, 0.24298017990326387);
+    t1897 = FFT_VADD(t1894, t1896);
+    t1898 = FFT_VSCL(t682, 0.9569403357322088);
+    t1899 = FFT_VMULNJ(t682);
+    t1900 = FFT_VSCL(t1899, 0.29028467725446233);
+    t1901 = FFT_VADD(t1898, t1900);
+    t1902 = FFT_VSCL(t783, 0.9415440651830208);
+    t1903 = FFT_VMULNJ(t783);
+    t1904 = FFT_VSCL(t1903, 0.33688985339222005);
+    t1905 = FFT_VADD(t1902, t1904);
+    t1906 = FFT_VSCL(t884, 0.9238795325112867);
+    t1907 = FFT_VMULNJ(t884);
+    t1908 = FFT_VSCL(t1907, 0.3826834323650898);
+    t1909 = FFT_VADD(t1906, t1908);
+    t1910 = FFT_VSCL(t985, 0.9039892931234433);
+    t1911 = FFT_VMULNJ(t985);
+    t1912 = FFT_VSCL(t1911, 0.4275550934302821);
+    t1913 = FFT_VADD(t1910, t1912);
+    t1914 = FFT_VSCL(t1086, 0.881921264348355);
+    t1915 = FFT_VMULNJ(t1086);
+    t1916 = FFT_VSCL(t1915, 0.47139673682599764);
+    t1917 = FFT_VADD(t1914, t1916);
+    t1918 = FFT_VSCL(t1187, 0.8577286100002721);
+    t1919 = FFT_VMULNJ(t1187);
+    t1920 = FFT_VSCL(t1919, 0.5141027441932217);
+    t1921 = FFT_VADD(t1918, t1920);
+    t1922 = FFT_VSCL(t1288, 0.8314696123025452);
+    t1923 = FFT_VMULNJ(t1288);
+    t1924 = FFT_VSCL(t1923, 0.5555702330196022);
+    t1925 = FFT_VADD(t1922, t1924);
+    t1926 = FFT_VSCL(t1389, 0.8032075314806449);
+    t1927 = FFT_VMULNJ(t1389);
+    t1928 = FFT_VSCL(t1927, 0.5956993044924334);
+    t1929 = FFT_VADD(t1926, t1928);
+    t1930 = FFT_VSCL(t1490, 0.773010453362737);
+    t1931 = FFT_VMULNJ(t1490);
+    t1932 = FFT_VSCL(t1931, 0.6343932841636455);
+    t1933 = FFT_VADD(t1930, t1932);
+    t1934 = FFT_VSCL(t1591, 0.7409511253549591);
+    t1935 = FFT_VMULNJ(t1591);
+    t1936 = FFT_VSCL(t1935, 0.6715589548470183);
+    t1937 = FFT_VADD(t1934, t1936);
+    t1938 = FFT_VADD(t1909, t76);
+    t1939 = FFT_VSUB(t76, t1909);
+    t1940 = FFT_VADD(t1893, t1925);
+    t1941 = FFT_VSUB(t1893, t1925);
+    t1942 = FFT_VADD(t1938, t1940);
+    t1943 = FFT_VSUB(t1938, t1940);
+    t1944 = FFT_VMULNJ(t1941);
+    t1945 = FFT_VADD(t1939, t1944);
+    t1946 = FFT_VSUB(t1939, t1944);
+    t1947 = FFT_VADD(t1881, t1913);
+    t1948 = FFT_VSUB(t1881, t1913);
+    t1949 = FFT_VADD(t1897, t1929);
+    t1950 = FFT_VSUB(t1897, t1929);
+    t1951 = FFT_VADD(t1947, t1949);
+    t1952 = FFT_VSUB(t1947, t1949);
+    t1953 = FFT_VMULNJ(t1950);
+    t1954 = FFT_VADD(t1948, t1953);
+    t1955 = FFT_VSUB(t1948, t1953);
+    t1956 = FFT_VADD(t1885, t1917);
+    t1957 = FFT_VSUB(t1885, t1917);
+    t1958 = FFT_VADD(t1901, t1933);
+    t1959 = FFT_VSUB(t1901, t1933);
+    t1960 = FFT_VADD(t1956, t1958);
+    t1961 = FFT_VSUB(t1956, t1958);
+    t1962 = FFT_VMULNJ(t1959);
+    t1963 = FFT_VADD(t1957, t1962);
+    t1964 = FFT_VSUB(t1957, t1962);
+    t1965 = FFT_VADD(t1889, t1921);
+    t1966 = FFT_VSUB(t1889, t1921);
+    t1967 = FFT_VADD(t1905, t1937);
+    t1968 = FFT_VSUB(t1905, t1937);
+    t1969 = FFT_VADD(t1965, t1967);
+    t1970 = FFT_VSUB(t1965, t1967);
+    t1971 = FFT_VMULNJ(t1968);
+    t1972 = FFT_VADD(t1966, t1971);
+    t1973 = FFT_VSUB(t1966, t1971);
+    t1974 = FFT_VADD(t1942, t1960);
+    t1975 = FFT_VSUB(t1942, t1960);
+    t1976 = FFT_VADD(t1951, t1969);
+    t1977 = FFT_VSUB(t1951, t1969);
+    t1978 = FFT_VADD(t1974, t1976);
+    t1979 = FFT_VSUB(t1974, t1976);
+    t1980 = FFT_VMULNJ(t1977);
+    t1981 = FFT_VADD(t1975, t1980);
+    t1982 = FFT_VSUB(t1975, t1980);
+    t1983 = FFT_VSCL(t1954, 0.9238795325112867);
+    t1984 = FFT_VMULNJ(t1954);
+    t1985 = FFT_VSCL(t1984, 0.3826834323650898);
+    t1986 = FFT_VADD(t1983, t1985);
+    t1987 = FFT_VMULNJ(t1963);
+    t1988 = FFT_VADD(t1963, t1987);
+    t1989 = FFT_VSCL(t1988, 0.7071067811865476);
+    t1990 = FFT_VSCL(t1972, 0.38268343236508984);
+    t1991 = FFT_VMULNJ(t1972);
+    t1992 = FFT_VSCL(t1991, 0.9238795325112867);
+    t1993 = FFT_VADD(t1990, t1992);
+    t1994 = FFT_VADD(t1945, t1989);
+    t1995 = FFT_VSUB(t1945, t1989);
+    t1996 = FFT_VADD(t1986, t1993);
+    t1997 = FFT_VSUB(t1986, t1993);
+    t1998 = FFT_VADD(t1994, t1996);
+    t1999 = FFT_VSUB(t1994, t1996);
+    t2000 = FFT_VMULNJ(t1997);
+    t2001 = FFT_VADD(t1995, t2000);
+    t2002 = FFT_VSUB(t1995, t2000);
+    t2003 = FFT_VMULNJ(t1952);
+    t2004 = FFT_VADD(t1952, t2003);
+    t2005 = FFT_VSCL(t2004, 0.7071067811865476);
+    t2006 = FFT_VMULNJ(t1961);
+    t2007 = FFT_VMULNJ(t1970);
+    t2008 = FFT_VSUB(t1970, t2007);
+    t2009 = FFT_VSCL(t2008, 0.7071067811865475);
+    t2010 = FFT_VADD(t1943, t2006);
+    t2011 = FFT_VSUB(t1943, t2006);
+    t2012 = FFT_VSUB(t2005, t2009);
+    t2013 = FFT_VADD(t2005, t2009);
+    t2014 = FFT_VADD(t2010, t2012);
+    t2015 = FFT_VSUB(t2010, t2012);
+    t2016 = FFT_VMULNJ(t2013);
+    t2017 = FFT_VADD(t2011, t2016);
+    t2018 = FFT_VSUB(t2011, t2016);
+    t2019 = FFT_VSCL(t1955, 0.38268343236508984);
+    t2020 = FFT_VMULNJ(t1955);
+    t2021 = FFT_VSCL(t2020, 0.9238795325112867);
+    t2022 = FFT_VADD(t2019, t2021);
+    t2023 = FFT_VMULNJ(t1964);
+    t2024 = FFT_VSUB(t1964, t2023);
+    t2025 = FFT_VSCL(t2024, 0.7071067811865475);
+    t2026 = FFT_VSCL(t1973, 0.9238795325112867);
+    t2027 = FFT_VMULNJ(t1973);
+    t2028 = FFT_VSCL(t2027, 0.3826834323650899);
+    t2029 = FFT_VADD(t2026, t2028);
+    t2030 = FFT_VSUB(t1946, t2025);
+    t2031 = FFT_VADD(t1946, t2025);
+    t2032 = FFT_VSUB(t2022, t2029);
+    t2033 = FFT_VADD(t2022, t2029);
+    t2034 = FFT_VADD(t2030, t2032);
+    t2035 = FFT_VSUB(t2030, t2032);
+    t2036 = FFT_VMULNJ(t2033);
+    t2037 = FFT_VADD(t2031, t2036);
+    t2038 = FFT_VSUB(t2031, t2036);
+    t2039 = FFT_VSCL(t197, 0.9972904566786902);
+    t2040 = FFT_VMULNJ(t197);
+    t2041 = FFT_VSCL(t2040, 0.07356456359966743);
+    t2042 = FFT_VADD(t2039, t2041);
+    t2043 = FFT_VSCL(t298, 0.989176509964781);
+    t2044 = FFT_VMULNJ(t298);
+    t2045 = FFT_VSCL(t2044, 0.14673047445536175);
+    t2046 = FFT_VADD(t2043, t2045);
+    t2047 = FFT_VSCL(t399, 0.9757021300385286);
+    t2048 = FFT_VMULNJ(t399);
+    t2049 = FFT_VSCL(t2048, 0.2191012401568698);
+    t2050 = FFT_VADD(t2047, t2049);
+    t2051 = FFT_VSCL(t500, 0.9569403357322088);
+    t2052 = FFT_VMULNJ(t500);
+    t2053 = FFT_VSCL(t2052, 0.29028467725446233);
+    t2054 = FFT_VADD(t2051, t2053);
+    t2055 = FFT_VSCL(t601, 0.932992798834739);
+    t2056 = FFT_VMULNJ(t601);
+    t2057 = FFT_VSCL(t2056, 0.3598950365349881);
+    t2058 = FFT_VADD(t2055, t2057);
+    t2059 = FFT_VSCL(t702, 0.9039892931234433);
+    t2060 = FFT_VMULNJ(t702);
+    t2061 = FFT_VSCL(t2060, 0.4275550934302821);
+    t2062 = FFT_VADD(t2059, t2061);
+    t2063 = FFT_VSCL(t803, 0.8700869911087115);
+    t2064 = FFT_VMULNJ(t803);
+    t2065 = FFT_VSCL(t2064, 0.49289819222978404);
+    t2066 = FFT_VADD(t2063, t2065);
+    t2067 = FFT_VSCL(t904, 0.8314696123025452);
+    t2068 = FFT_VMULNJ(t904);
+    t2069 = FFT_VSCL(t2068, 0.5555702330196022);
+    t2070 = FFT_VADD(t2067, t2069);
+    t2071 = FFT_VSCL(t1005, 0.7883464276266063);
+    t2072 = FFT_VMULNJ(t1005);
+    t2073 = FFT_VSCL(t2072, 0.6152315905806268);
+    t2074 = FFT_VADD(t2071, t2073);
+    t2075 = FFT_VSCL(t1106, 0.7409511253549591);
+    t2076 = FFT_VMULNJ(t1106);
+    t2077 = FFT_VSCL(t2076, 0.6715589548470183);
+    t2078 = FFT_VADD(t2075, t2077);
+    t2079 = FFT_VSCL(t1207, 0.6895405447370669);
+    t2080 = FFT_VMULNJ(t1207);
+    t2081 = FFT_VSCL(t2080, 0.7242470829514669);
+    t2082 = FFT_VADD(t2079, t2081);
+    t2083 = FFT_VSCL(t1308, 0.6343932841636455);
+    t2084 = FFT_VMULNJ(t1308);
+    t2085 = FFT_VSCL(t2084, 0.773010453362737);
+    t2086 = FFT_VADD(t2083, t2085);
+    t2087 = FFT_VSCL(t1409, 0.5758081914178453);
+    t2088 = FFT_VMULNJ(t1409);
+    t2089 = FFT_VSCL(t2088, 0.8175848131515837);
+    t2090 = FFT_VADD(t2087, t2089);
+    t2091 = FFT_VSCL(t1510, 0.5141027441932217);
+    t2092 = FFT_VMULNJ(t1510);
+    t2093 = FFT_VSCL(t2092, 0.8577286100002721);
+    t2094 = FFT_VADD(t2091, t2093);
+    t2095 = FFT_VSCL(t1611, 0.4496113296546066);
+    t2096 = FFT_VMULNJ(t1611);
+    t2097 = FFT_VSCL(t2096, 0.8932243011955153);
+    t2098 = FFT_VADD(t2095, t2097);
+    t2099 = FFT_VADD(t2070, t96);
+    t2100 = FFT_VSUB(t96, t2070);
+    t2101 = FFT_VADD(t2054, t2086);
+    t2102 = FFT_VSUB(t2054, t2086);
+    t2103 = FFT_VADD(t2099, t2101);
+    t2104 = FFT_VSUB(t2099, t2101);
+    t2105 = FFT_VMULNJ(t2102);
+    t2106 = FFT_VADD(t2100, t2105);
+    t2107 = FFT_VSUB(t2100, t2105);
+    t2108 = FFT_VADD(t2042, t2074);
+    t2109 = FFT_VSUB(t2042, t2074);
+    t2110 = FFT_VADD(t2058, t2090);
+    t2111 = FFT_VSUB(t2058, t2090);
+    t2112 = FFT_VADD(t2108, t2110);
+    t2113 = FFT_VSUB(t2108, t2110);
+    t2114 = FFT_VMULNJ(t2111);
+    t2115 = FFT_VADD(t2109, t2114);
+    t2116 = FFT_VSUB(t2109, t2114);
+    t2117 = FFT_VADD(t2046, t2078);
+    t2118 = FFT_VSUB(t2046, t2078);
+    t2119 = FFT_VADD(t2062, t2094);
+    t2120 = FFT_VSUB(t2062, t2094);
+    t2121 = FFT_VADD(t2117, t2119);
+    t2122 = FFT_VSUB(t2117, t2119);
+    t2123 = FFT_VMULNJ(t2120);
+    t2124 = FFT_VADD(t2118, t2123);
+    t2125 = FFT_VSUB(t2118, t2123);
+    t2126 = FFT_VADD(t2050, t2082);
+    t2127 = FFT_VSUB(t2050, t2082);
+    t2128 = FFT_VADD(t2066, t2098);
+    t2129 = FFT_VSUB(t2066, t2098);
+    t2130 = FFT_VADD(t2126, t2128);
+    t2131 = FFT_VSUB(t2126, t2128);
+    t2132 = FFT_VMULNJ(t2129);
+    t2133 = FFT_VADD(t2127, t2132);
+    t2134 = FFT_VSUB(t2127, t2132);
+    t2135 = FFT_VADD(t2103, t2121);
+    t2136 = FFT_VSUB(t2103, t2121);
+    t2137 = FFT_VADD(t2112, t2130);
+    t2138 = FFT_VSUB(t2112, t2130);
+    t2139 = FFT_VADD(t2135, t2137);
+    t2140 = FFT_VSUB(t2135, t2137);
+    t2141 = FFT_VMULNJ(t2138);
+    t2142 = FFT_VADD(t2136, t2141);
+    t2143 = FFT_VSUB(t2136, t2141);
+    t2144 = FFT_VSCL(t2115, 0.9238795325112867);
+    t2145 = FFT_VMULNJ(t2115);
+    t2146 = FFT_VSCL(t2145, 0.3826834323650898);
+    t2147 = FFT_VADD(t2144, t2146);
+    t2148 = FFT_VMULNJ(t2124);
+    t2149 = FFT_VADD(t2124, t2148);
+    t2150 = FFT_VSCL(t2149, 0.7071067811865476);
+    t2151 = FFT_VSCL(t2133, 0.38268343236508984);
+    t2152 = FFT_VMULNJ(t2133);
+    t2153 = FFT_VSCL(t2152, 0.9238795325112867);
+    t2154 = FFT_VADD(t2151, t2153);
+    t2155 = FFT_VADD(t2106, t2150);
+    t2156 = FFT_VSUB(t2106, t2150);
+    t2157 = FFT_VADD(t2147, t2154);
+    t2158 = FFT_VSUB(t2147, t2154);
+    t2159 = FFT_VADD(t2155, t2157);
+    t2160 = FFT_VSUB(t2155, t2157);
+    t2161 = FFT_VMULNJ(t2158);
+    t2162 = FFT_VADD(t2156, t2161);
+    t2163 = FFT_VSUB(t2156, t2161);
+    t2164 = FFT_VMULNJ(t2113);
+    t2165 = FFT_VADD(t2113, t2164);
+    t2166 = FFT_VSCL(t2165, 0.7071067811865476);
+    t2167 = FFT_VMULNJ(t2122);
+    t2168 = FFT_VMULNJ(t2131);
+    t2169 = FFT_VSUB(t2131, t2168);
+    t2170 = FFT_VSCL(t2169, 0.7071067811865475);
+    t2171 = FFT_VADD(t2104, t2167);
+    t2172 = FFT_VSUB(t2104, t2167);
+    t2173 = FFT_VSUB(t2166, t2170);
+    t2174 = FFT_VADD(t2166, t2170);
+    t2175 = FFT_VADD(t2171, t2173);
+    t2176 = FFT_VSUB(t2171, t2173);
+    t2177 = FFT_VMULNJ(t2174);
+    t2178 = FFT_VADD(t2172, t2177);
+    t2179 = FFT_VSUB(t2172, t2177);
+    t2180 = FFT_VSCL(t2116, 0.38268343236508984);
+    t2181 = FFT_VMULNJ(t2116);
+    t2182 = FFT_VSCL(t2181, 0.9238795325112867);
+    t2183 = FFT_VADD(t2180, t2182);
+    t2184 = FFT_VMULNJ(t2125);
+    t2185 = FFT_VSUB(t2125, t2184);
+    t2186 = FFT_VSCL(t2185, 0.7071067811865475);
+    t2187 = FFT_VSCL(t2134, 0.9238795325112867);
+    t2188 = FFT_VMULNJ(t2134);
+    t2189 = FFT_VSCL(t2188, 0.3826834323650899);
+    t2190 = FFT_VADD(t2187, t2189);
+    t2191 = FFT_VSUB(t2107, t2186);
+    t2192 = FFT_VADD(t2107, t2186);
+    t2193 = FFT_VSUB(t2183, t2190);
+    t2194 = FFT_VADD(t2183, t2190);
+    t2195 = FFT_VADD(t2191, t2193);
+    t2196 = FFT_VSUB(t2191, t2193);
+    t2197 = FFT_VMULNJ(t2194);
+    t2198 = FFT_VADD(t2192, t2197);
+    t2199 = FFT_VSUB(t2192, t2197);
+    t2200 = FFT_VSCL(t144, 0.9951847266721969);
+    t2201 = FFT_VMULNJ(t144);
+    t2202 = FFT_VSCL(t2201, 0.0980171403295606);
+    t2203 = FFT_VADD(t2200, t2202);
+    t2204 = FFT_VSCL(t245, 0.9807852804032304);
+    t2205 = FFT_VMULNJ(t245);
+    t2206 = FFT_VSCL(t2205, 0.19509032201612825);
+    t2207 = FFT_VADD(t2204, t2206);
+    t2208 = FFT_VSCL(t346, 0.9569403357322088);
+    t2209 = FFT_VMULNJ(t346);
+    t2210 = FFT_VSCL(t2209, 0.29028467725446233);
+    t2211 = FFT_VADD(t2208, t2210);
+    t2212 = FFT_VSCL(t447, 0.9238795325112867);
+    t2213 = FFT_VMULNJ(t447);
+    t2214 = FFT_VSCL(t2213, 0.3826834323650898);
+    t2215 = FFT_VADD(t2212, t2214);
+    t2216 = FFT_VSCL(t548, 0.881921264348355);
+    t2217 = FFT_VMULNJ(t548);
+    t2218 = FFT_VSCL(t2217, 0.47139673682599764);
+    t2219 = FFT_VADD(t2216, t2218);
+    t2220 = FFT_VSCL(t649, 0.8314696123025452);
+    t2221 = FFT_VMULNJ(t649);
+    t2222 = FFT_VSCL(t2221, 0.5555702330196022);
+    t2223 = FFT_VADD(t2220, t2222);
+    t2224 = FFT_VSCL(t750, 0.773010453362737);
+    t2225 = FFT_VMULNJ(t750);
+    t2226 = FFT_VSCL(t2225, 0.6343932841636455);
+    t2227 = FFT_VADD(t2224, t2226);
+    t2228 = FFT_VMULNJ(t851);
+    t2229 = FFT_VADD(t2228, t851);
+    t2230 = FFT_VSCL(t2229, 0.7071067811865476);
+    t2231 = FFT_VSCL(t952, 0.6343932841636455);
+    t2232 = FFT_VMULNJ(t952);
+    t2233 = FFT_VSCL(t2232, 0.773010453362737);
+    t2234 = FFT_VADD(t2231, t2233);
+    t2235 = FFT_VSCL(t1053, 0.5555702330196023);
+    t2236 = FFT_VMULNJ(t1053);
+    t2237 = FFT_VSCL(t2236, 0.8314696123025452);
+    t2238 = FFT_VADD(t2235, t2237);
+    t2239 = FFT_VSCL(t1154, 0.4713967368259978);
+    t2240 = FFT_VMULNJ(t1154);
+    t2241 = FFT_VSCL(t2240, 0.8819212643483549);
+    t2242 = FFT_VADD(t2239, t2241);
+    t2243 = FFT_VSCL(t1255, 0.38268343236508984);
+    t2244 = FFT_VMULNJ(t1255);
+    t2245 = FFT_VSCL(t2244, 0.9238795325112867);
+    t2246 = FFT_VADD(t2243, t2245);
+    t2247 = FFT_VSCL(t1356, 0.29028467725446233);
+    t2248 = FFT_VMULNJ(t1356);
+    t2249 = FFT_VSCL(t2248, 0.9569403357322089);
+    t2250 = FFT_VADD(t2247, t2249);
+    t2251 = FFT_VSCL(t1457, 0.19509032201612833);
+    t2252 = FFT_VMULNJ(t1457);
+    t2253 = FFT_VSCL(t2252, 0.9807852804032304);
+    t2254 = FFT_VADD(t2251, t2253);
+    t2255 = FFT_VSCL(t1558, 0.09801714032956077);
+    t2256 = FFT_VMULNJ(t1558);
+    t2257 = FFT_VSCL(t2256, 0.9951847266721968);
+    t2258 = FFT_VADD(t2255, t2257);
+    t2259 = FFT_VADD(t2230, t43);
+    t2260 = FFT_VSUB(t43, t2230);
+    t2261 = FFT_VADD(t2215, t2246);
+    t2262 = FFT_VSUB(t2215, t2246);
+    t2263 = FFT_VADD(t2259, t2261);
+    t2264 = FFT_VSUB(t2259, t2261);
+    t2265 = FFT_VMULNJ(t2262);
+    t2266 = FFT_VADD(t2260, t2265);
+    t2267 = FFT_VSUB(t2260, t2265);
+    t2268 = FFT_VADD(t2203, t2234);
+    t2269 = FFT_VSUB(t2203, t2234);
+    t2270 = FFT_VADD(t2219, t2250);
+    t2271 = FFT_VSUB(t2219, t2250);
+    t2272 = FFT_VADD(t2268, t2270);
+    t2273 = FFT_VSUB(t2268, t2270);
+    t2274 = FFT_VMULNJ(t2271);
+    t2275 = FFT_VADD(t2269, t2274);
+    t2276 = FFT_VSUB(t2269, t2274);
+    t2277 = FFT_VADD(t2207, t2238);
+    t2278 = FFT_VSUB(t2207, t2238);
+    t2279 = FFT_VADD(t2223, t2254);
+    t2280 = FFT_VSUB(t2223, t2254);
+    t2281 = FFT_VADD(t2277, t2279);
+    t2282 = FFT_VSUB(t2277, t2279);
+    t2283 = FFT_VMULNJ(t2280);
+    t2284 = FFT_VADD(t2278, t2283);
+    t2285 = FFT_VSUB(t2278, t2283);
+    t2286 = FFT_VADD(t2211, t2242);
+    t2287 = FFT_VSUB(t2211, t2242);
+    t2288 = FFT_VADD(t2227, t2258);
+    t2289 = FFT_VSUB(t2227, t2258);
+    t2290 = FFT_VADD(t2286, t2288);
+    t2291 = FFT_VSUB(t2286, t2288);
+    t2292 = FFT_VMULNJ(t2289);
+    t2293 = FFT_VADD(t2287, t2292);
+    t2294 = FFT_VSUB(t2287, t2292);
+    t2295 = FFT_VADD(t2263, t2281);
+    t2296 = FFT_VSUB(t2263, t2281);
+    t2297 = FFT_VADD(t2272, t2290);
+    t2298 = FFT_VSUB(t2272, t2290);
+    t2299 = FFT_VADD(t2295, t2297);
+    t2300 = FFT_VSUB(t2295, t2297);
+    t2301 = FFT_VMULNJ(t2298);
+    t2302 = FFT_VADD(t2296, t2301);
+    t2303 = FFT_VSUB(t2296, t2301);
+    t2304 = FFT_VSCL(t2275, 0.9238795325112867);
+    t2305 = FFT_VMULNJ(t2275);
+    t2306 = FFT_VSCL(t2305, 0.3826834323650898);
+    t2307 = FFT_VADD(t2304, t2306);
+    t2308 = FFT_VMULNJ(t2284);
+    t2309 = FFT_VADD(t2284, t2308);
+    t2310 = FFT_VSCL(t2309, 0.7071067811865476);
+    t2311 = FFT_VSCL(t2293, 0.38268343236508984);
+    t2312 = FFT_VMULNJ(t2293);
+    t2313 = FFT_VSCL(t2312, 0.9238795325112867);
+    t2314 = FFT_VADD(t2311, t2313);
+    t2315 = FFT_VADD(t2266, t2310);
+    t2316 = FFT_VSUB(t2266, t2310);
+    t2317 = FFT_VADD(t2307, t2314);
+    t2318 = FFT_VSUB(t2307, t2314);
+    t2319 = FFT_VADD(t2315, t2317);
+    t2320 = FFT_VSUB(t2315, t2317);
+    t2321 = FFT_VMULNJ(t2318);
+    t2322 = FFT_VADD(t2316, t2321);
+    t2323 = FFT_VSUB(t2316, t2321);
+    t2324 = FFT_VMULNJ(t2273);
+    t2325 = FFT_VADD(t2273, t2324);
+    t2326 = FFT_VSCL(t2325, 0.7071067811865476);
+    t2327 = FFT_VMULNJ(t2282);
+    t2328 = FFT_VMULNJ(t2291);
+    t2329 = FFT_VSUB(t2291, t2328);
+    t2330 = FFT_VSCL(t2329, 0.7071067811865475);
+    t2331 = FFT_VADD(t2264, t2327);
+    t2332 = FFT_VSUB(t2264, t2327);
+    t2333 = FFT_VSUB(t2326, t2330);
+    t2334 = FFT_VADD(t2326, t2330);
+    t2335 = FFT_VADD(t2331, t2333);
+    t2336 = FFT_VSUB(t2331, t2333);
+    t2337 = FFT_VMULNJ(t2334);
+    t2338 = FFT_VADD(t2332, t2337);
+    t2339 = FFT_VSUB(t2332, t2337);
+    t2340 = FFT_VSCL(t2276, 0.38268343236508984);
+    t2341 = FFT_VMULNJ(t2276);
+    t2342 = FFT_VSCL(t2341, 0.9238795325112867);
+    t2343 = FFT_VADD(t2340, t2342);
+    t2344 = FFT_VMULNJ(t2285);
+    t2345 = FFT_VSUB(t2285, t2344);
+    t2346 = FFT_VSCL(t2345, 0.7071067811865475);
+    t2347 = FFT_VSCL(t2294, 0.9238795325112867);
+    t2348 = FFT_VMULNJ(t2294);
+    t2349 = FFT_VSCL(t2348, 0.3826834323650899);
+    t2350 = FFT_VADD(t2347, t2349);
+    t2351 = FFT_VSUB(t2267, t2346);
+    t2352 = FFT_VADD(t2267, t2346);
+    t2353 = FFT_VSUB(t2343, t2350);
+    t2354 = FFT_VADD(t2343, t2350);
+    t2355 = FFT_VADD(t2351, t2353);
+    t2356 = FFT_VSUB(t2351, t2353);
+    t2357 = FFT_VMULNJ(t2354);
+    t2358 = FFT_VADD(t2352, t2357);
+    t2359 = FFT_VSUB(t2352, t2357);
+    t2360 = FFT_VSCL(t164, 0.99247953459871);
+    t2361 = FFT_VMULNJ(t164);
+    t2362 = FFT_VSCL(t2361, 0.1224106751992162);
+    t2363 = FFT_VADD(t2360, t2362);
+    t2364 = FFT_VSCL(t265, 0.970031253194544);
+    t2365 = FFT_VMULNJ(t265);
+    t2366 = FFT_VSCL(t2365, 0.24298017990326387);
+    t2367 = FFT_VADD(t2364, t2366);
+    t2368 = FFT_VSCL(t366, 0.932992798834739);
+    t2369 = FFT_VMULNJ(t366);
+    t2370 = FFT_VSCL(t2369, 0.3598950365349881);
+    t2371 = FFT_VADD(t2368, t2370);
+    t2372 = FFT_VSCL(t467, 0.881921264348355);
+    t2373 = FFT_VMULNJ(t467);
+    t2374 = FFT_VSCL(t2373, 0.47139673682599764);
+    t2375 = FFT_VADD(t2372, t2374);
+    t2376 = FFT_VSCL(t568, 0.8175848131515837);
+    t2377 = FFT_VMULNJ(t568);
+    t2378 = FFT_VSCL(t2377, 0.5758081914178453);
+    t2379 = FFT_VADD(t2376, t2378);
+    t2380 = FFT_VSCL(t669, 0.7409511253549591);
+    t2381 = FFT_VMULNJ(t669);
+    t2382 = FFT_VSCL(t2381, 0.6715589548470183);
+    t2383 = FFT_VADD(t2380, t2382);
+    t2384 = FFT_VSCL(t770, 0.6531728429537768);
+    t2385 = FFT_VMULNJ(t770);
+    t2386 = FFT_VSCL(t2385, 0.7572088465064845);
+    t2387 = FFT_VADD(t2384, t2386);
+    t2388 = FFT_VSCL(t871, 0.5555702330196023);
+    t2389 = FFT_VMULNJ(t871);
+    t2390 = FFT_VSCL(t2389, 0.8314696123025452);
+    t2391 = FFT_VADD(t2388, t2390);
+    t2392 = FFT_VSCL(t972, 0.4496113296546066);
+    t2393 = FFT_VMULNJ(t972);
+    t2394 = FFT_VSCL(t2393, 0.8932243011955153);
+    t2395 = FFT_VADD(t2392, t2394);
+    t2396 = FFT_VSCL(t1073, 0.33688985339222005);
+    t2397 = FFT_VMULNJ(t1073);
+    t2398 = FFT_VSCL(t2397, 0.9415440651830208);
+    t2399 = FFT_VADD(t2396, t2398);
+    t2400 = FFT_VSCL(t1174, 0.21910124015686977);
+    t2401 = FFT_VMULNJ(t1174);
+    t2402 = FFT_VSCL(t2401, 0.9757021300385286);
+    t2403 = FFT_VADD(t2400, t2402);
+    t2404 = FFT_VSCL(t1275, 0.09801714032956077);
+    t2405 = FFT_VMULNJ(t1275);
+    t2406 = FFT_VSCL(t2405, 0.9951847266721968);
+    t2407 = FFT_VADD(t2404, t2406);
+    t2408 = FFT_VSCL(t1376, 0.024541228522912142);
+    t2409 = FFT_VMULNJ(t1376);
+    t2410 = FFT_VSCL(t2409, 0.9996988186962042);
+    t2411 = FFT_VSUB(t2410, t2408);
+    t2412 = FFT_VSCL(t1477, 0.14673047445536164);
+    t2413 = FFT_VMULNJ(t1477);
+    t2414 = FFT_VSCL(t2413, 0.989176509964781);
+    t2415 = FFT_VSUB(t2414, t2412);
+    t2416 = FFT_VSCL(t1578, 0.2667127574748983);
+    t2417 = FFT_VMULNJ(t1578);
+    t2418 = FFT_VSCL(t2417, 0.9637760657954398);
+    t2419 = FFT_VSUB(t2418, t2416);
+    t2420 = FFT_VADD(t2391, t63);
+    t2421 = FFT_VSUB(t63, t2391);
+    t2422 = FFT_VADD(t2375, t2407);
+    t2423 = FFT_VSUB(t2375, t2407);
+    t2424 = FFT_VADD(t2420, t2422);
+    t2425 = FFT_VSUB(t2420, t2422);
+    t2426 = FFT_VMULNJ(t2423);
+    t2427 = FFT_VADD(t2421, t2426);
+    t2428 = FFT_VSUB(t2421, t2426);
+    t2429 = FFT_VADD(t2363, t2395);
+    t2430 = FFT_VSUB(t2363, t2395);
+    t2431 = FFT_VADD(t2379, t2411);
+    t2432 = FFT_VSUB(t2379, t2411);
+    t2433 = FFT_VADD(t2429, t2431);
+    t2434 = FFT_VSUB(t2429, t2431);
+    t2435 = FFT_VMULNJ(t2432);
+    t2436 = FFT_VADD(t2430, t2435);
+    t2437 = FFT_VSUB(t2430, t2435);
+    t2438 = FFT_VADD(t2367, t2399);
+    t2439 = FFT_VSUB(t2367, t2399);
+    t2440 = FFT_VADD(t2383, t2415);
+    t2441 = FFT_VSUB(t2383, t2415);
+    t2442 = FFT_VADD(t2438, t2440);
+    t2443 = FFT_VSUB(t2438, t2440);
+    t2444 = FFT_VMULNJ(t2441);
+    t2445 = FFT_VADD(t2439, t2444);
+    t2446 = FFT_VSUB(t2439, t2444);
+    t2447 = FFT_VADD(t2371, t2403);
+    t2448 = FFT_VSUB(t2371, t2403);
+    t2449 = FFT_VADD(t2387, t2419);
+    t2450 = FFT_VSUB(t2387, t2419);
+    t2451 = FFT_VADD(t2447, t2449);
+    t2452 = FFT_VSUB(t2447, t2449);
+    t2453 = FFT_VMULNJ(t2450);
+    t2454 = FFT_VADD(t2448, t2453);
+    t2455 = FFT_VSUB(t2448, t2453);
+    t2456 = FFT_VADD(t2424, t2442);
+    t2457 = FFT_VSUB(t2424, t2442);
+    t2458 = FFT_VADD(t2433, t2451);
+    t2459 = FFT_VSUB(t2433, t2451);
+    t2460 = FFT_VADD(t2456, t2458);
+    t2461 = FFT_VSUB(t2456, t2458);
+    t2462 = FFT_VMULNJ(t2459);
+    t2463 = FFT_VADD(t2457, t2462);
+    t2464 = FFT_VSUB(t2457, t2462);
+    t2465 = FFT_VSCL(t2436, 0.9238795325112867);
+    t2466 = FFT_VMULNJ(t2436);
+    t2467 = FFT_VSCL(t2466, 0.3826834323650898);
+    t2468 = FFT_VADD(t2465, t2467);
+    t2469 = FFT_VMULNJ(t2445);
+    t2470 = FFT_VADD(t2445, t2469);
+    t2471 = FFT_VSCL(t2470, 0.7071067811865476);
+    t2472 = FFT_VSCL(t2454, 0.38268343236508984);
+    t2473 = FFT_VMULNJ(t2454);
+    t2474 = FFT_VSCL(t2473, 0.9238795325112867);
+    t2475 = FFT_VADD(t2472, t2474);
+    t2476 = FFT_VADD(t2427, t2471);
+    t2477 = FFT_VSUB(t2427, t2471);
+    t2478 = FFT_VADD(t2468, t2475);
+    t2479 = FFT_VSUB(t2468, t2475);
+    t2480 = FFT_VADD(t2476, t2478);
+    t2481 = FFT_VSUB(t2476, t2478);
+    t2482 = FFT_VMULNJ(t2479);
+    t2483 = FFT_VADD(t2477, t2482);
+    t2484 = FFT_VSUB(t2477, t2482);
+    t2485 = FFT_VMULNJ(t2434);
+    t2486 = FFT_VADD(t2434, t2485);
+    t2487 = FFT_VSCL(t2486, 0.7071067811865476);
+    t2488 = FFT_VMULNJ(t2443);
+    t2489 = FFT_VMULNJ(t2452);
+    t2490 = FFT_VSUB(t2452, t2489);
+    t2491 = FFT_VSCL(t2490, 0.7071067811865475);
+    t2492 = FFT_VADD(t2425, t2488);
+    t2493 = FFT_VSUB(t2425, t2488);
+    t2494 = FFT_VSUB(t2487, t2491);
+    t2495 = FFT_VADD(t2487, t2491);
+    t2496 = FFT_VADD(t2492, t2494);
+    t2497 = FFT_VSUB(t2492, t2494);
+    t2498 = FFT_VMULNJ(t2495);
+    t2499 = FFT_VADD(t2493, t2498);
+    t2500 = FFT_VSUB(t2493, t2498);
+    t2501 = FFT_VSCL(t2437, 0.38268343236508984);
+    t2502 = FFT_VMULNJ(t2437);
+    t2503 = FFT_VSCL(t2502, 0.9238795325112867);
+    t2504 = FFT_VADD(t2501, t2503);
+    t2505 = FFT_VMULNJ(t2446);
+    t2506 = FFT_VSUB(t2446, t2505);
+    t2507 = FFT_VSCL(t2506, 0.7071067811865475);
+    t2508 = FFT_VSCL(t2455, 0.9238795325112867);
+    t2509 = FFT_VMULNJ(t2455);
+    t2510 = FFT_VSCL(t2509, 0.3826834323650899);
+    t2511 = FFT_VADD(t2508, t2510);
+    t2512 = FFT_VSUB(t2428, t2507);
+    t2513 = FFT_VADD(t2428, t2507);
+    t2514 = FFT_VSUB(t2504, t2511);
+    t2515 = FFT_VADD(t2504, t2511);
+    t2516 = FFT_VADD(t2512, t2514);
+    t2517 = FFT_VSUB(t2512, t2514);
+    t2518 = FFT_VMULNJ(t2515);
+    t2519 = FFT_VADD(t2513, t2518);
+    t2520 = FFT_VSUB(t2513, t2518);
+    t2521 = FFT_VSCL(t180, 0.989176509964781);
+    t2522 = FFT_VMULNJ(t180);
+    t2523 = FFT_VSCL(t2522, 0.14673047445536175);
+    t2524 = FFT_VADD(t2521, t2523);
+    t2525 = FFT_VSCL(t281, 0.9569403357322088);
+    t2526 = FFT_VMULNJ(t281);
+    t2527 = FFT_VSCL(t2526, 0.29028467725446233);
+    t2528 = FFT_VADD(t2525, t2527);
+    t2529 = FFT_VSCL(t382, 0.9039892931234433);
+    t2530 = FFT_VMULNJ(t382);
+    t2531 = FFT_VSCL(t2530, 0.4275550934302821);
+    t2532 = FFT_VADD(t2529, t2531);
+    t2533 = FFT_VSCL(t483, 0.8314696123025452);
+    t2534 = FFT_VMULNJ(t483);
+    t2535 = FFT_VSCL(t2534, 0.5555702330196022);
+    t2536 = FFT_VADD(t2533, t2535);
+    t2537 = FFT_VSCL(t584, 0.7409511253549591);
+    t2538 = FFT_VMULNJ(t584);
+    t2539 = FFT_VSCL(t2538, 0.6715589548470183);
+    t2540 = FFT_VADD(t2537, t2539);
+    t2541 = FFT_VSCL(t685, 0.6343932841636455);
+    t2542 = FFT_VMULNJ(t685);
+    t2543 = FFT_VSCL(t2542, 0.773010453362737);
+    t2544 = FFT_VADD(t2541, t2543);
+    t2545 = FFT_VSCL(t786, 0.5141027441932217);
+    t2546 = FFT_VMULNJ(t786);
+    t2547 = FFT_VSCL(t2546, 0.8577286100002721);
+    t2548 = FFT_VADD(t2545, t2547);
+    t2549 = FFT_VSCL(t887, 0.38268343236508984);
+    t2550 = FFT_VMULNJ(t887);
+    t2551 = FFT_VSCL(t2550, 0.9238795325112867);
+    t2552 = FFT_VADD(t2549, t2551);
+    t2553 = FFT_VSCL(t988, 0.24298017990326398);
+    t2554 = FFT_VMULNJ(t988);
+    t2555 = FFT_VSCL(t2554, 0.970031253194544);
+    t2556 = FFT_VADD(t2553, t2555);
+    t2557 = FFT_VSCL(t1089, 0.09801714032956077);
+    t2558 = FFT_VMULNJ(t1089);
+    t2559 = FFT_VSCL(t2558, 0.9951847266721968);
+    t2560 = FFT_VADD(t2557, t2559);
+    t2561 = FFT_VSCL(t1190, 0.04906767432741801);
+    t2562 = FFT_VMULNJ(t1190);
+    t2563 = FFT_VSCL(t2562, 0.9987954562051724);
+    t2564 = FFT_VSUB(t2563, t2561);
+    t2565 = FFT_VSCL(t1291, 0.1950903220161282);
+    t2566 = FFT_VMULNJ(t1291);
+    t2567 = FFT_VSCL(t2566, 0.9807852804032304);
+    t2568 = FFT_VSUB(t2567, t2565);
+    t2569 = FFT_VSCL(t1392, 0.33688985339221994);
+    t2570 = FFT_VMULNJ(t1392);
+    t2571 = FFT_VSCL(t2570, 0.9415440651830208);
+    t2572 = FFT_VSUB(t2571, t2569);
+    t2573 = FFT_VSCL(t1493, 0.4713967368259977);
+    t2574 = FFT_VMULNJ(t1493);
+    t2575 = FFT_VSCL(t2574, 0.881921264348355);
+    t2576 = FFT_VSUB(t2575, t2573);
+    t2577 = FFT_VSCL(t1594, 0.5956993044924334);
+    t2578 = FFT_VMULNJ(t1594);
+    t2579 = FFT_VSCL(t2578, 0.8032075314806449);
+    t2580 = FFT_VSUB(t2579, t2577);
+    t2581 = FFT_VADD(t2552, t79);
+    t2582 = FFT_VSUB(t79, t2552);
+    t2583 = FFT_VADD(t2536, t2568);
+    t2584 = FFT_VSUB(t2536, t2568);
+    t2585 = FFT_VADD(t2581, t2583);
+    t2586 = FFT_VSUB(t2581, t2583);
+    t2587 = FFT_VMULNJ(t2584);
+    t2588 = FFT_VADD(t2582, t2587);
+    t2589 = FFT_VSUB(t2582, t2587);
+    t2590 = FFT_VADD(t2524, t2556);
+    t2591 = FFT_VSUB(t2524, t2556);
+    t2592 = FFT_VADD(t2540, t2572);
+    t2593 = FFT_VSUB(t2540, t2572);
+    t2594 = FFT_VADD(t2590, t2592);
+    t2595 = FFT_VSUB(t2590, t2592);
+    t2596 = FFT_VMULNJ(t2593);
+    t2597 = FFT_VADD(t2591, t2596);
+    t2598 = FFT_VSUB(t2591, t2596);
+    t2599 = FFT_VADD(t2528, t2560);
+    t2600 = FFT_VSUB(t2528, t2560);
+    t2601 = FFT_VADD(t2544, t2576);
+    t2602 = FFT_VSUB(t2544, t2576);
+    t2603 = FFT_VADD(t2599, t2601);
+    t2604 = FFT_VSUB(t2599, t2601);
+    t2605 = FFT_VMULNJ(t2602);
+    t2606 = FFT_VADD(t2600, t2605);
+    t2607 = FFT_VSUB(t2600, t2605);
+    t2608 = FFT_VADD(t2532, t2564);
+    t2609 = FFT_VSUB(t2532, t2564);
+    t2610 = FFT_VADD(t2548, t2580);
+    t2611 = FFT_VSUB(t2548, t2580);
+    t2612 = FFT_VADD(t2608, t2610);
+    t2613 = FFT_VSUB(t2608, t2610);
+    t2614 = FFT_VMULNJ(t2611);
+    t2615 = FFT_VADD(t2609, t2614);
+    t2616 = FFT_VSUB(t2609, t2614);
+    t2617 = FFT_VADD(t2585, t2603);
+    t2618 = FFT_VSUB(t2585, t2603);
+    t2619 = FFT_VADD(t2594, t2612);
+    t2620 = FFT_VSUB(t2594, t2612);
+    t2621 = FFT_VADD(t2617, t2619);
+    t2622 = FFT_VSUB(t2617, t2619);
+    t2623 = FFT_VMULNJ(t2620);
+    t2624 = FFT_VADD(t2618, t2623);
+    t2625 = FFT_VSUB(t2618, t2623);
+    t2626 = FFT_VSCL(t2597, 0.9238795325112867);
+    t2627 = FFT_VMULNJ(t2597);
+    t2628 = FFT_VSCL(t2627, 0.3826834323650898);
+    t2629 = FFT_VADD(t2626, t2628);
+    t2630 = FFT_VMULNJ(t2606);
+    t2631 = FFT_VADD(t2606, t2630);
+    t2632 = FFT_VSCL(t2631, 0.7071067811865476);
+    t2633 = FFT_VSCL(t2615, 0.38268343236508984);
+    t2634 = FFT_VMULNJ(t2615);
+    t2635 = FFT_VSCL(t2634, 0.9238795325112867);
+    t2636 = FFT_VADD(t2633, t2635);
+    t2637 = FFT_VADD(t2588, t2632);
+    t2638 = FFT_VSUB(t2588, t2632);
+    t2639 = FFT_VADD(t2629, t2636);
+    t2640 = FFT_VSUB(t2629, t2636);
+    t2641 = FFT_VADD(t2637, t2639);
+    t2642 = FFT_VSUB(t2637, t2639);
+    t2643 = FFT_VMULNJ(t2640);
+    t2644 = FFT_VADD(t2638, t2643);
+    t2645 = FFT_VSUB(t2638, t2643);
+    t2646 = FFT_VMULNJ(t2595);
+    t2647 = FFT_VADD(t2595, t2646);
+    t2648 = FFT_VSCL(t2647, 0.7071067811865476);
+    t2649 = FFT_VMULNJ(t2604);
+    t2650 = FFT_VMULNJ(t2613);
+    t2651 = FFT_VSUB(t2613, t2650);
+    t2652 = FFT_VSCL(t2651, 0.7071067811865475);
+    t2653 = FFT_VADD(t2586, t2649);
+    t2654 = FFT_VSUB(t2586, t2649);
+    t2655 = FFT_VSUB(t2648, t2652);
+    t2656 = FFT_VADD(t2648, t2652);
+    t2657 = FFT_VADD(t2653, t2655);
+    t2658 = FFT_VSUB(t2653, t2655);
+    t2659 = FFT_VMULNJ(t2656);
+    t2660 = FFT_VADD(t2654, t2659);
+    t2661 = FFT_VSUB(t2654, t2659);
+    t2662 = FFT_VSCL(t2598, 0.38268343236508984);
+    t2663 = FFT_VMULNJ(t2598);
+    t2664 = FFT_VSCL(t2663, 0.9238795325112867);
+    t2665 = FFT_VADD(t2662, t2664);
+    t2666 = FFT_VMULNJ(t2607);
+    t2667 = FFT_VSUB(t2607, t2666);
+    t2668 = FFT_VSCL(t2667, 0.7071067811865475);
+    t2669 = FFT_VSCL(t2616, 0.9238795325112867);
+    t2670 = FFT_VMULNJ(t2616);
+    t2671 = FFT_VSCL(t2670, 0.3826834323650899);
+    t2672 = FFT_VADD(t2669, t2671);
+    t2673 = FFT_VSUB(t2589, t2668);
+    t2674 = FFT_VADD(t2589, t2668);
+    t2675 = FFT_VSUB(t2665, t2672);
+    t2676 = FFT_VADD(t2665, t2672);
+    t2677 = FFT_VADD(t2673, t2675);
+    t2678 = FFT_VSUB(t2673, t2675);
+    t2679 = FFT_VMULNJ(t2676);
+    t2680 = FFT_VADD(t2674, t2679);
+    t2681 = FFT_VSUB(t2674, t2679);
+    t2682 = FFT_VSCL(t200, 0.9852776423889412);
+    t2683 = FFT_VMULNJ(t200);
+    t2684 = FFT_VSCL(t2683, 0.17096188876030122);
+    t2685 = FFT_VADD(t2682, t2684);
+    t2686 = FFT_VSCL(t301, 0.9415440651830208);
+    t2687 = FFT_VMULNJ(t301);
+    t2688 = FFT_VSCL(t2687, 0.33688985339222005);
+    t2689 = FFT_VADD(t2686, t2688);
+    t2690 = FFT_VSCL(t402, 0.8700869911087115);
+    t2691 = FFT_VMULNJ(t402);
+    t2692 = FFT_VSCL(t2691, 0.49289819222978404);
+    t2693 = FFT_VADD(t2690, t2692);
+    t2694 = FFT_VSCL(t503, 0.773010453362737);
+    t2695 = FFT_VMULNJ(t503);
+    t2696 = FFT_VSCL(t2695, 0.6343932841636455);
+    t2697 = FFT_VADD(t2694, t2696);
+    t2698 = FFT_VSCL(t604, 0.6531728429537768);
+    t2699 = FFT_VMULNJ(t604);
+    t2700 = FFT_VSCL(t2699, 0.7572088465064845);
+    t2701 = FFT_VADD(t2698, t2700);
+    t2702 = FFT_VSCL(t705, 0.5141027441932217);
+    t2703 = FFT_VMULNJ(t705);
+    t2704 = FFT_VSCL(t2703, 0.8577286100002721);
+    t2705 = FFT_VADD(t2702, t2704);
+    t2706 = FFT_VSCL(t806, 0.3598950365349883);
+    t2707 = FFT_VMULNJ(t806);
+    t2708 = FFT_VSCL(t2707, 0.9329927988347388);
+    t2709 = FFT_VADD(t2706, t2708);
+    t2710 = FFT_VSCL(t907, 0.19509032201612833);
+    t2711 = FFT_VMULNJ(t907);
+    t2712 = FFT_VSCL(t2711, 0.9807852804032304);
+    t2713 = FFT_VADD(t2710, t2712);
+    t2714 = FFT_VSCL(t1008, 0.024541228522912264);
+    t2715 = FFT_VMULNJ(t1008);
+    t2716 = FFT_VSCL(t2715, 0.9996988186962042);
+    t2717 = FFT_VADD(t2714, t2716);
+    t2718 = FFT_VSCL(t1109, 0.14673047445536164);
+    t2719 = FFT_VMULNJ(t1109);
+    t2720 = FFT_VSCL(t2719, 0.989176509964781);
+    t2721 = FFT_VSUB(t2720, t2718);
+    t2722 = FFT_VSCL(t1210, 0.3136817403988914);
+    t2723 = FFT_VMULNJ(t1210);
+    t2724 = FFT_VSCL(t2723, 0.9495281805930367);
+    t2725 = FFT_VSUB(t2724, t2722);
+    t2726 = FFT_VSCL(t1311, 0.4713967368259977);
+    t2727 = FFT_VMULNJ(t1311);
+    t2728 = FFT_VSCL(t2727, 0.881921264348355);
+    t2729 = FFT_VSUB(t2728, t2726);
+    t2730 = FFT_VSCL(t1412, 0.6152315905806267);
+    t2731 = FFT_VMULNJ(t1412);
+    t2732 = FFT_VSCL(t2731, 0.7883464276266063);
+    t2733 = FFT_VSUB(t2732, t2730);
+    t2734 = FFT_VSCL(t1513, 0.7409511253549589);
+    t2735 = FFT_VMULNJ(t1513);
+    t2736 = FFT_VSCL(t2735, 0.6715589548470186);
+    t2737 = FFT_VSUB(t2736, t2734);
+    t2738 = FFT_VSCL(t1614, 0.8448535652497071);
+    t2739 = FFT_VMULNJ(t1614);
+    t2740 = FFT_VSCL(t2739, 0.5349976198870972);
+    t2741 = FFT_VSUB(t2740, t2738);
+    t2742 = FFT_VADD(t2713, t99);
+    t2743 = FFT_VSUB(t99, t2713);
+    t2744 = FFT_VADD(t2697, t2729);
+    t2745 = FFT_VSUB(t2697, t2729);
+    t2746 = FFT_VADD(t2742, t2744);
+    t2747 = FFT_VSUB(t2742, t2744);
+    t2748 = FFT_VMULNJ(t2745);
+    t2749 = FFT_VADD(t2743, t2748);
+    t2750 = FFT_VSUB(t2743, t2748);
+    t2751 = FFT_VADD(t2685, t2717);
+    t2752 = FFT_VSUB(t2685, t2717);
+    t2753 = FFT_VADD(t2701, t2733);
+    t2754 = FFT_VSUB(t2701, t2733);
+    t2755 = FFT_VADD(t2751, t2753);
+    t2756 = FFT_VSUB(t2751, t2753);
+    t2757 = FFT_VMULNJ(t2754);
+    t2758 = FFT_VADD(t2752, t2757);
+    t2759 = FFT_VSUB(t2752, t2757);
+    t2760 = FFT_VADD(t2689, t2721);
+    t2761 = FFT_VSUB(t2689, t2721);
+    t2762 = FFT_VADD(t2705, t2737);
+    t2763 = FFT_VSUB(t2705, t2737);
+    t2764 = FFT_VADD(t2760, t2762);
+    t2765 = FFT_VSUB(t2760, t2762);
+    t2766 = FFT_VMULNJ(t2763);
+    t2767 = FFT_VADD(t2761, t2766);
+    t2768 = FFT_VSUB(t2761, t2766);
+    t2769 = FFT_VADD(t2693, t2725);
+    t2770 = FFT_VSUB(t2693, t2725);
+    t2771 = FFT_VADD(t2709, t2741);
+    t2772 = FFT_VSUB(t2709, t2741);
+    t2773 = FFT_VADD(t2769, t2771);
+    t2774 = FFT_VSUB(t2769, t2771);
+    t2775 = FFT_VMULNJ(t2772);
+    t2776 = FFT_VADD(t2770, t2775);
+    t2777 = FFT_VSUB(t2770, t2775);
+    t2778 = FFT_VADD(t2746, t2764);
+    t2779 = FFT_VSUB(t2746, t2764);
+    t2780 = FFT_VADD(t2755, t2773);
+    t2781 = FFT_VSUB(t2755, t2773);
+    t2782 = FFT_VADD(t2778, t2780);
+    t2783 = FFT_VSUB(t2778, t2780);
+    t2784 = FFT_VMULNJ(t2781);
+    t2785 = FFT_VADD(t2779, t2784);
+    t2786 = FFT_VSUB(t2779, t2784);
+    t2787 = FFT_VSCL(t2758, 0.9238795325112867);
+    t2788 = FFT_VMULNJ(t2758);
+    t2789 = FFT_VSCL(t2788, 0.3826834323650898);
+    t2790 = FFT_VADD(t2787, t2789);
+    t2791 = FFT_VMULNJ(t2767);
+    t2792 = FFT_VADD(t2767, t2791);
+    t2793 = FFT_VSCL(t2792, 0.7071067811865476);
+    t2794 = FFT_VSCL(t2776, 0.38268343236508984);
+    t2795 = FFT_VMULNJ(t2776);
+    t2796 = FFT_VSCL(t2795, 0.9238795325112867);
+    t2797 = FFT_VADD(t2794, t2796);
+    t2798 = FFT_VADD(t2749, t2793);
+    t2799 = FFT_VSUB(t2749, t2793);
+    t2800 = FFT_VADD(t2790, t2797);
+    t2801 = FFT_VSUB(t2790, t2797);
+    t2802 = FFT_VADD(t2798, t2800);
+    t2803 = FFT_VSUB(t2798, t2800);
+    t2804 = FFT_VMULNJ(t2801);
+    t2805 = FFT_VADD(t2799, t2804);
+    t2806 = FFT_VSUB(t2799, t2804);
+    t2807 = FFT_VMULNJ(t2756);
+    t2808 = FFT_VADD(t2756, t2807);
+    t2809 = FFT_VSCL(t2808, 0.7071067811865476);
+    t2810 = FFT_VMULNJ(t2765);
+    t2811 = FFT_VMULNJ(t2774);
+    t2812 = FFT_VSUB(t2774, t2811);
+    t2813 = FFT_VSCL(t2812, 0.7071067811865475);
+    t2814 = FFT_VADD(t2747, t2810);
+    t2815 = FFT_VSUB(t2747, t2810);
+    t2816 = FFT_VSUB(t2809, t2813);
+    t2817 = FFT_VADD(t2809, t2813);
+    t2818 = FFT_VADD(t2814, t2816);
+    t2819 = FFT_VSUB(t2814, t2816);
+    t2820 = FFT_VMULNJ(t2817);
+    t2821 = FFT_VADD(t2815, t2820);
+    t2822 = FFT_VSUB(t2815, t2820);
+    t2823 = FFT_VSCL(t2759, 0.38268343236508984);
+    t2824 = FFT_VMULNJ(t2759);
+    t2825 = FFT_VSCL(t2824, 0.9238795325112867);
+    t2826 = FFT_VADD(t2823, t2825);
+    t2827 = FFT_VMULNJ(t2768);
+    t2828 = FFT_VSUB(t2768, t2827);
+    t2829 = FFT_VSCL(t2828, 0.7071067811865475);
+    t2830 = FFT_VSCL(t2777, 0.9238795325112867);
+    t2831 = FFT_VMULNJ(t2777);
+    t2832 = FFT_VSCL(t2831, 0.3826834323650899);
+    t2833 = FFT_VADD(t2830, t2832);
+    t2834 = FFT_VSUB(t2750, t2829);
+    t2835 = FFT_VADD(t2750, t2829);
+    t2836 = FFT_VSUB(t2826, t2833);
+    t2837 = FFT_VADD(t2826, t2833);
+    t2838 = FFT_VADD(t2834, t2836);
+    t2839 = FFT_VSUB(t2834, t2836);
+    t2840 = FFT_VMULNJ(t2837);
+    t2841 = FFT_VADD(t2835, t2840);
+    t2842 = FFT_VSUB(t2835, t2840);
+    t2843 = FFT_VSCL(t142, 0.9807852804032304);
+    t2844 = FFT_VMULNJ(t142);
+    t2845 = FFT_VSCL(t2844, 0.19509032201612825);
+    t2846 = FFT_VADD(t2843, t2845);
+    t2847 = FFT_VSCL(t243, 0.9238795325112867);
+    t2848 = FFT_VMULNJ(t243);
+    t2849 = FFT_VSCL(t2848, 0.3826834323650898);
+    t2850 = FFT_VADD(t2847, t2849);
+    t2851 = FFT_VSCL(t344, 0.8314696123025452);
+    t2852 = FFT_VMULNJ(t344);
+    t2853 = FFT_VSCL(t2852, 0.5555702330196022);
+    t2854 = FFT_VADD(t2851, t2853);
+    t2855 = FFT_VMULNJ(t445);
+    t2856 = FFT_VADD(t2855, t445);
+    t2857 = FFT_VSCL(t2856, 0.7071067811865476);
+    t2858 = FFT_VSCL(t546, 0.5555702330196023);
+    t2859 = FFT_VMULNJ(t546);
+    t2860 = FFT_VSCL(t2859, 0.8314696123025452);
+    t2861 = FFT_VADD(t2858, t2860);
+    t2862 = FFT_VSCL(t647, 0.38268343236508984);
+    t2863 = FFT_VMULNJ(t647);
+    t2864 = FFT_VSCL(t2863, 0.9238795325112867);
+    t2865 = FFT_VADD(t2862, t2864);
+    t2866 = FFT_VSCL(t748, 0.19509032201612833);
+    t2867 = FFT_VMULNJ(t748);
+    t2868 = FFT_VSCL(t2867, 0.9807852804032304);
+    t2869 = FFT_VADD(t2866, t2868);
+    t2870 = FFT_VMULNJ(t849);
+    t2871 = FFT_VSCL(t950, 0.1950903220161282);
+    t2872 = FFT_VMULNJ(t950);
+    t2873 = FFT_VSCL(t2872, 0.9807852804032304);
+    t2874 = FFT_VSUB(t2873, t2871);
+    t2875 = FFT_VSCL(t1051, 0.3826834323650897);
+    t2876 = FFT_VMULNJ(t1051);
+    t2877 = FFT_VSCL(t2876, 0.9238795325112867);
+    t2878 = FFT_VSUB(t2877, t2875);
+    t2879 = FFT_VSCL(t1152, 0.555570233019602);
+    t2880 = FFT_VMULNJ(t1152);
+    t2881 = FFT_VSCL(t2880, 0.8314696123025455);
+    t2882 = FFT_VSUB(t2881, t2879);
+    t2883 = FFT_VMULNJ(t1253);
+    t2884 = FFT_VSUB(t1253, t2883);
+    t2885 = FFT_VSCL(t2884, 0.7071067811865475);
+    t2886 = FFT_VSCL(t1354, 0.8314696123025453);
+    t2887 = FFT_VMULNJ(t1354);
+    t2888 = FFT_VSCL(t2887, 0.5555702330196022);
+    t2889 = FFT_VSUB(t2888, t2886);
+    t2890 = FFT_VSCL(t1455, 0.9238795325112867);
+    t2891 = FFT_VMULNJ(t1455);
+    t2892 = FFT_VSCL(t2891, 0.3826834323650899);
+    t2893 = FFT_VSUB(t2892, t2890);
+    t2894 = FFT_VSCL(t1556, 0.9807852804032304);
+    t2895 = FFT_VMULNJ(t1556);
+    t2896 = FFT_VSCL(t2895, 0.1950903220161286);
+    t2897 = FFT_VSUB(t2896, t2894);
+    t2898 = FFT_VADD(t2870, t41);
+    t2899 = FFT_VSUB(t41, t2870);
+    t2900 = FFT_VSUB(t2857, t2885);
+    t2901 = FFT_VADD(t2857, t2885);
+    t2902 = FFT_VADD(t2898, t2900);
+    t2903 = FFT_VSUB(t2898, t2900);
+    t2904 = FFT_VMULNJ(t2901);
+    t2905 = FFT_VADD(t2899, t2904);
+    t2906 = FFT_VSUB(t2899, t2904);
+    t2907 = FFT_VADD(t2846, t2874);
+    t2908 = FFT_VSUB(t2846, t2874);
+    t2909 = FFT_VADD(t2861, t2889);
+    t2910 = FFT_VSUB(t2861, t2889);
+    t2911 = FFT_VADD(t2907, t2909);
+    t2912 = FFT_VSUB(t2907, t2909);
+    t2913 = FFT_VMULNJ(t2910);
+    t2914 = FFT_VADD(t2908, t2913);
+    t2915 = FFT_VSUB(t2908, t2913);
+    t2916 = FFT_VADD(t2850, t2878);
+    t2917 = FFT_VSUB(t2850, t2878);
+    t2918 = FFT_VADD(t2865, t2893);
+    t2919 = FFT_VSUB(t2865, t2893);
+    t2920 = FFT_VADD(t2916, t2918);
+    t2921 = FFT_VSUB(t2916, t2918);
+    t2922 = FFT_VMULNJ(t2919);
+    t2923 = FFT_VADD(t2917, t2922);
+    t2924 = FFT_VSUB(t2917, t2922);
+    t2925 = FFT_VADD(t2854, t2882);
+    t2926 = FFT_VSUB(t2854, t2882);
+    t2927 = FFT_VADD(t2869, t2897);
+    t2928 = FFT_VSUB(t2869, t2897);
+    t2929 = FFT_VADD(t2925, t2927);
+    t2930 = FFT_VSUB(t2925, t2927);
+    t2931 = FFT_VMULNJ(t2928);
+    t2932 = FFT_VADD(t2926, t2931);
+    t2933 = FFT_VSUB(t2926, t2931);
+    t2934 = FFT_VADD(t2902, t2920);
+    t2935 = FFT_VSUB(t2902, t2920);
+    t2936 = FFT_VADD(t2911, t2929);
+    t2937 = FFT_VSUB(t2911, t2929);
+    t2938 = FFT_VADD(t2934, t2936);
+    t2939 = FFT_VSUB(t2934, t2936);
+    t2940 = FFT_VMULNJ(t2937);
+    t2941 = FFT_VADD(t2935, t2940);
+    t2942 = FFT_VSUB(t2935, t2940);
+    t2943 = FFT_VSCL(t2914, 0.9238795325112867);
+    t2944 = FFT_VMULNJ(t2914);
+    t2945 = FFT_VSCL(t2944, 0.3826834323650898);
+    t2946 = FFT_VADD(t2943, t2945);
+    t2947 = FFT_VMULNJ(t2923);
+    t2948 = FFT_VADD(t2923, t2947);
+    t2949 = FFT_VSCL(t2948, 0.7071067811865476);
+    t2950 = FFT_VSCL(t2932, 0.38268343236508984);
+    t2951 = FFT_VMULNJ(t2932);
+    t2952 = FFT_VSCL(t2951, 0.9238795325112867);
+    t2953 = FFT_VADD(t2950, t2952);
+    t2954 = FFT_VADD(t2905, t2949);
+    t2955 = FFT_VSUB(t2905, t2949);
+    t2956 = FFT_VADD(t2946, t2953);
+    t2957 = FFT_VSUB(t2946, t2953);
+    t2958 = FFT_VADD(t2954, t2956);
+    t2959 = FFT_VSUB(t2954, t2956);
+    t2960 = FFT_VMULNJ(t2957);
+    t2961 = FFT_VADD(t2955, t2960);
+    t2962 = FFT_VSUB(t2955, t2960);
+    t2963 = FFT_VMULNJ(t2912);
+    t2964 = FFT_VADD(t2912, t2963);
+    t2965 = FFT_VSCL(t2964, 0.7071067811865476);
+    t2966 = FFT_VMULNJ(t2921);
+    t2967 = FFT_VMULNJ(t2930);
+    t2968 = FFT_VSUB(t2930, t2967);
+    t2969 = FFT_VSCL(t2968, 0.7071067811865475);
+    t2970 = FFT_VADD(t2903, t2966);
+    t2971 = FFT_VSUB(t2903, t2966);
+    t2972 = FFT_VSUB(t2965, t2969);
+    t2973 = FFT_VADD(t2965, t2969);
+    t2974 = FFT_VADD(t2970, t2972);
+    t2975 = FFT_VSUB(t2970, t2972);
+    t2976 = FFT_VMULNJ(t2973);
+    t2977 = FFT_VADD(t2971, t2976);
+    t2978 = FFT_VSUB(t2971, t2976);
+    t2979 = FFT_VSCL(t2915, 0.38268343236508984);
+    t2980 = FFT_VMULNJ(t2915);
+    t2981 = FFT_VSCL(t2980, 0.9238795325112867);
+    t2982 = FFT_VADD(t2979, t2981);
+    t2983 = FFT_VMULNJ(t2924);
+    t2984 = FFT_VSUB(t2924, t2983);
+    t2985 = FFT_VSCL(t2984, 0.7071067811865475);
+    t2986 = FFT_VSCL(t2933, 0.9238795325112867);
+    t2987 = FFT_VMULNJ(t2933);
+    t2988 = FFT_VSCL(t2987, 0.3826834323650899);
+    t2989 = FFT_VADD(t2986, t2988);
+    t2990 = FFT_VSUB(t2906, t2985);
+    t2991 = FFT_VADD(t2906, t2985);
+    t2992 = FFT_VSUB(t2982, t2989);
+    t2993 = FFT_VADD(t2982, t2989);
+    t2994 = FFT_VADD(t2990, t2992);
+    t2995 = FFT_VSUB(t2990, t2992);
+    t2996 = FFT_VMULNJ(t2993);
+    t2997 = FFT_VADD(t2991, t2996);
+    t2998 = FFT_VSUB(t2991, t2996);
+    t2999 = FFT_VSCL(t162, 0.9757021300385286);
+    t3000 = FFT_VMULNJ(t162);
+    t3001 = FFT_VSCL(t3000, 0.2191012401568698);
+    t3002 = FFT_VADD(t2999, t3001);
+    t3003 = FFT_VSCL(t263, 0.9039892931234433);
+    t3004 = FFT_VMULNJ(t263);
+    t3005 = FFT_VSCL(t3004, 0.4275550934302821);
+    t3006 = FFT_VADD(t3003, t3005);
+    t3007 = FFT_VSCL(t364, 0.7883464276266063);
+    t3008 = FFT_VMULNJ(t364);
+    t3009 = FFT_VSCL(t3008, 0.6152315905806268);
+    t3010 = FFT_VADD(t3007, t3009);
+    t3011 = FFT_VSCL(t465, 0.6343932841636455);
+    t3012 = FFT_VMULNJ(t465);
+    t3013 = FFT_VSCL(t3012, 0.773010453362737);
+    t3014 = FFT_VADD(t3011, t3013);
+    t3015 = FFT_VSCL(t566, 0.4496113296546066);
+    t3016 = FFT_VMULNJ(t566);
+    t3017 = FFT_VSCL(t3016, 0.8932243011955153);
+    t3018 = FFT_VADD(t3015, t3017);
+    t3019 = FFT_VSCL(t667, 0.24298017990326398);
+    t3020 = FFT_VMULNJ(t667);
+    t3021 = FFT_VSCL(t3020, 0.970031253194544);
+    t3022 = FFT_VADD(t3019, t3021);
+    t3023 = FFT_VSCL(t768, 0.024541228522912264);
+    t3024 = FFT_VMULNJ(t768);
+    t3025 = FFT_VSCL(t3024, 0.9996988186962042);
+    t3026 = FFT_VADD(t3023, t3025);
+    t3027 = FFT_VSCL(t869, 0.1950903220161282);
+    t3028 = FFT_VMULNJ(t869);
+    t3029 = FFT_VSCL(t3028, 0.9807852804032304);
+    t3030 = FFT_VSUB(t3029, t3027);
+    t3031 = FFT_VSCL(t970, 0.40524131400498975);
+    t3032 = FFT_VMULNJ(t970);
+    t3033 = FFT_VSCL(t3032, 0.9142097557035307);
+    t3034 = FFT_VSUB(t3033, t3031);
+    t3035 = FFT_VSCL(t1071, 0.5956993044924334);
+    t3036 = FFT_VMULNJ(t1071);
+    t3037 = FFT_VSCL(t3036, 0.8032075314806449);
+    t3038 = FFT_VSUB(t3037, t3035);
+    t3039 = FFT_VSCL(t1172, 0.7572088465064846);
+    t3040 = FFT_VMULNJ(t1172);
+    t3041 = FFT_VSCL(t3040, 0.6531728429537766);
+    t3042 = FFT_VSUB(t3041, t3039);
+    t3043 = FFT_VSCL(t1273, 0.8819212643483549);
+    t3044 = FFT_VMULNJ(t1273);
+    t3045 = FFT_VSCL(t3044, 0.47139673682599786);
+    t3046 = FFT_VSUB(t3045, t3043);
+    t3047 = FFT_VSCL(t1374, 0.9637760657954398);
+    t3048 = FFT_VMULNJ(t1374);
+    t3049 = FFT_VSCL(t3048, 0.2667127574748985);
+    t3050 = FFT_VSUB(t3049, t3047);
+    t3051 = FFT_VSCL(t1475, 0.9987954562051724);
+    t3052 = FFT_VMULNJ(t1475);
+    t3053 = FFT_VSCL(t3052, 0.049067674327417966);
+    t3054 = FFT_VSUB(t3053, t3051);
+    t3055 = FFT_VSCL(t1576, 0.9852776423889412);
+    t3056 = FFT_VMULNJ(t1576);
+    t3057 = FFT_VSCL(t3056, 0.17096188876030122);
+    t3058 = FFT_VADD(t3055, t3057);
+    t3059 = FFT_VADD(t3030, t61);
+    t3060 = FFT_VSUB(t61, t3030);
+    t3061 = FFT_VADD(t3014, t3046);
+    t3062 = FFT_VSUB(t3014, t3046);
+    t3063 = FFT_VADD(t3059, t3061);
+    t3064 = FFT_VSUB(t3059, t3061);
+    t3065 = FFT_VMULNJ(t3062);
+    t3066 = FFT_VADD(t3060, t3065);
+    t3067 = FFT_VSUB(t3060, t3065);
+    t3068 = FFT_VADD(t3002, t3034);
+    t3069 = FFT_VSUB(t3002, t3034);
+    t3070 = FFT_VADD(t3018, t3050);
+    t3071 = FFT_VSUB(t3018, t3050);
+    t3072 = FFT_VADD(t3068, t3070);
+    t3073 = FFT_VSUB(t3068, t3070);
+    t3074 = FFT_VMULNJ(t3071);
+    t3075 = FFT_VADD(t3069, t3074);
+    t3076 = FFT_VSUB(t3069, t3074);
+    t3077 = FFT_VADD(t3006, t3038);
+    t3078 = FFT_VSUB(t3006, t3038);
+    t3079 = FFT_VADD(t3022, t3054);
+    t3080 = FFT_VSUB(t3022, t3054);
+    t3081 = FFT_VADD(t3077, t3079);
+    t3082 = FFT_VSUB(t3077, t3079);
+    t3083 = FFT_VMULNJ(t3080);
+    t3084 = FFT_VADD(t3078, t3083);
+    t3085 = FFT_VSUB(t3078, t3083);
+    t3086 = FFT_VADD(t3010, t3042);
+    t3087 = FFT_VSUB(t3010, t3042);
+    t3088 = FFT_VSUB(t3026, t3058);
+    t3089 = FFT_VADD(t3026, t3058);
+    t3090 = FFT_VADD(t3086, t3088);
+    t3091 = FFT_VSUB(t3086, t3088);
+    t3092 = FFT_VMULNJ(t3089);
+    t3093 = FFT_VADD(t3087, t3092);
+    t3094 = FFT_VSUB(t3087, t3092);
+    t3095 = FFT_VADD(t3063, t3081);
+    t3096 = FFT_VSUB(t3063, t3081);
+    t3097 = FFT_VADD(t3072, t3090);
+    t3098 = FFT_VSUB(t3072, t3090);
+    t3099 = FFT_VADD(t3095, t3097);
+    t3100 = FFT_VSUB(t3095, t3097);
+    t3101 = FFT_VMULNJ(t3098);
+    t3102 = FFT_VADD(t3096, t3101);
+    t3103 = FFT_VSUB(t3096, t3101);
+    t3104 = FFT_VSCL(t3075, 0.9238795325112867);
+    t3105 = FFT_VMULNJ(t3075);
+    t3106 = FFT_VSCL(t3105, 0.3826834323650898);
+    t3107 = FFT_VADD(t3104, t3106);
+    t3108 = FFT_VMULNJ(t3084);
+    t3109 = FFT_VADD(t3084, t3108);
+    t3110 = FFT_VSCL(t3109, 0.7071067811865476);
+    t3111 = FFT_VSCL(t3093, 0.38268343236508984);
+    t3112 = FFT_VMULNJ(t3093);
+    t3113 = FFT_VSCL(t3112, 0.9238795325112867);
+    t3114 = FFT_VADD(t3111, t3113);
+    t3115 = FFT_VADD(t3066, t3110);
+    t3116 = FFT_VSUB(t3066, t3110);
+    t3117 = FFT_VADD(t3107, t3114);
+    t3118 = FFT_VSUB(t3107, t3114);
+    t3119 = FFT_VADD(t3115, t3117);
+    t3120 = FFT_VSUB(t3115, t3117);
+    t3121 = FFT_VMULNJ(t3118);
+    t3122 = FFT_VADD(t3116, t3121);
+    t3123 = FFT_VSUB(t3116, t3121);
+    t3124 = FFT_VMULNJ(t3073);
+    t3125 = FFT_VADD(t3073, t3124);
+    t3126 = FFT_VSCL(t3125, 0.7071067811865476);
+    t3127 = FFT_VMULNJ(t3082);
+    t3128 = FFT_VMULNJ(t3091);
+    t3129 = FFT_VSUB(t3091, t3128);
+    t3130 = FFT_VSCL(t3129, 0.7071067811865475);
+    t3131 = FFT_VADD(t3064, t3127);
+    t3132 = FFT_VSUB(t3064, t3127);
+    t3133 = FFT_VSUB(t3126, t3130);
+    t3134 = FFT_VADD(t3126, t3130);
+    t3135 = FFT_VADD(t3131, t3133);
+    t3136 = FFT_VSUB(t3131, t3133);
+    t3137 = FFT_VMULNJ(t3134);
+    t3138 = FFT_VADD(t3132, t3137);
+    t3139 = FFT_VSUB(t3132, t3137);
+    t3140 = FFT_VSCL(t3076, 0.38268343236508984);
+    t3141 = FFT_VMULNJ(t3076);
+    t3142 = FFT_VSCL(t3141, 0.9238795325112867);
+    t3143 = FFT_VADD(t3140, t3142);
+    t3144 = FFT_VMULNJ(t3085);
+    t3145 = FFT_VSUB(t3085, t3144);
+    t3146 = FFT_VSCL(t3145, 0.7071067811865475);
+    t3147 = FFT_VSCL(t3094, 0.9238795325112867);
+    t3148 = FFT_VMULNJ(t3094);
+    t3149 = FFT_VSCL(t3148, 0.3826834323650899);
+    t3150 = FFT_VADD(t3147, t3149);
+    t3151 = FFT_VSUB(t3067, t3146);
+    t3152 = FFT_VADD(t3067, t3146);
+    t3153 = FFT_VSUB(t3143, t3150);
+    t3154 = FFT_VADD(t3143, t3150);
+    t3155 = FFT_VADD(t3151, t3153);
+    t3156 = FFT_VSUB(t3151, t3153);
+    t3157 = FFT_VMULNJ(t3154);
+    t3158 = FFT_VADD(t3152, t3157);
+    t3159 = FFT_VSUB(t3152, t3157);
+    t3160 = FFT_VSCL(t178, 0.970031253194544);
+    t3161 = FFT_VMULNJ(t178);
+    t3162 = FFT_VSCL(t3161, 0.24298017990326387);
+    t3163 = FFT_VADD(t3160, t3162);
+    t3164 = FFT_VSCL(t279, 0.881921264348355);
+    t3165 = FFT_VMULNJ(t279);
+    t3166 = FFT_VSCL(t3165, 0.47139673682599764);
+    t3167 = FFT_VADD(t3164, t3166);
+    t3168 = FFT_VSCL(t380, 0.7409511253549591);
+    t3169 = FFT_VMULNJ(t380);
+    t3170 = FFT_VSCL(t3169, 0.6715589548470183);
+    t3171 = FFT_VADD(t3168, t3170);
+    t3172 = FFT_VSCL(t481, 0.5555702330196023);
+    t3173 = FFT_VMULNJ(t481);
+    t3174 = FFT_VSCL(t3173, 0.8314696123025452);
+    t3175 = FFT_VADD(t3172, t3174);
+    t3176 = FFT_VSCL(t582, 0.33688985339222005);
+    t3177 = FFT_VMULNJ(t582);
+    t3178 = FFT_VSCL(t3177, 0.9415440651830208);
+    t3179 = FFT_VADD(t3176, t3178);
+    t3180 = FFT_VSCL(t683, 0.09801714032956077);
+    t3181 = FFT_VMULNJ(t683);
+    t3182 = FFT_VSCL(t3181, 0.9951847266721968);
+    t3183 = FFT_VADD(t3180, t3182);
+    t3184 = FFT_VSCL(t784, 0.14673047445536164);
+    t3185 = FFT_VMULNJ(t784);
+    t3186 = FFT_VSCL(t3185, 0.989176509964781);
+    t3187 = FFT_VSUB(t3186, t3184);
+    t3188 = FFT_VSCL(t885, 0.3826834323650897);
+    t3189 = FFT_VMULNJ(t885);
+    t3190 = FFT_VSCL(t3189, 0.9238795325112867);
+    t3191 = FFT_VSUB(t3190, t3188);
+    t3192 = FFT_VSCL(t986, 0.5956993044924334);
+    t3193 = FFT_VMULNJ(t986);
+    t3194 = FFT_VSCL(t3193, 0.8032075314806449);
+    t3195 = FFT_VSUB(t3194, t3192);
+    t3196 = FFT_VSCL(t1087, 0.773010453362737);
+    t3197 = FFT_VMULNJ(t1087);
+    t3198 = FFT_VSCL(t3197, 0.6343932841636455);
+    t3199 = FFT_VSUB(t3198, t3196);
+    t3200 = FFT_VSCL(t1188, 0.9039892931234433);
+    t3201 = FFT_VMULNJ(t1188);
+    t3202 = FFT_VSCL(t3201, 0.42755509343028203);
+    t3203 = FFT_VSUB(t3202, t3200);
+    t3204 = FFT_VSCL(t1289, 0.9807852804032304);
+    t3205 = FFT_VMULNJ(t1289);
+    t3206 = FFT_VSCL(t3205, 0.1950903220161286);
+    t3207 = FFT_VSUB(t3206, t3204);
+    t3208 = FFT_VSCL(t1390, 0.9987954562051724);
+    t3209 = FFT_VMULNJ(t1390);
+    t3210 = FFT_VSCL(t3209, 0.049067674327417966);
+    t3211 = FFT_VADD(t3208, t3210);
+    t3212 = FFT_VSCL(t1491, 0.9569403357322088);
+    t3213 = FFT_VMULNJ(t1491);
+    t3214 = FFT_VSCL(t3213, 0.2902846772544624);
+    t3215 = FFT_VADD(t3212, t3214);
+    t3216 = FFT_VSCL(t1592, 0.857728610000272);
+    t3217 = FFT_VMULNJ(t1592);
+    t3218 = FFT_VSCL(t3217, 0.5141027441932218);
+    t3219 = FFT_VADD(t3216, t3218);
+    t3220 = FFT_VADD(t3191, t77);
+    t3221 = FFT_VSUB(t77, t3191);
+    t3222 = FFT_VADD(t3175, t3207);
+    t3223 = FFT_VSUB(t3175, t3207);
+    t3224 = FFT_VADD(t3220, t3222);
+    t3225 = FFT_VSUB(t3220, t3222);
+    t3226 = FFT_VMULNJ(t3223);
+    t3227 = FFT_VADD(t3221, t3226);
+    t3228 = FFT_VSUB(t3221, t3226);
+    t3229 = FFT_VADD(t3163, t3195);
+    t3230 = FFT_VSUB(t3163, t3195);
+    t3231 = FFT_VSUB(t3179, t3211);
+    t3232 = FFT_VADD(t3179, t3211);
+    t3233 = FFT_VADD(t3229, t3231);
+    t3234 = FFT_VSUB(t3229, t3231);
+    t3235 = FFT_VMULNJ(t3232);
+    t3236 = FFT_VADD(t3230, t3235);
+    t3237 = FFT_VSUB(t3230, t3235);
+    t3238 = FFT_VADD(t3167, t3199);
+    t3239 = FFT_VSUB(t3167, t3199);
+    t3240 = FFT_VSUB(t3183, t3215);
+    t3241 = FFT_VADD(t3183, t3215);
+    t3242 = FFT_VADD(t3238, t3240);
+    t3243 = FFT_VSUB(t3238, t3240);
+    t3244 = FFT_VMULNJ(t3241);
+    t3245 = FFT_VADD(t3239, t3244);
+    t3246 = FFT_VSUB(t3239, t3244);
+    t3247 = FFT_VADD(t3171, t3203);
+    t3248 = FFT_VSUB(t3171, t3203);
+    t3249 = FFT_VSUB(t3187, t3219);
+    t3250 = FFT_VADD(t3187, t3219);
+    t3251 = FFT_VADD(t3247, t3249);
+    t3252 = FFT_VSUB(t3247, t3249);
+    t3253 = FFT_VMULNJ(t3250);
+    t3254 = FFT_VADD(t3248, t3253);
+    t3255 = FFT_VSUB(t3248, t3253);
+    t3256 = FFT_VADD(t3224, t3242);
+    t3257 = FFT_VSUB(t3224, t3242);
+    t3258 = FFT_VADD(t3233, t3251);
+    t3259 = FFT_VSUB(t3233, t3251);
+    t3260 = FFT_VADD(t3256, t3258);
+    t3261 = FFT_VSUB(t3256, t3258);
+    t3262 = FFT_VMULNJ(t3259);
+    t3263 = FFT_VADD(t3257, t3262);
+    t3264 = FFT_VSUB(t3257, t3262);
+    t3265 = FFT_VSCL(t3236, 0.9238795325112867);
+    t3266 = FFT_VMULNJ(t3236);
+    t3267 = FFT_VSCL(t3266, 0.3826834323650898);
+    t3268 = FFT_VADD(t3265, t3267);
+    t3269 = FFT_VMULNJ(t3245);
+    t3270 = FFT_VADD(t3245, t3269);
+    t3271 = FFT_VSCL(t3270, 0.7071067811865476);
+    t3272 = FFT_VSCL(t3254, 0.38268343236508984);
+    t3273 = FFT_VMULNJ(t3254);
+    t3274 = FFT_VSCL(t3273, 0.9238795325112867);
+    t3275 = FFT_VADD(t3272, t3274);
+    t3276 = FFT_VADD(t3227, t3271);
+    t3277 = FFT_VSUB(t3227, t3271);
+    t3278 = FFT_VADD(t3268, t3275);
+    t3279 = FFT_VSUB(t3268, t3275);
+    t3280 = FFT_VADD(t3276, t3278);
+    t3281 = FFT_VSUB(t3276, t3278);
+    t3282 = FFT_VMULNJ(t3279);
+    t3283 = FFT_VADD(t3277, t3282);
+    t3284 = FFT_VSUB(t3277, t3282);
+    t3285 = FFT_VMULNJ(t3234);
+    t3286 = FFT_VADD(t3234, t3285);
+    t3287 = FFT_VSCL(t3286, 0.7071067811865476);
+    t3288 = FFT_VMULNJ(t3243);
+    t3289 = FFT_VMULNJ(t3252);
+    t3290 = FFT_VSUB(t3252, t3289);
+    t3291 = FFT_VSCL(t3290, 0.7071067811865475);
+    t3292 = FFT_VADD(t3225, t3288);
+    t3293 = FFT_VSUB(t3225, t3288);
+    t3294 = FFT_VSUB(t3287, t3291);
+    t3295 = FFT_VADD(t3287, t3291);
+    t3296 = FFT_VADD(t3292, t3294);
+    t3297 = FFT_VSUB(t3292, t3294);
+    t3298 = FFT_VMULNJ(t3295);
+    t3299 = FFT_VADD(t3293, t3298);
+    t3300 = FFT_VSUB(t3293, t3298);
+    t3301 = FFT_VSCL(t3237, 0.38268343236508984);
+    t3302 = FFT_VMULNJ(t3237);
+    t3303 = FFT_VSCL(t3302, 0.9238795325112867);
+    t3304 = FFT_VADD(t3301, t3303);
+    t3305 = FFT_VMULNJ(t3246);
+    t3306 = FFT_VSUB(t3246, t3305);
+    t3307 = FFT_VSCL(t3306, 0.7071067811865475);
+    t3308 = FFT_VSCL(t3255, 0.9238795325112867);
+    t3309 = FFT_VMULNJ(t3255);
+    t3310 = FFT_VSCL(t3309, 0.3826834323650899);
+    t3311 = FFT_VADD(t3308, t3310);
+    t3312 = FFT_VSUB(t3228, t3307);
+    t3313 = FFT_VADD(t3228, t3307);
+    t3314 = FFT_VSUB(t3304, t3311);
+    t3315 = FFT_VADD(t3304, t3311);
+    t3316 = FFT_VADD(t3312, t3314);
+    t3317 = FFT_VSUB(t3312, t3314);
+    t3318 = FFT_VMULNJ(t3315);
+    t3319 = FFT_VADD(t3313, t3318);
+    t3320 = FFT_VSUB(t3313, t3318);
+    t3321 = FFT_VSCL(t198, 0.9637760657954398);
+    t3322 = FFT_VMULNJ(t198);
+    t3323 = FFT_VSCL(t3322, 0.26671275747489837);
+    t3324 = FFT_VADD(t3321, t3323);
+    t3325 = FFT_VSCL(t299, 0.8577286100002721);
+    t3326 = FFT_VMULNJ(t299);
+    t3327 = FFT_VSCL(t3326, 0.5141027441932217);
+    t3328 = FFT_VADD(t3325, t3327);
+    t3329 = FFT_VSCL(t400, 0.6895405447370669);
+    t3330 = FFT_VMULNJ(t400);
+    t3331 = FFT_VSCL(t3330, 0.7242470829514669);
+    t3332 = FFT_VADD(t3329, t3331);
+    t3333 = FFT_VSCL(t501, 0.4713967368259978);
+    t3334 = FFT_VMULNJ(t501);
+    t3335 = FFT_VSCL(t3334, 0.8819212643483549);
+    t3336 = FFT_VADD(t3333, t3335);
+    t3337 = FFT_VSCL(t602, 0.21910124015686977);
+    t3338 = FFT_VMULNJ(t602);
+    t3339 = FFT_VSCL(t3338, 0.9757021300385286);
+    t3340 = FFT_VADD(t3337, t3339);
+    t3341 = FFT_VSCL(t703, 0.04906767432741801);
+    t3342 = FFT_VMULNJ(t703);
+    t3343 = FFT_VSCL(t3342, 0.9987954562051724);
+    t3344 = FFT_VSUB(t3343, t3341);
+    t3345 = FFT_VSCL(t804, 0.3136817403988914);
+    t3346 = FFT_VMULNJ(t804);
+    t3347 = FFT_VSCL(t3346, 0.9495281805930367);
+    t3348 = FFT_VSUB(t3347, t3345);
+    t3349 = FFT_VSCL(t905, 0.555570233019602);
+    t3350 = FFT_VMULNJ(t905);
+    t3351 = FFT_VSCL(t3350, 0.8314696123025455);
+    t3352 = FFT_VSUB(t3351, t3349);
+    t3353 = FFT_VSCL(t1006, 0.7572088465064846);
+    t3354 = FFT_VMULNJ(t1006);
+    t3355 = FFT_VSCL(t3354, 0.6531728429537766);
+    t3356 = FFT_VSUB(t3355, t3353);
+    t3357 = FFT_VSCL(t1107, 0.9039892931234433);
+    t3358 = FFT_VMULNJ(t1107);
+    t3359 = FFT_VSCL(t3358, 0.42755509343028203);
+    t3360 = FFT_VSUB(t3359, t3357);
+    t3361 = FFT_VSCL(t1208, 0.9852776423889412);
+    t3362 = FFT_VMULNJ(t1208);
+    t3363 = FFT_VSCL(t3362, 0.17096188876030122);
+    t3364 = FFT_VSUB(t3363, t3361);
+    t3365 = FFT_VSCL(t1309, 0.9951847266721968);
+    t3366 = FFT_VMULNJ(t1309);
+    t3367 = FFT_VSCL(t3366, 0.09801714032956083);
+    t3368 = FFT_VADD(t3365, t3367);
+    t3369 = FFT_VSCL(t1410, 0.9329927988347388);
+    t3370 = FFT_VMULNJ(t1410);
+    t3371 = FFT_VSCL(t3370, 0.35989503653498833);
+    t3372 = FFT_VADD(t3369, t3371);
+    t3373 = FFT_VSCL(t1511, 0.8032075314806448);
+    t3374 = FFT_VMULNJ(t1511);
+    t3375 = FFT_VSCL(t3374, 0.5956993044924335);
+    t3376 = FFT_VADD(t3373, t3375);
+    t3377 = FFT_VSCL(t1612, 0.6152315905806267);
+    t3378 = FFT_VMULNJ(t1612);
+    t3379 = FFT_VSCL(t3378, 0.7883464276266063);
+    t3380 = FFT_VADD(t3377, t3379);
+    t3381 = FFT_VADD(t3352, t97);
+    t3382 = FFT_VSUB(t97, t3352);
+    t3383 = FFT_VSUB(t3336, t3368);
+    t3384 = FFT_VADD(t3336, t3368);
+    t3385 = FFT_VADD(t3381, t3383);
+    t3386 = FFT_VSUB(t3381, t3383);
+    t3387 = FFT_VMULNJ(t3384);
+    t3388 = FFT_VADD(t3382, t3387);
+    t3389 = FFT_VSUB(t3382, t3387);
+    t3390 = FFT_VADD(t3324, t3356);
+    t3391 = FFT_VSUB(t3324, t3356);
+    t3392 = FFT_VSUB(t3340, t3372);
+    t3393 = FFT_VADD(t3340, t3372);
+    t3394 = FFT_VADD(t3390, t3392);
+    t3395 = FFT_VSUB(t3390, t3392);
+    t3396 = FFT_VMULNJ(t3393);
+    t3397 = FFT_VADD(t3391, t3396);
+    t3398 = FFT_VSUB(t3391, t3396);
+    t3399 = FFT_VADD(t3328, t3360);
+    t3400 = FFT_VSUB(t3328, t3360);
+    t3401 = FFT_VSUB(t3344, t3376);
+    t3402 = FFT_VADD(t3344, t3376);
+    t3403 = FFT_VADD(t3399, t3401);
+    t3404 = FFT_VSUB(t3399, t3401);
+    t3405 = FFT_VMULNJ(t3402);
+    t3406 = FFT_VADD(t3400, t3405);
+    t3407 = FFT_VSUB(t3400, t3405);
+    t3408 = FFT_VADD(t3332, t3364);
+    t3409 = FFT_VSUB(t3332, t3364);
+    t3410 = FFT_VSUB(t3348, t3380);
+    t3411 = FFT_VADD(t3348, t3380);
+    t3412 = FFT_VADD(t3408, t3410);
+    t3413 = FFT_VSUB(t3408, t3410);
+    t3414 = FFT_VMULNJ(t3411);
+    t3415 = FFT_VADD(t3409, t3414);
+    t3416 = FFT_VSUB(t3409, t3414);
+    t3417 = FFT_VADD(t3385, t3403);
+    t3418 = FFT_VSUB(t3385, t3403);
+    t3419 = FFT_VADD(t3394, t3412);
+    t3420 = FFT_VSUB(t3394, t3412);
+    t3421 = FFT_VADD(t3417, t3419);
+    t3422 = FFT_VSUB(t3417, t3419);
+    t3423 = FFT_VMULNJ(t3420);
+    t3424 = FFT_VADD(t3418, t3423);
+    t3425 = FFT_VSUB(t3418, t3423);
+    t3426 = FFT_VSCL(t3397, 0.9238795325112867);
+    t3427 = FFT_VMULNJ(t3397);
+    t3428 = FFT_VSCL(t3427, 0.3826834323650898);
+    t3429 = FFT_VADD(t3426, t3428);
+    t3430 = FFT_VMULNJ(t3406);
+    t3431 = FFT_VADD(t3406, t3430);
+    t3432 = FFT_VSCL(t3431, 0.7071067811865476);
+    t3433 = FFT_VSCL(t3415, 0.38268343236508984);
+    t3434 = FFT_VMULNJ(t3415);
+    t3435 = FFT_VSCL(t3434, 0.9238795325112867);
+    t3436 = FFT_VADD(t3433, t3435);
+    t3437 = FFT_VADD(t3388, t3432);
+    t3438 = FFT_VSUB(t3388, t3432);
+    t3439 = FFT_VADD(t3429, t3436);
+    t3440 = FFT_VSUB(t3429, t3436);
+    t3441 = FFT_VADD(t3437, t3439);
+    t3442 = FFT_VSUB(t3437, t3439);
+    t3443 = FFT_VMULNJ(t3440);
+    t3444 = FFT_VADD(t3438, t3443);
+    t3445 = FFT_VSUB(t3438, t3443);
+    t3446 = FFT_VMULNJ(t3395);
+    t3447 = FFT_VADD(t3395, t3446);
+    t3448 = FFT_VSCL(t3447, 0.7071067811865476);
+    t3449 = FFT_VMULNJ(t3404);
+    t3450 = FFT_VMULNJ(t3413);
+    t3451 = FFT_VSUB(t3413, t3450);
+    t3452 = FFT_VSCL(t3451, 0.7071067811865475);
+    t3453 = FFT_VADD(t3386, t3449);
+    t3454 = FFT_VSUB(t3386, t3449);
+    t3455 = FFT_VSUB(t3448, t3452);
+    t3456 = FFT_VADD(t3448, t3452);
+    t3457 = FFT_VADD(t3453, t3455);
+    t3458 = FFT_VSUB(t3453, t3455);
+    t3459 = FFT_VMULNJ(t3456);
+    t3460 = FFT_VADD(t3454, t3459);
+    t3461 = FFT_VSUB(t3454, t3459);
+    t3462 = FFT_VSCL(t3398, 0.38268343236508984);
+    t3463 = FFT_VMULNJ(t3398);
+    t3464 = FFT_VSCL(t3463, 0.9238795325112867);
+    t3465 = FFT_VADD(t3462, t3464);
+    t3466 = FFT_VMULNJ(t3407);
+    t3467 = FFT_VSUB(t3407, t3466);
+    t3468 = FFT_VSCL(t3467, 0.7071067811865475);
+    t3469 = FFT_VSCL(t3416, 0.9238795325112867);
+    t3470 = FFT_VMULNJ(t3416);
+    t3471 = FFT_VSCL(t3470, 0.3826834323650899);
+    t3472 = FFT_VADD(t3469, t3471);
+    t3473 = FFT_VSUB(t3389, t3468);
+    t3474 = FFT_VADD(t3389, t3468);
+    t3475 = FFT_VSUB(t3465, t3472);
+    t3476 = FFT_VADD(t3465, t3472);
+    t3477 = FFT_VADD(t3473, t3475);
+    t3478 = FFT_VSUB(t3473, t3475);
+    t3479 = FFT_VMULNJ(t3476);
+    t3480 = FFT_VADD(t3474, t3479);
+    t3481 = FFT_VSUB(t3474, t3479);
+    t3482 = FFT_VSCL(t145, 0.9569403357322088);
+    t3483 = FFT_VMULNJ(t145);
+    t3484 = FFT_VSCL(t3483, 0.29028467725446233);
+    t3485 = FFT_VADD(t3482, t3484);
+    t3486 = FFT_VSCL(t246, 0.8314696123025452);
+    t3487 = FFT_VMULNJ(t246);
+    t3488 = FFT_VSCL(t3487, 0.5555702330196022);
+    t3489 = FFT_VADD(t3486, t3488);
+    t3490 = FFT_VSCL(t347, 0.6343932841636455);
+    t3491 = FFT_VMULNJ(t347);
+    t3492 = FFT_VSCL(t3491, 0.773010453362737);
+    t3493 = FFT_VADD(t3490, t3492);
+    t3494 = FFT_VSCL(t448, 0.38268343236508984);
+    t3495 = FFT_VMULNJ(t448);
+    t3496 = FFT_VSCL(t3495, 0.9238795325112867);
+    t3497 = FFT_VADD(t3494, t3496);
+    t3498 = FFT_VSCL(t549, 0.09801714032956077);
+    t3499 = FFT_VMULNJ(t549);
+    t3500 = FFT_VSCL(t3499, 0.9951847266721968);
+    t3501 = FFT_VADD(t3498, t3500);
+    t3502 = FFT_VSCL(t650, 0.1950903220161282);
+    t3503 = FFT_VMULNJ(t650);
+    t3504 = FFT_VSCL(t3503, 0.9807852804032304);
+    t3505 = FFT_VSUB(t3504, t3502);
+    t3506 = FFT_VSCL(t751, 0.4713967368259977);
+    t3507 = FFT_VMULNJ(t751);
+    t3508 = FFT_VSCL(t3507, 0.881921264348355);
+    t3509 = FFT_VSUB(t3508, t3506);
+    t3510 = FFT_VMULNJ(t852);
+    t3511 = FFT_VSUB(t852, t3510);
+    t3512 = FFT_VSCL(t3511, 0.7071067811865475);
+    t3513 = FFT_VSCL(t953, 0.8819212643483549);
+    t3514 = FFT_VMULNJ(t953);
+    t3515 = FFT_VSCL(t3514, 0.47139673682599786);
+    t3516 = FFT_VSUB(t3515, t3513);
+    t3517 = FFT_VSCL(t1054, 0.9807852804032304);
+    t3518 = FFT_VMULNJ(t1054);
+    t3519 = FFT_VSCL(t3518, 0.1950903220161286);
+    t3520 = FFT_VSUB(t3519, t3517);
+    t3521 = FFT_VSCL(t1155, 0.9951847266721968);
+    t3522 = FFT_VMULNJ(t1155);
+    t3523 = FFT_VSCL(t3522, 0.09801714032956083);
+    t3524 = FFT_VADD(t3521, t3523);
+    t3525 = FFT_VSCL(t1256, 0.9238795325112867);
+    t3526 = FFT_VMULNJ(t1256);
+    t3527 = FFT_VSCL(t3526, 0.3826834323650899);
+    t3528 = FFT_VADD(t3525, t3527);
+    t3529 = FFT_VSCL(t1357, 0.773010453362737);
+    t3530 = FFT_VMULNJ(t1357);
+    t3531 = FFT_VSCL(t3530, 0.6343932841636455);
+    t3532 = FFT_VADD(t3529, t3531);
+    t3533 = FFT_VSCL(t1458, 0.555570233019602);
+    t3534 = FFT_VMULNJ(t1458);
+    t3535 = FFT_VSCL(t3534, 0.8314696123025455);
+    t3536 = FFT_VADD(t3533, t3535);
+    t3537 = FFT_VSCL(t1559, 0.29028467725446216);
+    t3538 = FFT_VMULNJ(t1559);
+    t3539 = FFT_VSCL(t3538, 0.9569403357322089);
+    t3540 = FFT_VADD(t3537, t3539);
+    t3541 = FFT_VSUB(t44, t3512);
+    t3542 = FFT_VADD(t3512, t44);
+    t3543 = FFT_VSUB(t3497, t3528);
+    t3544 = FFT_VADD(t3497, t3528);
+    t3545 = FFT_VADD(t3541, t3543);
+    t3546 = FFT_VSUB(t3541, t3543);
+    t3547 = FFT_VMULNJ(t3544);
+    t3548 = FFT_VADD(t3542, t3547);
+    t3549 = FFT_VSUB(t3542, t3547);
+    t3550 = FFT_VADD(t3485, t3516);
+    t3551 = FFT_VSUB(t3485, t3516);
+    t3552 = FFT_VSUB(t3501, t3532);
+    t3553 = FFT_VADD(t3501, t3532);
+    t3554 = FFT_VADD(t3550, t3552);
+    t3555 = FFT_VSUB(t3550, t3552);
+    t3556 = FFT_VMULNJ(t3553);
+    t3557 = FFT_VADD(t3551, t3556);
+    t3558 = FFT_VSUB(t3551, t3556);
+    t3559 = FFT_VADD(t3489, t3520);
+    t3560 = FFT_VSUB(t3489, t3520);
+    t3561 = FFT_VSUB(t3505, t3536);
+    t3562 = FFT_VADD(t3505, t3536);
+    t3563 = FFT_VADD(t3559, t3561);
+    t3564 = FFT_VSUB(t3559, t3561);
+    t3565 = FFT_VMULNJ(t3562);
+    t3566 = FFT_VADD(t3560, t3565);
+    t3567 = FFT_VSUB(t3560, t3565);
+    t3568 = FFT_VSUB(t3493, t3524);
+    t3569 = FFT_VADD(t3493, t3524);
+    t3570 = FFT_VSUB(t3509, t3540);
+    t3571 = FFT_VADD(t3509, t3540);
+    t3572 = FFT_VADD(t3568, t3570);
+    t3573 = FFT_VSUB(t3568, t3570);
+    t3574 = FFT_VMULNJ(t3571);
+    t3575 = FFT_VADD(t3569, t3574);
+    t3576 = FFT_VSUB(t3569, t3574);
+    t3577 = FFT_VADD(t3545, t3563);
+    t3578 = FFT_VSUB(t3545, t3563);
+    t3579 = FFT_VADD(t3554, t3572);
+    t3580 = FFT_VSUB(t3554, t3572);
+    t3581 = FFT_VADD(t3577, t3579);
+    t3582 = FFT_VSUB(t3577, t3579);
+    t3583 = FFT_VMULNJ(t3580);
+    t3584 = FFT_VADD(t3578, t3583);
+    t3585 = FFT_VSUB(t3578, t3583);
+    t3586 = FFT_VSCL(t3557, 0.9238795325112867);
+    t3587 = FFT_VMULNJ(t3557);
+    t3588 = FFT_VSCL(t3587, 0.3826834323650898);
+    t3589 = FFT_VADD(t3586, t3588);
+    t3590 = FFT_VMULNJ(t3566);
+    t3591 = FFT_VADD(t3566, t3590);
+    t3592 = FFT_VSCL(t3591, 0.7071067811865476);
+    t3593 = FFT_VSCL(t3575, 0.38268343236508984);
+    t3594 = FFT_VMULNJ(t3575);
+    t3595 = FFT_VSCL(t3594, 0.9238795325112867);
+    t3596 = FFT_VADD(t3593, t3595);
+    t3597 = FFT_VADD(t3548, t3592);
+    t3598 = FFT_VSUB(t3548, t3592);
+    t3599 = FFT_VADD(t3589, t3596);
+    t3600 = FFT_VSUB(t3589, t3596);
+    t3601 = FFT_VADD(t3597, t3599);
+    t3602 = FFT_VSUB(t3597, t3599);
+    t3603 = FFT_VMULNJ(t3600);
+    t3604 = FFT_VADD(t3598, t3603);
+    t3605 = FFT_VSUB(t3598, t3603);
+    t3606 = FFT_VMULNJ(t3555);
+    t3607 = FFT_VADD(t3555, t3606);
+    t3608 = FFT_VSCL(t3607, 0.7071067811865476);
+    t3609 = FFT_VMULNJ(t3564);
+    t3610 = FFT_VMULNJ(t3573);
+    t3611 = FFT_VSUB(t3573, t3610);
+    t3612 = FFT_VSCL(t3611, 0.7071067811865475);
+    t3613 = FFT_VADD(t3546, t3609);
+    t3614 = FFT_VSUB(t3546, t3609);
+    t3615 = FFT_VSUB(t3608, t3612);
+    t3616 = FFT_VADD(t3608, t3612);
+    t3617 = FFT_VADD(t3613, t3615);
+    t3618 = FFT_VSUB(t3613, t3615);
+    t3619 = FFT_VMULNJ(t3616);
+    t3620 = FFT_VADD(t3614, t3619);
+    t3621 = FFT_VSUB(t3614, t3619);
+    t3622 = FFT_VSCL(t3558, 0.38268343236508984);
+    t3623 = FFT_VMULNJ(t3558);
+    t3624 = FFT_VSCL(t3623, 0.9238795325112867);
+    t3625 = FFT_VADD(t3622, t3624);
+    t3626 = FFT_VMULNJ(t3567);
+    t3627 = FFT_VSUB(t3567, t3626);
+    t3628 = FFT_VSCL(t3627, 0.7071067811865475);
+    t3629 = FFT_VSCL(t3576, 0.9238795325112867);
+    t3630 = FFT_VMULNJ(t3576);
+    t3631 = FFT_VSCL(t3630, 0.3826834323650899);
+    t3632 = FFT_VADD(t3629, t3631);
+    t3633 = FFT_VSUB(t3549, t3628);
+    t3634 = FFT_VADD(t3549, t3628);
+    t3635 = FFT_VSUB(t3625, t3632);
+    t3636 = FFT_VADD(t3625, t3632);
+    t3637 = FFT_VADD(t3633, t3635);
+    t3638 = FFT_VSUB(t3633, t3635);
+    t3639 = FFT_VMULNJ(t3636);
+    t3640 = FFT_VADD(t3634, t3639);
+    t3641 = FFT_VSUB(t3634, t3639);
+    t3642 = FFT_VSCL(t165, 0.9495281805930367);
+    t3643 = FFT_VMULNJ(t165);
+    t3644 = FFT_VSCL(t3643, 0.3136817403988915);
+    t3645 = FFT_VADD(t3642, t3644);
+    t3646 = FFT_VSCL(t266, 0.8032075314806449);
+    t3647 = FFT_VMULNJ(t266);
+    t3648 = FFT_VSCL(t3647, 0.5956993044924334);
+    t3649 = FFT_VADD(t3646, t3648);
+    t3650 = FFT_VSCL(t367, 0.5758081914178453);
+    t3651 = FFT_VMULNJ(t367);
+    t3652 = FFT_VSCL(t3651, 0.8175848131515837);
+    t3653 = FFT_VADD(t3650, t3652);
+    t3654 = FFT_VSCL(t468, 0.29028467725446233);
+    t3655 = FFT_VMULNJ(t468);
+    t3656 = FFT_VSCL(t3655, 0.9569403357322089);
+    t3657 = FFT_VADD(t3654, t3656);
+    t3658 = FFT_VSCL(t569, 0.024541228522912142);
+    t3659 = FFT_VMULNJ(t569);
+    t3660 = FFT_VSCL(t3659, 0.9996988186962042);
+    t3661 = FFT_VSUB(t3660, t3658);
+    t3662 = FFT_VSCL(t670, 0.33688985339221994);
+    t3663 = FFT_VMULNJ(t670);
+    t3664 = FFT_VSCL(t3663, 0.9415440651830208);
+    t3665 = FFT_VSUB(t3664, t3662);
+    t3666 = FFT_VSCL(t771, 0.6152315905806267);
+    t3667 = FFT_VMULNJ(t771);
+    t3668 = FFT_VSCL(t3667, 0.7883464276266063);
+    t3669 = FFT_VSUB(t3668, t3666);
+    t3670 = FFT_VSCL(t872, 0.8314696123025453);
+    t3671 = FFT_VMULNJ(t872);
+    t3672 = FFT_VSCL(t3671, 0.5555702330196022);
+    t3673 = FFT_VSUB(t3672, t3670);
+    t3674 = FFT_VSCL(t973, 0.9637760657954398);
+    t3675 = FFT_VMULNJ(t973);
+    t3676 = FFT_VSCL(t3675, 0.2667127574748985);
+    t3677 = FFT_VSUB(t3676, t3674);
+    t3678 = FFT_VSCL(t1074, 0.9987954562051724);
+    t3679 = FFT_VMULNJ(t1074);
+    t3680 = FFT_VSCL(t3679, 0.049067674327417966);
+    t3681 = FFT_VADD(t3678, t3680);
+    t3682 = FFT_VSCL(t1175, 0.9329927988347388);
+    t3683 = FFT_VMULNJ(t1175);
+    t3684 = FFT_VSCL(t3683, 0.35989503653498833);
+    t3685 = FFT_VADD(t3682, t3684);
+    t3686 = FFT_VSCL(t1276, 0.773010453362737);
+    t3687 = FFT_VMULNJ(t1276);
+    t3688 = FFT_VSCL(t3687, 0.6343932841636455);
+    t3689 = FFT_VADD(t3686, t3688);
+    t3690 = FFT_VSCL(t1377, 0.534997619887097);
+    t3691 = FFT_VMULNJ(t1377);
+    t3692 = FFT_VSCL(t3691, 0.8448535652497072);
+    t3693 = FFT_VADD(t3690, t3692);
+    t3694 = FFT_VSCL(t1478, 0.24298017990326387);
+    t3695 = FFT_VMULNJ(t1478);
+    t3696 = FFT_VSCL(t3695, 0.970031253194544);
+    t3697 = FFT_VADD(t3694, t3696);
+    t3698 = FFT_VSCL(t1579, 0.07356456359966745);
+    t3699 = FFT_VMULNJ(t1579);
+    t3700 = FFT_VSCL(t3699, 0.9972904566786902);
+    t3701 = FFT_VSUB(t3698, t3700);
+    t3702 = FFT_VADD(t3673, t64);
+    t3703 = FFT_VSUB(t64, t3673);
+    t3704 = FFT_VSUB(t3657, t3689);
+    t3705 = FFT_VADD(t3657, t3689);
+    t3706 = FFT_VADD(t3702, t3704);
+    t3707 = FFT_VSUB(t3702, t3704);
+    t3708 = FFT_VMULNJ(t3705);
+    t3709 = FFT_VADD(t3703, t3708);
+    t3710 = FFT_VSUB(t3703, t3708);
+    t3711 = FFT_VADD(t3645, t3677);
+    t3712 = FFT_VSUB(t3645, t3677);
+    t3713 = FFT_VSUB(t3661, t3693);
+    t3714 = FFT_VADD(t3661, t3693);
+    t3715 = FFT_VADD(t3711, t3713);
+    t3716 = FFT_VSUB(t3711, t3713);
+    t3717 = FFT_VMULNJ(t3714);
+    t3718 = FFT_VADD(t3712, t3717);
+    t3719 = FFT_VSUB(t3712, t3717);
+    t3720 = FFT_VSUB(t3649, t3681);
+    t3721 = FFT_VADD(t3649, t3681);
+    t3722 = FFT_VSUB(t3665, t3697);
+    t3723 = FFT_VADD(t3665, t3697);
+    t3724 = FFT_VADD(t3720, t3722);
+    t3725 = FFT_VSUB(t3720, t3722);
+    t3726 = FFT_VMULNJ(t3723);
+    t3727 = FFT_VADD(t3721, t3726);
+    t3728 = FFT_VSUB(t3721, t3726);
+    t3729 = FFT_VSUB(t3653, t3685);
+    t3730 = FFT_VADD(t3653, t3685);
+    t3731 = FFT_VADD(t3669, t3701);
+    t3732 = FFT_VSUB(t3669, t3701);
+    t3733 = FFT_VADD(t3729, t3731);
+    t3734 = FFT_VSUB(t3729, t3731);
+    t3735 = FFT_VMULNJ(t3732);
+    t3736 = FFT_VADD(t3730, t3735);
+    t3737 = FFT_VSUB(t3730, t3735);
+    t3738 = FFT_VADD(t3706, t3724);
+    t3739 = FFT_VSUB(t3706, t3724);
+    t3740 = FFT_VADD(t3715, t3733);
+    t3741 = FFT_VSUB(t3715, t3733);
+    t3742 = FFT_VADD(t3738, t3740);
+    t3743 = FFT_VSUB(t3738, t3740);
+    t3744 = FFT_VMULNJ(t3741);
+    t3745 = FFT_VADD(t3739, t3744);
+    t3746 = FFT_VSUB(t3739, t3744);
+    t3747 = FFT_VSCL(t3718, 0.9238795325112867);
+    t3748 = FFT_VMULNJ(t3718);
+    t3749 = FFT_VSCL(t3748, 0.3826834323650898);
+    t3750 = FFT_VADD(t3747, t3749);
+    t3751 = FFT_VMULNJ(t3727);
+    t3752 = FFT_VADD(t3727, t3751);
+    t3753 = FFT_VSCL(t3752, 0.7071067811865476);
+    t3754 = FFT_VSCL(t3736, 0.38268343236508984);
+    t3755 = FFT_VMULNJ(t3736);
+    t3756 = FFT_VSCL(t3755, 0.9238795325112867);
+    t3757 = FFT_VADD(t3754, t3756);
+    t3758 = FFT_VADD(t3709, t3753);
+    t3759 = FFT_VSUB(t3709, t3753);
+    t3760 = FFT_VADD(t3750, t3757);
+    t3761 = FFT_VSUB(t3750, t3757);
+    t3762 = FFT_VADD(t3758, t3760);
+    t3763 = FFT_VSUB(t3758, t3760);
+    t3764 = FFT_VMULNJ(t3761);
+    t3765 = FFT_VADD(t3759, t3764);
+    t3766 = FFT_VSUB(t3759, t3764);
+    t3767 = FFT_VMULNJ(t3716);
+    t3768 = FFT_VADD(t3716, t3767);
+    t3769 = FFT_VSCL(t3768, 0.7071067811865476);
+    t3770 = FFT_VMULNJ(t3725);
+    t3771 = FFT_VMULNJ(t3734);
+    t3772 = FFT_VSUB(t3734, t3771);
+    t3773 = FFT_VSCL(t3772, 0.7071067811865475);
+    t3774 = FFT_VADD(t3707, t3770);
+    t3775 = FFT_VSUB(t3707, t3770);
+    t3776 = FFT_VSUB(t3769, t3773);
+    t3777 = FFT_VADD(t3769, t3773);
+    t3778 = FFT_VADD(t3774, t3776);
+    t3779 = FFT_VSUB(t3774, t3776);
+    t3780 = FFT_VMULNJ(t3777);
+    t3781 = FFT_VADD(t3775, t3780);
+    t3782 = FFT_VSUB(t3775, t3780);
+    t3783 = FFT_VSCL(t3719, 0.38268343236508984);
+    t3784 = FFT_VMULNJ(t3719);
+    t3785 = FFT_VSCL(t3784, 0.9238795325112867);
+    t3786 = FFT_VADD(t3783, t3785);
+    t3787 = FFT_VMULNJ(t3728);
+    t3788 = FFT_VSUB(t3728, t3787);
+    t3789 = FFT_VSCL(t3788, 0.7071067811865475);
+    t3790 = FFT_VSCL(t3737, 0.9238795325112867);
+    t3791 = FFT_VMULNJ(t3737);
+    t3792 = FFT_VSCL(t3791, 0.3826834323650899);
+    t3793 = FFT_VADD(t3790, t3792);
+    t3794 = FFT_VSUB(t3710, t3789);
+    t3795 = FFT_VADD(t3710, t3789);
+    t3796 = FFT_VSUB(t3786, t3793);
+    t3797 = FFT_VADD(t3786, t3793);
+    t3798 = FFT_VADD(t3794, t3796);
+    t3799 = FFT_VSUB(t3794, t3796);
+    t3800 = FFT_VMULNJ(t3797);
+    t3801 = FFT_VADD(t3795, t3800);
+    t3802 = FFT_VSUB(t3795, t3800);
+    t3803 = FFT_VSCL(t181, 0.9415440651830208);
+    t3804 = FFT_VMULNJ(t181);
+    t3805 = FFT_VSCL(t3804, 0.33688985339222005);
+    t3806 = FFT_VADD(t3803, t3805);
+    t3807 = FFT_VSCL(t282, 0.773010453362737);
+    t3808 = FFT_VMULNJ(t282);
+    t3809 = FFT_VSCL(t3808, 0.6343932841636455);
+    t3810 = FFT_VADD(t3807, t3809);
+    t3811 = FFT_VSCL(t383, 0.5141027441932217);
+    t3812 = FFT_VMULNJ(t383);
+    t3813 = FFT_VSCL(t3812, 0.8577286100002721);
+    t3814 = FFT_VADD(t3811, t3813);
+    t3815 = FFT_VSCL(t484, 0.19509032201612833);
+    t3816 = FFT_VMULNJ(t484);
+    t3817 = FFT_VSCL(t3816, 0.9807852804032304);
+    t3818 = FFT_VADD(t3815, t3817);
+    t3819 = FFT_VSCL(t585, 0.14673047445536164);
+    t3820 = FFT_VMULNJ(t585);
+    t3821 = FFT_VSCL(t3820, 0.989176509964781);
+    t3822 = FFT_VSUB(t3821, t3819);
+    t3823 = FFT_VSCL(t686, 0.4713967368259977);
+    t3824 = FFT_VMULNJ(t686);
+    t3825 = FFT_VSCL(t3824, 0.881921264348355);
+    t3826 = FFT_VSUB(t3825, t3823);
+    t3827 = FFT_VSCL(t787, 0.7409511253549589);
+    t3828 = FFT_VMULNJ(t787);
+    t3829 = FFT_VSCL(t3828, 0.6715589548470186);
+    t3830 = FFT_VSUB(t3829, t3827);
+    t3831 = FFT_VSCL(t888, 0.9238795325112867);
+    t3832 = FFT_VMULNJ(t888);
+    t3833 = FFT_VSCL(t3832, 0.3826834323650899);
+    t3834 = FFT_VSUB(t3833, t3831);
+    t3835 = FFT_VSCL(t989, 0.9987954562051724);
+    t3836 = FFT_VMULNJ(t989);
+    t3837 = FFT_VSCL(t3836, 0.049067674327417966);
+    t3838 = FFT_VSUB(t3837, t3835);
+    t3839 = FFT_VSCL(t1090, 0.9569403357322088);
+    t3840 = FFT_VMULNJ(t1090);
+    t3841 = FFT_VSCL(t3840, 0.2902846772544624);
+    t3842 = FFT_VADD(t3839, t3841);
+    t3843 = FFT_VSCL(t1191, 0.8032075314806448);
+    t3844 = FFT_VMULNJ(t1191);
+    t3845 = FFT_VSCL(t3844, 0.5956993044924335);
+    t3846 = FFT_VADD(t3843, t3845);
+    t3847 = FFT_VSCL(t1292, 0.555570233019602);
+    t3848 = FFT_VMULNJ(t1292);
+    t3849 = FFT_VSCL(t3848, 0.8314696123025455);
+    t3850 = FFT_VADD(t3847, t3849);
+    t3851 = FFT_VSCL(t1393, 0.24298017990326387);
+    t3852 = FFT_VMULNJ(t1393);
+    t3853 = FFT_VSCL(t3852, 0.970031253194544);
+    t3854 = FFT_VADD(t3851, t3853);
+    t3855 = FFT_VSCL(t1494, 0.09801714032956077);
+    t3856 = FFT_VMULNJ(t1494);
+    t3857 = FFT_VSCL(t3856, 0.9951847266721968);
+    t3858 = FFT_VSUB(t3855, t3857);
+    t3859 = FFT_VSCL(t1595, 0.4275550934302822);
+    t3860 = FFT_VMULNJ(t1595);
+    t3861 = FFT_VSCL(t3860, 0.9039892931234433);
+    t3862 = FFT_VSUB(t3859, t3861);
+    t3863 = FFT_VADD(t3834, t80);
+    t3864 = FFT_VSUB(t80, t3834);
+    t3865 = FFT_VSUB(t3818, t3850);
+    t3866 = FFT_VADD(t3818, t3850);
+    t3867 = FFT_VADD(t3863, t3865);
+    t3868 = FFT_VSUB(t3863, t3865);
+    t3869 = FFT_VMULNJ(t3866);
+    t3870 = FFT_VADD(t3864, t3869);
+    t3871 = FFT_VSUB(t3864, t3869);
+    t3872 = FFT_VADD(t3806, t3838);
+    t3873 = FFT_VSUB(t3806, t3838);
+    t3874 = FFT_VSUB(t3822, t3854);
+    t3875 = FFT_VADD(t3822, t3854);
+    t3876 = FFT_VADD(t3872, t3874);
+    t3877 = FFT_VSUB(t3872, t3874);
+    t3878 = FFT_VMULNJ(t3875);
+    t3879 = FFT_VADD(t3873, t3878);
+    t3880 = FFT_VSUB(t3873, t3878);
+    t3881 = FFT_VSUB(t3810, t3842);
+    t3882 = FFT_VADD(t3810, t3842);
+    t3883 = FFT_VADD(t3826, t3858);
+    t3884 = FFT_VSUB(t3826, t3858);
+    t3885 = FFT_VADD(t3881, t3883);
+    t3886 = FFT_VSUB(t3881, t3883);
+    t3887 = FFT_VMULNJ(t3884);
+    t3888 = FFT_VADD(t3882, t3887);
+    t3889 = FFT_VSUB(t3882, t3887);
+    t3890 = FFT_VSUB(t3814, t3846);
+    t3891 = FFT_VADD(t3814, t3846);
+    t3892 = FFT_VADD(t3830, t3862);
+    t3893 = FFT_VSUB(t3830, t3862);
+    t3894 = FFT_VADD(t3890, t3892);
+    t3895 = FFT_VSUB(t3890, t3892);
+    t3896 = FFT_VMULNJ(t3893);
+    t3897 = FFT_VADD(t3891, t3896);
+    t3898 = FFT_VSUB(t3891, t3896);
+    t3899 = FFT_VADD(t3867, t3885);
+    t3900 = FFT_VSUB(t3867, t3885);
+    t3901 = FFT_VADD(t3876, t3894);
+    t3902 = FFT_VSUB(t3876, t3894);
+    t3903 = FFT_VADD(t3899, t3901);
+    t3904 = FFT_VSUB(t3899, t3901);
+    t3905 = FFT_VMULNJ(t3902);
+    t3906 = FFT_VADD(t3900, t3905);
+    t3907 = FFT_VSUB(t3900, t3905);
+    t3908 = FFT_VSCL(t3879, 0.9238795325112867);
+    t3909 = FFT_VMULNJ(t3879);
+    t3910 = FFT_VSCL(t3909, 0.3826834323650898);
+    t3911 = FFT_VADD(t3908, t3910);
+    t3912 = FFT_VMULNJ(t3888);
+    t3913 = FFT_VADD(t3888, t3912);
+    t3914 = FFT_VSCL(t3913, 0.7071067811865476);
+    t3915 = FFT_VSCL(t3897, 0.38268343236508984);
+    t3916 = FFT_VMULNJ(t3897);
+    t3917 = FFT_VSCL(t3916, 0.9238795325112867);
+    t3918 = FFT_VADD(t3915, t3917);
+    t3919 = FFT_VADD(t3870, t3914);
+    t3920 = FFT_VSUB(t3870, t3914);
+    t3921 = FFT_VADD(t3911, t3918);
+    t3922 = FFT_VSUB(t3911, t3918);
+    t3923 = FFT_VADD(t3919, t3921);
+    t3924 = FFT_VSUB(t3919, t3921);
+    t3925 = FFT_VMULNJ(t3922);
+    t3926 = FFT_VADD(t3920, t3925);
+    t3927 = FFT_VSUB(t3920, t3925);
+    t3928 = FFT_VMULNJ(t3877);
+    t3929 = FFT_VADD(t3877, t3928);
+    t3930 = FFT_VSCL(t3929, 0.7071067811865476);
+    t3931 = FFT_VMULNJ(t3886);
+    t3932 = FFT_VMULNJ(t3895);
+    t3933 = FFT_VSUB(t3895, t3932);
+    t3934 = FFT_VSCL(t3933, 0.7071067811865475);
+    t3935 = FFT_VADD(t3868, t3931);
+    t3936 = FFT_VSUB(t3868, t3931);
+    t3937 = FFT_VSUB(t3930, t3934);
+    t3938 = FFT_VADD(t3930, t3934);
+    t3939 = FFT_VADD(t3935, t3937);
+    t3940 = FFT_VSUB(t3935, t3937);
+    t3941 = FFT_VMULNJ(t3938);
+    t3942 = FFT_VADD(t3936, t3941);
+    t3943 = FFT_VSUB(t3936, t3941);
+    t3944 = FFT_VSCL(t3880, 0.38268343236508984);
+    t3945 = FFT_VMULNJ(t3880);
+    t3946 = FFT_VSCL(t3945, 0.9238795325112867);
+    t3947 = FFT_VADD(t3944, t3946);
+    t3948 = FFT_VMULNJ(t3889);
+    t3949 = FFT_VSUB(t3889, t3948);
+    t3950 = FFT_VSCL(t3949, 0.7071067811865475);
+    t3951 = FFT_VSCL(t3898, 0.9238795325112867);
+    t3952 = FFT_VMULNJ(t3898);
+    t3953 = FFT_VSCL(t3952, 0.3826834323650899);
+    t3954 = FFT_VADD(t3951, t3953);
+    t3955 = FFT_VSUB(t3871, t3950);
+    t3956 = FFT_VADD(t3871, t3950);
+    t3957 = FFT_VSUB(t3947, t3954);
+    t3958 = FFT_VADD(t3947, t3954);
+    t3959 = FFT_VADD(t3955, t3957);
+    t3960 = FFT_VSUB(t3955, t3957);
+    t3961 = FFT_VMULNJ(t3958);
+    t3962 = FFT_VADD(t3956, t3961);
+    t3963 = FFT_VSUB(t3956, t3961);
+    t3964 = FFT_VSCL(t201, 0.932992798834739);
+    t3965 = FFT_VMULNJ(t201);
+    t3966 = FFT_VSCL(t3965, 0.3598950365349881);
+    t3967 = FFT_VADD(t3964, t3966);
+    t3968 = FFT_VSCL(t302, 0.7409511253549591);
+    t3969 = FFT_VMULNJ(t302);
+    t3970 = FFT_VSCL(t3969, 0.6715589548470183);
+    t3971 = FFT_VADD(t3968, t3970);
+    t3972 = FFT_VSCL(t403, 0.4496113296546066);
+    t3973 = FFT_VMULNJ(t403);
+    t3974 = FFT_VSCL(t3973, 0.8932243011955153);
+    t3975 = FFT_VADD(t3972, t3974);
+    t3976 = FFT_VSCL(t504, 0.09801714032956077);
+    t3977 = FFT_VMULNJ(t504);
+    t3978 = FFT_VSCL(t3977, 0.9951847266721968);
+    t3979 = FFT_VADD(t3976, t3978);
+    t3980 = FFT_VSCL(t605, 0.2667127574748983);
+    t3981 = FFT_VMULNJ(t605);
+    t3982 = FFT_VSCL(t3981, 0.9637760657954398);
+    t3983 = FFT_VSUB(t3982, t3980);
+    t3984 = FFT_VSCL(t706, 0.5956993044924334);
+    t3985 = FFT_VMULNJ(t706);
+    t3986 = FFT_VSCL(t3985, 0.8032075314806449);
+    t3987 = FFT_VSUB(t3986, t3984);
+    t3988 = FFT_VSCL(t807, 0.8448535652497071);
+    t3989 = FFT_VMULNJ(t807);
+    t3990 = FFT_VSCL(t3989, 0.5349976198870972);
+    t3991 = FFT_VSUB(t3990, t3988);
+    t3992 = FFT_VSCL(t908, 0.9807852804032304);
+    t3993 = FFT_VMULNJ(t908);
+    t3994 = FFT_VSCL(t3993, 0.1950903220161286);
+    t3995 = FFT_VSUB(t3994, t3992);
+    t3996 = FFT_VSCL(t1009, 0.9852776423889412);
+    t3997 = FFT_VMULNJ(t1009);
+    t3998 = FFT_VSCL(t3997, 0.17096188876030122);
+    t3999 = FFT_VADD(t3996, t3998);
+    t4000 = FFT_VSCL(t1110, 0.857728610000272);
+    t4001 = FFT_VMULNJ(t1110);
+    t4002 = FFT_VSCL(t4001, 0.5141027441932218);
+    t4003 = FFT_VADD(t4000, t4002);
+    t4004 = FFT_VSCL(t1211, 0.6152315905806267);
+    t4005 = FFT_VMULNJ(t1211);
+    t4006 = FFT_VSCL(t4005, 0.7883464276266063);
+    t4007 = FFT_VADD(t4004, t4006);
+    t4008 = FFT_VSCL(t1312, 0.29028467725446216);
+    t4009 = FFT_VMULNJ(t1312);
+    t4010 = FFT_VSCL(t4009, 0.9569403357322089);
+    t4011 = FFT_VADD(t4008, t4010);
+    t4012 = FFT_VSCL(t1413, 0.07356456359966745);
+    t4013 = FFT_VMULNJ(t1413);
+    t4014 = FFT_VSCL(t4013, 0.9972904566786902);
+    t4015 = FFT_VSUB(t4012, t4014);
+    t4016 = FFT_VSCL(t1514, 0.4275550934302822);
+    t4017 = FFT_VMULNJ(t1514);
+    t4018 = FFT_VSCL(t4017, 0.9039892931234433);
+    t4019 = FFT_VSUB(t4016, t4018);
+    t4020 = FFT_VSCL(t1615, 0.724247082951467);
+    t4021 = FFT_VMULNJ(t1615);
+    t4022 = FFT_VSCL(t4021, 0.6895405447370668);
+    t4023 = FFT_VSUB(t4020, t4022);
+    t4024 = FFT_VADD(t100, t3995);
+    t4025 = FFT_VSUB(t100, t3995);
+    t4026 = FFT_VSUB(t3979, t4011);
+    t4027 = FFT_VADD(t3979, t4011);
+    t4028 = FFT_VADD(t4024, t4026);
+    t4029 = FFT_VSUB(t4024, t4026);
+    t4030 = FFT_VMULNJ(t4027);
+    t4031 = FFT_VADD(t4025, t4030);
+    t4032 = FFT_VSUB(t4025, t4030);
+    t4033 = FFT_VSUB(t3967, t3999);
+    t4034 = FFT_VADD(t3967, t3999);
+    t4035 = FFT_VADD(t3983, t4015);
+    t4036 = FFT_VSUB(t3983, t4015);
+    t4037 = FFT_VADD(t4033, t4035);
+    t4038 = FFT_VSUB(t4033, t4035);
+    t4039 = FFT_VMULNJ(t4036);
+    t4040 = FFT_VADD(t4034, t4039);
+    t4041 = FFT_VSUB(t4034, t4039);
+    t4042 = FFT_VSUB(t3971, t4003);
+    t4043 = FFT_VADD(t3971, t4003);
+    t4044 = FFT_VADD(t3987, t4019);
+    t4045 = FFT_VSUB(t3987, t4019);
+    t4046 = FFT_VADD(t4042, t4044);
+    t4047 = FFT_VSUB(t4042, t4044);
+    t4048 = FFT_VMULNJ(t4045);
+    t4049 = FFT_VADD(t4043, t4048);
+    t4050 = FFT_VSUB(t4043, t4048);
+    t4051 = FFT_VSUB(t3975, t4007);
+    t4052 = FFT_VADD(t3975, t4007);
+    t4053 = FFT_VADD(t3991, t4023);
+    t4054 = FFT_VSUB(t3991, t4023);
+    t4055 = FFT_VADD(t4051, t4053);
+    t4056 = FFT_VSUB(t4051, t4053);
+    t4057 = FFT_VMULNJ(t4054);
+    t4058 = FFT_VADD(t4052, t4057);
+    t4059 = FFT_VSUB(t4052, t4057);
+    t4060 = FFT_VADD(t4028, t4046);
+    t4061 = FFT_VSUB(t4028, t4046);
+    t4062 = FFT_VADD(t4037, t4055);
+    t4063 = FFT_VSUB(t4037, t4055);
+    t4064 = FFT_VADD(t4060, t4062);
+    t4065 = FFT_VSUB(t4060, t4062);
+    t4066 = FFT_VMULNJ(t4063);
+    t4067 = FFT_VADD(t4061, t4066);
+    t4068 = FFT_VSUB(t4061, t4066);
+    t4069 = FFT_VSCL(t4040, 0.9238795325112867);
+    t4070 = FFT_VMULNJ(t4040);
+    t4071 = FFT_VSCL(t4070, 0.3826834323650898);
+    t4072 = FFT_VADD(t4069, t4071);
+    t4073 = FFT_VMULNJ(t4049);
+    t4074 = FFT_VADD(t4049, t4073);
+    t4075 = FFT_VSCL(t4074, 0.7071067811865476);
+    t4076 = FFT_VSCL(t4058, 0.38268343236508984);
+    t4077 = FFT_VMULNJ(t4058);
+    t4078 = FFT_VSCL(t4077, 0.9238795325112867);
+    t4079 = FFT_VADD(t4076, t4078);
+    t4080 = FFT_VADD(t4031, t4075);
+    t4081 = FFT_VSUB(t4031, t4075);
+    t4082 = FFT_VADD(t4072, t4079);
+    t4083 = FFT_VSUB(t4072, t4079);
+    t4084 = FFT_VADD(t4080, t4082);
+    t4085 = FFT_VSUB(t4080, t4082);
+    t4086 = FFT_VMULNJ(t4083);
+    t4087 = FFT_VADD(t4081, t4086);
+    t4088 = FFT_VSUB(t4081, t4086);
+    t4089 = FFT_VMULNJ(t4038);
+    t4090 = FFT_VADD(t4038, t4089);
+    t4091 = FFT_VSCL(t4090, 0.7071067811865476);
+    t4092 = FFT_VMULNJ(t4047);
+    t4093 = FFT_VMULNJ(t4056);
+    t4094 = FFT_VSUB(t4056, t4093);
+    t4095 = FFT_VSCL(t4094, 0.7071067811865475);
+    t4096 = FFT_VADD(t4029, t4092);
+    t4097 = FFT_VSUB(t4029, t4092);
+    t4098 = FFT_VSUB(t4091, t4095);
+    t4099 = FFT_VADD(t4091, t4095);
+    t4100 = FFT_VADD(t4096, t4098);
+    t4101 = FFT_VSUB(t4096, t4098);
+    t4102 = FFT_VMULNJ(t4099);
+    t4103 = FFT_VADD(t4097, t4102);
+    t4104 = FFT_VSUB(t4097, t4102);
+    t4105 = FFT_VSCL(t4041, 0.38268343236508984);
+    t4106 = FFT_VMULNJ(t4041);
+    t4107 = FFT_VSCL(t4106, 0.9238795325112867);
+    t4108 = FFT_VADD(t4105, t4107);
+    t4109 = FFT_VMULNJ(t4050);
+    t4110 = FFT_VSUB(t4050, t4109);
+    t4111 = FFT_VSCL(t4110, 0.7071067811865475);
+    t4112 = FFT_VSCL(t4059, 0.9238795325112867);
+    t4113 = FFT_VMULNJ(t4059);
+    t4114 = FFT_VSCL(t4113, 0.3826834323650899);
+    t4115 = FFT_VADD(t4112, t4114);
+    t4116 = FFT_VSUB(t4032, t4111);
+    t4117 = FFT_VADD(t4032, t4111);
+    t4118 = FFT_VSUB(t4108, t4115);
+    t4119 = FFT_VADD(t4108, t4115);
+    t4120 = FFT_VADD(t4116, t4118);
+    t4121 = FFT_VSUB(t4116, t4118);
+    t4122 = FFT_VMULNJ(t4119);
+    t4123 = FFT_VADD(t4117, t4122);
+    t4124 = FFT_VSUB(t4117, t4122);
+    a[0] = t1656;
+    a[1] = t1817;
+    a[2] = t1978;
+    a[3] = t2139;
+    a[4] = t2299;
+    a[5] = t2460;
+    a[6] = t2621;
+    a[7] = t2782;
+    a[8] = t2938;
+    a[9] = t3099;
+    a[10] = t3260;
+    a[11] = t3421;
+    a[12] = t3581;
+    a[13] = t3742;
+    a[14] = t3903;
+    a[15] = t4064;
+    a[16] = t1676;
+    a[17] = t1837;
+    a[18] = t1998;
+    a[19] = t2159;
+    a[20] = t2319;
+    a[21] = t2480;
+    a[22] = t2641;
+    a[23] = t2802;
+    a[24] = t2958;
+    a[25] = t3119;
+    a[26] = t3280;
+    a[27] = t3441;
+    a[28] = t3601;
+    a[29] = t3762;
+    a[30] = t3923;
+    a[31] = t4084;
+    a[32] = t1692;
+    a[33] = t1853;
+    a[34] = t2014;
+    a[35] = t2175;
+    a[36] = t2335;
+    a[37] = t2496;
+    a[38] = t2657;
+    a[39] = t2818;
+    a[40] = t2974;
+    a[41] = t3135;
+    a[42] = t3296;
+    a[43] = t3457;
+    a[44] = t3617;
+    a[45] = t3778;
+    a[46] = t3939;
+    a[47] = t4100;
+    a[48] = t1712;
+    a[49] = t1873;
+    a[50] = t2034;
+    a[51] = t2195;
+    a[52] = t2355;
+    a[53] = t2516;
+    a[54] = t2677;
+    a[55] = t2838;
+    a[56] = t2994;
+    a[57] = t3155;
+    a[58] = t3316;
+    a[59] = t3477;
+    a[60] = t3637;
+    a[61] = t3798;
+    a[62] = t3959;
+    a[63] = t4120;
+    a[64] = t1659;
+    a[65] = t1820;
+    a[66] = t1981;
+    a[67] = t2142;
+    a[68] = t2302;
+    a[69] = t2463;
+    a[70] = t2624;
+    a[71] = t2785;
+    a[72] = t2941;
+    a[73] = t3102;
+    a[74] = t3263;
+    a[75] = t3424;
+    a[76] = t3584;
+    a[77] = t3745;
+    a[78] = t3906;
+    a[79] = t4067;
+    a[80] = t1679;
+    a[81] = t1840;
+    a[82] = t2001;
+    a[83] = t2162;
+    a[84] = t2322;
+    a[85] = t2483;
+    a[86] = t2644;
+    a[87] = t2805;
+    a[88] = t2961;
+    a[89] = t3122;
+    a[90] = t3283;
+    a[91] = t3444;
+    a[92] = t3604;
+    a[93] = t3765;
+    a[94] = t3926;
+    a[95] = t4087;
+    a[96] = t1695;
+    a[97] = t1856;
+    a[98] = t2017;
+    a[99] = t2178;
+    a[100] = t2338;
+    a[101] = t2499;
+    a[102] = t2660;
+    a[103] = t2821;
+    a[104] = t2977;
+    a[105] = t3138;
+    a[106] = t3299;
+    a[107] = t3460;
+    a[108] = t3620;
+    a[109] = t3781;
+    a[110] = t3942;
+    a[111] = t4103;
+    a[112] = t1715;
+    a[113] = t1876;
+    a[114] = t2037;
+    a[115] = t2198;
+    a[116] = t2358;
+    a[117] = t2519;
+    a[118] = t2680;
+    a[119] = t2841;
+    a[120] = t2997;
+    a[121] = t3158;
+    a[122] = t3319;
+    a[123] = t3480;
+    a[124] = t3640;
+    a[125] = t3801;
+    a[126] = t3962;
+    a[127] = t4123;
+    a[128] = t1657;
+    a[129] = t1818;
+    a[130] = t1979;
+    a[131] = t2140;
+    a[132] = t2300;
+    a[133] = t2461;
+    a[134] = t2622;
+    a[135] = t2783;
+    a[136] = t2939;
+    a[137] = t3100;
+    a[138] = t3261;
+    a[139] = t3422;
+    a[140] = t3582;
+    a[141] = t3743;
+    a[142] = t3904;
+    a[143] = t4065;
+    a[144] = t1677;
+    a[145] = t1838;
+    a[146] = t1999;
+    a[147] = t2160;
+    a[148] = t2320;
+    a[149] = t2481;
+    a[150] = t2642;
+    a[151] = t2803;
+    a[152] = t2959;
+    a[153] = t3120;
+    a[154] = t3281;
+    a[155] = t3442;
+    a[156] = t3602;
+    a[157] = t3763;
+    a[158] = t3924;
+    a[159] = t4085;
+    a[160] = t1693;
+    a[161] = t1854;
+    a[162] = t2015;
+    a[163] = t2176;
+    a[164] = t2336;
+    a[165] = t2497;
+    a[166] = t2658;
+    a[167] = t2819;
+    a[168] = t2975;
+    a[169] = t3136;
+    a[170] = t3297;
+    a[171] = t3458;
+    a[172] = t3618;
+    a[173] = t3779;
+    a[174] = t3940;
+    a[175] = t4101;
+    a[176] = t1713;
+    a[177] = t1874;
+    a[178] = t2035;
+    a[179] = t2196;
+    a[180] = t2356;
+    a[181] = t2517;
+    a[182] = t2678;
+    a[183] = t2839;
+    a[184] = t2995;
+    a[185] = t3156;
+    a[186] = t3317;
+    a[187] = t3478;
+    a[188] = t3638;
+    a[189] = t3799;
+    a[190] = t3960;
+    a[191] = t4121;
+    a[192] = t1660;
+    a[193] = t1821;
+    a[194] = t1982;
+    a[195] = t2143;
+    a[196] = t2303;
+    a[197] = t2464;
+    a[198] = t2625;
+    a[199] = t2786;
+    a[200] = t2942;
+    a[201] = t3103;
+    a[202] = t3264;
+    a[203] = t3425;
+    a[204] = t3585;
+    a[205] = t3746;
+    a[206] = t3907;
+    a[207] = t4068;
+    a[208] = t1680;
+    a[209] = t1841;
+    a[210] = t2002;
+    a[211] = t2163;
+    a[212] = t2323;
+    a[213] = t2484;
+    a[214] = t2645;
+    a[215] = t2806;
+    a[216] = t2962;
+    a[217] = t3123;
+    a[218] = t3284;
+    a[219] = t3445;
+    a[220] = t3605;
+    a[221] = t3766;
+    a[222] = t3927;
+    a[223] = t4088;
+    a[224] = t1696;
+    a[225] = t1857;
+    a[226] = t2018;
+    a[227] = t2179;
+    a[228] = t2339;
+    a[229] = t2500;
+    a[230] = t2661;
+    a[231] = t2822;
+    a[232] = t2978;
+    a[233] = t3139;
+    a[234] = t3300;
+    a[235] = t3461;
+    a[236] = t3621;
+    a[237] = t3782;
+    a[238] = t3943;
+    a[239] = t4104;
+    a[240] = t1716;
+    a[241] = t1877;
+    a[242] = t2038;
+    a[243] = t2199;
+    a[244] = t2359;
+    a[245] = t2520;
+    a[246] = t2681;
+    a[247] = t2842;
+    a[248] = t2998;
+    a[249] = t3159;
+    a[250] = t3320;
+    a[251] = t3481;
+    a[252] = t3641;
+    a[253] = t3802;
+    a[254] = t3963;
+    a[255] = t4124;
+}
+
+
+
+#endif /* FFT_SFX */
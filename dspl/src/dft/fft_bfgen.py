@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2015-2024 Sergey Bakhurin
+# Digital Signal Processing Library [http://dsplib.org]
+#
+# This file is part of libdspl-2.0.
+#
+# is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser    General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# DSPL is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+
+"""FFT butterflies code generator.
+
+The script generates fft_bfgen.h: straight-line R-points DFT butterflies
+FFT_SFX(fft_bfR)(FFT_V* a) written by the vector macros of fft_simd_krn.h,
+so one generated butterfly is compiled for all instruction sets and for
+the single and double precision. The butterflies are used by the vector
+codelets (fft_simd.c, fftf_simd.c) and by the scalar codelets
+(fft_codelet.c).
+
+Prime radix is calculated by the symmetric pairs algorithm
+(the same as the 5 and 7 points butterflies of fft_simd_krn.h).
+Composite radix R = r1 * r2 is calculated by the prime factor algorithm
+without twiddle factors if r1 and r2 are coprime, else by the
+Cooley-Tukey algorithm with the constant twiddle factors.
+Sub-DFTs are expanded in place, equal subexpressions are calculated once.
+
+Usage:
+    python3 fft_bfgen.py [-o fft_bfgen.h] [R1 R2 ...]
+
+Radixes 2, 3, 4, 5, 7, 8 and 16 have the hand-written butterflies
+in fft_simd_krn.h and they cannot be generated.
+
+The order of the radix list is the planner priority: FFT_BFGEN_PLAN
+lists the generated radixes up to PLAN_MAX in the command line order,
+and the heuristic of fft_plan_build and fftf_create tries them after
+the radix 16 and before the radix 7, 8, 5, 4, 3 and 2 stages.
+So a regenerated radix is used by the plans without the planner
+changes. Larger radixes (256 by default) are listed by FFT_BFGEN_LIST
+only: they are selected by the FFT wisdom (see fft_wisdom_measure.c).
+"""
+
+import math
+import sys
+
+
+DEFAULT_RADIX = [13, 11, 10, 12, 9, 25, 49, 15, 6, 256]
+HAND_RADIX = [2, 3, 4, 5, 7, 8, 16]
+PLAN_MAX = 64
+EPS = 1E-15
+
+
+def cs(k, n):
+    """cos and sin of the angle 2*pi*k/n reduced to the first half-turn,
+    so the equal constants are calculated equally"""
+    k %= n
+    neg = 2 * k > n
+    if neg:
+        k = n - k
+    c = math.cos(2.0 * math.pi * k / n)
+    s = math.sin(2.0 * math.pi * k / n)
+    return c, -s if neg else s
+
+
+class Gen:
+    """Straight-line code of one butterfly.
+    Value is the pair (name, neg): the vector name and the sign flag."""
+
+    def __init__(self):
+        self.code = []
+        self.memo = {}
+        self.nt = 0
+
+    def op(self, expr):
+        if expr in self.memo:
+            return self.memo[expr]
+        name = 't%d' % self.nt
+        self.nt += 1
+        self.code.append('%s = %s;' % (name, expr))
+        self.memo[expr] = name
+        return name
+
+    def add(self, a, b):
+        (na, sa), (nb, sb) = a, b
+        if not sa and not sb:
+            return (self.op('FFT_VADD(%s, %s)' % tuple(sorted((na, nb)))), 0)
+        if not sa and sb:
+            return (self.op('FFT_VSUB(%s, %s)' % (na, nb)), 0)
+        if sa and not sb:
+            return (self.op('FFT_VSUB(%s, %s)' % (nb, na)), 0)
+        return (self.op('FFT_VADD(%s, %s)' % tuple(sorted((na, nb)))), 1)
+
+    def neg(self, a):
+        return (a[0], 1 - a[1])
+
+    def sub(self, a, b):
+        return self.add(a, self.neg(b))
+
+    def scl(self, a, c):
+        if abs(c) < EPS:
+            return None
+        s = a[1]
+        if c < 0:
+            s, c = 1 - s, -c
+        if abs(c - 1.0) < EPS:
+            return (a[0], s)
+        return (self.op('FFT_VSCL(%s, %s)' % (a[0], repr(c))), s)
+
+    def mulnj(self, a):
+        return (self.op('FFT_VMULNJ(%s)' % a[0]), a[1])
+
+    def sum(self, vals):
+        vals = [v for v in vals if v is not None]
+        acc = vals[0]
+        for v in vals[1:]:
+            acc = self.add(acc, v)
+        return acc
+
+    def rot(self, a, k, n):
+        """a * exp(-j*2*pi*k/n) = c*a + s*(-j*a)"""
+        if k % n == 0:
+            return a
+        c, s = cs(k, n)
+        if abs(s) < EPS:
+            return self.scl(a, c)
+        if abs(c) < EPS:
+            return self.scl(self.mulnj(a), s)
+        if abs(abs(c) - abs(s)) < EPS:
+            b = self.mulnj(a)
+            t = self.add(a, b) if c * s > 0 else self.sub(a, b)
+            return self.scl(t, c)
+        return self.add(self.scl(a, c), self.scl(self.mulnj(a), s))
+
+
+def split(n):
+    """Factors r1 * r2 = n: coprime if possible, else the balanced one"""
+    fac = [(r, n // r) for r in range(2, int(math.isqrt(n)) + 1) if n % r == 0]
+    if not fac:
+        return None
+    cop = [f for f in fac if math.gcd(f[0], f[1]) == 1]
+    return cop[-1] if cop else fac[-1]
+
+
+def dft(g, x):
+    """DFT of the values x, returns the list of the output values"""
+    n = len(x)
+    if n == 1:
+        return list(x)
+    if n == 2:
+        return [g.add(x[0], x[1]), g.sub(x[0], x[1])]
+    f = split(n)
+    if f is None:
+        return dft_prime(g, x)
+    r1, r2 = f
+    if math.gcd(r1, r2) == 1:
+        return dft_pfa(g, x, r1, r2)
+    return dft_ct(g, x, r1, r2)
+
+
+def dft_prime(g, x):
+    p = len(x)
+    h = (p - 1) // 2
+    s = [None] + [g.add(x[k], x[p - k]) for k in range(1, h + 1)]
+    d = [None] + [g.mulnj(g.sub(x[k], x[p - k])) for k in range(1, h + 1)]
+    y = [None] * p
+    y[0] = g.sum([x[0]] + s[1:])
+    for m in range(1, h + 1):
+        t = g.sum([x[0]] + [g.scl(s[k], cs(k*m, p)[0])
+                            for k in range(1, h + 1)])
+        u = g.sum([g.scl(d[k], cs(k*m, p)[1]) for k in range(1, h + 1)])
+        y[m] = g.add(t, u)
+        y[p - m] = g.sub(t, u)
+    return y
+
+
+def dft_pfa(g, x, r1, r2):
+    """Prime factor algorithm: x(n1*r2 + n2*r1), y(k): k = k1 mod r1,
+    k = k2 mod r2"""
+    n = r1 * r2
+    c = [dft(g, [x[(n1*r2 + n2*r1) % n] for n1 in range(r1)])
+         for n2 in range(r2)]
+    y = [None] * n
+    for k1 in range(r1):
+        row = dft(g, [c[n2][k1] for n2 in range(r2)])
+        for k2 in range(r2):
+            k = next(k for k in range(k1, n, r1) if k % r2 == k2)
+            y[k] = row[k2]
+    return y
+
+
+def dft_ct(g, x, r1, r2):
+    """Cooley-Tukey algorithm: r2 DFTs of r1 points x(i + r2*m),
+    twiddle factors W_n^(i*k1) and r1 DFTs of r2 points"""
+    n = r1 * r2
+    c = [dft(g, [x[i + r2*m] for m in range(r1)]) for i in range(r2)]
+    y = [None] * n
+    for k1 in range(r1):
+        row = dft(g, [g.rot(c[i][k1], i*k1, n) for i in range(r2)])
+        for k2 in range(r2):
+            y[k1 + r1*k2] = row[k2]
+    return y
+
+
+def butterfly(n):
+    g = Gen()
+    y = dft(g, [('a[%d]' % k, 0) for k in range(n)])
+    out = []
+    for k, (name, neg) in enumerate(y):
+        out.append('a[%d] = %s;' % (k, 'FFT_VSCL(%s, -1.0)' % name
+                                        if neg else name))
+    names = ['t%d' % k for k in range(g.nt)]
+    decl = ['    FFT_V %s;' % ', '.join(names[k:k+10])
+            for k in range(0, len(names), 10)]
+    src = ['/* %d points DFT */' % n,
+           'static inline FFT_TARGET void FFT_SFX(fft_bf%d)(FFT_V* a)' % n,
+           '{']
+    src += decl + ['']
+    src += ['    ' + s for s in g.code + out]
+    src += ['}', '', '', '']
+    return src, g.nt
+
+
+def main(argv):
+    out = None
+    args = argv[1:]
+    if len(args) > 1 and args[0] == '-o':
+        out, args = args[1], args[2:]
+    radix = [int(a) for a in args] if args else DEFAULT_RADIX
+    for r in radix:
+        if r < 2 or r in HAND_RADIX:
+            sys.exit('radix %d cannot be generated' % r)
+    order = []
+    for r in radix:
+        if r not in order:
+            order.append(r)
+    plan = [r for r in order if r <= PLAN_MAX]
+    radix = sorted(order)
+
+    src = ['/*',
+           '* Copyright (c) 2015-2024 Sergey Bakhurin',
+           '* Digital Signal Processing Library [http://dsplib.org]',
+           '*',
+           '* This file is part of libdspl-2.0.',
+           '*',
+           '* is free software: you can redistribute it and/or modify',
+           '* it under the terms of the GNU Lesser    General Public '
+           'License as published by',
+           '* the Free Software Foundation, either version 3 of the '
+           'License, or',
+           '* (at your option) any later version.',
+           '*',
+           '* DSPL is distributed in the hope that it will be useful,',
+           '* but WITHOUT ANY WARRANTY; without even the implied '
+           'warranty of',
+           '* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    '
+           'See the',
+           '* GNU General Public License for more details.',
+           '*',
+           '* You should have received a copy of the GNU Lesser General '
+           'Public License',
+           '* along with Foobar.    If not, see '
+           '<http://www.gnu.org/licenses/>.',
+           '*/',
+           '',
+           '/*' + '*' * 78,
+           'Generated FFT butterflies. DO NOT EDIT, the file is generated by',
+           '    python3 fft_bfgen.py -o fft_bfgen.h %s'
+           % ' '.join(str(r) for r in order),
+           '',
+           'FFT_BFGEN_LIST(X) calls X(R) for each generated radix R.',
+           'FFT_BFGEN_PLAN(X) calls X(R) for the radixes tried by the FFT '
+           'planner',
+           'heuristic in the priority order.',
+           'If FFT_SFX is defined (see fft_simd_krn.h) then the file also',
+           'defines the butterflies FFT_SFX(fft_bfR)(FFT_V* a).',
+           '*' * 79 + '/',
+           '',
+           '#ifndef FFT_BFGEN_LIST',
+           '#define FFT_BFGEN_LIST(X)  %s'
+           % ' '.join('X(%d)' % r for r in radix),
+           '#endif',
+           '',
+           '#ifndef FFT_BFGEN_PLAN',
+           '#define FFT_BFGEN_PLAN(X)  %s'
+           % ' '.join('X(%d)' % r for r in plan),
+           '#endif',
+           '',
+           '',
+           '',
+           '#ifdef FFT_SFX',
+           '',
+           '']
+    for r in radix:
+        s, nt = butterfly(r)
+        src += s
+    src += ['#endif /* FFT_SFX */']
+    text = '\n'.join(src) + '\n'
+    if out:
+        with open(out, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -0,0 +1,184 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Bind `fft_t` object to the shared FFT plan.
+
+The function binds the `fft_t` object to the FFT plan `plan`
+created by the \ref fft_plan_create function 
+and allocates the workspace of the object. \n
+The plan is not copied and it is not changed by the FFT functions.
+So several `fft_t` objects (for example one object per worker thread)
+can calculate the FFT of the same size with one plan 
+without locking and without duplicated twiddle factors tables. \n
+Own plan of the object created by the \ref fft_create function
+is cleared.
+
+\param[in,out]  pfft
+Pointer to the `fft_t` object.  \n
+Pointer cannot be `NULL`.  \n \n
+
+\param[in]  plan
+Pointer to the FFT plan filled by the \ref fft_plan_create function. \n
+Pointer cannot be `NULL`.  \n 
+The plan must not be cleared before the `fft_t` object
+is cleared by the \ref fft_free function. \n \n
+
+\return
+`RES_OK` if the object is bound successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include fft_bind_test.c
+
+\author Sergey Bakhurin www.dsplib.org 
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Подключение объекта `fft_t` к совместно используемому плану БПФ
+
+Функция подключает объект `fft_t` к плану БПФ `plan`,
+созданному функцией \ref fft_plan_create, и выделяет 
+рабочую память объекта. \n
+План не копируется и не изменяется функциями БПФ.
+Поэтому несколько объектов `fft_t` (например по одному объекту 
+на каждый рабочий поток) могут рассчитывать БПФ одного размера
+при помощи одного плана без блокировок и без дублирования 
+таблиц поворотных коэффициентов. \n
+Собственный план объекта, созданный функцией \ref fft_create,
+очищается.
+
+\param[in,out]  pfft
+Указатель на структуру `fft_t`.  \n
+Указатель не должен быть `NULL`.  \n \n
+
+\param[in]  plan
+Указатель на план БПФ, заполненный функцией \ref fft_plan_create. \n
+Указатель не должен быть `NULL`.  \n 
+План не должен очищаться до очистки объекта `fft_t`
+функцией \ref fft_free. \n \n
+
+\return
+`RES_OK` если объект подключен успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции:
+
+\include fft_bind_test.c
+
+\author Бахурин Сергей www.dsplib.org 
+***************************************************************************** */
+#endif
+int DSPL_API fft_bind(fft_t* pfft, fft_plan_t* plan)
+{
+    int n;
+
+    if(!pfft || !plan)
+        return ERROR_PTR;
+    n = plan->n;
+    if(n < 1)
+        return ERROR_FFT_SIZE;
+
+    if(pfft->own && pfft->plan && pfft->plan != plan)
+    {
+        if(pfft->own == FFT_OWN_CACHE)
+            fft_cache_release(pfft->plan);
+        else
+        {
+            fft_plan_free(pfft->plan);
+            free(pfft->plan);
+        }
+    }
+    pfft->plan = plan;
+    pfft->own = 0;
+
+    pfft->n = 0;
+    if(fft_workspace(pfft, n) != RES_OK)
+        return ERROR_MALLOC;
+    pfft->n = n;
+
+    return fft_workspace_tb(pfft);
+}
+
+
+
+
+int fft_workspace(fft_t* pfft, int nt)
+{
+    if(pfft->nt >= nt)
+        return RES_OK;
+
+    pfft->t0 = pfft->t0 ? 
+               (complex_t*) realloc(pfft->t0, nt*sizeof(complex_t)):
+               (complex_t*) malloc(           nt*sizeof(complex_t));
+
+    pfft->t1 = pfft->t1 ? 
+               (complex_t*) realloc(pfft->t1, nt*sizeof(complex_t)):
+               (complex_t*) malloc(           nt*sizeof(complex_t));
+    pfft->nt = pfft->t0 && pfft->t1 ? nt : 0;
+    return pfft->nt ? RES_OK : ERROR_MALLOC;
+}
+
+
+
+
+int fft_workspace_tb(fft_t* pfft)
+{
+    int nb = pfft->plan ? pfft->plan->nb : 0;
+    int nth = pfft->nthreads > 1 ? pfft->nthreads : 1;
+
+    /* the workspace is shared by the half size plan of the real FFT */
+    if(pfft->half && pfft->half->nb > nb)
+        nb = pfft->half->nb;
+
+    /* Bluestein algorithm workspace of each thread */
+    if(nb)
+    {
+        pfft->tb = pfft->tb ? 
+                (complex_t*) realloc(pfft->tb, 2*(size_t)nb*nth*sizeof(complex_t)):
+                (complex_t*) malloc(           2*(size_t)nb*nth*sizeof(complex_t));
+        if(!pfft->tb)
+            return ERROR_MALLOC;
+    }
+    else if(pfft->tb)
+    {
+        free(pfft->tb);
+        pfft->tb = NULL;
+    }
+    return RES_OK;
+}
@@ -0,0 +1,78 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+
+#endif
+#ifdef DOXYGEN_RUSSIAN
+
+#endif
+void fft_bluestein(complex_t* t0, complex_t* t1, fft_plan_t* p, 
+                   fft_stage_t* s, complex_t* tb, fft_pool_t* pool)
+{
+    int n, nb, k;
+    complex_t *pc = p->w + s->addr;
+    complex_t *pb = pc + s->n1;
+    complex_t *a, *b;
+
+    n  = s->n1;
+    nb = p->nb;
+    a = tb;
+    b = tb + nb;
+
+    /* a(k) = x(k) * c(k), c(k) = exp(-j*pi*k^2/n) */
+    for(k = 0; k < n; k++)
+    {
+        RE(a[k]) = CMRE(t0[k], pc[k]);
+        IM(a[k]) = CMIM(t0[k], pc[k]);
+    }
+    memset(a+n, 0, (nb-n)*sizeof(complex_t));
+
+    /* nb-points FFT schedule follows the Bluestein stage */
+    fft_run_mt(a, b, p, s + 1, NULL, 1, pool);
+
+    /* inverse FFT of A(k)*B(k) as conj(FFT(conj(A(k)*B(k)))) */
+    for(k = 0; k < nb; k++)
+    {
+        RE(a[k]) =  CMRE(b[k], pb[k]);
+        IM(a[k]) = -CMIM(b[k], pb[k]);
+    }
+
+    fft_run_mt(a, b, p, s + 1, NULL, 1, pool);
+
+    /* y(k) = conj(b(k)) * c(k) */
+    for(k = 0; k < n; k++)
+    {
+        RE(t1[k]) = CMCONJRE(pc[k], b[k]);
+        IM(t1[k]) = CMCONJIM(pc[k], b[k]);
+    }
+}
@@ -0,0 +1,254 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+/* Plan cache entry */
+typedef struct
+{
+    fft_plan_t* plan;
+    int         ref;    /* number of fft_t objects using the plan   */
+    long long   tick;   /* last release time for the LRU eviction   */
+    int         stale;  /* plan is cleared after the last release   */
+} fft_cache_entry_t;
+
+
+/* Process-wide plan cache */
+static pthread_mutex_t    fft_cache_mtx  = PTHREAD_MUTEX_INITIALIZER;
+static fft_cache_entry_t* fft_cache_tab  = NULL;
+static int                fft_cache_cnt  = 0;
+static int                fft_cache_cap  = 0;
+static int                fft_cache_max  = FFT_CACHE_SIZE;
+static long long          fft_cache_tick = 0;
+static long long          fft_cache_hit  = 0;
+static long long          fft_cache_miss = 0;
+
+
+
+
+/*******************************************************************************
+Unused plans eviction (least recently used first) while the number of
+cached plans exceeds fft_cache_max. The mutex must be locked.
+*******************************************************************************/
+static void fft_cache_trim(void)
+{
+    int k, lru;
+    while(fft_cache_cnt > fft_cache_max)
+    {
+        lru = -1;
+        for(k = 0; k < fft_cache_cnt; k++)
+            if(!fft_cache_tab[k].ref && 
+              (lru < 0 || fft_cache_tab[k].tick < fft_cache_tab[lru].tick))
+                lru = k;
+        if(lru < 0)
+            return;
+        fft_plan_free(fft_cache_tab[lru].plan);
+        free(fft_cache_tab[lru].plan);
+        fft_cache_tab[lru] = fft_cache_tab[--fft_cache_cnt];
+    }
+}
+
+
+
+
+/* Cached plan of the n-points FFT and the current instruction set */
+static fft_plan_t* fft_cache_find(int n, int isa)
+{
+    int k;
+    for(k = 0; k < fft_cache_cnt; k++)
+    {
+        if(fft_cache_tab[k].plan->n == n && fft_cache_tab[k].plan->isa == isa &&
+          !fft_cache_tab[k].stale)
+        {
+            fft_cache_tab[k].ref++;
+            return fft_cache_tab[k].plan;
+        }
+    }
+    return NULL;
+}
+
+
+
+
+int fft_cache_get(int n, fft_plan_t** pplan)
+{
+    fft_plan_t *plan, *p;
+    fft_cache_entry_t* tab;
+    int isa, err;
+
+    *pplan = NULL;
+    isa = fft_get_isa();
+
+    pthread_mutex_lock(&fft_cache_mtx);
+    if(fft_cache_max < 1)
+    {
+        pthread_mutex_unlock(&fft_cache_mtx);
+        return RES_OK;
+    }
+    plan = fft_cache_find(n, isa);
+    if(plan)
+        fft_cache_hit++;
+    else
+        fft_cache_miss++;
+    pthread_mutex_unlock(&fft_cache_mtx);
+    if(plan)
+    {
+        *pplan = plan;
+        return RES_OK;
+    }
+
+    /* new plan is created out of the lock */
+    plan = (fft_plan_t*) malloc(sizeof(fft_plan_t));
+    if(!plan)
+        return ERROR_MALLOC;
+    memset(plan, 0, sizeof(fft_plan_t));
+    err = fft_plan_create(plan, n);
+    if(err != RES_OK)
+    {
+        free(plan);
+        return err;
+    }
+
+    pthread_mutex_lock(&fft_cache_mtx);
+    /* the same plan can be created by other thread */
+    p = fft_cache_find(n, plan->isa);
+    if(!p)
+    {
+        if(fft_cache_cnt == fft_cache_cap)
+        {
+            tab = (fft_cache_entry_t*) realloc(fft_cache_tab, 
+                      (2*fft_cache_cap + 4)*sizeof(fft_cache_entry_t));
+            if(!tab)
+            {
+                pthread_mutex_unlock(&fft_cache_mtx);
+                fft_plan_free(plan);
+                free(plan);
+                return ERROR_MALLOC;
+            }
+            fft_cache_tab = tab;
+            fft_cache_cap = 2*fft_cache_cap + 4;
+        }
+        fft_cache_tab[fft_cache_cnt].plan = plan;
+        fft_cache_tab[fft_cache_cnt].ref  = 1;
+        fft_cache_tab[fft_cache_cnt].tick = ++fft_cache_tick;
+        fft_cache_tab[fft_cache_cnt].stale = 0;
+        fft_cache_cnt++;
+        fft_cache_trim();
+    }
+    pthread_mutex_unlock(&fft_cache_mtx);
+
+    if(p)
+    {
+        fft_plan_free(plan);
+        free(plan);
+        plan = p;
+    }
+    *pplan = plan;
+    return RES_OK;
+}
+
+
+
+
+void fft_cache_release(fft_plan_t* plan)
+{
+    int k;
+    pthread_mutex_lock(&fft_cache_mtx);
+    for(k = 0; k < fft_cache_cnt; k++)
+    {
+        if(fft_cache_tab[k].plan == plan)
+        {
+            if(fft_cache_tab[k].ref > 0)
+                fft_cache_tab[k].ref--;
+            fft_cache_tab[k].tick = ++fft_cache_tick;
+            if(fft_cache_tab[k].stale && !fft_cache_tab[k].ref)
+            {
+                fft_plan_free(fft_cache_tab[k].plan);
+                free(fft_cache_tab[k].plan);
+                fft_cache_tab[k] = fft_cache_tab[--fft_cache_cnt];
+            }
+            break;
+        }
+    }
+    fft_cache_trim();
+    pthread_mutex_unlock(&fft_cache_mtx);
+}
+
+
+
+
+void fft_cache_resize(int nplans)
+{
+    pthread_mutex_lock(&fft_cache_mtx);
+    fft_cache_max = nplans;
+    fft_cache_trim();
+    if(!fft_cache_cnt && fft_cache_tab)
+    {
+        free(fft_cache_tab);
+        fft_cache_tab = NULL;
+        fft_cache_cap = 0;
+    }
+    pthread_mutex_unlock(&fft_cache_mtx);
+}
+
+
+
+
+void fft_cache_flush(void)
+{
+    int k;
+
+    pthread_mutex_lock(&fft_cache_mtx);
+    k = 0;
+    while(k < fft_cache_cnt)
+    {
+        if(fft_cache_tab[k].ref)
+        {
+            fft_cache_tab[k++].stale = 1;
+            continue;
+        }
+        fft_plan_free(fft_cache_tab[k].plan);
+        free(fft_cache_tab[k].plan);
+        fft_cache_tab[k] = fft_cache_tab[--fft_cache_cnt];
+    }
+    pthread_mutex_unlock(&fft_cache_mtx);
+}
+
+
+
+
+void fft_cache_counters(long long* hits, long long* misses, int* nplans)
+{
+    pthread_mutex_lock(&fft_cache_mtx);
+    if(hits)
+        *hits = fft_cache_hit;
+    if(misses)
+        *misses = fft_cache_miss;
+    if(nplans)
+        *nplans = fft_cache_cnt;
+    pthread_mutex_unlock(&fft_cache_mtx);
+}
@@ -0,0 +1,100 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Set the size of the process-wide FFT plan cache.
+
+Functions \ref fft_create, \ref fft_cmplx, \ref fft and other FFT functions
+take the FFT plans from the process-wide plan cache keyed by the FFT size
+and the codelets instruction set (see \ref fft_set_isa).
+The plan of the new size is calculated once and then it is shared
+by all `fft_t` objects of the process. Thus the object which alternates
+the FFT sizes (e.g. \ref conv_fft_cmplx or \ref xcorr functions)
+does not recalculate the twiddle factors. \n
+The cache is thread-safe. The plans are reference counted:
+the plan is used by the `fft_t` objects until \ref fft_free call
+or the FFT size change. If the number of cached plans exceeds `nplans`,
+then the least recently used plans which are not used
+by any object are cleared. \n
+The default cache size is 32 plans.
+
+\param[in]  nplans
+Maximal number of the cached plans. \n
+`nplans = 0` disables the cache: each `fft_t` object creates own plan
+and the cached plans are cleared. \n \n
+
+\return
+`RES_OK` if the cache size is set successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Задание размера общего кэша планов БПФ
+
+Функции \ref fft_create, \ref fft_cmplx, \ref fft и другие функции БПФ
+получают планы БПФ из общего для процесса кэша планов по ключу
+размера БПФ и набора инструкций ядер (см. \ref fft_set_isa).
+План нового размера рассчитывается один раз и затем используется
+совместно всеми объектами `fft_t` процесса. Таким образом объект,
+чередующий размеры БПФ (например в функциях \ref conv_fft_cmplx
+или \ref xcorr), не пересчитывает поворотные коэффициенты. \n
+Кэш является потокобезопасным. Планы имеют счетчик ссылок:
+план используется объектами `fft_t` до вызова \ref fft_free
+или изменения размера БПФ. Если количество планов кэша превышает
+`nplans`, то очищаются давно не использованные планы,
+не используемые ни одним объектом. \n
+Размер кэша по умолчанию 32 плана.
+
+\param[in]  nplans
+Максимальное количество планов кэша. \n
+`nplans = 0` отключает кэш: каждый объект `fft_t` создает собственный
+план, а планы кэша очищаются. \n \n
+
+\return
+`RES_OK` если размер кэша задан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_cache_set_size(int nplans)
+{
+    if(nplans < 0)
+        return ERROR_NEGATIVE;
+    fft_cache_resize(nplans);
+    return RES_OK;
+}
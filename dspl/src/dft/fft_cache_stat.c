@@ -0,0 +1,108 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Process-wide FFT plan cache statistics.
+
+The function returns the plan cache hit and miss counters since the
+process start and the current number of cached plans
+(see \ref fft_cache_set_size). \n
+Any of the pointers can be `NULL`.
+
+\param[out]  hits
+Pointer to the number of plan requests served by the cache. \n \n
+
+\param[out]  misses
+Pointer to the number of plan requests which required
+the plan calculation. \n \n
+
+\param[out]  nplans
+Pointer to the number of cached plans. \n \n
+
+\return
+`RES_OK`.
+
+Example:
+\code{.cpp}
+long long hits, misses;
+int nplans;
+
+fft_cache_stat(&hits, &misses, &nplans);
+printf("plan cache: %lld hits, %lld misses, %d plans\n", 
+       hits, misses, nplans);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Статистика общего кэша планов БПФ
+
+Функция возвращает счетчики попаданий и промахов кэша планов
+с момента запуска процесса и текущее количество планов кэша
+(см. \ref fft_cache_set_size). \n
+Любой из указателей может быть `NULL`.
+
+\param[out]  hits
+Указатель на количество запросов плана, обслуженных кэшем. \n \n
+
+\param[out]  misses
+Указатель на количество запросов плана, потребовавших
+расчета плана. \n \n
+
+\param[out]  nplans
+Указатель на количество планов кэша. \n \n
+
+\return
+`RES_OK`.
+
+Пример:
+\code{.cpp}
+long long hits, misses;
+int nplans;
+
+fft_cache_stat(&hits, &misses, &nplans);
+printf("кэш планов: %lld попаданий, %lld промахов, %d планов\n", 
+       hits, misses, nplans);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_cache_stat(long long* hits, long long* misses, int* nplans)
+{
+    fft_cache_counters(hits, misses, nplans);
+    return RES_OK;
+}
@@ -49,7 +49,7 @@ FFT size \f$n\f$. \n
 FFT size can be composite: 
 \f$n = n_0 \times n_1 \times n_2 \times \ldots \times n_p \times m\f$,
 here \f$n_i = 2,3,5,7\f$, а \f$m \f$ -- 
-simple number less than 46340
+arbitrary factor
 (see \ref fft_create function). \n \n
 
 \param[in]  pfft
@@ -63,7 +63,10 @@ cleared before exiting by the \ref fft_free function. \n \n
 Pointer to the FFT result complex vector \f$Y(k)\f$, 
 \f$ k = 0 \ldots n-1 \f$. \n
 Vector size is `[n x 1]`. \n
-Memory must be allocated. \n \n
+Memory must be allocated. \n
+The output vector can be the same as the input vector `x`
+(in-place FFT). The input vector is not copied to the 
+`fft_t` workspace if the FFT is calculated by the vector codelets. \n \n
 
 \return
 `RES_OK` if FFT is calculated successfully. \n
@@ -124,7 +127,7 @@ y[17] =    -0.300    0.588
 \f$ n = n_0 \times n_1 \times n_2 \times n_3 \times \ldots 
 \times n_p \times m \f$,
 где \f$n_i = 2,3,5,7\f$, а \f$m \f$ -- 
-произвольный простой множитель не превосходящий 46340
+произвольный множитель
 (см. описание функции \ref fft_create). \n \n
 
 \param[in]  pfft
@@ -139,7 +142,10 @@ y[17] =    -0.300    0.588
 результата БПФ \f$Y(k)\f$, 
 \f$ k = 0 \ldots n-1 \f$. 
 Размер вектора `[n x 1]`.  \n
-Память должна быть выделена. \n \n
+Память должна быть выделена. \n
+Выходной вектор может совпадать с входным вектором `x`
+(БПФ "на месте"). Входной вектор не копируется в рабочую память
+`fft_t`, если БПФ рассчитывается векторными кодлетами. \n \n
 
 \return
 `RES_OK` если расчет произведен успешно.  \n
@@ -188,8 +194,6 @@ int DSPL_API fft_cmplx(complex_t* x, int n, fft_t* pfft, complex_t* y)
     if(err != RES_OK)
         return err;
 
-    memcpy(pfft->t1, x, n*sizeof(complex_t));
-
-    return fft_krn(pfft->t1, y, pfft, n, 0);
+    return fft_krn_src(x, y, pfft);
 }
 
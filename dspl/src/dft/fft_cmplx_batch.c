@@ -0,0 +1,191 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Batch fast Fourier transform of the complex vectors.
+
+Function calculates `cnt` \f$ n \f$-points FFTs of the complex vectors
+\f$ x_b(m) \f$, \f$ m = 0 \ldots n-1 \f$, \f$ b = 0 \ldots cnt-1 \f$
+(for example the signals of the antenna array channels): \n
+\f[
+  Y_b(k) = \sum_{m = 0}^{n-1} x_b(m) 
+  \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$.
+
+Input samples are addressed as 
+\f$ x_b(m) = \textrm{x[b} \cdot \textrm{dist} + m \cdot \textrm{stride]} \f$,
+so the function can process the separated vectors 
+(`stride = 1`, `dist = n`) as well as the interleaved channels 
+(`stride = cnt`, `dist = 1`). \n
+The FFT size check and the plan creation are performed once per call.
+Small FFTs are calculated by groups, so the FFT codelets process 
+the blocks of all transforms of the group by one call.
+The channels are not interleaved sample by sample through 
+the butterflies: each transform of the group is stored contiguously 
+and the vector codelets (see \ref fft_set_isa) process the columns 
+of the FFT stage blocks. The interleaved channels input 
+(`stride > dist`) is gathered across the group of the adjacent channels,
+so the input is read by the contiguous samples. \n
+If the worker threads are set by the \ref fft_set_threads function 
+then the groups are distributed between the threads.
+
+\param[in]  x
+Pointer to the input complex vectors. \n \n
+
+\param[in]  n
+FFT size \f$n\f$ (see \ref fft_create function). \n \n
+
+\param[in]  cnt
+Number of the FFTs. \n \n
+
+\param[in]  stride
+Distance between the samples of one input vector. \n 
+`stride` must be positive. \n \n
+
+\param[in]  dist
+Distance between the first samples of the adjacent input vectors. \n 
+`dist` must be positive. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Structure \ref fft_t should be previously once
+filled with the \ref fft_create or \ref fft_bind functions, 
+and the memory should be cleared before exiting 
+by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the FFT results.  \n
+FFT result \f$ Y_b(k) \f$ is stored as `y[b*n + k]`. \n
+Vector size is `[n*cnt x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include fft_cmplx_batch_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Пакетное быстрое преобразование Фурье комплексных сигналов
+
+Функция рассчитывает `cnt` \f$ n \f$-точечных БПФ комплексных сигналов
+\f$ x_b(m) \f$, \f$ m = 0 \ldots n-1 \f$, \f$ b = 0 \ldots cnt-1 \f$
+(например сигналов каналов антенной решетки): \n
+\f[
+  Y_b(k) = \sum_{m = 0}^{n-1} x_b(m) 
+  \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$.
+
+Отсчеты входных сигналов адресуются как
+\f$ x_b(m) = \textrm{x[b} \cdot \textrm{dist} + m \cdot \textrm{stride]} \f$,
+поэтому функция может обрабатывать как раздельные векторы 
+(`stride = 1`, `dist = n`), так и чередующиеся отсчеты каналов
+(`stride = cnt`, `dist = 1`). \n
+Проверка размера и создание плана БПФ производится один раз за вызов.
+БПФ малого размера рассчитываются группами, при этом ядра БПФ 
+обрабатывают блоки всех преобразований группы за один вызов.
+Каналы не чередуются поотсчетно в бабочках БПФ: каждое преобразование 
+группы хранится непрерывно, а векторные ядра (см. \ref fft_set_isa) 
+обрабатывают столбцы блоков ступеней БПФ. Чередующиеся отсчеты каналов
+(`stride > dist`) собираются поперек группы соседних каналов,
+поэтому входные данные читаются последовательными отсчетами. \n
+Если функцией \ref fft_set_threads заданы рабочие потоки, 
+то группы распределяются между потоками.
+
+\param[in]  x
+Указатель на входные комплексные сигналы. \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$ (см. описание функции \ref fft_create). \n \n
+
+\param[in]  cnt
+Количество БПФ. \n \n
+
+\param[in]  stride
+Шаг между отсчетами одного входного сигнала. \n 
+Значение `stride` должно быть положительным. \n \n
+
+\param[in]  dist
+Шаг между первыми отсчетами соседних входных сигналов. \n 
+Значение `dist` должно быть положительным. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Структура \ref fft_t должна быть предварительно однократно
+заполнена функцией \ref fft_create или \ref fft_bind, 
+а память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на результаты БПФ. \n
+Результат БПФ \f$ Y_b(k) \f$ сохраняется как `y[b*n + k]`. \n
+Размер вектора `[n*cnt x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции:
+
+\include fft_cmplx_batch_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_cmplx_batch(complex_t* x, int n, int cnt, int stride, 
+                             int dist, fft_t* pfft, complex_t* y)
+{
+    int err;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || cnt < 1)
+        return ERROR_SIZE;
+    if(stride < 1 || dist < 1)
+        return ERROR_ARG_PARAM;
+
+    err = fft_create(pfft, n);
+    if(err != RES_OK)
+        return err;
+
+    /* groups of the input lines to the contiguous output vectors */
+    return fft_lines(x, y, cnt, stride, dist, 1, n, pfft);
+}
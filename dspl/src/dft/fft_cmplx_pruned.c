@@ -0,0 +1,201 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Pruned fast Fourier transform of the zero-padded complex vector.
+
+Function calculates `ny` samples 
+\f$ Y(k_0 + i) \f$, \f$ i = 0 \ldots n_y-1 \f$ of the \f$ n \f$-points FFT
+of the `nx` samples of the vector `x` zero-padded to the size `n`: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n_x-1} x(m) 
+  \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+the output index \f$ k = (k_0 + i) \bmod n \f$ is taken modulo `n`,
+so the output window can contain the negative frequencies. \n
+The known zero samples of the input (input pruning) 
+or the not required samples of the output (output pruning) 
+are not calculated. The FFT is decomposed to \f$ q \f$ FFTs 
+of the size \f$ m = n / q \f$. If \f$ n_x \leq m \f$ then the FFTs 
+of the input \f$ x(i) W_n^{i r} \f$, \f$ r = 0 \ldots q-1 \f$, 
+calculate the output samples \f$ Y(r + qk) \f$ (decimation in frequency). 
+Else the FFTs of the decimated inputs \f$ x(r + q i) \f$ are combined 
+only for the required output samples (decimation in time). 
+The size \f$ m \f$ and the algorithm are selected by the operations count,
+and the full FFT is used if the pruning is not faster. \n
+For example the FFT of the 4096 samples zero-padded to 65536 
+is calculated by sixteen 4096-points FFTs, 
+and the 129 samples of the 65536-points FFT are calculated 
+by the 512-points FFTs. \n
+The `pfft` object is created for the size \f$ m \f$. The `n`-points 
+twiddle factors of the pruning are kept in the object, so the same object
+can be used for the full FFTs and the factors are calculated once for 
+the repeated transforms of the size `n`. The factors calculation is 
+counted when the pruning is compared with the full FFT.
+
+\param[in]  x
+Pointer to the input complex vector. \n
+Vector size is `[nx x 1]`. \n \n
+
+\param[in]  nx
+Number of the input samples, \f$ 1 \leq n_x \leq n \f$. \n
+Input samples \f$ x(m) \f$, \f$ m = n_x \ldots n-1 \f$, are zeros. \n \n
+
+\param[in]  n
+FFT size \f$n\f$ (see \ref fft_create function). \n \n
+
+\param[in]  k0
+Index of the first output sample. \n 
+Index is taken modulo `n`, it can be negative. \n \n
+
+\param[in]  ny
+Number of the output samples, \f$ 1 \leq n_y \leq n \f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+The memory should be cleared before exiting 
+by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the FFT output samples \f$ Y(k_0 + i) \f$. \n
+Vector size is `[ny x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+fft_t pfft = {0};
+// 8192 samples spectrum zero-padded to 131072 points 
+// (the spectrum interpolation)
+fft_cmplx_pruned(x, 8192, 131072, 0, 131072, &pfft, y);
+// 101 samples of the 65536-points spectrum near zero frequency
+fft_cmplx_pruned(x, 65536, 65536, -50, 101, &pfft, z);
+fft_free(&pfft);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Усеченное быстрое преобразование Фурье комплексного сигнала,
+дополненного нулями
+
+Функция рассчитывает `ny` отсчетов 
+\f$ Y(k_0 + i) \f$, \f$ i = 0 \ldots n_y-1 \f$ \f$ n \f$-точечного БПФ
+`nx` отсчетов вектора `x`, дополненного нулями до размера `n`: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n_x-1} x(m) 
+  \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+индекс выходного отсчета \f$ k = (k_0 + i) \bmod n \f$ берется по модулю `n`,
+поэтому выходное окно может содержать отрицательные частоты. \n
+Известные нулевые отсчеты входа (усечение по входу) 
+и ненужные отсчеты выхода (усечение по выходу) не рассчитываются. 
+БПФ раскладывается на \f$ q \f$ БПФ размера \f$ m = n / q \f$. 
+Если \f$ n_x \leq m \f$, то БПФ входных сигналов \f$ x(i) W_n^{i r} \f$, 
+\f$ r = 0 \ldots q-1 \f$, рассчитывают выходные отсчеты \f$ Y(r + qk) \f$ 
+(прореживание по частоте). Иначе БПФ прореженных входных сигналов 
+\f$ x(r + q i) \f$ объединяются только для требуемых выходных отсчетов 
+(прореживание по времени). Размер \f$ m \f$ и алгоритм выбираются 
+по количеству операций, если усечение не быстрее, то используется 
+полное БПФ. \n
+Например, БПФ 4096 отсчетов, дополненных нулями до 65536, 
+рассчитывается шестнадцатью 4096-точечными БПФ, 
+а 129 отсчетов 65536-точечного БПФ рассчитываются 512-точечными БПФ. \n
+Объект `pfft` создается для размера \f$ m \f$. Поворотные 
+коэффициенты усечения `n`-точечного БПФ сохраняются в объекте, поэтому 
+тот же объект может использоваться для полного БПФ, а коэффициенты 
+рассчитываются один раз для повторяющихся преобразований размера `n`. 
+Расчет коэффициентов учитывается при сравнении усечения с полным БПФ.
+
+\param[in]  x
+Указатель на входной комплексный сигнал. \n
+Размер вектора `[nx x 1]`. \n \n
+
+\param[in]  nx
+Количество входных отсчетов, \f$ 1 \leq n_x \leq n \f$. \n
+Входные отсчеты \f$ x(m) \f$, \f$ m = n_x \ldots n-1 \f$, равны нулю. \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$ (см. описание функции \ref fft_create). \n \n
+
+\param[in]  k0
+Индекс первого выходного отсчета. \n 
+Индекс берется по модулю `n` и может быть отрицательным. \n \n
+
+\param[in]  ny
+Количество выходных отсчетов, \f$ 1 \leq n_y \leq n \f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на выходные отсчеты БПФ \f$ Y(k_0 + i) \f$. \n
+Размер вектора `[ny x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+fft_t pfft = {0};
+// спектр 8192 отсчетов, дополненных нулями до 131072 точек 
+// (интерполяция спектра)
+fft_cmplx_pruned(x, 8192, 131072, 0, 131072, &pfft, y);
+// 101 отсчет 65536-точечного спектра вблизи нулевой частоты
+fft_cmplx_pruned(x, 65536, 65536, -50, 101, &pfft, z);
+fft_free(&pfft);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_cmplx_pruned(complex_t* x, int nx, int n, int k0, int ny,
+                              fft_t* pfft, complex_t* y)
+{
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || nx < 1 || nx > n || ny < 1 || ny > n)
+        return ERROR_SIZE;
+    return fft_pruned_krn(x, nx, n, k0, ny, pfft, 0, y);
+}
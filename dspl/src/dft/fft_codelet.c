@@ -0,0 +1,346 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+void fft_codelet1(complex_t* x, complex_t* y, int cnt, 
+                  fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    memcpy(y, x, cnt*sizeof(complex_t));
+}
+
+
+void fft_codelet2(complex_t* x, complex_t* y, int cnt, 
+                  fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft2(x+2*k, y+2*k);
+}
+
+
+void fft_codelet3(complex_t* x, complex_t* y, int cnt, 
+                  fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft3(x+3*k, y+3*k);
+}
+
+
+void fft_codelet4(complex_t* x, complex_t* y, int cnt, 
+                  fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft4(x+4*k, y+4*k);
+}
+
+
+void fft_codelet5(complex_t* x, complex_t* y, int cnt, 
+                  fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft5(x+5*k, y+5*k);
+}
+
+
+void fft_codelet7(complex_t* x, complex_t* y, int cnt, 
+                  fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft7(x+7*k, y+7*k);
+}
+
+
+void fft_codelet8(complex_t* x, complex_t* y, int cnt, 
+                  fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft8(x+8*k, y+8*k);
+}
+
+
+void fft_codelet16(complex_t* x, complex_t* y, int cnt, 
+                   fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft16(x+16*k, y+16*k);
+}
+
+
+void fft_codelet32(complex_t* x, complex_t* y, int cnt, 
+                   fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft32(x+32*k, y+32*k, p->w32);
+}
+
+
+void fft_codelet64(complex_t* x, complex_t* y, int cnt, 
+                   fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft64(x+64*k, y+64*k, p->w64);
+}
+
+
+void fft_codelet128(complex_t* x, complex_t* y, int cnt, 
+                    fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft128(x+128*k, y+128*k, p->w128);
+}
+
+
+void fft_codelet256(complex_t* x, complex_t* y, int cnt, 
+                    fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft256(x+256*k, y+256*k, p->w256);
+}
+
+
+void fft_codelet512(complex_t* x, complex_t* y, int cnt, 
+                    fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft512(x+512*k, y+512*k, p->w512, p->w32);
+}
+
+
+void fft_codelet1024(complex_t* x, complex_t* y, int cnt, 
+                     fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft1024(x+1024*k, y+1024*k, p->w1024, p->w32);
+}
+
+
+void fft_codelet2048(complex_t* x, complex_t* y, int cnt, 
+                     fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft2048(x+2048*k, y+2048*k, p->w2048, p->w32, p->w64);
+}
+
+
+void fft_codelet4096(complex_t* x, complex_t* y, int cnt, 
+                     fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        dft4096(x+4096*k, y+4096*k, p->w4096, p->w256);
+}
+
+
+/*******************************************************************************
+Generated butterflies (see fft_bfgen.h) of the scalar codelets:
+one complex value per "vector"
+*******************************************************************************/
+typedef struct
+{
+    double re;
+    double im;
+} fft_sv_t;
+
+static inline fft_sv_t fft_sv_add(fft_sv_t a, fft_sv_t b)
+{
+    a.re += b.re;
+    a.im += b.im;
+    return a;
+}
+
+static inline fft_sv_t fft_sv_sub(fft_sv_t a, fft_sv_t b)
+{
+    a.re -= b.re;
+    a.im -= b.im;
+    return a;
+}
+
+static inline fft_sv_t fft_sv_scl(fft_sv_t a, double r)
+{
+    a.re *= r;
+    a.im *= r;
+    return a;
+}
+
+static inline fft_sv_t fft_sv_mulnj(fft_sv_t a)
+{
+    fft_sv_t b;
+    b.re =  a.im;
+    b.im = -a.re;
+    return b;
+}
+
+#define FFT_V               fft_sv_t
+#define FFT_TARGET
+#define FFT_SFX(f)          f##_scalar
+#define FFT_VADD(a, b)      fft_sv_add((a), (b))
+#define FFT_VSUB(a, b)      fft_sv_sub((a), (b))
+#define FFT_VSCL(a, r)      fft_sv_scl((a), (r))
+#define FFT_VMULNJ(a)       fft_sv_mulnj(a)
+
+#include "fft_bfgen.h"
+
+/* cnt R-points DFTs of the contiguous blocks */
+#define FFT_CODELET_GEN(R)                                                    \
+static void fft_codelet_gen##R(complex_t* x, complex_t* y, int cnt,           \
+                               fft_plan_t* p, fft_stage_t* s, complex_t* tb)  \
+{                                                                             \
+    fft_sv_t a[R];                                                            \
+    int b, k;                                                                 \
+    for(b = 0; b < cnt; b++)                                                  \
+    {                                                                         \
+        for(k = 0; k < R; k++)                                                \
+        {                                                                     \
+            a[k].re = RE(x[k]);                                               \
+            a[k].im = IM(x[k]);                                               \
+        }                                                                     \
+        fft_bf##R##_scalar(a);                                                \
+        for(k = 0; k < R; k++)                                                \
+        {                                                                     \
+            RE(y[k]) = a[k].re;                                               \
+            IM(y[k]) = a[k].im;                                               \
+        }                                                                     \
+        x += R;                                                               \
+        y += R;                                                               \
+    }                                                                         \
+}
+
+FFT_BFGEN_LIST(FFT_CODELET_GEN)
+
+#undef FFT_CODELET_GEN
+#undef FFT_V
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+
+
+
+/* generated codelet of the n1-points stage (NULL if n1 is not generated) */
+static fft_codelet_t fft_codelet_gen(int n1)
+{
+    switch(n1)
+    {
+#define FFT_CODELET_GEN_CASE(R)  case R: return fft_codelet_gen##R;
+        FFT_BFGEN_LIST(FFT_CODELET_GEN_CASE)
+#undef FFT_CODELET_GEN_CASE
+        default: return NULL;
+    }
+}
+
+
+
+int fft_codelet_radix(int s)
+{
+#define FFT_CODELET_RADIX(R)  if(s % R == 0) return R;
+    FFT_BFGEN_PLAN(FFT_CODELET_RADIX)
+#undef FFT_CODELET_RADIX
+    return 1;
+}
+
+
+void fft_codelet_dft(complex_t* x, complex_t* y, int cnt, 
+                     fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int n, k, m, i, b;
+    complex_t *pw = p->w + s->addr;
+    complex_t tmp;
+
+    n = s->n1;
+    for(b = 0; b < cnt; b++)
+    {
+        for(k = 0; k < n; k++)
+        {
+            RE(y[k]) = IM(y[k]) = 0.0;
+            i = 0;
+            for(m = 0; m < n; m++)
+            {
+                RE(tmp) = CMRE(x[m], pw[i]);
+                IM(tmp) = CMIM(x[m], pw[i]);
+                RE(y[k]) += RE(tmp);
+                IM(y[k]) += IM(tmp);
+                i += k;
+                if(i >= n)
+                    i -= n;
+            }
+        }
+        x += n;
+        y += n;
+    }
+}
+
+
+void fft_codelet_bluestein(complex_t* x, complex_t* y, int cnt, 
+                           fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    int k;
+    for(k = 0; k < cnt; k++)
+        fft_bluestein(x + k*s->n1, y + k*s->n1, p, s, tb, NULL);
+}
+
+
+fft_codelet_t fft_codelet(int n1)
+{
+    switch(n1)
+    {
+        case    1:  return fft_codelet1;
+        case    2:  return fft_codelet2;
+        case    3:  return fft_codelet3;
+        case    4:  return fft_codelet4;
+        case    5:  return fft_codelet5;
+        case    7:  return fft_codelet7;
+        case    8:  return fft_codelet8;
+        case   16:  return fft_codelet16;
+        case   32:  return fft_codelet32;
+        case   64:  return fft_codelet64;
+        case  128:  return fft_codelet128;
+        case  256:  return fft_codelet256;
+        case  512:  return fft_codelet512;
+        case 1024:  return fft_codelet1024;
+        case 2048:  return fft_codelet2048;
+        case 4096:  return fft_codelet4096;
+        default:    return fft_codelet_gen(n1);
+    }
+}
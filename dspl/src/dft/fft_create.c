@@ -36,7 +36,14 @@
 \brief Function creates and fill `fft_t` structure.
 
 The function allocates memory and calculates twiddle factors 
- of the `n`-point FFT for the structure` fft_t`.
+ of the `n`-point FFT for the structure` fft_t`. \n
+The object takes the FFT plan \ref fft_plan_t from the process-wide
+plan cache (see \ref fft_cache_set_size) and allocates the workspace 
+by the \ref fft_bind function. Plan of the new size is created by
+the \ref fft_plan_create function once and it is cached. 
+If the cache is disabled the object creates own plan. \n
+If the object is bound to the shared plan of other size, then
+the shared plan is not changed and the own plan is created.
 
 \param[in,out]  pfft
 Pointer to the `fft_t` object.  \n
@@ -47,18 +54,21 @@ FFT size \f$n\f$. \n
 FFT size can be composite 
 \f$n = n_0 \times n_1 \times n_2 \ldots \times n_p \times m\f$,
 here \f$n_i = 2,3,5,7\f$, and \f$m \f$ -- 
- arbitrary prime factor not exceeding 46340. \n
+ arbitrary factor. \n
 Thus, the FFT algorithm supports arbitrary integer lengths.
+The fastest FFT is provided for the integer
 degrees of numbers 2,3,5,7, as well as their various combinations.  \n
-For example, with \f$ n = 725760 \f$ the structure will be successfully filled, 
-because 
+For example, with \f$ n = 725760 \f$ the FFT uses only the radix-2,3,5,7
+kernels, because 
 \f$ 725760 = 2 \cdot 3 \cdot 4 \cdot 5 \cdot 6 \cdot 7 \cdot 9 \cdot 16 \f$. \n
-If \f$ n = 172804 = 43201 \cdot 4 \f$ then the structure will also be 
-successfully filled, because the simple factor in \f$ n \f$ does not 
-exceed 46340. \n
-For size \f$ n = 13 \cdot 17 \cdot 23 \cdot 13 = 66079 \f$
-the function will return an error since 66079 is greater than 46340 and is 
-not the result of the product of numbers 2,3,5,7. \n \n
+If the factor \f$ m \f$ does not exceed 32 then it is calculated
+as a DFT. \n
+Else (for example \f$ n = 172804 = 43201 \cdot 4 \f$ or 
+\f$ n = 13 \cdot 17 \cdot 23 \cdot 13 = 66079 \f$) the factor \f$ m \f$
+is calculated by the Bluestein algorithm as a circular convolution 
+with the chirp signal by the power of two FFT size 
+\f$ n_b \geq 2m-1 \f$. Thus the FFT complexity is 
+\f$ O(n \log n) \f$ for any size \f$ n \f$. \n \n
 
 \return
 `RES_OK` if FFT structure is created and filled successfully. \n
@@ -87,9 +97,6 @@ fft_free(&pfft);
 Before exiting the program, the memory allocated in the structure
 need to clear by  \ref fft_free function. \n \n
 
-\note
-The "magic number" 46340 because \f$\sqrt{2^{31}} = 46340.95\f$. \n
-
 \author Sergey Bakhurin www.dsplib.org 
 ***************************************************************************** */
 #endif
@@ -99,7 +106,14 @@ The "magic number" 46340 because \f$\sqrt{2^{31}} = 46340.95\f$. \n
 \brief Заполнение структуры `fft_t` для алгоритма БПФ
 
 Функция производит выделение памяти и рассчет векторов 
-поворотных коэффициентов `n`-точечного БПФ для структуры `fft_t`.
+поворотных коэффициентов `n`-точечного БПФ для структуры `fft_t`. \n
+Объект получает план БПФ \ref fft_plan_t из общего кэша планов
+процесса (см. \ref fft_cache_set_size) и выделяет рабочую память
+функцией \ref fft_bind. План нового размера создается функцией
+\ref fft_plan_create один раз и сохраняется в кэше.
+Если кэш отключен, то объект создает собственный план. \n
+Если объект подключен к совместно используемому плану другого размера,
+то общий план не изменяется, а создается собственный план объекта.
 
 \param[in,out]  pfft
 Указатель на структуру `fft_t`.  \n
@@ -110,18 +124,22 @@ The "magic number" 46340 because \f$\sqrt{2^{31}} = 46340.95\f$. \n
 Размер БПФ может быть составным вида 
 \f$n = n_0 \times n_1 \times n_2 \ldots \times n_p \times m\f$,
 где \f$n_i = 2,3,5,7\f$, а \f$m \f$ -- 
-произвольный простой множитель не превосходящий 46340. \n
-Таким образом алгоритм БПФ поддерживает произвольные длины, равные целой 
-степени чисел 2,3,5,7, а также различные их комбинации.  \n
-Так например, при \f$ n = 725760 \f$ структура будет успешно заполнена, 
-потому что 
+произвольный множитель. \n
+Таким образом алгоритм БПФ поддерживает произвольные длины. 
+Максимальное быстродействие достигается для длин, равных целой 
+степени чисел 2,3,5,7, а также различных их комбинаций.  \n
+Так например, при \f$ n = 725760 \f$ БПФ использует только 
+ядра по основанию 2,3,5,7, потому что 
 \f$725760 = 2 \cdot 3 \cdot 4 \cdot 5 \cdot 6 \cdot 7 \cdot 9 \cdot 16 \f$, 
 т.е. получается как произведение множителей 2,3,5,7. \n
-При \f$ n = 172804 = 43201 \cdot 4 \f$ структура также будет успешно заполнена, 
-потому что простой множитель входящий в \f$n\f$ не превосходит 46340. \n
-Для размера \f$ n = 13 \cdot 17 \cdot 23 \cdot 13 = 66079 \f$ 
-функция вернет ошибку, поскольку 66079 больше 46340 и не является результатом 
-произведения чисел 2,3,5,7. \n \n
+Если множитель \f$ m \f$ не превосходит 32, то он рассчитывается как ДПФ. \n
+В противном случае (например \f$ n = 172804 = 43201 \cdot 4 \f$ или 
+\f$ n = 13 \cdot 17 \cdot 23 \cdot 13 = 66079 \f$) 
+БПФ по множителю \f$ m \f$ рассчитывается алгоритмом Блюстейна 
+как циклическая свертка с ЛЧМ сигналом при помощи БПФ размера 
+\f$ n_b \geq 2m-1 \f$, равного целой степени двойки. 
+Таким образом вычислительная сложность БПФ составляет 
+\f$ O(n \log n) \f$ для любого размера \f$ n \f$. \n \n
 
 \return
 `RES_OK` если структура заполнена успешно. \n
@@ -150,216 +168,129 @@ fft_free(&pfft);
 Перед выходом из программы выделенную в структуре память 
 необходимо очистить функцией \ref fft_free . \n \n
 
-\note
-Магия числа 46340 заключается в том, что \f$\sqrt{2^{31}} = 46340.95\f$. \n
-
 \author Бахурин Сергей www.dsplib.org 
 ***************************************************************************** */
 #endif
 int DSPL_API fft_create(fft_t* pfft, int n)
 {
+    int err;
+    fft_plan_t* plan;
 
-    int n1, n2, addr, s, k, m, nw, err;
-    double phi;
-    s = n;
-    nw = addr = 0;
+    if(!pfft)
+        return ERROR_PTR;
 
-    if(pfft->n == n)
+    /* own and cached plans follow the instruction set of fft_set_isa,
+       the plan bound by fft_bind is used as is */
+    if(pfft->plan && pfft->plan->n == n && pfft->n == n &&
+      (!pfft->own || pfft->plan->isa == fft_get_isa()))
         return RES_OK;
 
-    while(s > 1)
+    /* plan of the process-wide cache */
+    err = fft_cache_get(n, &plan);
+    if(err != RES_OK)
     {
-        n2 = 1;
-        if(s%4096 == 0)  { n2 = 4096; goto label_size; }
-        if(s%2048 == 0)  { n2 = 2048; goto label_size; }
-        if(s%1024 == 0)  { n2 = 1024; goto label_size; }
-        if(s%512  == 0)  { n2 =  512; goto label_size; }
-        if(s%256  == 0)  { n2 =  256; goto label_size; }
-        if(s%128  == 0)  { n2 =  128; goto label_size; }
-        if(s% 64  == 0)  { n2 =   64; goto label_size; }
-        if(s% 32  == 0)  { n2 =   32; goto label_size; }
-        if(s% 16  == 0)  { n2 =   16; goto label_size; }
-        if(s%  7  == 0)  { n2 =    7; goto label_size; }
-        if(s%  8  == 0)  { n2 =    8; goto label_size; }
-        if(s%  5  == 0)  { n2 =    5; goto label_size; }
-        if(s%  4  == 0)  { n2 =    4; goto label_size; }
-        if(s%  3  == 0)  { n2 =    3; goto label_size; }
-        if(s%  2  == 0)  { n2 =    2; goto label_size; }
-
-
-label_size:
-        if(n2 == 1)
-        {
-            if(s > FFT_COMPOSITE_MAX)
-            {
-                err = ERROR_FFT_SIZE;
-                goto error_proc;
-            }
-            
-            nw += s;
-            pfft->w = pfft->w ? 
-                      (complex_t*) realloc(pfft->w,  nw*sizeof(complex_t)):
-                      (complex_t*) malloc(           nw*sizeof(complex_t));
-            for(k = 0; k < s; k++)
-            {
-                phi = - M_2PI * (double)k / (double)s;
-                RE(pfft->w[addr]) = cos(phi);
-                IM(pfft->w[addr]) = sin(phi);
-                addr++;
-            }
-            s = 1;
-        }
-        else
-        {
-            n1 = s / n2;
-            nw += s;
-            pfft->w = pfft->w ? 
-                      (complex_t*) realloc(pfft->w,    nw*sizeof(complex_t)):
-                      (complex_t*) malloc(             nw*sizeof(complex_t));
-
-            for(k = 0; k < n1; k++)
-            {
-                for(m = 0; m < n2; m++)
-                {
-                    phi = - M_2PI * (double)(k*m) / (double)s;
-                    RE(pfft->w[addr]) = cos(phi);
-                    IM(pfft->w[addr]) = sin(phi);
-                    addr++;
-                }
-            }
-        }
-        s /= n2;
+        fft_free(pfft);
+        return err;
     }
-
-    pfft->t0 = pfft->t0 ? (complex_t*) realloc(pfft->t0, n*sizeof(complex_t)):
-                          (complex_t*) malloc(           n*sizeof(complex_t));
-
-    pfft->t1 = pfft->t1 ? (complex_t*) realloc(pfft->t1, n*sizeof(complex_t)):
-                          (complex_t*) malloc(           n*sizeof(complex_t));
-    pfft->n = n;
-    
-    /* w32 fill */
-    addr = 0;
-    for(k = 0; k < 4; k++)
+    if(plan)
     {
-        for(m = 0; m < 8; m++)
-        {
-            phi = - M_2PI * (double)(k*m) / 32.0;
-            RE(pfft->w32[addr]) = cos(phi);
-            IM(pfft->w32[addr]) = sin(phi);
-            addr++;
-        }
-    }
-    
-    
-    /* w64 fill */
-    addr = 0;
-    for(k = 0; k < 8; k++)
-    {
-        for(m = 0; m < 8; m++)
-        {
-            phi = - M_2PI * (double)(k*m) / 64.0;
-            RE(pfft->w64[addr]) = cos(phi);
-            IM(pfft->w64[addr]) = sin(phi);
-            addr++;
-        }
-    }
-    
-    /* w128 fill */
-    addr = 0;
-    for(k = 0; k < 8; k++)
-    {
-        for(m = 0; m < 16; m++)
-        {
-            phi = - M_2PI * (double)(k*m) / 128.0;
-            RE(pfft->w128[addr]) = cos(phi);
-            IM(pfft->w128[addr]) = sin(phi);
-            addr++;
-        }
+        /* the object already holds a reference to this plan */
+        if(pfft->own == FFT_OWN_CACHE && pfft->plan == plan)
+            fft_cache_release(plan);
+        err = fft_bind(pfft, plan);
+        pfft->own = FFT_OWN_CACHE;
+        if(err != RES_OK)
+            fft_free(pfft);
+        return err;
     }
-    
-    /* w256 fill */
-    addr = 0;
-    for(k = 0; k < 16; k++)
+
+    /* shared plan is never changed, the object creates own plan */
+    if(pfft->own == 1 && pfft->plan)
+        plan = pfft->plan;
+    else
     {
-        for(m = 0; m < 16; m++)
-        {
-            phi = - M_2PI * (double)(k*m) / 256.0;
-            RE(pfft->w256[addr]) = cos(phi);
-            IM(pfft->w256[addr]) = sin(phi);
-            addr++;
-        }
+        plan = (fft_plan_t*) malloc(sizeof(fft_plan_t));
+        if(!plan)
+            return ERROR_MALLOC;
+        memset(plan, 0, sizeof(fft_plan_t));
     }
-    
-    /* w512 fill */
-    addr = 0;
-    for(k = 0; k < 16; k++)
+
+    err = fft_plan_create(plan, n);
+    if(err == RES_OK)
+        err = fft_bind(pfft, plan);
+    if(err != RES_OK)
     {
-        for(m = 0; m < 32; m++)
+        if(pfft->plan != plan)
         {
-            phi = - M_2PI * (double)(k*m) / 512.0;
-            RE(pfft->w512[addr]) = cos(phi);
-            IM(pfft->w512[addr]) = sin(phi);
-            addr++;
+            fft_plan_free(plan);
+            free(plan);
         }
+        else
+            pfft->own = 1;
+        fft_free(pfft);
+        return err;
     }
-    
-    /* w1024 fill */
-    if(pfft->w1024 == NULL)
+    pfft->own = 1;
+    return RES_OK;
+}
+
+
+
+
+int fft_create_half(fft_t* pfft, int n2, fft_t* h)
+{
+    int err, own;
+    fft_plan_t* plan;
+
+    if(!pfft->half || pfft->half->n != n2 || 
+        pfft->half->isa != fft_get_isa())
     {
-        pfft->w1024 = (complex_t*) malloc(1024 * sizeof(complex_t));
-        addr = 0;
-        for(k = 0; k < 32; k++)
+        /* plan of the process-wide cache or own plan */
+        err = fft_cache_get(n2, &plan);
+        if(err != RES_OK)
+            return err;
+        own = FFT_OWN_CACHE;
+        if(!plan)
         {
-            for(m = 0; m < 32; m++)
+            plan = (fft_plan_t*) malloc(sizeof(fft_plan_t));
+            if(!plan)
+                return ERROR_MALLOC;
+            memset(plan, 0, sizeof(fft_plan_t));
+            err = fft_plan_create(plan, n2);
+            if(err != RES_OK)
             {
-                phi = - M_2PI * (double)(k*m) / 1024.0;
-                RE(pfft->w1024[addr]) = cos(phi);
-                IM(pfft->w1024[addr]) = sin(phi);
-                addr++;
+                fft_plan_free(plan);
+                free(plan);
+                return err;
             }
+            own = 1;
         }
-    }
-    
-    /* w2048 fill */
-    if(pfft->w2048 == NULL)
-    {
-        pfft->w2048= (complex_t*) malloc(2048 * sizeof(complex_t));
-        addr = 0;
-        for(k = 0; k < 32; k++)
+
+        if(pfft->hown == FFT_OWN_CACHE && pfft->half)
+            fft_cache_release(pfft->half);
+        else if(pfft->half)
         {
-            for(m = 0; m < 64; m++)
-            {
-                phi = - M_2PI * (double)(k*m) / 2048.0;
-                RE(pfft->w2048[addr]) = cos(phi);
-                IM(pfft->w2048[addr]) = sin(phi);
-                addr++;
-            }
+            fft_plan_free(pfft->half);
+            free(pfft->half);
         }
+        pfft->half = plan;
+        pfft->hown = own;
+
+        /* Bluestein workspace of the both plans */
+        err = fft_workspace_tb(pfft);
+        if(err != RES_OK)
+            return err;
     }
-    
-    /* w4096 fill */
-    if(pfft->w4096 == NULL)
+
+    err = fft_workspace(pfft, n2);
+    if(err != RES_OK)
+        return err;
+
+    if(h)
     {
-        pfft->w4096= (complex_t*) malloc(4096 * sizeof(complex_t));
-        addr = 0;
-        for(k = 0; k < 16; k++)
-        {
-            for(m = 0; m < 256; m++)
-            {
-                phi = - M_2PI * (double)(k*m) / 4096.0;
-                RE(pfft->w4096[addr]) = cos(phi);
-                IM(pfft->w4096[addr]) = sin(phi);
-                addr++;
-            }
-        }
+        *h = *pfft;
+        h->plan = pfft->half;
+        h->n = n2;
     }
-
     return RES_OK;
-error_proc:
-    if(pfft->t0) free(pfft->t0);
-    if(pfft->t1) free(pfft->t1);
-    if(pfft->w)    free(pfft->w);
-    pfft->n = 0;
-    return err;
 }
@@ -24,6 +24,7 @@
 #include <float.h>
 
 #include "dspl.h"
+#include "dft.h"
 
 
 
@@ -36,7 +37,9 @@
 \brief Free `fft_t` structure.
 
 The function clears the intermediate data memory
-and vectors of FFT twiddle factors of the structure `fft_t`.
+and vectors of FFT twiddle factors of the structure `fft_t`. \n
+Shared plan bound by the \ref fft_bind function is not cleared 
+and must be cleared by the \ref fft_plan_free function.
 
 \param[in] pfft
 Pointer to the `fft_t` object. \n
@@ -50,7 +53,9 @@ Pointer to the `fft_t` object. \n
 \brief Очистить структуру `fft_t` алгоритма БПФ
 
 Функция производит очищение памяти промежуточных данных 
-и векторов поворотных коэффициентов структуры `fft_t`.
+и векторов поворотных коэффициентов структуры `fft_t`. \n
+Совместно используемый план, подключенный функцией \ref fft_bind,
+не очищается и должен быть очищен функцией \ref fft_plan_free.
 
 \param[in] pfft
 Указатель на структуру `fft_t`. \n
@@ -62,22 +67,34 @@ void DSPL_API fft_free(fft_t *pfft)
 {
     if(!pfft)
         return;
-    if(pfft->w)
-        free(pfft->w);
     if(pfft->t0)
         free(pfft->t0);
     if(pfft->t1)
         free(pfft->t1);
+    if(pfft->tb)
+        free(pfft->tb);
+    if(pfft->pool)
+        fft_pool_free(pfft->pool);
+    if(pfft->wd)
+        free(pfft->wd);
+    if(pfft->wp)
+        free(pfft->wp);
       
-    if(pfft->w1024)
-        free(pfft->w1024);
-      
-    if(pfft->w2048)
-        free(pfft->w2048);
-      
-    if(pfft->w4096)
-        free(pfft->w4096);
+    if(pfft->own == FFT_OWN_CACHE && pfft->plan)
+        fft_cache_release(pfft->plan);
+    else if(pfft->own && pfft->plan)
+    {
+        fft_plan_free(pfft->plan);
+        free(pfft->plan);
+    }
+
+    if(pfft->hown == FFT_OWN_CACHE && pfft->half)
+        fft_cache_release(pfft->half);
+    else if(pfft->hown && pfft->half)
+    {
+        fft_plan_free(pfft->half);
+        free(pfft->half);
+    }
       
     memset(pfft, 0, sizeof(fft_t));
 }
-
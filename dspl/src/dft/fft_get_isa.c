@@ -0,0 +1,62 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Instruction set of the FFT codelets.
+
+The function is the alias of the \ref dspl_get_isa function 
+and it is kept for compatibility.
+
+\return
+`FFT_ISA_SCALAR`, `FFT_ISA_SSE2`, `FFT_ISA_AVX2` or `FFT_ISA_AVX512`.
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Набор инструкций ядер БПФ
+
+Функция является синонимом функции \ref dspl_get_isa
+и сохранена для совместимости.
+
+\return
+`FFT_ISA_SCALAR`, `FFT_ISA_SSE2`, `FFT_ISA_AVX2` или `FFT_ISA_AVX512`.
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_get_isa(void)
+{
+    return dspl_get_isa();
+}
@@ -35,136 +35,148 @@
 #ifdef DOXYGEN_RUSSIAN
 
 #endif
-int fft_krn(complex_t* t0, complex_t* t1, fft_t* p, int n, int addr)
+int fft_krn(complex_t* t0, complex_t* t1, fft_t* p)
 {
-    int n1, n2, k, m, i;
-    complex_t *pw = p->w+addr;
-    complex_t tmp;
-    
-    n1 = 1;
-    if(n % 4096 == 0) { n1 = 4096; goto label_size; }
-    if(n % 2048 == 0) { n1 = 2048; goto label_size; }
-    if(n % 1024 == 0) { n1 = 1024; goto label_size; }
-    if(n %  512 == 0) { n1 =  512; goto label_size; }
-    if(n %  256 == 0) { n1 =  256; goto label_size; }
-    if(n %  128 == 0) { n1 =  128; goto label_size; }
-    if(n %   64 == 0) { n1 =   64; goto label_size; }
-    if(n %   32 == 0) { n1 =   32; goto label_size; }
-    if(n %   16 == 0) { n1 =   16; goto label_size; }
-    if(n %    7 == 0) { n1 =    7; goto label_size; }
-    if(n %    8 == 0) { n1 =    8; goto label_size; }
-    if(n %    5 == 0) { n1 =    5; goto label_size; }
-    if(n %    4 == 0) { n1 =    4; goto label_size; }
-    if(n %    3 == 0) { n1 =    3; goto label_size; }
-    if(n %    2 == 0) { n1 =    2; goto label_size; }
-
-label_size:
-    if(n1 == 1)
+    if(p->pool && p->n >= FFT_THREADS_MIN)
+        fft_run_mt(t0, t1, p->plan, p->plan->st, p->tb, 1, p->pool);
+    else
+        fft_run(t0, t1, p->plan, p->plan->st, p->tb, 1);
+    return RES_OK;
+}
+
+
+
+
+int fft_krn_src(complex_t* x, complex_t* y, fft_t* p)
+{
+    fft_stage_t* s = p->plan->st;
+    int mt = p->pool && p->n >= FFT_THREADS_MIN;
+
+    /* scalar first stage transposes the input: x is copied to t1 */
+    if(!s->vec)
+    {
+        memcpy(p->t1, x, p->n * sizeof(complex_t));
+        return fft_krn(p->t1, y, p);
+    }
+
+    /* the vector codelet reads and writes the same column positions,
+       so the first stage is executed from x to y in place if x == y.
+       Next stages use y as input and t0 as output,
+       the first stage transpose returns the result to y */
+    if(mt)
+    {
+        fft_vcol_mt(x, y, p->plan, s, p->pool);
+        fft_run_mt(y, p->t0, p->plan, s+1, p->tb,
+                   s->flat ? 1 : s->n1, p->pool);
+        fft_transpose_mt(p->t0, y, p->plan, s, p->pool);
+    }
+    else
+    {
+        s->fn(x, y, 1, p->plan, s, p->tb);
+        fft_run(y, p->t0, p->plan, s+1, p->tb, s->flat ? 1 : s->n1);
+        matrix_transpose_cmplx(p->t0, s->n2, s->n1, y);
+    }
+    return RES_OK;
+}
+
+
+
+
+void fft_run(complex_t* t0, complex_t* t1, fft_plan_t* p, 
+             fft_stage_t* s, complex_t* tb, int cnt)
+{
+    fft_stage_t *s0 = s;
+    complex_t *a = t0;
+    complex_t *b = t1;
+    complex_t *c, *w, *pa, *pb;
+    int n1, n2, i, j, k, m, l, nc;
+
+    /* large stage: each block is processed by n1 sub-blocks 
+       which are kept in cache */
+    if(!s->flat)
     {
-        for(k = 0; k < n; k++)
+        n1 = s->n1;
+        n2 = s->n2;
+        w  = p->w + s->addr;
+        for(; cnt > 0; cnt--)
         {
-            RE(t1[k]) = IM(t1[k]) = 0.0;
-            for(m = 0; m < n; m++)
+            if(s->vec)
+                s->fn(t0, t1, 1, p, s, tb);
+            else
             {
-                i = (k*m) % n;
-                RE(tmp) = CMRE(t0[m], pw[i]);
-                IM(tmp) = CMIM(t0[m], pw[i]);
-                RE(t1[k]) += RE(tmp);
-                IM(t1[k]) += IM(tmp);
+                matrix_transpose_cmplx(t0, n2, n1, t1);
+                s->fn(t1, t0, n2, p, s, tb);
+                m = 0;
+                for(i = 0; i < n2; i++)
+                {
+                    for(j = 0; j < n1; j++)
+                    {
+                        RE(t1[i + j*n2]) = CMRE(t0[m], w[m]);
+                        IM(t1[i + j*n2]) = CMIM(t0[m], w[m]);
+                        m++;
+                    }
+                }
             }
+            fft_run(t1, t0, p, s+1, tb, n1);
+            matrix_transpose_cmplx(t0, n2, n1, t1);
+            t0 += s->n;
+            t1 += s->n;
         }
+        return;
     }
-    else
+
+    /* flat stages: input transpose, n1-points codelets, 
+       twiddle factors multiplication with the output transpose */
+    for(l = 0; s0[l].n2 > 1; l++)
     {
-        n2 = n / n1;
-        
-        if(n2>1)
+        s  = s0 + l;
+        n1 = s->n1;
+        n2 = s->n2;
+        nc = s->cnt * cnt;
+        if(s->vec)
         {
-            memcpy(t1, t0, n*sizeof(complex_t));
-            matrix_transpose_cmplx(t1, n2, n1, t0);
+            /* vector codelet reads the stage blocks without transpose 
+               and writes the output with twiddle factors */
+            s->fn(a, b, nc, p, s, tb);
+            c = a; a = b; b = c;
+            continue;
         }
-        
-        if(n1 == 4096)
-            for(k = 0; k < n2; k++)
-                dft4096(t0+4096*k, t1+4096*k, p->w4096, p->w256);
-              
-        if(n1 == 2048)
-            for(k = 0; k < n2; k++)
-                dft2048(t0+2048*k, t1+2048*k, p->w2048, p->w32, p->w64);
-        
-        if(n1 == 1024)
-            for(k = 0; k < n2; k++)
-                dft1024(t0+1024*k, t1+1024*k, p->w1024, p->w32);
-              
-        if(n1 == 512)
-            for(k = 0; k < n2; k++)
-                dft512(t0+512*k, t1+512*k, p->w512, p->w32);
-              
-        if(n1 == 256)
-            for(k = 0; k < n2; k++)
-                dft256(t0+256*k, t1+256*k, p->w256);
-              
-        if(n1 == 128)
-            for(k = 0; k < n2; k++)
-                dft128(t0+128*k, t1+128*k, p->w128);
-              
-        if(n1 == 64)
-            for(k = 0; k < n2; k++)
-                dft64(t0+64*k, t1+64*k, p->w64);
-
-        if(n1 == 32)
-            for(k = 0; k < n2; k++)
-                dft32(t0+32*k, t1+32*k, p->w32);
-        
-        if(n1 == 16)
-            for(k = 0; k < n2; k++)
-                dft16(t0+16*k, t1+16*k);
-                
-        if(n1 == 7)
-            for(k = 0; k < n2; k++)
-                dft7(t0+7*k, t1+7*k);
-            
-        if(n1 == 8)
-            for(k = 0; k < n2; k++)
-                dft8(t0+8*k, t1+8*k); 
-                
-        if(n1 == 5)
-            for(k = 0; k < n2; k++)
-                dft5(t0+5*k, t1+5*k);
-     
-        if(n1 == 4)
-            for(k = 0; k < n2; k++)
-                dft4(t0+4*k, t1+4*k);
-        
-        if(n1 == 3)
-            for(k = 0; k < n2; k++)
-                dft3(t0+3*k, t1+3*k);
-        
-        if(n1 == 2)
-            for(k = 0; k < n2; k++)
-                dft2(t0+2*k, t1+2*k);
-
-        if(n2 > 1)
-        {
+        for(k = 0; k < nc; k++)
+            matrix_transpose_cmplx(a + k*s->n, n2, n1, b + k*s->n);
 
-            for(k =0; k < n; k++)
-            {
-                RE(t0[k]) = CMRE(t1[k], pw[k]);
-                IM(t0[k]) = CMIM(t1[k], pw[k]);
-            }
+        s->fn(b, a, nc * n2, p, s, tb);
 
-            matrix_transpose_cmplx(t0, n1, n2, t1);
-            
-            
-            for(k = 0; k < n1; k++)
+        w = p->w + s->addr;
+        for(k = 0; k < nc; k++)
+        {
+            pa = a + k*s->n;
+            pb = b + k*s->n;
+            m = 0;
+            for(i = 0; i < n2; i++)
             {
-                fft_krn(t1+k*n2, t0+k*n2, p, n2, addr+n);
+                for(j = 0; j < n1; j++)
+                {
+                    RE(pb[i + j*n2]) = CMRE(pa[m], w[m]);
+                    IM(pb[i + j*n2]) = CMIM(pa[m], w[m]);
+                    m++;
+                }
             }
-            
-            matrix_transpose_cmplx(t0, n2, n1, t1);
         }
+        c = a; a = b; b = c;
     }
-    return RES_OK;
-}
 
+    /* last stage codelets */
+    s = s0 + l;
+    s->fn(a, b, s->cnt * cnt, p, s, tb);
+    c = a; a = b; b = c;
 
+    /* backward stages output transpose */
+    for(l--; l >= 0; l--)
+    {
+        s  = s0 + l;
+        nc = s->cnt * cnt;
+        for(k = 0; k < nc; k++)
+            matrix_transpose_cmplx(a + k*s->n, s->n2, s->n1, b + k*s->n);
+        c = a; a = b; b = c;
+    }
+}
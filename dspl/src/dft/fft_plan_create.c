@@ -0,0 +1,564 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Function creates and fills `fft_plan_t` FFT plan.
+
+The function allocates memory and calculates twiddle factors 
+of the `n`-point FFT for the plan `fft_plan_t`. \n
+The plan is not changed by the FFT functions, so it can be shared 
+by several `fft_t` objects bound by the \ref fft_bind function.
+
+\param[in,out]  plan
+Pointer to the `fft_plan_t` object.  \n
+Pointer cannot be `NULL`.  \n \n
+
+\param[in]  n
+FFT size \f$n\f$. \n
+FFT size can be composite 
+\f$n = n_0 \times n_1 \times n_2 \ldots \times n_p \times m\f$,
+here \f$n_i = 2,3,5,7,11,13\f$, and \f$m \f$ -- 
+ arbitrary factor. \n
+Thus, the FFT algorithm supports arbitrary integer lengths.
+The fastest FFT is provided for the integer
+degrees of numbers 2,3,5,7,11,13, as well as their various combinations.  \n
+For example, with \f$ n = 725760 \f$ the FFT uses only the radix-2,3,5,7
+kernels, because 
+\f$ 725760 = 2 \cdot 3 \cdot 4 \cdot 5 \cdot 6 \cdot 7 \cdot 9 \cdot 16 \f$. \n
+If the factor \f$ m \f$ does not exceed 32 then it is calculated
+as a DFT. \n
+Else (for example \f$ n = 172804 = 43201 \cdot 4 \f$ or 
+\f$ n = 13 \cdot 17 \cdot 23 \cdot 13 = 66079 \f$, here \f$ m = 391 \f$) 
+the factor \f$ m \f$
+is calculated by the Bluestein algorithm as a circular convolution 
+with the chirp signal by the power of two FFT size 
+\f$ n_b \geq 2m-1 \f$. Thus the FFT complexity is 
+\f$ O(n \log n) \f$ for any size \f$ n \f$. \n
+The order of the radixes and the codelets of the plan stages are
+selected by the heuristic, or they are taken from the FFT wisdom
+of the size `n` and the current instruction set 
+(see \ref fft_wisdom_measure and \ref fft_wisdom_load). \n \n
+
+\return
+`RES_OK` if FFT plan is created and filled successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\note
+It is recommended to reset the plan structure after its declaration:
+\code{.cpp}
+fft_plan_t plan = {0};  // fill all fields of fft_plan_t as zeros
+fft_t pfft = {0};       // fill all fields of fft_t as zeros
+
+fft_plan_create(&plan, 64);
+fft_bind(&pfft, &plan);
+
+// ................................... 
+
+fft_free(&pfft);
+fft_plan_free(&plan);
+\endcode
+
+Before exiting the program, the memory allocated in the plan
+need to clear by  \ref fft_plan_free function. \n \n
+
+\author Sergey Bakhurin www.dsplib.org 
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Заполнение плана БПФ `fft_plan_t`
+
+Функция производит выделение памяти и рассчет векторов 
+поворотных коэффициентов `n`-точечного БПФ для плана `fft_plan_t`. \n
+План не изменяется функциями БПФ, поэтому он может совместно 
+использоваться несколькими объектами `fft_t`, 
+подключенными функцией \ref fft_bind.
+
+\param[in,out]  plan
+Указатель на план `fft_plan_t`.  \n
+Указатель не должен быть `NULL`.  \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$. \n
+Размер БПФ может быть составным вида 
+\f$n = n_0 \times n_1 \times n_2 \ldots \times n_p \times m\f$,
+где \f$n_i = 2,3,5,7,11,13\f$, а \f$m \f$ -- 
+произвольный множитель. \n
+Таким образом алгоритм БПФ поддерживает произвольные длины. 
+Максимальное быстродействие достигается для длин, равных целой 
+степени чисел 2,3,5,7,11,13, а также различных их комбинаций.  \n
+Так например, при \f$ n = 725760 \f$ БПФ использует только 
+ядра по основанию 2,3,5,7, потому что 
+\f$725760 = 2 \cdot 3 \cdot 4 \cdot 5 \cdot 6 \cdot 7 \cdot 9 \cdot 16 \f$, 
+т.е. получается как произведение множителей 2,3,5,7. \n
+Если множитель \f$ m \f$ не превосходит 32, то он рассчитывается как ДПФ. \n
+В противном случае (например \f$ n = 172804 = 43201 \cdot 4 \f$ или 
+\f$ n = 13 \cdot 17 \cdot 23 \cdot 13 = 66079 \f$, где \f$ m = 391 \f$) 
+БПФ по множителю \f$ m \f$ рассчитывается алгоритмом Блюстейна 
+как циклическая свертка с ЛЧМ сигналом при помощи БПФ размера 
+\f$ n_b \geq 2m-1 \f$, равного целой степени двойки. 
+Таким образом вычислительная сложность БПФ составляет 
+\f$ O(n \log n) \f$ для любого размера \f$ n \f$. \n
+Порядок оснований и ядра этапов плана выбираются эвристически, 
+либо берутся из мудрости БПФ размера `n` для текущего набора инструкций
+(см. \ref fft_wisdom_measure и \ref fft_wisdom_load). \n \n
+
+\return
+`RES_OK` если план заполнен успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+\note
+Рекомендуется произвести обнуление структуры плана после ее объявления:
+\code{.cpp}
+fft_plan_t plan = {0};  // объявляем план fft_plan_t
+fft_t pfft = {0};       // объявляем объект fft_t
+
+fft_plan_create(&plan, 64);
+fft_bind(&pfft, &plan);
+
+// ................................... 
+
+fft_free(&pfft);
+fft_plan_free(&plan);
+\endcode
+
+Перед выходом из программы выделенную в плане память 
+необходимо очистить функцией \ref fft_plan_free . \n \n
+
+\author Бахурин Сергей www.dsplib.org 
+***************************************************************************** */
+#endif
+int DSPL_API fft_plan_create(fft_plan_t* plan, int n)
+{
+    fft_wisdom_t wis;
+
+    if(!plan)
+        return ERROR_PTR;
+    if(n < 1)
+        return ERROR_FFT_SIZE;
+    /* the plan is rebuilt if the instruction set is changed 
+       by fft_set_isa after the plan creation */
+    if(plan->n == n && plan->isa == fft_get_isa())
+        return RES_OK;
+
+    /* radix sequence measured by fft_wisdom_measure 
+       or loaded by fft_wisdom_load */
+    if(fft_wisdom_find(n, fft_get_isa(), &wis))
+        return fft_plan_build(plan, n, &wis);
+    return fft_plan_build(plan, n, NULL);
+}
+
+
+
+
+int fft_plan_build(fft_plan_t* plan, int n, fft_wisdom_t* wis)
+{
+
+    int n1, n2, addr, s, k, m, i, nw, nb, bs, baddr, bst, ns, base, err, vec;
+    double phi;
+    complex_t* tb = NULL;
+    complex_t* tw;
+    fft_stage_t* st;
+    s = n;
+    base = 0;
+    nw = addr = ns = 0;
+    nb = bs = baddr = bst = 0;
+
+    plan->isa = fft_get_isa();
+    if(wis && (wis->n != n || wis->isa != plan->isa))
+        wis = NULL;
+    do
+    {
+        n2 = 1;
+        vec = 1;
+        /* wisdom stage radix, the invalid sequence is discarded */
+        if(wis && ns < wis->nst)
+        {
+            n2 = wis->r[ns];
+            if(n2 > 1 && s % n2 == 0 && fft_codelet(n2))
+            {
+                vec = wis->vec[ns];
+                goto label_size;
+            }
+            n2 = 1;
+            wis = NULL;
+        }
+        /* vector codelets are used up to radix 16 */
+        if(plan->isa == FFT_ISA_SCALAR)
+        {
+            if(s%4096 == 0)  { n2 = 4096; goto label_size; }
+            if(s%2048 == 0)  { n2 = 2048; goto label_size; }
+            if(s%1024 == 0)  { n2 = 1024; goto label_size; }
+            if(s%512  == 0)  { n2 =  512; goto label_size; }
+            if(s%256  == 0)  { n2 =  256; goto label_size; }
+            if(s%128  == 0)  { n2 =  128; goto label_size; }
+            if(s% 64  == 0)  { n2 =   64; goto label_size; }
+            if(s% 32  == 0)  { n2 =   32; goto label_size; }
+        }
+        if(s% 16  == 0)  { n2 =   16; goto label_size; }
+        /* generated codelets in the fft_bfgen.py priority order */
+        n2 = fft_codelet_radix(s);
+        if(n2 > 1)
+            goto label_size;
+        if(s%  7  == 0)  { n2 =    7; goto label_size; }
+        if(s%  8  == 0)  { n2 =    8; goto label_size; }
+        if(s%  5  == 0)  { n2 =    5; goto label_size; }
+        if(s%  4  == 0)  { n2 =    4; goto label_size; }
+        if(s%  3  == 0)  { n2 =    3; goto label_size; }
+        if(s%  2  == 0)  { n2 =    2; goto label_size; }
+
+
+label_size:
+        /* schedule stage of the s-points FFT */
+        st = plan->st ? 
+             (fft_stage_t*) realloc(plan->st, (ns+1)*sizeof(fft_stage_t)):
+             (fft_stage_t*) malloc(           (ns+1)*sizeof(fft_stage_t));
+        if(!st)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        plan->st = st;
+        st += ns++;
+        if(!base && (s <= FFT_FLAT_MAX || n2 == 1))
+            base = s;
+        st->n    = s;
+        st->cnt  = base ? base / s : 1;
+        st->flat = base ? 1 : 0;
+        st->addr = addr;
+        st->vec  = 0;
+        if(n2 == 1)
+        {
+            st->n1 = s;
+            st->n2 = 1;
+            st->fn = fft_codelet(s);
+            if(!st->fn)
+                st->fn = s > FFT_BLUESTEIN_MIN ? fft_codelet_bluestein : 
+                                                 fft_codelet_dft;
+        }
+        else
+        {
+            st->n1 = n2;
+            st->n2 = s / n2;
+            st->fn = fft_codelet(n2);
+        }
+        if(vec && plan->isa != FFT_ISA_SCALAR && fft_simd_radix(st->n1))
+        {
+            st->vec = st->n2 > 1;
+            st->fn  = st->vec ? fft_codelet_vcol : fft_codelet_vrow;
+        }
+
+        if(n2 == 1)
+        {
+            if(s <= FFT_BLUESTEIN_MIN)
+            {
+                nw += s;
+                tw = plan->w ? 
+                     (complex_t*) realloc(plan->w, nw*sizeof(complex_t)):
+                     (complex_t*) malloc(          nw*sizeof(complex_t));
+                if(!tw)
+                {
+                    err = ERROR_MALLOC;
+                    goto error_proc;
+                }
+                plan->w = tw;
+                for(k = 0; k < s; k++)
+                {
+                    phi = - M_2PI * (double)k / (double)s;
+                    RE(plan->w[addr]) = cos(phi);
+                    IM(plan->w[addr]) = sin(phi);
+                    addr++;
+                }
+                s = 1;
+            }
+            else
+            {
+                /* Bluestein algorithm: s-points chirp, 
+                   nb-points chirp filter spectrum and 
+                   nb-points radix-2 FFT twiddle factors */
+                if(s > FFT_BLUESTEIN_MAX)
+                {
+                    err = ERROR_FFT_SIZE;
+                    goto error_proc;
+                }
+                nb = 1;
+                while(nb < 2*s-1)
+                    nb *= 2;
+                nw += s + nb;
+                tw = plan->w ? 
+                     (complex_t*) realloc(plan->w, nw*sizeof(complex_t)):
+                     (complex_t*) malloc(          nw*sizeof(complex_t));
+                if(!tw)
+                {
+                    err = ERROR_MALLOC;
+                    goto error_proc;
+                }
+                plan->w = tw;
+                for(k = 0; k < s; k++)
+                {
+                    phi = - M_PI * (double)(((long long)k*k) % (2*s)) / 
+                                   (double)s;
+                    RE(plan->w[addr]) = cos(phi);
+                    IM(plan->w[addr]) = sin(phi);
+                    addr++;
+                }
+                bs = s;
+                baddr = addr;
+                bst = ns;
+                addr += nb;
+                s = nb;
+                base = 0;
+            }
+        }
+        else
+        {
+            n1 = s / n2;
+            nw += s;
+            tw = plan->w ? 
+                 (complex_t*) realloc(plan->w, nw*sizeof(complex_t)):
+                 (complex_t*) malloc(          nw*sizeof(complex_t));
+            if(!tw)
+            {
+                err = ERROR_MALLOC;
+                goto error_proc;
+            }
+            plan->w = tw;
+
+            /* vector codelet twiddle factors are stored transposed */
+            for(k = 0; k < n1; k++)
+            {
+                for(m = 0; m < n2; m++)
+                {
+                    phi = - M_2PI * (double)(k*m) / (double)s;
+                    i = st->vec ? addr + m*n1 + k : addr + k*n2 + m;
+                    RE(plan->w[i]) = cos(phi);
+                    IM(plan->w[i]) = sin(phi);
+                }
+            }
+            addr += s;
+        }
+        s /= n2;
+    } while(s > 1);
+    plan->nst = ns;
+
+    /* real FFT split twiddle factors W_{2n}^k, k = 0 ... n/2 */
+    tw = plan->wr ? 
+         (complex_t*) realloc(plan->wr, (n/2+1)*sizeof(complex_t)):
+         (complex_t*) malloc(           (n/2+1)*sizeof(complex_t));
+    if(!tw)
+    {
+        err = ERROR_MALLOC;
+        goto error_proc;
+    }
+    plan->wr = tw;
+    for(k = 0; k < n/2+1; k++)
+    {
+        phi = - M_PI * (double)k / (double)n;
+        RE(plan->wr[k]) = cos(phi);
+        IM(plan->wr[k]) = sin(phi);
+    }
+    plan->n = n;
+    
+    /* w32 fill */
+    addr = 0;
+    for(k = 0; k < 4; k++)
+    {
+        for(m = 0; m < 8; m++)
+        {
+            phi = - M_2PI * (double)(k*m) / 32.0;
+            RE(plan->w32[addr]) = cos(phi);
+            IM(plan->w32[addr]) = sin(phi);
+            addr++;
+        }
+    }
+    
+    
+    /* w64 fill */
+    addr = 0;
+    for(k = 0; k < 8; k++)
+    {
+        for(m = 0; m < 8; m++)
+        {
+            phi = - M_2PI * (double)(k*m) / 64.0;
+            RE(plan->w64[addr]) = cos(phi);
+            IM(plan->w64[addr]) = sin(phi);
+            addr++;
+        }
+    }
+    
+    /* w128 fill */
+    addr = 0;
+    for(k = 0; k < 8; k++)
+    {
+        for(m = 0; m < 16; m++)
+        {
+            phi = - M_2PI * (double)(k*m) / 128.0;
+            RE(plan->w128[addr]) = cos(phi);
+            IM(plan->w128[addr]) = sin(phi);
+            addr++;
+        }
+    }
+    
+    /* w256 fill */
+    addr = 0;
+    for(k = 0; k < 16; k++)
+    {
+        for(m = 0; m < 16; m++)
+        {
+            phi = - M_2PI * (double)(k*m) / 256.0;
+            RE(plan->w256[addr]) = cos(phi);
+            IM(plan->w256[addr]) = sin(phi);
+            addr++;
+        }
+    }
+    
+    /* w512 fill */
+    addr = 0;
+    for(k = 0; k < 16; k++)
+    {
+        for(m = 0; m < 32; m++)
+        {
+            phi = - M_2PI * (double)(k*m) / 512.0;
+            RE(plan->w512[addr]) = cos(phi);
+            IM(plan->w512[addr]) = sin(phi);
+            addr++;
+        }
+    }
+    
+    /* w1024 fill */
+    if(plan->w1024 == NULL)
+    {
+        plan->w1024 = (complex_t*) malloc(1024 * sizeof(complex_t));
+        if(!plan->w1024)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        addr = 0;
+        for(k = 0; k < 32; k++)
+        {
+            for(m = 0; m < 32; m++)
+            {
+                phi = - M_2PI * (double)(k*m) / 1024.0;
+                RE(plan->w1024[addr]) = cos(phi);
+                IM(plan->w1024[addr]) = sin(phi);
+                addr++;
+            }
+        }
+    }
+    
+    /* w2048 fill */
+    if(plan->w2048 == NULL)
+    {
+        plan->w2048 = (complex_t*) malloc(2048 * sizeof(complex_t));
+        if(!plan->w2048)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        addr = 0;
+        for(k = 0; k < 32; k++)
+        {
+            for(m = 0; m < 64; m++)
+            {
+                phi = - M_2PI * (double)(k*m) / 2048.0;
+                RE(plan->w2048[addr]) = cos(phi);
+                IM(plan->w2048[addr]) = sin(phi);
+                addr++;
+            }
+        }
+    }
+    
+    /* w4096 fill */
+    if(plan->w4096 == NULL)
+    {
+        plan->w4096 = (complex_t*) malloc(4096 * sizeof(complex_t));
+        if(!plan->w4096)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        addr = 0;
+        for(k = 0; k < 16; k++)
+        {
+            for(m = 0; m < 256; m++)
+            {
+                phi = - M_2PI * (double)(k*m) / 4096.0;
+                RE(plan->w4096[addr]) = cos(phi);
+                IM(plan->w4096[addr]) = sin(phi);
+                addr++;
+            }
+        }
+    }
+
+    /* Bluestein chirp filter spectrum */
+    plan->nb = 0;
+    if(bs)
+    {
+        tb = (complex_t*) malloc(2*nb*sizeof(complex_t));
+        if(!tb)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        memset(tb, 0, nb*sizeof(complex_t));
+        for(k = 0; k < bs; k++)
+        {
+            RE(tb[k]) =  RE(plan->w[baddr - bs + k]);
+            IM(tb[k]) = -IM(plan->w[baddr - bs + k]);
+            if(k)
+            {
+                RE(tb[nb-k]) = RE(tb[k]);
+                IM(tb[nb-k]) = IM(tb[k]);
+            }
+        }
+        fft_run(tb, tb + nb, plan, plan->st + bst, NULL, 1);
+
+        /* 1/nb inverse FFT scale is included into the filter spectrum */
+        phi = 1.0 / (double)nb;
+        for(k = 0; k < nb; k++)
+        {
+            RE(plan->w[baddr + k]) = RE(tb[nb + k]) * phi;
+            IM(plan->w[baddr + k]) = IM(tb[nb + k]) * phi;
+        }
+        free(tb);
+        plan->nb = nb;
+    }
+
+    return RES_OK;
+error_proc:
+    fft_plan_free(plan);
+    return err;
+}
@@ -0,0 +1,86 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP            
+\brief Free `fft_plan_t` FFT plan.
+
+The function clears vectors of FFT twiddle factors 
+of the plan `fft_plan_t`. \n
+All `fft_t` objects bound to the plan by the \ref fft_bind function
+must be cleared by the \ref fft_free function before.
+
+\param[in] plan
+Pointer to the `fft_plan_t` object. \n
+
+\author Sergey Bakhurin www.dsplib.org 
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Очистить план БПФ `fft_plan_t`
+
+Функция производит очищение памяти векторов поворотных 
+коэффициентов плана `fft_plan_t`. \n
+Все объекты `fft_t`, подключенные к плану функцией \ref fft_bind,
+должны быть предварительно очищены функцией \ref fft_free.
+
+\param[in] plan
+Указатель на план `fft_plan_t`. \n
+
+\author Бахурин Сергей www.dsplib.org 
+***************************************************************************** */
+#endif
+void DSPL_API fft_plan_free(fft_plan_t *plan)
+{
+    if(!plan)
+        return;
+    if(plan->w)
+        free(plan->w);
+    if(plan->wr)
+        free(plan->wr);
+    if(plan->st)
+        free(plan->st);
+      
+    if(plan->w1024)
+        free(plan->w1024);
+      
+    if(plan->w2048)
+        free(plan->w2048);
+      
+    if(plan->w4096)
+        free(plan->w4096);
+      
+    memset(plan, 0, sizeof(fft_plan_t));
+}
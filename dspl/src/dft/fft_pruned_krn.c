@@ -0,0 +1,333 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+/*******************************************************************************
+Number q of the m = n/q points FFTs of the pruned n-points FFT. 
+dif is set to 1 for the input pruning (decimation in frequency, m >= nx)
+or to 0 for the output pruning (decimation in time).
+The cost is n*log2(m) butterflies of the q FFTs, FFT_PRUNED_PASS*n of 
+the data passes and FFT_PRUNED_TW per twiddle factor multiplication: 
+q*nx for the input pruning, q*ny for the output pruning and ntw for 
+the twiddle factors table if it is not calculated yet (see fft_pruned_tw). 
+q = 1 if the full FFT is cheaper
+*******************************************************************************/
+static int fft_pruned_split(int n, int nx, int ny, int ntw, int* dif)
+{
+    double c, cbest;
+    int d, q, m, k, best;
+
+    best  = 1;
+    cbest = (double)n * log((double)n) / log(2.0);
+    *dif  = 1;
+    for(d = 1; d * d <= n; d++)
+    {
+        if(n % d)
+            continue;
+        /* divisors pair d and n/d */
+        for(k = 0; k < 2; k++)
+        {
+            q = k ? n / d : d;
+            m = n / q;
+            if(q < 2)
+                continue;
+            c = (double)n * (log((double)m) / log(2.0) + FFT_PRUNED_PASS) + 
+                FFT_PRUNED_TW * (double)ntw;
+            if(m >= nx && c + FFT_PRUNED_TW * (double)q * nx < cbest)
+            {
+                cbest = c + FFT_PRUNED_TW * (double)q * nx;
+                best  = q;
+                *dif  = 1;
+            }
+            if(c + FFT_PRUNED_TW * (double)q * ny < cbest)
+            {
+                cbest = c + FFT_PRUNED_TW * (double)q * ny;
+                best  = q;
+                *dif  = 0;
+            }
+        }
+    }
+    return best;
+}
+
+
+
+
+/*******************************************************************************
+Twiddle factors wp[k] = exp(-j 2 pi k / n), k = 0 ... n-1.
+The table is calculated as wp[a + b] = exp(-j 2 pi a / n) * wp[b], 
+a = 0, L, 2L ..., b = 0 ... L-1, by the L + n/L values of cos and sin 
+(L = sqrt(n)), thus the cost is one complex multiplication per factor.
+The table is kept in the fft_t object when the object is recreated 
+for the other FFT size
+*******************************************************************************/
+static int fft_pruned_tw(fft_t* pfft, int n)
+{
+    complex_t* w;
+    double phi, c, s;
+    int a, b, L;
+
+    if(pfft->wp && pfft->np == n)
+        return RES_OK;
+
+    w = pfft->wp ? 
+        (complex_t*) realloc(pfft->wp, n*sizeof(complex_t)):
+        (complex_t*) malloc(           n*sizeof(complex_t));
+    pfft->np = 0;
+    if(!w)
+    {
+        free(pfft->wp);
+        pfft->wp = NULL;
+        return ERROR_MALLOC;
+    }
+    pfft->wp = w;
+
+    L = (int)sqrt((double)n);
+    if(L < 1)
+        L = 1;
+    for(b = 0; b < L; b++)
+    {
+        phi = -M_2PI * (double)b / (double)n;
+        RE(w[b]) = cos(phi);
+        IM(w[b]) = sin(phi);
+    }
+    for(a = L; a < n; a += L)
+    {
+        phi = -M_2PI * (double)a / (double)n;
+        c = cos(phi);
+        s = sin(phi);
+        for(b = 0; b < L && a + b < n; b++)
+        {
+            RE(w[a+b]) = c * RE(w[b]) - s * IM(w[b]);
+            IM(w[a+b]) = c * IM(w[b]) + s * RE(w[b]);
+        }
+    }
+    pfft->np = n;
+    return RES_OK;
+}
+
+
+
+
+/*******************************************************************************
+Full n-points FFT of x zero-padded to n, the output window is copied to y
+*******************************************************************************/
+static int fft_pruned_full(complex_t* x, int nx, int n, int k0, int ny, 
+                           fft_t* pfft, int inv, complex_t* y)
+{
+    double nrm;
+    int i, k, err;
+
+    err = fft_create(pfft, n);
+    if(err != RES_OK)
+        return err;
+
+    /* all FFT outputs are calculated in place of y */
+    if(!inv && !k0 && ny == n)
+    {
+        if(y != x)
+            memcpy(y, x, nx*sizeof(complex_t));
+        memset(y + nx, 0, (n - nx)*sizeof(complex_t));
+        return fft_krn_src(y, y, pfft);
+    }
+
+    memcpy(pfft->t0, x, nx*sizeof(complex_t));
+    if(nx < n)
+        memset(pfft->t0 + nx, 0, (n - nx)*sizeof(complex_t));
+    if(inv)
+        for(i = 0; i < nx; i++)
+            IM(pfft->t0[i]) = -IM(pfft->t0[i]);
+
+    err = fft_krn(pfft->t0, pfft->t1, pfft);
+    if(err != RES_OK)
+        return err;
+
+    if(!inv)
+    {
+        k = ny < n - k0 ? ny : n - k0;
+        memcpy(y, pfft->t1 + k0, k*sizeof(complex_t));
+        if(k < ny)
+            memcpy(y + k, pfft->t1, (ny - k)*sizeof(complex_t));
+        return RES_OK;
+    }
+    nrm = 1.0 / (double)n;
+    for(i = 0, k = k0; i < ny; i++)
+    {
+        RE(y[i]) =  RE(pfft->t1[k]) * nrm;
+        IM(y[i]) = -IM(pfft->t1[k]) * nrm;
+        if(++k == n)
+            k = 0;
+    }
+    return RES_OK;
+}
+
+
+
+
+int fft_pruned_krn(complex_t* x, int nx, int n, int k0, int ny, 
+                   fft_t* pfft, int inv, complex_t* y)
+{
+    complex_t *w, *pt;
+    double s, nrm, re, im;
+    int q, m, g, b, r, i, j, k, km, dif, ntw, err;
+
+    k0 %= n;
+    if(k0 < 0)
+        k0 += n;
+    /* the twiddle factors table is counted if it is not calculated yet */
+    ntw = pfft->wp && pfft->np == n ? 0 : n;
+    q = fft_pruned_split(n, nx, ny, ntw, &dif);
+    if(q < 2)
+        return fft_pruned_full(x, nx, n, k0, ny, pfft, inv, y);
+
+    m = n / q;
+    err = fft_create(pfft, m);
+    if(err != RES_OK)
+        return err;
+    err = fft_pruned_tw(pfft, n);
+    if(err != RES_OK)
+        return err;
+    w = pfft->wp;
+
+    /* m-points FFTs are calculated by groups of g transforms as the batch 
+       FFT. At least FFT_PRUNED_GROUP adjacent blocks are grouped, 
+       so the decimated samples r + q*i of the group are adjacent */
+    g = m < FFT_BATCH_SIZE ? FFT_BATCH_SIZE / m : 1;
+    if(g < FFT_PRUNED_GROUP)
+        g = FFT_PRUNED_GROUP;
+    if(g > q)
+        g = q;
+    err = fft_workspace(pfft, g*m);
+    if(err != RES_OK)
+        return err;
+
+    /* IFFT is calculated as the conjugate FFT of the conjugate input */
+    s   = inv ? -1.0 : 1.0;
+    nrm = inv ? 1.0 / (double)n : 1.0;
+    if(!dif)
+        memset(y, 0, ny*sizeof(complex_t));
+
+    for(b = 0; b < q; b += g)
+    {
+        if(g > q - b)
+            g = q - b;
+
+        /* FFTs input */
+        if(dif)
+        {
+            /* x(i) * W_n^(i*r), i = 0 ... nx-1, zero padded to m */
+            for(r = b; r < b + g; r++)
+            {
+                pt = pfft->t0 + (r - b) * m;
+                for(i = 0, j = 0; i < nx; i++)
+                {
+                    RE(pt[i]) = RE(x[i]) * RE(w[j]) - s*IM(x[i]) * IM(w[j]);
+                    IM(pt[i]) = RE(x[i]) * IM(w[j]) + s*IM(x[i]) * RE(w[j]);
+                    j += r;
+                    if(j >= n)
+                        j -= n;
+                }
+                if(m > nx)
+                    memset(pt + nx, 0, (m - nx)*sizeof(complex_t));
+            }
+        }
+        else
+        {
+            /* x(r + q*i), i = 0 ... m-1 */
+            for(i = 0; i < m; i++)
+            {
+                pt = pfft->t0 + i;
+                for(r = 0, j = b + q*i; r < g; r++, j++)
+                {
+                    RE(pt[r*m]) = j < nx ?   RE(x[j]) : 0.0;
+                    IM(pt[r*m]) = j < nx ? s*IM(x[j]) : 0.0;
+                }
+            }
+        }
+
+        fft_run(pfft->t0, pfft->t1, pfft->plan, pfft->plan->st, pfft->tb, g);
+
+        /* FFTs output */
+        if(dif)
+        {
+            /* X(r + q*k) = T_r(k), outputs i = r + q*k - k0 */
+            for(k = 0; k < m; k++)
+            {
+                pt = pfft->t1 + k;
+                i = b + q*k - k0;
+                if(i < 0)
+                    i += n;
+                for(r = 0; r < g; r++, i++)
+                {
+                    if(i == n)
+                        i = 0;
+                    if(i < ny)
+                    {
+                        RE(y[i]) =   RE(pt[r*m]) * nrm;
+                        IM(y[i]) = s*IM(pt[r*m]) * nrm;
+                    }
+                }
+            }
+        }
+        else
+        {
+            /* X(k) += W_n^(r*k) * T_r(k mod m) */
+            for(r = b; r < b + g; r++)
+            {
+                pt = pfft->t1 + (r - b) * m;
+                j  = (int)(((long long)r * (long long)k0) % n);
+                km = k0 % m;
+                for(i = 0; i < ny; i++)
+                {
+                    re = RE(pt[km]);
+                    im = IM(pt[km]);
+                    RE(y[i]) += re * RE(w[j]) - im * IM(w[j]);
+                    IM(y[i]) += re * IM(w[j]) + im * RE(w[j]);
+                    j += r;
+                    if(j >= n)
+                        j -= n;
+                    if(++km == m)
+                        km = 0;
+                }
+            }
+        }
+    }
+
+    if(!dif && inv)
+    {
+        for(i = 0; i < ny; i++)
+        {
+            RE(y[i]) *=  nrm;
+            IM(y[i]) *= -nrm;
+        }
+    }
+    return RES_OK;
+}
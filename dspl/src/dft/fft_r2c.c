@@ -0,0 +1,217 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Fast Fourier transform of the real vector
+(non-redundant half of the spectrum).
+
+Function calculates \f$ n/2+1 \f$ non-redundant samples of the
+\f$ n \f$-points FFT for the real vector
+\f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \exp
+  \left( -j   \frac{2\pi}{n} m k \right),
+\f]
+here \f$ k = 0 \ldots \lfloor n/2 \rfloor\f$.
+Other spectrum samples are complex conjugate:
+\f$ Y(n-k) = Y^*(k) \f$.
+
+For even `n` the real vector is packed into the \f$ n/2 \f$-points
+complex vector \f$ z(m) = x(2m) + j x(2m+1) \f$,
+the \f$ n/2 \f$-points complex FFT is calculated
+and then the spectrum \f$ Y(k) \f$ is separated
+with the `wr` twiddle factors of the `fft_t` structure.
+Thus the function requires about twice less memory and calculations
+than the \ref fft function. \n
+For odd `n` the function uses the \f$ n \f$-points complex FFT.
+
+\param[in]  x
+Pointer to the input real vector \f$x(m)\f$,
+\f$ m = 0 \ldots n-1 \f$.  \n
+Vector size is `[n x 1]`.  \n \n
+
+\param[in]  n
+FFT size \f$n\f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Note that for even `n` the function uses the `n/2`-points
+plan `half` of the structure \ref fft_t, the `n`-points plan 
+of the structure is not changed. \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the FFT result complex vector \f$Y(k)\f$,
+\f$ k = 0 \ldots \lfloor n/2 \rfloor \f$. \n
+Vector size is `[n/2+1 x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include fft_r2c_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Быстрое преобразование Фурье вещественного сигнала
+(неизбыточная половина спектра)
+
+Функция рассчитывает \f$ n/2+1 \f$ неизбыточных отсчетов
+\f$ n \f$-точечного быстрого преобразования Фурье
+вещественного сигнала \f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \exp
+  \left( -j \frac{2\pi}{n} m k \right),
+\f]
+где \f$ k = 0 \ldots \lfloor n/2 \rfloor \f$.
+Остальные отсчеты спектра комплексно-сопряженные:
+\f$ Y(n-k) = Y^*(k) \f$.
+
+При четном `n` вещественный сигнал упаковывается в
+\f$ n/2 \f$-точечный комплексный сигнал \f$ z(m) = x(2m) + j x(2m+1) \f$,
+рассчитывается \f$ n/2 \f$-точечное комплексное БПФ,
+после чего спектр \f$ Y(k) \f$ выделяется при помощи
+поворотных коэффициентов `wr` структуры `fft_t`.
+Таким образом функция требует примерно вдвое меньше
+памяти и вычислений, чем функция \ref fft. \n
+При нечетном `n` используется \f$ n \f$-точечное комплексное БПФ.
+
+\param[in]  x
+Указатель на вектор вещественного входного сигнала \f$x(m)\f$,
+\f$ m = 0 \ldots n-1 \f$.  \n
+Размер вектора `[n x 1]`.  \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Необходимо учитывать, что при четном `n` функция использует 
+план `half` `n/2`-точечного БПФ структуры \ref fft_t, 
+план `n`-точечного БПФ структуры не изменяется. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на комплексный вектор результата БПФ \f$Y(k)\f$,
+\f$ k = 0 \ldots \lfloor n/2 \rfloor \f$. \n
+Размер вектора `[n/2+1 x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+ В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции `fft_r2c`:
+
+\include fft_r2c_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_r2c(double* x, int n, fft_t* pfft, complex_t* y)
+{
+    int err, n2;
+    fft_t h;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n<1)
+        return ERROR_SIZE;
+
+    if(n%2)
+    {
+        /* odd size: full complex FFT */
+        err = fft_create(pfft, n);
+        if(err != RES_OK)
+            return err;
+
+        re2cmplx(x, n, pfft->t1);
+        err = fft_krn(pfft->t1, pfft->t0, pfft);
+        if(err != RES_OK)
+            return err;
+        memcpy(y, pfft->t0, (n/2+1)*sizeof(complex_t));
+        return RES_OK;
+    }
+
+    /* half size plan, the n-points plan of the object is not changed */
+    n2 = n/2;
+    err = fft_create_half(pfft, n2, &h);
+    if(err != RES_OK)
+        return err;
+
+    /* z(m) = x(2m) + j x(2m+1) */
+    err = fft_krn_src((complex_t*)x, y, &h);
+    if(err != RES_OK)
+        return err;
+
+    fft_r2c_split(y, n2, h.plan->wr);
+    return RES_OK;
+}
+
+
+
+
+void fft_r2c_split(complex_t* y, int n2, complex_t* wr)
+{
+    int k;
+    complex_t e, o, b;
+
+    /* split Z(k) = E(k) + j O(k) into Y(k) = E(k) + W_n^k O(k) */
+    RE(y[n2]) = RE(y[0]) - IM(y[0]);
+    RE(y[0])  = RE(y[0]) + IM(y[0]);
+    IM(y[0])  = IM(y[n2]) = 0.0;
+
+    for(k = 1; k <= n2/2; k++)
+    {
+        RE(e) = 0.5 * (RE(y[k]) + RE(y[n2-k]));
+        IM(e) = 0.5 * (IM(y[k]) - IM(y[n2-k]));
+        RE(o) = 0.5 * (IM(y[k]) + IM(y[n2-k]));
+        IM(o) = 0.5 * (RE(y[n2-k]) - RE(y[k]));
+
+        RE(b) = CMRE(o, wr[k]);
+        IM(b) = CMIM(o, wr[k]);
+
+        RE(y[n2-k]) = RE(e) - RE(b);
+        IM(y[n2-k]) = IM(b) - IM(e);
+
+        RE(y[k]) = RE(e) + RE(b);
+        IM(y[k]) = IM(e) + IM(b);
+    }
+}
@@ -0,0 +1,74 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Select the instruction set of the FFT codelets.
+
+The function is the alias of the \ref dspl_set_isa function 
+and it is kept for compatibility. The `FFT_ISA_*` names are equal to 
+the `DSPL_ISA_*` names. The instruction set is common 
+for the FFT and for the filtering functions.
+
+\param[in]  isa
+Instruction set (see \ref dspl_set_isa). \n \n
+
+\return
+`RES_OK` if the instruction set is selected successfully. \n
+`ERROR_FFT_ISA` if the instruction set is not supported by the CPU. 
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Выбор набора инструкций ядер БПФ
+
+Функция является синонимом функции \ref dspl_set_isa
+и сохранена для совместимости. Имена `FFT_ISA_*` равны
+именам `DSPL_ISA_*`. Набор инструкций общий для БПФ 
+и для функций фильтрации.
+
+\param[in]  isa
+Набор инструкций (см. \ref dspl_set_isa). \n \n
+
+\return
+`RES_OK` если набор инструкций выбран успешно. \n
+`ERROR_FFT_ISA` если набор инструкций не поддерживается процессором. 
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_set_isa(int isa)
+{
+    return dspl_set_isa(isa);
+}
@@ -0,0 +1,153 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Set the number of threads of the FFT object.
+
+The function creates the pool of `nthreads - 1` worker threads
+of the `fft_t` object. The caller thread is also used by the FFT. \n
+FFT of the size \f$ n \geq 262144 \f$ is calculated by the pool threads:
+independent sub-FFTs of the plan stages, twiddle factors multiplication
+and the stage transposes are distributed between the threads.
+Smaller FFTs are calculated by the caller thread only. \n
+The batch FFT functions (see \ref fft_cmplx_batch and \ref fft_batch)
+distribute the groups of the transforms between the threads 
+if the total size of the batch is \f$ n \cdot cnt \geq 262144 \f$. \n
+The worker threads wait for the next FFT between the FFT calls
+and they are terminated by the \ref fft_free function
+or by the next `fft_set_threads` call. \n
+The FFT result does not depend on the number of threads.
+
+\param[in,out]  pfft
+Pointer to the `fft_t` object.  \n
+Pointer cannot be `NULL`.  \n
+The function can be called before or after the \ref fft_create
+or \ref fft_bind functions. \n \n
+
+\param[in]  nthreads
+Number of threads. \n
+`nthreads = 1` disables the multithreaded FFT (default). \n \n
+
+\return
+`RES_OK` if the number of threads is set successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+fft_t pfft = {0};
+int err;
+
+err = fft_set_threads(&pfft, 4);
+
+// 2^20-points FFT is calculated by 4 threads
+err = fft_cmplx(x, 1048576, &pfft, y);
+
+fft_free(&pfft);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Задание количества потоков объекта БПФ
+
+Функция создает пул из `nthreads - 1` рабочих потоков объекта `fft_t`.
+Вызывающий поток также используется для расчета БПФ. \n
+БПФ размера \f$ n \geq 262144 \f$ рассчитывается потоками пула:
+независимые БПФ этапов плана, умножение на поворотные коэффициенты
+и транспонирования этапов распределяются между потоками.
+БПФ меньшего размера рассчитываются только вызывающим потоком. \n
+Функции пакетного БПФ (см. \ref fft_cmplx_batch и \ref fft_batch)
+распределяют группы преобразований между потоками, 
+если общий размер пакета \f$ n \cdot cnt \geq 262144 \f$. \n
+Между вызовами БПФ рабочие потоки ожидают следующего БПФ
+и завершаются функцией \ref fft_free
+или следующим вызовом `fft_set_threads`. \n
+Результат БПФ не зависит от количества потоков.
+
+\param[in,out]  pfft
+Указатель на структуру `fft_t`.  \n
+Указатель не должен быть `NULL`.  \n
+Функция может быть вызвана как до, так и после функций
+\ref fft_create или \ref fft_bind. \n \n
+
+\param[in]  nthreads
+Количество потоков. \n
+`nthreads = 1` отключает многопоточный расчет БПФ (по умолчанию). \n \n
+
+\return
+`RES_OK` если количество потоков задано успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+fft_t pfft = {0};
+int err;
+
+err = fft_set_threads(&pfft, 4);
+
+// БПФ размера 2^20 рассчитывается четырьмя потоками
+err = fft_cmplx(x, 1048576, &pfft, y);
+
+fft_free(&pfft);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_set_threads(fft_t* pfft, int nthreads)
+{
+    if(!pfft)
+        return ERROR_PTR;
+    if(nthreads < 1)
+        return ERROR_ARG_PARAM;
+
+    if(pfft->pool)
+    {
+        fft_pool_free(pfft->pool);
+        pfft->pool = NULL;
+    }
+    pfft->nthreads = 1;
+
+    if(nthreads > 1)
+    {
+        pfft->pool = fft_pool_create(nthreads);
+        if(!pfft->pool)
+            return ERROR_MALLOC;
+    }
+    pfft->nthreads = nthreads;
+
+    /* Bluestein workspace of each thread */
+    return fft_workspace_tb(pfft);
+}
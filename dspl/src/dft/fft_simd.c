@@ -0,0 +1,313 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+#include "fft_bfgen.h"
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FFT_SIMD_X86
+#include <immintrin.h>
+#endif
+
+
+/* FFT instruction set selected by fft_set_isa */
+int fft_simd_isa = FFT_ISA_AUTO;
+
+
+
+#ifdef FFT_SIMD_X86
+
+#define FFT_CT              complex_t
+#define FFT_VKRN_T          fft_vkrn_t
+
+/* AVX two complex values p[0] and p[s] load and store */
+#define FFT_VLD2(p, s)                                                       \
+    _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd((double*)(p))), \
+                         _mm_loadu_pd((double*)((p)+(s))), 1)
+#define FFT_VST2(p, s, a)                                                    \
+    do{                                                                      \
+        _mm_storeu_pd((double*)(p),       _mm256_castpd256_pd128(a));        \
+        _mm_storeu_pd((double*)((p)+(s)), _mm256_extractf128_pd((a), 1));    \
+    }while(0)
+
+
+
+/*******************************************************************************
+SSE2 kernels: one complex value per vector
+*******************************************************************************/
+#define FFT_V               __m128d
+#define FFT_VN              1
+#define FFT_TARGET          __attribute__((target("sse2")))
+#define FFT_SFX(f)          f##_sse2
+#define FFT_VLD(p)          _mm_loadu_pd((double*)(p))
+#define FFT_VST(p, a)       _mm_storeu_pd((double*)(p), (a))
+#define FFT_VLDS(p, s)      FFT_VLD(p)
+#define FFT_VSTS(p, s, a)   FFT_VST(p, a)
+#define FFT_VADD(a, b)      _mm_add_pd((a), (b))
+#define FFT_VSUB(a, b)      _mm_sub_pd((a), (b))
+#define FFT_VSCL(a, r)      _mm_mul_pd((a), _mm_set1_pd(r))
+#define FFT_VMULNJ(a)       _mm_xor_pd(_mm_shuffle_pd((a), (a), 1),          \
+                                       _mm_set_pd(-0.0, 0.0))
+#define FFT_VCMUL(a, w)                                                      \
+    _mm_add_pd(_mm_mul_pd((a), _mm_unpacklo_pd((w), (w))),                   \
+               _mm_xor_pd(_mm_mul_pd(_mm_shuffle_pd((a), (a), 1),            \
+                                     _mm_unpackhi_pd((w), (w))),             \
+                          _mm_set_pd(0.0, -0.0)))
+
+#include "fft_simd_krn.h"
+
+#undef FFT_V
+#undef FFT_VN
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VLD
+#undef FFT_VST
+#undef FFT_VLDS
+#undef FFT_VSTS
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+#undef FFT_VCMUL
+
+
+
+/*******************************************************************************
+AVX2 and FMA kernels: two complex values per vector
+*******************************************************************************/
+#define FFT_V               __m256d
+#define FFT_VN              2
+#define FFT_TARGET          __attribute__((target("avx2,fma")))
+#define FFT_SFX(f)          f##_avx2
+#define FFT_VLD(p)          _mm256_loadu_pd((double*)(p))
+#define FFT_VST(p, a)       _mm256_storeu_pd((double*)(p), (a))
+#define FFT_VLDS(p, s)      FFT_VLD2(p, s)
+#define FFT_VSTS(p, s, a)   FFT_VST2(p, s, a)
+#define FFT_VADD(a, b)      _mm256_add_pd((a), (b))
+#define FFT_VSUB(a, b)      _mm256_sub_pd((a), (b))
+#define FFT_VSCL(a, r)      _mm256_mul_pd((a), _mm256_set1_pd(r))
+#define FFT_VMULNJ(a)       _mm256_xor_pd(_mm256_permute_pd((a), 0x5),      \
+                                         _mm256_set_pd(-0.0, 0.0, -0.0, 0.0))
+#define FFT_VCMUL(a, w)                                                      \
+    _mm256_fmaddsub_pd((a), _mm256_movedup_pd(w),                            \
+                       _mm256_mul_pd(_mm256_permute_pd((a), 0x5),            \
+                                     _mm256_permute_pd((w), 0xF)))
+
+#include "fft_simd_krn.h"
+
+#undef FFT_V
+#undef FFT_VN
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VLD
+#undef FFT_VST
+#undef FFT_VLDS
+#undef FFT_VSTS
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+#undef FFT_VCMUL
+
+
+
+/*******************************************************************************
+AVX-512 kernels: four complex values per vector
+*******************************************************************************/
+#define FFT_V               __m512d
+#define FFT_VN              4
+#define FFT_TARGET          __attribute__((target("avx512f,avx2,fma")))
+#define FFT_SFX(f)          f##_avx512
+#define FFT_VLD(p)          _mm512_loadu_pd((double*)(p))
+#define FFT_VST(p, a)       _mm512_storeu_pd((double*)(p), (a))
+#define FFT_VLDS(p, s)                                                       \
+    _mm512_insertf64x4(_mm512_castpd256_pd512(FFT_VLD2((p), (s))),          \
+                       FFT_VLD2((p)+2*(s), (s)), 1)
+#define FFT_VSTS(p, s, a)                                                    \
+    do{                                                                      \
+        __m256d lo_ = _mm512_castpd512_pd256(a);                             \
+        __m256d hi_ = _mm512_extractf64x4_pd((a), 1);                        \
+        FFT_VST2((p), (s), lo_);                                            \
+        FFT_VST2((p)+2*(s), (s), hi_);                                      \
+    }while(0)
+#define FFT_VADD(a, b)      _mm512_add_pd((a), (b))
+#define FFT_VSUB(a, b)      _mm512_sub_pd((a), (b))
+#define FFT_VSCL(a, r)      _mm512_mul_pd((a), _mm512_set1_pd(r))
+#define FFT_VMULNJ(a)                                                        \
+    _mm512_castsi512_pd(_mm512_xor_si512(                                    \
+        _mm512_castpd_si512(_mm512_permute_pd((a), 0x55)),                   \
+        _mm512_castpd_si512(_mm512_set_pd(-0.0, 0.0, -0.0, 0.0,              \
+                                          -0.0, 0.0, -0.0, 0.0))))
+#define FFT_VCMUL(a, w)                                                      \
+    _mm512_fmaddsub_pd((a), _mm512_movedup_pd(w),                            \
+                       _mm512_mul_pd(_mm512_permute_pd((a), 0x55),           \
+                                     _mm512_permute_pd((w), 0xFF)))
+
+#include "fft_simd_krn.h"
+
+#undef FFT_V
+#undef FFT_VN
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VLD
+#undef FFT_VST
+#undef FFT_VLDS
+#undef FFT_VSTS
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+#undef FFT_VCMUL
+#undef FFT_VLD2
+#undef FFT_VST2
+#undef FFT_CT
+#undef FFT_VKRN_T
+
+#endif /* FFT_SIMD_X86 */
+
+
+
+
+int fft_simd_support(int isa)
+{
+    if(isa == FFT_ISA_SCALAR)
+        return 1;
+#ifdef FFT_SIMD_X86
+    __builtin_cpu_init();
+    switch(isa)
+    {
+        case FFT_ISA_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case FFT_ISA_AVX2:
+            return __builtin_cpu_supports("avx2") &&
+                   __builtin_cpu_supports("fma");
+        case FFT_ISA_AVX512:
+            return __builtin_cpu_supports("avx512f") &&
+                   __builtin_cpu_supports("avx2")    &&
+                   __builtin_cpu_supports("fma");
+        default:
+            return 0;
+    }
+#else
+    return 0;
+#endif
+}
+
+
+
+
+int fft_simd_best(void)
+{
+    int isa;
+    for(isa = FFT_ISA_AVX512; isa > FFT_ISA_SCALAR; isa--)
+        if(fft_simd_support(isa))
+            return isa;
+    return FFT_ISA_SCALAR;
+}
+
+
+
+
+int fft_simd_radix(int n1)
+{
+    switch(n1)
+    {
+        case  2:
+        case  3:
+        case  4:
+        case  5:
+        case  7:
+        case  8:
+        case 16: return 1;
+#define FFT_SIMD_RADIX_CASE(R)  case R: return 1;
+        FFT_BFGEN_LIST(FFT_SIMD_RADIX_CASE)
+#undef FFT_SIMD_RADIX_CASE
+        default: return 0;
+    }
+}
+
+
+
+
+/*******************************************************************************
+Kernels of the isa instruction set and of the narrower instruction sets
+which process the tail vectors. Function returns the number of kernels.
+*******************************************************************************/
+int fft_simd_chain(int isa, int r, int row, fft_vkrn_t* krn)
+{
+    int k = 0;
+#ifdef FFT_SIMD_X86
+    if(isa >= FFT_ISA_AVX512)
+        krn[k++] = fft_vkrn_avx512(r, row);
+    if(isa >= FFT_ISA_AVX2)
+        krn[k++] = fft_vkrn_avx2(r, row);
+    if(isa >= FFT_ISA_SSE2)
+        krn[k++] = fft_vkrn_sse2(r, row);
+#endif
+    return k;
+}
+
+
+
+
+void fft_codelet_vcol(complex_t* x, complex_t* y, int cnt,
+                      fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    fft_vkrn_t krn[3];
+    complex_t* w = p->w + s->addr;
+    int b, i, v, nk;
+
+    nk = fft_simd_chain(p->isa, s->n1, 0, krn);
+    for(b = 0; b < cnt; b++)
+    {
+        v = 0;
+        for(i = 0; i < nk; i++)
+            v = krn[i](x, y, w, v, s->n2, s->n2);
+        x += s->n;
+        y += s->n;
+    }
+}
+
+
+
+
+void fft_codelet_vrow(complex_t* x, complex_t* y, int cnt,
+                      fft_plan_t* p, fft_stage_t* s, complex_t* tb)
+{
+    fft_vkrn_t krn[3];
+    int i, v, nk;
+
+    /* one block DFT by the scalar codelet */
+    if(cnt < 2)
+    {
+        fft_codelet(s->n1)(x, y, cnt, p, s, tb);
+        return;
+    }
+    nk = fft_simd_chain(p->isa, s->n1, 1, krn);
+    v = 0;
+    for(i = 0; i < nk; i++)
+        v = krn[i](x, y, NULL, v, cnt, s->n1);
+}
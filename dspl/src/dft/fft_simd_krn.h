@@ -0,0 +1,312 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*******************************************************************************
+FFT vector kernels.
+
+The file is included by fft_simd.c (double precision) and fftf_simd.c
+(single precision) once for each instruction set.
+Before the include the following macros must be defined:
+FFT_CT         complex data type (complex_t or complexf_t)
+FFT_VKRN_T     kernel pointer type (fft_vkrn_t or fftf_vkrn_t)
+FFT_V          vector type of FFT_VN complex values
+FFT_VN         number of complex values in the vector
+FFT_TARGET     function target attribute
+FFT_SFX(f)     function name with the instruction set suffix
+FFT_VLD(p)     load FFT_VN complex values from p
+FFT_VST(p, a)  store vector a to p
+FFT_VLDS(p, s) load FFT_VN complex values p[0], p[s], p[2s] ...
+FFT_VSTS(p, s, a) store vector a to p[0], p[s], p[2s] ...
+FFT_VADD, FFT_VSUB  complex addition and subtraction
+FFT_VSCL(a, r) multiplication by the real constant r
+FFT_VMULNJ(a)  multiplication by -j
+FFT_VCMUL(a, w) complex multiplication
+
+The butterflies of the other radixes are generated by fft_bfgen.py
+to fft_bfgen.h.
+*******************************************************************************/
+
+
+
+/* a * (c - j*s) */
+static inline FFT_TARGET FFT_V FFT_SFX(fft_vrot)(FFT_V a, double c, double s)
+{
+    return FFT_VADD(FFT_VSCL(a, c), FFT_VSCL(FFT_VMULNJ(a), s));
+}
+
+
+
+/* 2 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf2)(FFT_V* a)
+{
+    FFT_V t = a[0];
+    a[0] = FFT_VADD(t, a[1]);
+    a[1] = FFT_VSUB(t, a[1]);
+}
+
+
+
+/* 3 points DFT (Winograd algorithm) */
+static inline FFT_TARGET void FFT_SFX(fft_bf3)(FFT_V* a)
+{
+    FFT_V s, d, t;
+
+    s = FFT_VADD(a[1], a[2]);
+    d = FFT_VSCL(FFT_VMULNJ(FFT_VSUB(a[1], a[2])), DFT3_W);
+    t = FFT_VSUB(a[0], FFT_VSCL(s, 0.5));
+
+    a[0] = FFT_VADD(a[0], s);
+    a[1] = FFT_VADD(t, d);
+    a[2] = FFT_VSUB(t, d);
+}
+
+
+
+/* 4 points DFT of a[0], a[q], a[2q], a[3q] (in place) */
+static inline FFT_TARGET void FFT_SFX(fft_bf4q)(FFT_V* a, int q)
+{
+    FFT_V s0, d0, s1, d1;
+
+    s0 = FFT_VADD(a[0], a[2*q]);
+    d0 = FFT_VSUB(a[0], a[2*q]);
+    s1 = FFT_VADD(a[q], a[3*q]);
+    d1 = FFT_VMULNJ(FFT_VSUB(a[q], a[3*q]));
+
+    a[0]   = FFT_VADD(s0, s1);
+    a[q]   = FFT_VADD(d0, d1);
+    a[2*q] = FFT_VSUB(s0, s1);
+    a[3*q] = FFT_VSUB(d0, d1);
+}
+
+
+
+/* 4 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf4)(FFT_V* a)
+{
+    FFT_SFX(fft_bf4q)(a, 1);
+}
+
+
+
+/* 5 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf5)(FFT_V* a)
+{
+    FFT_V s1, s2, d1, d2, t1, t2, u1, u2;
+
+    s1 = FFT_VADD(a[1], a[4]);
+    d1 = FFT_VMULNJ(FFT_VSUB(a[1], a[4]));
+    s2 = FFT_VADD(a[2], a[3]);
+    d2 = FFT_VMULNJ(FFT_VSUB(a[2], a[3]));
+
+    t1 = FFT_VADD(a[0], FFT_VADD(FFT_VSCL(s1, DFT5_C1), FFT_VSCL(s2, DFT5_C2)));
+    t2 = FFT_VADD(a[0], FFT_VADD(FFT_VSCL(s1, DFT5_C2), FFT_VSCL(s2, DFT5_C1)));
+    u1 = FFT_VADD(FFT_VSCL(d1, DFT5_S1), FFT_VSCL(d2, DFT5_S2));
+    u2 = FFT_VSUB(FFT_VSCL(d1, DFT5_S2), FFT_VSCL(d2, DFT5_S1));
+
+    a[0] = FFT_VADD(a[0], FFT_VADD(s1, s2));
+    a[1] = FFT_VADD(t1, u1);
+    a[4] = FFT_VSUB(t1, u1);
+    a[2] = FFT_VADD(t2, u2);
+    a[3] = FFT_VSUB(t2, u2);
+}
+
+
+
+/* 7 points DFT */
+static inline FFT_TARGET void FFT_SFX(fft_bf7)(FFT_V* a)
+{
+    FFT_V s1, s2, s3, d1, d2, d3, t, u;
+    FFT_V y[7];
+
+    s1 = FFT_VADD(a[1], a[6]);
+    d1 = FFT_VMULNJ(FFT_VSUB(a[1], a[6]));
+    s2 = FFT_VADD(a[2], a[5]);
+    d2 = FFT_VMULNJ(FFT_VSUB(a[2], a[5]));
+    s3 = FFT_VADD(a[3], a[4]);
+    d3 = FFT_VMULNJ(FFT_VSUB(a[3], a[4]));
+
+    y[0] = FFT_VADD(a[0], FFT_VADD(s1, FFT_VADD(s2, s3)));
+
+    t = FFT_VADD(a[0], FFT_VADD(FFT_VSCL(s1, DFT7_C1),
+        FFT_VADD(FFT_VSCL(s2, DFT7_C2), FFT_VSCL(s3, DFT7_C3))));
+    u = FFT_VADD(FFT_VSCL(d1, DFT7_S1),
+        FFT_VADD(FFT_VSCL(d2, DFT7_S2), FFT_VSCL(d3, DFT7_S3)));
+    y[1] = FFT_VADD(t, u);
+    y[6] = FFT_VSUB(t, u);
+
+    t = FFT_VADD(a[0], FFT_VADD(FFT_VSCL(s1, DFT7_C2),
+        FFT_VADD(FFT_VSCL(s2, DFT7_C3), FFT_VSCL(s3, DFT7_C1))));
+    u = FFT_VSUB(FFT_VSCL(d1, DFT7_S2),
+        FFT_VADD(FFT_VSCL(d2, DFT7_S3), FFT_VSCL(d3, DFT7_S1)));
+    y[2] = FFT_VADD(t, u);
+    y[5] = FFT_VSUB(t, u);
+
+    t = FFT_VADD(a[0], FFT_VADD(FFT_VSCL(s1, DFT7_C3),
+        FFT_VADD(FFT_VSCL(s2, DFT7_C1), FFT_VSCL(s3, DFT7_C2))));
+    u = FFT_VADD(FFT_VSUB(FFT_VSCL(d1, DFT7_S3), FFT_VSCL(d2, DFT7_S1)),
+        FFT_VSCL(d3, DFT7_S2));
+    y[3] = FFT_VADD(t, u);
+    y[4] = FFT_VSUB(t, u);
+
+    a[0] = y[0]; a[1] = y[1]; a[2] = y[2]; a[3] = y[3];
+    a[4] = y[4]; a[5] = y[5]; a[6] = y[6];
+}
+
+
+
+/* 8 points DFT (radix-2 of two 4 points DFTs) */
+static inline FFT_TARGET void FFT_SFX(fft_bf8)(FFT_V* a)
+{
+    FFT_V e, o;
+    FFT_V y[8];
+    int k;
+
+    FFT_SFX(fft_bf4q)(a,   2);
+    FFT_SFX(fft_bf4q)(a+1, 2);
+
+    a[3] = FFT_SFX(fft_vrot)(a[3],  DFT8_W, DFT8_W);
+    a[5] = FFT_VMULNJ(a[5]);
+    a[7] = FFT_SFX(fft_vrot)(a[7], -DFT8_W, DFT8_W);
+
+    for(k = 0; k < 4; k++)
+    {
+        e = a[2*k];
+        o = a[2*k+1];
+        y[k]   = FFT_VADD(e, o);
+        y[k+4] = FFT_VSUB(e, o);
+    }
+    for(k = 0; k < 8; k++)
+        a[k] = y[k];
+}
+
+
+
+/* 16 points DFT (4 x 4 points DFTs) */
+static inline FFT_TARGET void FFT_SFX(fft_bf16)(FFT_V* a)
+{
+    FFT_V y[16];
+    int k;
+
+    /* 4 points DFTs of a[i + 4m], m = 0..3 */
+    for(k = 0; k < 4; k++)
+        FFT_SFX(fft_bf4q)(a + k, 4);
+
+    /* twiddle factors W_16^(i*m) */
+    a[ 5] = FFT_SFX(fft_vrot)(a[ 5],  DFT16_W1, DFT16_W2);
+    a[ 9] = FFT_SFX(fft_vrot)(a[ 9],  DFT16_W3, DFT16_W3);
+    a[13] = FFT_SFX(fft_vrot)(a[13],  DFT16_W2, DFT16_W1);
+    a[ 6] = FFT_SFX(fft_vrot)(a[ 6],  DFT16_W3, DFT16_W3);
+    a[10] = FFT_VMULNJ(a[10]);
+    a[14] = FFT_SFX(fft_vrot)(a[14], -DFT16_W3, DFT16_W3);
+    a[ 7] = FFT_SFX(fft_vrot)(a[ 7],  DFT16_W2, DFT16_W1);
+    a[11] = FFT_SFX(fft_vrot)(a[11], -DFT16_W3, DFT16_W3);
+    a[15] = FFT_SFX(fft_vrot)(a[15], -DFT16_W1, -DFT16_W2);
+
+    /* 4 points DFTs of the rows and output transpose */
+    for(k = 0; k < 4; k++)
+        FFT_SFX(fft_bf4q)(a + 4*k, 1);
+    for(k = 0; k < 16; k++)
+        y[(k>>2) + 4*(k&3)] = a[k];
+    for(k = 0; k < 16; k++)
+        a[k] = y[k];
+}
+
+
+
+/* generated butterflies */
+#include "fft_bfgen.h"
+
+
+
+/*******************************************************************************
+Column kernel: DFTs of the vectors x[v + k*s], k = 0 ... R-1
+for v = v0 ... nv-1 with the output twiddle factors
+y[v + k*s] = DFT(k) * w[v + k*s].
+Function processes the vectors while v + FFT_VN <= nv and
+returns the first unprocessed v.
+
+Row kernel: DFTs of the R-points blocks x[v*R + k], k = 0 ... R-1
+for v = v0 ... nv-1 without twiddle factors.
+*******************************************************************************/
+#define FFT_VKRN(R)                                                           \
+static FFT_TARGET int FFT_SFX(fft_vcol##R)(FFT_CT* x, FFT_CT* y,              \
+                                         FFT_CT* w, int v, int nv, int s)     \
+{                                                                             \
+    FFT_V a[R];                                                               \
+    int k;                                                                    \
+    for(; v + FFT_VN <= nv; v += FFT_VN)                                      \
+    {                                                                         \
+        for(k = 0; k < R; k++)                                                \
+            a[k] = FFT_VLD(x + v + k*s);                                      \
+        FFT_SFX(fft_bf##R)(a);                                                \
+        FFT_VST(y + v, a[0]);                                                 \
+        for(k = 1; k < R; k++)                                                \
+            FFT_VST(y + v + k*s, FFT_VCMUL(a[k], FFT_VLD(w + v + k*s)));      \
+    }                                                                         \
+    return v;                                                                 \
+}                                                                             \
+static FFT_TARGET int FFT_SFX(fft_vrow##R)(FFT_CT* x, FFT_CT* y,              \
+                                         FFT_CT* w, int v, int nv, int s)     \
+{                                                                             \
+    FFT_V a[R];                                                               \
+    int k;                                                                    \
+    for(; v + FFT_VN <= nv; v += FFT_VN)                                      \
+    {                                                                         \
+        for(k = 0; k < R; k++)                                                \
+            a[k] = FFT_VLDS(x + v*R + k, R);                                  \
+        FFT_SFX(fft_bf##R)(a);                                                \
+        for(k = 0; k < R; k++)                                                \
+            FFT_VSTS(y + v*R + k, R, a[k]);                                   \
+    }                                                                         \
+    return v;                                                                 \
+}
+
+FFT_VKRN(2)
+FFT_VKRN(3)
+FFT_VKRN(4)
+FFT_VKRN(5)
+FFT_VKRN(7)
+FFT_VKRN(8)
+FFT_VKRN(16)
+FFT_BFGEN_LIST(FFT_VKRN)
+
+#undef FFT_VKRN
+
+
+
+/* column (row = 0) or row (row = 1) kernel of the R-points DFT */
+static FFT_VKRN_T FFT_SFX(fft_vkrn)(int r, int row)
+{
+    switch(r)
+    {
+        case  2: return row ? FFT_SFX(fft_vrow2)  : FFT_SFX(fft_vcol2);
+        case  3: return row ? FFT_SFX(fft_vrow3)  : FFT_SFX(fft_vcol3);
+        case  4: return row ? FFT_SFX(fft_vrow4)  : FFT_SFX(fft_vcol4);
+        case  5: return row ? FFT_SFX(fft_vrow5)  : FFT_SFX(fft_vcol5);
+        case  7: return row ? FFT_SFX(fft_vrow7)  : FFT_SFX(fft_vcol7);
+        case  8: return row ? FFT_SFX(fft_vrow8)  : FFT_SFX(fft_vcol8);
+        case 16: return row ? FFT_SFX(fft_vrow16) : FFT_SFX(fft_vcol16);
+#define FFT_VKRN_CASE(R)                                                      \
+        case R:  return row ? FFT_SFX(fft_vrow##R) : FFT_SFX(fft_vcol##R);
+        FFT_BFGEN_LIST(FFT_VKRN_CASE)
+#undef FFT_VKRN_CASE
+        default: return NULL;
+    }
+}
@@ -0,0 +1,643 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+/* Number of rows of the transpose tile */
+#define FFT_TILE    16
+
+
+/* Worker thread task: the range k0 ... k1-1 of the parallel loop */
+typedef struct fft_task_s fft_task_t;
+struct fft_task_s
+{
+    void          (*fn)(fft_task_t* t);
+    complex_t*    t0;       /* source vector                            */
+    complex_t*    t1;       /* destination vector                       */
+    complex_t*    tb;       /* Bluestein workspace of all threads       */
+    fft_plan_t*   p;        /* FFT plan                                 */
+    fft_stage_t*  s;        /* schedule stage                           */
+    int           k0;       /* first index of the task                  */
+    int           k1;       /* last index of the task plus one          */
+    int           id;       /* thread index (0 is the caller thread)    */
+    fft_pool_t*   pool;     /* threads pool                             */
+    complex_t*    x;        /* strided lines input                      */
+    complex_t*    y;        /* strided lines output                     */
+    int           stride;   /* distance between the line samples        */
+    int           dist;     /* distance between the lines               */
+    int           ystride;  /* distance between the output line samples */
+    int           ydist;    /* distance between the output lines        */
+    int           g;        /* lines group size                         */
+    int           cnt;      /* number of lines                          */
+    fft_range_t   fb;       /* parallel loop range function             */
+    void*         arg;      /* parallel loop range function argument    */
+};
+
+
+/* Worker threads pool.
+   Thread 0 is the caller thread, threads 1 ... nth-1 wait for
+   the next generation gen of the tasks */
+struct fft_pool_s
+{
+    pthread_mutex_t mtx;
+    pthread_cond_t  go;     /* new tasks signal                         */
+    pthread_cond_t  done;   /* all tasks are finished signal            */
+    pthread_t*      th;     /* worker threads 1 ... nth-1               */
+    fft_task_t*     task;   /* tasks of the nth threads                 */
+    int             nth;    /* number of threads including the caller   */
+    int             gen;    /* tasks generation                         */
+    int             busy;   /* number of the worker threads in progress */
+    int             quit;   /* pool termination flag                    */
+};
+
+
+
+
+static void* fft_pool_worker(void* arg)
+{
+    fft_task_t* t = (fft_task_t*)arg;
+    fft_pool_t* pool = t->pool;
+    int gen = 0;
+
+    for(;;)
+    {
+        pthread_mutex_lock(&pool->mtx);
+        while(pool->gen == gen && !pool->quit)
+            pthread_cond_wait(&pool->go, &pool->mtx);
+        if(pool->quit)
+        {
+            pthread_mutex_unlock(&pool->mtx);
+            return NULL;
+        }
+        gen = pool->gen;
+        pthread_mutex_unlock(&pool->mtx);
+
+        if(t->k0 < t->k1)
+            t->fn(t);
+
+        pthread_mutex_lock(&pool->mtx);
+        if(--pool->busy == 0)
+            pthread_cond_signal(&pool->done);
+        pthread_mutex_unlock(&pool->mtx);
+    }
+}
+
+
+
+
+fft_pool_t* fft_pool_create(int nth)
+{
+    fft_pool_t* pool;
+    int k;
+
+    pool = (fft_pool_t*) malloc(sizeof(fft_pool_t));
+    if(!pool)
+        return NULL;
+    memset(pool, 0, sizeof(fft_pool_t));
+    pool->th   = (pthread_t*)  malloc(nth * sizeof(pthread_t));
+    pool->task = (fft_task_t*) malloc(nth * sizeof(fft_task_t));
+    if(!pool->th || !pool->task)
+        goto error_proc;
+    memset(pool->task, 0, nth * sizeof(fft_task_t));
+
+    pthread_mutex_init(&pool->mtx, NULL);
+    pthread_cond_init(&pool->go, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    pool->nth = 1;
+    for(k = 1; k < nth; k++)
+    {
+        pool->task[k].pool = pool;
+        pool->task[k].id   = k;
+        if(pthread_create(pool->th + k, NULL, fft_pool_worker, pool->task + k))
+        {
+            fft_pool_free(pool);
+            return NULL;
+        }
+        pool->nth++;
+    }
+    pool->task[0].pool = pool;
+    return pool;
+
+error_proc:
+    if(pool->th)
+        free(pool->th);
+    if(pool->task)
+        free(pool->task);
+    free(pool);
+    return NULL;
+}
+
+
+
+
+void fft_pool_free(fft_pool_t* pool)
+{
+    int k;
+    if(!pool)
+        return;
+
+    pthread_mutex_lock(&pool->mtx);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->go);
+    pthread_mutex_unlock(&pool->mtx);
+    for(k = 1; k < pool->nth; k++)
+        pthread_join(pool->th[k], NULL);
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->go);
+    pthread_mutex_destroy(&pool->mtx);
+    free(pool->th);
+    free(pool->task);
+    free(pool);
+}
+
+
+
+
+/*******************************************************************************
+Parallel loop of cnt iterations.
+The iterations are split between the pool threads by ranges
+which are multiples of align. The caller thread executes the range 0.
+*******************************************************************************/
+static void fft_pool_run(fft_pool_t* pool, fft_task_t* task, 
+                         int cnt, int align)
+{
+    fft_task_t* t;
+    int k, step;
+
+    step = (cnt + pool->nth - 1) / pool->nth;
+    step = ((step + align - 1) / align) * align;
+    for(k = 0; k < pool->nth; k++)
+    {
+        t = pool->task + k;
+        t->fn = task->fn;
+        t->t0 = task->t0;
+        t->t1 = task->t1;
+        t->tb = task->tb;
+        t->p  = task->p;
+        t->s  = task->s;
+        t->x  = task->x;
+        t->y  = task->y;
+        t->stride = task->stride;
+        t->dist   = task->dist;
+        t->ystride = task->ystride;
+        t->ydist   = task->ydist;
+        t->g      = task->g;
+        t->cnt    = task->cnt;
+        t->fb     = task->fb;
+        t->arg    = task->arg;
+        t->k0 = k*step < cnt ? k*step : cnt;
+        t->k1 = t->k0 + step < cnt ? t->k0 + step : cnt;
+    }
+
+    pthread_mutex_lock(&pool->mtx);
+    pool->busy = pool->nth - 1;
+    pool->gen++;
+    pthread_cond_broadcast(&pool->go);
+    pthread_mutex_unlock(&pool->mtx);
+
+    t = pool->task;
+    if(t->k0 < t->k1)
+        t->fn(t);
+
+    pthread_mutex_lock(&pool->mtx);
+    while(pool->busy)
+        pthread_cond_wait(&pool->done, &pool->mtx);
+    pthread_mutex_unlock(&pool->mtx);
+}
+
+
+
+
+/* Bluestein workspace of the task thread */
+static complex_t* fft_task_tb(fft_task_t* t)
+{
+    return t->tb ? t->tb + 2 * t->id * t->p->nb : NULL;
+}
+
+
+
+
+/* Independent blocks k0 ... k1-1 of the stage s */
+static void fft_task_blocks(fft_task_t* t)
+{
+    int n = t->s->n;
+    fft_run(t->t0 + t->k0*n, t->t1 + t->k0*n, t->p, t->s,
+            fft_task_tb(t), t->k1 - t->k0);
+}
+
+
+
+
+/* Output rows q = b*n2 + i of the blocks transpose t1 = t0^T */
+static void fft_task_transpose(fft_task_t* t)
+{
+    int n1 = t->s->n1;
+    int n2 = t->s->n2;
+    int n  = t->s->n;
+    int q, r, i, j, i1, b;
+    complex_t *x, *y;
+
+    for(q = t->k0; q < t->k1; q = i1 + b*n2)
+    {
+        b  = q / n2;
+        i  = q % n2;
+        i1 = i + FFT_TILE;
+        if(i1 > n2)
+            i1 = n2;
+        if(i1 > t->k1 - b*n2)
+            i1 = t->k1 - b*n2;
+        x = t->t0 + b*n;
+        y = t->t1 + b*n;
+        for(j = 0; j < n1; j++)
+        {
+            for(r = i; r < i1; r++)
+            {
+                RE(y[r*n1 + j]) = RE(x[j*n2 + r]);
+                IM(y[r*n1 + j]) = IM(x[j*n2 + r]);
+            }
+        }
+    }
+}
+
+
+
+
+/* n1-points codelets of the rows q = b*n2 + i */
+static void fft_task_codelet(fft_task_t* t)
+{
+    int n1 = t->s->n1;
+    t->s->fn(t->t0 + t->k0*n1, t->t1 + t->k0*n1, t->k1 - t->k0,
+             t->p, t->s, fft_task_tb(t));
+}
+
+
+
+
+/* Twiddle factors multiplication with transpose of the rows q = b*n2 + i */
+static void fft_task_twiddle(fft_task_t* t)
+{
+    int n1 = t->s->n1;
+    int n2 = t->s->n2;
+    int n  = t->s->n;
+    complex_t* w = t->p->w + t->s->addr;
+    complex_t *x, *y;
+    int q, i, j, m, b;
+
+    for(q = t->k0; q < t->k1; q++)
+    {
+        b = q / n2;
+        i = q % n2;
+        x = t->t0 + q*n1;
+        y = t->t1 + b*n + i;
+        m = i*n1;
+        for(j = 0; j < n1; j++)
+        {
+            RE(y[j*n2]) = CMRE(x[j], w[m+j]);
+            IM(y[j*n2]) = CMIM(x[j], w[m+j]);
+        }
+    }
+}
+
+
+
+
+/* Vector codelet columns q = b*n2 + i */
+static void fft_task_vcol(fft_task_t* t)
+{
+    fft_vkrn_t krn[3];
+    complex_t* w = t->p->w + t->s->addr;
+    int n2 = t->s->n2;
+    int n  = t->s->n;
+    int q, b, i0, i1, v, k, nk;
+
+    nk = fft_simd_chain(t->p->isa, t->s->n1, 0, krn);
+    for(q = t->k0; q < t->k1; q = b*n2 + i1)
+    {
+        b  = q / n2;
+        i0 = q % n2;
+        i1 = t->k1 - b*n2 < n2 ? t->k1 - b*n2 : n2;
+        v  = i0;
+        for(k = 0; k < nk; k++)
+            v = krn[k](t->t0 + b*n, t->t1 + b*n, w, v, i1, n2);
+    }
+}
+
+
+
+
+/*******************************************************************************
+Multithreaded FFT schedule execution.
+Independent blocks are distributed between the threads.
+If the number of blocks is less than the number of threads then
+the stage transposes, codelets and twiddle factors multiplication
+are executed by the parallel loops over the stage rows of all blocks.
+*******************************************************************************/
+void fft_run_mt(complex_t* t0, complex_t* t1, fft_plan_t* p,
+                fft_stage_t* s, complex_t* tb, int cnt, fft_pool_t* pool)
+{
+    fft_task_t task;
+    int k, nr;
+
+    if(!pool || pool->nth < 2)
+    {
+        fft_run(t0, t1, p, s, tb, cnt);
+        return;
+    }
+
+    memset(&task, 0, sizeof(fft_task_t));
+    task.p  = p;
+    task.s  = s;
+    task.tb = tb;
+
+    /* Bluestein blocks with the multithreaded nb-points FFT */
+    if(s->flat && s->fn == fft_codelet_bluestein && cnt < pool->nth)
+    {
+        for(k = 0; k < cnt; k++)
+            fft_bluestein(t0 + k*s->n, t1 + k*s->n, p, s, tb, pool);
+        return;
+    }
+
+    if(s->flat || cnt >= pool->nth)
+    {
+        if(cnt < 2)
+        {
+            fft_run(t0, t1, p, s, tb, cnt);
+            return;
+        }
+        task.fn = fft_task_blocks;
+        task.t0 = t0;
+        task.t1 = t1;
+        fft_pool_run(pool, &task, cnt, 1);
+        return;
+    }
+
+    /* rows of all blocks of the stage */
+    nr = cnt * s->n2;
+    if(s->vec)
+    {
+        task.fn = fft_task_vcol;
+        task.t0 = t0;
+        task.t1 = t1;
+        fft_pool_run(pool, &task, nr, FFT_TILE);
+    }
+    else
+    {
+        task.fn = fft_task_transpose;
+        task.t0 = t0;
+        task.t1 = t1;
+        fft_pool_run(pool, &task, nr, FFT_TILE);
+
+        task.fn = fft_task_codelet;
+        task.t0 = t1;
+        task.t1 = t0;
+        fft_pool_run(pool, &task, nr, 1);
+
+        task.fn = fft_task_twiddle;
+        task.t0 = t0;
+        task.t1 = t1;
+        fft_pool_run(pool, &task, nr, FFT_TILE);
+    }
+
+    fft_run_mt(t1, t0, p, s+1, tb, cnt * s->n1, pool);
+
+    task.fn = fft_task_transpose;
+    task.t0 = t0;
+    task.t1 = t1;
+    fft_pool_run(pool, &task, nr, FFT_TILE);
+}
+
+
+
+
+void fft_vcol_mt(complex_t* x, complex_t* y, fft_plan_t* p,
+                 fft_stage_t* s, fft_pool_t* pool)
+{
+    fft_task_t task;
+
+    if(!pool || pool->nth < 2)
+    {
+        s->fn(x, y, 1, p, s, NULL);
+        return;
+    }
+    memset(&task, 0, sizeof(fft_task_t));
+    task.fn = fft_task_vcol;
+    task.t0 = x;
+    task.t1 = y;
+    task.p  = p;
+    task.s  = s;
+    fft_pool_run(pool, &task, s->n2, FFT_TILE);
+}
+
+
+
+
+void fft_transpose_mt(complex_t* x, complex_t* y, fft_plan_t* p,
+                      fft_stage_t* s, fft_pool_t* pool)
+{
+    fft_task_t task;
+
+    if(!pool || pool->nth < 2)
+    {
+        matrix_transpose_cmplx(x, s->n2, s->n1, y);
+        return;
+    }
+    memset(&task, 0, sizeof(fft_task_t));
+    task.fn = fft_task_transpose;
+    task.t0 = x;
+    task.t1 = y;
+    task.p  = p;
+    task.s  = s;
+    fft_pool_run(pool, &task, s->n2, FFT_TILE);
+}
+
+
+
+
+/* Strided lines groups k0 ... k1-1: gather, FFT and scatter */
+static void fft_task_lines(fft_task_t* t)
+{
+    int n = t->p->n;
+    int q, b, g, m, k;
+    complex_t *t0, *t1, *px, *py;
+
+    t0 = t->t0 + t->id * t->g * n;
+    t1 = t->t1 + t->id * t->g * n;
+    for(q = t->k0; q < t->k1; q++)
+    {
+        b = q * t->g;
+        g = t->cnt - b < t->g ? t->cnt - b : t->g;
+
+        /* the inner loop runs over the closest samples: along the lines
+           or across the group of the adjacent lines */
+        if(t->stride == 1 && t->dist == n)
+            memcpy(t0, t->x + b*n, g*n*sizeof(complex_t));
+        else if(t->stride <= t->dist)
+        {
+            for(m = 0; m < g; m++)
+            {
+                px = t->x + (b+m)*t->dist;
+                for(k = 0; k < n; k++)
+                {
+                    RE(t0[m*n + k]) = RE(px[k*t->stride]);
+                    IM(t0[m*n + k]) = IM(px[k*t->stride]);
+                }
+            }
+        }
+        else
+        {
+            for(k = 0; k < n; k++)
+            {
+                px = t->x + b*t->dist + k*t->stride;
+                for(m = 0; m < g; m++)
+                {
+                    RE(t0[m*n + k]) = RE(px[m*t->dist]);
+                    IM(t0[m*n + k]) = IM(px[m*t->dist]);
+                }
+            }
+        }
+
+        /* contiguous output lines: FFT output is written to y directly */
+        if(t->ystride == 1 && t->ydist == n)
+        {
+            fft_run(t0, t->y + b*n, t->p, t->p->st, fft_task_tb(t), g);
+            continue;
+        }
+
+        fft_run(t0, t1, t->p, t->p->st, fft_task_tb(t), g);
+
+        if(t->ystride <= t->ydist)
+        {
+            for(m = 0; m < g; m++)
+            {
+                py = t->y + (b+m)*t->ydist;
+                for(k = 0; k < n; k++)
+                {
+                    RE(py[k*t->ystride]) = RE(t1[m*n + k]);
+                    IM(py[k*t->ystride]) = IM(t1[m*n + k]);
+                }
+            }
+        }
+        else
+        {
+            for(k = 0; k < n; k++)
+            {
+                py = t->y + b*t->ydist + k*t->ystride;
+                for(m = 0; m < g; m++)
+                {
+                    RE(py[m*t->ydist]) = RE(t1[m*n + k]);
+                    IM(py[m*t->ydist]) = IM(t1[m*n + k]);
+                }
+            }
+        }
+    }
+}
+
+
+
+
+/*******************************************************************************
+FFTs of cnt strided lines x[b*dist + k*stride], k = 0 ... n-1,
+to y[b*ydist + k*ystride] (x can be equal to y if the layouts are equal).
+Lines are processed by groups of adjacent lines in the t0 and t1
+workspace without the full matrix transpose. The groups are distributed
+between the pool threads for the large transforms.
+*******************************************************************************/
+int fft_lines(complex_t* x, complex_t* y, int cnt, int stride, int dist,
+              int ystride, int ydist, fft_t* pfft)
+{
+    fft_task_t task;
+    int n = pfft->n;
+    int nth, g, ng, err;
+
+    g = n < FFT_BATCH_SIZE ? FFT_BATCH_SIZE / n : 1;
+    if(g > cnt)
+        g = cnt;
+    ng = (cnt + g - 1) / g;
+
+    nth = 1;
+    if(pfft->pool && (double)n * cnt >= FFT_THREADS_MIN && ng > 1)
+        nth = pfft->nthreads < ng ? pfft->nthreads : ng;
+
+    err = fft_workspace(pfft, nth * g * n);
+    if(err != RES_OK)
+        return err;
+
+    memset(&task, 0, sizeof(fft_task_t));
+    task.fn = fft_task_lines;
+    task.t0 = pfft->t0;
+    task.t1 = pfft->t1;
+    task.tb = pfft->tb;
+    task.p  = pfft->plan;
+    task.x  = x;
+    task.y  = y;
+    task.stride = stride;
+    task.dist   = dist;
+    task.ystride = ystride;
+    task.ydist   = ydist;
+    task.g      = g;
+    task.cnt    = cnt;
+
+    if(nth > 1)
+        fft_pool_run(pfft->pool, &task, ng, 1);
+    else
+    {
+        task.k0 = 0;
+        task.k1 = ng;
+        fft_task_lines(&task);
+    }
+    return RES_OK;
+}
+
+
+
+
+/* Parallel loop range of the fft_pool_for */
+static void fft_task_for(fft_task_t* t)
+{
+    t->fb(t->arg, t->id, t->k0, t->k1);
+}
+
+
+
+
+void fft_pool_for(fft_pool_t* pool, int cnt, fft_range_t fn, void* arg)
+{
+    fft_task_t task;
+
+    if(!pool || pool->nth < 2 || cnt < 2)
+    {
+        fn(arg, 0, 0, cnt);
+        return;
+    }
+    memset(&task, 0, sizeof(fft_task_t));
+    task.fn  = fft_task_for;
+    task.fb  = fn;
+    task.arg = arg;
+    fft_pool_run(pool, &task, cnt, 1);
+}
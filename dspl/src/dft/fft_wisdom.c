@@ -0,0 +1,152 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#include <pthread.h>
+
+
+
+
+/* Process-wide FFT wisdom table */
+static pthread_mutex_t  fft_wisdom_mtx = PTHREAD_MUTEX_INITIALIZER;
+static fft_wisdom_t*    fft_wisdom_tab = NULL;
+static int              fft_wisdom_cnt = 0;
+static int              fft_wisdom_cap = 0;
+
+
+
+
+int fft_wisdom_find(int n, int isa, fft_wisdom_t* wis)
+{
+    int k, res = 0;
+
+    pthread_mutex_lock(&fft_wisdom_mtx);
+    for(k = 0; k < fft_wisdom_cnt; k++)
+    {
+        if(fft_wisdom_tab[k].n == n && fft_wisdom_tab[k].isa == isa)
+        {
+            memcpy(wis, fft_wisdom_tab + k, sizeof(fft_wisdom_t));
+            res = 1;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&fft_wisdom_mtx);
+    return res;
+}
+
+
+
+
+int fft_wisdom_get(int k, fft_wisdom_t* wis)
+{
+    int res = 0;
+
+    pthread_mutex_lock(&fft_wisdom_mtx);
+    if(k >= 0 && k < fft_wisdom_cnt)
+    {
+        memcpy(wis, fft_wisdom_tab + k, sizeof(fft_wisdom_t));
+        res = 1;
+    }
+    pthread_mutex_unlock(&fft_wisdom_mtx);
+    return res;
+}
+
+
+
+
+int fft_wisdom_put(fft_wisdom_t* wis)
+{
+    fft_wisdom_t* tab;
+    int k;
+
+    pthread_mutex_lock(&fft_wisdom_mtx);
+    for(k = 0; k < fft_wisdom_cnt; k++)
+        if(fft_wisdom_tab[k].n == wis->n && fft_wisdom_tab[k].isa == wis->isa)
+            break;
+    if(k == fft_wisdom_cap)
+    {
+        tab = (fft_wisdom_t*) realloc(fft_wisdom_tab, 
+                  (2*fft_wisdom_cap + 4)*sizeof(fft_wisdom_t));
+        if(!tab)
+        {
+            pthread_mutex_unlock(&fft_wisdom_mtx);
+            return ERROR_MALLOC;
+        }
+        fft_wisdom_tab = tab;
+        fft_wisdom_cap = 2*fft_wisdom_cap + 4;
+    }
+    memcpy(fft_wisdom_tab + k, wis, sizeof(fft_wisdom_t));
+    if(k == fft_wisdom_cnt)
+        fft_wisdom_cnt++;
+    pthread_mutex_unlock(&fft_wisdom_mtx);
+    return RES_OK;
+}
+
+
+
+
+void fft_wisdom_reset(void)
+{
+    pthread_mutex_lock(&fft_wisdom_mtx);
+    if(fft_wisdom_tab)
+        free(fft_wisdom_tab);
+    fft_wisdom_tab = NULL;
+    fft_wisdom_cnt = fft_wisdom_cap = 0;
+    pthread_mutex_unlock(&fft_wisdom_mtx);
+}
+
+
+
+
+int fft_wisdom_check(fft_wisdom_t* wis)
+{
+    long long s = 1;
+    int k;
+
+    if(wis->n < 1 || wis->isa < FFT_ISA_SCALAR || wis->isa > FFT_ISA_AVX512)
+        return 0;
+    if(wis->nst < 1 || wis->nst > FFT_WISDOM_NST)
+        return 0;
+    for(k = 0; k < wis->nst; k++)
+    {
+        if(wis->r[k] < 2 || !fft_codelet(wis->r[k]))
+            return 0;
+        if(wis->vec[k] && !fft_simd_radix(wis->r[k]))
+            return 0;
+        s *= wis->r[k];
+        if(wis->n % s)
+            return 0;
+    }
+
+    /* the sequence ends at the first DFT or Bluestein stage, so the rest
+       of the FFT size has no factors of the codelets radixes 
+       (all radixes are the products of the primes up to 13) */
+    for(k = 2; k <= 13; k++)
+        if(fft_codelet(k) && (wis->n / s) % k == 0)
+            return 0;
+    return 1;
+}
@@ -0,0 +1,63 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Clear the FFT wisdom.
+
+The function clears the process-wide FFT wisdom measured by 
+\ref fft_wisdom_measure or loaded by \ref fft_wisdom_load.
+The plans created after the function call use the heuristic
+stages (see \ref fft_plan_create).
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Очистка мудрости БПФ
+
+Функция очищает общую для процесса мудрость БПФ, измеренную функцией
+\ref fft_wisdom_measure или загруженную функцией \ref fft_wisdom_load.
+Планы, создаваемые после вызова функции, используют эвристический
+выбор этапов (см. \ref fft_plan_create).
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+void DSPL_API fft_wisdom_clear(void)
+{
+    fft_wisdom_reset();
+    fft_cache_flush();
+}
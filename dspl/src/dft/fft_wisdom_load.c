@@ -0,0 +1,200 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+/* Maximal length of the wisdom file line */
+#define FFT_WISDOM_LINE     1024
+
+
+
+
+/*******************************************************************************
+Wisdom of the one line of the wisdom file. Returns 0 if the line is 
+not correct
+*******************************************************************************/
+static int fft_wisdom_parse(char* str, fft_wisdom_t* wis)
+{
+    char* end;
+    long v;
+
+    memset(wis, 0, sizeof(fft_wisdom_t));
+    wis->n = (int)strtol(str, &end, 10);
+    if(end == str)
+        return 0;
+    str = end;
+    wis->isa = (int)strtol(str, &end, 10);
+    if(end == str)
+        return 0;
+    str = end;
+    while(1)
+    {
+        v = strtol(str, &end, 10);
+        if(end == str)
+            break;
+        if(wis->nst == FFT_WISDOM_NST)
+            return 0;
+        wis->r[wis->nst] = (int)v;
+        wis->vec[wis->nst] = *end == 'v';
+        if(*end == 'v')
+            end++;
+        wis->nst++;
+        str = end;
+    }
+    while(*str == ' ' || *str == '\t' || *str == '\r' || *str == '\n')
+        str++;
+    return !*str && fft_wisdom_check(wis);
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Load the FFT wisdom from the text file.
+
+The function reads the FFT wisdom file saved by \ref fft_wisdom_save
+(see the file format in the \ref fft_wisdom_save description)
+and adds it to the process-wide FFT wisdom. 
+The wisdom of the same FFT size and instruction set is replaced. \n
+The plans created after the function call by \ref fft_plan_create,
+\ref fft_create and the other FFT functions use the loaded stages
+without the measurement. The loaded wisdom of the other instruction sets
+is used after the \ref fft_set_isa call. 
+The cached plans of the previous wisdom are not used anymore. \n
+The wisdom is not changed if the file is not correct.
+
+\param[in]  fn
+File name. \n \n
+
+\return
+`RES_OK` if the wisdom is loaded successfully. \n
+`ERROR_FFT_WISDOM` if the file has the incorrect line. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+// application startup
+err = fft_wisdom_load("fft.wisdom");
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Загрузка мудрости БПФ из текстового файла
+
+Функция читает файл мудрости БПФ, сохраненный функцией 
+\ref fft_wisdom_save (формат файла приведен в описании функции
+\ref fft_wisdom_save), и добавляет его в общую для процесса
+мудрость БПФ. Мудрость того же размера БПФ и набора инструкций 
+заменяется. \n
+Планы, создаваемые после вызова функции функциями \ref fft_plan_create,
+\ref fft_create и другими функциями БПФ, используют загруженные этапы
+без измерения. Загруженная мудрость других наборов инструкций 
+используется после вызова функции \ref fft_set_isa.
+Кэшированные планы предыдущей мудрости больше не используются. \n
+Если файл некорректен, то мудрость не изменяется.
+
+\param[in]  fn
+Имя файла. \n \n
+
+\return
+`RES_OK` если мудрость загружена успешно. \n
+`ERROR_FFT_WISDOM` если файл содержит некорректную строку. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+// запуск приложения
+err = fft_wisdom_load("fft.wisdom");
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_wisdom_load(char* fn)
+{
+    char str[FFT_WISDOM_LINE];
+    fft_wisdom_t *tab = NULL;
+    fft_wisdom_t *t;
+    FILE* pFile = NULL;
+    char* p;
+    int k, cnt, cap, res;
+
+    if(!fn)
+        return ERROR_FNAME;
+
+    pFile = fopen(fn, "r");
+    if(pFile == NULL)
+        return ERROR_FOPEN;
+
+    /* all lines are parsed before the wisdom change */
+    cnt = cap = 0;
+    res = RES_OK;
+    while(fgets(str, FFT_WISDOM_LINE, pFile))
+    {
+        p = str;
+        while(*p == ' ' || *p == '\t')
+            p++;
+        if(*p == '#' || *p == '\n' || *p == '\r' || !*p)
+            continue;
+        if(cnt == cap)
+        {
+            t = (fft_wisdom_t*) realloc(tab, (2*cap+4)*sizeof(fft_wisdom_t));
+            if(!t)
+            {
+                res = ERROR_MALLOC;
+                goto exit_label;
+            }
+            tab = t;
+            cap = 2*cap + 4;
+        }
+        if(!fft_wisdom_parse(p, tab + cnt))
+        {
+            res = ERROR_FFT_WISDOM;
+            goto exit_label;
+        }
+        cnt++;
+    }
+
+    for(k = 0; k < cnt && res == RES_OK; k++)
+        res = fft_wisdom_put(tab + k);
+    fft_cache_flush();
+
+exit_label:
+    fclose(pFile);
+    if(tab)
+        free(tab);
+    return res;
+}
@@ -0,0 +1,445 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#include <time.h>
+
+
+
+
+/* Maximal number of the candidate radix sequences */
+#define FFT_WISDOM_CAND     512
+
+
+
+/*******************************************************************************
+Radix sequence of the plan stages up to the first DFT or Bluestein stage
+*******************************************************************************/
+static void fft_wisdom_from_plan(fft_plan_t* plan, fft_wisdom_t* wis)
+{
+    fft_stage_t* st;
+    int k;
+
+    wis->nst = 0;
+    for(k = 0; k < plan->nst && k < FFT_WISDOM_NST; k++)
+    {
+        st = plan->st + k;
+        if(st->n1 < 2 || !fft_codelet(st->n1))
+            break;
+        wis->r[k]   = st->n1;
+        wis->vec[k] = st->fn == fft_codelet_vcol || st->fn == fft_codelet_vrow;
+        wis->nst++;
+    }
+}
+
+
+
+
+/*******************************************************************************
+Candidate c is added to the list of nc candidates if it is new
+*******************************************************************************/
+static void fft_wisdom_add(fft_wisdom_t* c, int* nc, fft_wisdom_t* cand)
+{
+    int k;
+
+    if(c->nst < 1 || *nc >= FFT_WISDOM_CAND)
+        return;
+    for(k = 0; k < *nc; k++)
+    {
+        if(cand[k].nst == c->nst && 
+           !memcmp(cand[k].r,   c->r,   c->nst*sizeof(int)) &&
+           !memcmp(cand[k].vec, c->vec, c->nst*sizeof(int)))
+            return;
+    }
+    memcpy(cand + (*nc)++, c, sizeof(fft_wisdom_t));
+}
+
+
+
+
+/*******************************************************************************
+Candidate radix sequences of the 2,3,5,7,11,13-smooth part of n.
+The sequence is composed by the runs of the radix-2^k, 13, 11, 7, 5 and 3 
+stages in all orders of the runs. The power of two run is factorized by 
+the largest scalar codelets, by the radix-256 vector stages or by 
+the radix-16, 8 or 4 stages. The radix 7, 5 and 3 runs are also grouped 
+by the radix-49, 25 and 9 stages. The vector codelets stages 
+use the vector or the scalar codelets
+*******************************************************************************/
+static int fft_wisdom_cand(int n, int isa, fft_wisdom_t* cand, int nc)
+{
+    int e[6] = {0};
+    int fac[5] = {13, 11, 7, 5, 3};
+    int run[6][FFT_WISDOM_NST];
+    int len[6];
+    int prm[6];
+    int g, q, r, m, k, i, j, t, nr, v, nv;
+    fft_wisdom_t c;
+
+    c.n   = n;
+    c.isa = isa;
+
+    m = n;
+    while(m % 2 == 0) { m /= 2; e[0]++; }
+    for(k = 0; k < 5; k++)
+        while(m % fac[k] == 0) { m /= fac[k]; e[k+1]++; }
+
+    nv = isa == FFT_ISA_SCALAR ? 1 : 2;
+    for(q = 0; q < 10; q++)
+    {
+        /* power of two run: 4096 ... 2, 16 ... 2, 8 ... 2, 4 ... 2 
+           or 256, 16 ... 2 for the vector instruction sets */
+        g = q % 5;
+        if(g == 4 && nv < 2)
+            continue;
+        r = g == 4 ? 256 : (g ? 32 >> g : 4096);
+        len[0] = 0;
+        for(k = e[0]; k > 0;)
+        {
+            while(r > (1 << k))
+                r /= 2;
+            run[0][len[0]++] = r;
+            for(t = r; t > 1; t /= 2)
+                k--;
+            if(r == 256)
+                r = 16;
+        }
+        /* radix 13, 11, 7, 5 and 3 runs, the squares of 7, 5 and 3 
+           are grouped for q > 4 */
+        nr = 1;
+        for(k = 0; k < 5; k++)
+        {
+            len[nr] = 0;
+            i = e[k+1];
+            if(q > 4 && k > 1)
+                for(; i > 1; i -= 2)
+                    run[nr][len[nr]++] = fac[k] * fac[k];
+            for(; i > 0; i--)
+                run[nr][len[nr]++] = fac[k];
+            if(len[nr])
+                nr++;
+        }
+        if(!len[0])
+        {
+            for(k = 1; k < nr; k++)
+            {
+                memcpy(run[k-1], run[k], len[k]*sizeof(int));
+                len[k-1] = len[k];
+            }
+            nr--;
+        }
+
+        /* all orders of the runs */
+        for(k = 0; k < nr; k++)
+            prm[k] = k;
+        do
+        {
+            for(v = 0; v < nv; v++)
+            {
+                c.nst = 0;
+                for(k = 0; k < nr; k++)
+                {
+                    for(i = 0; i < len[prm[k]]; i++)
+                    {
+                        if(c.nst == FFT_WISDOM_NST)
+                            break;
+                        c.r[c.nst]   = run[prm[k]][i];
+                        c.vec[c.nst] = !v && nv > 1 && 
+                                       fft_simd_radix(c.r[c.nst]);
+                        c.nst++;
+                    }
+                }
+                fft_wisdom_add(&c, &nc, cand);
+            }
+
+            /* next permutation */
+            i = nr - 2;
+            while(i >= 0 && prm[i] > prm[i+1])
+                i--;
+            if(i < 0)
+                break;
+            j = nr - 1;
+            while(prm[j] < prm[i])
+                j--;
+            t = prm[i]; prm[i] = prm[j]; prm[j] = t;
+            for(i++, j = nr - 1; i < j; i++, j--)
+            {
+                t = prm[i]; prm[i] = prm[j]; prm[j] = t;
+            }
+        } while(1);
+    }
+    return nc;
+}
+
+
+
+
+/*******************************************************************************
+Time of the one FFT by the plan of the wisdom wis (seconds). 
+The measurement is stopped if the plan is two times slower than tbest
+*******************************************************************************/
+static int fft_wisdom_time(fft_wisdom_t* wis, complex_t* x, complex_t* y, 
+                           double tbest, double* pt)
+{
+    fft_plan_t plan = {0};
+    fft_t pfft = {0};
+    clock_t t0, dt;
+    double t;
+    int k, cnt, err;
+
+    err = fft_plan_build(&plan, wis->n, wis);
+    if(err != RES_OK)
+        return err;
+    err = fft_bind(&pfft, &plan);
+    if(err != RES_OK)
+        goto exit_label;
+
+    /* warm-up */
+    err = fft_cmplx(x, wis->n, &pfft, y);
+    if(err != RES_OK)
+        goto exit_label;
+
+    *pt = 0.0;
+    for(k = 0; k < FFT_WISDOM_REP; k++)
+    {
+        cnt = 0;
+        t0 = clock();
+        do
+        {
+            fft_cmplx(x, wis->n, &pfft, y);
+            cnt++;
+            dt = clock() - t0;
+        } while((double)dt < FFT_WISDOM_TIME * (double)CLOCKS_PER_SEC);
+
+        t = (double)dt / (double)CLOCKS_PER_SEC / (double)cnt;
+        if(!k || t < *pt)
+            *pt = t;
+        if(tbest > 0.0 && *pt > 2.0 * tbest)
+            break;
+    }
+
+exit_label:
+    fft_free(&pfft);
+    fft_plan_free(&plan);
+    return err;
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Measure the fastest FFT plan of the size `n` and add it 
+to the FFT wisdom.
+
+By default the FFT plan stages radixes are selected by the heuristic
+(see \ref fft_plan_create). The function measures the alternative plans
+of the `n`-points FFT for the current instruction set 
+(see \ref fft_set_isa): the orders of the radix-2,3,5,7,11,13 stages, 
+the radix-256, 16, 8 and 4 factorizations of the power of two factor, 
+the radix-49, 25 and 9 stages instead of the pairs of the radix-7, 5 
+and 3 stages, the large scalar codelets and the vector or scalar codelets 
+of the stages. The heuristic plan is also measured. \n
+The fastest plan is added to the process-wide FFT wisdom.
+Then the plans of the size `n` created by \ref fft_plan_create,
+\ref fft_create and the other FFT functions use the measured stages.
+The cached plans of the previous wisdom are not used anymore. \n
+The measurement takes from tens of milliseconds to several seconds
+depending on the FFT size, thus the wisdom is usually measured once and
+saved to the file by \ref fft_wisdom_save function. 
+Then the application loads the wisdom by \ref fft_wisdom_load function 
+without the measurement. \n
+The FFT objects created before the function call keep their plans.
+
+\param[in]  n
+FFT size. \n
+If `n` has no factors 2, 3, 5, 7, 11 or 13 then there is no alternative plans
+and the wisdom is not changed. \n \n
+
+\return
+`RES_OK` if the wisdom is measured successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+// measurement once, for example at the application installation
+fft_wisdom_measure(75600);
+fft_wisdom_measure(165375);
+fft_wisdom_save("fft.wisdom");
+
+// ...
+
+// application startup
+fft_wisdom_load("fft.wisdom");
+fft_cmplx(x, 75600, &pfft, y);     // measured plan is used
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Измерение самого быстрого плана БПФ размера `n` 
+и добавление его в мудрость БПФ
+
+По умолчанию основания этапов плана БПФ выбираются эвристически
+(см. \ref fft_plan_create). Функция измеряет альтернативные планы
+`n`-точечного БПФ для текущего набора инструкций (см. \ref fft_set_isa):
+порядок этапов по основаниям 2,3,5,7,11,13, разложение множителя -- 
+степени двойки по основаниям 256, 16, 8 и 4, этапы по основаниям 49, 25 
+и 9 вместо пар этапов по основаниям 7, 5 и 3, большие скалярные ядра, 
+а также векторные или скалярные ядра этапов. Эвристический план также 
+измеряется. \n
+Самый быстрый план добавляется в общую для процесса мудрость БПФ.
+После этого планы размера `n`, создаваемые функциями
+\ref fft_plan_create, \ref fft_create и другими функциями БПФ, 
+используют измеренные этапы. Кэшированные планы предыдущей мудрости 
+больше не используются. \n
+Измерение занимает от десятков миллисекунд до нескольких секунд
+в зависимости от размера БПФ, поэтому мудрость обычно измеряется 
+один раз и сохраняется в файл функцией \ref fft_wisdom_save.
+Затем приложение загружает мудрость функцией \ref fft_wisdom_load
+без измерения. \n
+Объекты БПФ, созданные до вызова функции, сохраняют свои планы.
+
+\param[in]  n
+Размер БПФ. \n
+Если `n` не имеет множителей 2, 3, 5, 7, 11 или 13, то альтернативные планы
+отсутствуют и мудрость не изменяется. \n \n
+
+\return
+`RES_OK` если мудрость измерена успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+// однократное измерение, например при установке приложения
+fft_wisdom_measure(75600);
+fft_wisdom_measure(165375);
+fft_wisdom_save("fft.wisdom");
+
+// ...
+
+// запуск приложения
+fft_wisdom_load("fft.wisdom");
+fft_cmplx(x, 75600, &pfft, y);     // используется измеренный план
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_wisdom_measure(int n)
+{
+    fft_plan_t plan = {0};
+    fft_wisdom_t* cand = NULL;
+    complex_t *x = NULL;
+    complex_t *y = NULL;
+    double t, tbest;
+    int k, nc, best, isa, err;
+
+    if(n < 1)
+        return ERROR_FFT_SIZE;
+
+    isa  = fft_get_isa();
+    cand = (fft_wisdom_t*) malloc(FFT_WISDOM_CAND * sizeof(fft_wisdom_t));
+    if(!cand)
+        return ERROR_MALLOC;
+
+    /* heuristic plan is the first candidate */
+    err = fft_plan_build(&plan, n, NULL);
+    if(err != RES_OK)
+        goto exit_label;
+    cand[0].n   = n;
+    cand[0].isa = isa;
+    fft_wisdom_from_plan(&plan, cand);
+    fft_plan_free(&plan);
+    nc = cand[0].nst ? 1 : 0;
+    nc = fft_wisdom_cand(n, isa, cand, nc);
+    if(nc < 2)
+    {
+        err = RES_OK;
+        goto exit_label;
+    }
+
+    x = (complex_t*) malloc(n * sizeof(complex_t));
+    y = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y)
+    {
+        err = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)(k % 7) - 3.0;
+        IM(x[k]) = (double)(k % 5) - 2.0;
+    }
+
+    /* the heuristic plan is measured first after the warm-up, 
+       and it is measured again with the fastest candidate */
+    err = fft_wisdom_time(cand, x, y, 0.0, &t);
+    if(err != RES_OK)
+        goto exit_label;
+    best  = 0;
+    tbest = 0.0;
+    for(k = 0; k < nc; k++)
+    {
+        err = fft_wisdom_time(cand + k, x, y, tbest, &t);
+        if(err != RES_OK)
+            goto exit_label;
+        if(!k || t < tbest)
+        {
+            tbest = t;
+            best  = k;
+        }
+    }
+    if(best)
+    {
+        err = fft_wisdom_time(cand, x, y, 0.0, &t);
+        if(err != RES_OK)
+            goto exit_label;
+        err = fft_wisdom_time(cand + best, x, y, 0.0, &tbest);
+        if(err != RES_OK)
+            goto exit_label;
+        if(t <= tbest)
+            best = 0;
+    }
+
+    err = fft_wisdom_put(cand + best);
+    if(err == RES_OK)
+        fft_cache_flush();
+
+exit_label:
+    if(cand)
+        free(cand);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    return err;
+}
@@ -0,0 +1,129 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Save the FFT wisdom to the text file.
+
+The function writes the process-wide FFT wisdom measured by 
+\ref fft_wisdom_measure or loaded by \ref fft_wisdom_load
+to the text file. Each line of the file describes the plan of one 
+FFT size and instruction set:
+\verbatim
+n isa r0 r1 ... 
+\endverbatim
+here `n` is the FFT size, `isa` is the instruction set 
+(see \ref fft_set_isa) and `r0 r1 ...` are the radixes of the plan
+stages. The radix of the stage which uses the vector codelet 
+is marked by the `v` suffix, for example:
+\verbatim
+75600 3 16v 7v 5v 5v 3v 3v 3v
+\endverbatim
+The lines which begin with `#` are the comments. \n
+The wisdom depends on the CPU, thus the file should be measured
+on the same CPU model where it is used.
+
+\param[in]  fn
+File name. \n \n
+
+\return
+`RES_OK` if the wisdom is saved successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Сохранение мудрости БПФ в текстовый файл
+
+Функция записывает в текстовый файл общую для процесса мудрость БПФ,
+измеренную функцией \ref fft_wisdom_measure или загруженную функцией
+\ref fft_wisdom_load. Каждая строка файла описывает план одного
+размера БПФ и набора инструкций:
+\verbatim
+n isa r0 r1 ... 
+\endverbatim
+где `n` -- размер БПФ, `isa` -- набор инструкций 
+(см. \ref fft_set_isa), а `r0 r1 ...` -- основания этапов плана.
+Основание этапа, использующего векторное ядро, отмечается 
+суффиксом `v`, например:
+\verbatim
+75600 3 16v 7v 5v 5v 3v 3v 3v
+\endverbatim
+Строки, начинающиеся с `#`, являются комментариями. \n
+Мудрость зависит от процессора, поэтому файл должен быть измерен
+на той же модели процессора, на которой он используется.
+
+\param[in]  fn
+Имя файла. \n \n
+
+\return
+`RES_OK` если мудрость сохранена успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fft_wisdom_save(char* fn)
+{
+    fft_wisdom_t wis;
+    FILE* pFile = NULL;
+    int k, i, res;
+
+    if(!fn)
+        return ERROR_FNAME;
+
+    pFile = fopen(fn, "w");
+    if(pFile == NULL)
+        return ERROR_FOPEN;
+
+    res = RES_OK;
+    if(fprintf(pFile, "# libdspl-2.0 FFT wisdom: n isa radixes\n") < 0)
+        res = ERROR_FWRITE_SIZE;
+    for(k = 0; res == RES_OK && fft_wisdom_get(k, &wis); k++)
+    {
+        if(fprintf(pFile, "%d %d", wis.n, wis.isa) < 0)
+            res = ERROR_FWRITE_SIZE;
+        for(i = 0; i < wis.nst; i++)
+            if(fprintf(pFile, " %d%s", wis.r[i], wis.vec[i] ? "v" : "") < 0)
+                res = ERROR_FWRITE_SIZE;
+        if(fprintf(pFile, "\n") < 0)
+            res = ERROR_FWRITE_SIZE;
+    }
+
+    if(fclose(pFile) && res == RES_OK)
+        res = ERROR_FWRITE_SIZE;
+    return res;
+}
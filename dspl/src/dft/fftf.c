@@ -0,0 +1,196 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Single precision fast Fourier transform for the real vector.
+
+Function calculates \f$ n \f$-points FFT for the real vector 
+\f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$. \n
+The function is the single precision version of the \ref fft function.
+For even `n` the real vector is packed into the \f$ n/2 \f$-points
+complex vector and the spectrum is separated by the `wr` twiddle
+factors of the `fftf_t` object (see \ref fft_r2c function).
+
+\param[in]  x
+Pointer to the input real vector \f$x(m)\f$, 
+\f$ m = 0 \ldots n-1 \f$.  \n
+Vector size is `[n x 1]`.  \n \n
+
+\param[in]  n
+FFT size \f$n\f$ (see \ref fftf_create function). \n \n
+
+\param[in]  pfft
+Pointer to the `fftf_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Note that for even `n` the function fills the
+object for the `n/2`-points FFT. \n
+The object must be cleared by the \ref fftf_free function. \n \n
+
+\param[out] y
+Pointer to the FFT result complex vector \f$Y(k)\f$, 
+\f$ k = 0 \ldots n-1 \f$. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Быстрое преобразование Фурье одинарной точности
+вещественного сигнала
+
+Функция рассчитывает \f$ n \f$-точечное БПФ вещественного сигнала
+\f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$. \n
+Функция является версией одинарной точности функции \ref fft.
+При четном `n` вещественный сигнал упаковывается в
+\f$ n/2 \f$-точечный комплексный сигнал, и спектр выделяется
+при помощи поворотных коэффициентов `wr` объекта `fftf_t`
+(см. функцию \ref fft_r2c).
+
+\param[in]  x
+Указатель на вектор вещественного входного сигнала \f$x(m)\f$, 
+\f$ m = 0 \ldots n-1 \f$.  \n
+Размер вектора `[n x 1]`.  \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$ (см. функцию \ref fftf_create). \n \n
+
+\param[in]  pfft
+Указатель на структуру `fftf_t`. \n
+Указатель не должен быть `NULL`. \n
+Необходимо учитывать, что при четном `n` функция заполняет
+объект для `n/2`-точечного БПФ. \n
+Объект должен быть очищен функцией \ref fftf_free. \n \n
+
+\param[out] y
+Указатель на комплексный вектор результата БПФ \f$Y(k)\f$, 
+\f$ k = 0 \ldots n-1 \f$. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fftf(float* x, int n, fftf_t* pfft, complexf_t* y)
+{
+    int err, k, n2;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n<1)
+        return ERROR_SIZE;
+
+    if(n%2)
+    {
+        err = fftf_create(pfft, n);
+        if(err != RES_OK)
+            return err;
+
+        for(k = 0; k < n; k++)
+        {
+            RE(pfft->t1[k]) = x[k];
+            IM(pfft->t1[k]) = 0.0f;
+        }
+        return fftf_krn(pfft->t1, y, pfft);
+    }
+
+    /* even size: z(m) = x(2m) + j x(2m+1) and n/2-points complex FFT */
+    n2 = n/2;
+    err = fftf_create(pfft, n2);
+    if(err != RES_OK)
+        return err;
+
+    memcpy(pfft->t1, x, n*sizeof(float));
+    err = fftf_krn(pfft->t1, y, pfft);
+    if(err != RES_OK)
+        return err;
+
+    fftf_r2c_split(y, n2, pfft->wr);
+
+    /* spectrum symmetry */
+    for(k = n2+1; k < n; k++)
+    {
+        RE(y[k]) =  RE(y[n-k]);
+        IM(y[k]) = -IM(y[n-k]);
+    }
+    return RES_OK;
+}
+
+
+
+
+void fftf_r2c_split(complexf_t* y, int n2, complexf_t* wr)
+{
+    int k;
+    complexf_t e, o, b;
+
+    /* split Z(k) = E(k) + j O(k) into Y(k) = E(k) + W_n^k O(k) */
+    RE(y[n2]) = RE(y[0]) - IM(y[0]);
+    RE(y[0])  = RE(y[0]) + IM(y[0]);
+    IM(y[0])  = IM(y[n2]) = 0.0f;
+
+    for(k = 1; k <= n2/2; k++)
+    {
+        RE(e) = 0.5f * (RE(y[k]) + RE(y[n2-k]));
+        IM(e) = 0.5f * (IM(y[k]) - IM(y[n2-k]));
+        RE(o) = 0.5f * (IM(y[k]) + IM(y[n2-k]));
+        IM(o) = 0.5f * (RE(y[n2-k]) - RE(y[k]));
+
+        RE(b) = CMRE(o, wr[k]);
+        IM(b) = CMIM(o, wr[k]);
+
+        RE(y[n2-k]) = RE(e) - RE(b);
+        IM(y[n2-k]) = IM(b) - IM(e);
+
+        RE(y[k]) = RE(e) + RE(b);
+        IM(y[k]) = IM(e) + IM(b);
+    }
+}
@@ -0,0 +1,141 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Single precision fast Fourier transform for the complex vector.
+
+Function calculates \f$ n \f$-points FFT for the complex vector 
+\f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$. \n
+The function is the single precision version of the \ref fft_cmplx
+function. The vector codelets process twice more values per vector
+than the double precision codelets. 
+
+\param[in]  x
+Pointer to the input complex vector \f$x(m)\f$, 
+\f$ m = 0 \ldots n-1 \f$.  \n
+Vector size is `[n x 1]`.  \n \n
+
+\param[in]  n
+FFT size \f$n\f$ (see \ref fftf_create function). \n \n
+
+\param[in]  pfft
+Pointer to the `fftf_t` object.  \n
+This pointer cannot be `NULL`.  \n
+The object is filled by the \ref fftf_create function automatically
+and it must be cleared by the \ref fftf_free function. \n \n
+
+\param[out] y
+Pointer to the FFT result complex vector \f$Y(k)\f$, 
+\f$ k = 0 \ldots n-1 \f$. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if FFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include fftf_cmplx_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Быстрое преобразование Фурье одинарной точности
+комплексного сигнала
+
+Функция рассчитывает \f$ n \f$-точечное БПФ комплексного сигнала
+\f$ x(m) \f$, \f$ m = 0 \ldots n-1 \f$: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n-1} x(m) \exp \left( -j \frac{2\pi}{n} m k \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$. \n
+Функция является версией одинарной точности функции \ref fft_cmplx.
+Векторные ядра обрабатывают вдвое больше значений в векторе,
+чем ядра двойной точности.
+
+\param[in]  x
+Указатель на вектор комплексного входного сигнала \f$x(m)\f$, 
+\f$ m = 0 \ldots n-1 \f$.  \n
+Размер вектора `[n x 1]`.  \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$ (см. функцию \ref fftf_create). \n \n
+
+\param[in]  pfft
+Указатель на структуру `fftf_t`. \n
+Указатель не должен быть `NULL`. \n
+Объект заполняется функцией \ref fftf_create автоматически
+и должен быть очищен функцией \ref fftf_free. \n \n
+
+\param[out] y
+Указатель на комплексный вектор результата БПФ \f$Y(k)\f$, 
+\f$ k = 0 \ldots n-1 \f$. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции `fftf_cmplx`:
+
+\include fftf_cmplx_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fftf_cmplx(complexf_t* x, int n, fftf_t* pfft, complexf_t* y)
+{
+    int err;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n<1)
+        return ERROR_SIZE;
+
+    err = fftf_create(pfft, n);
+    if(err != RES_OK)
+        return err;
+
+    memcpy(pfft->t1, x, n*sizeof(complexf_t));
+
+    return fftf_krn(pfft->t1, y, pfft);
+}
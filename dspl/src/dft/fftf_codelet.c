@@ -0,0 +1,106 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+void fftf_codelet_dft(complexf_t* x, complexf_t* y, int cnt, 
+                      fftf_t* p, fftf_stage_t* s)
+{
+    complexf_t* w = p->w + s->addr;
+    int n = s->n1;
+    int b, k, m, i;
+    float re, im;
+
+    for(b = 0; b < cnt; b++)
+    {
+        for(k = 0; k < n; k++)
+        {
+            re = im = 0.0f;
+            i = 0;
+            for(m = 0; m < n; m++)
+            {
+                re += CMRE(x[m], w[i]);
+                im += CMIM(x[m], w[i]);
+                i += k;
+                if(i >= n)
+                    i -= n;
+            }
+            RE(y[k]) = re;
+            IM(y[k]) = im;
+        }
+        x += n;
+        y += n;
+    }
+}
+
+
+
+
+void fftf_codelet_bluestein(complexf_t* x, complexf_t* y, int cnt, 
+                            fftf_t* p, fftf_stage_t* s)
+{
+    complexf_t *pc = p->w + s->addr;
+    complexf_t *pb = pc + s->n1;
+    complexf_t *a = p->tb;
+    complexf_t *c = p->tb + p->nb;
+    int n  = s->n1;
+    int nb = p->nb;
+    int b, k;
+
+    for(b = 0; b < cnt; b++)
+    {
+        /* a(k) = x(k) * c(k), c(k) = exp(-j*pi*k^2/n) */
+        for(k = 0; k < n; k++)
+        {
+            RE(a[k]) = CMRE(x[k], pc[k]);
+            IM(a[k]) = CMIM(x[k], pc[k]);
+        }
+        memset(a+n, 0, (nb-n)*sizeof(complexf_t));
+
+        /* nb-points FFT schedule follows the Bluestein stage */
+        fftf_run(a, c, p, s + 1, 1);
+
+        /* inverse FFT of A(k)*B(k) as conj(FFT(conj(A(k)*B(k)))) */
+        for(k = 0; k < nb; k++)
+        {
+            RE(a[k]) =  CMRE(c[k], pb[k]);
+            IM(a[k]) = -CMIM(c[k], pb[k]);
+        }
+        fftf_run(a, c, p, s + 1, 1);
+
+        /* y(k) = conj(b(k)) * c(k) */
+        for(k = 0; k < n; k++)
+        {
+            RE(y[k]) = CMCONJRE(pc[k], c[k]);
+            IM(y[k]) = CMCONJIM(pc[k], c[k]);
+        }
+        x += n;
+        y += n;
+    }
+}
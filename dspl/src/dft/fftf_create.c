@@ -0,0 +1,293 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Create the single precision FFT object `fftf_t`.
+
+The function creates the `n`-points FFT schedule, calculates
+the single precision twiddle factors and allocates
+the workspace of the `fftf_t` object. \n
+The FFT size is factored by the radix 16 stages, by the stages of the 
+generated codelets radixes (13, 11, 10, 12, 9, 25, 49, 15 and 6 in the 
+priority order of the fft_bfgen.py script), and by the radix 7, 8, 5, 4, 3 
+and 2 stages
+which are calculated by the vector codelets of the instruction set
+selected by the \ref fft_set_isa function.
+The factor \f$ m \f$ which is not divisible by 2, 3, 5, 7, 11, 13 is
+calculated as the DFT if \f$ m \leq 32\f$, else by the Bluestein
+algorithm. The Bluestein chirp filter spectrum and all twiddle
+factors are calculated in double precision and then rounded to `float`. \n
+Functions \ref fftf_cmplx, \ref ifftf_cmplx and \ref fftf
+call `fftf_create` automatically if the FFT size is changed.
+
+\param[in,out]  pfft
+Pointer to the `fftf_t` object.  \n
+Pointer cannot be `NULL`.  \n \n
+
+\param[in]  n
+FFT size \f$n\f$ (arbitrary positive integer). \n \n
+
+\return
+`RES_OK` if the FFT object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\note
+The object must be cleared by the \ref fftf_free function.
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Создание объекта БПФ одинарной точности `fftf_t`
+
+Функция создает расписание `n`-точечного БПФ, рассчитывает
+поворотные коэффициенты одинарной точности и выделяет
+рабочую память объекта `fftf_t`. \n
+Размер БПФ раскладывается на этапы по основанию 16, на этапы
+по основаниям сгенерированных ядер (13, 11, 10, 12, 9, 25, 49, 15 и 6 
+в порядке приоритета скрипта fft_bfgen.py) и на этапы по основанию 
+7, 8, 5, 4, 3 и 2,
+которые рассчитываются векторными ядрами набора инструкций,
+выбранного функцией \ref fft_set_isa.
+Множитель \f$ m \f$, не делящийся на 2, 3, 5, 7, 11, 13, рассчитывается
+как ДПФ при \f$ m \leq 32\f$, иначе алгоритмом Блюстейна.
+Спектр ЛЧМ фильтра алгоритма Блюстейна и все поворотные коэффициенты
+рассчитываются с двойной точностью и затем округляются до `float`. \n
+Функции \ref fftf_cmplx, \ref ifftf_cmplx и \ref fftf
+вызывают `fftf_create` автоматически при изменении размера БПФ.
+
+\param[in,out]  pfft
+Указатель на структуру `fftf_t`.  \n
+Указатель не должен быть `NULL`.  \n \n
+
+\param[in]  n
+Размер БПФ \f$n\f$ (произвольное положительное целое). \n \n
+
+\return
+`RES_OK` если объект БПФ создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\note
+Объект должен быть очищен функцией \ref fftf_free.
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API fftf_create(fftf_t* pfft, int n)
+{
+    fftf_stage_t *st;
+    complex_t *cb = NULL;
+    fft_t fb = {0};
+    int s, r, g, k, m, i, nw, ns, nb, err;
+    double phi;
+
+    if(!pfft)
+        return ERROR_PTR;
+    if(n < 1)
+        return ERROR_FFT_SIZE;
+    if(pfft->n == n && pfft->isa == fft_get_isa())
+        return RES_OK;
+
+    fftf_free(pfft);
+    pfft->isa = fft_get_isa();
+
+    /* FFT schedule: radix 16, generated radixes (see fft_bfgen.py), 
+       7, 8, 5, 4, 3, 2 vector stages and the last stage of the other factor */
+    s = n;
+    nw = ns = nb = 0;
+    do
+    {
+        r = s;
+        g = fft_codelet_radix(s);
+        if     (s%16 == 0) r = 16;
+        else if(g     > 1) r =  g;
+        else if(s% 7 == 0) r =  7;
+        else if(s% 8 == 0) r =  8;
+        else if(s% 5 == 0) r =  5;
+        else if(s% 4 == 0) r =  4;
+        else if(s% 3 == 0) r =  3;
+        else if(s% 2 == 0) r =  2;
+
+        st = pfft->st ? 
+             (fftf_stage_t*) realloc(pfft->st, (ns+1)*sizeof(fftf_stage_t)):
+             (fftf_stage_t*) malloc(           (ns+1)*sizeof(fftf_stage_t));
+        if(!st)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+        pfft->st = st;
+        st += ns++;
+        st->n    = s;
+        st->n1   = r;
+        st->n2   = s / r;
+        st->addr = nw;
+        if(st->n2 > 1)
+        {
+            st->fn = fftf_codelet_vcol;
+            nw += s;
+        }
+        else if(fft_simd_radix(r))
+            st->fn = fftf_codelet_vrow;
+        else if(r <= FFT_BLUESTEIN_MIN)
+        {
+            st->fn = fftf_codelet_dft;
+            nw += r;
+        }
+        else
+        {
+            /* Bluestein algorithm: r-points chirp, nb-points chirp 
+               filter spectrum and the nb-points FFT schedule */
+            if(r > FFT_BLUESTEIN_MAX)
+            {
+                err = ERROR_FFT_SIZE;
+                goto error_proc;
+            }
+            st->fn = fftf_codelet_bluestein;
+            nb = 1;
+            while(nb < 2*r-1)
+                nb *= 2;
+            nw += r + nb;
+            s = nb;
+            continue;
+        }
+        s = st->n2;
+    } while(s > 1);
+    pfft->nst = ns;
+    pfft->nb  = nb;
+
+    pfft->w  = (complexf_t*) malloc((nw > 0 ? nw : 1) * sizeof(complexf_t));
+    pfft->wr = (complexf_t*) malloc((n/2+1) * sizeof(complexf_t));
+    pfft->t0 = (complexf_t*) malloc(n * sizeof(complexf_t));
+    pfft->t1 = (complexf_t*) malloc(n * sizeof(complexf_t));
+    if(!pfft->w || !pfft->wr || !pfft->t0 || !pfft->t1)
+    {
+        err = ERROR_MALLOC;
+        goto error_proc;
+    }
+
+    for(i = 0; i < ns; i++)
+    {
+        st = pfft->st + i;
+        s  = st->n;
+        /* vector codelet twiddle factors w[i + m*n2] = W_s^(i*m) */
+        if(st->fn == fftf_codelet_vcol)
+        {
+            for(m = 0; m < st->n1; m++)
+            {
+                for(k = 0; k < st->n2; k++)
+                {
+                    phi = - M_2PI * (double)(k*m) / (double)s;
+                    RE(pfft->w[st->addr + m*st->n2 + k]) = (float)cos(phi);
+                    IM(pfft->w[st->addr + m*st->n2 + k]) = (float)sin(phi);
+                }
+            }
+        }
+        if(st->fn == fftf_codelet_dft)
+        {
+            for(k = 0; k < s; k++)
+            {
+                phi = - M_2PI * (double)k / (double)s;
+                RE(pfft->w[st->addr + k]) = (float)cos(phi);
+                IM(pfft->w[st->addr + k]) = (float)sin(phi);
+            }
+        }
+        if(st->fn == fftf_codelet_bluestein)
+        {
+            /* chirp c(k) and the chirp filter spectrum by the 
+               double precision FFT with the 1/nb inverse FFT scale */
+            cb = (complex_t*) malloc(2*nb*sizeof(complex_t));
+            if(!cb)
+            {
+                err = ERROR_MALLOC;
+                goto error_proc;
+            }
+            memset(cb, 0, nb*sizeof(complex_t));
+            for(k = 0; k < s; k++)
+            {
+                phi = - M_PI * (double)(((long long)k*k) % (2*s)) / 
+                               (double)s;
+                RE(pfft->w[st->addr + k]) = (float)cos(phi);
+                IM(pfft->w[st->addr + k]) = (float)sin(phi);
+                RE(cb[k]) =  cos(phi);
+                IM(cb[k]) = -sin(phi);
+                if(k)
+                {
+                    RE(cb[nb-k]) = RE(cb[k]);
+                    IM(cb[nb-k]) = IM(cb[k]);
+                }
+            }
+            err = fft_cmplx(cb, nb, &fb, cb + nb);
+            fft_free(&fb);
+            if(err != RES_OK)
+                goto error_proc;
+            phi = 1.0 / (double)nb;
+            for(k = 0; k < nb; k++)
+            {
+                RE(pfft->w[st->addr + s + k]) = (float)(RE(cb[nb + k]) * phi);
+                IM(pfft->w[st->addr + s + k]) = (float)(IM(cb[nb + k]) * phi);
+            }
+            free(cb);
+            cb = NULL;
+        }
+    }
+
+    /* real FFT split twiddle factors W_{2n}^k, k = 0 ... n/2 */
+    for(k = 0; k < n/2+1; k++)
+    {
+        phi = - M_PI * (double)k / (double)n;
+        RE(pfft->wr[k]) = (float)cos(phi);
+        IM(pfft->wr[k]) = (float)sin(phi);
+    }
+
+    /* Bluestein algorithm workspace */
+    if(nb)
+    {
+        pfft->tb = (complexf_t*) malloc(2*nb*sizeof(complexf_t));
+        if(!pfft->tb)
+        {
+            err = ERROR_MALLOC;
+            goto error_proc;
+        }
+    }
+    pfft->n = n;
+    return RES_OK;
+
+error_proc:
+    if(cb)
+        free(cb);
+    fftf_free(pfft);
+    return err;
+}
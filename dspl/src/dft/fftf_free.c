@@ -0,0 +1,77 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP            
+\brief Free `fftf_t` structure.
+
+The function clears the schedule, the twiddle factors
+and the workspace memory of the single precision FFT object `fftf_t`.
+
+\param[in] pfft
+Pointer to the `fftf_t` object. \n
+
+\author Sergey Bakhurin www.dsplib.org 
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Очистить структуру `fftf_t` алгоритма БПФ одинарной точности
+
+Функция производит очищение памяти расписания, поворотных коэффициентов
+и рабочей памяти объекта БПФ одинарной точности `fftf_t`.
+
+\param[in] pfft
+Указатель на структуру `fftf_t`. \n
+
+\author Бахурин Сергей www.dsplib.org 
+***************************************************************************** */
+#endif
+void DSPL_API fftf_free(fftf_t *pfft)
+{
+    if(!pfft)
+        return;
+    if(pfft->w)
+        free(pfft->w);
+    if(pfft->wr)
+        free(pfft->wr);
+    if(pfft->t0)
+        free(pfft->t0);
+    if(pfft->t1)
+        free(pfft->t1);
+    if(pfft->tb)
+        free(pfft->tb);
+    if(pfft->st)
+        free(pfft->st);
+    memset(pfft, 0, sizeof(fftf_t));
+}
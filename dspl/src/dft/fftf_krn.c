@@ -0,0 +1,92 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+int fftf_krn(complexf_t* t0, complexf_t* t1, fftf_t* p)
+{
+    fftf_run(t0, t1, p, p->st, 1);
+    return RES_OK;
+}
+
+
+
+
+void fftf_run(complexf_t* t0, complexf_t* t1, fftf_t* p, 
+              fftf_stage_t* s, int cnt)
+{
+    int k, m, nc;
+
+    /* last stage codelets */
+    if(s->n2 == 1)
+    {
+        s->fn(t0, t1, cnt, p, s);
+        return;
+    }
+
+    /* large blocks are processed one by one to keep 
+       the sub-blocks data in cache */
+    nc = s->n > FFT_FLAT_MAX ? 1 : cnt;
+    for(k = 0; k < cnt; k += nc)
+    {
+        /* n2 vector DFTs of n1 points with twiddle factors,
+           n1 FFTs of n2 points by the next stages and output transpose */
+        s->fn(t0, t1, nc, p, s);
+        fftf_run(t1, t0, p, s+1, nc * s->n1);
+        for(m = 0; m < nc; m++)
+            fftf_transpose(t0 + m*s->n, s->n2, s->n1, t1 + m*s->n);
+        t0 += nc * s->n;
+        t1 += nc * s->n;
+    }
+}
+
+
+
+
+void fftf_transpose(complexf_t* a, int n, int m, complexf_t* b)
+{
+    int p, q, i, j, i1, j1;
+
+    for(p = 0; p < n; p += DSPL_MATRIX_BLOCK)
+    {
+        i1 = p + DSPL_MATRIX_BLOCK < n ? p + DSPL_MATRIX_BLOCK : n;
+        for(q = 0; q < m; q += DSPL_MATRIX_BLOCK)
+        {
+            j1 = q + DSPL_MATRIX_BLOCK < m ? q + DSPL_MATRIX_BLOCK : m;
+            for(i = p; i < i1; i++)
+            {
+                for(j = q; j < j1; j++)
+                {
+                    RE(b[i*m + j]) = RE(a[j*n + i]);
+                    IM(b[i*m + j]) = IM(a[j*n + i]);
+                }
+            }
+        }
+    }
+}
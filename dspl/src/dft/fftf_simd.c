@@ -0,0 +1,359 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FFT_SIMD_X86
+#include <immintrin.h>
+#endif
+
+
+#define FFT_CT              complexf_t
+#define FFT_VKRN_T          fftf_vkrn_t
+
+
+
+/*******************************************************************************
+Scalar kernels: one complex value per "vector".
+The kernels are used on any CPU and process the tail vectors
+of the vector kernels.
+*******************************************************************************/
+typedef struct
+{
+    float re;
+    float im;
+} fftf_sv_t;
+
+static inline fftf_sv_t fftf_sv_ld(complexf_t* p)
+{
+    fftf_sv_t a;
+    a.re = RE(p[0]);
+    a.im = IM(p[0]);
+    return a;
+}
+
+static inline void fftf_sv_st(complexf_t* p, fftf_sv_t a)
+{
+    RE(p[0]) = a.re;
+    IM(p[0]) = a.im;
+}
+
+static inline fftf_sv_t fftf_sv_add(fftf_sv_t a, fftf_sv_t b)
+{
+    a.re += b.re;
+    a.im += b.im;
+    return a;
+}
+
+static inline fftf_sv_t fftf_sv_sub(fftf_sv_t a, fftf_sv_t b)
+{
+    a.re -= b.re;
+    a.im -= b.im;
+    return a;
+}
+
+static inline fftf_sv_t fftf_sv_scl(fftf_sv_t a, float r)
+{
+    a.re *= r;
+    a.im *= r;
+    return a;
+}
+
+static inline fftf_sv_t fftf_sv_mulnj(fftf_sv_t a)
+{
+    fftf_sv_t b;
+    b.re =  a.im;
+    b.im = -a.re;
+    return b;
+}
+
+static inline fftf_sv_t fftf_sv_cmul(fftf_sv_t a, fftf_sv_t w)
+{
+    fftf_sv_t b;
+    b.re = a.re * w.re - a.im * w.im;
+    b.im = a.re * w.im + a.im * w.re;
+    return b;
+}
+
+#define FFT_V               fftf_sv_t
+#define FFT_VN              1
+#define FFT_TARGET
+#define FFT_SFX(f)          f##_scalar_f
+#define FFT_VLD(p)          fftf_sv_ld(p)
+#define FFT_VST(p, a)       fftf_sv_st((p), (a))
+#define FFT_VLDS(p, s)      FFT_VLD(p)
+#define FFT_VSTS(p, s, a)   FFT_VST(p, a)
+#define FFT_VADD(a, b)      fftf_sv_add((a), (b))
+#define FFT_VSUB(a, b)      fftf_sv_sub((a), (b))
+#define FFT_VSCL(a, r)      fftf_sv_scl((a), (float)(r))
+#define FFT_VMULNJ(a)       fftf_sv_mulnj(a)
+#define FFT_VCMUL(a, w)     fftf_sv_cmul((a), (w))
+
+#include "fft_simd_krn.h"
+
+#undef FFT_V
+#undef FFT_VN
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VLD
+#undef FFT_VST
+#undef FFT_VLDS
+#undef FFT_VSTS
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+#undef FFT_VCMUL
+
+
+
+#ifdef FFT_SIMD_X86
+
+/* SSE two complex values p[0] and p[s] load and store */
+#define FFTF_VLD2(p, s)                                                      \
+    _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((double*)(p))),                   \
+                 (__m64*)((p)+(s)))
+#define FFTF_VST2(p, s, a)                                                   \
+    do{                                                                      \
+        _mm_storel_pi((__m64*)(p),       (a));                               \
+        _mm_storeh_pi((__m64*)((p)+(s)), (a));                               \
+    }while(0)
+
+/* AVX four complex values p[0], p[s], p[2s], p[3s] load and store */
+#define FFTF_VLD4(p, s)                                                      \
+    _mm256_insertf128_ps(_mm256_castps128_ps256(FFTF_VLD2((p), (s))),        \
+                         FFTF_VLD2((p)+2*(s), (s)), 1)
+#define FFTF_VST4(p, s, a)                                                   \
+    do{                                                                      \
+        __m128 lo4_ = _mm256_castps256_ps128(a);                             \
+        __m128 hi4_ = _mm256_extractf128_ps((a), 1);                         \
+        FFTF_VST2((p), (s), lo4_);                                           \
+        FFTF_VST2((p)+2*(s), (s), hi4_);                                     \
+    }while(0)
+
+
+
+/*******************************************************************************
+SSE2 kernels: two complex values per vector
+*******************************************************************************/
+#define FFT_V               __m128
+#define FFT_VN              2
+#define FFT_TARGET          __attribute__((target("sse2")))
+#define FFT_SFX(f)          f##_sse2_f
+#define FFT_VLD(p)          _mm_loadu_ps((float*)(p))
+#define FFT_VST(p, a)       _mm_storeu_ps((float*)(p), (a))
+#define FFT_VLDS(p, s)      FFTF_VLD2(p, s)
+#define FFT_VSTS(p, s, a)   FFTF_VST2(p, s, a)
+#define FFT_VADD(a, b)      _mm_add_ps((a), (b))
+#define FFT_VSUB(a, b)      _mm_sub_ps((a), (b))
+#define FFT_VSCL(a, r)      _mm_mul_ps((a), _mm_set1_ps((float)(r)))
+#define FFT_VMULNJ(a)       _mm_xor_ps(_mm_shuffle_ps((a), (a), 0xB1),       \
+                                       _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f))
+#define FFT_VCMUL(a, w)                                                      \
+    _mm_add_ps(_mm_mul_ps((a), _mm_shuffle_ps((w), (w), 0xA0)),              \
+               _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps((a), (a), 0xB1),         \
+                                     _mm_shuffle_ps((w), (w), 0xF5)),        \
+                          _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f)))
+
+#include "fft_simd_krn.h"
+
+#undef FFT_V
+#undef FFT_VN
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VLD
+#undef FFT_VST
+#undef FFT_VLDS
+#undef FFT_VSTS
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+#undef FFT_VCMUL
+
+
+
+/*******************************************************************************
+AVX2 and FMA kernels: four complex values per vector
+*******************************************************************************/
+#define FFT_V               __m256
+#define FFT_VN              4
+#define FFT_TARGET          __attribute__((target("avx2,fma")))
+#define FFT_SFX(f)          f##_avx2_f
+#define FFT_VLD(p)          _mm256_loadu_ps((float*)(p))
+#define FFT_VST(p, a)       _mm256_storeu_ps((float*)(p), (a))
+#define FFT_VLDS(p, s)      FFTF_VLD4(p, s)
+#define FFT_VSTS(p, s, a)   FFTF_VST4(p, s, a)
+#define FFT_VADD(a, b)      _mm256_add_ps((a), (b))
+#define FFT_VSUB(a, b)      _mm256_sub_ps((a), (b))
+#define FFT_VSCL(a, r)      _mm256_mul_ps((a), _mm256_set1_ps((float)(r)))
+#define FFT_VMULNJ(a)                                                        \
+    _mm256_xor_ps(_mm256_permute_ps((a), 0xB1),                              \
+                  _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f,                    \
+                                -0.0f, 0.0f, -0.0f, 0.0f))
+#define FFT_VCMUL(a, w)                                                      \
+    _mm256_fmaddsub_ps((a), _mm256_moveldup_ps(w),                           \
+                       _mm256_mul_ps(_mm256_permute_ps((a), 0xB1),           \
+                                     _mm256_movehdup_ps(w)))
+
+#include "fft_simd_krn.h"
+
+#undef FFT_V
+#undef FFT_VN
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VLD
+#undef FFT_VST
+#undef FFT_VLDS
+#undef FFT_VSTS
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+#undef FFT_VCMUL
+
+
+
+/*******************************************************************************
+AVX-512 kernels: eight complex values per vector
+*******************************************************************************/
+#define FFT_V               __m512
+#define FFT_VN              8
+#define FFT_TARGET          __attribute__((target("avx512f,avx2,fma")))
+#define FFT_SFX(f)          f##_avx512_f
+#define FFT_VLD(p)          _mm512_loadu_ps((float*)(p))
+#define FFT_VST(p, a)       _mm512_storeu_ps((float*)(p), (a))
+#define FFT_VLDS(p, s)                                                       \
+    _mm512_castpd_ps(_mm512_insertf64x4(                                     \
+        _mm512_castpd256_pd512(_mm256_castps_pd(FFTF_VLD4((p), (s)))),       \
+        _mm256_castps_pd(FFTF_VLD4((p)+4*(s), (s))), 1))
+#define FFT_VSTS(p, s, a)                                                    \
+    do{                                                                      \
+        __m256 lo8_ = _mm512_castps512_ps256(a);                             \
+        __m256 hi8_ = _mm256_castpd_ps(                                      \
+                      _mm512_extractf64x4_pd(_mm512_castps_pd(a), 1));       \
+        FFTF_VST4((p), (s), lo8_);                                           \
+        FFTF_VST4((p)+4*(s), (s), hi8_);                                     \
+    }while(0)
+#define FFT_VADD(a, b)      _mm512_add_ps((a), (b))
+#define FFT_VSUB(a, b)      _mm512_sub_ps((a), (b))
+#define FFT_VSCL(a, r)      _mm512_mul_ps((a), _mm512_set1_ps((float)(r)))
+#define FFT_VMULNJ(a)                                                        \
+    _mm512_castsi512_ps(_mm512_xor_si512(                                    \
+        _mm512_castps_si512(_mm512_permute_ps((a), 0xB1)),                   \
+        _mm512_castps_si512(_mm512_set_ps(-0.0f, 0.0f, -0.0f, 0.0f,          \
+                                          -0.0f, 0.0f, -0.0f, 0.0f,          \
+                                          -0.0f, 0.0f, -0.0f, 0.0f,          \
+                                          -0.0f, 0.0f, -0.0f, 0.0f))))
+#define FFT_VCMUL(a, w)                                                      \
+    _mm512_fmaddsub_ps((a), _mm512_moveldup_ps(w),                           \
+                       _mm512_mul_ps(_mm512_permute_ps((a), 0xB1),           \
+                                     _mm512_movehdup_ps(w)))
+
+#include "fft_simd_krn.h"
+
+#undef FFT_V
+#undef FFT_VN
+#undef FFT_TARGET
+#undef FFT_SFX
+#undef FFT_VLD
+#undef FFT_VST
+#undef FFT_VLDS
+#undef FFT_VSTS
+#undef FFT_VADD
+#undef FFT_VSUB
+#undef FFT_VSCL
+#undef FFT_VMULNJ
+#undef FFT_VCMUL
+#undef FFTF_VLD2
+#undef FFTF_VST2
+#undef FFTF_VLD4
+#undef FFTF_VST4
+
+#endif /* FFT_SIMD_X86 */
+
+#undef FFT_CT
+#undef FFT_VKRN_T
+
+
+
+
+/*******************************************************************************
+Single precision kernels of the isa instruction set and of the narrower
+instruction sets. The scalar kernel is the last one.
+Function returns the number of kernels.
+*******************************************************************************/
+int fftf_simd_chain(int isa, int r, int row, fftf_vkrn_t* krn)
+{
+    int k = 0;
+#ifdef FFT_SIMD_X86
+    if(isa >= FFT_ISA_AVX512)
+        krn[k++] = fft_vkrn_avx512_f(r, row);
+    if(isa >= FFT_ISA_AVX2)
+        krn[k++] = fft_vkrn_avx2_f(r, row);
+    if(isa >= FFT_ISA_SSE2)
+        krn[k++] = fft_vkrn_sse2_f(r, row);
+#endif
+    krn[k++] = fft_vkrn_scalar_f(r, row);
+    return k;
+}
+
+
+
+
+void fftf_codelet_vcol(complexf_t* x, complexf_t* y, int cnt,
+                       fftf_t* p, fftf_stage_t* s)
+{
+    fftf_vkrn_t krn[4];
+    complexf_t* w = p->w + s->addr;
+    int b, i, v, nk;
+
+    nk = fftf_simd_chain(p->isa, s->n1, 0, krn);
+    for(b = 0; b < cnt; b++)
+    {
+        v = 0;
+        for(i = 0; i < nk; i++)
+            v = krn[i](x, y, w, v, s->n2, s->n2);
+        x += s->n;
+        y += s->n;
+    }
+}
+
+
+
+
+void fftf_codelet_vrow(complexf_t* x, complexf_t* y, int cnt,
+                       fftf_t* p, fftf_stage_t* s)
+{
+    fftf_vkrn_t krn[4];
+    int i, v, nk;
+
+    nk = fftf_simd_chain(p->isa, s->n1, 1, krn);
+    v = 0;
+    for(i = 0; i < nk; i++)
+        v = krn[i](x, y, NULL, v, cnt, s->n1);
+}
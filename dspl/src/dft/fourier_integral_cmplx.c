@@ -22,7 +22,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <float.h>
 #include "dspl.h"
+#include "dft.h"
 
 
 #ifdef DOXYGEN_ENGLISH
@@ -35,6 +37,7 @@ int DSPL_API fourier_integral_cmplx(double* t, complex_t* s, int nt,
             int nw, double* w, complex_t* y)
 {
     int k, m;
+    double w0, dw;
     complex_t e[2];
 
     if(!t || !s || !w || !y)
@@ -42,6 +45,9 @@ int DSPL_API fourier_integral_cmplx(double* t, complex_t* s, int nt,
     if(nt<1 || nw < 1)
         return ERROR_SIZE;
 
+    /* uniform frequencies grid: type 1 NUFFT */
+    if(nufft_uniform(w, nw, &w0, &dw) && nufft_fast(nt, nw, NUFFT_EPS))
+        return nufft_fourier_integral(t, s, nt, w0, dw, nw, y);
 
     memset(y, 0 , nw*sizeof(complex_t));
 
@@ -22,7 +22,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <float.h>
 #include "dspl.h"
+#include "dft.h"
 
 
 
@@ -72,10 +74,12 @@ Memory must be allocated. \n
 Else \ref ERROR_CODE_GROUP "code error".
 
 \note
-Numerical integration is used for Fourier series coefficients calculation.
-This function is not effective. 
-To increase the speed of calculation of the signal spectrum
-it is more expedient to use fast Fourier transform algorithms.
+Numerical integration by the trapezoidal rule is used 
+for Fourier series coefficients calculation.
+The integrals of all `nw` frequencies are calculated by the type 1 
+non-uniform FFT (see \ref nufft1_cmplx) with the relative accuracy 
+\f$ 10^{-12} \f$ in \f$ O(n_t + n_w \log n_w) \f$ operations, 
+the small sizes are integrated directly.
 \n
 
 \author Sergey Bakhurin www.dsplib.org
@@ -134,10 +138,11 @@ it is more expedient to use fast Fourier transform algorithms.
 
 \note
 Для расчета спектра сигнала используется численное интегрирование
-исходного сигнала методом трапеций. Данная функция не является
-эффективной. Для увеличения скорости расчета спектра сигнала
-целесообразнее использовать алгоритмы дискретного
-и быстрого преобразования Фурье.
+исходного сигнала методом трапеций. Интегралы всех `nw` частот
+рассчитываются неравномерным БПФ первого типа (см. \ref nufft1_cmplx)
+с относительной точностью \f$ 10^{-12} \f$ за 
+\f$ O(n_t + n_w \log n_w) \f$ операций, при малых размерах
+интегрирование производится непосредственно.
 \n
 
 \author Бахурин Сергей www.dsplib.org
@@ -146,9 +151,10 @@ it is more expedient to use fast Fourier transform algorithms.
 int DSPL_API fourier_series_dec(double* t, double* s, int nt, double period,
                                                                 int nw, double* w, complex_t* y)
 {
-    int k, m;
+    int k, m, err;
     double dw = M_2PI / period;
     complex_t e[2];
+    complex_t *sc = NULL;
 
     if(!t || !s || !w || !y)
         return ERROR_PTR;
@@ -157,11 +163,33 @@ int DSPL_API fourier_series_dec(double* t, double* s, int nt, double period,
     if(period <= 0.0)
         return ERROR_NEGATIVE;
 
+    for(k = 0; k < nw; k++)
+        w[k] = (k - nw/2) * dw;
+
+    if(nufft_fast(nt, nw, NUFFT_EPS))
+    {
+        sc = (complex_t*) malloc(nt * sizeof(complex_t));
+        if(!sc)
+            return ERROR_MALLOC;
+        re2cmplx(s, nt, sc);
+        err = nufft_fourier_integral(t, sc, nt, w[0], dw, nw, y);
+        free(sc);
+        if(err != RES_OK)
+            return err;
+        for(k = 0; k < nw; k++)
+        {
+            RE(y[k]) /= period;
+            IM(y[k]) /= period;
+        }
+        if(!(nw%2))
+            RE(y[0]) = RE(y[1]) = 0.0;
+        return RES_OK;
+    }
+
     memset(y, 0 , nw*sizeof(complex_t));
 
     for(k = 0; k < nw; k++)
     {
-        w[k] = (k - nw/2) * dw;
         RE(e[1]) =    s[0] * cos(w[k] * t[0]);
         IM(e[1]) = -s[0] * sin(w[k] * t[0]);
         for(m = 1; m < nt; m++)
@@ -22,7 +22,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <float.h>
 #include "dspl.h"
+#include "dft.h"
 
 
 #ifdef DOXYGEN_ENGLISH
@@ -34,7 +36,7 @@
 int DSPL_API fourier_series_dec_cmplx(double* t, complex_t* s, int nt,
             double period, int nw, double* w, complex_t* y)
 {
-    int k, m;
+    int k, m, err;
     double dw = M_2PI / period;
     complex_t e[2];
 
@@ -45,11 +47,28 @@ int DSPL_API fourier_series_dec_cmplx(double* t, complex_t* s, int nt,
     if(period <= 0.0)
         return ERROR_NEGATIVE;
 
+    for(k = 0; k < nw; k++)
+        w[k] = (k - nw/2) * dw;
+
+    if(nufft_fast(nt, nw, NUFFT_EPS))
+    {
+        err = nufft_fourier_integral(t, s, nt, w[0], dw, nw, y);
+        if(err != RES_OK)
+            return err;
+        for(k = 0; k < nw; k++)
+        {
+            RE(y[k]) /= period;
+            IM(y[k]) /= period;
+        }
+        if(!(nw%2))
+            RE(y[0]) = RE(y[1]) = 0.0;
+        return RES_OK;
+    }
+
     memset(y, 0 , nw*sizeof(complex_t));
 
     for(k = 0; k < nw; k++)
     {
-        w[k] = (k - nw/2) * dw;
         RE(e[1]) =    RE(s[0]) * cos(w[k] * t[0]) +
         IM(s[0]) * sin(w[k] * t[0]);
         IM(e[1]) = -RE(s[0]) * sin(w[k] * t[0]) +
@@ -22,7 +22,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <float.h>
 #include "dspl.h"
+#include "dft.h"
 
 
 #ifdef DOXYGEN_ENGLISH
@@ -77,6 +79,10 @@ However, subject to the symmetry properties of the vectors `w` and` s`
 with respect to zero frequency we get the imaginary part of the vector `y` 
 at the EPS level. The negligible imaginary part in this case
 can be ignored.
+
+If the frequencies `w` are the uniform grid, the signal is calculated 
+by the type 2 non-uniform FFT (see \ref nufft2_cmplx) with the relative
+accuracy \f$ 10^{-12} \f$ in \f$ O(n_t + n_w \log n_w) \f$ operations.
 \n
 
 \author Sergey Bakhurin www.dsplib.org
@@ -137,6 +143,10 @@ s(t) = \sum\limits_{n = 0}^{n_{\omega}-1} S(\omega_n) \exp(j\omega_n t)
 нулевой частоты получим мнимую часть элементов вектора `y` на уровне ошибок
 округления числа с двойной точностью. Ничтожно малую мнимую часть в этом случае
 можно игнорировать.
+
+Если частоты `w` образуют равномерную сетку, то сигнал рассчитывается
+неравномерным БПФ второго типа (см. \ref nufft2_cmplx) с относительной
+точностью \f$ 10^{-12} \f$ за \f$ O(n_t + n_w \log n_w) \f$ операций.
 \n
 
 \author Бахурин Сергей www.dsplib.org
@@ -146,6 +156,7 @@ int DSPL_API fourier_series_rec(double* w, complex_t* s, int nw,
                         double* t, int nt, complex_t* y)
 {
     int k, m;
+    double w0, dw;
     complex_t e;
 
     if(!t || !s || !w || !y)
@@ -153,6 +164,10 @@ int DSPL_API fourier_series_rec(double* w, complex_t* s, int nw,
     if(nt<1 || nw < 1)
         return ERROR_SIZE;
 
+    /* uniform frequencies grid: type 2 NUFFT */
+    if(nufft_uniform(w, nw, &w0, &dw) && nufft_fast(nt, nw, NUFFT_EPS))
+        return nufft_fourier_series(w0, dw, s, nw, t, nt, y);
+
     memset(y, 0, nt*sizeof(complex_t));
 
 
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "dspl.h"
+#include "dft.h"
 
 
 #ifdef DOXYGEN_ENGLISH
@@ -68,6 +69,12 @@ can also be arbitrary integers, including negative ones.
 In this case, the DFT samples will be calculated.
 with indices modulo `n`. \n
 
+All `k` samples are calculated by one pass of the input signal
+by the multi-bin Goertzel algorithm (see \ref goertzel_update).
+If the FFT of the signal requires less operations
+(`k` is large relative to \f$ \log_2 n \f$),
+the samples are taken from the `n`-points FFT. \n
+
 \author Sergey Bakhurin www.dsplib.org
 ***************************************************************************** */
 #endif
@@ -117,16 +124,21 @@ with indices modulo `n`. \n
 В этом случае будут рассчитаны спектральные отсчеты 
 с индексами по модулю `n`. \n
 
+Все `k` отсчетов рассчитываются за один проход входного сигнала
+алгоритмом Гёрцеля для нескольких отсчетов (см. \ref goertzel_update).
+Если БПФ сигнала требует меньше операций
+(`k` велико относительно \f$ \log_2 n \f$),
+то отсчеты берутся из `n`-точечного БПФ. \n
+
 \author Бахурин Сергей www.dsplib.org
 ***************************************************************************** */
 #endif
 int DSPL_API goertzel(double *x, int n, int *ind, int k, complex_t *y)
 {
-
-    int m, p;
-    double wR, wI;
-    double alpha;
-    double v[3];
+    goertzel_t g = {0};
+    fft_t pfft = {0};
+    complex_t *t = NULL;
+    int p, m, err;
 
     if(!x || !y || !ind)
         return ERROR_PTR;
@@ -134,22 +146,42 @@ int DSPL_API goertzel(double *x, int n, int *ind, int k, complex_t *y)
     if(n < 1 || k < 1)
         return ERROR_SIZE;
 
-    for(p = 0; p < k; p++)
+    if(goertzel_use_fft(n, k))
     {
-        wR = cos(M_2PI * (double)ind[p] / (double)n);
-        wI = sin(M_2PI * (double)ind[p] / (double)n);
-
-        alpha = 2.0 * wR;
-        v[0] = v[1] = v[2] = 0.0;
-
-        for(m = 0; m < n; m++)
+        /* n/2+1 bins of the real FFT, the rest are complex conjugated */
+        t = (complex_t*) malloc((n/2+1) * sizeof(complex_t));
+        if(!t)
+            return ERROR_MALLOC;
+        err = fft_r2c(x, n, &pfft, t);
+        if(err == RES_OK)
         {
-            v[2] = v[1];
-            v[1] = v[0];
-            v[0] = x[m]+alpha*v[1] - v[2];
+            for(p = 0; p < k; p++)
+            {
+                m = ind[p] % n;
+                if(m < 0)
+                    m += n;
+                if(m > n/2)
+                {
+                    RE(y[p]) =  RE(t[n-m]);
+                    IM(y[p]) = -IM(t[n-m]);
+                }
+                else
+                {
+                    RE(y[p]) = RE(t[m]);
+                    IM(y[p]) = IM(t[m]);
+                }
+            }
         }
-        RE(y[p]) = wR * v[0] - v[1];
-        IM(y[p]) = wI * v[0];
+        fft_free(&pfft);
+        free(t);
+        return err;
     }
-    return RES_OK;
+
+    err = goertzel_create(&g, n, ind, k);
+    if(err == RES_OK)
+        err = goertzel_update(&g, x, n);
+    if(err == RES_OK)
+        err = goertzel_result(&g, y);
+    goertzel_free(&g);
+    return err;
 }
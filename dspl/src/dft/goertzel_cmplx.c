@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "dspl.h"
+#include "dft.h"
 
 
 
@@ -70,6 +71,12 @@ can also be arbitrary integers, including negative ones.
 In this case, the DFT samples will be calculated.
 with indices modulo `n`. \n
 
+All `k` samples are calculated by one pass of the input signal
+by the multi-bin Goertzel algorithm (see \ref goertzel_update).
+If the FFT of the signal requires less operations
+(`k` is large relative to \f$ \log_2 n \f$),
+the samples are taken from the `n`-points FFT. \n
+
 \author Sergey Bakhurin www.dsplib.org
 ***************************************************************************** */
 #endif
@@ -117,18 +124,23 @@ with indices modulo `n`. \n
 Значения индексов спектральных отсчетов `ind` также могут быть 
 произвольными целыми, в том числе и отрицательными. 
 В этом случае будут рассчитаны спектральные отсчеты с индексами
-по модулю `n`. \n \n
+по модулю `n`. \n
+
+Все `k` отсчетов рассчитываются за один проход входного сигнала
+алгоритмом Гёрцеля для нескольких отсчетов (см. \ref goertzel_update).
+Если БПФ сигнала требует меньше операций
+(`k` велико относительно \f$ \log_2 n \f$),
+то отсчеты берутся из `n`-точечного БПФ. \n \n
 
 \author Бахурин Сергей www.dsplib.org
 ***************************************************************************** */
 #endif
 int DSPL_API goertzel_cmplx(complex_t *x, int n, int *ind, int k, complex_t *y)
 {
-
-    int m, p;
-    complex_t w;
-    double alpha;
-    complex_t v[3];
+    goertzel_t g = {0};
+    fft_t pfft = {0};
+    complex_t *t = NULL;
+    int p, m, err;
 
     if(!x || !y || !ind)
         return ERROR_PTR;
@@ -136,29 +148,33 @@ int DSPL_API goertzel_cmplx(complex_t *x, int n, int *ind, int k, complex_t *y)
     if(n < 1 || k < 1)
         return ERROR_SIZE;
 
-    for(p = 0; p < k; p++)
+    if(goertzel_use_fft(n, k))
     {
-        RE(w) = cos(M_2PI * (double)ind[p] / (double)n);
-        IM(w) = sin(M_2PI * (double)ind[p] / (double)n);
-
-        alpha = 2.0 * RE(w);
-        memset(v, 0, 3*sizeof(complex_t));
-
-        for(m = 0; m < n; m++)
+        t = (complex_t*) malloc(n * sizeof(complex_t));
+        if(!t)
+            return ERROR_MALLOC;
+        err = fft_cmplx(x, n, &pfft, t);
+        if(err == RES_OK)
         {
-            RE(v[2]) = RE(v[1]);
-            RE(v[1]) = RE(v[0]);
-            RE(v[0]) = RE(x[m]) + alpha * RE(v[1]) - RE(v[2]);
-
-            IM(v[2]) = IM(v[1]);
-            IM(v[1]) = IM(v[0]);
-            IM(v[0]) = IM(x[m]) + alpha * IM(v[1]) - IM(v[2]);
+            for(p = 0; p < k; p++)
+            {
+                m = ind[p] % n;
+                if(m < 0)
+                    m += n;
+                RE(y[p]) = RE(t[m]);
+                IM(y[p]) = IM(t[m]);
+            }
         }
-
-        RE(y[p]) = CMRE(w, v[0]) - RE(v[1]);
-        IM(y[p]) = CMIM(w, v[0]) - IM(v[1]);
+        fft_free(&pfft);
+        free(t);
+        return err;
     }
 
-    return RES_OK;
+    err = goertzel_create(&g, n, ind, k);
+    if(err == RES_OK)
+        err = goertzel_update_cmplx(&g, x, n);
+    if(err == RES_OK)
+        err = goertzel_result(&g, y);
+    goertzel_free(&g);
+    return err;
 }
-
@@ -0,0 +1,143 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Create the multi-bin Goertzel algorithm object.
+
+The function calculates the resonators coefficients of the `k` bins
+of the `n`-points DFT given by the indexes vector `ind`
+and resets the resonators states (see \ref goertzel_update). \n
+The coefficients are calculated once and they are used
+for any number of the signal frames.
+
+\param[in,out]  pg
+Pointer to the `goertzel_t` object. \n
+Pointer cannot be `NULL`. \n
+The object must be zeroed before the first call.
+The previous state of the object is cleared. \n \n
+
+\param[in]  n
+DFT size. \n \n
+
+\param[in]  ind
+Pointer to the DFT bins indexes. \n
+Vector size is `[k x 1]`. \n
+The indexes can be arbitrary integers and they are taken modulo `n`. \n \n
+
+\param[in]  k
+Number of the bins. \n \n
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Создание объекта алгоритма Гёрцеля для нескольких отсчетов ДПФ
+
+Функция рассчитывает коэффициенты резонаторов `k` отсчетов
+`n`-точечного ДПФ, заданных вектором индексов `ind`,
+и сбрасывает состояния резонаторов (см. \ref goertzel_update). \n
+Коэффициенты рассчитываются один раз и используются
+для любого количества кадров сигнала.
+
+\param[in,out]  pg
+Указатель на объект `goertzel_t`. \n
+Указатель не должен быть `NULL`. \n
+Объект должен быть обнулен перед первым вызовом.
+Предыдущее состояние объекта очищается. \n \n
+
+\param[in]  n
+Размер ДПФ. \n \n
+
+\param[in]  ind
+Указатель на индексы отсчетов ДПФ. \n
+Размер вектора `[k x 1]`. \n
+Индексы могут быть произвольными целыми и берутся по модулю `n`. \n \n
+
+\param[in]  k
+Количество отсчетов ДПФ. \n \n
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API goertzel_create(goertzel_t* pg, int n, int* ind, int k)
+{
+    double phi;
+    int i, m, kp;
+
+    if(!pg || !ind)
+        return ERROR_PTR;
+    if(n < 1 || k < 1)
+        return ERROR_SIZE;
+
+    goertzel_free(pg);
+
+    /* zero coefficients resonators pad the vectors to the kernel tile */
+    kp = GOERTZEL_KP(k);
+    pg->a   = (double*)    malloc(kp * sizeof(double));
+    pg->w   = (complex_t*) malloc(k * sizeof(complex_t));
+    pg->s   = (double*)    malloc(4 * kp * sizeof(double));
+    pg->ind = (int*)       malloc(k * sizeof(int));
+    if(!pg->a || !pg->w || !pg->s || !pg->ind)
+    {
+        goertzel_free(pg);
+        return ERROR_MALLOC;
+    }
+
+    for(i = 0; i < k; i++)
+    {
+        m = ind[i] % n;
+        if(m < 0)
+            m += n;
+        pg->ind[i] = m;
+        phi = M_2PI * (double)m / (double)n;
+        RE(pg->w[i]) = cos(phi);
+        IM(pg->w[i]) = sin(phi);
+        pg->a[i] = 2.0 * RE(pg->w[i]);
+    }
+    for(; i < kp; i++)
+        pg->a[i] = 0.0;
+    pg->n = n;
+    pg->k = k;
+    return goertzel_reset(pg);
+}
@@ -0,0 +1,75 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Free `goertzel_t` structure.
+
+The function clears the coefficients and the resonators states
+of the `goertzel_t` structure.
+
+\param[in] pg
+Pointer to the `goertzel_t` object. \n
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Очистить структуру `goertzel_t` алгоритма Гёрцеля
+
+Функция очищает коэффициенты и состояния резонаторов
+структуры `goertzel_t`.
+
+\param[in] pg
+Указатель на структуру `goertzel_t`. \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+void DSPL_API goertzel_free(goertzel_t* pg)
+{
+    if(!pg)
+        return;
+    if(pg->a)
+        free(pg->a);
+    if(pg->w)
+        free(pg->w);
+    if(pg->s)
+        free(pg->s);
+    if(pg->ind)
+        free(pg->ind);
+
+    memset(pg, 0, sizeof(goertzel_t));
+}
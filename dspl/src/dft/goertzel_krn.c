@@ -0,0 +1,175 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GOERTZEL_SIMD_X86
+#include <immintrin.h>
+#endif
+
+
+/* Resonators tiles: the tile states are kept in registers 
+   and the tile resonators are the independent chains. 
+   The tile of nv vectors (nv is a constant after inlining)
+   is updated by cnt samples x[m*step] */
+#define GOERTZEL_TILE(NAME, TARGET, V, VN, LD, ST, SET1, UPD)                   \
+TARGET __attribute__((always_inline))                                        \
+static inline void NAME(double* x, int cnt, int step, double* a,             \
+                        double* s1, double* s2, int nv)                      \
+{                                                                            \
+    V u1[4], u2[4], c[4], v, xm;                                             \
+    int j, m;                                                                \
+    for(j = 0; j < nv; j++)                                                  \
+    {                                                                        \
+        u1[j] = LD(s1 + VN*j);                                               \
+        u2[j] = LD(s2 + VN*j);                                               \
+        c[j]  = LD(a  + VN*j);                                               \
+    }                                                                        \
+    for(m = 0; m < cnt; m++)                                                 \
+    {                                                                        \
+        xm = SET1(x[m*step]);                                                \
+        for(j = 0; j < nv; j++)                                              \
+        {                                                                    \
+            v     = UPD(xm, u1[j], u2[j], c[j]);                             \
+            u2[j] = u1[j];                                                   \
+            u1[j] = v;                                                       \
+        }                                                                    \
+    }                                                                        \
+    for(j = 0; j < nv; j++)                                                  \
+    {                                                                        \
+        ST(s1 + VN*j, u1[j]);                                                \
+        ST(s2 + VN*j, u2[j]);                                                \
+    }                                                                        \
+}
+
+/* Kernel: tiles of 4 vectors and the last tile of nv < 4 vectors */
+#define GOERTZEL_KRN(NAME, TARGET, TILE, VN)                                 \
+TARGET                                                                       \
+static void NAME(double* x, int cnt, int step, double* a,                    \
+                 double* s1, double* s2, int k)                              \
+{                                                                            \
+    int i, kv = (k + VN - 1) / VN * VN;                                      \
+    for(i = 0; i + 4*VN <= kv; i += 4*VN)                                    \
+        TILE(x, cnt, step, a + i, s1 + i, s2 + i, 4);                        \
+    switch((kv - i) / VN)                                                    \
+    {                                                                        \
+        case 1: TILE(x, cnt, step, a + i, s1 + i, s2 + i, 1); break;         \
+        case 2: TILE(x, cnt, step, a + i, s1 + i, s2 + i, 2); break;         \
+        case 3: TILE(x, cnt, step, a + i, s1 + i, s2 + i, 3); break;         \
+        default: break;                                                      \
+    }                                                                        \
+}
+
+
+
+/* scalar kernel: tiles of 4 resonators */
+#define SCL_LD(p)               (*(p))
+#define SCL_ST(p, a)            (*(p) = (a))
+#define SCL_SET1(r)             (r)
+#define SCL_UPD(x, u1, u2, c)   (((x) - (u2)) + (c) * (u1))
+
+GOERTZEL_TILE(goertzel_tile_scalar, , double, 1, 
+              SCL_LD, SCL_ST, SCL_SET1, SCL_UPD)
+GOERTZEL_KRN(goertzel_krn_scalar, , goertzel_tile_scalar, 1)
+
+
+
+#ifdef GOERTZEL_SIMD_X86
+
+/* SSE2 kernel: tiles of 4 vectors of 2 resonators */
+#define SSE2_UPD(x, u1, u2, c)  _mm_add_pd(_mm_sub_pd((x), (u2)),            \
+                                           _mm_mul_pd((c), (u1)))
+
+GOERTZEL_TILE(goertzel_tile_sse2, __attribute__((target("sse2"))), __m128d, 2,
+              _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd, SSE2_UPD)
+GOERTZEL_KRN(goertzel_krn_sse2, __attribute__((target("sse2"))), 
+             goertzel_tile_sse2, 2)
+
+/* AVX2 and FMA kernel: tiles of 4 vectors of 4 resonators */
+#define AVX2_UPD(x, u1, u2, c)  _mm256_fmadd_pd((c), (u1),                   \
+                                                _mm256_sub_pd((x), (u2)))
+
+GOERTZEL_TILE(goertzel_tile_avx2, __attribute__((target("avx2,fma"))), 
+              __m256d, 4, 
+              _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd, AVX2_UPD)
+GOERTZEL_KRN(goertzel_krn_avx2, __attribute__((target("avx2,fma"))), 
+             goertzel_tile_avx2, 4)
+
+#endif /* GOERTZEL_SIMD_X86 */
+
+
+
+
+void goertzel_krn(double* x, int cnt, int step, double* a, 
+                  double* s1, double* s2, int k)
+{
+#ifdef GOERTZEL_SIMD_X86
+    int isa = fft_get_isa();
+    if(isa >= FFT_ISA_AVX2)
+    {
+        goertzel_krn_avx2(x, cnt, step, a, s1, s2, k);
+        return;
+    }
+    if(isa >= FFT_ISA_SSE2)
+    {
+        goertzel_krn_sse2(x, cnt, step, a, s1, s2, k);
+        return;
+    }
+#endif
+    goertzel_krn_scalar(x, cnt, step, a, s1, s2, k);
+}
+
+
+
+
+/*******************************************************************************
+Goertzel algorithm costs n*k resonators updates, FFT costs about n*log2(n)
+butterflies operations (several times more for the prime factors 
+calculated by the naive DFT or Bluestein codelets). 
+One butterfly operation is about GOERTZEL_FFT_RATIO resonators updates.
+*******************************************************************************/
+#define GOERTZEL_FFT_RATIO  2.5
+
+int goertzel_use_fft(int n, int k)
+{
+    double c;
+    int r = n;
+
+    while(r % 2 == 0) r /= 2;
+    while(r % 3 == 0) r /= 3;
+    while(r % 5 == 0) r /= 5;
+    while(r % 7 == 0) r /= 7;
+
+    c = log2((double)n);
+    if(r > FFT_BLUESTEIN_MIN)
+        c *= 6.0;
+    else
+        c += (double)r;
+
+    return (double)k > GOERTZEL_FFT_RATIO * c;
+}
@@ -0,0 +1,84 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Reset the resonators of the multi-bin Goertzel algorithm object.
+
+The function sets to zero the resonators states of the `goertzel_t`
+object and the pushed samples counter, so the next
+\ref goertzel_update call starts the new signal frame.
+The resonators coefficients are not changed.
+
+\param[in,out]  pg
+Pointer to the `goertzel_t` object
+created by the \ref goertzel_create function. \n \n
+
+\return
+`RES_OK` if the object is reset successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Сброс резонаторов объекта алгоритма Гёрцеля
+
+Функция обнуляет состояния резонаторов объекта `goertzel_t`
+и счетчик поступивших отсчетов, поэтому следующий вызов
+\ref goertzel_update начинает новый кадр сигнала.
+Коэффициенты резонаторов не изменяются.
+
+\param[in,out]  pg
+Указатель на объект `goertzel_t`,
+созданный функцией \ref goertzel_create. \n \n
+
+\return
+`RES_OK` если объект сброшен успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API goertzel_reset(goertzel_t* pg)
+{
+    if(!pg)
+        return ERROR_PTR;
+    if(!pg->s)
+        return ERROR_SIZE;
+    memset(pg->s, 0, 4 * GOERTZEL_KP(pg->k) * sizeof(double));
+    pg->pos = 0;
+    return RES_OK;
+}
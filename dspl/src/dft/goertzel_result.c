@@ -0,0 +1,134 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief DFT bins of the frame pushed to the multi-bin Goertzel object.
+
+The function calculates the bins
+\f[
+Y(i) = \sum_{m = 0}^{L-1} x(m) \exp\left(-j 2\pi \frac{ind(i) m}{n}\right),
+\qquad i = 0 \ldots k-1,
+\f]
+of the `L` samples pushed by the \ref goertzel_update and
+\ref goertzel_update_cmplx functions since the last reset. \n
+If `L = n` the result is equal to the `ind` bins of the `n`-points DFT.
+The resonators states are not changed, so the frame can be continued
+after the function call.
+
+\param[in]  pg
+Pointer to the `goertzel_t` object. \n \n
+
+\param[out]  y
+Pointer to the DFT bins vector. \n
+Vector size is `[k x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if the bins are calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Отсчеты ДПФ кадра, поданного в объект алгоритма Гёрцеля
+
+Функция рассчитывает отсчеты
+\f[
+Y(i) = \sum_{m = 0}^{L-1} x(m) \exp\left(-j 2\pi \frac{ind(i) m}{n}\right),
+\qquad i = 0 \ldots k-1,
+\f]
+по `L` отсчетам, поданным функциями \ref goertzel_update и
+\ref goertzel_update_cmplx после последнего сброса. \n
+Если `L = n`, то результат равен отсчетам `ind` `n`-точечного ДПФ.
+Состояния резонаторов не изменяются, поэтому кадр может быть
+продолжен после вызова функции.
+
+\param[in]  pg
+Указатель на объект `goertzel_t`. \n \n
+
+\param[out]  y
+Указатель на вектор отсчетов ДПФ. \n
+Размер вектора `[k x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если отсчеты ДПФ рассчитаны успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API goertzel_result(goertzel_t* pg, complex_t* y)
+{
+    double *s1r, *s2r, *s1i, *s2i, phi, re;
+    complex_t z, c;
+    int i, k, kp;
+
+    if(!pg || !y)
+        return ERROR_PTR;
+    if(!pg->s)
+        return ERROR_SIZE;
+
+    k   = pg->k;
+    kp  = GOERTZEL_KP(k);
+    s1r = pg->s;
+    s2r = pg->s + kp;
+    s1i = pg->s + 2*kp;
+    s2i = pg->s + 3*kp;
+
+    for(i = 0; i < k; i++)
+    {
+        /* z = w * s1 - s2 */
+        RE(z) = RE(pg->w[i]) * s1r[i] - IM(pg->w[i]) * s1i[i] - s2r[i];
+        IM(z) = IM(pg->w[i]) * s1r[i] + RE(pg->w[i]) * s1i[i] - s2i[i];
+
+        /* frame of L samples: y = z * exp(-j 2 pi ind L / n) */
+        if(pg->pos)
+        {
+            phi = -M_2PI * (double)(((long long)pg->ind[i] * pg->pos) % pg->n)
+                / (double)pg->n;
+            RE(c) = cos(phi);
+            IM(c) = sin(phi);
+            re    = CMRE(z, c);
+            IM(z) = CMIM(z, c);
+            RE(z) = re;
+        }
+        RE(y[i]) = RE(z);
+        IM(y[i]) = IM(z);
+    }
+    return RES_OK;
+}
@@ -0,0 +1,170 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Update the multi-bin Goertzel resonators by the real samples block.
+
+The function pushes `cnt` real samples of the signal frame
+to the resonators of all bins of the `goertzel_t` object:
+\f[
+s_i(m) = x(m) + 2\cos\left(2\pi \frac{ind(i)}{n}\right) s_i(m-1) - s_i(m-2).
+\f]
+The input block is processed by the parts of
+512 samples: each part stays in the cache while
+all the resonators are updated, so the signal is read from the memory
+once for any number of bins. The resonators states are kept
+in the separate vectors and the tiles of the resonators are updated
+by the SIMD instructions selected by the \ref fft_set_isa function. \n
+The frame can be pushed by any number of the blocks of any size,
+so the function can be used in the streaming tone detectors.
+The DFT bins of the pushed frame are calculated by the
+\ref goertzel_result function.
+
+\param[in,out]  pg
+Pointer to the `goertzel_t` object
+created by the \ref goertzel_create function. \n \n
+
+\param[in]  x
+Pointer to the real samples block. \n
+Vector size is `[cnt x 1]`. \n \n
+
+\param[in]  cnt
+Block size. \n \n
+
+\return
+`RES_OK` if the resonators are updated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+goertzel_t g = {0};
+int ind[2] = {10, 20};
+complex_t y[2];
+
+goertzel_create(&g, 1024, ind, 2);
+
+// 1024-points frame is pushed by 4 blocks of 256 samples
+for(i = 0; i < 4; i++)
+    goertzel_update(&g, x + i*256, 256);
+
+// DFT bins 10 and 20 of the frame
+goertzel_result(&g, y);
+
+// next frame
+goertzel_reset(&g);
+
+goertzel_free(&g);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Обновление резонаторов алгоритма Гёрцеля блоком вещественных отсчетов
+
+Функция подает `cnt` вещественных отсчетов кадра сигнала
+на резонаторы всех отсчетов ДПФ объекта `goertzel_t`:
+\f[
+s_i(m) = x(m) + 2\cos\left(2\pi \frac{ind(i)}{n}\right) s_i(m-1) - s_i(m-2).
+\f]
+Входной блок обрабатывается частями по
+512 отсчетов: каждая часть остается в кэше пока
+обновляются все резонаторы, поэтому сигнал читается из памяти
+один раз для любого количества отсчетов ДПФ. Состояния резонаторов
+хранятся в отдельных векторах, и группы резонаторов
+обновляются SIMD инструкциями, выбранными функцией \ref fft_set_isa. \n
+Кадр может подаваться любым количеством блоков любого размера,
+поэтому функция может использоваться в потоковых детекторах тонов.
+Отсчеты ДПФ поданного кадра рассчитываются функцией
+\ref goertzel_result.
+
+\param[in,out]  pg
+Указатель на объект `goertzel_t`,
+созданный функцией \ref goertzel_create. \n \n
+
+\param[in]  x
+Указатель на блок вещественных отсчетов. \n
+Размер вектора `[cnt x 1]`. \n \n
+
+\param[in]  cnt
+Размер блока. \n \n
+
+\return
+`RES_OK` если резонаторы обновлены успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+goertzel_t g = {0};
+int ind[2] = {10, 20};
+complex_t y[2];
+
+goertzel_create(&g, 1024, ind, 2);
+
+// кадр 1024 отсчета подается 4 блоками по 256 отсчетов
+for(i = 0; i < 4; i++)
+    goertzel_update(&g, x + i*256, 256);
+
+// отсчеты 10 и 20 ДПФ кадра
+goertzel_result(&g, y);
+
+// следующий кадр
+goertzel_reset(&g);
+
+goertzel_free(&g);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API goertzel_update(goertzel_t* pg, double* x, int cnt)
+{
+    int m, b, kp;
+
+    if(!pg || !x)
+        return ERROR_PTR;
+    if(!pg->s || cnt < 1)
+        return ERROR_SIZE;
+
+    kp = GOERTZEL_KP(pg->k);
+    for(m = 0; m < cnt; m += GOERTZEL_BLOCK)
+    {
+        b = cnt - m < GOERTZEL_BLOCK ? cnt - m : GOERTZEL_BLOCK;
+        goertzel_krn(x + m, b, 1, pg->a, pg->s, pg->s + kp, pg->k);
+    }
+    pg->pos = (int)(((long long)pg->pos + cnt) % pg->n);
+    return RES_OK;
+}
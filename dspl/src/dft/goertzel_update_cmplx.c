@@ -0,0 +1,113 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Update the multi-bin Goertzel resonators by the complex samples block.
+
+The function is similar to the \ref goertzel_update function,
+but it pushes `cnt` complex samples of the signal frame.
+The real and imaginary parts of each part of the block are processed
+while the part stays in the cache. \n
+The real and the complex blocks can be mixed in one frame.
+
+\param[in,out]  pg
+Pointer to the `goertzel_t` object
+created by the \ref goertzel_create function. \n \n
+
+\param[in]  x
+Pointer to the complex samples block. \n
+Vector size is `[cnt x 1]`. \n \n
+
+\param[in]  cnt
+Block size. \n \n
+
+\return
+`RES_OK` if the resonators are updated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Обновление резонаторов алгоритма Гёрцеля блоком комплексных отсчетов
+
+Функция аналогична функции \ref goertzel_update,
+но подает `cnt` комплексных отсчетов кадра сигнала.
+Реальные и мнимые части каждой части блока обрабатываются
+пока часть остается в кэше. \n
+Вещественные и комплексные блоки могут чередоваться в одном кадре.
+
+\param[in,out]  pg
+Указатель на объект `goertzel_t`,
+созданный функцией \ref goertzel_create. \n \n
+
+\param[in]  x
+Указатель на блок комплексных отсчетов. \n
+Размер вектора `[cnt x 1]`. \n \n
+
+\param[in]  cnt
+Размер блока. \n \n
+
+\return
+`RES_OK` если резонаторы обновлены успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API goertzel_update_cmplx(goertzel_t* pg, complex_t* x, int cnt)
+{
+    double *s;
+    int m, b, kp;
+
+    if(!pg || !x)
+        return ERROR_PTR;
+    if(!pg->s || cnt < 1)
+        return ERROR_SIZE;
+
+    kp = GOERTZEL_KP(pg->k);
+    s = pg->s;
+    for(m = 0; m < cnt; m += GOERTZEL_BLOCK)
+    {
+        b = cnt - m < GOERTZEL_BLOCK ? cnt - m : GOERTZEL_BLOCK;
+        goertzel_krn((double*)(x + m),     b, 2, pg->a, s,        s + kp,   
+                     pg->k);
+        goertzel_krn((double*)(x + m) + 1, b, 2, pg->a, s + 2*kp, s + 3*kp, 
+                     pg->k);
+    }
+    pg->pos = (int)(((long long)pg->pos + cnt) % pg->n);
+    return RES_OK;
+}
@@ -0,0 +1,242 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Inverse fast Fourier transform of the Hermitian spectrum
+(real output).
+
+Function calculates \f$ n \f$-points IFFT of the Hermitian
+spectrum \f$ X(k) = X^*(n-k) \f$ given by the \f$ n/2+1 \f$ non-redundant
+samples \f$ X(k) \f$, \f$ k = 0 \ldots \lfloor n/2 \rfloor \f$: \n
+\f[
+  y(m) = \frac{1}{n} \sum_{k = 0}^{n-1} X(k) \exp
+  \left( j   \frac{2\pi}{n} m k \right),
+\f]
+here \f$ m = 0 \ldots n-1 \f$. IFFT result \f$ y(m) \f$ is real. \n
+The function is inverse to the \ref fft_r2c function. \n
+Imaginary parts of \f$ X(0) \f$ and of \f$ X(n/2) \f$ for even `n`
+are ignored.
+
+For even `n` the spectrum is merged into the \f$ n/2 \f$-points
+complex spectrum of the vector \f$ z(m) = y(2m) + j y(2m+1) \f$
+with the `wr` twiddle factors of the `fft_t` structure,
+the \f$ n/2 \f$-points complex IFFT is calculated and
+\f$ z(m) \f$ is unpacked to \f$ y(m) \f$.
+The \f$ 1/n \f$ scaling is fused with the spectrum merging.
+Thus the function requires about twice less memory and calculations
+than the \ref ifft_cmplx function. \n
+For odd `n` the function uses the \f$ n \f$-points complex FFT.
+
+\param[in]  x
+Pointer to the input spectrum \f$X(k)\f$,
+\f$ k = 0 \ldots \lfloor n/2 \rfloor \f$. \n
+Vector size is `[n/2+1 x 1]`.  \n \n
+
+\param[in]  n
+IFFT size \f$n\f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Note that for even `n` the function uses the `n/2`-points
+plan `half` of the structure \ref fft_t, the `n`-points plan 
+of the structure is not changed. \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the IFFT result real vector \f$y(m)\f$,
+\f$ m = 0 \ldots n-1 \f$. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if IFFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include ifft_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Обратное быстрое преобразование Фурье эрмитова спектра
+(вещественный результат)
+
+Функция рассчитывает \f$ n \f$-точечное обратное БПФ
+эрмитова спектра \f$ X(k) = X^*(n-k) \f$, заданного \f$ n/2+1 \f$
+неизбыточными отсчетами \f$ X(k) \f$,
+\f$ k = 0 \ldots \lfloor n/2 \rfloor \f$: \n
+\f[
+  y(m) = \frac{1}{n} \sum_{k = 0}^{n-1} X(k) \exp
+  \left( j \frac{2\pi}{n} m k \right),
+\f]
+где \f$ m = 0 \ldots n-1 \f$. Результат ОБПФ \f$ y(m) \f$ вещественный. \n
+Функция является обратной к функции \ref fft_r2c. \n
+Мнимые части \f$ X(0) \f$ и \f$ X(n/2) \f$ при четном `n`
+не учитываются.
+
+При четном `n` спектр объединяется в \f$ n/2 \f$-точечный
+комплексный спектр сигнала \f$ z(m) = y(2m) + j y(2m+1) \f$
+при помощи поворотных коэффициентов `wr` структуры `fft_t`,
+рассчитывается \f$ n/2 \f$-точечное комплексное ОБПФ,
+после чего \f$ z(m) \f$ распаковывается в \f$ y(m) \f$.
+Нормировка \f$ 1/n \f$ совмещена с объединением спектра.
+Таким образом функция требует примерно вдвое меньше
+памяти и вычислений, чем функция \ref ifft_cmplx. \n
+При нечетном `n` используется \f$ n \f$-точечное комплексное БПФ.
+
+\param[in]  x
+Указатель на входной спектр \f$X(k)\f$,
+\f$ k = 0 \ldots \lfloor n/2 \rfloor \f$. \n
+Размер вектора `[n/2+1 x 1]`.  \n \n
+
+\param[in]  n
+Размер ОБПФ \f$n\f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Необходимо учитывать, что при четном `n` функция использует 
+план `half` `n/2`-точечного БПФ структуры \ref fft_t, 
+план `n`-точечного БПФ структуры не изменяется. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на вещественный вектор результата ОБПФ \f$y(m)\f$,
+\f$ m = 0 \ldots n-1 \f$. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции `ifft`:
+
+\include ifft_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API ifft(complex_t* x, int n, fft_t* pfft, double* y)
+{
+    int err, k, n2;
+    double norm;
+    fft_t h;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n<1)
+        return ERROR_SIZE;
+
+    norm = 1.0 / (double)n;
+    if(n%2)
+    {
+        /* odd size: full conjugate spectrum and complex FFT */
+        err = fft_create(pfft, n);
+        if(err != RES_OK)
+            return err;
+
+        RE(pfft->t1[0]) = RE(x[0]) * norm;
+        IM(pfft->t1[0]) = 0.0;
+        for(k = 1; k <= n/2; k++)
+        {
+            RE(pfft->t1[k])   =  RE(x[k]) * norm;
+            IM(pfft->t1[k])   = -IM(x[k]) * norm;
+            RE(pfft->t1[n-k]) =  RE(x[k]) * norm;
+            IM(pfft->t1[n-k]) =  IM(x[k]) * norm;
+        }
+        err = fft_krn(pfft->t1, pfft->t0, pfft);
+        if(err != RES_OK)
+            return err;
+        for(k = 0; k < n; k++)
+            y[k] = RE(pfft->t0[k]);
+        return RES_OK;
+    }
+
+    /* half size plan, the n-points plan of the object is not changed */
+    n2 = n/2;
+    err = fft_create_half(pfft, n2, &h);
+    if(err != RES_OK)
+        return err;
+
+    /* conjugate spectrum of z(m) = y(2m) + j y(2m+1) */
+    fft_c2r_merge(x, n2, h.plan->wr, norm, pfft->t1);
+
+    err = fft_krn(pfft->t1, pfft->t0, &h);
+    if(err != RES_OK)
+        return err;
+
+    for(k = 0; k < n2; k++)
+    {
+        y[2*k]   =  RE(pfft->t0[k]);
+        y[2*k+1] = -IM(pfft->t0[k]);
+    }
+    return RES_OK;
+}
+
+
+
+
+void fft_c2r_merge(complex_t* x, int n2, complex_t* wr, double norm,
+                   complex_t* z)
+{
+    int k;
+    double er, ei, dr, di, qr, qi;
+
+    /* merge Z(k) = E(k) + j O(k), E(k) = X(k) + X*(n2-k),
+       O(k) = (X(k) - X*(n2-k)) W_n^{-k}, z receives the scaled Z*(k) */
+    RE(z[0]) = (RE(x[0]) + RE(x[n2])) * norm;
+    IM(z[0]) = (RE(x[n2]) - RE(x[0])) * norm;
+
+    for(k = 1; k <= n2/2; k++)
+    {
+        er = (RE(x[k]) + RE(x[n2-k])) * norm;
+        ei = (IM(x[k]) - IM(x[n2-k])) * norm;
+        dr = (RE(x[k]) - RE(x[n2-k])) * norm;
+        di = (IM(x[k]) + IM(x[n2-k])) * norm;
+
+        qr = dr * RE(wr[k]) + di * IM(wr[k]);
+        qi = di * RE(wr[k]) - dr * IM(wr[k]);
+
+        RE(z[n2-k]) = er + qi;
+        IM(z[n2-k]) = ei - qr;
+
+        RE(z[k]) = er - qi;
+        IM(z[k]) = -ei - qr;
+    }
+}
@@ -0,0 +1,158 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Two-dimensional inverse fast Fourier transform of the complex matrix.
+
+Function calculates 2D IFFT of the complex matrix \f$ x(p,q) \f$
+of size `[n x m]`: \n
+\f[
+  y(k,l) = \frac{1}{nm} \sum_{p = 0}^{n-1} \sum_{q = 0}^{m-1} x(p,q)
+  \exp \left( j \frac{2\pi}{n} p k \right)
+  \exp \left( j \frac{2\pi}{m} q l \right),
+\f]
+here \f$ k = 0 \ldots n-1 \f$, \f$ l = 0 \ldots m-1 \f$. \n
+Matrix is stored in the memory as column-major array. \n
+The IFFT is calculated by the \ref fft2_cmplx passes of the
+conjugate matrix, the \f$ 1/(nm) \f$ scaling is fused with 
+the input conjugation.
+
+\param[in]  x
+Pointer to the input complex matrix \f$ x(p,q) \f$. \n
+Matrix size is `[n x m]`. \n \n
+
+\param[in]  n
+Number of the matrix rows. \n \n
+
+\param[in]  m
+Number of the matrix columns. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+Memory should be cleared before exiting by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the 2D IFFT result matrix \f$ y(k,l) \f$. \n
+Matrix size is `[n x m]`. \n
+Memory must be allocated. \n
+The output matrix can be the same as the input matrix `x`. \n \n
+
+\return
+`RES_OK` if IFFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include fft2_cmplx_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Двумерное обратное быстрое преобразование Фурье комплексной матрицы
+
+Функция рассчитывает двумерное ОБПФ комплексной матрицы \f$ x(p,q) \f$
+размера `[n x m]`: \n
+\f[
+  y(k,l) = \frac{1}{nm} \sum_{p = 0}^{n-1} \sum_{q = 0}^{m-1} x(p,q)
+  \exp \left( j \frac{2\pi}{n} p k \right)
+  \exp \left( j \frac{2\pi}{m} q l \right),
+\f]
+где \f$ k = 0 \ldots n-1 \f$, \f$ l = 0 \ldots m-1 \f$. \n
+Матрица должна быть расположена в памяти по столбцам. \n
+ОБПФ рассчитывается проходами функции \ref fft2_cmplx 
+комплексно-сопряженной матрицы, нормировка \f$ 1/(nm) \f$ 
+совмещена с сопряжением входной матрицы.
+
+\param[in]  x
+Указатель на входную комплексную матрицу \f$ x(p,q) \f$. \n
+Размер матрицы `[n x m]`. \n \n
+
+\param[in]  n
+Количество строк матрицы. \n \n
+
+\param[in]  m
+Количество столбцов матрицы. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на матрицу результата двумерного ОБПФ \f$ y(k,l) \f$. \n
+Размер матрицы `[n x m]`. \n
+Память должна быть выделена. \n
+Выходная матрица может совпадать с входной матрицей `x`. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+Пример использования функции:
+
+\include fft2_cmplx_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API ifft2_cmplx(complex_t* x, int n, int m, fft_t* pfft, 
+                         complex_t* y)
+{
+    int err, k;
+    double norm;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || m < 1)
+        return ERROR_SIZE;
+
+    norm = 1.0 / ((double)n * (double)m);
+    for(k = 0; k < n*m; k++)
+    {
+        RE(y[k]) =  RE(x[k]) * norm;
+        IM(y[k]) = -IM(x[k]) * norm;
+    }
+
+    err = fft2_cmplx(y, n, m, pfft, y);
+    if(err != RES_OK)
+        return err;
+
+    for(k = 0; k < n*m; k++)
+        IM(y[k]) = -IM(y[k]);
+    return RES_OK;
+}
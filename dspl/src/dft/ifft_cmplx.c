@@ -51,7 +51,7 @@ IFFT size \f$n\f$. \n
 IFFT size can be composite: 
 \f$n = n_0 \times n_1 \times n_2 \times \ldots \times n_p \times m\f$,
 here \f$n_i = 2,3,5,7\f$, а \f$m \f$ -- 
-simple number less than 46340
+arbitrary factor
 (see \ref fft_create function). \n \n
 
 \param[in]  pfft
@@ -126,7 +126,7 @@ Result:
 Размер ОБПФ может быть составным вида 
 \f$n = n_0 \times n_1 \times n_2 \times \ldots \times n_p \times m\f$,
 где \f$n_i = 2,3,5,7\f$, а \f$m \f$ -- 
-произвольный простой множитель не превосходящий 46340
+произвольный множитель
 (см. описание функции \ref fft_create). \n \n
 
 \param[in]  pfft
@@ -194,7 +194,7 @@ int DSPL_API ifft_cmplx(complex_t *x, int n, fft_t* pfft, complex_t* y)
     for(k = 0; k < n; k++)
         IM(pfft->t1[k]) = -IM(pfft->t1[k]);
 
-    err = fft_krn(pfft->t1, pfft->t0, pfft, n, 0);
+    err = fft_krn(pfft->t1, pfft->t0, pfft);
 
     if(err!=RES_OK)
         return err;
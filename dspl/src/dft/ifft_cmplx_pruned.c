@@ -0,0 +1,149 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Pruned inverse fast Fourier transform of the zero-padded 
+complex vector.
+
+Function calculates `ny` samples 
+\f$ y(k_0 + i) \f$, \f$ i = 0 \ldots n_y-1 \f$ of the \f$ n \f$-points IFFT
+of the `nx` samples of the vector `x` zero-padded to the size `n`: \n
+\f[
+  y(k) = \frac{1}{n} \sum_{m = 0}^{n_x-1} X(m) 
+  \exp \left( j \frac{2\pi}{n} m k \right),
+\f]
+the output index \f$ k = (k_0 + i) \bmod n \f$ is taken modulo `n`. \n
+The known zero samples of the input and the not required samples 
+of the output are not calculated (see \ref fft_cmplx_pruned). 
+For example the fast convolution requires only the part of the IFFT output,
+and the correlation function requires only the lags near zero.
+
+\param[in]  x
+Pointer to the input complex vector. \n
+Vector size is `[nx x 1]`. \n \n
+
+\param[in]  nx
+Number of the input samples, \f$ 1 \leq n_x \leq n \f$. \n
+Input samples \f$ X(m) \f$, \f$ m = n_x \ldots n-1 \f$, are zeros. \n \n
+
+\param[in]  n
+IFFT size \f$n\f$ (see \ref fft_create function). \n \n
+
+\param[in]  k0
+Index of the first output sample. \n 
+Index is taken modulo `n`, it can be negative. \n \n
+
+\param[in]  ny
+Number of the output samples, \f$ 1 \leq n_y \leq n \f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object.  \n
+This pointer cannot be `NULL`.  \n
+The memory should be cleared before exiting 
+by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the IFFT output samples \f$ y(k_0 + i) \f$. \n
+Vector size is `[ny x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if IFFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Усеченное обратное быстрое преобразование Фурье комплексного 
+сигнала, дополненного нулями
+
+Функция рассчитывает `ny` отсчетов 
+\f$ y(k_0 + i) \f$, \f$ i = 0 \ldots n_y-1 \f$ \f$ n \f$-точечного ОБПФ
+`nx` отсчетов вектора `x`, дополненного нулями до размера `n`: \n
+\f[
+  y(k) = \frac{1}{n} \sum_{m = 0}^{n_x-1} X(m) 
+  \exp \left( j \frac{2\pi}{n} m k \right),
+\f]
+индекс выходного отсчета \f$ k = (k_0 + i) \bmod n \f$ берется по модулю `n`. \n
+Известные нулевые отсчеты входа и ненужные отсчеты выхода 
+не рассчитываются (см. \ref fft_cmplx_pruned). Например, быстрой свертке
+требуется только часть выхода ОБПФ, а корреляционной функции 
+требуются только отсчеты вблизи нулевого сдвига.
+
+\param[in]  x
+Указатель на входной комплексный сигнал. \n
+Размер вектора `[nx x 1]`. \n \n
+
+\param[in]  nx
+Количество входных отсчетов, \f$ 1 \leq n_x \leq n \f$. \n
+Входные отсчеты \f$ X(m) \f$, \f$ m = n_x \ldots n-1 \f$, равны нулю. \n \n
+
+\param[in]  n
+Размер ОБПФ \f$n\f$ (см. описание функции \ref fft_create). \n \n
+
+\param[in]  k0
+Индекс первого выходного отсчета. \n 
+Индекс берется по модулю `n` и может быть отрицательным. \n \n
+
+\param[in]  ny
+Количество выходных отсчетов, \f$ 1 \leq n_y \leq n \f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t`. \n
+Указатель не должен быть `NULL`. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на выходные отсчеты ОБПФ \f$ y(k_0 + i) \f$. \n
+Размер вектора `[ny x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API ifft_cmplx_pruned(complex_t* x, int nx, int n, int k0, int ny,
+                               fft_t* pfft, complex_t* y)
+{
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n < 1 || nx < 1 || nx > n || ny < 1 || ny > n)
+        return ERROR_SIZE;
+    return fft_pruned_krn(x, nx, n, k0, ny, pfft, 1, y);
+}
@@ -0,0 +1,142 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Single precision inverse fast Fourier transform.
+
+Function calculates \f$ n \f$-points IFFT of the complex vector 
+\f$ X(k) \f$, \f$ k = 0 \ldots n-1 \f$: \n
+\f[
+  y(m) = \frac{1}{n} \sum_{k = 0}^{n-1} X(k) 
+  \exp \left( j \frac{2\pi}{n} m k \right),
+\f]
+here \f$ m = 0 \ldots n-1 \f$. \n
+The function is the single precision version of the \ref ifft_cmplx
+function.
+
+\param[in]  x
+Pointer to the input vector \f$X(k)\f$, 
+\f$ k = 0 \ldots n-1 \f$.  \n
+Vector size is `[n x 1]`.  \n \n
+
+\param[in]  n
+IFFT size \f$n\f$ (see \ref fftf_create function). \n \n
+
+\param[in]  pfft
+Pointer to the `fftf_t` object.  \n
+This pointer cannot be `NULL`.  \n
+The object must be cleared by the \ref fftf_free function. \n \n
+
+\param[out] y
+Pointer to the IFFT result vector \f$y(m)\f$, 
+\f$ m = 0 \ldots n-1 \f$. \n
+Vector size is `[n x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if IFFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Обратное быстрое преобразование Фурье одинарной точности
+
+Функция рассчитывает \f$ n \f$-точечное ОБПФ комплексного вектора
+\f$ X(k) \f$, \f$ k = 0 \ldots n-1 \f$: \n
+\f[
+  y(m) = \frac{1}{n} \sum_{k = 0}^{n-1} X(k) 
+  \exp \left( j \frac{2\pi}{n} m k \right),
+\f]
+где \f$ m = 0 \ldots n-1 \f$. \n
+Функция является версией одинарной точности функции \ref ifft_cmplx.
+
+\param[in]  x
+Указатель на входной вектор \f$X(k)\f$, 
+\f$ k = 0 \ldots n-1 \f$.  \n
+Размер вектора `[n x 1]`.  \n \n
+
+\param[in]  n
+Размер ОБПФ \f$n\f$ (см. функцию \ref fftf_create). \n \n
+
+\param[in]  pfft
+Указатель на структуру `fftf_t`. \n
+Указатель не должен быть `NULL`. \n
+Объект должен быть очищен функцией \ref fftf_free. \n \n
+
+\param[out] y
+Указатель на вектор результата ОБПФ \f$y(m)\f$, 
+\f$ m = 0 \ldots n-1 \f$. \n
+Размер вектора `[n x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки". \n \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API ifftf_cmplx(complexf_t* x, int n, fftf_t* pfft, complexf_t* y)
+{
+    int err, k;
+    float norm;
+
+    if(!x || !pfft || !y)
+        return ERROR_PTR;
+    if(n<1)
+        return ERROR_SIZE;
+
+    err = fftf_create(pfft, n);
+    if(err != RES_OK)
+        return err;
+
+    memcpy(pfft->t1, x, n*sizeof(complexf_t));
+    for(k = 0; k < n; k++)
+        IM(pfft->t1[k]) = -IM(pfft->t1[k]);
+
+    err = fftf_krn(pfft->t1, pfft->t0, pfft);
+    if(err != RES_OK)
+        return err;
+
+    norm = 1.0f / (float)n;
+    for(k = 0; k < n; k++)
+    {
+        RE(y[k]) =  RE(pfft->t0[k])*norm;
+        IM(y[k]) = -IM(pfft->t0[k])*norm;
+    }
+    return RES_OK;
+}
@@ -0,0 +1,160 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Inverse short-time Fourier transform (overlap-add synthesis).
+
+The function restores the real signal from the `ncol` columns
+of the time-frequency matrix `y` (see \ref stft)
+by the weighted overlap-add synthesis:
+\f[
+x(t) = \frac{\sum_f w(t - f H) \, y_f(t - f H)}
+            {\sum_f w^2(t - f H)},
+\f]
+here \f$ y_f(m) \f$ is the real inverse FFT of the column `f`
+(see \ref ifft), \f$ w(m) \f$ is the window of the `stft_t` object
+and \f$ H \f$ is the frames step `hop`. \n
+The least squares synthesis restores the signal exactly
+from the unchanged STFT for any window and any step,
+except the samples which are not covered
+by the nonzero window samples.
+Such samples are set to zero.
+
+\param[in]  y
+Pointer to the time-frequency matrix. \n
+Matrix size is `[nfft/2+1 x ncol]`. \n \n
+
+\param[in]  ncol
+Number of the matrix columns (frames). \n \n
+
+\param[in]  pstft
+Pointer to the `stft_t` object created by the \ref stft_create function. \n \n
+
+\param[out]  x
+Pointer to the restored signal. \n
+Vector size is `[(ncol-1)*hop + nfft x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if the signal is restored successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Обратное оконное преобразование Фурье (синтез с перекрытием)
+
+Функция восстанавливает вещественный сигнал по `ncol` столбцам
+частотно-временной матрицы `y` (см. \ref stft)
+методом взвешенного суммирования с перекрытием:
+\f[
+x(t) = \frac{\sum_f w(t - f H) \, y_f(t - f H)}
+            {\sum_f w^2(t - f H)},
+\f]
+где \f$ y_f(m) \f$ --- вещественное обратное БПФ столбца `f`
+(см. \ref ifft), \f$ w(m) \f$ --- окно объекта `stft_t`,
+\f$ H \f$ --- шаг кадров `hop`. \n
+Синтез по методу наименьших квадратов точно восстанавливает сигнал
+по неизмененному оконному преобразованию Фурье для любого окна
+и любого шага, кроме отсчетов, не покрытых
+ненулевыми отсчетами окна. Такие отсчеты обнуляются.
+
+\param[in]  y
+Указатель на частотно-временную матрицу. \n
+Размер матрицы `[nfft/2+1 x ncol]`. \n \n
+
+\param[in]  ncol
+Количество столбцов матрицы (кадров). \n \n
+
+\param[in]  pstft
+Указатель на объект `stft_t`, созданный функцией \ref stft_create. \n \n
+
+\param[out]  x
+Указатель на восстановленный сигнал. \n
+Размер вектора `[(ncol-1)*hop + nfft x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если сигнал восстановлен успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API istft(complex_t* y, int ncol, stft_t* pstft, double* x)
+{
+    double *den = NULL, *t, *w;
+    int f, m, nfft, nk, nx, pos, err = RES_OK;
+
+    if(!y || !pstft || !x)
+        return ERROR_PTR;
+    if(!pstft->w || ncol < 1)
+        return ERROR_SIZE;
+
+    nfft = pstft->nfft;
+    nk   = nfft / 2 + 1;
+    nx   = (ncol - 1) * pstft->hop + nfft;
+    t    = pstft->t;
+    w    = pstft->w;
+
+    den = (double*) malloc(nx * sizeof(double));
+    if(!den)
+        return ERROR_MALLOC;
+    memset(den, 0, nx * sizeof(double));
+    memset(x,   0, nx * sizeof(double));
+
+    /* weighted overlap-add */
+    for(f = 0; f < ncol; f++)
+    {
+        err = ifft(y + f*nk, nfft, &pstft->fft, t);
+        if(err != RES_OK)
+            goto exit_label;
+        pos = f * pstft->hop;
+        for(m = 0; m < nfft; m++)
+        {
+            x[pos + m]   += w[m] * t[m];
+            den[pos + m] += w[m] * w[m];
+        }
+    }
+
+    for(m = 0; m < nx; m++)
+        x[m] = den[m] > DBL_EPSILON ? x[m] / den[m] : 0.0;
+
+exit_label:
+    free(den);
+    return err;
+}
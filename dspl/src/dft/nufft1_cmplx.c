@@ -0,0 +1,190 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Type 1 non-uniform fast Fourier transform (NUFFT) 
+of the complex signal.
+
+Function calculates the spectrum of the nonuniformly sampled signal
+at the uniform frequencies grid: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n_x-1} s(m) 
+  \exp \left( -j \left(k - \frac{n_k}{2} \right) x(m) \right),
+  \qquad k = 0 \ldots n_k-1,
+\f]
+where \f$ x(m) \f$ are arbitrary phases (for example 
+\f$ x(m) = \Delta\omega \cdot t(m) \f$ for the samples times \f$ t(m) \f$ and 
+the frequencies step \f$ \Delta\omega \f$), 
+\f$ n_k/2 \f$ is the integer division. \n
+The samples are spread to the uniform grid of 
+\f$ n_f \geq 2 n_k \f$ points by the "exponential of semicircle" kernel
+\f[
+  \varphi(z) = \exp \left( \beta \left( \sqrt{1 - z^2} - 1 \right) \right),
+  \qquad |z| < 1,
+\f]
+of the \f$ w \f$ grid points width. 
+The grid is transformed by the \f$ n_f \f$-points FFT and
+the spectrum is divided by the Fourier transform of the kernel. \n
+The number of operations is 
+\f$ O(n_x w + n_f \log_2 n_f) \f$ instead of \f$ O(n_x n_k) \f$ 
+of the direct sum. The kernel width \f$ w \f$ is selected 
+by the required accuracy `eps`: \f$ w \approx 1 - \log_{10} \varepsilon \f$.
+
+\param[in]  x
+Pointer to the phases vector \f$ x(m) \f$ (radians). \n
+Vector size is `[nx x 1]`. \n \n
+
+\param[in]  s
+Pointer to the input complex signal \f$ s(m) \f$. \n
+Vector size is `[nx x 1]`. \n \n
+
+\param[in]  nx
+Number of the input samples. \n \n
+
+\param[in]  nk
+Number of the output spectrum samples. \n \n
+
+\param[in]  eps
+Required relative accuracy of the spectrum 
+(relative to \f$ \sum |s(m)| \f$), \f$ 10^{-14} \ldots 10^{-1} \f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object of the grid FFT. \n
+This pointer cannot be `NULL`.  \n
+The memory should be cleared before exiting 
+by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the spectrum \f$ Y(k) \f$. \n
+Vector size is `[nk x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if NUFFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+fft_t pfft = {0};
+// Fourier series coefficients of the period T for the samples times t
+for(m = 0; m < nt; m++)
+    x[m] = M_2PI * t[m] / T;
+nufft1_cmplx(x, s, nt, nw, 1E-10, &pfft, y);
+fft_free(&pfft);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Неравномерное быстрое преобразование Фурье (NUFFT) первого типа
+комплексного сигнала.
+
+Функция рассчитывает спектр неравномерно дискретизированного сигнала
+на равномерной сетке частот: \n
+\f[
+  Y(k) = \sum_{m = 0}^{n_x-1} s(m) 
+  \exp \left( -j \left(k - \frac{n_k}{2} \right) x(m) \right),
+  \qquad k = 0 \ldots n_k-1,
+\f]
+где \f$ x(m) \f$ --- произвольные фазы (например 
+\f$ x(m) = \Delta\omega \cdot t(m) \f$ для моментов времени отсчетов 
+\f$ t(m) \f$ и шага по частоте \f$ \Delta\omega \f$), 
+\f$ n_k/2 \f$ --- целочисленное деление. \n
+Отсчеты переносятся на равномерную сетку из
+\f$ n_f \geq 2 n_k \f$ точек ядром "экспонента полуокружности"
+\f[
+  \varphi(z) = \exp \left( \beta \left( \sqrt{1 - z^2} - 1 \right) \right),
+  \qquad |z| < 1,
+\f]
+шириной \f$ w \f$ точек сетки. 
+Сетка преобразуется \f$ n_f \f$-точечным БПФ, и спектр делится 
+на преобразование Фурье ядра. \n
+Количество операций равно \f$ O(n_x w + n_f \log_2 n_f) \f$ вместо 
+\f$ O(n_x n_k) \f$ при прямом суммировании. Ширина ядра \f$ w \f$ 
+выбирается по требуемой точности `eps`: 
+\f$ w \approx 1 - \log_{10} \varepsilon \f$.
+
+\param[in]  x
+Указатель на вектор фаз \f$ x(m) \f$ (радиан). \n
+Размер вектора `[nx x 1]`. \n \n
+
+\param[in]  s
+Указатель на входной комплексный сигнал \f$ s(m) \f$. \n
+Размер вектора `[nx x 1]`. \n \n
+
+\param[in]  nx
+Количество входных отсчетов. \n \n
+
+\param[in]  nk
+Количество отсчетов выходного спектра. \n \n
+
+\param[in]  eps
+Требуемая относительная точность спектра 
+(относительно \f$ \sum |s(m)| \f$), \f$ 10^{-14} \ldots 10^{-1} \f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t` БПФ сетки. \n
+Указатель не должен быть `NULL`. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на спектр \f$ Y(k) \f$. \n
+Размер вектора `[nk x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+fft_t pfft = {0};
+// коэффициенты ряда Фурье периода T для моментов времени отсчетов t
+for(m = 0; m < nt; m++)
+    x[m] = M_2PI * t[m] / T;
+nufft1_cmplx(x, s, nt, nw, 1E-10, &pfft, y);
+fft_free(&pfft);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API nufft1_cmplx(double* x, complex_t* s, int nx, int nk,
+                          double eps, fft_t* pfft, complex_t* y)
+{
+    if(!x || !s || !pfft || !y)
+        return ERROR_PTR;
+    if(nx < 1 || nk < 1)
+        return ERROR_SIZE;
+    return nufft_krn(x, s, nx, nk, eps, 1, pfft, y);
+}
@@ -0,0 +1,157 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Type 2 non-uniform fast Fourier transform (NUFFT) 
+of the complex spectrum.
+
+Function calculates the signal of the uniform frequencies grid spectrum
+at the nonuniform time samples: \n
+\f[
+  y(m) = \sum_{k = 0}^{n_k-1} S(k) 
+  \exp \left( j \left(k - \frac{n_k}{2} \right) x(m) \right),
+  \qquad m = 0 \ldots n_x-1,
+\f]
+where \f$ x(m) \f$ are arbitrary phases (for example 
+\f$ x(m) = \Delta\omega \cdot t(m) \f$), 
+\f$ n_k/2 \f$ is the integer division. \n
+The transform is adjoint to the type 1 NUFFT (see \ref nufft1_cmplx).
+The spectrum divided by the Fourier transform of the kernel
+is transformed to the uniform grid of \f$ n_f \geq 2 n_k \f$ points
+by the \f$ n_f \f$-points FFT, and the signal is interpolated 
+from the grid by the kernel of \f$ w \f$ grid points. \n
+The number of operations is 
+\f$ O(n_x w + n_f \log_2 n_f) \f$ instead of \f$ O(n_x n_k) \f$ 
+of the direct sum.
+
+\param[in]  s
+Pointer to the input spectrum \f$ S(k) \f$. \n
+Vector size is `[nk x 1]`. \n \n
+
+\param[in]  nk
+Number of the spectrum samples. \n \n
+
+\param[in]  x
+Pointer to the phases vector \f$ x(m) \f$ (radians). \n
+Vector size is `[nx x 1]`. \n \n
+
+\param[in]  nx
+Number of the output samples. \n \n
+
+\param[in]  eps
+Required relative accuracy of the signal 
+(relative to \f$ \sum |S(k)| \f$), \f$ 10^{-14} \ldots 10^{-1} \f$. \n \n
+
+\param[in]  pfft
+Pointer to the `fft_t` object of the grid FFT. \n
+This pointer cannot be `NULL`.  \n
+The memory should be cleared before exiting 
+by the \ref fft_free function. \n \n
+
+\param[out] y
+Pointer to the output signal \f$ y(m) \f$. \n
+Vector size is `[nx x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if NUFFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Неравномерное быстрое преобразование Фурье (NUFFT) второго типа
+комплексного спектра.
+
+Функция рассчитывает сигнал по спектру на равномерной сетке частот
+в неравномерные моменты времени: \n
+\f[
+  y(m) = \sum_{k = 0}^{n_k-1} S(k) 
+  \exp \left( j \left(k - \frac{n_k}{2} \right) x(m) \right),
+  \qquad m = 0 \ldots n_x-1,
+\f]
+где \f$ x(m) \f$ --- произвольные фазы (например 
+\f$ x(m) = \Delta\omega \cdot t(m) \f$), 
+\f$ n_k/2 \f$ --- целочисленное деление. \n
+Преобразование сопряжено с NUFFT первого типа (см. \ref nufft1_cmplx).
+Спектр, деленный на преобразование Фурье ядра, переносится
+на равномерную сетку из \f$ n_f \geq 2 n_k \f$ точек 
+\f$ n_f \f$-точечным БПФ, и сигнал интерполируется по сетке
+ядром шириной \f$ w \f$ точек сетки. \n
+Количество операций равно \f$ O(n_x w + n_f \log_2 n_f) \f$ вместо 
+\f$ O(n_x n_k) \f$ при прямом суммировании.
+
+\param[in]  s
+Указатель на входной спектр \f$ S(k) \f$. \n
+Размер вектора `[nk x 1]`. \n \n
+
+\param[in]  nk
+Количество отсчетов спектра. \n \n
+
+\param[in]  x
+Указатель на вектор фаз \f$ x(m) \f$ (радиан). \n
+Размер вектора `[nx x 1]`. \n \n
+
+\param[in]  nx
+Количество выходных отсчетов. \n \n
+
+\param[in]  eps
+Требуемая относительная точность сигнала 
+(относительно \f$ \sum |S(k)| \f$), \f$ 10^{-14} \ldots 10^{-1} \f$. \n \n
+
+\param[in]  pfft
+Указатель на структуру `fft_t` БПФ сетки. \n
+Указатель не должен быть `NULL`. \n
+Память должна быть очищена перед выходом функцией \ref fft_free. \n \n
+
+\param[out] y
+Указатель на выходной сигнал \f$ y(m) \f$. \n
+Размер вектора `[nx x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если расчет произведен успешно.  \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API nufft2_cmplx(complex_t* s, int nk, double* x, int nx,
+                          double eps, fft_t* pfft, complex_t* y)
+{
+    if(!x || !s || !pfft || !y)
+        return ERROR_PTR;
+    if(nx < 1 || nk < 1)
+        return ERROR_SIZE;
+    return nufft_krn(x, s, nx, nk, eps, 2, pfft, y);
+}
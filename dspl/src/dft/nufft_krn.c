@@ -0,0 +1,416 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+#include <math.h>
+
+
+/* Smallest even size 2^a * 3^b * 5^c not less than n */
+static int nufft_grid_size(int n)
+{
+    int m, r;
+    if(n < 2)
+        n = 2;
+    for(;;)
+    {
+        if(!(n % 2))
+        {
+            m = n;
+            for(r = 2; r <= 5; r++)
+                while(!(m % r))
+                    m /= r;
+            if(m == 1)
+                return n;
+        }
+        n++;
+    }
+}
+
+
+
+/* Kernel width (grid points) of the accuracy eps */
+static int nufft_width(double eps)
+{
+    int w;
+    if(eps >= 0.1)
+        return 2;
+    if(eps < 1E-15)
+        return NUFFT_WIDTH_MAX;
+    w = (int)ceil(-log10(eps)) + 1;
+    return w < NUFFT_WIDTH_MAX ? w : NUFFT_WIDTH_MAX;
+}
+
+
+
+/* Gauss-Legendre q nodes z and weights a of the interval [0, 1] */
+static void nufft_gauss(int q, double* z, double* a)
+{
+    int i, k, it;
+    double x, p0, p1, p2, dp;
+
+    for(i = 0; i < q; i++)
+    {
+        x = cos(M_PI * ((double)i + 0.75) / ((double)q + 0.5));
+        for(it = 0; it < 100; it++)
+        {
+            p0 = 1.0;
+            p1 = x;
+            for(k = 2; k <= q; k++)
+            {
+                p2 = ((2.0*k - 1.0) * x * p1 - (k - 1.0) * p0) / (double)k;
+                p0 = p1;
+                p1 = p2;
+            }
+            dp = (double)q * (x * p1 - p0) / (x*x - 1.0);
+            p2 = p1 / dp;
+            x -= p2;
+            if(fabs(p2) < 1E-16)
+                break;
+        }
+        p0 = 1.0;
+        p1 = x;
+        for(k = 2; k <= q; k++)
+        {
+            p2 = ((2.0*k - 1.0) * x * p1 - (k - 1.0) * p0) / (double)k;
+            p0 = p1;
+            p1 = p2;
+        }
+        dp = (double)q * (x * p1 - p0) / (x*x - 1.0);
+        z[i] = 0.5 * (1.0 + x);
+        a[i] = 1.0 / ((1.0 - x*x) * dp * dp);
+    }
+}
+
+
+
+/* Deconvolution factors h(k) = 1 / psi(k), k = 0 ... nh-1, where psi(k) is
+   the Fourier transform of the kernel of w points on the nf-points grid:
+   psi(k) = w * int_0^1 phi(z) cos(pi k w z / nf) dz. The cosines of each
+   quadrature node are calculated by the rotation with the periodic restart */
+static void nufft_deconv(int nh, int w, double beta, int nf, double* h)
+{
+    double z[2*NUFFT_WIDTH_MAX + 2], a[2*NUFFT_WIDTH_MAX + 2];
+    double th, c, s, c1, s1, t;
+    int q, i, k;
+
+    q = 2 * w + 2;
+    nufft_gauss(q, z, a);
+    memset(h, 0, nh * sizeof(double));
+    for(i = 0; i < q; i++)
+    {
+        a[i] *= (double)w * exp(beta * (sqrt(1.0 - z[i]*z[i]) - 1.0));
+        th = M_PI * (double)w * z[i] / (double)nf;
+        c1 = cos(th);
+        s1 = sin(th);
+        c = 1.0;
+        s = 0.0;
+        for(k = 0; k < nh; k++)
+        {
+            if(!(k & 63))
+            {
+                c = cos(th * (double)k);
+                s = sin(th * (double)k);
+            }
+            h[k] += a[i] * c;
+            t = c * c1 - s * s1;
+            s = s * c1 + c * s1;
+            c = t;
+        }
+    }
+    for(k = 0; k < nh; k++)
+        h[k] = 1.0 / h[k];
+}
+
+
+
+/* Kernel values phi(l0 + i - X), i = 0 ... w-1, of the grid position X */
+static int nufft_kernel(double X, int w, double beta, double* v)
+{
+    int l0, i;
+    double z, r = 2.0 / (double)w;
+
+    l0 = (int)ceil(X - 0.5 * (double)w);
+    for(i = 0; i < w; i++)
+    {
+        z = ((double)(l0 + i) - X) * r;
+        z = 1.0 - z*z;
+        v[i] = z > 0.0 ? exp(beta * (sqrt(z) - 1.0)) : 0.0;
+    }
+    return l0;
+}
+
+
+
+/******************************************************************************
+Nonzero if the nk x nx NUFFT with the accuracy eps is faster than the direct
+nk x nx sum of the complex exponents
+*******************************************************************************/
+int nufft_fast(int nx, int nk, double eps)
+{
+    double nf = (double)nufft_grid_size(2 * nk);
+    return (double)nx * (double)nk * NUFFT_DIRECT_COST >
+           (double)nx * (double)nufft_width(eps) + nf * log2(nf);
+}
+
+
+
+/******************************************************************************
+Uniform grid check of the vector w: w(k) = w0 + k * dw with the 
+rounding errors tolerance n * NUFFT_UNIFORM_TOL * max|w(k)|
+*******************************************************************************/
+int nufft_uniform(double* w, int n, double* w0, double* dw)
+{
+    int k;
+    double d, tol;
+
+    if(n < 2)
+        return 0;
+    d = (w[n-1] - w[0]) / (double)(n - 1);
+    tol = NUFFT_UNIFORM_TOL * (double)n * 
+          (fabs(w[0]) > fabs(w[n-1]) ? fabs(w[0]) : fabs(w[n-1]));
+    for(k = 1; k < n - 1; k++)
+        if(fabs(w[k] - w[0] - d * (double)k) > tol)
+            return 0;
+    *w0 = w[0];
+    *dw = d;
+    return 1;
+}
+
+
+
+/******************************************************************************
+Type 1 or type 2 NUFFT, see dft.h
+*******************************************************************************/
+int nufft_krn(double* x, complex_t* s, int nx, int nk, double eps, int type,
+              fft_t* pfft, complex_t* y)
+{
+    double v[NUFFT_WIDTH_MAX];
+    double *h = NULL;
+    double beta, X, sc, re, im;
+    complex_t *g;
+    int w, nf, nh, k, m, i, l, l0, k1, err;
+
+    w = nufft_width(eps);
+    beta = NUFFT_BETA * (double)w;
+    nf = nufft_grid_size(2 * (nk > w ? nk : w));
+    nh = nk / 2 + 1;
+
+    err = fft_create(pfft, nf);
+    if(err != RES_OK)
+        return err;
+
+    h = (double*) malloc(nh * sizeof(double));
+    if(!h)
+        return ERROR_MALLOC;
+    nufft_deconv(nh, w, beta, nf, h);
+
+    g = pfft->t0;
+    memset(g, 0, nf * sizeof(complex_t));
+    sc = (double)nf / M_2PI;
+
+    if(type == 1)
+    {
+        /* spreading of the sources to the grid */
+        for(m = 0; m < nx; m++)
+        {
+            X = x[m] * sc;
+            X -= floor(X / (double)nf) * (double)nf;
+            l0 = nufft_kernel(X, w, beta, v);
+            for(i = 0; i < w; i++)
+            {
+                l = l0 + i;
+                if(l < 0)
+                    l += nf;
+                else if(l >= nf)
+                    l -= nf;
+                RE(g[l]) += RE(s[m]) * v[i];
+                IM(g[l]) += IM(s[m]) * v[i];
+            }
+        }
+        err = fft_krn(pfft->t0, pfft->t1, pfft);
+        if(err != RES_OK)
+            goto exit_label;
+
+        /* deconvolution of the grid spectrum */
+        g = pfft->t1;
+        for(k = 0; k < nk; k++)
+        {
+            k1 = k - nk/2;
+            l = k1 < 0 ? k1 + nf : k1;
+            k1 = k1 < 0 ? -k1 : k1;
+            RE(y[k]) = RE(g[l]) * h[k1];
+            IM(y[k]) = IM(g[l]) * h[k1];
+        }
+    }
+    else
+    {
+        /* deconvolved spectrum at the negative grid frequencies,
+           thus the forward FFT calculates the sum with exp(+j ...) */
+        for(k = 0; k < nk; k++)
+        {
+            k1 = k - nk/2;
+            l = k1 > 0 ? nf - k1 : -k1;
+            k1 = k1 < 0 ? -k1 : k1;
+            RE(g[l]) = RE(s[k]) * h[k1];
+            IM(g[l]) = IM(s[k]) * h[k1];
+        }
+        err = fft_krn(pfft->t0, pfft->t1, pfft);
+        if(err != RES_OK)
+            goto exit_label;
+
+        /* interpolation of the grid signal */
+        g = pfft->t1;
+        for(m = 0; m < nx; m++)
+        {
+            X = x[m] * sc;
+            X -= floor(X / (double)nf) * (double)nf;
+            l0 = nufft_kernel(X, w, beta, v);
+            re = im = 0.0;
+            for(i = 0; i < w; i++)
+            {
+                l = l0 + i;
+                if(l < 0)
+                    l += nf;
+                else if(l >= nf)
+                    l -= nf;
+                re += RE(g[l]) * v[i];
+                im += IM(g[l]) * v[i];
+            }
+            RE(y[m]) = re;
+            IM(y[m]) = im;
+        }
+    }
+
+exit_label:
+    free(h);
+    return err;
+}
+
+
+
+/******************************************************************************
+Trapezoidal Fourier integral by the type 1 NUFFT, see dft.h.
+The trapezoidal rule is the sum of the samples with the weights 
+(t(m+1) - t(m-1)) / 2, the frequencies are shifted to the center
+frequency wc by the samples modulation exp(-j wc t)
+*******************************************************************************/
+int nufft_fourier_integral(double* t, complex_t* s, int nt, 
+                           double w0, double dw, int nw, complex_t* y)
+{
+    fft_t fftp = {0};
+    complex_t *a = NULL;
+    double *x = NULL;
+    double wc, c, re, im, ph;
+    int m, err;
+
+    if(nt < 2)
+    {
+        memset(y, 0, nw * sizeof(complex_t));
+        return RES_OK;
+    }
+
+    a = (complex_t*) malloc(nt * sizeof(complex_t));
+    x = (double*) malloc(nt * sizeof(double));
+    if(!a || !x)
+    {
+        err = ERROR_MALLOC;
+        goto exit_label;
+    }
+
+    wc = w0 + (double)(nw/2) * dw;
+    for(m = 0; m < nt; m++)
+    {
+        c = 0.5 * (t[m < nt-1 ? m+1 : m] - t[m > 0 ? m-1 : m]);
+        re = RE(s[m]) * c;
+        im = IM(s[m]) * c;
+        if(wc != 0.0)
+        {
+            ph = wc * t[m];
+            RE(a[m]) = re * cos(ph) + im * sin(ph);
+            IM(a[m]) = im * cos(ph) - re * sin(ph);
+        }
+        else
+        {
+            RE(a[m]) = re;
+            IM(a[m]) = im;
+        }
+        x[m] = dw * t[m];
+    }
+    err = nufft_krn(x, a, nt, nw, NUFFT_EPS, 1, &fftp, y);
+
+exit_label:
+    fft_free(&fftp);
+    if(a)
+        free(a);
+    if(x)
+        free(x);
+    return err;
+}
+
+
+
+/******************************************************************************
+Fourier series by the type 2 NUFFT, see dft.h.
+The series of the frequencies (k - nw/2) * dw is calculated by the NUFFT,
+the output is shifted to the center frequency wc by exp(j wc t)
+*******************************************************************************/
+int nufft_fourier_series(double w0, double dw, complex_t* s, int nw,
+                         double* t, int nt, complex_t* y)
+{
+    fft_t fftp = {0};
+    double *x = NULL;
+    double wc, re, c, sn;
+    int m, err;
+
+    x = (double*) malloc(nt * sizeof(double));
+    if(!x)
+        return ERROR_MALLOC;
+    for(m = 0; m < nt; m++)
+        x[m] = dw * t[m];
+
+    err = nufft_krn(x, s, nt, nw, NUFFT_EPS, 2, &fftp, y);
+    if(err != RES_OK)
+        goto exit_label;
+
+    wc = w0 + (double)(nw/2) * dw;
+    if(wc != 0.0)
+    {
+        for(m = 0; m < nt; m++)
+        {
+            c  = cos(wc * t[m]);
+            sn = sin(wc * t[m]);
+            re = RE(y[m]);
+            RE(y[m]) = re * c - IM(y[m]) * sn;
+            IM(y[m]) = re * sn + IM(y[m]) * c;
+        }
+    }
+
+exit_label:
+    fft_free(&fftp);
+    free(x);
+    return err;
+}
@@ -0,0 +1,191 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Create the sliding DFT object.
+
+The function fills the `sdft_t` object of the `n`-points sliding DFT
+(see \ref sdft_push). The buffer of the last `n` samples and all the
+tracked bins are set to zero (zero signal before the first sample).
+
+\param[in,out]  psdft
+Pointer to the `sdft_t` object. \n
+Pointer cannot be `NULL`. \n
+The object must be zeroed before the first call.
+The previous state of the object is cleared. \n \n
+
+\param[in]  n
+Sliding window size (DFT size). \n \n
+
+\param[in]  ind
+Pointer to the indexes of the tracked DFT bins. \n
+Vector size is `[k x 1]`. \n
+The indexes can be arbitrary integers and they are taken modulo `n`. \n
+If `ind` is `NULL` then all `n` DFT bins are tracked
+and the parameter `k` is ignored. \n \n
+
+\param[in]  k
+Number of the tracked DFT bins. \n \n
+
+\param[in]  nr
+Re-anchoring period (samples). \n
+The recursive bins update accumulates the rounding errors.
+The bins are recalculated from the samples buffer
+after each `nr` pushed samples
+(by the FFT if all bins are tracked, else by the Goertzel algorithm
+object stored in `psdft`, or by the FFT if it is faster). 
+The re-anchoring does not allocate memory. \n
+`nr = 0` sets the period equal to `n`. \n \n
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Создание объекта скользящего ДПФ
+
+Функция заполняет объект `sdft_t` `n`-точечного скользящего ДПФ
+(см. \ref sdft_push). Буфер последних `n` отсчетов и все
+отслеживаемые отсчеты ДПФ обнуляются
+(нулевой сигнал до первого отсчета).
+
+\param[in,out]  psdft
+Указатель на объект `sdft_t`. \n
+Указатель не должен быть `NULL`. \n
+Объект должен быть обнулен перед первым вызовом.
+Предыдущее состояние объекта очищается. \n \n
+
+\param[in]  n
+Размер скользящего окна (размер ДПФ). \n \n
+
+\param[in]  ind
+Указатель на индексы отслеживаемых отсчетов ДПФ. \n
+Размер вектора `[k x 1]`. \n
+Индексы могут быть произвольными целыми и берутся по модулю `n`. \n
+Если `ind` равен `NULL`, то отслеживаются все `n` отсчетов ДПФ,
+а параметр `k` игнорируется. \n \n
+
+\param[in]  k
+Количество отслеживаемых отсчетов ДПФ. \n \n
+
+\param[in]  nr
+Период пересчета (отсчетов). \n
+Рекурсивное обновление отсчетов накапливает ошибки округления.
+Отсчеты пересчитываются по буферу отсчетов сигнала
+после каждых `nr` поступивших отсчетов
+(при помощи БПФ если отслеживаются все отсчеты,
+иначе объектом алгоритма Гёрцеля, хранящимся в `psdft`, 
+или при помощи БПФ, если это быстрее). 
+Пересчет не выделяет память. \n
+`nr = 0` задает период равным `n`. \n \n
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API sdft_create(sdft_t* psdft, int n, int* ind, int k, int nr)
+{
+    double phi;
+    int i, m, err;
+
+    if(!psdft)
+        return ERROR_PTR;
+    if(n < 1)
+        return ERROR_SIZE;
+    if(ind && k < 1)
+        return ERROR_SIZE;
+    if(nr < 0)
+        return ERROR_ARG_PARAM;
+
+    sdft_free(psdft);
+
+    if(!ind)
+        k = n;
+
+    psdft->x = (complex_t*) malloc(n * sizeof(complex_t));
+    psdft->t = (complex_t*) malloc(n * sizeof(complex_t));
+    psdft->s = (complex_t*) malloc(k * sizeof(complex_t));
+    psdft->w = (complex_t*) malloc(k * sizeof(complex_t));
+    if(ind)
+        psdft->ind = (int*) malloc(k * sizeof(int));
+    if(!psdft->x || !psdft->t || !psdft->s || !psdft->w ||
+       (ind && !psdft->ind))
+    {
+        sdft_free(psdft);
+        return ERROR_MALLOC;
+    }
+
+    memset(psdft->x, 0, n * sizeof(complex_t));
+    memset(psdft->s, 0, k * sizeof(complex_t));
+
+    /* w(i) = exp(j 2 pi ind(i) / n) */
+    for(i = 0; i < k; i++)
+    {
+        m = ind ? ind[i] % n : i;
+        if(m < 0)
+            m += n;
+        if(ind)
+            psdft->ind[i] = m;
+        phi = M_2PI * (double)m / (double)n;
+        RE(psdft->w[i]) = cos(phi);
+        IM(psdft->w[i]) = sin(phi);
+    }
+
+    /* the tracked bins are re-anchored by the Goertzel algorithm object,
+       or by the FFT if it is faster (the object is not created) */
+    if(ind && !goertzel_use_fft(n, k))
+    {
+        err = goertzel_create(&psdft->g, n, psdft->ind, k);
+        if(err != RES_OK)
+        {
+            sdft_free(psdft);
+            return err;
+        }
+    }
+
+    psdft->n   = n;
+    psdft->k   = k;
+    psdft->pos = 0;
+    psdft->cnt = 0;
+    psdft->nr  = nr ? nr : n;
+    return RES_OK;
+}
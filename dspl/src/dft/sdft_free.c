@@ -0,0 +1,79 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Free `sdft_t` structure.
+
+The function clears the samples buffer, the bins
+and the FFT object of the `sdft_t` structure.
+
+\param[in] psdft
+Pointer to the `sdft_t` object. \n
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Очистить структуру `sdft_t` скользящего ДПФ
+
+Функция очищает буфер отсчетов, отсчеты ДПФ
+и объект БПФ структуры `sdft_t`.
+
+\param[in] psdft
+Указатель на структуру `sdft_t`. \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+void DSPL_API sdft_free(sdft_t* psdft)
+{
+    if(!psdft)
+        return;
+    if(psdft->x)
+        free(psdft->x);
+    if(psdft->s)
+        free(psdft->s);
+    if(psdft->w)
+        free(psdft->w);
+    if(psdft->t)
+        free(psdft->t);
+    if(psdft->ind)
+        free(psdft->ind);
+    fft_free(&psdft->fft);
+    goertzel_free(&psdft->g);
+
+    memset(psdft, 0, sizeof(sdft_t));
+}
@@ -0,0 +1,254 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+/* recalculate the bins from the samples buffer (oldest sample first) 
+   by the FFT or by the Goertzel algorithm object of the sdft_t object, 
+   so the re-anchoring does not allocate memory */
+static int sdft_anchor(sdft_t* p)
+{
+    int n = p->n;
+    int i, err;
+
+    memcpy(p->t,              p->x + p->pos, (n - p->pos) * sizeof(complex_t));
+    memcpy(p->t + n - p->pos, p->x,                p->pos * sizeof(complex_t));
+    p->cnt = 0;
+    if(!p->ind)
+        return fft_cmplx(p->t, n, &p->fft, p->s);
+
+    if(!p->g.s)
+    {
+        err = fft_cmplx(p->t, n, &p->fft, p->t);
+        if(err != RES_OK)
+            return err;
+        for(i = 0; i < p->k; i++)
+        {
+            RE(p->s[i]) = RE(p->t[p->ind[i]]);
+            IM(p->s[i]) = IM(p->t[p->ind[i]]);
+        }
+        return RES_OK;
+    }
+
+    err = goertzel_reset(&p->g);
+    if(err == RES_OK)
+        err = goertzel_update_cmplx(&p->g, p->t, n);
+    if(err == RES_OK)
+        err = goertzel_result(&p->g, p->s);
+    return err;
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Push the complex samples block to the sliding DFT.
+
+The sliding DFT tracks the `n`-points DFT bins of the window
+of the last `n` input samples (the oldest sample first):
+\f[
+S_t(k) = \sum_{m = 0}^{n-1} x(t-n+1+m) \exp\left(-j 2\pi \frac{km}{n}\right).
+\f]
+Each new sample \f$ x(t) \f$ updates the tracked bins by the recursion
+\f[
+S_t(k) = \left(S_{t-1}(k) + x(t) - x(t-n)\right)
+\exp\left(j 2\pi \frac{k}{n}\right),
+\f]
+so the cost of one sample is \f$ O(K) \f$ for \f$ K \f$ tracked bins
+instead of the \f$ O(n \log_2 n) \f$ FFT of the window. \n
+The bins are recalculated from the samples buffer after each
+`nr` samples (see \ref sdft_create) to remove the accumulated
+rounding errors. If the block size is not less than `n`, the window
+is filled by the last `n` samples of the block and the bins are
+recalculated once.
+
+\param[in,out]  psdft
+Pointer to the `sdft_t` object created by the \ref sdft_create function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[cnt x 1]`. \n \n
+
+\param[in]  cnt
+Block size. \n \n
+
+\param[out]  y
+Pointer to the tracked bins after the last sample of the block. \n
+Vector size is `[k x 1]` (`[n x 1]` if all bins are tracked). \n
+Pointer can be `NULL`, then the bins are updated
+in the `sdft_t` object only. \n \n
+
+\return
+`RES_OK` if the bins are updated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+sdft_t sdft = {0};
+int ind[2] = {10, 20};
+complex_t y[2];
+
+// 1024-points sliding DFT, bins 10 and 20
+sdft_create(&sdft, 1024, ind, 2, 0);
+
+// 16 new samples: y is the DFT of the last 1024 samples
+sdft_push(&sdft, x, 16, y);
+
+sdft_free(&sdft);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Добавление блока комплексных отсчетов в скользящее ДПФ
+
+Скользящее ДПФ отслеживает отсчеты `n`-точечного ДПФ окна
+последних `n` входных отсчетов (самый старый отсчет первый):
+\f[
+S_t(k) = \sum_{m = 0}^{n-1} x(t-n+1+m) \exp\left(-j 2\pi \frac{km}{n}\right).
+\f]
+Каждый новый отсчет \f$ x(t) \f$ обновляет отслеживаемые отсчеты ДПФ
+рекурсивно
+\f[
+S_t(k) = \left(S_{t-1}(k) + x(t) - x(t-n)\right)
+\exp\left(j 2\pi \frac{k}{n}\right),
+\f]
+поэтому затраты на один отсчет равны \f$ O(K) \f$ для \f$ K \f$
+отслеживаемых отсчетов ДПФ вместо \f$ O(n \log_2 n) \f$ для БПФ окна. \n
+Отсчеты ДПФ пересчитываются по буферу отсчетов сигнала после каждых
+`nr` отсчетов (см. \ref sdft_create) для устранения накопленных
+ошибок округления. Если размер блока не меньше `n`, то окно
+заполняется последними `n` отсчетами блока и отсчеты ДПФ
+пересчитываются один раз.
+
+\param[in,out]  psdft
+Указатель на объект `sdft_t`, созданный функцией \ref sdft_create. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[cnt x 1]`. \n \n
+
+\param[in]  cnt
+Размер блока. \n \n
+
+\param[out]  y
+Указатель на отслеживаемые отсчеты ДПФ после последнего отсчета блока. \n
+Размер вектора `[k x 1]` (`[n x 1]` если отслеживаются все отсчеты). \n
+Указатель может быть `NULL`, тогда отсчеты ДПФ обновляются
+только в объекте `sdft_t`. \n \n
+
+\return
+`RES_OK` если отсчеты ДПФ обновлены успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+sdft_t sdft = {0};
+int ind[2] = {10, 20};
+complex_t y[2];
+
+// 1024-точечное скользящее ДПФ, отсчеты 10 и 20
+sdft_create(&sdft, 1024, ind, 2, 0);
+
+// 16 новых отсчетов: y --- ДПФ последних 1024 отсчетов
+sdft_push(&sdft, x, 16, y);
+
+sdft_free(&sdft);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API sdft_push(sdft_t* psdft, complex_t* x, int cnt, complex_t* y)
+{
+    complex_t d, *s, *w, *b;
+    double re;
+    int i, m, k, err;
+
+    if(!psdft || !x)
+        return ERROR_PTR;
+    if(!psdft->x || cnt < 1)
+        return ERROR_SIZE;
+
+    s = psdft->s;
+    w = psdft->w;
+    b = psdft->x;
+    k = psdft->k;
+
+    if(cnt >= psdft->n)
+    {
+        /* the window is the block tail */
+        memcpy(b, x + cnt - psdft->n, psdft->n * sizeof(complex_t));
+        psdft->pos = 0;
+        err = sdft_anchor(psdft);
+        if(err != RES_OK)
+            return err;
+    }
+    else
+    {
+        for(m = 0; m < cnt; m++)
+        {
+            /* d = x(t) - x(t-n) */
+            RE(d) = RE(x[m]) - RE(b[psdft->pos]);
+            IM(d) = IM(x[m]) - IM(b[psdft->pos]);
+            RE(b[psdft->pos]) = RE(x[m]);
+            IM(b[psdft->pos]) = IM(x[m]);
+            if(++psdft->pos == psdft->n)
+                psdft->pos = 0;
+
+            if(++psdft->cnt >= psdft->nr)
+            {
+                err = sdft_anchor(psdft);
+                if(err != RES_OK)
+                    return err;
+                continue;
+            }
+
+            /* s(i) = (s(i) + d) * w(i) */
+            for(i = 0; i < k; i++)
+            {
+                RE(s[i]) += RE(d);
+                IM(s[i]) += IM(d);
+                re       = CMRE(s[i], w[i]);
+                IM(s[i]) = CMIM(s[i], w[i]);
+                RE(s[i]) = re;
+            }
+        }
+    }
+
+    if(y)
+        memcpy(y, s, k * sizeof(complex_t));
+    return RES_OK;
+}
@@ -0,0 +1,118 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Spectrogram of the real signal.
+
+The function calculates the magnitude \f$ |Y(k, f)| \f$
+of the short-time Fourier transform of the `n`-samples real signal `x`
+(see \ref stft), or the magnitude in dB
+\f$ 20 \log_{10} |Y(k, f)| \f$.
+
+\param[in]  x
+Pointer to the real input signal. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Input signal size, \f$ n \geq N \f$. \n \n
+
+\param[in]  pstft
+Pointer to the `stft_t` object created by the \ref stft_create function. \n
+The stream tail of the object is not used and not changed. \n \n
+
+\param[in]  flag
+Flag: \n
+\f$ 20 \log_{10} |Y(k, f)| \f$ is calculated
+if `flag` has the `DSPL_FLAG_LOGMAG` bit. \n \n
+
+\param[out]  s
+Pointer to the spectrogram matrix. \n
+Matrix size is `[N/2+1 x F]` (see \ref stft). \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if the spectrogram is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Спектрограмма вещественного сигнала
+
+Функция рассчитывает модуль \f$ |Y(k, f)| \f$
+оконного преобразования Фурье вещественного сигнала `x`
+длительности `n` отсчетов (см. \ref stft), или модуль в дБ
+\f$ 20 \log_{10} |Y(k, f)| \f$.
+
+\param[in]  x
+Указатель на вещественный входной сигнал. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер входного сигнала, \f$ n \geq N \f$. \n \n
+
+\param[in]  pstft
+Указатель на объект `stft_t`, созданный функцией \ref stft_create. \n
+Остаток входного потока объекта не используется и не изменяется. \n \n
+
+\param[in]  flag
+Флаг: \n
+рассчитывается \f$ 20 \log_{10} |Y(k, f)| \f$,
+если `flag` содержит бит `DSPL_FLAG_LOGMAG`. \n \n
+
+\param[out]  s
+Указатель на матрицу спектрограммы. \n
+Размер матрицы `[N/2+1 x F]` (см. \ref stft). \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если спектрограмма рассчитана успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API spectrogram(double* x, int n, stft_t* pstft, int flag, double* s)
+{
+    if(!x || !pstft || !s)
+        return ERROR_PTR;
+    if(!pstft->w || n < pstft->nfft)
+        return ERROR_SIZE;
+
+    return stft_krn(x, NULL, 0, 0, (n - pstft->nfft) / pstft->hop + 1, 
+                    pstft, flag, NULL, s);
+}
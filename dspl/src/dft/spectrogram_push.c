@@ -0,0 +1,127 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Streaming spectrogram of the real signal block.
+
+The function is similar to the \ref stft_push function,
+but it calculates the spectra magnitudes of the completed frames,
+or the magnitudes in dB (see \ref spectrogram). \n
+The function can be used to update the waterfall display
+by the new columns as the input blocks arrive.
+
+\param[in,out]  pstft
+Pointer to the `stft_t` object created by the \ref stft_create function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Block size. \n \n
+
+\param[in]  flag
+Flag: \n
+the magnitudes in dB are calculated
+if `flag` has the `DSPL_FLAG_LOGMAG` bit. \n \n
+
+\param[out]  s
+Pointer to the completed frames spectrogram columns. \n
+Matrix size is `[nfft/2+1 x cnt]` (see \ref stft_push). \n
+Memory must be allocated. \n \n
+
+\param[out]  pcnt
+Pointer to the number of the completed frames `cnt`. \n
+Pointer can be `NULL`. \n \n
+
+\return
+`RES_OK` if the block is processed successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Потоковая спектрограмма блока вещественного сигнала
+
+Функция аналогична функции \ref stft_push,
+но рассчитывает модули спектров завершенных кадров,
+или модули в дБ (см. \ref spectrogram). \n
+Функция может использоваться для обновления отображения
+спектрального водопада новыми столбцами по мере поступления
+входных блоков.
+
+\param[in,out]  pstft
+Указатель на объект `stft_t`, созданный функцией \ref stft_create. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер блока. \n \n
+
+\param[in]  flag
+Флаг: \n
+рассчитываются модули в дБ,
+если `flag` содержит бит `DSPL_FLAG_LOGMAG`. \n \n
+
+\param[out]  s
+Указатель на столбцы спектрограммы завершенных кадров. \n
+Размер матрицы `[nfft/2+1 x cnt]` (см. \ref stft_push). \n
+Память должна быть выделена. \n \n
+
+\param[out]  pcnt
+Указатель на количество завершенных кадров `cnt`. \n
+Указатель может быть `NULL`. \n \n
+
+\return
+`RES_OK` если блок обработан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API spectrogram_push(stft_t* pstft, double* x, int n, int flag, 
+                              double* s, int* pcnt)
+{
+    if(!pstft || !x || !s)
+        return ERROR_PTR;
+    if(!pstft->w || n < 1)
+        return ERROR_SIZE;
+
+    return stft_stream(pstft, x, n, flag, NULL, s, pcnt);
+}
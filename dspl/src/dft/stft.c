@@ -0,0 +1,132 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Short-time Fourier transform of the real signal.
+
+The function calculates the short-time Fourier transform (STFT)
+of the `n`-samples real signal `x`:
+\f[
+Y(k, f) = \sum_{m = 0}^{N-1} w(m) x(f \cdot H + m)
+\exp\left(-j \frac{2\pi}{N} m k \right),
+\f]
+here \f$ N \f$ is the frame size `nfft`, \f$ H \f$ is the frames step `hop`
+and \f$ w(m) \f$ is the window of the `stft_t` object,
+\f$ k = 0 \ldots N/2 \f$, \f$ f = 0 \ldots F-1 \f$,
+\f$ F = \lfloor (n - N) / H \rfloor + 1 \f$ is the number of the frames. \n
+The frames are transformed by the batched real FFT.
+
+\param[in]  x
+Pointer to the real input signal. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Input signal size, \f$ n \geq N \f$. \n \n
+
+\param[in]  pstft
+Pointer to the `stft_t` object created by the \ref stft_create function. \n
+The stream tail of the object is not used and not changed. \n \n
+
+\param[out]  y
+Pointer to the time-frequency matrix. \n
+Matrix size is `[N/2+1 x F]`, the column `f` is the spectrum
+of the frame `f`: \f$ Y(k, f) \f$ is stored as `y[f*(N/2+1) + k]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if the STFT is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include stft_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Оконное преобразование Фурье вещественного сигнала
+
+Функция рассчитывает оконное (кратковременное) преобразование Фурье
+вещественного сигнала `x` длительности `n` отсчетов:
+\f[
+Y(k, f) = \sum_{m = 0}^{N-1} w(m) x(f \cdot H + m)
+\exp\left(-j \frac{2\pi}{N} m k \right),
+\f]
+где \f$ N \f$ --- размер кадра `nfft`, \f$ H \f$ --- шаг кадров `hop`,
+\f$ w(m) \f$ --- окно объекта `stft_t`,
+\f$ k = 0 \ldots N/2 \f$, \f$ f = 0 \ldots F-1 \f$,
+\f$ F = \lfloor (n - N) / H \rfloor + 1 \f$ --- количество кадров. \n
+Кадры преобразуются пакетным БПФ вещественного сигнала.
+
+\param[in]  x
+Указатель на вещественный входной сигнал. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер входного сигнала, \f$ n \geq N \f$. \n \n
+
+\param[in]  pstft
+Указатель на объект `stft_t`, созданный функцией \ref stft_create. \n
+Остаток входного потока объекта не используется и не изменяется. \n \n
+
+\param[out]  y
+Указатель на частотно-временную матрицу. \n
+Размер матрицы `[N/2+1 x F]`, столбец `f` --- спектр
+кадра `f`: \f$ Y(k, f) \f$ хранится как `y[f*(N/2+1) + k]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если преобразование рассчитано успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+
+\include stft_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API stft(double* x, int n, stft_t* pstft, complex_t* y)
+{
+    if(!x || !pstft || !y)
+        return ERROR_PTR;
+    if(!pstft->w || n < pstft->nfft)
+        return ERROR_SIZE;
+
+    return stft_krn(x, NULL, 0, 0, (n - pstft->nfft) / pstft->hop + 1, 
+                    pstft, 0, y, NULL);
+}
@@ -0,0 +1,154 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Create the short-time Fourier transform object.
+
+The function calculates the window of the `nfft`-samples frames
+and allocates the workspace of the short-time Fourier transform (STFT)
+functions \ref stft, \ref spectrogram, \ref stft_push,
+\ref spectrogram_push and \ref istft.
+The window is calculated once and it is used for all the frames. \n
+The frames are transformed by the batched real FFT (see \ref fft_batch)
+by the groups of \f$ g \geq 1 \f$ frames.
+The stream tail of the streaming functions is cleared.
+
+\param[in,out]  pstft
+Pointer to the `stft_t` object. \n
+Pointer cannot be `NULL`. \n
+The object must be zeroed before the first call.
+The previous state of the object is cleared. \n \n
+
+\param[in]  nfft
+Frame size (FFT size). \n \n
+
+\param[in]  hop
+Frames step (samples), \f$ 1 \leq hop \leq nfft \f$. \n \n
+
+\param[in]  win_type
+Window type (see \ref window function). \n
+`DSPL_WIN_PERIODIC` windows are recommended for the
+\ref istft synthesis. \n \n
+
+\param[in]  win_param
+Window parameter (see \ref window function). \n \n
+
+\return
+`RES_OK` if the object is created successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Создание объекта оконного преобразования Фурье
+
+Функция рассчитывает окно кадров по `nfft` отсчетов
+и выделяет рабочую память функций оконного преобразования Фурье
+\ref stft, \ref spectrogram, \ref stft_push,
+\ref spectrogram_push и \ref istft.
+Окно рассчитывается один раз и используется для всех кадров. \n
+Кадры преобразуются пакетным БПФ вещественного сигнала
+(см. \ref fft_batch) группами по \f$ g \geq 1 \f$ кадров.
+Остаток входного потока потоковых функций очищается.
+
+\param[in,out]  pstft
+Указатель на объект `stft_t`. \n
+Указатель не должен быть `NULL`. \n
+Объект должен быть обнулен перед первым вызовом.
+Предыдущее состояние объекта очищается. \n \n
+
+\param[in]  nfft
+Размер кадра (размер БПФ). \n \n
+
+\param[in]  hop
+Шаг кадров (отсчетов), \f$ 1 \leq hop \leq nfft \f$. \n \n
+
+\param[in]  win_type
+Тип окна (см. функцию \ref window). \n
+Для синтеза функцией \ref istft рекомендуется использовать
+окна `DSPL_WIN_PERIODIC`. \n \n
+
+\param[in]  win_param
+Параметр окна (см. функцию \ref window). \n \n
+
+\return
+`RES_OK` если объект создан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API stft_create(stft_t* pstft, int nfft, int hop, 
+                         int win_type, double win_param)
+{
+    int g, err;
+
+    if(!pstft)
+        return ERROR_PTR;
+    if(nfft < 1)
+        return ERROR_SIZE;
+    if(hop < 1 || hop > nfft)
+        return ERROR_ARG_PARAM;
+
+    stft_free(pstft);
+
+    g = nfft < FFT_BATCH_SIZE ? FFT_BATCH_SIZE / nfft : 1;
+
+    pstft->w   = (double*)    malloc(nfft * sizeof(double));
+    pstft->t   = (double*)    malloc(g * nfft * sizeof(double));
+    pstft->tc  = (complex_t*) malloc(g * nfft * sizeof(complex_t));
+    pstft->buf = (double*)    malloc(nfft * sizeof(double));
+    if(!pstft->w || !pstft->t || !pstft->tc || !pstft->buf)
+    {
+        err = ERROR_MALLOC;
+        goto error_proc;
+    }
+
+    err = window(pstft->w, nfft, win_type, win_param);
+    if(err != RES_OK)
+        goto error_proc;
+
+    pstft->nfft = nfft;
+    pstft->hop  = hop;
+    pstft->g    = g;
+    pstft->nbuf = 0;
+    return RES_OK;
+
+error_proc:
+    stft_free(pstft);
+    return err;
+}
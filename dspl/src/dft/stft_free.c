@@ -0,0 +1,76 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Free `stft_t` structure.
+
+The function clears the window, the workspace
+and the FFT object of the `stft_t` structure.
+
+\param[in] pstft
+Pointer to the `stft_t` object. \n
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Очистить структуру `stft_t` оконного преобразования Фурье
+
+Функция очищает окно, рабочую память
+и объект БПФ структуры `stft_t`.
+
+\param[in] pstft
+Указатель на структуру `stft_t`. \n
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+void DSPL_API stft_free(stft_t* pstft)
+{
+    if(!pstft)
+        return;
+    if(pstft->w)
+        free(pstft->w);
+    if(pstft->t)
+        free(pstft->t);
+    if(pstft->tc)
+        free(pstft->tc);
+    if(pstft->buf)
+        free(pstft->buf);
+    fft_free(&pstft->fft);
+
+    memset(pstft, 0, sizeof(stft_t));
+}
@@ -0,0 +1,128 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+int stft_krn(double* x, double* xb, int nb, int s, int cnt, stft_t* p,
+             int flag, complex_t* yc, double* ym)
+{
+    double *pt, *py, v;
+    complex_t *pc;
+    int f, b, g, m, k, nk, nfft, pos, idx, err;
+
+    nfft = p->nfft;
+    nk   = nfft / 2 + 1;
+
+    for(f = 0; f < cnt; f += g)
+    {
+        g = cnt - f < p->g ? cnt - f : p->g;
+
+        /* windowed frames of the group */
+        pt = p->t;
+        for(b = 0; b < g; b++)
+        {
+            pos = s + (f + b) * p->hop;
+            if(pos >= 0)
+            {
+                for(m = 0; m < nfft; m++)
+                    pt[m] = p->w[m] * x[pos + m];
+            }
+            else
+            {
+                for(m = 0; m < nfft; m++)
+                {
+                    idx = pos + m;
+                    v = idx < 0 ? xb[nb + idx] : x[idx];
+                    pt[m] = p->w[m] * v;
+                }
+            }
+            pt += nfft;
+        }
+
+        err = fft_batch(p->t, nfft, g, 1, nfft, &p->fft, p->tc);
+        if(err != RES_OK)
+            return err;
+
+        /* nfft/2+1 non-redundant bins of each frame */
+        pc = p->tc;
+        for(b = 0; b < g; b++)
+        {
+            if(yc)
+                memcpy(yc + (f + b) * nk, pc, nk * sizeof(complex_t));
+            else
+            {
+                py = ym + (f + b) * nk;
+                if(flag & DSPL_FLAG_LOGMAG)
+                    for(k = 0; k < nk; k++)
+                        py[k] = 20.0 * log10(ABS(pc[k]) + DBL_EPSILON);
+                else
+                    for(k = 0; k < nk; k++)
+                        py[k] = ABS(pc[k]);
+            }
+            pc += nfft;
+        }
+    }
+    return RES_OK;
+}
+
+
+
+
+int stft_stream(stft_t* p, double* x, int n, int flag, 
+                complex_t* yc, double* ym, int* pcnt)
+{
+    int s, cnt, len, err;
+
+    /* the stream tail samples have the negative indexes */
+    s   = -p->nbuf;
+    cnt = n - s >= p->nfft ? (n - s - p->nfft) / p->hop + 1 : 0;
+    if(cnt)
+    {
+        err = stft_krn(x, p->buf, p->nbuf, s, cnt, p, flag, yc, ym);
+        if(err != RES_OK)
+            return err;
+    }
+
+    /* new tail from the next frame start, len < nfft */
+    s  += cnt * p->hop;
+    len = n - s;
+    if(s >= 0)
+        memcpy(p->buf, x + s, len * sizeof(double));
+    else
+    {
+        memmove(p->buf, p->buf + p->nbuf + s, -s * sizeof(double));
+        memcpy(p->buf - s, x, n * sizeof(double));
+    }
+    p->nbuf = len;
+
+    if(pcnt)
+        *pcnt = cnt;
+    return RES_OK;
+}
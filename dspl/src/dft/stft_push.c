@@ -0,0 +1,154 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Streaming short-time Fourier transform of the real signal block.
+
+The function appends `n` new samples of the real input stream
+and calculates the spectra of all the frames (see \ref stft)
+which are completed by the block. \n
+The stream samples which are not covered by the completed frames
+(less than `nfft` samples) are stored in the `stft_t` object
+and they are used by the next call, so the columns are the same
+as the \ref stft function result of the whole stream
+for any blocks sizes.
+
+\param[in,out]  pstft
+Pointer to the `stft_t` object created by the \ref stft_create function. \n \n
+
+\param[in]  x
+Pointer to the new samples block. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Block size. \n \n
+
+\param[out]  y
+Pointer to the completed frames spectra. \n
+Matrix size is `[nfft/2+1 x cnt]`. \n
+The number of the completed frames `cnt` does not exceed
+\f$ \lfloor (n - 1) / hop \rfloor + 1 \f$,
+memory must be allocated for this number of the columns. \n \n
+
+\param[out]  pcnt
+Pointer to the number of the completed frames `cnt`. \n
+Pointer can be `NULL`. \n \n
+
+\return
+`RES_OK` if the block is processed successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+\code{.cpp}
+stft_t st = {0};
+int cnt;
+
+// 512-samples Hann frames with 128 samples step
+stft_create(&st, 512, 128, DSPL_WIN_HANN | DSPL_WIN_PERIODIC, 0.0);
+
+// new input block of 1000 samples, cnt new columns of y
+stft_push(&st, x, 1000, y, &cnt);
+
+stft_free(&st);
+\endcode
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Потоковое оконное преобразование Фурье блока вещественного сигнала
+
+Функция добавляет `n` новых отсчетов вещественного входного потока
+и рассчитывает спектры всех кадров (см. \ref stft),
+которые завершаются этим блоком. \n
+Отсчеты потока, не вошедшие в завершенные кадры
+(менее `nfft` отсчетов), сохраняются в объекте `stft_t`
+и используются при следующем вызове, поэтому столбцы совпадают
+с результатом функции \ref stft для всего потока
+при любых размерах блоков.
+
+\param[in,out]  pstft
+Указатель на объект `stft_t`, созданный функцией \ref stft_create. \n \n
+
+\param[in]  x
+Указатель на блок новых отсчетов. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер блока. \n \n
+
+\param[out]  y
+Указатель на спектры завершенных кадров. \n
+Размер матрицы `[nfft/2+1 x cnt]`. \n
+Количество завершенных кадров `cnt` не превышает
+\f$ \lfloor (n - 1) / hop \rfloor + 1 \f$,
+память должна быть выделена для этого количества столбцов. \n \n
+
+\param[out]  pcnt
+Указатель на количество завершенных кадров `cnt`. \n
+Указатель может быть `NULL`. \n \n
+
+\return
+`RES_OK` если блок обработан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+\code{.cpp}
+stft_t st = {0};
+int cnt;
+
+// кадры 512 отсчетов с окном Ханна и шагом 128 отсчетов
+stft_create(&st, 512, 128, DSPL_WIN_HANN | DSPL_WIN_PERIODIC, 0.0);
+
+// новый входной блок 1000 отсчетов, cnt новых столбцов y
+stft_push(&st, x, 1000, y, &cnt);
+
+stft_free(&st);
+\endcode
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API stft_push(stft_t* pstft, double* x, int n, complex_t* y, 
+                       int* pcnt)
+{
+    if(!pstft || !x || !y)
+        return ERROR_PTR;
+    if(!pstft->w || n < 1)
+        return ERROR_SIZE;
+
+    return stft_stream(pstft, x, n, 0, y, NULL, pcnt);
+}
@@ -0,0 +1,206 @@
+/*
+* Copyright (c) 2015-2024 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.    If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+#include "dspl.h"
+#include "dft.h"
+
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Zoom FFT: spectrum of the complex signal in the given frequency band.
+
+The function calculates `m` samples of the discrete-time Fourier transform
+of the `n`-points complex input vector `x`
+\f[
+Y(k) = \sum_{p = 0}^{n-1} x(p) \exp\left(-j 2\pi \frac{f_k}{f_s} p \right),
+\qquad
+f_k = f_0 + k \frac{f_1 - f_0}{m-1}, \qquad k = 0 \ldots m-1,
+\f]
+uniformly spaced from the frequency \f$ f_0 \f$ to the frequency
+\f$ f_1 \f$ inclusive. \n
+The spectrum is calculated by the chirp Z-transform
+(see \ref czt_cmplx) on the unit circle arc, so the frequency resolution
+\f$ (f_1 - f_0) / (m-1) \f$ does not depend on the signal size `n`
+and the number of operations is \f$ O((n+m) \log_2(n+m)) \f$. \n
+The function creates the `czt_t` object at the first call
+and recreates it only if `n`, `m` or the band are changed,
+so the chirp vectors are calculated once for the repeated frames. \n
+The contour angles \f$ f_0 / f_s \f$ and \f$ (f_1 - f_0) / ((m-1) f_s) \f$
+are calculated in the double-double arithmetic, thus the narrow band
+of the long signal is calculated without the phase error growth.
+
+\param[in]  x
+Pointer to the complex input vector. \n
+Vector size is `[n x 1]`. \n \n
+
+\param[in]  n
+Input vector size. \n \n
+
+\param[in]  f0
+Band start frequency (Hz). \n \n
+
+\param[in]  f1
+Band stop frequency (Hz). \n \n
+
+\param[in]  fs
+Sample rate (Hz). \n \n
+
+\param[in]  m
+Number of the spectrum samples. \n
+If `m = 1` the only frequency \f$ f_0 \f$ is calculated. \n \n
+
+\param[in,out]  pczt
+Pointer to the `czt_t` object. \n
+The object must be zeroed before the first call
+and it must be cleared by the \ref czt_free function. \n \n
+
+\param[out]  y
+Pointer to the spectrum vector. \n
+Vector size is `[m x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if the spectrum is calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+Example:
+
+\include zoom_fft_test.c
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\brief Zoom FFT: спектр комплексного сигнала в заданной полосе частот
+
+Функция рассчитывает `m` отсчетов дискретно-временного
+преобразования Фурье `n` отсчетов комплексного входного вектора `x`
+\f[
+Y(k) = \sum_{p = 0}^{n-1} x(p) \exp\left(-j 2\pi \frac{f_k}{f_s} p \right),
+\qquad
+f_k = f_0 + k \frac{f_1 - f_0}{m-1}, \qquad k = 0 \ldots m-1,
+\f]
+равномерно расположенных от частоты \f$ f_0 \f$ до частоты
+\f$ f_1 \f$ включительно. \n
+Спектр рассчитывается при помощи ЛЧМ Z-преобразования
+(см. \ref czt_cmplx) на дуге единичной окружности,
+поэтому разрешение по частоте \f$ (f_1 - f_0) / (m-1) \f$
+не зависит от размера сигнала `n`,
+а количество операций равно \f$ O((n+m) \log_2(n+m)) \f$. \n
+Функция создает объект `czt_t` при первом вызове
+и пересоздает его только при изменении `n`, `m` или полосы частот,
+поэтому ЛЧМ векторы рассчитываются один раз для повторяющихся кадров. \n
+Углы контура \f$ f_0 / f_s \f$ и \f$ (f_1 - f_0) / ((m-1) f_s) \f$
+рассчитываются в арифметике двойной-двойной точности,
+поэтому узкая полоса длинного сигнала рассчитывается без роста
+ошибки фазы.
+
+\param[in]  x
+Указатель на комплексный входной вектор. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param[in]  n
+Размер входного вектора. \n \n
+
+\param[in]  f0
+Начальная частота полосы (Гц). \n \n
+
+\param[in]  f1
+Конечная частота полосы (Гц). \n \n
+
+\param[in]  fs
+Частота дискретизации (Гц). \n \n
+
+\param[in]  m
+Количество отсчетов спектра. \n
+Если `m = 1`, то рассчитывается только частота \f$ f_0 \f$. \n \n
+
+\param[in,out]  pczt
+Указатель на объект `czt_t`. \n
+Объект должен быть обнулен перед первым вызовом
+и должен быть очищен функцией \ref czt_free. \n \n
+
+\param[out]  y
+Указатель на вектор спектра. \n
+Размер вектора `[m x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если спектр рассчитан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+Пример:
+
+\include zoom_fft_test.c
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API zoom_fft(complex_t* x, int n, double f0, double f1, double fs,
+                      int m, czt_t* pczt, complex_t* y)
+{
+    complex_t w, a;
+    double fw[2], fa[2], d, dl, b, q, ql;
+    int err;
+
+    if(!x || !y || !pczt)
+        return ERROR_PTR;
+    if(n < 1 || m < 1)
+        return ERROR_SIZE;
+    if(fs <= 0.0)
+        return ERROR_FS;
+
+    /* z(k) = A W^(-k) = exp(j 2 pi (f0 + k df) / fs), df = (f1-f0)/(m-1),
+       fw = -df / fs and fa = f0 / fs are the double-double angles */
+    fw[0] = fw[1] = 0.0;
+    if(m > 1)
+    {
+        /* d + dl = f1 - f0 and q + ql = (m-1) fs exactly */
+        d  = f1 - f0;
+        b  = d - f1;
+        dl = (f1 - (d - b)) - (f0 + b);
+        q  = (double)(m - 1) * fs;
+        ql = fma((double)(m - 1), fs, -q);
+        czt_div(-d, -dl, q, ql, fw);
+    }
+    czt_div(f0, 0.0, fs, 0.0, fa);
+
+    RE(w) = cos(M_2PI * fw[0]);
+    IM(w) = sin(M_2PI * fw[0]);
+    RE(a) = cos(M_2PI * fa[0]);
+    IM(a) = sin(M_2PI * fa[0]);
+
+    err = czt_create_krn(pczt, n, m, w, fw, a, fa);
+    if(err != RES_OK)
+        return err;
+
+    return czt_cmplx(x, pczt, y);
+}
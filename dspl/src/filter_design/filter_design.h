@@ -8,5 +8,11 @@ int fir_linphase_lpf(int ord, double wp, int wintype,
 
 int iir_ap(double rp, double rs, int ord, int type, double* b, double* a);
 
+
+/* Relative imaginary part tolerance of the real zeros and poles 
+   of the second-order sections design */
+#define FILTER_SOS_TOL  1E-9
+
+
 #endif
 
@@ -0,0 +1,209 @@
+/*
+* \file filter_tf2sos.c
+* \author Sergey Bakhurin <admin\dsplib.org>
+* \copyright Copyright (c) 2015-2024 Sergey Bakhurin
+*
+* \section DESCRIPTION
+* Digital Signal Processing Library [http://dsplib.org]
+* 
+* This file is part of libdspl-2.0.
+*
+* libdspl-2.0 is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* libdspl-2.0 is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with libdspl-2.0. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+#include "filter_design.h"
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\brief Second-order sections of the filter transfer function.
+
+Function calculates the cascade of `ns = (ord+1)/2` second-order sections
+of the real filter transfer function
+\f[
+  H(z) = \frac{\sum_{m = 0}^{ord} b_m z^{-m}}
+              {\sum_{m = 0}^{ord} a_m z^{-m}}.
+\f]
+The zeros and poles are calculated by the \ref polyroots function
+and are grouped to the sections by the \ref filter_zp2sos function. \n
+The zeros \f$ z = \pm 1 \f$ are deflated from the numerator before 
+the \ref polyroots call. \n
+The roots of the high order polynomial are calculated with the large error,
+especially the multiple roots, so the \ref iir_sos function is preferred 
+for the filter design.
+
+\param[in]  b
+Pointer to the transfer function \f$ H(z) \f$ numerator coefficients. \n
+Vector size is `[ord+1 x 1]`. \n
+Coefficient `b[0]` must be nonzero. \n \n
+
+\param[in]  a
+Pointer to the transfer function \f$ H(z) \f$ denominator coefficients. \n
+Vector size is `[ord+1 x 1]`. \n \n
+
+\param[in]  ord
+Filter order. \n \n
+
+\param[out]  sb
+Pointer to the sections numerators. \n
+Vector size is `[3*ns x 1]`. \n
+Memory must be allocated. \n \n
+
+\param[out]  sa
+Pointer to the sections denominators. \n
+Vector size is `[3*ns x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if the sections are calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\brief Звенья второго порядка передаточной функции фильтра
+
+Функция рассчитывает каскад из `ns = (ord+1)/2` звеньев второго порядка
+передаточной функции вещественного фильтра
+\f[
+  H(z) = \frac{\sum_{m = 0}^{ord} b_m z^{-m}}
+              {\sum_{m = 0}^{ord} a_m z^{-m}}.
+\f]
+Нули и полюсы рассчитываются функцией \ref polyroots
+и группируются в звенья функцией \ref filter_zp2sos. \n
+Нули \f$ z = \pm 1 \f$ исключаются из числителя перед вызовом
+функции \ref polyroots. \n
+Корни полинома высокого порядка, особенно кратные, рассчитываются 
+с большой погрешностью, поэтому для расчета фильтра предпочтительнее 
+использовать функцию \ref iir_sos.
+
+\param[in]  b
+Указатель на коэффициенты числителя передаточной функции \f$ H(z) \f$. \n
+Размер вектора `[ord+1 x 1]`. \n
+Коэффициент `b[0]` должен быть ненулевым. \n \n
+
+\param[in]  a
+Указатель на коэффициенты знаменателя передаточной функции \f$ H(z) \f$. \n
+Размер вектора `[ord+1 x 1]`. \n \n
+
+\param[in]  ord
+Порядок фильтра. \n \n
+
+\param[out]  sb
+Указатель на числители звеньев. \n
+Размер вектора `[3*ns x 1]`. \n
+Память должна быть выделена. \n \n
+
+\param[out]  sa
+Указатель на знаменатели звеньев. \n
+Размер вектора `[3*ns x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если звенья рассчитаны успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API filter_tf2sos(double* b, double* a, int ord, 
+                           double* sb, double* sa)
+{
+    double *c = NULL;
+    complex_t *z = NULL, *p = NULL;
+    double r, v, s;
+    int m, n, res;
+
+    if(!b || !a || !sb || !sa)
+        return ERROR_PTR;
+    if(ord < 1)
+        return ERROR_FILTER_ORD;
+    if(a[0] == 0.0)
+        return ERROR_FILTER_A0;
+
+    c = (double*)    malloc((ord + 1) * sizeof(double));
+    z = (complex_t*) malloc(ord * sizeof(complex_t));
+    p = (complex_t*) malloc(ord * sizeof(complex_t));
+    if(!c || !z || !p)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+
+    /* The multiple zeros z = 1 and z = -1 of the LPF, HPF and BPF are 
+       calculated by polyroots as the cluster of the complex roots, 
+       so they are deflated from the numerator before. 
+       c[0..n] is the numerator polynomial of z with the descending powers */
+    memcpy(c, b, (ord + 1) * sizeof(double));
+    n = ord;
+    for(r = 1.0; r > -2.0; r -= 2.0)
+    {
+        while(n > 0)
+        {
+            v = s = 0.0;
+            for(m = 0; m <= n; m++)
+            {
+                v = v * r + c[m];
+                s += fabs(c[m]);
+            }
+            if(fabs(v) > FILTER_SOS_TOL * s)
+                break;
+            for(m = 1; m < n; m++)
+                c[m] += r * c[m-1];
+            n--;
+            RE(z[n]) = r;
+            IM(z[n]) = 0.0;
+        }
+    }
+
+    /* H(z) zeros and poles are the roots of the reversed polynomials */
+    if(n > 0)
+    {
+        for(m = 0; m < (n + 1) / 2; m++)
+        {
+            v = c[m];
+            c[m] = c[n - m];
+            c[n - m] = v;
+        }
+        res = polyroots(c, n, z, NULL);
+        if(res != RES_OK)
+            goto exit_label;
+    }
+
+    for(m = 0; m <= ord; m++)
+        c[m] = a[ord - m];
+    res = polyroots(c, ord, p, NULL);
+    if(res != RES_OK)
+        goto exit_label;
+
+    res = filter_zp2sos(z, ord, p, ord, b[0] / a[0], sb, sa);
+
+exit_label:
+    if(c)
+        free(c);
+    if(z)
+        free(z);
+    if(p)
+        free(p);
+    return res;
+}
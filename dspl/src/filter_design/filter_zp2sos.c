@@ -0,0 +1,468 @@
+/*
+* \file filter_zp2sos.c
+* \author Sergey Bakhurin <admin\dsplib.org>
+* \copyright Copyright (c) 2015-2024 Sergey Bakhurin
+*
+* \section DESCRIPTION
+* Digital Signal Processing Library [http://dsplib.org]
+* 
+* This file is part of libdspl-2.0.
+*
+* libdspl-2.0 is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* libdspl-2.0 is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with libdspl-2.0. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+#include "filter_design.h"
+
+
+/* Split the conjugate-symmetric roots r into the roots with the positive 
+   imaginary part rc[nc] and the real roots rr[nr]. 
+   The complex roots are paired starting from the largest imaginary part,
+   each with the root nearest to its conjugate, and the pair quadratic 
+   is calculated from both roots. So the roots perturbed by the rounding 
+   errors (e.g. the multiple roots cluster) are grouped correctly: 
+   the pair of the real roots gives two real roots and the unpaired root 
+   with the imaginary part less than the distance to the cluster roots 
+   is real. Returns RES_OK or ERROR_ARG_PARAM if the roots are not 
+   conjugate pairs */
+static int sos_split(complex_t* r, int n, complex_t* rc, int* nc, 
+                     double* rr, int* nr)
+{
+    int *st = NULL;
+    int i, q, m, res = RES_OK;
+    double d, dm, c1, c2, t;
+
+    *nc = *nr = 0;
+    if(n < 1)
+        return RES_OK;
+    st = (int*) malloc(n * sizeof(int));
+    if(!st)
+        return ERROR_MALLOC;
+
+    /* st[i] is nonzero if r[i] is real or paired already */
+    for(i = 0; i < n; i++)
+    {
+        st[i] = fabs(IM(r[i])) <= FILTER_SOS_TOL * ABS(r[i]);
+        if(st[i])
+            rr[(*nr)++] = RE(r[i]);
+    }
+
+    for(;;)
+    {
+        q = -1;
+        for(i = 0; i < n; i++)
+            if(!st[i] && (q < 0 || fabs(IM(r[i])) > fabs(IM(r[q]))))
+                q = i;
+        if(q < 0)
+            break;
+        st[q] = 1;
+
+        m  = -1;
+        dm = 0.0;
+        for(i = 0; i < n; i++)
+        {
+            if(st[i] || IM(r[i]) * IM(r[q]) > 0.0)
+                continue;
+            d = hypot(RE(r[i]) - RE(r[q]), IM(r[i]) + IM(r[q]));
+            if(m < 0 || d < dm)
+            {
+                m  = i;
+                dm = d;
+            }
+        }
+
+        if(m < 0)
+        {
+            /* unpaired root is real if it is inside the roots cluster */
+            for(i = 0; i < n; i++)
+            {
+                if(i == q)
+                    continue;
+                d = hypot(RE(r[i]) - RE(r[q]), IM(r[i]) - IM(r[q]));
+                if(m < 0 || d < dm)
+                {
+                    m  = i;
+                    dm = d;
+                }
+            }
+            if(m < 0 || fabs(IM(r[q])) > dm)
+            {
+                res = ERROR_ARG_PARAM;
+                break;
+            }
+            rr[(*nr)++] = RE(r[q]);
+            continue;
+        }
+        st[m] = 1;
+
+        /* pair quadratic x^2 + c1 x + c2 */
+        c1 = -(RE(r[q]) + RE(r[m]));
+        c2 = RE(r[q]) * RE(r[m]) - IM(r[q]) * IM(r[m]);
+        t  = c2 - 0.25 * c1 * c1;
+        if(t > 0.0)
+        {
+            RE(rc[*nc]) = -0.5 * c1;
+            IM(rc[*nc]) = sqrt(t);
+            (*nc)++;
+        }
+        else
+        {
+            t = sqrt(-t);
+            rr[(*nr)++] = -0.5 * c1 + t;
+            rr[(*nr)++] = -0.5 * c1 - t;
+        }
+    }
+    free(st);
+    return res;
+}
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\brief Second-order sections of the filter defined by zeros and poles.
+
+Function groups the zeros `z` and poles `p` of the real filter
+\f[
+  H(z) = k \frac{\prod_{i=0}^{nz-1} \left(1 - z_i z^{-1}\right)}
+                {\prod_{i=0}^{np-1} \left(1 - p_i z^{-1}\right)}
+\f]
+into the cascade of `ns = (np+1)/2` second-order sections (biquads)
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}}.
+\f]
+The complex zeros and poles must be the complex conjugate pairs.
+The pairs are matched by the nearest roots, so the roots perturbed by
+the rounding errors (e.g. the multiple roots calculated 
+by \ref polyroots) are allowed.
+The poles pairs nearest to the unit circle are processed first and
+each of them gets the nearest zeros pair, so the gain of the each section
+is bounded. The sections are ordered by the poles distance 
+to the unit circle: the last section has the poles nearest 
+to the unit circle. The gain `k` is divided between the sections: 
+each section numerator is multiplied by \f$ |k|^{1/ns} \f$ 
+and the first section gets the sign of `k`. \n
+If the number of the real poles is odd then the section with one real pole 
+is the first-order section (\f$ a_{3s+2} = b_{3s+2} = 0 \f$).
+The sections can be used in the \ref filter_sos function.
+
+\param[in]  z
+Pointer to the zeros vector. \n
+Vector size is `[nz x 1]`. \n
+The pointer can be `NULL` if `nz = 0`. \n \n
+
+\param[in]  nz
+Number of zeros. Must be not greater than `np`. \n \n
+
+\param[in]  p
+Pointer to the poles vector. \n
+Vector size is `[np x 1]`. \n \n
+
+\param[in]  np
+Number of poles. \n \n
+
+\param[in]  k
+Filter gain. \n \n
+
+\param[out]  b
+Pointer to the sections numerators. \n
+Vector size is `[3*ns x 1]`. \n
+Memory must be allocated. \n \n
+
+\param[out]  a
+Pointer to the sections denominators. \n
+Vector size is `[3*ns x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if the sections are calculated successfully. \n
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\brief Звенья второго порядка фильтра, заданного нулями и полюсами
+
+Функция группирует нули `z` и полюсы `p` вещественного фильтра
+\f[
+  H(z) = k \frac{\prod_{i=0}^{nz-1} \left(1 - z_i z^{-1}\right)}
+                {\prod_{i=0}^{np-1} \left(1 - p_i z^{-1}\right)}
+\f]
+в каскад из `ns = (np+1)/2` звеньев второго порядка (биквадратных звеньев)
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}}.
+\f]
+Комплексные нули и полюсы должны быть комплексно-сопряженными парами.
+Пары составляются из ближайших корней, поэтому допускаются корни, 
+искаженные ошибками округления (например, кратные корни, рассчитанные
+функцией \ref polyroots).
+Пары полюсов, ближайшие к единичной окружности, обрабатываются первыми,
+и каждой из них назначается ближайшая пара нулей, поэтому усиление 
+каждого звена ограничено. Звенья упорядочены по расстоянию полюсов 
+до единичной окружности: последнее звено имеет полюсы, ближайшие
+к единичной окружности. Коэффициент усиления `k` делится между
+звеньями: числитель каждого звена умножается на \f$ |k|^{1/ns} \f$, 
+а первое звено получает знак `k`. \n
+Если число вещественных полюсов нечетное, то звено с одним вещественным
+полюсом является звеном первого порядка (\f$ a_{3s+2} = b_{3s+2} = 0 \f$).
+Звенья могут использоваться в функции \ref filter_sos.
+
+\param[in]  z
+Указатель на вектор нулей. \n
+Размер вектора `[nz x 1]`. \n
+Указатель может быть `NULL`, если `nz = 0`. \n \n
+
+\param[in]  nz
+Число нулей. Должно быть не больше `np`. \n \n
+
+\param[in]  p
+Указатель на вектор полюсов. \n
+Размер вектора `[np x 1]`. \n \n
+
+\param[in]  np
+Число полюсов. \n \n
+
+\param[in]  k
+Коэффициент усиления фильтра. \n \n
+
+\param[out]  b
+Указатель на числители звеньев. \n
+Размер вектора `[3*ns x 1]`. \n
+Память должна быть выделена. \n \n
+
+\param[out]  a
+Указатель на знаменатели звеньев. \n
+Размер вектора `[3*ns x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если звенья рассчитаны успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API filter_zp2sos(complex_t* z, int nz, complex_t* p, int np,
+                           double k, double* b, double* a)
+{
+    complex_t *zc = NULL, *pc = NULL, *pu = NULL;
+    double *zr = NULL, *pr = NULL, *du = NULL, *au = NULL;
+    int *ord = NULL, *ind = NULL;
+    int nzc, nzr, npc, npr, ns, nu2, i, j, m, u, s, res;
+    double d, dm, t, r;
+    complex_t c;
+
+    if(!p || !b || !a || (nz && !z))
+        return ERROR_PTR;
+    if(np < 1 || nz < 0)
+        return ERROR_SIZE;
+    if(nz > np)
+        return ERROR_POLY_ORD;
+
+    ns  = (np + 1) / 2;
+    zc  = (complex_t*) malloc((nz + 1) * sizeof(complex_t));
+    zr  = (double*)    malloc((nz + 1) * sizeof(double));
+    pc  = (complex_t*) malloc(np * sizeof(complex_t));
+    pr  = (double*)    malloc(np * sizeof(double));
+    pu  = (complex_t*) malloc(ns * sizeof(complex_t));
+    du  = (double*)    malloc(ns * sizeof(double));
+    au  = (double*)    malloc(2 * ns * sizeof(double));
+    ord = (int*)       malloc(ns * sizeof(int));
+    ind = (int*)       malloc(ns * sizeof(int));
+    if(!zc || !zr || !pc || !pr || !pu || !du || !au || !ord || !ind)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+
+    res = sos_split(z, nz, zc, &nzc, zr, &nzr);
+    if(res != RES_OK)
+        goto exit_label;
+    res = sos_split(p, np, pc, &npc, pr, &npr);
+    if(res != RES_OK)
+        goto exit_label;
+
+    /* real poles are sorted by the distance to the unit circle */
+    for(i = 1; i < npr; i++)
+    {
+        t = pr[i];
+        for(j = i; j > 0 && fabs(1.0 - fabs(pr[j-1])) > fabs(1.0 - fabs(t)); j--)
+            pr[j] = pr[j-1];
+        pr[j] = t;
+    }
+
+    /* poles units: complex pairs, real pairs and the last single real pole.
+       au[2u], au[2u+1] is the unit denominator, pu[u] is the unit pole 
+       nearest to the unit circle, du[u] is its distance to the circle */
+    u = 0;
+    for(i = 0; i < npc; i++, u++)
+    {
+        au[2*u]   = -2.0 * RE(pc[i]);
+        au[2*u+1] = ABSSQR(pc[i]);
+        RE(pu[u]) = RE(pc[i]);
+        IM(pu[u]) = IM(pc[i]);
+        ord[u] = 2;
+    }
+    for(i = 0; i < npr; i += 2, u++)
+    {
+        if(i + 1 < npr)
+        {
+            au[2*u]   = -(pr[i] + pr[i+1]);
+            au[2*u+1] = pr[i] * pr[i+1];
+            ord[u] = 2;
+        }
+        else
+        {
+            au[2*u]   = -pr[i];
+            au[2*u+1] = 0.0;
+            ord[u] = 1;
+        }
+        RE(pu[u]) = pr[i];
+        IM(pu[u]) = 0.0;
+    }
+    for(u = 0; u < ns; u++)
+        du[u] = fabs(1.0 - ABS(pu[u]));
+
+    /* units order: the nearest to the unit circle first */
+    for(i = 0; i < ns; i++)
+    {
+        for(j = i; j > 0 && du[ind[j-1]] > du[i]; j--)
+            ind[j] = ind[j-1];
+        ind[j] = i;
+    }
+
+    nu2 = 0;
+    for(u = 0; u < ns; u++)
+        nu2 += (ord[u] == 2);
+
+    /* zeros assignment. The complex zeros pairs must be not more 
+       than the remaining second-order units */
+    for(i = 0; i < ns; i++)
+    {
+        u = ind[i];
+        s = ns - 1 - i;
+        a[3*s]   = 1.0;
+        a[3*s+1] = au[2*u];
+        a[3*s+2] = au[2*u+1];
+        b[3*s]   = 1.0;
+        b[3*s+1] = 0.0;
+        b[3*s+2] = 0.0;
+
+        /* m is the nearest zero index: m < nzc for the complex pair, 
+           nzc + j for the real zero zr[j], -1 if no zeros remain */
+        m  = -1;
+        dm = 0.0;
+        for(j = 0; j < nzc && ord[u] == 2; j++)
+        {
+            RE(c) = RE(zc[j]) - RE(pu[u]);
+            IM(c) = IM(zc[j]) - IM(pu[u]);
+            d = ABS(c);
+            if(m < 0 || d < dm)
+            {
+                m  = j;
+                dm = d;
+            }
+        }
+        if(ord[u] == 1 || nzc < nu2)
+        {
+            for(j = 0; j < nzr; j++)
+            {
+                RE(c) = zr[j] - RE(pu[u]);
+                IM(c) = IM(pu[u]);
+                d = ABS(c);
+                if(m < 0 || d < dm)
+                {
+                    m  = nzc + j;
+                    dm = d;
+                }
+            }
+        }
+        if(ord[u] == 2)
+            nu2--;
+
+        if(m < 0)
+            continue;
+        if(m < nzc)
+        {
+            b[3*s+1] = -2.0 * RE(zc[m]);
+            b[3*s+2] = ABSSQR(zc[m]);
+            nzc--;
+            RE(zc[m]) = RE(zc[nzc]);
+            IM(zc[m]) = IM(zc[nzc]);
+        }
+        else
+        {
+            m -= nzc;
+            r = zr[m];
+            b[3*s+1] = -r;
+            zr[m] = zr[--nzr];
+            if(ord[u] == 2 && nzr)
+            {
+                /* second real zero nearest to the unit pole */
+                m = 0;
+                for(j = 1; j < nzr; j++)
+                    if(fabs(zr[j] - RE(pu[u])) < fabs(zr[m] - RE(pu[u])))
+                        m = j;
+                b[3*s+1] = -(r + zr[m]);
+                b[3*s+2] = r * zr[m];
+                zr[m] = zr[--nzr];
+            }
+        }
+    }
+
+    /* the gain is divided between the sections equally, 
+       so the sections outputs are of the same order */
+    t = pow(fabs(k), 1.0 / (double)ns);
+    for(s = 0; s < 3*ns; s++)
+        b[s] *= t;
+    if(k < 0.0)
+    {
+        b[0] = -b[0];
+        b[1] = -b[1];
+        b[2] = -b[2];
+    }
+
+exit_label:
+    if(zc)
+        free(zc);
+    if(zr)
+        free(zr);
+    if(pc)
+        free(pc);
+    if(pr)
+        free(pr);
+    if(pu)
+        free(pu);
+    if(du)
+        free(du);
+    if(au)
+        free(au);
+    if(ord)
+        free(ord);
+    if(ind)
+        free(ind);
+    return res;
+}
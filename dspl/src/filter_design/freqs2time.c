@@ -65,20 +65,26 @@ int DSPL_API freqs2time(double* b, double* a, int ord, double fs,
     if(err != RES_OK)
         goto exit_label;
 
-    ht = (complex_t*)malloc(n*sizeof(complex_t));
-
-    err = ifft_cmplx(hs, n, pfft, ht);
-    if(err != RES_OK)
+    /* hs is Hermitian for the real filter and even n 
+       (frequency grid is symmetric): real IFFT of the spectrum half */
+    if(!(n%2))
+        err = ifft(hs, n, pfft, h);
+    if(n%2 || err != RES_OK)
     {
-        err = idft_cmplx(hs, n, ht);
+        ht = (complex_t*)malloc(n*sizeof(complex_t));
+        err = ifft_cmplx(hs, n, pfft, ht);
+        if(err != RES_OK)
+            err = idft_cmplx(hs, n, ht);
         if(err != RES_OK)
             goto exit_label;
+        for(k = 0; k < n; k++)
+            h[k] = RE(ht[k]);
     }
 
     for(k = 0; k < n; k++)
     {
         t[k] = (double)k/fs;
-        h[k] = RE(ht[k]) * fs;
+        h[k] *= fs;
     }
 
 exit_label:
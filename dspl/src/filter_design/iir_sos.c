@@ -0,0 +1,439 @@
+/*
+* \file iir_sos.c
+* \author Sergey Bakhurin <admin\dsplib.org>
+* \copyright Copyright (c) 2015-2024 Sergey Bakhurin
+*
+* \section DESCRIPTION
+* Digital Signal Processing Library [http://dsplib.org]
+* 
+* This file is part of libdspl-2.0.
+*
+* libdspl-2.0 is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser    General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* libdspl-2.0 is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.    See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with libdspl-2.0. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+#include "filter_design.h"
+
+
+/* Re( prod(s - z) / prod(s - p) ) for the real s */
+static double sos_gain(complex_t* z, int nz, complex_t* p, int np, double s)
+{
+    complex_t num, den;
+    double t;
+    int i;
+
+    RE(num) = RE(den) = 1.0;
+    IM(num) = IM(den) = 0.0;
+    for(i = 0; i < nz; i++)
+    {
+        t       = (s - RE(z[i])) * RE(num) + IM(z[i]) * IM(num);
+        IM(num) = (s - RE(z[i])) * IM(num) - IM(z[i]) * RE(num);
+        RE(num) = t;
+    }
+    for(i = 0; i < np; i++)
+    {
+        t       = (s - RE(p[i])) * RE(den) + IM(p[i]) * IM(den);
+        IM(den) = (s - RE(p[i])) * IM(den) - IM(p[i]) * RE(den);
+        RE(den) = t;
+    }
+    return CMCONJRE(num, den) / ABSSQR(den);
+}
+
+
+
+/* r = w / r for the each of n roots */
+static void sos_inv(complex_t* r, int n, double w)
+{
+    double t;
+    int i;
+    for(i = 0; i < n; i++)
+    {
+        t = w / ABSSQR(r[i]);
+        RE(r[i]) *=  t;
+        IM(r[i]) *= -t;
+    }
+}
+
+
+
+/* s -> s / w frequency scaling: the roots are multiplied by w 
+   and the gain k is multiplied by w^(np-nz) */
+static void sos_scale(complex_t* z, int nz, complex_t* p, int np, 
+                      double w, double* k)
+{
+    int i;
+    for(i = 0; i < nz; i++)
+    {
+        RE(z[i]) *= w;
+        IM(z[i]) *= w;
+    }
+    for(i = 0; i < np; i++)
+    {
+        RE(p[i]) *= w;
+        IM(p[i]) *= w;
+    }
+    *k *= pow(w, np - nz);
+}
+
+
+
+/* r = (1 + r) / (1 - r) for the each of n roots */
+static void sos_bilinear(complex_t* r, int n)
+{
+    complex_t num, den;
+    int i;
+    for(i = 0; i < n; i++)
+    {
+        RE(num) = 1.0 + RE(r[i]);
+        IM(num) = IM(r[i]);
+        RE(den) = 1.0 - RE(r[i]);
+        IM(den) = -IM(r[i]);
+        RE(r[i]) = CMCONJRE(num, den) / ABSSQR(den);
+        IM(r[i]) = CMCONJIM(num, den) / ABSSQR(den);
+    }
+}
+
+
+
+/* Roots of the s^2 - q*s + w2 = 0 for the each of n values q[i] 
+   are written to r[2*i] and r[2*i+1] */
+static void sos_quad(complex_t* q, int n, double w2, complex_t* r)
+{
+    complex_t d;
+    int i;
+    for(i = n - 1; i >= 0; i--)
+    {
+        RE(d) = CMRE(q[i], q[i]) - 4.0 * w2;
+        IM(d) = CMIM(q[i], q[i]);
+        sqrt_cmplx(&d, 1, &d);
+        RE(r[2*i+1]) = 0.5 * (RE(q[i]) - RE(d));
+        IM(r[2*i+1]) = 0.5 * (IM(q[i]) - IM(d));
+        RE(r[2*i])   = 0.5 * (RE(q[i]) + RE(d));
+        IM(r[2*i])   = 0.5 * (IM(q[i]) + IM(d));
+    }
+}
+
+
+
+/* Analog normalized lowpass prototype zeros, poles and gain */
+static int sos_ap(double rp, double rs, int ord, int type, 
+                  complex_t* z, int* nz, complex_t* p, int* np, double* k)
+{
+    double h0 = 1.0, es, gp, alpha, wp;
+    int err, i;
+
+    switch(type & DSPL_FILTER_APPROX_MASK)
+    {
+        case DSPL_FILTER_BUTTER:
+            err = butter_ap_zp(ord, rp, z, nz, p, np);
+            break;
+        case DSPL_FILTER_CHEBY1:
+            err = cheby1_ap_zp(ord, rp, z, nz, p, np);
+            if(!(ord % 2))
+                h0 = pow(10.0, -rp*0.05);
+            break;
+        case DSPL_FILTER_CHEBY2:
+            if(rp <= 0.0)
+                return ERROR_FILTER_RP;
+            err = cheby2_ap_zp(ord, rs, z, nz, p, np);
+            if(err != RES_OK)
+                break;
+            /* passband edge frequency is moved to 1 rad/s 
+               as in the cheby2_ap_wp1 function */
+            es = sqrt(pow(10.0, rs*0.1) - 1.0);
+            gp = pow(10.0, -rp*0.05);
+            alpha = gp * es / sqrt(1.0 - gp*gp);
+            alpha = log(alpha + sqrt(alpha * alpha - 1.0)) / (double)ord;
+            wp = 2.0 / (exp(alpha) + exp(-alpha));
+            for(i = 0; i < *nz; i++)
+            {
+                RE(z[i]) /= wp;
+                IM(z[i]) /= wp;
+            }
+            for(i = 0; i < *np; i++)
+            {
+                RE(p[i]) /= wp;
+                IM(p[i]) /= wp;
+            }
+            break;
+        case DSPL_FILTER_ELLIP:
+            err = ellip_ap_zp(ord, rp, rs, z, nz, p, np);
+            if(!(ord % 2))
+                h0 = pow(10.0, -rp*0.05);
+            break;
+        default:
+            err = ERROR_FILTER_APPROX;
+    }
+    if(err == RES_OK)
+        *k = h0 / sos_gain(z, *nz, p, *np, 0.0);
+    return err;
+}
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\brief Digital IIR filter design as the second-order sections cascade.
+
+Function calculates the same digital IIR filter as the \ref iir function,
+but the filter is calculated as the cascade of `ns = (ord+1)/2` 
+second-order sections
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}}.
+\f]
+The analog prototype zeros and poles are calculated by the 
+\ref butter_ap_zp, \ref cheby1_ap_zp, \ref cheby2_ap_zp or \ref ellip_ap_zp
+function. Frequency transformation and bilinear transform are applied 
+to the zeros and poles, and the zeros and poles are grouped
+to the sections by the \ref filter_zp2sos function. \n
+The transfer function polynomials are not calculated, so the high order
+filters are calculated without the polynomial coefficients rounding 
+errors and the sections can be filtered by the \ref filter_sos function
+when the \ref iir function filter is unstable.
+
+\param [in] rp
+Magnitude ripple in passband (dB). \n \n
+
+\param [in] rs
+Suppression level in stopband (dB). \n \n
+
+\param [in] ord
+Filter order. \n
+For bandpass and bandstop filters `ord` must be even. \n \n
+
+\param [in] w0
+Normalized cutoff frequency (from 0 to 1) for lowpass or highpass filter. \n
+Or left normalized cutoff frequency (from 0 to 1) for 
+bandpass and bandstop filter. \n \n
+
+\param [in] w1
+Right normalized cutoff frequency (from 0 to 1) for 
+bandpass and bandstop filter. \n 
+This parameter is ingnored for lowpass and highpass filters. \n \n
+
+\param[in] type
+Filter type and approximation type flags 
+(see the \ref iir function). \n \n
+
+\param [out] b
+Pointer to the sections numerators. \n
+Vector size is `[3*ns x 1]`. \n
+Memory must be allocated. \n \n
+
+\param [out] a
+Pointer to the sections denominators. \n
+Vector size is `[3*ns x 1]`. \n
+Memory must be allocated. \n \n
+
+\return
+`RES_OK` if filter is calculated successfully. \n 
+Else \ref ERROR_CODE_GROUP "code error".
+
+\author Sergey Bakhurin www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\brief Расчет цифрового БИХ-фильтра в виде каскада звеньев второго порядка
+
+Функция рассчитывает тот же цифровой БИХ-фильтр, что и функция \ref iir,
+но фильтр рассчитывается в виде каскада из `ns = (ord+1)/2` 
+звеньев второго порядка
+\f[
+  H(z) = \prod_{s=0}^{ns-1} 
+  \frac{b_{3s} + b_{3s+1} z^{-1} + b_{3s+2} z^{-2}}
+       {a_{3s} + a_{3s+1} z^{-1} + a_{3s+2} z^{-2}}.
+\f]
+Нули и полюсы аналогового фильтра-прототипа рассчитываются функцией
+\ref butter_ap_zp, \ref cheby1_ap_zp, \ref cheby2_ap_zp или \ref ellip_ap_zp.
+Частотное преобразование и билинейное преобразование применяются 
+к нулям и полюсам, после чего нули и полюсы группируются в звенья
+функцией \ref filter_zp2sos. \n
+Полиномы передаточной функции не рассчитываются, поэтому фильтры
+высокого порядка рассчитываются без ошибок округления коэффициентов 
+полиномов, и звенья могут использоваться в функции \ref filter_sos
+в случае, когда фильтр, рассчитанный функцией \ref iir, неустойчив.
+
+\param [in] rp
+Неравномерность АЧХ в полосе пропускания (дБ). \n \n
+
+\param [in] rs
+Уровень подавления в полосе заграждения (дБ). \n \n
+
+\param [in] ord
+Порядок фильтра. \n
+Для полосовых и режекторных фильтров `ord` должен быть четным. \n \n
+
+\param [in] w0
+Нормированная частота среза (от 0 до 1) ФНЧ или ФВЧ. \n
+Или левая нормированная частота среза (от 0 до 1) полосового 
+или режекторного фильтра. \n \n
+
+\param [in] w1
+Правая нормированная частота среза (от 0 до 1) полосового 
+или режекторного фильтра. \n
+Параметр игнорируется для ФНЧ и ФВЧ. \n \n
+
+\param[in] type
+Флаги типа фильтра и типа аппроксимации
+(см. функцию \ref iir). \n \n
+
+\param [out] b
+Указатель на числители звеньев. \n
+Размер вектора `[3*ns x 1]`. \n
+Память должна быть выделена. \n \n
+
+\param [out] a
+Указатель на знаменатели звеньев. \n
+Размер вектора `[3*ns x 1]`. \n
+Память должна быть выделена. \n \n
+
+\return
+`RES_OK` если фильтр рассчитан успешно. \n
+В противном случае \ref ERROR_CODE_GROUP "код ошибки".
+
+\author Бахурин Сергей www.dsplib.org
+***************************************************************************** */
+#endif
+int DSPL_API iir_sos(double rp, double rs, int ord, double w0, double w1,
+                     int type, double* b, double* a)
+{
+    complex_t *z = NULL;
+    complex_t *p = NULL;
+    double wa0, wa1, ws, k;
+    int err, ord_ap = ord, nz, np, i;
+
+    if(!b || !a)
+        return ERROR_PTR;
+    if(ord < 1)
+        return ERROR_FILTER_ORD;
+
+    switch(type & DSPL_FILTER_TYPE_MASK)
+    {
+        case DSPL_FILTER_LPF:
+        case DSPL_FILTER_HPF:
+            if(w0 <= 0.0 || w0 >= 1.0)
+                return ERROR_FILTER_FT;
+            break;
+        case DSPL_FILTER_BPASS:
+        case DSPL_FILTER_BSTOP:
+            if(ord % 2)
+                return ERROR_FILTER_ORD_BP;
+            if(w0 <= 0.0 || w1 >= 1.0 || w1 <= w0)
+                return ERROR_FILTER_FT;
+            ord_ap = ord / 2;
+            break;
+        default:
+            return ERROR_FILTER_TYPE;
+    }
+
+    z = (complex_t*) malloc(ord * sizeof(complex_t));
+    p = (complex_t*) malloc(ord * sizeof(complex_t));
+    if(!z || !p)
+    {
+        err = ERROR_MALLOC;
+        goto error_proc;
+    }
+
+    err = sos_ap(rp, rs, ord_ap, type, z, &nz, p, &np, &k);
+    if(err != RES_OK)
+        goto error_proc;
+
+    /* frequency transformation of the zeros and poles */
+    wa0 = tan(w0 * M_PI * 0.5);
+    wa1 = tan(w1 * M_PI * 0.5);
+
+    switch(type & DSPL_FILTER_TYPE_MASK)
+    {
+        case DSPL_FILTER_LPF:
+            sos_scale(z, nz, p, np, wa0, &k);
+            break;
+
+        case DSPL_FILTER_HPF:
+            ws = filter_ws1(ord_ap, rp, rs, type);
+            sos_scale(z, nz, p, np, 1.0 / ws, &k);
+            /* s -> wa0 / s */
+            k *= sos_gain(z, nz, p, np, 0.0);
+            sos_inv(z, nz, wa0);
+            sos_inv(p, np, wa0);
+            for(i = nz; i < np; i++)
+                RE(z[i]) = IM(z[i]) = 0.0;
+            nz = np;
+            break;
+
+        case DSPL_FILTER_BPASS:
+            /* s -> (s^2 + wa0*wa1) / (s*(wa1-wa0)) */
+            sos_scale(z, nz, p, np, wa1 - wa0, &k);
+            sos_quad(z, nz, wa0 * wa1, z);
+            sos_quad(p, np, wa0 * wa1, p);
+            for(i = 2*nz; i < nz + np; i++)
+                RE(z[i]) = IM(z[i]) = 0.0;
+            nz += np;
+            np *= 2;
+            break;
+
+        case DSPL_FILTER_BSTOP:
+            /* need frequency transform ws ->    1    rad/s     */
+            ws = filter_ws1(ord_ap, rp, rs, type);
+            sos_scale(z, nz, p, np, 1.0 / ws, &k);
+            /* s -> s*(wa1-wa0) / (s^2 + wa0*wa1) */
+            k *= sos_gain(z, nz, p, np, 0.0);
+            sos_inv(z, nz, wa1 - wa0);
+            sos_inv(p, np, wa1 - wa0);
+            sos_quad(z, nz, wa0 * wa1, z);
+            sos_quad(p, np, wa0 * wa1, p);
+            for(i = nz; i < np; i++)
+            {
+                RE(z[2*i]) = RE(z[2*i+1]) = 0.0;
+                IM(z[2*i]) = sqrt(wa0 * wa1);
+                IM(z[2*i+1]) = -IM(z[2*i]);
+            }
+            np *= 2;
+            nz = np;
+            break;
+
+        default:
+            err = ERROR_FILTER_TYPE;
+            goto error_proc;
+    }
+
+    /* bilinear transform z = (1 + s) / (1 - s), 
+       the zeros at infinity are mapped to z = -1 */
+    k *= sos_gain(z, nz, p, np, 1.0);
+    sos_bilinear(z, nz);
+    sos_bilinear(p, np);
+    for(i = nz; i < np; i++)
+    {
+        RE(z[i]) = -1.0;
+        IM(z[i]) =  0.0;
+    }
+
+    err = filter_zp2sos(z, np, p, np, k, b, a);
+
+error_proc:
+    if(z)
+        free(z);
+    if(p)
+        free(p);
+    return err;
+}
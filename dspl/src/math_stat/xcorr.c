@@ -495,14 +495,12 @@ int xcorr_get_lag_cmplx(complex_t* x, int nd, int nr, complex_t* r, double* t)
 int xcorr_krn(complex_t* x, int nx, complex_t* y, int ny, fft_t* pfft,
               int flag, int nr, complex_t* r, double* t)
 {
-    complex_t *px = NULL;
-    complex_t *py = NULL;
     complex_t *pc = NULL;
     complex_t *pX = NULL;
     complex_t *pY = NULL;
     complex_t *pC = NULL;
 
-    int nfft, ndata;
+    int nfft, ndata, nw;
     int err, i;
     
     if(!x || !y || !r)
@@ -515,20 +513,6 @@ int xcorr_krn(complex_t* x, int nx, complex_t* y, int ny, fft_t* pfft,
         goto exit_label;
     
     /* memory allocation */
-    px = (complex_t*)malloc(nfft * sizeof(complex_t));
-    if(!px)
-    {
-        err = ERROR_MALLOC;
-        goto exit_label;
-    }
-    
-    py = (complex_t*)malloc(nfft * sizeof(complex_t));
-    if(!py)
-    {
-        err = ERROR_MALLOC;
-        goto exit_label;
-    }
-    
     pc = (complex_t*)malloc(nfft * sizeof(complex_t));
     if(!pc)
     {
@@ -557,17 +541,12 @@ int xcorr_krn(complex_t* x, int nx, complex_t* y, int ny, fft_t* pfft,
         goto exit_label;
     }
     
-    memset(px, 0, nfft * sizeof(complex_t));
-    memset(py, 0, nfft * sizeof(complex_t));
-    
-    memcpy(px + ndata - 1, x, nx * sizeof(complex_t));
-    memcpy(py, y, ny * sizeof(complex_t));
-    
-    err = fft_cmplx(px, nfft, pfft, pX);
+    /* spectrums of x and y zero-padded to nfft (input-pruned FFT) */
+    err = fft_cmplx_pruned(x, nx, nfft, 0, nfft, pfft, pX);
     if(err!= RES_OK)
         goto exit_label;
     
-    err = fft_cmplx(py, nfft, pfft, pY);
+    err = fft_cmplx_pruned(y, ny, nfft, 0, nfft, pfft, pY);
     if(err!= RES_OK)
         goto exit_label;
       
@@ -577,7 +556,13 @@ int xcorr_krn(complex_t* x, int nx, complex_t* y, int ny, fft_t* pfft,
         IM(pC[i]) = CMCONJIM(pX[i], pY[i]);
     }
     
-    err = ifft_cmplx(pC, nfft, pfft, pc);
+    /* x is not shifted, thus the lag k is the IFFT output k mod nfft. 
+       Only the required lags |k| <= nw are calculated (output-pruned IFFT) 
+       and stored to pc[ndata - 1 + k] */
+    nw = nr < ndata - 1 ? nr : ndata - 1;
+    memset(pc, 0, (2*ndata - 1) * sizeof(complex_t));
+    err = ifft_cmplx_pruned(pC, nfft, nfft, -nw, 2*nw + 1, pfft, 
+                            pc + ndata - 1 - nw);
     if(err!= RES_OK)
         goto exit_label;
       
@@ -588,10 +573,6 @@ int xcorr_krn(complex_t* x, int nx, complex_t* y, int ny, fft_t* pfft,
     err = xcorr_get_lag_cmplx(pc, ndata, nr, r, t);
     
 exit_label:
-    if(px)
-        free(px);
-    if(py)
-        free(py);
     if(pc)
         free(pc);
     if(pX)
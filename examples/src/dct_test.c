@@ -0,0 +1,35 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* DCT size */
+#define N 8
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    double x[N];            /* Input signal array       */
+    double y[N];            /* DCT-II result            */
+    double z[N];            /* DCT-III (inverse) result */
+    fft_t pfft = {0};       /* FFT object (fill zeros)  */
+    int k;
+
+    /* Fill input signal x[k] = k                        */
+    for(k = 0; k < N; k++)
+        x[k] = (double)k;
+
+    /* DCT-II and the inverse DCT-III                    */
+    dct2(x, N, &pfft, y);
+    dct3(y, N, &pfft, z);
+
+    /* print result                                     */
+    for(k = 0; k < N; k++)
+        printf("x[%d] = %6.3f    y[%d] = %8.3f    z[%d] = %6.3f\n", 
+               k, x[k], k, y[k], k, z[k]);
+
+    fft_free(&pfft);        /* Clear fft_t object       */
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Matrix size N x M */
+#define N 4
+#define M 6
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    complex_t x[N*M];       /* Input matrix             */
+    complex_t y[N*M];       /* 2D FFT result            */
+    complex_t z[N*M];       /* 2D IFFT result           */
+    fft_t pfft = {0};       /* FFT object (fill zeros)  */
+    int k;
+
+    /* Fill input matrix x(p,q) = p + j q (column-major) */
+    for(k = 0; k < N*M; k++)
+    {
+        RE(x[k]) = (double)(k % N);
+        IM(x[k]) = (double)(k / N);
+    }
+
+    /* 2D FFT and 2D IFFT                                */
+    fft2_cmplx(x, N, M, &pfft, y);
+    ifft2_cmplx(y, N, M, &pfft, z);
+
+    printf("2D FFT:\n");
+    matrix_print_cmplx(y, N, M, "Y", "%8.2f");
+    printf("2D IFFT:\n");
+    matrix_print_cmplx(z, N, M, "Z", "%8.2f");
+
+    fft_free(&pfft);        /* Clear fft_t object       */
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* FFT size */
+#define N 14
+
+int main()
+{
+    void* handle;           /* DSPL handle                          */
+    handle = dspl_load();   /* Load libdspl                         */
+    complex_t x[N];         /* Input signal array                   */
+    complex_t y0[N];        /* Output spectrum of the 1st object    */
+    complex_t y1[N];        /* Output spectrum of the 2nd object    */
+    fft_plan_t plan = {0};  /* Shared FFT plan (fill zeros)         */
+    fft_t pfft[2] = {{0}};  /* Two FFT objects (i.e. two threads)   */
+    int k;
+
+    /* Fill input signal x[k] = k + j*k/2                           */
+    for(k = 0; k < N; k++)
+    {
+        RE(x[k]) = (double)k;
+        IM(x[k]) = 0.5 * (double)k;
+    }
+
+    /* Create the shared plan once and bind both FFT objects        */
+    fft_plan_create(&plan, N);
+    fft_bind(pfft,   &plan);
+    fft_bind(pfft+1, &plan);
+
+    /* Each object uses own workspace and the shared twiddles       */
+    fft_cmplx(x, N, pfft,   y0);
+    fft_cmplx(x, N, pfft+1, y1);
+
+    /* print result                                                 */
+    for(k = 0; k < N; k++)
+        printf("y0[%2d] = %9.3f%9.3f    y1[%2d] = %9.3f%9.3f\n", 
+               k, RE(y0[k]), IM(y0[k]), k, RE(y1[k]), IM(y1[k]));
+
+    fft_free(pfft);         /* Clear fft_t objects                  */
+    fft_free(pfft+1);
+    fft_plan_free(&plan);   /* Clear shared plan after the objects  */
+    dspl_free(handle);      /* Clear DSPL handle                    */
+    return 0;
+}
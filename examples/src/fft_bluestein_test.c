@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Large prime FFT size (the DFT is checked at the NBIN bins only) */
+#define NP      131071
+/* Number of the checked bins of the NP-points FFT */
+#define NBIN    16
+
+
+/*
+function fills the random input, calculates the n-points FFT
+and the DFT (or the nb bins of the DFT by the direct sum if nb > 0)
+and prints the maximum difference relative to the maximum DFT sample
+and the maximum error of the IFFT of the FFT.
+ */
+int bluestein_err(int n, int nb)
+{
+    complex_t *x = NULL, *y = NULL, *z = NULL, *w = NULL;
+    fft_t pfft = {0};
+    double err, d, ymax, ierr;
+    long long i;
+    int k, m, b, res;
+
+    x = (complex_t*) malloc(n * sizeof(complex_t));
+    y = (complex_t*) malloc(n * sizeof(complex_t));
+    z = (complex_t*) malloc(n * sizeof(complex_t));
+    w = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y || !z || !w)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    res = fft_cmplx(x, n, &pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+
+    if(nb > 0)
+    {
+        /* z[k] = sum x[m] w[(k*m) % n], w[i] = exp(-j 2 pi i / n) */
+        for(k = 0; k < n; k++)
+        {
+            RE(w[k]) =  cos(M_2PI * (double)k / (double)n);
+            IM(w[k]) = -sin(M_2PI * (double)k / (double)n);
+        }
+        memset(z, 0, n * sizeof(complex_t));
+        for(b = 0; b < nb; b++)
+        {
+            k = (int)((long long)b * (n - 1) / (nb - 1));
+            for(m = 0; m < n; m++)
+            {
+                i = ((long long)k * m) % n;
+                RE(z[k]) += CMRE(x[m], w[i]);
+                IM(z[k]) += CMIM(x[m], w[i]);
+            }
+        }
+    }
+    else
+    {
+        res = dft_cmplx(x, n, z);
+        if(res != RES_OK)
+            goto exit_label;
+    }
+
+    err = ymax = 0.0;
+    for(b = 0; b < (nb > 0 ? nb : n); b++)
+    {
+        k = nb > 0 ? (int)((long long)b * (n - 1) / (nb - 1)) : b;
+        if(ABS(z[k]) > ymax)
+            ymax = ABS(z[k]);
+        d = fabs(RE(y[k]) - RE(z[k])) + fabs(IM(y[k]) - IM(z[k]));
+        if(d > err)
+            err = d;
+    }
+
+    /* IFFT of the FFT returns the input */
+    res = ifft_cmplx(y, n, &pfft, z);
+    if(res != RES_OK)
+        goto exit_label;
+    ierr = 0.0;
+    for(k = 0; k < n; k++)
+    {
+        d = fabs(RE(z[k]) - RE(x[k])) + fabs(IM(z[k]) - IM(x[k]));
+        if(d > ierr)
+            ierr = d;
+    }
+
+    printf("n = %7d   %s   err = %.3e   ifft(fft(x)) err = %.3e\n",
+           n, nb > 0 ? "bins" : "dft ", err / ymax, ierr);
+
+exit_label:
+    fft_free(&pfft);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    if(z)
+        free(z);
+    if(w)
+        free(w);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+
+    /* 4097 = 17 * 241, 8191, 46349 and NP are primes,
+       46349 and NP were above the former FFT_COMPOSITE_MAX */
+    bluestein_err(4097,     0);
+    bluestein_err(8191,     0);
+    bluestein_err(6 * 8191, NBIN);
+    bluestein_err(46349,    NBIN);
+    bluestein_err(NP,       NBIN);
+
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
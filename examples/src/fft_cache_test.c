@@ -0,0 +1,75 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* FFT size                         */
+#define N   1000
+
+
+/* print the plan cache counters */
+void cache_print(char* msg)
+{
+    long long hits, misses;
+    int nplans;
+
+    fft_cache_stat(&hits, &misses, &nplans);
+    printf("%-34s hits = %lld   misses = %lld   plans = %d\n", 
+           msg, hits, misses, nplans);
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    complex_t x[N];         /* Input signal             */
+    complex_t y0[N];        /* FFT of the first object  */
+    complex_t y1[N];        /* FFT of the other objects */
+    fft_t f0 = {0};         /* FFT objects (fill zeros) */
+    fft_t f1 = {0};
+    fft_t f2 = {0};
+    double err;
+    int k;
+
+    for(k = 0; k < N; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+    cache_print("start:");
+
+    /* the first object calculates the plan (cache miss)  */
+    fft_cmplx(x, N, &f0, y0);
+    cache_print("first object, N = 1000:");
+
+    /* the second object of the same size shares the plan */
+    fft_cmplx(x, N, &f1, y1);
+    cache_print("second object, N = 1000:");
+    err = 0.0;
+    for(k = 0; k < N; k++)
+        if(fabs(RE(y1[k]) - RE(y0[k])) + fabs(IM(y1[k]) - IM(y0[k])) > err)
+            err = fabs(RE(y1[k]) - RE(y0[k])) + fabs(IM(y1[k]) - IM(y0[k]));
+    printf("shared plan FFT difference:        %.3e\n", err);
+
+    /* the cache is disabled: the cached plans are cleared 
+       when they are not used by any object                */
+    fft_free(&f0);
+    fft_free(&f1);
+    fft_cache_set_size(0);
+    cache_print("fft_cache_set_size(0):");
+
+    /* the object creates own plan                        */
+    fft_cmplx(x, N, &f2, y1);
+    cache_print("cache disabled, N = 1000:");
+    err = 0.0;
+    for(k = 0; k < N; k++)
+        if(fabs(RE(y1[k]) - RE(y0[k])) + fabs(IM(y1[k]) - IM(y0[k])) > err)
+            err = fabs(RE(y1[k]) - RE(y0[k])) + fabs(IM(y1[k]) - IM(y0[k]));
+    printf("own plan FFT difference:           %.3e\n", err);
+
+    fft_free(&f2);
+    fft_cache_set_size(32);   /* default cache size   */
+    dspl_free(handle);        /* Clear DSPL handle    */
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* FFT size */
+#define N 8
+
+/* Number of channels */
+#define CH 3
+
+/* Antenna array FFT size and number of channels */
+#define NA  1024
+#define CHA 256
+/* Number of the FFT threads */
+#define NTHREADS 4
+
+
+/*
+function calculates CHA interleaved channels NA-points FFTs by 
+fft_cmplx_batch and fft_batch (real parts of the channels) with nth threads
+and prints the maximum difference from the channel by channel 
+fft_cmplx and fft results.
+ */
+int batch_err(int nth)
+{
+    complex_t *x = NULL, *y = NULL, *z = NULL, *t = NULL;
+    double *xr = NULL, *tr = NULL;
+    fft_t pfft = {0};       /* batch FFT object         */
+    fft_t pref = {0};       /* reference FFT object     */
+    double err, rerr, d;
+    int k, c, res;
+
+    x  = (complex_t*) malloc(NA * CHA * sizeof(complex_t));
+    y  = (complex_t*) malloc(NA * CHA * sizeof(complex_t));
+    z  = (complex_t*) malloc(NA * sizeof(complex_t));
+    t  = (complex_t*) malloc(NA * sizeof(complex_t));
+    xr = (double*)    malloc(NA * CHA * sizeof(double));
+    tr = (double*)    malloc(NA * sizeof(double));
+    if(!x || !y || !z || !t || !xr || !tr)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < NA * CHA; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        xr[k] = RE(x[k]);
+    }
+
+    res = fft_set_threads(&pfft, nth);
+    if(res != RES_OK)
+        goto exit_label;
+
+    /* complex channels: stride = CHA, dist = 1 */
+    res = fft_cmplx_batch(x, NA, CHA, CHA, 1, &pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+    err = 0.0;
+    for(c = 0; c < CHA; c++)
+    {
+        for(k = 0; k < NA; k++)
+        {
+            RE(t[k]) = RE(x[k*CHA + c]);
+            IM(t[k]) = IM(x[k*CHA + c]);
+        }
+        res = fft_cmplx(t, NA, &pref, z);
+        if(res != RES_OK)
+            goto exit_label;
+        for(k = 0; k < NA; k++)
+        {
+            d = fabs(RE(y[c*NA+k]) - RE(z[k])) + fabs(IM(y[c*NA+k]) - IM(z[k]));
+            if(d > err)
+                err = d;
+        }
+    }
+
+    /* real channels */
+    res = fft_batch(xr, NA, CHA, CHA, 1, &pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+    rerr = 0.0;
+    for(c = 0; c < CHA; c++)
+    {
+        for(k = 0; k < NA; k++)
+            tr[k] = xr[k*CHA + c];
+        res = fft(tr, NA, &pref, z);
+        if(res != RES_OK)
+            goto exit_label;
+        for(k = 0; k < NA; k++)
+        {
+            d = fabs(RE(y[c*NA+k]) - RE(z[k])) + fabs(IM(y[c*NA+k]) - IM(z[k]));
+            if(d > rerr)
+                rerr = d;
+        }
+    }
+    printf("%d channels  n = %d  threads = %d   "
+           "fft_cmplx_batch err = %.3e   fft_batch err = %.3e\n", 
+           CHA, NA, nth, err, rerr);
+
+exit_label:
+    fft_free(&pfft);
+    fft_free(&pref);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    if(z)
+        free(z);
+    if(t)
+        free(t);
+    if(xr)
+        free(xr);
+    if(tr)
+        free(tr);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle                          */
+    handle = dspl_load();   /* Load libdspl                         */
+    complex_t x[N*CH];      /* Interleaved channels input array     */
+    complex_t y[N*CH];      /* Output spectrum (channel by channel) */
+    fft_t pfft = {0};       /* FFT object (fill zeros)              */
+    int k, c;
+
+    /* Fill interleaved input: channel c sample k is x[k*CH + c],   */
+    /* channel c signal is exp(j*(c+1)*k)                           */
+    for(k = 0; k < N; k++)
+    {
+        for(c = 0; c < CH; c++)
+        {
+            RE(x[k*CH + c]) = cos((double)((c+1)*k));
+            IM(x[k*CH + c]) = sin((double)((c+1)*k));
+        }
+    }
+
+    /* CH FFTs by one call: stride = CH, dist = 1                   */
+    fft_cmplx_batch(x, N, CH, CH, 1, &pfft, y);
+
+    /* print result                                                 */
+    for(k = 0; k < N; k++)
+    {
+        printf("y[%d]", k);
+        for(c = 0; c < CH; c++)
+            printf("%9.3f%9.3f  ", RE(y[c*N + k]), IM(y[c*N + k]));
+        printf("\n");
+    }
+
+    /* antenna array channels by one and by NTHREADS threads        */
+    batch_err(1);
+    batch_err(NTHREADS);
+
+    fft_free(&pfft);        /* Clear fft_t object                   */
+    dspl_free(handle);      /* Clear DSPL handle                    */
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Number of the FFT sizes of the planner */
+#define NSIZE   6
+
+/* FFT size of the radix-256 wisdom plan */
+#define N256    4096
+
+
+/*
+function calculates the n-points FFT and the DFT of the random input
+and returns the maximum difference relative to the maximum DFT sample
+(or -1.0 if the FFT is failed).
+ */
+double codelet_err(int n)
+{
+    complex_t *x = NULL, *y = NULL, *z = NULL;
+    fft_t pfft = {0};
+    double err, d, ymax;
+    int k;
+
+    err = -1.0;
+    x = (complex_t*) malloc(n * sizeof(complex_t));
+    y = (complex_t*) malloc(n * sizeof(complex_t));
+    z = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y || !z)
+        goto exit_label;
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    if(fft_cmplx(x, n, &pfft, y) != RES_OK)
+        goto exit_label;
+    if(dft_cmplx(x, n, z) != RES_OK)
+        goto exit_label;
+
+    err = ymax = 0.0;
+    for(k = 0; k < n; k++)
+    {
+        if(ABS(z[k]) > ymax)
+            ymax = ABS(z[k]);
+        d = fabs(RE(y[k]) - RE(z[k])) + fabs(IM(y[k]) - IM(z[k]));
+        if(d > err)
+            err = d;
+    }
+    err /= ymax;
+
+exit_label:
+    fft_free(&pfft);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    if(z)
+        free(z);
+    return err;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+
+    /* sizes of the generated radix 11, 13, 25, 49 stages */
+    int n[NSIZE] = {121, 169, 625, 2401, 3575, 637};
+    char* name[4] = {"SCALAR", "SSE2", "AVX2", "AVX512"};
+    FILE* f;
+    int isa, k, res;
+
+    for(isa = FFT_ISA_SCALAR; isa <= FFT_ISA_AVX512; isa++)
+    {
+        if(fft_set_isa(isa) != RES_OK)
+        {
+            printf("%-7s is not supported\n", name[isa - FFT_ISA_SCALAR]);
+            continue;
+        }
+        for(k = 0; k < NSIZE; k++)
+            printf("%-7s n = %5d   err = %.3e\n", name[isa - FFT_ISA_SCALAR],
+                   n[k], codelet_err(n[k]));
+
+        /* radix 256 is used by the FFT wisdom only */
+        f = fopen("dat/fft_codelet.wisdom", "w");
+        if(!f)
+            continue;
+        fprintf(f, "%d %d %s\n", N256, isa,
+                isa == FFT_ISA_SCALAR ? "256 16" : "256v 16v");
+        fclose(f);
+        fft_wisdom_clear();
+        res = fft_wisdom_load("dat/fft_codelet.wisdom");
+        if(res != RES_OK)
+            printf("%-7s fft_wisdom_load: res = 0x%.8x\n",
+                   name[isa - FFT_ISA_SCALAR], res);
+        else
+            printf("%-7s n = %5d   err = %.3e   (radix 256 wisdom)\n",
+                   name[isa - FFT_ISA_SCALAR], N256, codelet_err(N256));
+        fft_wisdom_clear();
+    }
+    fft_set_isa(FFT_ISA_AUTO);
+
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Number of the FFT sizes */
+#define NSIZE   8
+/* Number of the FFT threads of the threaded plans */
+#define NTHREADS 4
+
+
+/*
+function calculates the n-points FFT of the random input out-of-place
+fft_cmplx(x, n, p, y) and in-place fft_cmplx(x, n, p, x)
+by the nth threads plan and prints the maximum difference.
+ */
+int inplace_err(int n, int nth)
+{
+    complex_t *x = NULL, *y = NULL, *t = NULL;
+    fft_t pfft = {0};
+    double err, d;
+    int k, res;
+
+    x = (complex_t*) malloc(n * sizeof(complex_t));
+    y = (complex_t*) malloc(n * sizeof(complex_t));
+    t = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y || !t)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    res = fft_set_threads(&pfft, nth);
+    if(res != RES_OK)
+        goto exit_label;
+
+    /* out-of-place FFT */
+    res = fft_cmplx(x, n, &pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+
+    /* in-place FFT of the input copy */
+    memcpy(t, x, n * sizeof(complex_t));
+    res = fft_cmplx(t, n, &pfft, t);
+    if(res != RES_OK)
+        goto exit_label;
+
+    err = 0.0;
+    for(k = 0; k < n; k++)
+    {
+        d = fabs(RE(y[k]) - RE(t[k])) + fabs(IM(y[k]) - IM(t[k]));
+        if(d > err)
+            err = d;
+    }
+    printf("n = %8d   threads = %d   in-place vs out-of-place = %.3e\n",
+           n, nth, err);
+
+exit_label:
+    fft_free(&pfft);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    if(t)
+        free(t);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+
+    /* single stage, mixed radix, Bluestein and the threaded sizes */
+    int n[NSIZE] = {16, 1000, 4096, 4097, 65536, 262144, 786432, 1048576};
+    int k;
+
+    for(k = 0; k < NSIZE; k++)
+        inplace_err(n[k], 1);
+    for(k = 0; k < NSIZE; k++)
+        inplace_err(n[k], NTHREADS);
+
+    /* scalar plans stage the input in the workspace */
+    fft_set_isa(FFT_ISA_SCALAR);
+    printf("FFT_ISA_SCALAR plans:\n");
+    for(k = 0; k < 5; k++)
+        inplace_err(n[k], 1);
+    fft_set_isa(FFT_ISA_AUTO);
+
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
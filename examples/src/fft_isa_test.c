@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Number of the FFT sizes */
+#define NSIZE   8
+
+
+/*
+function calculates the n-points FFT of the random input by the scalar
+codelets and by the codelets of the isa instruction set and prints
+the maximum difference relative to the maximum scalar FFT sample.
+ */
+int isa_err(int n, int isa, char* name)
+{
+    complex_t *x = NULL, *y = NULL, *z = NULL;
+    fft_t fs = {0};         /* scalar FFT object        */
+    fft_t fv = {0};         /* vector FFT object        */
+    double err, d, ymax;
+    int k, res;
+
+    x = (complex_t*) malloc(n * sizeof(complex_t));
+    y = (complex_t*) malloc(n * sizeof(complex_t));
+    z = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y || !z)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    /* the plan instruction set is selected at the plan creation */
+    res = fft_set_isa(FFT_ISA_SCALAR);
+    if(res != RES_OK)
+        goto exit_label;
+    res = fft_cmplx(x, n, &fs, y);
+    if(res != RES_OK)
+        goto exit_label;
+
+    res = fft_set_isa(isa);
+    if(res != RES_OK)
+    {
+        printf("%-7s is not supported\n", name);
+        goto exit_label;
+    }
+    res = fft_cmplx(x, n, &fv, z);
+    if(res != RES_OK)
+        goto exit_label;
+
+    err = ymax = 0.0;
+    for(k = 0; k < n; k++)
+    {
+        if(ABS(y[k]) > ymax)
+            ymax = ABS(y[k]);
+        d = fabs(RE(y[k]) - RE(z[k])) + fabs(IM(y[k]) - IM(z[k]));
+        if(d > err)
+            err = d;
+    }
+    printf("%-7s n = %6d   vs SCALAR err = %.3e\n", name, n, err / ymax);
+
+exit_label:
+    fft_set_isa(FFT_ISA_AUTO);
+    fft_free(&fs);
+    fft_free(&fv);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    if(z)
+        free(z);
+    return res;
+}
+
+
+/*
+function calculates the n-points FFT by one fft_t object before and after
+the fft_set_isa(FFT_ISA_SCALAR) call and prints the plan instruction set
+of the object (the own plan if the plan cache is disabled by ncache = 0).
+ */
+int isa_replan(int n, int ncache)
+{
+    complex_t *x = NULL, *y = NULL;
+    fft_t pfft = {0};
+    int k, res, isa0, isa1;
+
+    x = (complex_t*) malloc(n * sizeof(complex_t));
+    y = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    fft_cache_set_size(ncache);
+    res = fft_cmplx(x, n, &pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+    isa0 = pfft.plan->isa;
+
+    /* the plan of the object is rebuilt by the next FFT call */
+    fft_set_isa(FFT_ISA_SCALAR);
+    res = fft_cmplx(x, n, &pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+    isa1 = pfft.plan->isa;
+
+    printf("cache size = %2d   plan isa %d -> fft_set_isa(FFT_ISA_SCALAR) "
+           "-> plan isa %d (FFT_ISA_SCALAR = %d)\n", 
+           ncache, isa0, isa1, FFT_ISA_SCALAR);
+
+exit_label:
+    fft_set_isa(FFT_ISA_AUTO);
+    fft_cache_set_size(32);   /* default cache size   */
+    fft_free(&pfft);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+
+    /* radix 2, 3, 4, 5, 7, 8, 16 stages and the prime factor stages */
+    int n[NSIZE] = {16, 64, 1024, 4096, 65536, 2520, 1000, 7 * 37};
+    int isa[3] = {FFT_ISA_SSE2, FFT_ISA_AVX2, FFT_ISA_AVX512};
+    char* name[3] = {"SSE2", "AVX2", "AVX512"};
+    int i, k;
+
+    for(i = 0; i < 3; i++)
+        for(k = 0; k < NSIZE; k++)
+            if(isa_err(n[k], isa[i], name[i]) == ERROR_FFT_ISA)
+                break;
+
+    /* own and cached plans follow the instruction set */
+    isa_replan(4096, 0);
+    isa_replan(4096, 32);
+
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
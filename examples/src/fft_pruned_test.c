@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Number of the test cases         */
+#define NCASE   6
+
+
+/*
+function calculates ny samples from k0 of the n-points FFT (or IFFT)
+of the nx samples zero-padded to n by the pruned FFT and by the full FFT
+and prints the maximum difference relative to the maximum output sample.
+ */
+int pruned_err(int nx, int n, int k0, int ny, int inv)
+{
+    complex_t *x = NULL, *t = NULL, *s = NULL, *y = NULL;
+    fft_t fp = {0};         /* pruned FFT object        */
+    fft_t ff = {0};         /* full FFT object          */
+    double err, d, smax;
+    int k, m, res;
+
+    x = (complex_t*) malloc(nx * sizeof(complex_t));
+    t = (complex_t*) malloc(n  * sizeof(complex_t));
+    s = (complex_t*) malloc(n  * sizeof(complex_t));
+    y = (complex_t*) malloc(ny * sizeof(complex_t));
+    if(!x || !t || !s || !y)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < nx; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    /* pruned transform */
+    res = inv ? ifft_cmplx_pruned(x, nx, n, k0, ny, &fp, y) :
+                 fft_cmplx_pruned(x, nx, n, k0, ny, &fp, y);
+    if(res != RES_OK)
+        goto exit_label;
+
+    /* full transform of the zero-padded input */
+    memset(t, 0, n * sizeof(complex_t));
+    memcpy(t, x, nx * sizeof(complex_t));
+    res = inv ? ifft_cmplx(t, n, &ff, s) : fft_cmplx(t, n, &ff, s);
+    if(res != RES_OK)
+        goto exit_label;
+
+    smax = err = 0.0;
+    for(k = 0; k < n; k++)
+        if(ABS(s[k]) > smax)
+            smax = ABS(s[k]);
+    for(k = 0; k < ny; k++)
+    {
+        m = ((k0 + k) % n + n) % n;
+        d = fabs(RE(y[k]) - RE(s[m])) + fabs(IM(y[k]) - IM(s[m]));
+        if(d > err)
+            err = d;
+    }
+    printf("%-5s nx = %6d   n = %6d   k0 = %6d   ny = %6d   err = %.3e\n",
+           inv ? "ifft" : "fft", nx, n, k0, ny, err / smax);
+
+exit_label:
+    if(res != RES_OK)
+        printf("error 0x%.8x\n", res);
+    fft_free(&fp);
+    fft_free(&ff);
+    if(x)
+        free(x);
+    if(t)
+        free(t);
+    if(s)
+        free(s);
+    if(y)
+        free(y);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+
+    /* nx, n, k0, ny of the test cases: input pruning, output pruning
+       with the negative frequencies and the window wrapped modulo n,
+       both and the full transform                                  */
+    int c[NCASE][4] = {{  4096,  65536,      0, 65536},
+                       {  8192, 131072,   1000,   129},
+                       {   100,   1000,    -50,   101},
+                       {   500,   1024,    700,   600},
+                       { 65536,  65536,   -200,   400},
+                       {   720,    720,      0,   720}};
+    int i;
+
+    for(i = 0; i < NCASE; i++)
+    {
+        pruned_err(c[i][0], c[i][1], c[i][2], c[i][3], 0);
+        pruned_err(c[i][0], c[i][1], c[i][2], c[i][3], 1);
+    }
+
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
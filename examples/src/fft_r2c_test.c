@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* FFT size */
+#define N 14
+/* FFT size of the real and complex FFT calls by one object */
+#define NA 4096
+
+
+/*
+function calculates the NA-points real FFT, IFFT and complex FFT
+of the same input by one fft_t object with the plan cache disabled,
+checks that the NA-points plan of the object is not re-planned by 
+the real FFT calls and prints the maximum difference of the spectra
+and the maximum error of the IFFT of the FFT.
+ */
+int alternate_err(void)
+{
+    double *x = NULL, *r = NULL;
+    complex_t *xc = NULL, *y = NULL, *z = NULL;
+    fft_t pfft = {0};
+    fft_plan_t *plan, *half;
+    double err, ierr, d;
+    int k, i, res, keep;
+
+    x  = (double*)    malloc(NA * sizeof(double));
+    r  = (double*)    malloc(NA * sizeof(double));
+    xc = (complex_t*) malloc(NA * sizeof(complex_t));
+    y  = (complex_t*) malloc(NA * sizeof(complex_t));
+    z  = (complex_t*) malloc(NA * sizeof(complex_t));
+    if(!x || !r || !xc || !y || !z)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < NA; k++)
+    {
+        x[k] = (double)rand() / RAND_MAX - 0.5;
+        RE(xc[k]) = x[k];
+        IM(xc[k]) = 0.0;
+    }
+
+    /* own plans of the object */
+    fft_cache_set_size(0);
+
+    res = fft_cmplx(xc, NA, &pfft, z);
+    if(res != RES_OK)
+        goto exit_label;
+    res = fft(x, NA, &pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+    plan = pfft.plan;
+    half = pfft.half;
+
+    err = ierr = 0.0;
+    keep = 1;
+    for(i = 0; i < 4; i++)
+    {
+        res = fft_cmplx(xc, NA, &pfft, z);
+        if(res != RES_OK)
+            goto exit_label;
+        res = fft(x, NA, &pfft, y);
+        if(res != RES_OK)
+            goto exit_label;
+        res = ifft(y, NA, &pfft, r);
+        if(res != RES_OK)
+            goto exit_label;
+        keep = keep && pfft.plan == plan && pfft.half == half;
+
+        for(k = 0; k < NA; k++)
+        {
+            d = fabs(RE(y[k]) - RE(z[k])) + fabs(IM(y[k]) - IM(z[k]));
+            if(d > err)
+                err = d;
+            d = fabs(r[k] - x[k]);
+            if(d > ierr)
+                ierr = d;
+        }
+    }
+    printf("\nn = %d  fft / fft_cmplx / ifft by one object:\n", NA);
+    printf("plans kept = %d   fft err = %.3e   ifft(fft(x)) err = %.3e\n",
+           keep, err, ierr);
+
+exit_label:
+    fft_cache_set_size(32);   /* default cache size   */
+    fft_free(&pfft);
+    if(x)
+        free(x);
+    if(r)
+        free(r);
+    if(xc)
+        free(xc);
+    if(y)
+        free(y);
+    if(z)
+        free(z);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    double    x[N];         /* Input signal array       */
+    complex_t y[N/2+1];     /* Output spectrum half     */
+    fft_t pfft = {0};       /* FFT object (fill zeros)  */
+    int k;
+
+    /* Fill input signal x[k] = k                        */
+    for(k = 0; k < N; k++)
+        x[k] = (double)k;
+
+    /* Real FFT (N/2+1 non-redundant spectrum samples)   */
+    fft_r2c(x, N, &pfft, y);
+
+    /* print result                                     */
+    for(k = 0; k < N/2+1; k++)
+        printf("y[%2d] = %9.3f%9.3f\n", k, RE(y[k]), IM(y[k]));
+
+    /* real and complex FFT of the same size by one object */
+    alternate_err();
+
+    fft_free(&pfft);        /* Clear fft_t object       */
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
+
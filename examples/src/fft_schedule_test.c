@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Number of the FFT sizes */
+#define NSIZE   14
+
+
+/*
+function calculates the n-points FFT by the pfft object schedule
+and the DFT of the random input and prints the maximum difference
+relative to the maximum DFT sample.
+ */
+int schedule_err(int n, fft_t* pfft)
+{
+    complex_t *x = NULL, *y = NULL, *z = NULL;
+    double err, d, ymax;
+    int k, res;
+
+    x = (complex_t*) malloc(n * sizeof(complex_t));
+    y = (complex_t*) malloc(n * sizeof(complex_t));
+    z = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y || !z)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    res = fft_cmplx(x, n, pfft, y);
+    if(res != RES_OK)
+        goto exit_label;
+    res = dft_cmplx(x, n, z);
+    if(res != RES_OK)
+        goto exit_label;
+
+    err = ymax = 0.0;
+    for(k = 0; k < n; k++)
+    {
+        if(ABS(z[k]) > ymax)
+            ymax = ABS(z[k]);
+        d = fabs(RE(y[k]) - RE(z[k])) + fabs(IM(y[k]) - IM(z[k]));
+        if(d > err)
+            err = d;
+    }
+    printf("n = %5d   err = %.3e\n", n, err / ymax);
+
+exit_label:
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    if(z)
+        free(z);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    fft_t pfft = {0};       /* FFT object (fill zeros)  */
+
+    /* powers of two, mixed radix and prime factor sizes */
+    int n[NSIZE] = {2, 64, 128, 256, 512, 1024, 96, 360, 720,
+                    1000, 1001, 2520, 148, 4096};
+    int k;
+
+    /* the same object is recreated for each size */
+    for(k = 0; k < NSIZE; k++)
+        schedule_err(n[k], &pfft);
+
+    fft_free(&pfft);        /* Clear fft_t object       */
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
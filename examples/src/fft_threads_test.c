@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Number of the FFT threads        */
+#define NTHREADS   4
+
+
+/*
+function calculates the n-points FFT by one thread and by NTHREADS threads
+and prints the maximum difference of the results
+ */
+int fft_threads_err(int n)
+{
+    complex_t *x = NULL, *y1 = NULL, *yt = NULL;
+    fft_t f1 = {0};         /* single-thread FFT object */
+    fft_t ft = {0};         /* multithreaded FFT object */
+    double err, d;
+    int k, res;
+
+    x  = (complex_t*) malloc(n * sizeof(complex_t));
+    y1 = (complex_t*) malloc(n * sizeof(complex_t));
+    yt = (complex_t*) malloc(n * sizeof(complex_t));
+    if(!x || !y1 || !yt)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+    for(k = 0; k < n; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    res = fft_set_threads(&ft, NTHREADS);
+    if(res != RES_OK)
+        goto exit_label;
+
+    res = fft_cmplx(x, n, &f1, y1);
+    if(res != RES_OK)
+        goto exit_label;
+    res = fft_cmplx(x, n, &ft, yt);
+    if(res != RES_OK)
+        goto exit_label;
+
+    err = 0.0;
+    for(k = 0; k < n; k++)
+    {
+        d = fabs(RE(yt[k]) - RE(y1[k])) + fabs(IM(yt[k]) - IM(y1[k]));
+        if(d > err)
+            err = d;
+    }
+    printf("n = %8d   %d threads vs 1 thread FFT difference = %.3e\n", 
+           n, NTHREADS, err);
+
+exit_label:
+    fft_free(&f1);
+    fft_free(&ft);
+    if(x)
+        free(x);
+    if(y1)
+        free(y1);
+    if(yt)
+        free(yt);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+
+    /* FFT sizes not less than 262144 are multithreaded */
+    fft_threads_err(1048576);
+    fft_threads_err(786432);
+    fft_threads_err(1000000);
+
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* FFT size                         */
+#define N   2520
+
+
+/* print the plan cache counters */
+void cache_print(char* msg)
+{
+    long long hits, misses;
+    int nplans;
+
+    fft_cache_stat(&hits, &misses, &nplans);
+    printf("%-30s hits = %lld   misses = %lld   plans = %d\n",
+           msg, hits, misses, nplans);
+}
+
+
+/* print the text file */
+void file_print(char* fn)
+{
+    char str[256];
+    FILE* f = fopen(fn, "r");
+    if(!f)
+        return;
+    while(fgets(str, 256, f))
+        printf("    %s", str);
+    fclose(f);
+}
+
+
+/* compare the text files, returns 1 if the files are equal */
+int file_cmp(char* fn0, char* fn1)
+{
+    FILE *f0 = fopen(fn0, "rb"), *f1 = fopen(fn1, "rb");
+    int c0, c1, eq = f0 && f1;
+
+    while(eq)
+    {
+        c0 = fgetc(f0);
+        c1 = fgetc(f1);
+        eq = (c0 == c1);
+        if(c0 == EOF)
+            break;
+    }
+    if(f0)
+        fclose(f0);
+    if(f1)
+        fclose(f1);
+    return eq;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    complex_t x[N];         /* Input signal             */
+    complex_t y0[N];        /* FFT by the measured plan */
+    complex_t y1[N];        /* FFT by the loaded plan   */
+    fft_t pfft = {0};       /* FFT object (fill zeros)  */
+    FILE* f;
+    double err, d;
+    int k, res;
+
+    for(k = 0; k < N; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    /* measure the plan of the N-points FFT and save the wisdom */
+    fft_wisdom_clear();
+    res = fft_wisdom_measure(N);
+    printf("fft_wisdom_measure(%d):       res = 0x%.8x\n", N, res);
+    fft_cmplx(x, N, &pfft, y0);
+    fft_free(&pfft);
+    res = fft_wisdom_save("dat/fft.wisdom");
+    printf("fft_wisdom_save:              res = 0x%.8x\n", res);
+    file_print("dat/fft.wisdom");
+
+    /* new process startup: the wisdom is loaded without the measurement.
+       The load flushes the plan cache, so the next FFT plan is
+       calculated by the loaded wisdom (cache miss)                  */
+    fft_wisdom_clear();
+    fft_cmplx(x, N, &pfft, y1);
+    fft_free(&pfft);
+    cache_print("heuristic plan cached:");
+    res = fft_wisdom_load("dat/fft.wisdom");
+    printf("fft_wisdom_load:              res = 0x%.8x\n", res);
+    cache_print("after fft_wisdom_load:");
+    fft_cmplx(x, N, &pfft, y1);
+    fft_free(&pfft);
+    cache_print("loaded plan FFT:");
+
+    err = 0.0;
+    for(k = 0; k < N; k++)
+    {
+        d = fabs(RE(y1[k]) - RE(y0[k])) + fabs(IM(y1[k]) - IM(y0[k]));
+        if(d > err)
+            err = d;
+    }
+    printf("measured vs loaded plan FFT difference: %.3e\n", err);
+
+    /* malformed files are rejected, the wisdom is not changed */
+    f = fopen("dat/bad1.wisdom", "w");
+    fprintf(f, "# radixes product is not equal to the FFT size\n");
+    fprintf(f, "2520 1 8 9 5\n");
+    fclose(f);
+    res = fft_wisdom_load("dat/bad1.wisdom");
+    printf("bad radixes product:          res = 0x%.8x (%s)\n", res,
+           res == ERROR_FFT_WISDOM ? "ERROR_FFT_WISDOM" : "unexpected");
+
+    f = fopen("dat/bad2.wisdom", "w");
+    fprintf(f, "2520 1 8 9 5 7\n");
+    fprintf(f, "2520 1 8 9x 5 7\n");
+    fclose(f);
+    res = fft_wisdom_load("dat/bad2.wisdom");
+    printf("bad radix suffix:             res = 0x%.8x (%s)\n", res,
+           res == ERROR_FFT_WISDOM ? "ERROR_FFT_WISDOM" : "unexpected");
+
+    fft_wisdom_save("dat/fft_after_bad.wisdom");
+    printf("wisdom is not changed:        %s\n",
+           file_cmp("dat/fft.wisdom", "dat/fft_after_bad.wisdom") ?
+           "yes" : "no");
+
+    fft_wisdom_clear();
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
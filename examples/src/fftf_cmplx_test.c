@@ -0,0 +1,38 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* FFT size */
+#define N 18
+
+int main()
+{
+    void* handle;           /* DSPL handle                          */
+    handle = dspl_load();   /* Load libdspl                         */
+    complexf_t x[N];        /* Input signal array (single precision)*/
+    complexf_t y[N];        /* Output signal array                  */
+    fftf_t pfft = {0};      /* Single precision FFT object          */
+    int k;
+
+    /* Fill FFT structure                                           */
+    fftf_create(&pfft, N);
+
+    /* Fill input signal x[k] = exp(j*k)                            */
+    for(k = 0; k < N; k++)
+    {
+        RE(x[k]) = (float)cos((double)k);
+        IM(x[k]) = (float)sin((double)k);
+    }
+
+    /* FFT                                                          */
+    fftf_cmplx(x, N, &pfft, y);
+
+    /* print result                                                 */
+    for(k = 0; k < N; k++)
+        printf("y[%2d] = %9.3f%9.3f\n", k, RE(y[k]), IM(y[k]));
+
+    fftf_free(&pfft);       /* Clear fftf_t object                  */
+    dspl_free(handle);      /* Clear DSPL handle                    */
+    return 0;
+}
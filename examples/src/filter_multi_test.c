@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+
+/* Number of the channels: AVX lanes and the scalar rest channels */
+#define NCH     13
+/* Frame width for the ld > nch case                              */
+#define LDMAX   16
+/* Samples of each channel                                        */
+#define N       3000
+/* Maximum block size                                             */
+#define BMAX    300
+/* FIR filter order (direct filter)                               */
+#define FIR_ORD 24
+/* IIR filter order                                               */
+#define IIR_ORD 6
+/* Marker of the samples which are not the channels samples       */
+#define MARK    1E300
+/* FIR outputs error bound, the IIR outputs must be equal         */
+#define FIR_TOL 1E-14
+
+
+/*
+function filters the NCH channels of the frame of ld channels by
+filter_fir_multi (fir != 0) or filter_iir_multi (fir == 0) pushing the
+random size blocks, and returns the maximum difference between the
+channels outputs and the outputs of the one channel filters fir_filter
+or iir_filter. The returned value is -1 if the samples which are not the
+channels samples are changed.
+ */
+double multi_err(double* s, int ld, int fir, double* h,
+                 double* b, double* a)
+{
+    double x[N*LDMAX], y[N*LDMAX], u[N], v[N];
+    fir_t pf = {0};
+    iir_t pi = {0};
+    double err, d;
+    int k, m, c, res;
+
+    for(k = 0; k < N*ld; k++)
+    {
+        x[k] = (k % ld < NCH) ? s[(k % ld) * N + k / ld] : MARK;
+        y[k] = MARK;
+    }
+
+    res = fir ? fir_create_multi(&pf, h, FIR_ORD+1, NCH) :
+                iir_create_multi(&pi, b, a, IIR_ORD, NCH);
+    if(res != RES_OK)
+    {
+        printf("create error 0x%.8x\n", res);
+        return -1.0;
+    }
+    for(k = 0; k < N; k += m)
+    {
+        m = 1 + rand() % BMAX;
+        if(m > N - k)
+            m = N - k;
+        res = fir ? filter_fir_multi(&pf, x + k*ld, m, ld, y + k*ld) :
+                    filter_iir_multi(&pi, x + k*ld, m, ld, y + k*ld);
+        if(res != RES_OK)
+        {
+            printf("filter error 0x%.8x\n", res);
+            break;
+        }
+    }
+    fir_free(&pf);
+    iir_free(&pi);
+
+    err = 0.0;
+    for(c = 0; c < NCH; c++)
+    {
+        /* one channel reference */
+        if(fir)
+        {
+            fir_create(&pf, h, FIR_ORD+1);
+            fir_filter(&pf, s + c*N, N, u);
+            fir_free(&pf);
+        }
+        else
+        {
+            iir_create(&pi, b, a, IIR_ORD);
+            iir_filter(&pi, s + c*N, N, u);
+            iir_free(&pi);
+        }
+        for(k = 0; k < N; k++)
+            v[k] = y[k*ld + c];
+        for(k = 0; k < N; k++)
+        {
+            d = fabs(u[k] - v[k]);
+            if(d > err)
+                err = d;
+        }
+    }
+    for(k = 0; k < N*ld; k++)
+        if(k % ld >= NCH && y[k] != MARK)
+            return -1.0;
+    return err;
+}
+
+
+int main()
+{
+    void* hdspl;  /* DSPL handle        */
+
+    double s[NCH*N];
+    double h[FIR_ORD+1], b[IIR_ORD+1], a[IIR_ORD+1];
+    int isa[4] = {DSPL_ISA_SCALAR, DSPL_ISA_AVX2, DSPL_ISA_AVX512,
+                  DSPL_ISA_AUTO};
+    char* isa_name[4] = {"scalar", "AVX2", "AVX-512", "best"};
+    double err[4];
+    random_t rnd;
+    int i, res, fail = 0;
+
+    /* Load DSPL function  */
+    hdspl = dspl_load();
+
+    /* random generator init */
+    random_init(&rnd, RAND_TYPE_MT19937, NULL);
+
+    /* NCH channels of the white noise */
+    randn(s, NCH*N, 0, 1.0, &rnd);
+
+    /* The FIR vector lanes are calculated by the FMA operations, so the
+       outputs differ from fir_filter by the rounding errors of the unit
+       variance signal. The IIR vector lanes are calculated by the separate
+       multiplications and additions in the iir_filter order, so the
+       outputs are equal to iir_filter. Otherwise the rounding errors
+       of the IIR recursion would be amplified by the narrowband
+       elliptic filter poles close to the unit circle.                  */
+    fir_linphase(FIR_ORD, 0.2, 0.0, DSPL_FILTER_LPF,
+                 DSPL_WIN_BLACKMAN, 0.0, h);
+    iir(1.0, 70.0, IIR_ORD, 0.06, 0.0,
+        DSPL_FILTER_ELLIP | DSPL_FILTER_LPF, b, a);
+
+    printf("%d channels, the max errors vs fir_filter / iir_filter\n", NCH);
+    printf("(-1 if the samples out of the channels are changed)\n");
+    printf("FIR error bound %.0e, IIR outputs must be equal\n", FIR_TOL);
+    printf("ISA        FIR ld = %d   FIR ld = %d   IIR ld = %d   "
+           "IIR ld = %d\n", NCH, LDMAX, NCH, LDMAX);
+    for(i = 0; i < 4; i++)
+    {
+        if(dspl_set_isa(isa[i]) != RES_OK)
+        {
+            printf("%-9s  is not supported by the CPU\n", isa_name[i]);
+            continue;
+        }
+        err[0] = multi_err(s, NCH,   1, h, b, a);
+        err[1] = multi_err(s, LDMAX, 1, h, b, a);
+        err[2] = multi_err(s, NCH,   0, h, b, a);
+        err[3] = multi_err(s, LDMAX, 0, h, b, a);
+        res = err[0] < 0.0 || err[0] > FIR_TOL || 
+              err[1] < 0.0 || err[1] > FIR_TOL || 
+              err[2] != 0.0 || err[3] != 0.0;
+        fail += res;
+        printf("%-9s  %.3e     %.3e     %.3e     %.3e   %s\n", isa_name[i],
+               err[0], err[1], err[2], err[3], res ? "FAILED" : "ok");
+    }
+
+    dspl_set_isa(DSPL_ISA_AUTO);
+
+    /* free DSPL handle */
+    dspl_free(hdspl);
+
+    return fail ? 1 : 0;
+}
@@ -0,0 +1,345 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+
+/* Maximum number of the sections      */
+#define NSMAX   30
+/* Input signal size                   */
+#define N       4096
+/* Maximum block size of sos_filter    */
+#define BMAX    500
+/* Frequency response points           */
+#define NW      256
+
+/* Error bounds. The sections coefficients are checked against the
+   zeros and poles to the rounding errors of the pair quadratic.
+   The filter outputs are the same recursions with the other rounding
+   (FMA in the vector kernels), the errors relative to the output
+   maximum are bounded by the sections gain and the poles radius 0.95 */
+#define ZP_TOL   1E-12
+#define H_TOL    1E-12
+#define Y_TOL    1E-11
+
+
+/*
+function fills the zeros and poles of the test filter with ns sections:
+the poles pairs radii 0.6 ... 0.95 and the zeros pairs on the unit circle.
+If odd is nonzero then the first poles pair is replaced by the real pole
+and the first zeros pair is removed. The roots are shuffled, so the
+conjugate roots are not neighbours in the vectors.
+ */
+void test_zp(int ns, int odd, complex_t* z, int* nz, complex_t* p, int* np)
+{
+    complex_t t;
+    double r, w;
+    int s, k, m;
+
+    *nz = *np = 0;
+    for(s = 0; s < ns; s++)
+    {
+        r = 0.6 + 0.35 * (double)s / (double)(ns - 1);
+        w = M_PI * (0.05 + 0.25 * (double)s / (double)ns);
+        if(odd && !s)
+        {
+            RE(p[*np]) = 0.5;
+            IM(p[(*np)++]) = 0.0;
+            continue;
+        }
+        RE(p[*np]) = r * cos(w);
+        IM(p[(*np)++]) = r * sin(w);
+        RE(p[*np]) = r * cos(w);
+        IM(p[(*np)++]) = -r * sin(w);
+
+        w = M_PI * (0.4 + 0.55 * (double)s / (double)ns);
+        RE(z[*nz]) = cos(w);
+        IM(z[(*nz)++]) = sin(w);
+        RE(z[*nz]) = cos(w);
+        IM(z[(*nz)++]) = -sin(w);
+    }
+    for(k = 0; k < *np; k++)
+    {
+        m = rand() % *np;
+        RE(t) = RE(p[k]); IM(t) = IM(p[k]);
+        RE(p[k]) = RE(p[m]); IM(p[k]) = IM(p[m]);
+        RE(p[m]) = RE(t); IM(p[m]) = IM(t);
+    }
+    for(k = 0; k < *nz; k++)
+    {
+        m = rand() % *nz;
+        RE(t) = RE(z[k]); IM(t) = IM(z[k]);
+        RE(z[k]) = RE(z[m]); IM(z[k]) = IM(z[m]);
+        RE(z[m]) = RE(t); IM(z[m]) = IM(t);
+    }
+}
+
+
+/*
+function returns the maximum difference between the section quadratic
+(1 + c[0] z^-1 + c[1] z^-2) coefficients and the quadratic of the
+roots r which are not used yet. The nearest roots are marked as used.
+The first-order section (c[1] = 0) is compared to the real root.
+ */
+double pair_err(double* c, complex_t* r, int n, int* used)
+{
+    double d, dm = 1.0;
+    int i, q = -1;
+
+    for(i = 0; i < n; i++)
+    {
+        if(used[i] || IM(r[i]) < 0.0)
+            continue;
+        if(c[1] == 0.0 && IM(r[i]) == 0.0)
+            d = fabs(c[0] + RE(r[i]));
+        else if(c[1] != 0.0 && IM(r[i]) > 0.0)
+            d = fabs(c[0] + 2.0 * RE(r[i])) +
+                fabs(c[1] - RE(r[i])*RE(r[i]) - IM(r[i])*IM(r[i]));
+        else
+            continue;
+        if(q < 0 || d < dm)
+        {
+            q  = i;
+            dm = d;
+        }
+    }
+    if(q < 0)
+        return 1.0;
+    used[q] = 1;
+    /* the conjugate root is used too */
+    for(i = 0; i < n; i++)
+    {
+        if(!used[i] && RE(r[i]) == RE(r[q]) && IM(r[i]) == -IM(r[q]))
+        {
+            used[i] = 1;
+            break;
+        }
+    }
+    return dm;
+}
+
+
+/*
+function checks the filter_zp2sos sections of the zeros z, poles p
+and gain k: each section numerator and denominator are the quadratics
+of one conjugate zeros and poles pair (zp_err), the poles radii are
+not decreasing, the sections gains product is k (k_err) and the cascade
+frequency response is equal to the zeros and poles response
+relative to its maximum (h_err).
+Returns the number of the failed checks.
+ */
+int zp2sos_check(complex_t* z, int nz, complex_t* p, int np, double k,
+                 double* b, double* a, int ns)
+{
+    int uz[2*NSMAX], up[2*NSMAX];
+    double c[2], zp_err, k_err, h_err, g, rad, rmax, w, hm;
+    complex_t e, h, hs, num, den, t;
+    int s, i, j, fail = 0;
+
+    memset(uz, 0, sizeof(uz));
+    memset(up, 0, sizeof(up));
+    zp_err = 0.0;
+    rad = 0.0;
+    g = 1.0;
+    for(s = 0; s < ns; s++)
+    {
+        c[0] = a[3*s+1] / a[3*s];
+        c[1] = a[3*s+2] / a[3*s];
+        zp_err = fmax(zp_err, pair_err(c, p, np, up));
+        rmax = (c[1] == 0.0) ? fabs(c[0]) : sqrt(c[1]);
+        if(rmax < rad)
+            fail++;
+        rad = rmax;
+        g *= b[3*s] / a[3*s];
+        if(b[3*s+1] != 0.0 || b[3*s+2] != 0.0)
+        {
+            c[0] = b[3*s+1] / b[3*s];
+            c[1] = b[3*s+2] / b[3*s];
+            zp_err = fmax(zp_err, pair_err(c, z, nz, uz));
+        }
+    }
+    for(i = 0; i < np; i++)
+        if(!up[i])
+            zp_err = 1.0;
+    for(i = 0; i < nz; i++)
+        if(!uz[i])
+            zp_err = 1.0;
+    k_err = fabs(g - k) / fabs(k);
+
+    h_err = hm = 0.0;
+    for(i = 0; i < NW; i++)
+    {
+        /* e = exp(-jw) */
+        w = M_PI * (double)i / (double)NW;
+        RE(e) = cos(w);
+        IM(e) = -sin(w);
+
+        /* zeros and poles response */
+        RE(h) = k;
+        IM(h) = 0.0;
+        for(j = 0; j < nz; j++)
+        {
+            RE(num) = 1.0 - RE(z[j])*RE(e) + IM(z[j])*IM(e);
+            IM(num) = -RE(z[j])*IM(e) - IM(z[j])*RE(e);
+            RE(t) = CMRE(h, num);
+            IM(t) = CMIM(h, num);
+            RE(h) = RE(t);
+            IM(h) = IM(t);
+        }
+        for(j = 0; j < np; j++)
+        {
+            RE(den) = 1.0 - RE(p[j])*RE(e) + IM(p[j])*IM(e);
+            IM(den) = -RE(p[j])*IM(e) - IM(p[j])*RE(e);
+            RE(t) = CMCONJRE(h, den) / ABSSQR(den);
+            IM(t) = CMCONJIM(h, den) / ABSSQR(den);
+            RE(h) = RE(t);
+            IM(h) = IM(t);
+        }
+
+        /* sections cascade response */
+        RE(hs) = 1.0;
+        IM(hs) = 0.0;
+        for(s = 0; s < ns; s++)
+        {
+            RE(num) = b[3*s] + b[3*s+1]*RE(e) +
+                      b[3*s+2]*(RE(e)*RE(e) - IM(e)*IM(e));
+            IM(num) = b[3*s+1]*IM(e) + b[3*s+2]*2.0*RE(e)*IM(e);
+            RE(den) = a[3*s] + a[3*s+1]*RE(e) +
+                      a[3*s+2]*(RE(e)*RE(e) - IM(e)*IM(e));
+            IM(den) = a[3*s+1]*IM(e) + a[3*s+2]*2.0*RE(e)*IM(e);
+            RE(t) = CMRE(hs, num);
+            IM(t) = CMIM(hs, num);
+            RE(hs) = CMCONJRE(t, den) / ABSSQR(den);
+            IM(hs) = CMCONJIM(t, den) / ABSSQR(den);
+        }
+        h_err = fmax(h_err, sqrt((RE(h)-RE(hs))*(RE(h)-RE(hs)) +
+                                 (IM(h)-IM(hs))*(IM(h)-IM(hs))));
+        hm = fmax(hm, ABS(h));
+    }
+    h_err /= hm;
+
+    fail += (zp_err > ZP_TOL) + (k_err > ZP_TOL) + (h_err > H_TOL);
+    printf("zp2sos   pairs err = %.3e   gain err = %.3e   "
+           "response err = %.3e   %s\n", zp_err, k_err, h_err,
+           fail ? "FAILED" : "ok");
+    return fail;
+}
+
+
+/*
+function compares the filter_sos output and the block-wise sos_filter
+output with the reference y0 (the sections filtered one by one
+by filter_iir) relative to the reference maximum.
+Returns the number of the failed checks.
+ */
+int sos_check(double* b, double* a, int ns, double* s, double* y0,
+              double* y, char* name)
+{
+    sos_t flt = {0};
+    double err_sos, err_blk, ym;
+    int k, m, res;
+
+    ym = 0.0;
+    for(k = 0; k < N; k++)
+        ym = fmax(ym, fabs(y0[k]));
+
+    res = filter_sos(b, a, ns, s, N, y);
+    if(res != RES_OK)
+    {
+        printf("filter_sos error 0x%.8x\n", res);
+        return 1;
+    }
+    err_sos = 0.0;
+    for(k = 0; k < N; k++)
+        err_sos = fmax(err_sos, fabs(y[k] - y0[k]) / ym);
+
+    res = sos_create(&flt, b, a, ns);
+    for(k = 0; k < N && res == RES_OK; k += m)
+    {
+        m = 1 + rand() % BMAX;
+        if(m > N - k)
+            m = N - k;
+        res = sos_filter(&flt, s + k, m, y + k);
+    }
+    sos_free(&flt);
+    if(res != RES_OK)
+    {
+        printf("sos_filter error 0x%.8x\n", res);
+        return 1;
+    }
+    err_blk = 0.0;
+    for(k = 0; k < N; k++)
+        err_blk = fmax(err_blk, fabs(y[k] - y0[k]) / ym);
+
+    res = (err_sos > Y_TOL) + (err_blk > Y_TOL);
+    printf("%-9s  filter_sos err = %.3e   sos_filter err = %.3e   %s\n",
+           name, err_sos, err_blk, res ? "FAILED" : "ok");
+    return res;
+}
+
+
+int main()
+{
+    void* hdspl;  /* DSPL handle        */
+
+    complex_t z[2*NSMAX], p[2*NSMAX];
+    double b[3*NSMAX], a[3*NSMAX];
+    double s[N], y0[N], y[N];
+    /* sections below, at and above the AVX-512 kernel minimum (13) */
+    int nsv[3] = {4, 13, 30};
+    int isa[4] = {DSPL_ISA_SCALAR, DSPL_ISA_AVX2, DSPL_ISA_AVX512,
+                  DSPL_ISA_AUTO};
+    char* isa_name[4] = {"scalar", "AVX2", "AVX-512", "best"};
+    random_t rnd;
+    double k = 0.01;
+    int i, j, ns, nz, np, fail = 0;
+
+    /* Load DSPL function  */
+    hdspl = dspl_load();
+
+    /* random generator init */
+    random_init(&rnd, RAND_TYPE_MT19937, NULL);
+
+    /* input signal is the white noise */
+    randn(s, N, 0, 1.0, &rnd);
+
+    printf("error bounds: zp2sos %.0e, response %.0e, filter output %.0e\n",
+           ZP_TOL, H_TOL, Y_TOL);
+    for(i = 0; i < 3; i++)
+    {
+        ns = nsv[i];
+        /* the odd number of poles at 13 sections
+           gives the first-order section */
+        test_zp(ns, ns % 2, z, &nz, p, &np);
+        printf("\n%d sections, %d zeros, %d poles\n", ns, nz, np);
+        if(filter_zp2sos(z, nz, p, np, k, b, a) != RES_OK)
+        {
+            printf("filter_zp2sos error\n");
+            fail++;
+            continue;
+        }
+        fail += zp2sos_check(z, nz, p, np, k, b, a, ns);
+
+        /* reference: the sections filtered one by one by filter_iir */
+        memcpy(y0, s, N * sizeof(double));
+        for(j = 0; j < ns; j++)
+            filter_iir(b + 3*j, a + 3*j, 2, y0, N, y0);
+
+        for(j = 0; j < 4; j++)
+        {
+            if(dspl_set_isa(isa[j]) != RES_OK)
+            {
+                printf("%-9s  is not supported by the CPU\n", isa_name[j]);
+                continue;
+            }
+            fail += sos_check(b, a, ns, s, y0, y, isa_name[j]);
+        }
+        dspl_set_isa(DSPL_ISA_AUTO);
+    }
+    printf("\n%d checks failed\n", fail);
+
+    /* free DSPL handle */
+    dspl_free(hdspl);
+
+    return fail ? 1 : 0;
+}
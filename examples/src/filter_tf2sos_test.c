@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+
+/* Maximum filter order */
+#define MAX_ORD 8
+
+/* Stopband suppression (dB) */
+#define RS 60.0
+
+/* Pass-band maximum distortion (dB) */
+#define RP 1.0
+
+/* Frequency response vector size */
+#define N  512
+
+
+/*
+function returns the maximum difference between the magnitude of 
+the transfer function H(z) and the magnitude of its second-order sections
+cascade calculated by filter_tf2sos.
+params: b  - pointer to the transfer fuction H(z) numerator vector
+        a  - pointer to the transfer fuction H(z) denominator vector
+        ord - filter order
+        err - pointer to the maximum magnitude difference
+ */
+int tf2sos_err(double* b, double* a, int ord, double* err)
+{
+    double sb[3*MAX_ORD], sa[3*MAX_ORD];
+    double w[N], mag[N], ms[N], h[N];
+    int ns, s, k, res;
+
+    ns = (ord + 1) / 2;
+    res = filter_tf2sos(b, a, ord, sb, sa);
+    if(res != RES_OK)
+        return res;
+
+    linspace(0, M_PI, N, DSPL_PERIODIC, w);
+    filter_freq_resp(b, a, ord, w, N, 0, mag, NULL, NULL);
+
+    /* Cascade magnitude is the product of the sections magnitudes */
+    for(k = 0; k < N; k++)
+        h[k] = 1.0;
+    for(s = 0; s < ns; s++)
+    {
+        filter_freq_resp(sb+3*s, sa+3*s, 2, w, N, 0, ms, NULL, NULL);
+        for(k = 0; k < N; k++)
+            h[k] *= ms[k];
+    }
+
+    *err = 0.0;
+    for(k = 0; k < N; k++)
+        if(fabs(h[k] - mag[k]) > *err)
+            *err = fabs(h[k] - mag[k]);
+    return RES_OK;
+}
+
+
+/*
+ * Main program
+ */
+int main(int argc, char* argv[])
+{
+    void* hdspl;           /* DSPL handle         */
+    hdspl = dspl_load();   /* Load DSPL functions */
+
+    /* Transfer function H(z) coeff. vectors */
+    double a[MAX_ORD+1], b[MAX_ORD+1];
+
+    int approx[4] = {DSPL_FILTER_BUTTER, DSPL_FILTER_CHEBY1, 
+                     DSPL_FILTER_CHEBY2, DSPL_FILTER_ELLIP};
+    int type[4]   = {DSPL_FILTER_LPF,   DSPL_FILTER_HPF, 
+                     DSPL_FILTER_BPASS, DSPL_FILTER_BSTOP};
+    char* approx_name[4] = {"butter", "cheby1", "cheby2", "ellip"};
+    char* type_name[4]   = {"lpf", "hpf", "bpf", "bsf"};
+    double err;
+    int i, j, ord, res;
+
+    printf("filter        ord   tf2sos magnitude error\n");
+    for(i = 0; i < 4; i++)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            for(ord = 3; ord <= MAX_ORD; ord++)
+            {
+                /* band-pass and band-stop filters order must be even */
+                if(j > 1 && ord % 2)
+                    continue;
+                iir(RP, RS, ord, 0.3, 0.7, approx[i] | type[j], b, a);
+                res = tf2sos_err(b, a, ord, &err);
+                if(res != RES_OK)
+                    printf("%s %s  %4d   error 0x%.8x\n", 
+                           approx_name[i], type_name[j], ord, res);
+                else
+                    printf("%s %s  %4d   %.3e\n", 
+                           approx_name[i], type_name[j], ord, err);
+            }
+        }
+    }
+
+    /* free dspl handle */
+    dspl_free(hdspl);
+
+    return 0;
+}
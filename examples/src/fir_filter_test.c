@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Short filter order (direct filter)       */
+#define ORD0    16
+/* Long filter order (overlap-save filter)  */
+#define ORD1    254
+/* Input signal size                        */
+#define N       20000
+/* Maximum block size                       */
+#define BMAX    1500
+
+
+/*
+function filters the signal s by the streaming FIR filter h pushing
+the random size blocks and returns the maximum difference between the
+stream output and the one-shot convolution c. Every second block
+is filtered in-place.
+ */
+double fir_err(double* h, int nh, double* s, double* c, double* y)
+{
+    fir_t fir = {0};
+    double err, d;
+    int k, m, b, res;
+
+    res = fir_create(&fir, h, nh);
+    if(res != RES_OK)
+    {
+        printf("fir_create error 0x%.8x\n", res);
+        return -1.0;
+    }
+
+    for(k = 0, b = 0; k < N; k += m, b++)
+    {
+        m = 1 + rand() % BMAX;
+        if(m > N - k)
+            m = N - k;
+        if(b % 2)
+        {
+            memcpy(y + k, s + k, m * sizeof(double));
+            res = fir_filter(&fir, y + k, m, y + k);
+        }
+        else
+            res = fir_filter(&fir, s + k, m, y + k);
+        if(res != RES_OK)
+        {
+            printf("fir_filter error 0x%.8x\n", res);
+            break;
+        }
+    }
+    fir_free(&fir);
+
+    err = 0.0;
+    for(k = 0; k < N; k++)
+    {
+        d = fabs(y[k] - c[k]);
+        if(d > err)
+            err = d;
+    }
+    return err;
+}
+
+
+int main()
+{
+    void* hdspl;  /* DSPL handle        */
+
+    double h0[ORD0+1], h1[ORD1+1];
+    double s[N], y[N];
+    double c[N+ORD1];
+    random_t rnd;
+    double err;
+
+    /* Load DSPL function  */
+    hdspl = dspl_load();
+
+    /* random generator init */
+    random_init(&rnd, RAND_TYPE_MT19937, NULL);
+
+    /* input signal is the white noise */
+    randn(s, N, 0, 1.0, &rnd);
+
+    /* short filter is calculated directly */
+    fir_linphase(ORD0, 0.2, 0.0, DSPL_FILTER_LPF,
+                 DSPL_WIN_BLACKMAN, 0.0, h0);
+    conv(s, N, h0, ORD0+1, c);
+    err = fir_err(h0, ORD0+1, s, c, y);
+    printf("%3d taps (direct filter):       max error = %.3e\n",
+           ORD0+1, err);
+
+    /* long filter is calculated by the overlap-save FFT */
+    fir_linphase(ORD1, 0.2, 0.0, DSPL_FILTER_LPF,
+                 DSPL_WIN_BLACKMAN, 0.0, h1);
+    conv(s, N, h1, ORD1+1, c);
+    err = fir_err(h1, ORD1+1, s, c, y);
+    printf("%3d taps (overlap-save filter): max error = %.3e\n",
+           ORD1+1, err);
+
+    /* free DSPL handle */
+    dspl_free(hdspl);
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* DFT size                         */
+#define N       1000
+/* Number of the bins               */
+#define K       37
+/* Partial frame size               */
+#define L       600
+
+
+/* maximum difference of the complex vectors */
+double cmplx_err(complex_t* a, complex_t* b, int n)
+{
+    double d, err = 0.0;
+    int k;
+    for(k = 0; k < n; k++)
+    {
+        d = fabs(RE(a[k]) - RE(b[k])) + fabs(IM(a[k]) - IM(b[k]));
+        if(d > err)
+            err = d;
+    }
+    return err;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    complex_t x[N];         /* Complex input frame      */
+    double    r[N];         /* Real input frame         */
+    complex_t t[N];         /* Zero-padded frame        */
+    complex_t s[N];         /* dft_cmplx of the frame   */
+    complex_t y[N];         /* Goertzel bins            */
+    complex_t yref[N];      /* Scalar ISA bins          */
+    int ind[N];             /* Bins indexes             */
+    goertzel_t g = {0};     /* Goertzel object          */
+    int isa[5] = {FFT_ISA_SCALAR, FFT_ISA_SSE2, FFT_ISA_AVX2,
+                  FFT_ISA_AVX512, FFT_ISA_AUTO};
+    char* isa_name[5] = {"scalar", "SSE2", "AVX2", "AVX-512", "best"};
+    double e1, e2, e3, e4;
+    int i, k, m, c;
+
+    for(k = 0; k < N; k++)
+    {
+        RE(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[k]) = (double)rand() / RAND_MAX - 0.5;
+        r[k]     = (double)rand() / RAND_MAX - 0.5;
+    }
+    /* arbitrary bins, the negative indexes are taken modulo N */
+    for(i = 0; i < K; i++)
+        ind[i] = (i * 271) % N - 100;
+
+    printf("ISA        full frame   partial frame   real partial   "
+           "FFT fallback\n");
+    for(m = 0; m < 5; m++)
+    {
+        if(fft_set_isa(isa[m]) != RES_OK)
+        {
+            printf("%-9s  is not supported by the CPU\n", isa_name[m]);
+            continue;
+        }
+
+        /* full frame: goertzel_cmplx vs dft_cmplx bins */
+        goertzel_cmplx(x, N, ind, K, y);
+        dft_cmplx(x, N, s);
+        for(i = 0; i < K; i++)
+        {
+            RE(t[i]) = RE(s[((ind[i] % N) + N) % N]);
+            IM(t[i]) = IM(s[((ind[i] % N) + N) % N]);
+        }
+        e1 = cmplx_err(y, t, K);
+
+        /* partial frame of L samples pushed by the random blocks,
+           the bins are the DFT of the zero-padded frame         */
+        goertzel_create(&g, N, ind, K);
+        for(k = 0; k < L; k += c)
+        {
+            c = 1 + rand() % 97;
+            if(c > L - k)
+                c = L - k;
+            goertzel_update_cmplx(&g, x + k, c);
+        }
+        goertzel_result(&g, y);
+        memset(t, 0, N * sizeof(complex_t));
+        memcpy(t, x, L * sizeof(complex_t));
+        dft_cmplx(t, N, s);
+        for(i = 0; i < K; i++)
+        {
+            RE(t[i]) = RE(s[((ind[i] % N) + N) % N]);
+            IM(t[i]) = IM(s[((ind[i] % N) + N) % N]);
+        }
+        e2 = cmplx_err(y, t, K);
+
+        /* real partial frame */
+        goertzel_reset(&g);
+        for(k = 0; k < L; k += c)
+        {
+            c = 1 + rand() % 97;
+            if(c > L - k)
+                c = L - k;
+            goertzel_update(&g, r + k, c);
+        }
+        goertzel_result(&g, y);
+        memset(t, 0, N * sizeof(complex_t));
+        for(k = 0; k < L; k++)
+            RE(t[k]) = r[k];
+        dft_cmplx(t, N, s);
+        for(i = 0; i < K; i++)
+        {
+            RE(t[i]) = RE(s[((ind[i] % N) + N) % N]);
+            IM(t[i]) = IM(s[((ind[i] % N) + N) % N]);
+        }
+        e3 = cmplx_err(y, t, K);
+        goertzel_free(&g);
+
+        /* all N bins are calculated by the FFT fallback */
+        for(i = 0; i < N; i++)
+            ind[i] = i;
+        goertzel_cmplx(x, N, ind, N, y);
+        dft_cmplx(x, N, s);
+        e4 = cmplx_err(y, s, N);
+        for(i = 0; i < K; i++)
+            ind[i] = (i * 271) % N - 100;
+
+        printf("%-9s  %.3e    %.3e       %.3e      %.3e\n",
+               isa_name[m], e1, e2, e3, e4);
+
+        /* the selected ISA bins vs the scalar ISA bins */
+        goertzel_cmplx(x, N, ind, K, y);
+        if(isa[m] == FFT_ISA_SCALAR)
+            memcpy(yref, y, K * sizeof(complex_t));
+        else
+            printf("%-9s  vs scalar difference %.3e\n",
+                   isa_name[m], cmplx_err(y, yref, K));
+    }
+
+    fft_set_isa(FFT_ISA_AUTO);
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* FFT size */
+#define N 14
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    double    x[N];         /* Input signal array       */
+    complex_t y[N/2+1];     /* Spectrum half            */
+    double    z[N];         /* IFFT result              */
+    fft_t pfft = {0};       /* FFT object (fill zeros)  */
+    int k;
+
+    /* Fill input signal x[k] = k                        */
+    for(k = 0; k < N; k++)
+        x[k] = (double)k;
+
+    /* Real FFT (N/2+1 non-redundant spectrum samples)   */
+    fft_r2c(x, N, &pfft, y);
+
+    /* Real IFFT of the spectrum half                   */
+    ifft(y, N, &pfft, z);
+
+    /* print result                                     */
+    for(k = 0; k < N; k++)
+        printf("x[%2d] = %9.3f    z[%2d] = %9.3f\n", k, x[k], k, z[k]);
+
+    fft_free(&pfft);        /* Clear fft_t object       */
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
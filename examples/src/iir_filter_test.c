@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Filters order                    */
+#define ORD     8
+/* Input signal size                */
+#define N       20000
+/* Maximum block size               */
+#define BMAX    700
+
+
+/*
+function filters the signal s by the streaming IIR filter pushing the
+random size blocks and returns the maximum difference between the stream
+output and the one-shot filter_iir output sf. The stream is filtered
+twice: the second pass after iir_reset is filtered in-place.
+ */
+double iir_err(double* b, double* a, int ord, double* s, double* sf,
+               double* y)
+{
+    iir_t flt = {0};
+    double err, d;
+    int k, m, p, res;
+
+    res = iir_create(&flt, b, a, ord);
+    if(res != RES_OK)
+    {
+        printf("iir_create error 0x%.8x\n", res);
+        return -1.0;
+    }
+
+    err = 0.0;
+    for(p = 0; p < 2; p++)
+    {
+        if(p)
+        {
+            iir_reset(&flt);
+            memcpy(y, s, N * sizeof(double));
+        }
+        for(k = 0; k < N; k += m)
+        {
+            m = 1 + rand() % BMAX;
+            if(m > N - k)
+                m = N - k;
+            res = iir_filter(&flt, p ? y + k : s + k, m, y + k);
+            if(res != RES_OK)
+            {
+                printf("iir_filter error 0x%.8x\n", res);
+                break;
+            }
+        }
+        for(k = 0; k < N; k++)
+        {
+            d = fabs(y[k] - sf[k]);
+            if(d > err)
+                err = d;
+        }
+    }
+    iir_free(&flt);
+    return err;
+}
+
+
+int main()
+{
+    void* hdspl;  /* DSPL handle        */
+
+    double b[ORD+1], a[ORD+1];
+    double s[N], sf[N], y[N];
+    random_t rnd;
+    double err;
+
+    /* Load DSPL function  */
+    hdspl = dspl_load();
+
+    /* random generator init */
+    random_init(&rnd, RAND_TYPE_MT19937, NULL);
+
+    /* input signal is the white noise */
+    randn(s, N, 0, 1.0, &rnd);
+
+    /* elliptic LPF */
+    iir(1.0, 70.0, ORD, 0.06, 0.0, DSPL_FILTER_ELLIP | DSPL_FILTER_LPF, b, a);
+    filter_iir(b, a, ORD, s, N, sf);
+    err = iir_err(b, a, ORD, s, sf, y);
+    printf("elliptic LPF:    max error = %.3e\n", err);
+
+    /* Chebyshev type 2 HPF */
+    iir(1.0, 60.0, ORD, 0.3, 0.0, DSPL_FILTER_CHEBY2 | DSPL_FILTER_HPF, b, a);
+    filter_iir(b, a, ORD, s, N, sf);
+    err = iir_err(b, a, ORD, s, sf, y);
+    printf("Chebyshev 2 HPF: max error = %.3e\n", err);
+
+    /* free DSPL handle */
+    dspl_free(hdspl);
+
+    return 0;
+}
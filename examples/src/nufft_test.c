@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Number of the non-uniform samples */
+#define NX      1000
+/* Number of the uniform spectrum samples */
+#define NK      256
+/* Number of the accuracy values    */
+#define NEPS    5
+
+
+/* direct type 1 NUDFT:  Y(k) = sum s(m) exp(-j(k - nk/2) x(m)) */
+void nudft1(double* x, complex_t* s, int nx, int nk, complex_t* y)
+{
+    double c, d;
+    int k, m;
+    for(k = 0; k < nk; k++)
+    {
+        RE(y[k]) = IM(y[k]) = 0.0;
+        for(m = 0; m < nx; m++)
+        {
+            c = cos((k - nk / 2) * x[m]);
+            d = sin((k - nk / 2) * x[m]);
+            RE(y[k]) += RE(s[m]) * c + IM(s[m]) * d;
+            IM(y[k]) += IM(s[m]) * c - RE(s[m]) * d;
+        }
+    }
+}
+
+
+/* direct type 2 NUDFT:  y(m) = sum S(k) exp(j(k - nk/2) x(m)) */
+void nudft2(complex_t* s, int nk, double* x, int nx, complex_t* y)
+{
+    double c, d;
+    int k, m;
+    for(m = 0; m < nx; m++)
+    {
+        RE(y[m]) = IM(y[m]) = 0.0;
+        for(k = 0; k < nk; k++)
+        {
+            c = cos((k - nk / 2) * x[m]);
+            d = sin((k - nk / 2) * x[m]);
+            RE(y[m]) += RE(s[k]) * c - IM(s[k]) * d;
+            IM(y[m]) += IM(s[k]) * c + RE(s[k]) * d;
+        }
+    }
+}
+
+
+/* maximum difference relative to the sum of the input magnitudes */
+double rel_err(complex_t* a, complex_t* b, int n, complex_t* s, int ns)
+{
+    double d, err = 0.0, sum = 0.0;
+    int k;
+    for(k = 0; k < n; k++)
+    {
+        d = sqrt((RE(a[k]) - RE(b[k])) * (RE(a[k]) - RE(b[k])) +
+                 (IM(a[k]) - IM(b[k])) * (IM(a[k]) - IM(b[k])));
+        if(d > err)
+            err = d;
+    }
+    for(k = 0; k < ns; k++)
+        sum += ABS(s[k]);
+    return err / sum;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    double    x[NX];        /* Non-uniform phases       */
+    complex_t s[NX];        /* Non-uniform signal       */
+    complex_t S[NK];        /* Uniform spectrum         */
+    complex_t y1[NK];       /* Type 1 NUFFT spectrum    */
+    complex_t r1[NK];       /* Type 1 direct spectrum   */
+    complex_t y2[NX];       /* Type 2 NUFFT signal      */
+    complex_t r2[NX];       /* Type 2 direct signal     */
+    fft_t pfft = {0};       /* FFT object (fill zeros)  */
+    double eps[NEPS] = {1E-2, 1E-4, 1E-7, 1E-10, 1E-13};
+    double e1, e2;
+    int k, res;
+
+    /* random phases of the several periods (not only [-pi, pi)) */
+    for(k = 0; k < NX; k++)
+    {
+        x[k]     = 3.0 * M_2PI * ((double)rand() / RAND_MAX - 0.5);
+        RE(s[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(s[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+    for(k = 0; k < NK; k++)
+    {
+        RE(S[k]) = (double)rand() / RAND_MAX - 0.5;
+        IM(S[k]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    nudft1(x, s, NX, NK, r1);
+    nudft2(S, NK, x, NX, r2);
+
+    printf("eps          type 1 error   type 2 error\n");
+    for(k = 0; k < NEPS; k++)
+    {
+        res = nufft1_cmplx(x, s, NX, NK, eps[k], &pfft, y1);
+        if(res != RES_OK)
+            break;
+        res = nufft2_cmplx(S, NK, x, NX, eps[k], &pfft, y2);
+        if(res != RES_OK)
+            break;
+        e1 = rel_err(y1, r1, NK, s, NX);
+        e2 = rel_err(y2, r2, NX, S, NK);
+        printf("%.0e        %.3e      %.3e    %s\n", eps[k], e1, e2,
+               (e1 < eps[k] && e2 < eps[k]) ? "ok" : "exceeds eps");
+    }
+    if(res != RES_OK)
+        printf("error 0x%.8x\n", res);
+
+    fft_free(&pfft);
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Sliding window size (DFT size)   */
+#define N       64
+/* Re-anchoring period              */
+#define NR      40
+/* Number of the pushed samples     */
+#define L       1000
+/* Maximum pushed block size        */
+#define BMAX    23
+
+
+/*
+function pushes the random signal to the sliding DFT by the random blocks
+and returns the maximum difference between the tracked bins after each
+block and the bins of fft_cmplx of the current window.
+params: ind - pointer to the tracked bins indexes (NULL - all bins)
+        k   - number of the tracked bins
+        err - pointer to the maximum difference
+ */
+int sdft_err(int* ind, int k, double* err)
+{
+    complex_t x[L];             /* Input signal             */
+    complex_t y[N];             /* sdft_push bins           */
+    complex_t w[N];             /* Current window           */
+    complex_t s[N];             /* fft_cmplx bins           */
+    sdft_t sd = {0};            /* Sliding DFT object       */
+    fft_t pfft = {0};           /* FFT object (fill zeros)  */
+    int t, c, i, m, res;
+
+    for(t = 0; t < L; t++)
+    {
+        RE(x[t]) = (double)rand() / RAND_MAX - 0.5;
+        IM(x[t]) = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    res = sdft_create(&sd, N, ind, k, NR);
+    if(res != RES_OK)
+        return res;
+
+    *err = 0.0;
+    for(t = 0; t < L; t += c)
+    {
+        c = 1 + rand() % BMAX;
+        if(c > L - t)
+            c = L - t;
+        res = sdft_push(&sd, x + t, c, y);
+        if(res != RES_OK)
+            break;
+
+        /* window of the last N samples, zeros before the first sample */
+        for(i = 0; i < N; i++)
+        {
+            m = t + c - N + i;
+            RE(w[i]) = m < 0 ? 0.0 : RE(x[m]);
+            IM(w[i]) = m < 0 ? 0.0 : IM(x[m]);
+        }
+        res = fft_cmplx(w, N, &pfft, s);
+        if(res != RES_OK)
+            break;
+
+        for(i = 0; i < (ind ? k : N); i++)
+        {
+            m = ind ? ((ind[i] % N) + N) % N : i;
+            RE(s[m]) -= RE(y[i]);
+            IM(s[m]) -= IM(y[i]);
+            if(ABS(s[m]) > *err)
+                *err = ABS(s[m]);
+        }
+    }
+
+    sdft_free(&sd);
+    fft_free(&pfft);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    int ind2[2] = {3, -5};  /* Two bins (Goertzel)      */
+    int indn[N];            /* Most bins (FFT re-anchor)*/
+    double err;
+    int k, res;
+
+    for(k = 0; k < N; k++)
+        indn[k] = N - 1 - k;
+
+    /* The bins re-anchoring every NR = 40 samples: the windows
+       across the re-anchoring boundaries are compared too     */
+    res = sdft_err(ind2, 2, &err);
+    printf("2 tracked bins:        res = 0x%.8x   max error = %.3e\n",
+           res, err);
+
+    res = sdft_err(indn, N, &err);
+    printf("%d tracked bins:       res = 0x%.8x   max error = %.3e\n",
+           N, res, err);
+
+    res = sdft_err(NULL, 0, &err);
+    printf("all bins:              res = 0x%.8x   max error = %.3e\n",
+           res, err);
+
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
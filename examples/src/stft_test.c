@@ -0,0 +1,72 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Signal size                      */
+#define N       2048
+/* STFT frame size                  */
+#define NFFT    256
+/* Frame hop                        */
+#define HOP     64
+/* Number of the STFT frames        */
+#define NCOL    ((N - NFFT) / HOP + 1)
+/* Number of the frame bins         */
+#define NK      (NFFT / 2 + 1)
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    double x[N];            /* Input signal array       */
+    double r[N];            /* Reconstructed signal     */
+    complex_t* y;           /* STFT matrix              */
+    double* s;              /* Spectrogram, dB          */
+    stft_t st = {0};        /* STFT object (fill zeros) */
+    double fs = 8000.0;     /* Sample rate, Hz          */
+    double err, f;
+    int k, m;
+
+    y = (complex_t*) malloc(NCOL * NK * sizeof(complex_t));
+    s = (double*)    malloc(NCOL * NK * sizeof(double));
+
+    /* Linear chirp from 500 Hz to 3500 Hz              */
+    for(k = 0; k < N; k++)
+    {
+        f = (double)k / fs;
+        x[k] = cos(M_2PI * (500.0 * f + 3000.0 * fs / (2.0 * N) * f * f));
+    }
+
+    /* periodic Hann window, 75% overlap                */
+    stft_create(&st, NFFT, HOP, DSPL_WIN_HANN | DSPL_WIN_PERIODIC, 0.0);
+
+    /* spectrogram in dB: peak bin of each 4th frame    */
+    spectrogram(x, N, &st, DSPL_FLAG_LOGMAG, s);
+    for(k = 0; k < NCOL; k += 4)
+    {
+        int kmax = 0;
+        for(m = 1; m < NK; m++)
+            if(s[k*NK + m] > s[k*NK + kmax])
+                kmax = m;
+        printf("t = %7.4f s    peak f = %7.1f Hz    S = %6.2f dB\n",
+               (double)(k * HOP + NFFT / 2) / fs,
+               (double)kmax * fs / (double)NFFT, s[k*NK + kmax]);
+    }
+
+    /* STFT and inverse STFT                            */
+    stft(x, N, &st, y);
+    istft(y, NCOL, &st, r);
+
+    /* reconstruction error (window edges excluded)     */
+    err = 0.0;
+    for(k = NFFT; k < N - NFFT; k++)
+        if(fabs(r[k] - x[k]) > err)
+            err = fabs(r[k] - x[k]);
+    printf("istft max error = %.3e\n", err);
+
+    free(y);
+    free(s);
+    stft_free(&st);         /* Clear stft_t object      */
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* Signal size                      */
+#define N   1000
+/* Number of the spectrum samples   */
+#define M   11
+
+/* Long signal size (4M samples)    */
+#define NL  4194304
+/* Number of the long signal band samples */
+#define ML  101
+
+
+/*
+function calculates ML samples of the 10 kHz band of the NL-points
+tone sampled at 50 MHz by zoom_fft and prints the maximum difference
+from the geometric series closed form relative to the maximum sample.
+The tone frequency is a multiple of fs / 2^30, so the input phases
+p * r are calculated exactly.
+ */
+int zoom_fft_long_err(void)
+{
+    complex_t *x = NULL, *y = NULL;
+    czt_t czt = {0};
+    double fs = 50.0e6;
+    double f0 = 12.5e6;
+    double f1 = f0 + 10.0e3;
+    double r, ph, err, ymax;
+    long double d, re, im, a, c;
+    int k, res;
+
+    x = (complex_t*) malloc(NL * sizeof(complex_t));
+    y = (complex_t*) malloc(ML * sizeof(complex_t));
+    if(!x || !y)
+    {
+        res = ERROR_MALLOC;
+        goto exit_label;
+    }
+
+    r = floor((f0 + 4321.0) / fs * 1073741824.0) / 1073741824.0;
+    for(k = 0; k < NL; k++)
+    {
+        ph = (double)k * r;
+        ph -= floor(ph);
+        RE(x[k]) = cos(M_2PI * ph);
+        IM(x[k]) = sin(M_2PI * ph);
+    }
+
+    res = zoom_fft(x, NL, f0, f1, fs, ML, &czt, y);
+    if(res != RES_OK)
+        goto exit_label;
+
+    /* Y(k) = (1 - exp(j 2 pi d NL)) / (1 - exp(j 2 pi d)),
+       d = r - f(k) / fs                                    */
+    err = ymax = 0.0;
+    for(k = 0; k < ML; k++)
+    {
+        d  = (long double)r - ((long double)f0 + (long double)k *
+             ((long double)f1 - (long double)f0) / (long double)(ML-1)) /
+             (long double)fs;
+        a  = 3.14159265358979323846264338327950288L * d;
+        /* |Y| = sin(pi d NL) / sin(pi d),  arg(Y) = pi d (NL-1) */
+        c  = sinl(a * (long double)NL) / sinl(a);
+        re = c * cosl(a * (long double)(NL - 1));
+        im = c * sinl(a * (long double)(NL - 1));
+        ph = (double)fabsl(c);
+        if(ph > ymax)
+            ymax = ph;
+        ph = fabs(RE(y[k]) - (double)re) + fabs(IM(y[k]) - (double)im);
+        if(ph > err)
+            err = ph;
+    }
+    printf("\nzoom_fft  n = %d  fs = %.0f Hz  band = %.0f ... %.0f Hz\n",
+           NL, fs, f0, f1);
+    printf("relative error = %.3e\n", err / ymax);
+
+exit_label:
+    czt_free(&czt);
+    if(x)
+        free(x);
+    if(y)
+        free(y);
+    return res;
+}
+
+
+int main()
+{
+    void* handle;           /* DSPL handle              */
+    handle = dspl_load();   /* Load libdspl             */
+    complex_t x[N];         /* Input signal array       */
+    complex_t y[M];         /* Zoom FFT spectrum        */
+    czt_t czt = {0};        /* CZT object (fill zeros)  */
+    double fs = 1000.0;     /* Sample rate, Hz          */
+    double f0 = 120.0;      /* Band start frequency, Hz */
+    double f1 = 125.0;      /* Band stop frequency, Hz  */
+    int k;
+
+    /* Fill input signal x[k] = exp(j 2 pi 123.5 k / fs) */
+    for(k = 0; k < N; k++)
+    {
+        RE(x[k]) = cos(M_2PI * 123.5 * (double)k / fs);
+        IM(x[k]) = sin(M_2PI * 123.5 * (double)k / fs);
+    }
+
+    /* M spectrum samples from f0 to f1 (0.5 Hz step)   */
+    zoom_fft(x, N, f0, f1, fs, M, &czt, y);
+
+    /* print result                                     */
+    for(k = 0; k < M; k++)
+        printf("f = %6.2f Hz    |Y| = %9.3f\n",
+               f0 + (double)k * (f1 - f0) / (double)(M-1), ABS(y[k]));
+
+    /* 10 kHz band of the 4M samples signal at 50 MHz   */
+    zoom_fft_long_err();
+
+    czt_free(&czt);         /* Clear czt_t object       */
+    dspl_free(handle);      /* Clear DSPL handle        */
+    return 0;
+}
@@ -87,6 +87,37 @@ typedef double complex_t[2];
 
 
 
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup TYPES_GROUP
+\typedef complexf_t
+\brief Single precision complex data type.
+
+Complex number as an array of two `float` elements:
+the real part and the imaginary part. \n
+The type is used by the single precision FFT functions
+(\ref fftf_cmplx, \ref ifftf_cmplx, \ref fftf).
+Macros \ref RE and \ref IM can be used for `complexf_t` variables.
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup TYPES_GROUP
+\typedef complexf_t
+\brief Комплексный тип данных одинарной точности.
+
+Комплексное число в виде массива из двух элементов типа `float`:
+реальной и мнимой части. \n
+Тип используется функциями БПФ одинарной точности
+(\ref fftf_cmplx, \ref ifftf_cmplx, \ref fftf).
+Для переменных типа `complexf_t` могут использоваться
+макросы \ref RE и \ref IM.
+***************************************************************************** */
+#endif
+typedef float complexf_t[2];
+
+
+
 /* Point 2D point2d_t[0] - x
             point2d_t[1] - y
 */
@@ -107,62 +138,311 @@ typedef struct
 
 
 
+/* FFT schedule stage (library internal data) */
+typedef struct fft_stage_s fft_stage_t;
+
+/* FFT worker threads pool (library internal data) */
+typedef struct fft_pool_s fft_pool_t;
+
+/* Single precision FFT schedule stage (library internal data) */
+typedef struct fftf_stage_s fftf_stage_t;
 
 #ifdef DOXYGEN_ENGLISH
 /*! ****************************************************************************
 \ingroup DFT_GROUP
-\struct fft_t
-\brief Fast Fourier Transform Object Data Structure
+\struct fft_plan_t
+\brief Fast Fourier Transform plan data structure
 
-The structure stores pointers to twiddle factors and arrays of intermediate
-data of the fast Fourier transform algorithm.
+The structure stores the FFT twiddle factors calculated for the
+FFT size `n`. The plan is read-only during the FFT calculation,
+so one plan can be shared by several \ref fft_t objects
+(for example by several worker threads) without locking.
 
 The libdspl-2.0 library uses an FFT algorithm for composite size.
 
-\param  n
-The size of the FFT vector for which memory is allocated
-in the structure arrays.  \n
-The parameter `n` must be equal to an integer power of two (radix 2). \n \n
-
 \param  w
 Pointer to the vector of twiddle factors. \n
-The size of the vector is `[n x 1]`. \n
 The memory must be allocated and an array of twiddle factors
-must be filled with the \ref fft_create function. \n\n
+must be filled with the \ref fft_plan_create function. \n\n
+
+\param  wr
+Pointer to the vector of the real FFT split twiddle factors
+\f$ W_{2n}^{k} = \exp(-j \pi k / n) \f$, \f$ k = 0 \ldots n/2 \f$. \n
+The size of the vector is `[n/2+1 x 1]`. \n
+These twiddle factors are used for the `2n`-points FFT
+of a real signal which is calculated by the `n`-points complex FFT
+(see \ref fft_r2c function). \n
+The memory must be allocated and the vector must be filled
+with the \ref fft_plan_create function. \n\n
 
-\param  t0
-Pointer to the vector of intermediate results of the FFT algorithm. \n
-The size of the vector is `[n x 1]`. \n
-Memory must be allocated by \ref fft_create function. \n\n
+\param w32
+Static twiddle factors vector for 32-points FFT. \n \n
 
-\param  t1
-Pointer to the vector of intermediate results. \n
-The size of the vector is `[n x 1]`. \n
-The memory must be allocated with the \ref fft_create function. \n\n
+\param w64
+Static twiddle factors vector for 64-points FFT. \n \n
+
+\param w128
+Static twiddle factors vector for 128-points FFT. \n \n
+
+\param w256
+Static twiddle factors vector for 256-points FFT. \n \n
+
+\param w512
+Static twiddle factors vector for 512-points FFT. \n \n
+
+\param w1024
+Dynamic twiddle factors vector for 1024-points FFT. \n \n
+
+\param w2048
+Dynamic twiddle factors vector for 2048-points FFT. \n \n
+
+\param w4096
+Dynamic twiddle factors vector for 4096-points FFT. \n \n
+
+\param  n
+FFT size. \n \n
+
+\param  nb
+Bluestein algorithm FFT size. \n
+Bluestein algorithm is used if the FFT size `n` contains
+a prime factor greater than 32. Then the prime factor FFT
+is calculated as a convolution by the power of two FFT size `nb`. \n
+`nb = 0` if the Bluestein algorithm is not required. \n \n
+
+\param  isa
+FFT codelets instruction set (see \ref fft_set_isa). \n
+The instruction set is selected once by the \ref fft_plan_create 
+function. \n
+If `isa` is not `FFT_ISA_SCALAR` then the plan uses the vector codelets
+of radix 2, 3, 4, 5, 7, 8 and 16 which read the strided stage data 
+without the intermediate transposition. \n \n
+
+\param  st
+Pointer to the FFT execution schedule. \n
+The FFT size factorization, the radix codelets and the twiddle factors
+offsets of each FFT stage are calculated once by the 
+\ref fft_plan_create function, so the FFT functions execute 
+the stages without the size factorization. \n
+The schedule is the library internal data. \n \n
+
+\param  nst
+Number of the FFT schedule stages. \n \n
+
+The plan is filled by the \ref fft_plan_create function
+and must be cleared by the \ref fft_plan_free function
+after all \ref fft_t objects bound to the plan are cleared.
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct fft_plan_t
+\brief Структура данных плана быстрого преобразования Фурье
+
+Структура хранит поворотные коэффициенты БПФ, рассчитанные для
+размера БПФ `n`. План не изменяется в процессе расчета БПФ,
+поэтому один план может совместно использоваться несколькими
+объектами \ref fft_t (например несколькими рабочими потоками)
+без блокировок.
+
+Библиотека libdspl-2.0 использует для БПФ алгоритм для составной длины
+
+\param  w
+Указатель на вектор поворотных коэффициентов алгоритма БПФ. \n
+Память должна быть выделена и массив поворотных коэффициентов
+должен быть заполнен функцией \ref fft_plan_create.  \n \n
+
+\param  wr
+Указатель на вектор поворотных коэффициентов 
+\f$ W_{2n}^{k} = \exp(-j \pi k / n) \f$, \f$ k = 0 \ldots n/2 \f$,
+используемых при расчете `2n`-точечного БПФ вещественного сигнала 
+посредством `n`-точечного комплексного БПФ (см. функцию \ref fft_r2c). \n
+Размер вектора `[n/2+1 x 1]`. \n
+Память должна быть выделена и вектор 
+должен быть заполнен функцией \ref fft_plan_create. \n \n
 
 \param w32
-Static twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 32-точечного БПФ. \n \n
 
 \param w64
-Static twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 64-точечного БПФ. \n \n
 
 \param w128
-Static twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 128-точечного БПФ. \n \n
 
 \param w256
-Static twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 256-точечного БПФ. \n \n
 
 \param w512
-Static twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 512-точечного БПФ. \n \n
 
 \param w1024
-Dynamic twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 1024-точечного БПФ. \n \n
 
 \param w2048
-Dynamic twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 2048-точечного БПФ. \n \n
 
 \param w4096
-Dynamic twiddle factors vector for 32-points FFT. \n \n
+Статический вектор поворотных коэффициентов 4096-точечного БПФ. \n \n
+
+\param  n
+Размер БПФ. \n \n
+
+\param  nb
+Размер БПФ алгоритма Блюстейна. \n
+Алгоритм Блюстейна используется, если размер БПФ `n` содержит
+простой множитель больше 32. При этом БПФ по простому множителю
+рассчитывается как свертка при помощи БПФ размера `nb`,
+равного целой степени двойки. \n
+`nb = 0` если алгоритм Блюстейна не требуется. \n \n
+
+\param  isa
+Набор инструкций ядер БПФ (см. \ref fft_set_isa). \n
+Набор инструкций выбирается один раз функцией \ref fft_plan_create. \n
+Если `isa` не равен `FFT_ISA_SCALAR`, то план использует векторные
+ядра по основанию 2, 3, 4, 5, 7, 8 и 16, которые читают данные 
+ступени БПФ с шагом без промежуточного транспонирования. \n \n
+
+\param  st
+Указатель на расписание выполнения БПФ. \n
+Разложение размера БПФ на множители, ядра БПФ по основанию
+и смещения поворотных коэффициентов каждой ступени БПФ 
+рассчитываются один раз функцией \ref fft_plan_create, 
+поэтому функции БПФ выполняют ступени без разложения 
+размера на множители. \n
+Расписание является внутренними данными библиотеки. \n \n
+
+\param  nst
+Количество ступеней расписания БПФ. \n \n
+
+План заполняется функцией \ref fft_plan_create и должен быть
+очищен функцией \ref fft_plan_free после очистки всех объектов
+\ref fft_t, использующих данный план.
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    complex_t*  w;
+    complex_t*  wr;
+   
+    /* radix-2 twiddle factors vectors */
+    complex_t    w32[ 32];
+    complex_t    w64[ 64];
+    complex_t   w128[128];
+    complex_t   w256[256];
+    complex_t   w512[512];
+    complex_t*  w1024;
+    complex_t*  w2048;
+    complex_t*  w4096;
+    int         n;
+    int         nb;
+    int         isa;
+
+    /* FFT execution schedule */
+    fft_stage_t* st;
+    int          nst;
+} fft_plan_t;
+
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct fft_t
+\brief Fast Fourier Transform Object Data Structure
+
+The structure stores the pointer to the FFT plan \ref fft_plan_t
+and arrays of intermediate data (workspace) of the fast
+Fourier transform algorithm.
+
+\param  plan
+Pointer to the FFT plan. \n
+The plan is created by the \ref fft_create function 
+(own plan of the object), or an external plan 
+is bound by the \ref fft_bind function (shared plan). \n \n
+
+\param  t0
+Pointer to the vector of intermediate results of the FFT algorithm. \n
+The size of the vector is `[n x 1]`. \n
+Memory must be allocated by \ref fft_create function. \n\n
+
+\param  t1
+Pointer to the vector of intermediate results. \n
+The size of the vector is `[n x 1]`. \n
+The memory must be allocated with the \ref fft_create function. \n\n
+
+\param  tb
+Pointer to the Bluestein algorithm intermediate vector. \n
+The size of the vector is `[2*nb*nthreads x 1]`, 
+here `nb` is the Bluestein FFT size of the plan. \n
+The memory is allocated by the \ref fft_create function
+(`NULL` if the Bluestein algorithm is not required). \n\n
+
+\param  n
+The size of the FFT vector for which memory is allocated
+in the structure arrays.  \n \n
+
+\param  nt
+The size of the `t0` and `t1` vectors. \n
+`nt` can be greater than `n` if the object was used 
+by the batch FFT functions (see \ref fft_cmplx_batch). \n \n
+
+\param  own
+Plan ownership flag. \n
+If `own` is equal to 1 the plan was created by the \ref fft_create function
+and it is cleared by the \ref fft_free function. \n
+If `own` is equal to 2 the plan is taken from the process-wide plan cache
+(see \ref fft_cache_set_size) and it is released by 
+the \ref fft_free function. \n
+Shared plan bound by the \ref fft_bind function is not cleared. \n \n
+
+\param  nthreads
+Number of threads of the FFT calculation. \n
+Zero or one means the single thread FFT. \n
+The value is set by the \ref fft_set_threads function. \n \n
+
+\param  pool
+Pointer to the worker threads pool (library internal data). \n
+The pool is created by the \ref fft_set_threads function
+and it is cleared by the \ref fft_free function. \n \n
+
+\param  wd
+Pointer to the twiddle factors of the cosine and sine transforms 
+(see \ref dct2). \n
+The vector is allocated by the first DCT or DST call 
+and it is cleared by the \ref fft_free function. \n \n
+
+\param  nd
+The DCT and DST size of the `wd` twiddle factors. \n \n
+
+\param  wp
+Pointer to the twiddle factors of the pruned FFT 
+(see \ref fft_cmplx_pruned). \n
+The vector is allocated by the first pruned FFT call 
+and it is cleared by the \ref fft_free function. \n \n
+
+\param  np
+The pruned FFT size of the `wp` twiddle factors. \n \n
+
+\param  half
+Pointer to the `n/2`-points FFT plan of the even size `n` real FFT
+(see \ref fft, \ref fft_r2c and \ref ifft). \n
+The plan is kept next to the `plan` pointer, so the real and 
+the complex FFT of the same size calculated by one object
+do not re-plan the object. \n
+The plan is taken from the plan cache (or created if the cache
+is disabled) by the first real FFT call and it is released
+by the \ref fft_free function. \n \n
+
+\param  hown
+Ownership flag of the `half` plan (the same values as `own`). \n \n
 
 The structure is calculated with the \ref fft_create function once
 before using the FFT algorithm. \n
@@ -190,6 +470,26 @@ err = fft_create(&pfft, n);
 fft_free(&pfft);
 \endcode
 
+Several threads can calculate the FFT of the same size
+with one shared plan. Each thread needs own `fft_t` object
+bound to the plan by \ref fft_bind function:
+
+\code
+fft_plan_t plan = {0};  // shared FFT plan
+fft_t pfft[2] = {0};    // per-thread workspaces
+
+fft_plan_create(&plan, n);
+fft_bind(pfft,   &plan);
+fft_bind(pfft+1, &plan);
+
+// thread 0: fft_cmplx(x0, n, pfft,   y0);
+// thread 1: fft_cmplx(x1, n, pfft+1, y1);
+
+fft_free(pfft);
+fft_free(pfft+1);
+fft_plan_free(&plan);
+\endcode
+
 \note
 It is important to note that if the object `fft_t` was created for the FFT size
 equal to` n`, it can only be used for FFT of size `n`. \n \n
@@ -198,6 +498,8 @@ and independently allocate the memory of the FFT object, if necessary.
 So if you call any function using the `fft_t` structure with filled
 data for the FFT length `k` for calculating the FFT of length`n`,
 then the structure arrays will be automatically recreated for the length `n`.
+The shared plan is not changed in this case: the object creates 
+own plan for the length `n`.
 
 \author  Sergey Bakhurin  www.dsplib.org
 ***************************************************************************** */
@@ -208,20 +510,15 @@ then the structure arrays will be automatically recreated for the length `n`.
 \struct fft_t
 \brief Структура данных объекта быстрого преобразования Фурье
 
-Структура хранит указатели на массивы поворотных коэффициентов
-и массивы промежуточных данных алгоритма быстрого преобразования Фурье.
-
-Библиотека libdspl-2.0 использует для БПФ алгоритм для составной длины
-
-\param  n
-Размер вектора БПФ, для которого выделена память в массивах структуры.  \n
-Парметр `n` должен быть равен целой степени двойки. \n \n
+Структура хранит указатель на план БПФ \ref fft_plan_t
+и массивы промежуточных данных (рабочую память) 
+алгоритма быстрого преобразования Фурье.
 
-\param  w
-Указатель на вектор поворотных коэффициентов алгоритма БПФ. \n
-Размер вектора `[n x 1]`.  \n
-Память должна быть выделена и массив поворотных коэффициентов
-должен быть заполнен функцией \ref fft_create.  \n \n
+\param  plan
+Указатель на план БПФ. \n
+План создается функцией \ref fft_create (собственный план объекта),
+или внешний план подключается функцией \ref fft_bind 
+(совместно используемый план). \n \n
 
 \param  t0
 Указатель на вектор промежуточных вычислений алгоритма БПФ. \n
@@ -233,62 +530,1140 @@ then the structure arrays will be automatically recreated for the length `n`.
 Размер вектора `[n x 1]`. \n
 Память должна быть выделена функцией \ref fft_create. \n \n
 
-\param w32
-Статический вектор поворотных коэффициентов 32-точечного БПФ. \n \n
+\param  tb
+Указатель на вектор промежуточных вычислений алгоритма Блюстейна. \n
+Размер вектора `[2*nb*nthreads x 1]`, где `nb` -- размер БПФ 
+алгоритма Блюстейна плана. \n
+Память выделяется функцией \ref fft_create
+(`NULL` если алгоритм Блюстейна не требуется). \n \n
+
+\param  n
+Размер вектора БПФ, для которого выделена память в массивах структуры.  \n \n
+
+\param  nt
+Размер векторов `t0` и `t1`. \n
+`nt` может превышать `n`, если объект использовался 
+функциями пакетного БПФ (см. \ref fft_cmplx_batch). \n \n
+
+\param  own
+Флаг владения планом. \n
+Если `own` равен 1, то план создан функцией \ref fft_create
+и очищается функцией \ref fft_free. \n
+Если `own` равен 2, то план получен из общего кэша планов процесса
+(см. \ref fft_cache_set_size) и освобождается функцией \ref fft_free. \n
+Совместно используемый план, подключенный функцией \ref fft_bind,
+не очищается. \n \n
+
+\param  nthreads
+Количество потоков расчета БПФ. \n
+Ноль или единица означают однопоточный расчет БПФ. \n
+Значение задается функцией \ref fft_set_threads. \n \n
+
+\param  pool
+Указатель на пул рабочих потоков (внутренние данные библиотеки). \n
+Пул создается функцией \ref fft_set_threads
+и очищается функцией \ref fft_free. \n \n
+
+\param  wd
+Указатель на поворотные коэффициенты косинусных и синусных 
+преобразований (см. \ref dct2). \n
+Память выделяется при первом вызове функции ДКП или ДСП
+и очищается функцией \ref fft_free. \n \n
+
+\param  nd
+Размер ДКП и ДСП, для которого рассчитаны коэффициенты `wd`. \n \n
+
+\param  wp
+Указатель на поворотные коэффициенты усеченного БПФ 
+(см. \ref fft_cmplx_pruned). \n
+Память выделяется при первом вызове функции усеченного БПФ
+и очищается функцией \ref fft_free. \n \n
+
+\param  np
+Размер усеченного БПФ, для которого рассчитаны коэффициенты `wp`. \n \n
+
+\param  half
+Указатель на план `n/2`-точечного БПФ, используемого при расчете 
+БПФ вещественного сигнала четного размера `n` 
+(см. \ref fft, \ref fft_r2c и \ref ifft). \n
+План хранится отдельно от указателя `plan`, поэтому 
+БПФ вещественного и комплексного сигналов одного размера, 
+рассчитываемые одним объектом, не пересоздают план объекта. \n
+План берется из кэша планов (или создается, если кэш отключен) 
+при первом вызове БПФ вещественного сигнала и освобождается 
+функцией \ref fft_free. \n \n
+
+\param  hown
+Флаг владения планом `half` (значения аналогичны `own`). \n \n
+
+Структура заполняется функцией \ref fft_create один раз
+до использования алгоритма БПФ.  \n
+Указатель на объект данной структуры может быть
+многократно использован при вызове функций БПФ. \n
+Перед выходом из программы выделенную память под поворотные
+коэффициенты и массивы промежуточных данных
+необходимо очистить функцией \ref fft_free. Например:
+\code
+fft_t pfft = {0};     // объявляем объект fft_t и обнуляем все поля
+int n = 64;           // Размер БПФ
+int err;
+
+// создаем объект для 64-точечного БПФ
+err = fft_create(&pfft, n);
+
+// Вызов БПФ функции
+// Еще раз вызов БПФ функции
+// ...
+
+// очистить память объекта БПФ
+fft_free(&pfft);
+\endcode
+
+Несколько потоков могут рассчитывать БПФ одного размера
+при помощи одного совместно используемого плана. 
+Каждому потоку необходим собственный объект `fft_t`,
+подключенный к плану функцией \ref fft_bind:
+
+\code
+fft_plan_t plan = {0};  // общий план БПФ
+fft_t pfft[2] = {0};    // рабочая память потоков
+
+fft_plan_create(&plan, n);
+fft_bind(pfft,   &plan);
+fft_bind(pfft+1, &plan);
+
+// поток 0: fft_cmplx(x0, n, pfft,   y0);
+// поток 1: fft_cmplx(x1, n, pfft+1, y1);
+
+fft_free(pfft);
+fft_free(pfft+1);
+fft_plan_free(&plan);
+\endcode
+
+\note
+Важно отметить, что если объект `fft_t` был создан для размера БПФ равного `n`,
+то он может быть использован только для БПФ размера `n`.  \n\n
+Также необходимо заметить, что функции БПФ самостоятельно контролируют размер,
+и самостоятельно выделяют память объекта БПФ при необходимости.
+Так если вызвать любую функцию использующую структуру `fft_t` с заполненными
+данными для длины БПФ `k` для расчета БПФ длины `n`,
+то массивы структуры будут автоматически пересозданы для длины `n`.
+Совместно используемый план при этом не изменяется: объект 
+создает собственный план для длины `n`.
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    fft_plan_t* plan;
+    complex_t*  t0;
+    complex_t*  t1;
+    complex_t*  tb;
+    int         n;
+    int         nt;
+    int         own;
+    int         nthreads;
+    fft_pool_t* pool;
+    complex_t*  wd;
+    int         nd;
+    complex_t*  wp;
+    int         np;
+    fft_plan_t* half;
+    int         hown;
+} fft_t;
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct fftf_t
+\brief Single precision FFT object data structure
+
+The structure stores the single precision FFT plan (stages schedule
+and twiddle factors) and the workspace vectors. \n
+The plan uses the vector codelets of the instruction set
+selected by the \ref fft_set_isa function. A vector of the same
+width holds twice more `float` values than `double` values,
+and the FFT working set is twice less than the
+\ref fft_t object working set.
+
+\param  w
+Pointer to the twiddle factors vector of the plan. \n \n
+
+\param  wr
+Pointer to the real FFT spectrum separation twiddle factors. \n
+Vector size is `[n/2+1 x 1]`. \n \n
+
+\param  t0
+Pointer to the FFT workspace vector. \n
+Vector size is `[n x 1]`. \n \n
+
+\param  t1
+Pointer to the FFT workspace vector. \n
+Vector size is `[n x 1]`. \n \n
+
+\param  tb
+Pointer to the Bluestein algorithm workspace vector. \n
+Vector size is `[2*nb x 1]` (`NULL` if the Bluestein algorithm
+is not required). \n \n
+
+\param  st
+Pointer to the FFT stages schedule (library internal data). \n \n
+
+\param  n
+FFT size. \n \n
+
+\param  nst
+Number of the schedule stages. \n \n
+
+\param  nb
+Bluestein algorithm FFT size (zero if the Bluestein algorithm
+is not required). \n \n
+
+\param  isa
+Instruction set of the plan codelets (see \ref fft_set_isa). \n \n
+
+The structure is filled by the \ref fftf_create function
+and it must be cleared by the \ref fftf_free function:
+\code
+fftf_t pfft = {0};     // single precision FFT object
+int n = 4096;          // FFT size
+
+fftf_cmplx(x, n, &pfft, y);
+
+fftf_free(&pfft);
+\endcode
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct fftf_t
+\brief Структура данных объекта БПФ одинарной точности
+
+Структура хранит план БПФ одинарной точности (расписание этапов
+и поворотные коэффициенты) и векторы рабочей памяти. \n
+План использует векторные ядра набора инструкций,
+выбранного функцией \ref fft_set_isa. Вектор той же разрядности
+содержит вдвое больше значений `float`, чем значений `double`,
+а рабочая память БПФ вдвое меньше рабочей памяти
+объекта \ref fft_t.
+
+\param  w
+Указатель на вектор поворотных коэффициентов плана. \n \n
+
+\param  wr
+Указатель на поворотные коэффициенты разделения спектра
+вещественного БПФ. \n
+Размер вектора `[n/2+1 x 1]`. \n \n
+
+\param  t0
+Указатель на вектор рабочей памяти БПФ. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param  t1
+Указатель на вектор рабочей памяти БПФ. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param  tb
+Указатель на вектор рабочей памяти алгоритма Блюстейна. \n
+Размер вектора `[2*nb x 1]` (`NULL` если алгоритм Блюстейна
+не требуется). \n \n
+
+\param  st
+Указатель на расписание этапов БПФ
+(внутренние данные библиотеки). \n \n
+
+\param  n
+Размер БПФ. \n \n
+
+\param  nst
+Количество этапов расписания. \n \n
+
+\param  nb
+Размер БПФ алгоритма Блюстейна (ноль если алгоритм Блюстейна
+не требуется). \n \n
+
+\param  isa
+Набор инструкций ядер плана (см. \ref fft_set_isa). \n \n
+
+Структура заполняется функцией \ref fftf_create
+и должна быть очищена функцией \ref fftf_free:
+\code
+fftf_t pfft = {0};     // объект БПФ одинарной точности
+int n = 4096;          // размер БПФ
+
+fftf_cmplx(x, n, &pfft, y);
+
+fftf_free(&pfft);
+\endcode
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    complexf_t*   w;
+    complexf_t*   wr;
+    complexf_t*   t0;
+    complexf_t*   t1;
+    complexf_t*   tb;
+    fftf_stage_t* st;
+    int           n;
+    int           nst;
+    int           nb;
+    int           isa;
+} fftf_t;
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct czt_t
+\brief Chirp Z-transform object data structure
+
+The structure stores the precomputed chirp vectors and the FFT object
+of the `n`-points input to `m`-points output chirp Z-transform
+(see \ref czt_cmplx). \n
+The chirp vectors depend on the transform sizes and the contour only,
+so one object calculates the CZT of any number of the signal frames.
+
+\param  wn
+Pointer to the input chirp \f$ A^{-k} W^{k^2/2} \f$. \n
+Vector size is `[n x 1]`. \n \n
+
+\param  wm
+Pointer to the output chirp \f$ W^{k^2/2} \f$. \n
+Vector size is `[m x 1]`. \n \n
+
+\param  h
+Pointer to the `l`-points FFT of the chirp filter
+\f$ W^{-k^2/2} \f$ scaled by \f$ 1/l \f$. \n
+Vector size is `[l x 1]`. \n \n
+
+\param  t
+Pointer to the workspace vector. \n
+Vector size is `[l x 1]`. \n \n
+
+\param  a
+Contour start point \f$ A \f$. \n \n
+
+\param  w
+Contour points ratio \f$ W \f$. \n \n
+
+\param  fa
+Angle of \f$ A \f$ in cycles `fa[0] + fa[1]`
+(double-double number). \n \n
+
+\param  fw
+Angle of \f$ W \f$ in cycles `fw[0] + fw[1]`
+(double-double number). \n \n
+
+\param  fft
+`l`-points FFT object. \n \n
+
+\param  n
+Input signal size. \n \n
+
+\param  m
+Number of the output contour points. \n \n
+
+\param  l
+FFT size \f$ l \geq n + m - 1 \f$. \n \n
+
+The structure is filled by the \ref czt_create function
+(or by the \ref zoom_fft function)
+and it must be cleared by the \ref czt_free function:
+\code
+czt_t czt = {0};
+
+czt_create(&czt, n, m, w, a);
+
+czt_cmplx(x0, &czt, y0);
+czt_cmplx(x1, &czt, y1);
+
+czt_free(&czt);
+\endcode
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct czt_t
+\brief Структура данных объекта ЛЧМ Z-преобразования
+
+Структура хранит заранее рассчитанные ЛЧМ векторы и объект БПФ
+ЛЧМ Z-преобразования `n` отсчетов входного сигнала в `m` точек
+контура (см. \ref czt_cmplx). \n
+ЛЧМ векторы зависят только от размеров преобразования и контура,
+поэтому один объект рассчитывает ЛЧМ Z-преобразование
+любого количества кадров сигнала.
+
+\param  wn
+Указатель на входной ЛЧМ вектор \f$ A^{-k} W^{k^2/2} \f$. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param  wm
+Указатель на выходной ЛЧМ вектор \f$ W^{k^2/2} \f$. \n
+Размер вектора `[m x 1]`. \n \n
+
+\param  h
+Указатель на `l`-точечное БПФ ЛЧМ фильтра
+\f$ W^{-k^2/2} \f$, умноженное на \f$ 1/l \f$. \n
+Размер вектора `[l x 1]`. \n \n
+
+\param  t
+Указатель на вектор рабочей памяти. \n
+Размер вектора `[l x 1]`. \n \n
+
+\param  a
+Начальная точка контура \f$ A \f$. \n \n
+
+\param  w
+Отношение соседних точек контура \f$ W \f$. \n \n
+
+\param  fa
+Угол \f$ A \f$ в периодах `fa[0] + fa[1]`
+(число двойной-двойной точности). \n \n
+
+\param  fw
+Угол \f$ W \f$ в периодах `fw[0] + fw[1]`
+(число двойной-двойной точности). \n \n
+
+\param  fft
+Объект `l`-точечного БПФ. \n \n
+
+\param  n
+Размер входного сигнала. \n \n
+
+\param  m
+Количество точек контура. \n \n
+
+\param  l
+Размер БПФ \f$ l \geq n + m - 1 \f$. \n \n
+
+Структура заполняется функцией \ref czt_create
+(или функцией \ref zoom_fft)
+и должна быть очищена функцией \ref czt_free:
+\code
+czt_t czt = {0};
+
+czt_create(&czt, n, m, w, a);
+
+czt_cmplx(x0, &czt, y0);
+czt_cmplx(x1, &czt, y1);
+
+czt_free(&czt);
+\endcode
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    complex_t*  wn;
+    complex_t*  wm;
+    complex_t*  h;
+    complex_t*  t;
+    complex_t   a;
+    complex_t   w;
+    double      fa[2];
+    double      fw[2];
+    fft_t       fft;
+    int         n;
+    int         m;
+    int         l;
+} czt_t;
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct goertzel_t
+\brief Multi-bin Goertzel algorithm object data structure
+
+The structure stores the precomputed coefficients and the resonators
+states of the `k` bins of the `n`-points DFT calculated by the
+Goertzel algorithm (see \ref goertzel_update). \n
+The resonators states are stored as the separate vectors, so all
+the bins are updated by one pass of the input signal.
+
+\param  a
+Pointer to the resonators coefficients
+\f$ 2\cos(2\pi \cdot ind(i) / n) \f$. \n
+Vector size is `[kp x 1]`, where `kp` is `k` rounded up to the multiple
+of 16 (the extra resonators have zero coefficients). \n \n
+
+\param  w
+Pointer to the output twiddle factors
+\f$ \exp(j 2\pi \cdot ind(i) / n) \f$. \n
+Vector size is `[k x 1]`. \n \n
+
+\param  s
+Pointer to the resonators states. \n
+Vector size is `[4kp x 1]`: the real parts of the last and the previous
+states and then the imaginary parts of the last and the previous states. \n \n
+
+\param  ind
+Pointer to the bins indexes (modulo `n`). \n
+Vector size is `[k x 1]`. \n \n
+
+\param  n
+DFT size. \n \n
+
+\param  k
+Number of the bins. \n \n
+
+\param  pos
+Number of the samples pushed since the last reset (modulo `n`). \n \n
+
+The structure is filled by the \ref goertzel_create function
+and it must be cleared by the \ref goertzel_free function.
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct goertzel_t
+\brief Структура данных объекта алгоритма Гёрцеля для нескольких отсчетов
+
+Структура хранит заранее рассчитанные коэффициенты и состояния
+резонаторов `k` отсчетов `n`-точечного ДПФ, рассчитываемых
+алгоритмом Гёрцеля (см. \ref goertzel_update). \n
+Состояния резонаторов хранятся в отдельных векторах, поэтому
+все отсчеты ДПФ обновляются за один проход входного сигнала.
+
+\param  a
+Указатель на коэффициенты резонаторов
+\f$ 2\cos(2\pi \cdot ind(i) / n) \f$. \n
+Размер вектора `[kp x 1]`, где `kp` --- `k`, округленное вверх
+до кратного 16 (дополнительные резонаторы имеют нулевые
+коэффициенты). \n \n
+
+\param  w
+Указатель на выходные поворотные коэффициенты
+\f$ \exp(j 2\pi \cdot ind(i) / n) \f$. \n
+Размер вектора `[k x 1]`. \n \n
+
+\param  s
+Указатель на состояния резонаторов. \n
+Размер вектора `[4kp x 1]`: реальные части последнего и предыдущего
+состояний, затем мнимые части последнего и предыдущего состояний. \n \n
+
+\param  ind
+Указатель на индексы отсчетов ДПФ (по модулю `n`). \n
+Размер вектора `[k x 1]`. \n \n
+
+\param  n
+Размер ДПФ. \n \n
+
+\param  k
+Количество отсчетов ДПФ. \n \n
+
+\param  pos
+Количество отсчетов сигнала, поступивших после последнего сброса
+(по модулю `n`). \n \n
+
+Структура заполняется функцией \ref goertzel_create
+и должна быть очищена функцией \ref goertzel_free.
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    double*     a;
+    complex_t*  w;
+    double*     s;
+    int*        ind;
+    int         n;
+    int         k;
+    int         pos;
+} goertzel_t;
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct sdft_t
+\brief Sliding DFT object data structure
+
+The structure stores the state of the sliding DFT (see \ref sdft_push):
+the last `n` input samples and the current `n`-points DFT bins
+of the sliding window.
+
+\param  x
+Pointer to the circular buffer of the last `n` input samples. \n
+Vector size is `[n x 1]`. \n \n
+
+\param  s
+Pointer to the current DFT bins of the window. \n
+Vector size is `[k x 1]`. \n \n
+
+\param  w
+Pointer to the bins update twiddle factors
+\f$ \exp(j 2\pi \cdot ind(i) / n) \f$. \n
+Vector size is `[k x 1]`. \n \n
+
+\param  t
+Pointer to the re-anchoring workspace vector. \n
+Vector size is `[n x 1]`. \n \n
+
+\param  ind
+Pointer to the DFT bins indexes
+(`NULL` if all `n` bins are tracked). \n
+Vector size is `[k x 1]`. \n \n
+
+\param  fft
+FFT object of the re-anchoring by the FFT. \n \n
+
+\param  g
+Goertzel algorithm object of the tracked bins re-anchoring
+(see \ref goertzel_update). It is not created if the bins
+are re-anchored by the FFT. \n \n
+
+\param  n
+Sliding window size (DFT size). \n \n
+
+\param  k
+Number of the tracked bins. \n \n
+
+\param  pos
+Index of the oldest sample in the buffer `x`. \n \n
+
+\param  cnt
+Number of the samples pushed since the last re-anchoring. \n \n
+
+\param  nr
+Re-anchoring period (samples). \n \n
+
+The structure is filled by the \ref sdft_create function
+and it must be cleared by the \ref sdft_free function.
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct sdft_t
+\brief Структура данных объекта скользящего ДПФ
+
+Структура хранит состояние скользящего ДПФ (см. \ref sdft_push):
+последние `n` отсчетов входного сигнала и текущие отсчеты
+`n`-точечного ДПФ скользящего окна.
+
+\param  x
+Указатель на кольцевой буфер последних `n` входных отсчетов. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param  s
+Указатель на текущие отсчеты ДПФ окна. \n
+Размер вектора `[k x 1]`. \n \n
+
+\param  w
+Указатель на поворотные коэффициенты обновления отсчетов
+\f$ \exp(j 2\pi \cdot ind(i) / n) \f$. \n
+Размер вектора `[k x 1]`. \n \n
+
+\param  t
+Указатель на рабочую память пересчета. \n
+Размер вектора `[n x 1]`. \n \n
+
+\param  ind
+Указатель на индексы отсчетов ДПФ
+(`NULL` если отслеживаются все `n` отсчетов). \n
+Размер вектора `[k x 1]`. \n \n
+
+\param  fft
+Объект БПФ пересчета отсчетов при помощи БПФ. \n \n
+
+\param  g
+Объект алгоритма Гёрцеля пересчета отслеживаемых отсчетов
+(см. \ref goertzel_update). Не создается, если отсчеты
+пересчитываются при помощи БПФ. \n \n
+
+\param  n
+Размер скользящего окна (размер ДПФ). \n \n
+
+\param  k
+Количество отслеживаемых отсчетов ДПФ. \n \n
+
+\param  pos
+Индекс самого старого отсчета в буфере `x`. \n \n
+
+\param  cnt
+Количество отсчетов, поступивших после последнего пересчета. \n \n
+
+\param  nr
+Период пересчета (отсчетов). \n \n
+
+Структура заполняется функцией \ref sdft_create
+и должна быть очищена функцией \ref sdft_free.
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    complex_t*  x;
+    complex_t*  s;
+    complex_t*  w;
+    complex_t*  t;
+    int*        ind;
+    fft_t       fft;
+    goertzel_t  g;
+    int         n;
+    int         k;
+    int         pos;
+    int         cnt;
+    int         nr;
+} sdft_t;
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct stft_t
+\brief Short-time Fourier transform object data structure
+
+The structure stores the cached window, the FFT object and the workspace
+of the short-time Fourier transform (STFT) of the `nfft`-samples frames
+with the `hop` samples step (see \ref stft),
+and the input stream tail of the streaming STFT (see \ref stft_push).
+
+\param  w
+Pointer to the window. \n
+Vector size is `[nfft x 1]`. \n \n
+
+\param  t
+Pointer to the windowed frames workspace. \n
+Vector size is `[g*nfft x 1]`. \n \n
+
+\param  tc
+Pointer to the frames spectra workspace. \n
+Vector size is `[g*nfft x 1]`. \n \n
+
+\param  buf
+Pointer to the input stream tail. \n
+Vector size is `[nfft x 1]`. \n \n
+
+\param  fft
+`nfft`-points FFT object. \n \n
+
+\param  nfft
+Frame size (FFT size). \n \n
+
+\param  hop
+Frames step (samples). \n \n
+
+\param  g
+Number of the frames of one batched FFT. \n \n
+
+\param  nbuf
+Number of the samples of the input stream tail. \n \n
+
+The structure is filled by the \ref stft_create function
+and it must be cleared by the \ref stft_free function.
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup DFT_GROUP
+\struct stft_t
+\brief Структура данных объекта оконного преобразования Фурье
+
+Структура хранит рассчитанное окно, объект БПФ и рабочую память
+оконного преобразования Фурье кадров по `nfft` отсчетов
+с шагом `hop` отсчетов (см. \ref stft),
+а также остаток входного потока потокового расчета
+(см. \ref stft_push).
+
+\param  w
+Указатель на окно. \n
+Размер вектора `[nfft x 1]`. \n \n
+
+\param  t
+Указатель на рабочую память кадров, умноженных на окно. \n
+Размер вектора `[g*nfft x 1]`. \n \n
+
+\param  tc
+Указатель на рабочую память спектров кадров. \n
+Размер вектора `[g*nfft x 1]`. \n \n
+
+\param  buf
+Указатель на остаток входного потока. \n
+Размер вектора `[nfft x 1]`. \n \n
+
+\param  fft
+Объект `nfft`-точечного БПФ. \n \n
+
+\param  nfft
+Размер кадра (размер БПФ). \n \n
+
+\param  hop
+Шаг кадров (отсчетов). \n \n
+
+\param  g
+Количество кадров одного пакетного БПФ. \n \n
+
+\param  nbuf
+Количество отсчетов остатка входного потока. \n \n
+
+Структура заполняется функцией \ref stft_create
+и должна быть очищена функцией \ref stft_free.
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    double*     w;
+    double*     t;
+    complex_t*  tc;
+    double*     buf;
+    fft_t       fft;
+    int         nfft;
+    int         hop;
+    int         g;
+    int         nbuf;
+} stft_t;
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\struct fir_t
+\brief Streaming FIR filter object data structure
+
+The structure stores the taps, the input history and the workspace
+of the streaming FIR filter (see \ref fir_filter). \n
+The filter with the small number of the taps is calculated directly.
+Else the overlap-save method is used: the blocks of `nfft - nh + 1` 
+new samples and `nh - 1` history samples are transformed by the 
+`nfft`-points real FFT, multiplied by the filter spectrum calculated
+once by \ref fir_create, and transformed back by the real IFFT. \n
+The multichannel filter (see \ref fir_create_multi) is calculated directly,
+the sample `k` of the channel `c` is stored in the `buf[k*nch + c]`.
+
+\param  h
+Pointer to the reversed filter taps. \n
+Vector size is `[nh x 1]`. \n \n
+
+\param  buf
+Pointer to the input buffer: the filter history of `nh - 1` samples
+and the new samples. \n
+Vector size is `[(nh - 1 + FIR_BLOCK) * nch x 1]` for the direct filtering
+(the block size `FIR_BLOCK` is set by the library)
+or `[nfft x 1]` for the FFT filtering. \n \n
+
+\param  t
+Pointer to the IFFT output workspace. \n
+Vector size is `[nfft x 1]`, `NULL` for the direct filtering. \n \n
+
+\param  hf
+Pointer to the filter spectrum. \n
+Vector size is `[nfft/2+1 x 1]`, `NULL` for the direct filtering. \n \n
+
+\param  xf
+Pointer to the input block spectrum workspace. \n
+Vector size is `[nfft/2+1 x 1]`, `NULL` for the direct filtering. \n \n
+
+\param  fft
+`nfft`-points FFT object. \n \n
+
+\param  nh
+Number of the filter taps. \n \n
+
+\param  nfft
+Overlap-save FFT size, zero for the direct filtering. \n \n
+
+\param  nch
+Number of the channels. \n \n
+
+\param  pos
+Number of the new samples of the incomplete overlap-save block. \n \n
+
+\param  nout
+Number of the samples of the incomplete block 
+which outputs are already calculated. \n \n
+
+The structure is filled by the \ref fir_create or \ref fir_create_multi
+function and it must be cleared by the \ref fir_free function.
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\struct fir_t
+\brief Структура данных объекта потокового КИХ-фильтра
+
+Структура хранит коэффициенты, предысторию входного сигнала
+и рабочую память потокового КИХ-фильтра (см. \ref fir_filter). \n
+Фильтр с малым количеством коэффициентов рассчитывается непосредственно.
+Иначе используется метод перекрытия с накоплением: блоки из 
+`nfft - nh + 1` новых отсчетов и `nh - 1` отсчетов предыстории 
+преобразуются `nfft`-точечным БПФ вещественного сигнала, умножаются 
+на спектр фильтра, рассчитанный один раз функцией \ref fir_create, 
+и преобразуются обратно ОБПФ вещественного сигнала. \n
+Многоканальный фильтр (см. \ref fir_create_multi) рассчитывается
+непосредственно, отсчет `k` канала `c` хранится в `buf[k*nch + c]`.
+
+\param  h
+Указатель на коэффициенты фильтра в обратном порядке. \n
+Размер вектора `[nh x 1]`. \n \n
+
+\param  buf
+Указатель на входной буфер: предысторию фильтра из `nh - 1` отсчетов
+и новые отсчеты. \n
+Размер вектора `[(nh - 1 + FIR_BLOCK) * nch x 1]` при непосредственном расчете
+(размер блока `FIR_BLOCK` задается библиотекой)
+или `[nfft x 1]` при расчете с использованием БПФ. \n \n
+
+\param  t
+Указатель на рабочую память выхода ОБПФ. \n
+Размер вектора `[nfft x 1]`, `NULL` при непосредственном расчете. \n \n
+
+\param  hf
+Указатель на спектр фильтра. \n
+Размер вектора `[nfft/2+1 x 1]`, `NULL` при непосредственном расчете. \n \n
+
+\param  xf
+Указатель на рабочую память спектра входного блока. \n
+Размер вектора `[nfft/2+1 x 1]`, `NULL` при непосредственном расчете. \n \n
+
+\param  fft
+Объект `nfft`-точечного БПФ. \n \n
+
+\param  nh
+Количество коэффициентов фильтра. \n \n
+
+\param  nfft
+Размер БПФ метода перекрытия с накоплением, 
+ноль при непосредственном расчете. \n \n
+
+\param  nch
+Количество каналов. \n \n
+
+\param  pos
+Количество новых отсчетов незавершенного блока. \n \n
+
+\param  nout
+Количество отсчетов незавершенного блока, 
+выходные отсчеты которых уже рассчитаны. \n \n
+
+Структура заполняется функцией \ref fir_create или \ref fir_create_multi
+и должна быть очищена функцией \ref fir_free.
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    double*     h;
+    double*     buf;
+    double*     t;
+    complex_t*  hf;
+    complex_t*  xf;
+    fft_t       fft;
+    int         nh;
+    int         nfft;
+    int         nch;
+    int         pos;
+    int         nout;
+} fir_t;
+
+
+
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\struct iir_t
+\brief Streaming IIR filter object data structure
+
+The structure stores the normalized coefficients and the delay line
+of the streaming IIR filter (see \ref iir_filter). \n
+The delay line is the circular buffer stored twice, so the 
+`ord + 1` delayed samples \f$ w(k-m) \f$, \f$ m = 0 \ldots ord \f$, 
+are always read as the contiguous vector `w + pos`. \n
+The delay line sample \f$ w(k-m) \f$ of the channel `c` 
+of the multichannel filter (see \ref iir_create_multi) is stored 
+in the `w[(pos+m)*nch + c]`.
+
+\param  b
+Pointer to the transfer function numerator coefficients
+divided by \f$ a_0 \f$. \n
+Vector size is `[ord + 1 x 1]`. \n \n
+
+\param  a
+Pointer to the transfer function denominator coefficients
+divided by \f$ a_0 \f$ (zeros for the FIR filter). \n
+Vector size is `[ord + 1 x 1]`. \n \n
+
+\param  w
+Pointer to the delay line. \n
+Vector size is `[2*(ord + 1) * nch x 1]`. \n \n
+
+\param  ord
+Filter order. \n \n
+
+\param  nch
+Number of the channels. \n \n
+
+\param  pos
+Index of the last delay line sample \f$ w(k) \f$. \n \n
+
+The structure is filled by the \ref iir_create or \ref iir_create_multi
+function and it must be cleared by the \ref iir_free function.
+
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\struct iir_t
+\brief Структура данных объекта потокового БИХ-фильтра
+
+Структура хранит нормированные коэффициенты и линию задержки
+потокового БИХ-фильтра (см. \ref iir_filter). \n
+Линия задержки --- кольцевой буфер, хранимый дважды, поэтому
+`ord + 1` задержанных отсчетов \f$ w(k-m) \f$, 
+\f$ m = 0 \ldots ord \f$, всегда читаются как непрерывный вектор `w + pos`. \n
+Отсчет линии задержки \f$ w(k-m) \f$ канала `c` многоканального фильтра
+(см. \ref iir_create_multi) хранится в `w[(pos+m)*nch + c]`.
+
+\param  b
+Указатель на коэффициенты числителя передаточной характеристики,
+деленные на \f$ a_0 \f$. \n
+Размер вектора `[ord + 1 x 1]`. \n \n
+
+\param  a
+Указатель на коэффициенты знаменателя передаточной характеристики,
+деленные на \f$ a_0 \f$ (нули для КИХ-фильтра). \n
+Размер вектора `[ord + 1 x 1]`. \n \n
+
+\param  w
+Указатель на линию задержки. \n
+Размер вектора `[2*(ord + 1) * nch x 1]`. \n \n
+
+\param  ord
+Порядок фильтра. \n \n
+
+\param  nch
+Количество каналов. \n \n
+
+\param  pos
+Индекс последнего отсчета линии задержки \f$ w(k) \f$. \n \n
+
+Структура заполняется функцией \ref iir_create или \ref iir_create_multi
+и должна быть очищена функцией \ref iir_free.
+
+\author
+Бахурин Сергей.
+www.dsplib.org
+***************************************************************************** */
+#endif
+typedef struct
+{
+    double*     b;
+    double*     a;
+    double*     w;
+    int         ord;
+    int         nch;
+    int         pos;
+} iir_t;
+
 
-\param w64
-Статический вектор поворотных коэффициентов 64-точечного БПФ. \n \n
 
-\param w128
-Статический вектор поворотных коэффициентов 128-точечного БПФ. \n \n
+#ifdef DOXYGEN_ENGLISH
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\struct sos_t
+\brief Streaming second-order sections cascade object data structure
 
-\param w256
-Статический вектор поворотных коэффициентов 256-точечного БПФ. \n \n
+The structure stores the normalized coefficients and the state 
+of the second-order sections of the streaming IIR filter 
+(see \ref sos_filter).
 
-\param w512
-Статический вектор поворотных коэффициентов 512-точечного БПФ. \n \n
+\param  c
+Pointer to the normalized sections coefficients. \n
+`c[5*s]` ... `c[5*s+4]` are \f$ b_0, b_1, b_2, a_1, a_2 \f$ 
+of the section `s` divided by \f$ a_0 \f$. \n
+Vector size is `[5*ns x 1]`. \n \n
 
-\param w1024
-Статический вектор поворотных коэффициентов 1024-точечного БПФ. \n \n
+\param  w
+Pointer to the sections state. \n
+`w[2*s]` and `w[2*s+1]` are the two state variables of the 
+transposed direct form II of the section `s`. \n
+Vector size is `[2*ns x 1]`. \n \n
 
-\param w2048
-Статический вектор поворотных коэффициентов 2048-точечного БПФ. \n \n
+\param  ns
+Number of the sections. \n \n
 
-\param w4096
-Статический вектор поворотных коэффициентов 4096-точечного БПФ. \n \n
+The structure is filled by the \ref sos_create function 
+and it must be cleared by the \ref sos_free function.
 
+\author  Sergey Bakhurin  www.dsplib.org
+***************************************************************************** */
+#endif
+#ifdef DOXYGEN_RUSSIAN
+/*! ****************************************************************************
+\ingroup FILTER_CONV_GROUP
+\struct sos_t
+\brief Структура данных объекта потокового каскада звеньев второго порядка
 
-Структура заполняется функцией \ref fft_create один раз
-до использования алгоритма БПФ.  \n
-Указатель на объект данной структуры может быть
-многократно использован при вызове функций БПФ. \n
-Перед выходом из программы выделенную память под поворотные
-коэффициенты и массивы промежуточных данных
-необходимо очистить функцией \ref fft_free. Например:
-\code
-fft_t pfft = {0};     // объявляем объект fft_t и обнуляем все поля
-int n = 64;           // Размер БПФ
-int err;
+Структура хранит нормированные коэффициенты и состояние звеньев 
+второго порядка потокового БИХ-фильтра (см. \ref sos_filter).
 
-// создаем объект для 64-точечного БПФ
-err = fft_create(&pfft, n);
+\param  c
+Указатель на нормированные коэффициенты звеньев. \n
+`c[5*s]` ... `c[5*s+4]` --- коэффициенты \f$ b_0, b_1, b_2, a_1, a_2 \f$ 
+звена `s`, деленные на \f$ a_0 \f$. \n
+Размер вектора `[5*ns x 1]`. \n \n
 
-// Вызов БПФ функции
-// Еще раз вызов БПФ функции
-// ...
+\param  w
+Указатель на состояние звеньев. \n
+`w[2*s]` и `w[2*s+1]` --- две переменные состояния транспонированной 
+прямой формы II звена `s`. \n
+Размер вектора `[2*ns x 1]`. \n \n
 
-// очистить память объекта БПФ
-fft_free(&pfft);
-\endcode
+\param  ns
+Количество звеньев. \n \n
 
-\note
-Важно отметить, что если объект `fft_t` был создан для размера БПФ равного `n`,
-то он может быть использован только для БПФ размера `n`.  \n\n
-Также необходимо заметить, что функции БПФ самостоятельно контролируют размер,
-и самостоятельно выделяют память объекта БПФ при необходимости.
-Так если вызвать любую функцию использующую структуру `fft_t` с заполненными
-данными для длины БПФ `k` для расчета БПФ длины `n`,
-то массивы структуры будут автоматически пересозданы для длины `n`.
+Структура заполняется функцией \ref sos_create
+и должна быть очищена функцией \ref sos_free.
 
 \author
 Бахурин Сергей.
@@ -297,21 +1672,10 @@ www.dsplib.org
 #endif
 typedef struct
 {
-    complex_t*  w;
-    complex_t*  t0;
-    complex_t*  t1;
-   
-    /* radix-2 twiddle factors vectors */
-    complex_t    w32[ 32];
-    complex_t    w64[ 64];
-    complex_t   w128[128];
-    complex_t   w256[256];
-    complex_t   w512[512];
-    complex_t*  w1024;
-    complex_t*  w2048;
-    complex_t*  w4096;
-    int         n;
-} fft_t;
+    double*     c;
+    double*     w;
+    int         ns;
+} sos_t;
 
 
 
@@ -589,7 +1953,9 @@ Variable `z = 1-2j`, here `j` - imaginary unit, but variable `y = 5`.
 /* E                                          0x05xxxxxx*/
 #define ERROR_ELLIP_MODULE                    0x05121315
 /* F                                          0x06xxxxxx*/
+#define ERROR_FFT_ISA                         0x06060919
 #define ERROR_FFT_SIZE                        0x06062021
+#define ERROR_FFT_WISDOM                      0x06062309
 #define ERROR_FILTER_A0                       0x06090100
 #define ERROR_FILTER_APPROX                   0x06090116
 #define ERROR_FILTER_FT                       0x06090620
@@ -713,6 +2079,25 @@ Variable `z = 1-2j`, here `j` - imaginary unit, but variable `y = 5`.
 #define DSPL_XCORR_UNBIASED                   0x00000002
 
 
+#define DSPL_ISA_AUTO                         0x00000000
+#define DSPL_ISA_SCALAR                       0x00000001
+#define DSPL_ISA_SSE2                         0x00000002
+#define DSPL_ISA_AVX2                         0x00000003
+#define DSPL_ISA_AVX512                       0x00000004
+
+/* FFT names of the instruction sets (see dspl_set_isa) */
+#define FFT_ISA_AUTO                          DSPL_ISA_AUTO
+#define FFT_ISA_SCALAR                        DSPL_ISA_SCALAR
+#define FFT_ISA_SSE2                          DSPL_ISA_SSE2
+#define FFT_ISA_AVX2                          DSPL_ISA_AVX2
+#define FFT_ISA_AVX512                        DSPL_ISA_AVX512
+
+#define DSPL_DCT2                             0x00000002
+#define DSPL_DCT3                             0x00000003
+#define DSPL_DCT4                             0x00000004
+#define DSPL_DST2                             0x00000012
+
+
 
 #define ELLIP_ITER                            16
 #define ELLIP_MAX_ORD                         24
@@ -899,6 +2284,40 @@ DECLARE_FUNC(int,        cos_cmplx,                   complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        czt_cmplx,                   complex_t*       x
+                                                COMMA czt_t*           pczt
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        czt_create,                  czt_t*           pczt
+                                                COMMA int              n
+                                                COMMA int              m
+                                                COMMA complex_t        w
+                                                COMMA complex_t        a);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       czt_free,                    czt_t*           pczt);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dct_batch,                   double*          x
+                                                COMMA int              n
+                                                COMMA int              cnt
+                                                COMMA int              type
+                                                COMMA fft_t*           pfft
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dct2,                        double*          x
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dct3,                        double*          x
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dct4,                        double*          x
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        decimate,                    double*           x
                                                 COMMA int               n
                                                 COMMA int               d
@@ -922,8 +2341,17 @@ DECLARE_FUNC(int,        dft_cmplx,                   complex_t*
 DECLARE_FUNC(double,     dmod,                        double
                                                 COMMA double);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dspl_get_isa,                void);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(void,       dspl_info,                   void);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dspl_set_isa,                int               isa);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dst,                         double*          x
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        ellip_acd,                   double*           w
                                                 COMMA int               n
                                                 COMMA double            k
@@ -1030,16 +2458,51 @@ DECLARE_FUNC(int,        fft_abs_cmplx,               complex_t*       x
                                                 COMMA double*          mag
                                                 COMMA double*          freq);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_batch,                   double*           x
+                                                COMMA int               n
+                                                COMMA int               cnt
+                                                COMMA int               stride
+                                                COMMA int               dist
+                                                COMMA fft_t*            pfft
+                                                COMMA complex_t*        y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_bind,                    fft_t*            pfft
+                                                COMMA fft_plan_t*       plan);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_cache_set_size,          int              nplans);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_cache_stat,              long long*       hits
+                                                COMMA long long*       misses
+                                                COMMA int*             nplans);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        fft_cmplx,                   complex_t*
                                                 COMMA int
                                                 COMMA fft_t*
                                                 COMMA complex_t* );
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_cmplx_batch,             complex_t*        x
+                                                COMMA int               n
+                                                COMMA int               cnt
+                                                COMMA int               stride
+                                                COMMA int               dist
+                                                COMMA fft_t*            pfft
+                                                COMMA complex_t*        y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_cmplx_pruned,            complex_t*       x
+                                                COMMA int              nx
+                                                COMMA int              n
+                                                COMMA int              k0
+                                                COMMA int              ny
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        fft_create,                  fft_t*
                                                 COMMA int);
 /*----------------------------------------------------------------------------*/
 DECLARE_FUNC(void,       fft_free,                    fft_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_get_isa,                 void);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        fft_mag,                     double*          x
                                                 COMMA int              n
                                                 COMMA fft_t*           pfft
@@ -1056,6 +2519,21 @@ DECLARE_FUNC(int,        fft_mag_cmplx,               complex_t*       x
                                                 COMMA double*          mag
                                                 COMMA double*          freq);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_plan_create,             fft_plan_t*       plan
+                                                COMMA int               n);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       fft_plan_free,               fft_plan_t*       plan);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_r2c,                     double*          x
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_set_isa,                 int               isa);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_set_threads,             fft_t*           pfft
+                                                COMMA int              nthreads);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        fft_shift,                   double*
                                                 COMMA int n
                                                 COMMA double*);
@@ -1064,6 +2542,47 @@ DECLARE_FUNC(int,        fft_shift_cmplx,             complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       fft_wisdom_clear,            void);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_wisdom_load,             char*            fn);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_wisdom_measure,          int              n);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft_wisdom_save,             char*            fn);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft2,                        double*          x
+                                                COMMA int              n
+                                                COMMA int              m
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fft2_cmplx,                  complex_t*       x
+                                                COMMA int              n
+                                                COMMA int              m
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fftf,                        float*           x
+                                                COMMA int              n
+                                                COMMA fftf_t*          pfft
+                                                COMMA complexf_t*      y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fftf_cmplx,                  complexf_t*      x
+                                                COMMA int              n
+                                                COMMA fftf_t*          pfft
+                                                COMMA complexf_t*      y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fftf_create,                 fftf_t*          pfft
+                                                COMMA int              n);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       fftf_free,                   fftf_t*          pfft);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_fir_multi,            fir_t*           pfir
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA int              ld
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        filter_freq_resp,            double*          b
                                                 COMMA double*          a
                                                 COMMA int              ord
@@ -1081,6 +2600,25 @@ DECLARE_FUNC(int,        filter_iir,                  double*
                                                 COMMA int
                                                 COMMA double*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_multi,            iir_t*           piir
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA int              ld
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_sos,                  double*          b
+                                                COMMA double*          a
+                                                COMMA int              ns
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_tf2sos,               double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA double*          sb
+                                                COMMA double*          sa);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(double,     filter_ws1,                  int              ord
                                                 COMMA double           rp
                                                 COMMA double           rs
@@ -1094,6 +2632,14 @@ DECLARE_FUNC(int,        filter_zp2ab,                complex_t*
                                                 COMMA double*
                                                 COMMA double*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_zp2sos,               complex_t*       z
+                                                COMMA int              nz
+                                                COMMA complex_t*       p
+                                                COMMA int              np
+                                                COMMA double           k
+                                                COMMA double*          b
+                                                COMMA double*          a);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        find_max_abs,                double*        a
                                                 COMMA int            n
                                                 COMMA double*        m
@@ -1105,6 +2651,22 @@ DECLARE_FUNC(int,        find_nearest,                double*        x
                                                 COMMA int*           idx
                                                 COMMA double*        dist);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_create,                  fir_t*           pfir
+                                                COMMA double*          h
+                                                COMMA int              nh);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_create_multi,            fir_t*           pfir
+                                                COMMA double*          h
+                                                COMMA int              nh
+                                                COMMA int              nch);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_filter,                  fir_t*           pfir
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       fir_free,                    fir_t*           pfir);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        fir_linphase,                int            ord
                                                 COMMA double         w0
                                                 COMMA double         w1
@@ -1113,6 +2675,8 @@ DECLARE_FUNC(int,        fir_linphase,                int            ord
                                                 COMMA double         winparam
                                                 COMMA double*        h);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_reset,                   fir_t*           pfir);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        flipip,                      double*
                                                 COMMA int);
 /*----------------------------------------------------------------------------*/
@@ -1205,6 +2769,26 @@ DECLARE_FUNC(int,        goertzel_cmplx,              complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        goertzel_create,             goertzel_t*      pg
+                                                COMMA int              n
+                                                COMMA int*             ind
+                                                COMMA int              k);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       goertzel_free,               goertzel_t*      pg);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        goertzel_reset,              goertzel_t*      pg);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        goertzel_result,             goertzel_t*      pg
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        goertzel_update,             goertzel_t*      pg
+                                                COMMA double*          x
+                                                COMMA int              cnt);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        goertzel_update_cmplx,       goertzel_t*      pg
+                                                COMMA complex_t*       x
+                                                COMMA int              cnt);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        group_delay,                 double*          b
                                                 COMMA double*          a
                                                 COMMA int              ord
@@ -1229,11 +2813,35 @@ DECLARE_FUNC(int,        idft_cmplx,                  complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        ifft,                        complex_t*       x
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        ifft_cmplx,                  complex_t*
                                                 COMMA int
                                                 COMMA fft_t*
                                                 COMMA complex_t* );
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        ifft_cmplx_pruned,           complex_t*       x
+                                                COMMA int              nx
+                                                COMMA int              n
+                                                COMMA int              k0
+                                                COMMA int              ny
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        ifft2_cmplx,                 complex_t*       x
+                                                COMMA int              n
+                                                COMMA int              m
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        ifftf_cmplx,                 complexf_t*      x
+                                                COMMA int              n
+                                                COMMA fftf_t*          pfft
+                                                COMMA complexf_t*      y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        iir,                         double           rp
                                                 COMMA double           rs
                                                 COMMA int              ord
@@ -1243,6 +2851,40 @@ DECLARE_FUNC(int,        iir,                         double           rp
                                                 COMMA double*          b
                                                 COMMA double*          a);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_create,                  iir_t*           piir
+                                                COMMA double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_create_multi,            iir_t*           piir
+                                                COMMA double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA int              nch);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_filter,                  iir_t*           piir
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       iir_free,                    iir_t*           piir);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_reset,                   iir_t*           piir);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_sos,                     double           rp
+                                                COMMA double           rs
+                                                COMMA int              ord
+                                                COMMA double           w0
+                                                COMMA double           w1
+                                                COMMA int              type
+                                                COMMA double*          b
+                                                COMMA double*          a);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        istft,                       complex_t*       y
+                                                COMMA int              ncol
+                                                COMMA stft_t*          pstft
+                                                COMMA double*          x);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        linspace,                    double
                                                 COMMA double
                                                 COMMA int
@@ -1369,6 +3011,22 @@ DECLARE_FUNC(int,        minmax,                      double*          x
                                                 COMMA double*          xmin
                                                 COMMA double*          xmax);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        nufft1_cmplx,                double*          x
+                                                COMMA complex_t*       s
+                                                COMMA int              nx
+                                                COMMA int              nk
+                                                COMMA double           eps
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        nufft2_cmplx,                complex_t*       s
+                                                COMMA int              nk
+                                                COMMA double*          x
+                                                COMMA int              nx
+                                                COMMA double           eps
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        ones,                        double*          x
                                                 COMMA int              n);
 /*----------------------------------------------------------------------------*/
@@ -1517,6 +3175,19 @@ DECLARE_FUNC(int,        readbin,                     char*           fn
                                                 COMMA int*            pm
                                                 COMMA int*            dtype);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        sdft_create,                 sdft_t*          psdft
+                                                COMMA int              n
+                                                COMMA int*             ind
+                                                COMMA int              k
+                                                COMMA int              nr);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       sdft_free,                   sdft_t*          psdft);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        sdft_push,                   sdft_t*          psdft
+                                                COMMA complex_t*       x
+                                                COMMA int              cnt
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        signal_pimp,                 double*
                                                 COMMA size_t
                                                 COMMA double
@@ -1545,6 +3216,33 @@ DECLARE_FUNC(int,        sine_int,                    double*          x
                                                 COMMA int              n
                                                 COMMA double*          si);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        sos_create,                  sos_t*           psos
+                                                COMMA double*          b
+                                                COMMA double*          a
+                                                COMMA int              ns);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        sos_filter,                  sos_t*           psos
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       sos_free,                    sos_t*           psos);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        sos_reset,                   sos_t*           psos);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        spectrogram,                 double*          x
+                                                COMMA int              n
+                                                COMMA stft_t*          pstft
+                                                COMMA int              flag
+                                                COMMA double*          s);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        spectrogram_push,            stft_t*          pstft
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA int              flag
+                                                COMMA double*          s
+                                                COMMA int*             pcnt);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        sqrt_cmplx,                  complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
@@ -1557,6 +3255,25 @@ DECLARE_FUNC(int,        stat_std_cmplx,              complex_t*       x
                                                 COMMA int              n
                                                 COMMA double*          s);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        stft,                        double*          x
+                                                COMMA int              n
+                                                COMMA stft_t*          pstft
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        stft_create,                 stft_t*          pstft
+                                                COMMA int              nfft
+                                                COMMA int              hop
+                                                COMMA int              win_type
+                                                COMMA double           win_param);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       stft_free,                   stft_t*          pstft);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        stft_push,                   stft_t*          pstft
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA complex_t*       y
+                                                COMMA int*             pcnt);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        sum,                         double*          x
                                                 COMMA int              n
                                                 COMMA double*          s);
@@ -1679,6 +3396,15 @@ DECLARE_FUNC(int,        xcorr_cmplx,                 complex_t*        x
                                                 COMMA complex_t*        r
                                                 COMMA double*           t);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        zoom_fft,                    complex_t*       x
+                                                COMMA int              n
+                                                COMMA double           f0
+                                                COMMA double           f1
+                                                COMMA double           fs
+                                                COMMA int              m
+                                                COMMA czt_t*           pczt
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
 
 
 #ifdef __cplusplus
@@ -7,6 +7,7 @@
 #define NMAX 4194304
 #define L 20
 #define SIZE_FACTOR 2.3 
+#define NISA 4
 
 
 
@@ -92,22 +93,79 @@ int main(int argc, char* argv[])
     int len_nr[L] = {6, 9, 12, 15, 18, 24, 36, 80, 100, 108, 210, 504, 1000,
                     1960, 4725, 8000, 10368, 27000, 75600, 165375};
 
-    int err;
-    double   mflops[L] = {0};
-    double dlen[L];
+    /* FFT codelets instruction sets */
+    int   isa[NISA]      = {FFT_ISA_SCALAR, FFT_ISA_SSE2, 
+                            FFT_ISA_AVX2,   FFT_ISA_AVX512};
+    char* isa_name[NISA] = {"scalar", "sse2", "avx2", "avx512"};
+    int   isa_ok[NISA]   = {0};
+
+    int err, i, j, best;
+    double mflops_r2[NISA][L] = {{0}};
+    double mflops_nr[NISA][L] = {{0}};
+    double dlen_r2[L];
+    double dlen_nr[L];
+    char fn[64];
    
-    printf("\n\nDouble precision complex 1D radix-2\n");
-    fft_perf_cmplx(len_r2, dlen, mflops);
-    writetxt(dlen, mflops, L, "dat/fft_cmplx_dspl_r2.txt");
-    
-    printf("\n\nDouble precision complex 1D non-powers of two\n");
-    fft_perf_cmplx(len_nr, dlen, mflops);
-    writetxt(dlen, mflops, L, "dat/fft_cmplx_dspl_nr.txt");
+    best = fft_get_isa();
+    for(i = 0; i < NISA; i++)
+    {
+        /* FFT plans created after fft_set_isa use the isa[i] codelets */
+        err = fft_set_isa(isa[i]);
+        if(err != RES_OK)
+        {
+            printf("\n\n%s is not supported by the CPU\n", isa_name[i]);
+            continue;
+        }
+        isa_ok[i] = 1;
+
+        printf("\n\nDouble precision complex 1D radix-2 (%s)\n", 
+               isa_name[i]);
+        fft_perf_cmplx(len_r2, dlen_r2, mflops_r2[i]);
+        sprintf(fn, "dat/fft_cmplx_dspl_r2_%s.txt", isa_name[i]);
+        writetxt(dlen_r2, mflops_r2[i], L, fn);
     
+        printf("\n\nDouble precision complex 1D non-powers of two (%s)\n",
+               isa_name[i]);
+        fft_perf_cmplx(len_nr, dlen_nr, mflops_nr[i]);
+        sprintf(fn, "dat/fft_cmplx_dspl_nr_%s.txt", isa_name[i]);
+        writetxt(dlen_nr, mflops_nr[i], L, fn);
+
+        /* default instruction set results */
+        if(isa[i] == best)
+        {
+            writetxt(dlen_r2, mflops_r2[i], L, "dat/fft_cmplx_dspl_r2.txt");
+            writetxt(dlen_nr, mflops_nr[i], L, "dat/fft_cmplx_dspl_nr.txt");
+        }
+    }
+    fft_set_isa(FFT_ISA_AUTO);
+
+    /* MFlops gain of the vector codelets over the scalar codelets */
+    printf("\n\nMFlops gain over the scalar codelets\n");
+    printf("---------");
+    for(i = 1; i < NISA; i++)
+        printf("----------");
+    printf("\nFFT size ");
+    for(i = 1; i < NISA; i++)
+        printf("%10s", isa_name[i]);
+    printf("\n");
+    for(j = 0; j < 2*L; j++)
+    {
+        printf("%8d ", j < L ? len_r2[j] : len_nr[j-L]);
+        for(i = 1; i < NISA; i++)
+        {
+            if(!isa_ok[i] || !isa_ok[0])
+                printf("%10s", "-");
+            else if(j < L)
+                printf("%10.2f", mflops_r2[i][j] / mflops_r2[0][j]);
+            else
+                printf("%10.2f", mflops_nr[i][j-L] / mflops_nr[0][j-L]);
+        }
+        printf("\n");
+    }
+    err = RES_OK;
 
 exit_label:
     /* free dspl handle */
     dspl_free(hdspl);
     return err;
 }
-